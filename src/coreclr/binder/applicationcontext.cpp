@@ -15,6 +15,7 @@
 #include "assemblyhashtraits.hpp"
 #include "stringarraylist.h"
 #include "failurecache.hpp"
+#include "tpaindex.hpp"
 #include "utils.hpp"
 #include "ex.h"
 #include "clr/fs/path.h"
@@ -28,6 +29,7 @@ namespace BINDER_SPACE
         m_pFailureCache = NULL;
         m_contextCS = NULL;
         m_pTrustedPlatformAssemblyMap = nullptr;
+        m_pTrustedPlatformAssemblyIndex = nullptr;
     }
 
     ApplicationContext::~ApplicationContext()
@@ -44,6 +46,8 @@ namespace BINDER_SPACE
         {
             delete m_pTrustedPlatformAssemblyMap;
         }
+
+        SAFE_DELETE(m_pTrustedPlatformAssemblyIndex);
     }
 
     HRESULT ApplicationContext::Init()
@@ -79,6 +83,7 @@ namespace BINDER_SPACE
     }
 
     HRESULT ApplicationContext::SetupBindingPaths(SString &sTrustedPlatformAssemblies,
+                                                  SString &sTrustedPlatformAssembliesIndex,
                                                   SString &sPlatformResourceRoots,
                                                   SString &sAppPaths,
                                                   BOOL     fAcquireLock)
@@ -86,14 +91,85 @@ namespace BINDER_SPACE
         HRESULT hr = S_OK;
 
         CRITSEC_Holder contextLock(fAcquireLock ? GetCriticalSectionCookie() : NULL);
-        if (m_pTrustedPlatformAssemblyMap != nullptr)
+        if (IsTpaListProvided())
         {
             GO_WITH_HRESULT(S_OK);
         }
 
+        //
+        // Adopt a prebuilt TrustedPlatformAssemblies index if the host passed one that matches the list
+        //
+        if (!sTrustedPlatformAssembliesIndex.IsEmpty() && !Path::IsRelative(sTrustedPlatformAssembliesIndex))
+        {
+            NewHolder<TpaIndex> pIndex = new TpaIndex();
+            if (pIndex->Init(sTrustedPlatformAssembliesIndex.GetUnicode(), sTrustedPlatformAssemblies) == S_OK)
+            {
+                m_pTrustedPlatformAssemblyIndex = pIndex.Extract();
+            }
+        }
+
         //
         // Parse TrustedPlatformAssemblies
         //
+        if (m_pTrustedPlatformAssemblyIndex == nullptr)
+        {
+            IF_FAIL_GO(ParseTrustedPlatformAssemblies(sTrustedPlatformAssemblies));
+        }
+
+        //
+        // Parse PlatformResourceRoots
+        //
+        sPlatformResourceRoots.Normalize();
+        for (SString::Iterator i = sPlatformResourceRoots.Begin(); i != sPlatformResourceRoots.End(); )
+        {
+            SString pathName;
+            HRESULT pathResult = S_OK;
+
+            IF_FAIL_GO(pathResult = GetNextPath(sPlatformResourceRoots, i, pathName));
+            if (pathResult == S_FALSE)
+            {
+                break;
+            }
+
+            if (Path::IsRelative(pathName))
+            {
+                GO_WITH_HRESULT(E_INVALIDARG);
+            }
+
+            m_platformResourceRoots.Append(pathName);
+        }
+
+        //
+        // Parse AppPaths
+        //
+        sAppPaths.Normalize();
+        for (SString::Iterator i = sAppPaths.Begin(); i != sAppPaths.End(); )
+        {
+            SString pathName;
+            HRESULT pathResult = S_OK;
+
+            IF_FAIL_GO(pathResult = GetNextPath(sAppPaths, i, pathName));
+            if (pathResult == S_FALSE)
+            {
+                break;
+            }
+
+            if (Path::IsRelative(pathName))
+            {
+                GO_WITH_HRESULT(E_INVALIDARG);
+            }
+
+            m_appPaths.Append(pathName);
+        }
+
+    Exit:
+        return hr;
+    }
+
+    HRESULT ApplicationContext::ParseTrustedPlatformAssemblies(SString &sTrustedPlatformAssemblies)
+    {
+        HRESULT hr = S_OK;
+
         m_pTrustedPlatformAssemblyMap = new SimpleNameToFileNameMap();
 
         sTrustedPlatformAssemblies.Normalize();
@@ -165,58 +241,30 @@ namespace BINDER_SPACE
             m_pTrustedPlatformAssemblyMap->AddOrReplace(mapEntry);
         }
 
-        //
-        // Parse PlatformResourceRoots
-        //
-        sPlatformResourceRoots.Normalize();
-        for (SString::Iterator i = sPlatformResourceRoots.Begin(); i != sPlatformResourceRoots.End(); )
-        {
-            SString pathName;
-            HRESULT pathResult = S_OK;
-
-            IF_FAIL_GO(pathResult = GetNextPath(sPlatformResourceRoots, i, pathName));
-            if (pathResult == S_FALSE)
-            {
-                break;
-            }
+    Exit:
+        return hr;
+    }
 
-            if (Path::IsRelative(pathName))
-            {
-                GO_WITH_HRESULT(E_INVALIDARG);
-            }
+    bool ApplicationContext::IsTpaListProvided()
+    {
+        return (m_pTrustedPlatformAssemblyMap != nullptr) || (m_pTrustedPlatformAssemblyIndex != nullptr);
+    }
 
-            m_platformResourceRoots.Append(pathName);
+    bool ApplicationContext::LookupTpaEntry(PCWSTR                        pwzSimpleName,
+                                            SimpleNameToFileNameMapEntry *pEntry)
+    {
+        if (m_pTrustedPlatformAssemblyIndex != nullptr)
+        {
+            return m_pTrustedPlatformAssemblyIndex->Lookup(pwzSimpleName, pEntry);
         }
 
-        //
-        // Parse AppPaths
-        //
-        sAppPaths.Normalize();
-        for (SString::Iterator i = sAppPaths.Begin(); i != sAppPaths.End(); )
+        const SimpleNameToFileNameMapEntry *pMapEntry = m_pTrustedPlatformAssemblyMap->LookupPtr(pwzSimpleName);
+        if (pMapEntry == nullptr)
         {
-            SString pathName;
-            HRESULT pathResult = S_OK;
-
-            IF_FAIL_GO(pathResult = GetNextPath(sAppPaths, i, pathName));
-            if (pathResult == S_FALSE)
-            {
-                break;
-            }
-
-            if (Path::IsRelative(pathName))
-            {
-                GO_WITH_HRESULT(E_INVALIDARG);
-            }
-
-            m_appPaths.Append(pathName);
+            return false;
         }
 
-    Exit:
-        return hr;
-    }
-
-    bool ApplicationContext::IsTpaListProvided()
-    {
-        return m_pTrustedPlatformAssemblyMap != nullptr;
+        *pEntry = *pMapEntry;
+        return true;
     }
 };
@@ -889,8 +889,9 @@ namespace BINDER_SPACE
             }
 
             // Is assembly on TPA list?
-            SimpleNameToFileNameMap * tpaMap = pApplicationContext->GetTpaList();
-            const SimpleNameToFileNameMapEntry *pTpaEntry = tpaMap->LookupPtr(simpleName.GetUnicode());
+            SimpleNameToFileNameMapEntry tpaEntry;
+            const SimpleNameToFileNameMapEntry *pTpaEntry =
+                pApplicationContext->LookupTpaEntry(simpleName.GetUnicode(), &tpaEntry) ? &tpaEntry : nullptr;
             if (pTpaEntry != nullptr)
             {
                 if (pTpaEntry->m_wszNIFileName != nullptr)
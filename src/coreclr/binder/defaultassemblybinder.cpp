@@ -141,8 +141,8 @@ HRESULT DefaultAssemblyBinder::BindUsingPEImage( /* in */ PEImage *pPEImage,
             // Ensure we are not being asked to bind to a TPA assembly
             //
             const SString& simpleName = pAssemblyName->GetSimpleName();
-            SimpleNameToFileNameMap* tpaMap = GetAppContext()->GetTpaList();
-            if (tpaMap->LookupPtr(simpleName.GetUnicode()) != NULL)
+            SimpleNameToFileNameMapEntry tpaEntry;
+            if (GetAppContext()->LookupTpaEntry(simpleName.GetUnicode(), &tpaEntry))
             {
                 // The simple name of the assembly being requested to be bound was found in the TPA list.
                 // Now, perform the actual bind to see if the assembly was really in the TPA assembly list or not.
@@ -174,6 +174,7 @@ Exit:;
 #endif // !defined(DACCESS_COMPILE)
 
 HRESULT DefaultAssemblyBinder::SetupBindingPaths(SString  &sTrustedPlatformAssemblies,
+                                                SString  &sTrustedPlatformAssembliesIndex,
                                                 SString  &sPlatformResourceRoots,
                                                 SString  &sAppPaths)
 {
@@ -181,7 +182,7 @@ HRESULT DefaultAssemblyBinder::SetupBindingPaths(SString  &sTrustedPlatformAssem
 
     EX_TRY
     {
-        hr = GetAppContext()->SetupBindingPaths(sTrustedPlatformAssemblies, sPlatformResourceRoots, sAppPaths, TRUE /* fAcquireLock */);
+        hr = GetAppContext()->SetupBindingPaths(sTrustedPlatformAssemblies, sTrustedPlatformAssembliesIndex, sPlatformResourceRoots, sAppPaths, TRUE /* fAcquireLock */);
     }
     EX_CATCH_HRESULT(hr);
     return hr;
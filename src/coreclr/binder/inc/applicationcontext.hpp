@@ -81,6 +81,8 @@ namespace BINDER_SPACE
     class AssemblyHashTraits;
     typedef SHash<AssemblyHashTraits> ExecutionContext;
 
+    class TpaIndex;
+
     class ApplicationContext
     {
     public:
@@ -92,6 +94,7 @@ namespace BINDER_SPACE
         inline SString &GetApplicationName();
 
         HRESULT SetupBindingPaths(/* in */ SString &sTrustedPlatformAssemblies,
+                                  /* in */ SString &sTrustedPlatformAssembliesIndex,
                                   /* in */ SString &sPlatformResourceRoots,
                                   /* in */ SString &sAppPaths,
                                   /* in */ BOOL     fAcquireLock);
@@ -102,7 +105,8 @@ namespace BINDER_SPACE
         inline HRESULT AddToFailureCache(SString &assemblyNameOrPath,
                                          HRESULT  hrBindResult);
         inline StringArrayList *GetAppPaths();
-        inline SimpleNameToFileNameMap *GetTpaList();
+        bool LookupTpaEntry(/* in */  PCWSTR                        pwzSimpleName,
+                            /* out */ SimpleNameToFileNameMapEntry *pEntry);
         inline StringArrayList *GetPlatformResourceRoots();
 
         // Using a host-configured Trusted Platform Assembly list
@@ -112,6 +116,8 @@ namespace BINDER_SPACE
         inline void IncrementVersion();
 
     private:
+        HRESULT ParseTrustedPlatformAssemblies(/* in */ SString &sTrustedPlatformAssemblies);
+
         Volatile<LONG>     m_cVersion;
         SString            m_applicationName;
         ExecutionContext  *m_pExecutionContext;
@@ -122,6 +128,8 @@ namespace BINDER_SPACE
         StringArrayList    m_appPaths;
 
         SimpleNameToFileNameMap * m_pTrustedPlatformAssemblyMap;
+        // Prebuilt index adopted instead of m_pTrustedPlatformAssemblyMap when the host provides one
+        TpaIndex                * m_pTrustedPlatformAssemblyIndex;
     };
 
 #include "applicationcontext.inl"
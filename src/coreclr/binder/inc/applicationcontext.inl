@@ -53,11 +53,6 @@ StringArrayList *ApplicationContext::GetAppPaths()
     return &m_appPaths;
 }
 
-SimpleNameToFileNameMap * ApplicationContext::GetTpaList()
-{
-    return m_pTrustedPlatformAssemblyMap;
-}
-
 StringArrayList * ApplicationContext::GetPlatformResourceRoots()
 {
     return &m_platformResourceRoots;
@@ -36,6 +36,7 @@ public:
 public:
 
     HRESULT SetupBindingPaths(SString  &sTrustedPlatformAssemblies,
+                              SString  &sTrustedPlatformAssembliesIndex,
                               SString  &sPlatformResourceRoots,
                               SString  &sAppPaths);
 
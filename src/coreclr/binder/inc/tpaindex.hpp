@@ -0,0 +1,95 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// ============================================================
+//
+// TpaIndex.hpp
+//
+
+
+//
+// Defines the TpaIndex class
+//
+// ============================================================
+
+#ifndef __BINDER__TPA_INDEX_HPP__
+#define __BINDER__TPA_INDEX_HPP__
+
+#include "applicationcontext.hpp"
+
+//
+// A prebuilt, memory mapped index of the trusted platform assemblies (TPA) list.
+//
+// A host passes the absolute path of the index in the TRUSTED_PLATFORM_ASSEMBLIES_INDEX property,
+// next to the TRUSTED_PLATFORM_ASSEMBLIES list the index was generated from (for instance at publish
+// time). When the index matches that list, the binder looks simple names up in the mapped file
+// instead of parsing the list into a SimpleNameToFileNameMap.
+//
+// Layout (little endian, offsets in bytes from the start of the file):
+//
+//   TpaIndexHeader
+//   TpaIndexEntry[bucketCount]     at entriesOffset; open addressing with linear probing
+//   WCHAR[]                        at stringsOffset; NUL terminated UTF-16 strings
+//
+// Hashes are 32-bit FNV-1a over UTF-16 code units. tpaListHash covers the TPA list exactly as the
+// host passes it; nameHash covers the simple name with ASCII letters folded to upper case. The
+// generator is expected to apply the same rules as the parsing path: the first IL and the first
+// native image seen for a simple name win.
+//
+
+#define TPA_INDEX_SIGNATURE     0x58444954  // 'TIDX'
+#define TPA_INDEX_VERSION       1
+#define TPA_INDEX_NO_STRING     0xFFFFFFFF
+
+namespace BINDER_SPACE
+{
+    struct TpaIndexHeader
+    {
+        uint32_t signature;
+        uint32_t version;
+        uint32_t tpaListLength;     // in WCHARs
+        uint32_t tpaListHash;
+        uint32_t entryCount;
+        uint32_t bucketCount;       // power of 2, greater than entryCount
+        uint32_t entriesOffset;
+        uint32_t stringsOffset;
+        uint32_t stringsLength;     // in WCHARs
+    };
+
+    // String offsets are in WCHARs from stringsOffset, or TPA_INDEX_NO_STRING
+    struct TpaIndexEntry
+    {
+        uint32_t nameHash;
+        uint32_t simpleNameOffset;  // TPA_INDEX_NO_STRING for an empty bucket
+        uint32_t ilFileNameOffset;
+        uint32_t niFileNameOffset;
+    };
+
+    class TpaIndex
+    {
+    public:
+        TpaIndex();
+
+        // Maps the index and validates it against the TPA list. Returns S_FALSE if the index
+        // doesn't match the list and the list has to be parsed instead.
+        HRESULT Init(/* in */ LPCWSTR  pwzIndexPath,
+                     /* in */ SString &sTrustedPlatformAssemblies);
+
+        bool Lookup(/* in */  PCWSTR                        pwzSimpleName,
+                    /* out */ SimpleNameToFileNameMapEntry *pEntry) const;
+
+        static uint32_t HashSimpleName(PCWSTR pwzSimpleName);
+
+    private:
+        LPWSTR GetString(uint32_t offset) const;
+
+        HandleHolder            m_hFile;
+        HandleHolder            m_hFileMap;
+        MapViewHolder           m_pView;
+
+        const TpaIndexHeader   *m_pHeader;
+        const TpaIndexEntry    *m_pEntries;
+        const WCHAR            *m_pStrings;
+    };
+};
+
+#endif
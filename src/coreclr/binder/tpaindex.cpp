@@ -0,0 +1,183 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// ============================================================
+//
+// TpaIndex.cpp
+//
+
+
+//
+// Implements the TpaIndex class
+//
+// ============================================================
+
+#include "tpaindex.hpp"
+#include "ex.h"
+
+namespace
+{
+    const uint32_t FnvOffsetBasis = 2166136261u;
+    const uint32_t FnvPrime = 16777619u;
+}
+
+namespace BINDER_SPACE
+{
+    TpaIndex::TpaIndex()
+    {
+        m_pHeader = nullptr;
+        m_pEntries = nullptr;
+        m_pStrings = nullptr;
+    }
+
+    HRESULT TpaIndex::Init(LPCWSTR  pwzIndexPath,
+                           SString &sTrustedPlatformAssemblies)
+    {
+        HRESULT hr = S_OK;
+
+        m_hFile = WszCreateFile(pwzIndexPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (m_hFile == INVALID_HANDLE_VALUE)
+        {
+            return HRESULT_FROM_GetLastError();
+        }
+
+        DWORD dwFileSizeHigh = 0;
+        DWORD dwFileSize = GetFileSize(m_hFile, &dwFileSizeHigh);
+        if ((dwFileSize == INVALID_FILE_SIZE) || (dwFileSizeHigh != 0) || (dwFileSize < sizeof(TpaIndexHeader)))
+        {
+            return S_FALSE;
+        }
+
+        m_hFileMap = CreateFileMapping(m_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (m_hFileMap == NULL)
+        {
+            return HRESULT_FROM_GetLastError();
+        }
+
+        m_pView = MapViewOfFile(m_hFileMap, FILE_MAP_READ, 0, 0, 0);
+        if (m_pView == NULL)
+        {
+            return HRESULT_FROM_GetLastError();
+        }
+
+        const BYTE *pBase = (const BYTE *)m_pView.GetValue();
+        const TpaIndexHeader *pHeader = (const TpaIndexHeader *)pBase;
+
+        if ((pHeader->signature != TPA_INDEX_SIGNATURE) ||
+            (pHeader->version != TPA_INDEX_VERSION) ||
+            (pHeader->bucketCount == 0) ||
+            ((pHeader->bucketCount & (pHeader->bucketCount - 1)) != 0) ||
+            (pHeader->entryCount >= pHeader->bucketCount) ||
+            ((pHeader->entriesOffset % sizeof(uint32_t)) != 0) ||
+            ((pHeader->stringsOffset % sizeof(WCHAR)) != 0) ||
+            (pHeader->stringsLength == 0))
+        {
+            return S_FALSE;
+        }
+
+        // Make sure both tables lie within the file
+        UINT64 entriesEnd = (UINT64)pHeader->entriesOffset + (UINT64)pHeader->bucketCount * sizeof(TpaIndexEntry);
+        UINT64 stringsEnd = (UINT64)pHeader->stringsOffset + (UINT64)pHeader->stringsLength * sizeof(WCHAR);
+        if ((pHeader->entriesOffset < sizeof(TpaIndexHeader)) || (entriesEnd > dwFileSize) ||
+            (pHeader->stringsOffset < sizeof(TpaIndexHeader)) || (stringsEnd > dwFileSize))
+        {
+            return S_FALSE;
+        }
+
+        const WCHAR *pStrings = (const WCHAR *)(pBase + pHeader->stringsOffset);
+
+        // Every string offset below the length then finds a terminator
+        if (pStrings[pHeader->stringsLength - 1] != W('\0'))
+        {
+            return S_FALSE;
+        }
+
+        // The index is only usable for the TPA list it was generated from
+        COUNT_T tpaListLength = sTrustedPlatformAssemblies.GetCount();
+        if (tpaListLength != pHeader->tpaListLength)
+        {
+            return S_FALSE;
+        }
+
+        uint32_t tpaListHash = FnvOffsetBasis;
+        PCWSTR pwzTpaList = sTrustedPlatformAssemblies.GetUnicode();
+        for (COUNT_T i = 0; i < tpaListLength; i++)
+        {
+            tpaListHash = (tpaListHash ^ (uint32_t)pwzTpaList[i]) * FnvPrime;
+        }
+
+        if (tpaListHash != pHeader->tpaListHash)
+        {
+            return S_FALSE;
+        }
+
+        m_pHeader = pHeader;
+        m_pEntries = (const TpaIndexEntry *)(pBase + pHeader->entriesOffset);
+        m_pStrings = pStrings;
+
+        return hr;
+    }
+
+    uint32_t TpaIndex::HashSimpleName(PCWSTR pwzSimpleName)
+    {
+        uint32_t hash = FnvOffsetBasis;
+        for (PCWSTR pwz = pwzSimpleName; *pwz != W('\0'); pwz++)
+        {
+            WCHAR wc = *pwz;
+            if ((wc >= W('a')) && (wc <= W('z')))
+            {
+                wc = (WCHAR)(wc - W('a') + W('A'));
+            }
+            hash = (hash ^ (uint32_t)wc) * FnvPrime;
+        }
+        return hash;
+    }
+
+    LPWSTR TpaIndex::GetString(uint32_t offset) const
+    {
+        if (offset >= m_pHeader->stringsLength)
+        {
+            return nullptr;
+        }
+
+        // Entries keep the same (writable) type as in the parsed map, but callers only read them
+        return const_cast<LPWSTR>(m_pStrings + offset);
+    }
+
+    bool TpaIndex::Lookup(PCWSTR                        pwzSimpleName,
+                          SimpleNameToFileNameMapEntry *pEntry) const
+    {
+        _ASSERTE(m_pHeader != nullptr);
+
+        uint32_t hash = HashSimpleName(pwzSimpleName);
+        uint32_t mask = m_pHeader->bucketCount - 1;
+
+        for (uint32_t probe = 0, bucket = hash & mask; probe < m_pHeader->bucketCount; probe++, bucket = (bucket + 1) & mask)
+        {
+            const TpaIndexEntry &entry = m_pEntries[bucket];
+            if (entry.simpleNameOffset == TPA_INDEX_NO_STRING)
+            {
+                return false;
+            }
+
+            if (entry.nameHash != hash)
+            {
+                continue;
+            }
+
+            LPWSTR wszSimpleName = GetString(entry.simpleNameOffset);
+            if ((wszSimpleName == nullptr) || (SString::_wcsicmp(wszSimpleName, pwzSimpleName) != 0))
+            {
+                continue;
+            }
+
+            pEntry->m_wszSimpleName = wszSimpleName;
+            pEntry->m_wszILFileName = GetString(entry.ilFileNameOffset);
+            pEntry->m_wszNIFileName = GetString(entry.niFileNameOffset);
+
+            // A usable entry names at least one file
+            return (pEntry->m_wszILFileName != nullptr) || (pEntry->m_wszNIFileName != nullptr);
+        }
+
+        return false;
+    }
+};
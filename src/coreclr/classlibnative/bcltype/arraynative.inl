@@ -13,6 +13,10 @@
 
 #include "gchelpers.inl"
 
+// Copies and clears of at least this many bytes use non-temporal stores where they are available. A block
+// this large would evict most of the last level cache for data that is unlikely to be read back soon.
+static const size_t NonTemporalStoreThreshold = 32 * 1024 * 1024;
+
 FORCEINLINE void InlinedForwardGCSafeCopyHelper(void *dest, const void *src, size_t len)
 {
     CONTRACTL
@@ -88,17 +92,37 @@ FORCEINLINE void InlinedForwardGCSafeCopyHelper(void *dest, const void *src, siz
 
         // Copy 32 bytes at a time
         _ASSERTE(len >= 4 * sizeof(SIZE_T));
-        do
+        if (len >= NonTemporalStoreThreshold)
         {
-            __m128 v = _mm_loadu_ps((float *)sptr);
-            _mm_store_ps((float *)dptr, v);
-            v = _mm_loadu_ps((float *)(sptr + 2));
-            _mm_store_ps((float *)(dptr + 2), v);
-
-            sptr += 4;
-            dptr += 4;
-            len -= 4 * sizeof(SIZE_T);
-        } while (len >= 4 * sizeof(SIZE_T));
+            do
+            {
+                __m128 v = _mm_loadu_ps((float *)sptr);
+                _mm_stream_ps((float *)dptr, v);
+                v = _mm_loadu_ps((float *)(sptr + 2));
+                _mm_stream_ps((float *)(dptr + 2), v);
+
+                sptr += 4;
+                dptr += 4;
+                len -= 4 * sizeof(SIZE_T);
+            } while (len >= 4 * sizeof(SIZE_T));
+
+            // Non-temporal stores are weakly ordered, they have to be visible before the cards are set
+            _mm_sfence();
+        }
+        else
+        {
+            do
+            {
+                __m128 v = _mm_loadu_ps((float *)sptr);
+                _mm_store_ps((float *)dptr, v);
+                v = _mm_loadu_ps((float *)(sptr + 2));
+                _mm_store_ps((float *)(dptr + 2), v);
+
+                sptr += 4;
+                dptr += 4;
+                len -= 4 * sizeof(SIZE_T);
+            } while (len >= 4 * sizeof(SIZE_T));
+        }
         if (len == 0)
         {
             return;
@@ -225,18 +249,39 @@ FORCEINLINE void InlinedBackwardGCSafeCopyHelper(void *dest, const void *src, si
 
         // Copy 32 bytes at a time
         _ASSERTE(len >= 4 * sizeof(SIZE_T));
-        do
+        if (len >= NonTemporalStoreThreshold)
         {
-            sptr -= 4;
-            dptr -= 4;
+            do
+            {
+                sptr -= 4;
+                dptr -= 4;
 
-            __m128 v = _mm_loadu_ps((float *)(sptr + 2));
-            _mm_store_ps((float *)(dptr + 2), v);
-            v = _mm_loadu_ps((float *)sptr);
-            _mm_store_ps((float *)dptr, v);
+                __m128 v = _mm_loadu_ps((float *)(sptr + 2));
+                _mm_stream_ps((float *)(dptr + 2), v);
+                v = _mm_loadu_ps((float *)sptr);
+                _mm_stream_ps((float *)dptr, v);
 
-            len -= 4 * sizeof(SIZE_T);
-        } while (len >= 4 * sizeof(SIZE_T));
+                len -= 4 * sizeof(SIZE_T);
+            } while (len >= 4 * sizeof(SIZE_T));
+
+            // Non-temporal stores are weakly ordered, they have to be visible before the cards are set
+            _mm_sfence();
+        }
+        else
+        {
+            do
+            {
+                sptr -= 4;
+                dptr -= 4;
+
+                __m128 v = _mm_loadu_ps((float *)(sptr + 2));
+                _mm_store_ps((float *)(dptr + 2), v);
+                v = _mm_loadu_ps((float *)sptr);
+                _mm_store_ps((float *)dptr, v);
+
+                len -= 4 * sizeof(SIZE_T);
+            } while (len >= 4 * sizeof(SIZE_T));
+        }
         if (len == 0)
         {
             return;
@@ -26,6 +26,8 @@ CrashInfo::CrashInfo(const CreateDumpOptions& options) :
     m_crashThread(options.CrashThread),
     m_signal(options.Signal),
     m_exceptionRecord(options.ExceptionRecord),
+    m_trimGCHeap(options.TrimGCHeap && options.DumpType == DumpType::Heap),
+    m_gcHeapGen2AndLohOnly(options.GCHeapGen2AndLohOnly),
     m_moduleInfos(&ModuleInfoCompare),
     m_mainModule(nullptr),
     m_cbModuleMappings(0),
@@ -239,6 +241,10 @@ CrashInfo::GatherCrashInfo(DumpType dumpType)
         // the heap regions are marked RWX instead of just RW.
         if (dumpType == DumpType::Heap)
         {
+            if (m_trimGCHeap)
+            {
+                EnumerateGCHeapExclusions();
+            }
             for (const MemoryRegion& region : m_otherMappings)
             {
                 uint32_t permissions = region.Permissions();
@@ -248,7 +254,7 @@ CrashInfo::GatherCrashInfo(DumpType dumpType)
                 if (permissions == (PF_R | PF_W) || permissions == (PF_R | PF_W | PF_X))
 #endif
                 {
-                    InsertMemoryRegion(region);
+                    InsertHeapMemoryRegion(region);
                 }
             }
         }
@@ -791,6 +797,159 @@ CrashInfo::InsertMemoryRegion(const MemoryRegion& region)
     return pagesAdded;
 }
 
+//
+// Add a heap dump memory region except for the GC heap ranges being left out
+//
+void
+CrashInfo::InsertHeapMemoryRegion(const MemoryRegion& region)
+{
+    uint64_t start = region.StartAddress();
+    for (auto iter = m_gcHeapExclusions.lower_bound(MemoryRegion(0, start, start + PAGE_SIZE));
+         iter != m_gcHeapExclusions.end() && iter->StartAddress() < region.EndAddress();
+         ++iter)
+    {
+        if (iter->StartAddress() > start)
+        {
+            InsertMemoryRegion(MemoryRegion(region.Flags(), start, iter->StartAddress()));
+        }
+        start = std::max(start, iter->EndAddress());
+    }
+    if (start < region.EndAddress())
+    {
+        InsertMemoryRegion(MemoryRegion(region.Flags(), start, region.EndAddress()));
+    }
+}
+
+//
+// Ask the DAC for the GC heap memory that doesn't contain objects: the free regions and the committed
+// but unused end of every region/segment. With m_gcHeapGen2AndLohOnly the gen0 and gen1 objects are
+// also left out. Only whole pages are left out. If any of the GC info isn't available, nothing is.
+//
+void
+CrashInfo::EnumerateGCHeapExclusions()
+{
+    ReleaseHolder<ISOSDacInterface> pSos = nullptr;
+    if (m_pClrDataProcess == nullptr || FAILED(m_pClrDataProcess->QueryInterface(__uuidof(ISOSDacInterface), (void**)&pSos)))
+    {
+        TRACE("EnumerateGCHeapExclusions: SOS DAC interface not available\n");
+        return;
+    }
+
+    DacpGcHeapData gcHeapData;
+    if (FAILED(gcHeapData.Request(pSos)) || !gcHeapData.bGcStructuresValid)
+    {
+        TRACE("EnumerateGCHeapExclusions: GC heap data not available\n");
+        return;
+    }
+
+    std::vector<CLRDATA_ADDRESS> heaps(gcHeapData.bServerMode ? gcHeapData.HeapCount : 1, 0);
+    if (gcHeapData.bServerMode)
+    {
+        unsigned int needed = 0;
+        if (FAILED(pSos->GetGCHeapList((unsigned int)heaps.size(), heaps.data(), &needed)))
+        {
+            TRACE("EnumerateGCHeapExclusions: GetGCHeapList FAILED\n");
+            return;
+        }
+    }
+
+    // Ranges [start, end) that don't need to be in the dump
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    for (CLRDATA_ADDRESS heap : heaps)
+    {
+        DacpGcHeapDetails details;
+        HRESULT hr = gcHeapData.bServerMode ? details.Request(pSos, heap) : details.Request(pSos);
+        if (FAILED(hr))
+        {
+            TRACE("EnumerateGCHeapExclusions: GC heap details FAILED %08x\n", hr);
+            return;
+        }
+
+        // With regions every generation has its own list of regions. With segments gen0 and gen1
+        // are at the end of the ephemeral segment, which is in the gen2 list.
+        bool regions = details.generation_table[0].start_segment != details.generation_table[1].start_segment;
+        for (int generation = 0; generation < DAC_NUMBERGENERATIONS; generation++)
+        {
+            if (!regions && generation < 2)
+            {
+                continue;
+            }
+            bool allUnused = regions && generation < 2 && m_gcHeapGen2AndLohOnly;
+
+            // The limit protects against a corrupted list
+            CLRDATA_ADDRESS segmentAddress = details.generation_table[generation].start_segment;
+            for (int count = 0; segmentAddress != 0 && count < 1000000; count++)
+            {
+                DacpHeapSegmentData segment;
+                hr = segment.Request(pSos, segmentAddress, details);
+                if (FAILED(hr))
+                {
+                    TRACE("EnumerateGCHeapExclusions: segment %" PRIA PRIx64 " FAILED %08x\n", segmentAddress, hr);
+                    return;
+                }
+                ranges.push_back({ allUnused ? segment.mem : segment.highAllocMark, segment.committed });
+                segmentAddress = segment.next;
+            }
+        }
+
+        if (!regions && m_gcHeapGen2AndLohOnly)
+        {
+            ranges.push_back({ details.generation_table[1].allocation_start, details.alloc_allocated });
+        }
+    }
+
+    // The regions the GC keeps for later use or hasn't decommitted yet
+    ReleaseHolder<ISOSDacInterface13> pSos13 = nullptr;
+    if (SUCCEEDED(m_pClrDataProcess->QueryInterface(__uuidof(ISOSDacInterface13), (void**)&pSos13)))
+    {
+        ReleaseHolder<ISOSMemoryEnum> pFreeRegions = nullptr;
+        if (SUCCEEDED(pSos13->GetGCFreeRegions(&pFreeRegions)))
+        {
+            SOSMemoryRegion freeRegions[64];
+            unsigned int fetched = 0;
+            while (SUCCEEDED(pFreeRegions->Next(sizeof(freeRegions) / sizeof(freeRegions[0]), freeRegions, &fetched)) && fetched > 0)
+            {
+                for (unsigned int i = 0; i < fetched; i++)
+                {
+                    ranges.push_back({ freeRegions[i].Start, freeRegions[i].Start + freeRegions[i].Size });
+                }
+            }
+        }
+    }
+
+    // Round to whole pages and merge the overlapping ranges
+    std::sort(ranges.begin(), ranges.end());
+    uint64_t excluded = 0;
+    uint64_t start = 0, end = 0;
+    for (size_t i = 0; i <= ranges.size(); i++)
+    {
+        uint64_t rangeStart = 0, rangeEnd = 0;
+        if (i < ranges.size())
+        {
+            rangeStart = (ranges[i].first + PAGE_SIZE - 1) & PAGE_MASK;
+            rangeEnd = ranges[i].second & PAGE_MASK;
+            if (rangeStart >= rangeEnd)
+            {
+                continue;
+            }
+            if (rangeStart <= end)
+            {
+                end = std::max(end, rangeEnd);
+                continue;
+            }
+        }
+        if (start < end)
+        {
+            m_gcHeapExclusions.insert(MemoryRegion(0, start, end));
+            excluded += end - start;
+        }
+        start = rangeStart;
+        end = rangeEnd;
+    }
+
+    TRACE("EnumerateGCHeapExclusions: %zu ranges, %" PRIu64 " pages left out of the dump\n", m_gcHeapExclusions.size(), excluded / PAGE_SIZE);
+}
+
 //
 // Check the page is really used by the application before adding it to the dump
 // On some kernels reading a region from createdump results in committing this region in the parent application
@@ -60,6 +60,9 @@ private:
     siginfo_t m_siginfo;                            // signal info (if any)
     std::string m_coreclrPath;                      // the path of the coreclr module or empty if none
     uint64_t m_runtimeBaseAddress;                  // base address of the runtime module
+    bool m_trimGCHeap;                              // if true, leave the GC heap memory without objects out of heap dumps
+    bool m_gcHeapGen2AndLohOnly;                    // if true, also leave the gen0 and gen1 objects out of heap dumps
+    std::set<MemoryRegion> m_gcHeapExclusions;      // GC heap ranges left out of heap dumps
 #ifdef __APPLE__
     vm_map_t m_task;                                // the mach task for the process
     std::set<MemoryRegion> m_allMemoryRegions;      // all memory regions on MacOS
@@ -163,6 +166,8 @@ private:
     bool UnwindAllThreads();
     void AddOrReplaceModuleMapping(uint64_t baseAddress, uint64_t size, const std::string& pszName);
     int InsertMemoryRegion(const MemoryRegion& region);
+    void InsertHeapMemoryRegion(const MemoryRegion& region);
+    void EnumerateGCHeapExclusions();
     uint32_t GetMemoryRegionFlags(uint64_t start);
     bool PageCanBeRead(uint64_t start);
     bool PageMappedToPhysicalMemory(uint64_t start);
@@ -10,7 +10,8 @@
 extern CrashInfo* g_crashInfo;
 extern uint8_t g_debugHeaderCookie[4];
 
-int g_readProcessMemoryErrno = 0;
+// Per thread since memory is read on several threads while writing the dump
+thread_local int g_readProcessMemoryErrno = 0;
 
 bool GetStatus(pid_t pid, pid_t* ppid, pid_t* tgid, std::string* name);
 
@@ -84,6 +84,7 @@ typedef int T_CONTEXT;
 #include <winternl.h>
 #include <dbghelp.h>
 #endif
+#include <algorithm>
 #include <map>
 #include <set>
 #include <vector>
@@ -112,6 +113,8 @@ typedef struct
     enum AppModelType AppModel;
     bool CreateDump;
     bool CrashReport;
+    bool TrimGCHeap;
+    bool GCHeapGen2AndLohOnly;
     int Pid;
     int CrashThread;
     int Signal;
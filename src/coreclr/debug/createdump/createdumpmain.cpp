@@ -35,6 +35,8 @@ const char* g_help = "createdump [options]\n"
 "--signal <code> - the signal code of the crash.\n"
 "--singlefile - single-file app model.\n"
 "--nativeaot - native AOT app model.\n"
+"--trimgcheap - leave the GC heap memory without objects (free regions, committed but unused space) out of heap dumps.\n"
+"--gen2gcheap - like --trimgcheap and also leave out the gen0 and gen1 objects, for memory leak triage.\n"
 #endif
 ;
 
@@ -68,6 +70,8 @@ int createdump_main(const int argc, const char* argv[])
     options.AppModel = AppModelType::Normal;
     options.CrashReport = false;
     options.CreateDump = true;
+    options.TrimGCHeap = false;
+    options.GCHeapGen2AndLohOnly = false;
     options.Signal = 0;
     options.CrashThread = 0;
     options.Pid = 0;
@@ -130,6 +134,15 @@ int createdump_main(const int argc, const char* argv[])
             {
                 options.AppModel = AppModelType::NativeAOT;
             }
+            else if (strcmp(*argv, "--trimgcheap") == 0)
+            {
+                options.TrimGCHeap = true;
+            }
+            else if (strcmp(*argv, "--gen2gcheap") == 0)
+            {
+                options.TrimGCHeap = true;
+                options.GCHeapGen2AndLohOnly = true;
+            }
             else if (strcmp(*argv, "--code") == 0)
             {
                 options.SignalCode = atoi(*++argv);
@@ -189,6 +202,15 @@ int createdump_main(const int argc, const char* argv[])
     {
         help = true;
     }
+
+    // The runtime launches createdump with the dump type options on a crash, this allows the GC heap
+    // to be trimmed in that case too: 1 - trim the unused GC heap, 2 - also leave out gen0 and gen1.
+    CLRConfigNoCache trimGCHeap = CLRConfigNoCache::Get("DbgTrimGCHeap", /*noprefix*/ false, &getenv);
+    if (trimGCHeap.IsSet() && trimGCHeap.TryAsInteger(10, value))
+    {
+        options.TrimGCHeap = options.TrimGCHeap || value >= 1;
+        options.GCHeapGen2AndLohOnly = options.GCHeapGen2AndLohOnly || value >= 2;
+    }
 #endif
 
     if (help)
@@ -2,8 +2,17 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "createdump.h"
+#include <pthread.h>
 
-extern int g_readProcessMemoryErrno;
+extern thread_local int g_readProcessMemoryErrno;
+
+// Size of the work items for the memory writer threads
+const size_t MemoryChunkSize = 4 * 1024 * 1024;
+
+// Size of a single read from the target process
+const size_t MemoryReadSize = 1024 * 1024;
+
+const size_t MaxMemoryWriterThreads = 8;
 
 // Write the core dump file:
 //   ELF header
@@ -168,17 +177,26 @@ DumpWriter::WriteDump()
 
     TRACE("Writing %" PRIu64 " memory regions to core file\n", phnum - 1);
 
-    // Read from target process and write memory regions to core
+    // Read from target process and write memory regions to core. The regions are laid out back to back
+    // from the current position, so the file offset of every region is known up front.
+    off_t dataOffset = lseek(m_fd, 0, SEEK_CUR);
+    if (dataOffset == -1) {
+        printf_error("Error getting dump file position: %s (%d)\n", strerror(errno), errno);
+        return false;
+    }
+
+    m_memoryChunks.clear();
     uint64_t total = 0;
     for (const MemoryRegion& memoryRegion : m_crashInfo.MemoryRegions())
     {
         uint64_t address = memoryRegion.StartAddress();
         size_t size = memoryRegion.Size();
+        off_t fileOffset = dataOffset + total;
         total += size;
 
         if (address == SpecialDiagInfoAddress)
         {
-            if (!WriteDiagInfo(size)) {
+            if (lseek(m_fd, fileOffset, SEEK_SET) == -1 || !WriteDiagInfo(size)) {
                 return false;
             }
         }
@@ -186,31 +204,209 @@ DumpWriter::WriteDump()
         {
             while (size > 0)
             {
-                size_t bytesToRead = std::min(size, sizeof(m_tempBuffer));
-                size_t read = 0;
-
-                if (!m_crashInfo.ReadProcessMemory(address, m_tempBuffer, bytesToRead, &read)) {
-                    printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx FAILED %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
-                    return false;
-                }
-
-                // This can happen if the target process dies before createdump is finished
-                if (read == 0) {
-                    printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx returned 0 bytes read: %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
-                    return false;
-                }
-
-                if (!WriteData(m_tempBuffer, read)) {
-                    return false;
-                }
-
-                address += read;
-                size -= read;
+                size_t chunkSize = std::min(size, MemoryChunkSize);
+                m_memoryChunks.push_back({ address, chunkSize, fileOffset });
+                address += chunkSize;
+                fileOffset += chunkSize;
+                size -= chunkSize;
+            }
+        }
+    }
+
+    uint64_t skipped = 0;
+    if (!WriteMemoryChunks(&skipped)) {
+        return false;
+    }
+
+    // Zero pages at the end of the last region are not written, extend the file over them
+    if (ftruncate(m_fd, dataOffset + total) != 0) {
+        printf_error("Error setting dump file size: %s (%d)\n", strerror(errno), errno);
+        return false;
+    }
+
+    printf_status("Written %" PRId64 " bytes (%" PRId64 " pages, %" PRId64 " zero pages left sparse) to core file\n", total, total / PAGE_SIZE, skipped / PAGE_SIZE);
+    return true;
+}
+
+//
+// Reads the memory chunks from the target process on several threads and writes them at their
+// offsets in the dump. Every thread takes the next chunk until they are all written.
+//
+bool
+DumpWriter::WriteMemoryChunks(uint64_t* skipped)
+{
+    m_nextMemoryChunk = 0;
+    m_memoryWriteFailed = false;
+
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t threadCount = std::min((size_t)std::max(processors, 1L), std::min(MaxMemoryWriterThreads, m_memoryChunks.size()));
+
+    TRACE("Writing %zu memory chunks on %zu threads\n", m_memoryChunks.size(), threadCount);
+
+    // This thread is one of the writers
+    std::vector<pthread_t> threads;
+    for (size_t i = 1; i < threadCount; i++)
+    {
+        pthread_t thread;
+        int error = pthread_create(&thread, nullptr, MemoryWriterThread, this);
+        if (error != 0) {
+            TRACE("Failed to create memory writer thread: %s (%d)\n", strerror(error), error);
+            break;
+        }
+        threads.push_back(thread);
+    }
+
+    *skipped = WriteMemoryChunksOnThread();
+
+    for (pthread_t thread : threads)
+    {
+        void* result;
+        if (pthread_join(thread, &result) == 0) {
+            *skipped += (uint64_t)(size_t)result;
+        }
+    }
+
+    return !m_memoryWriteFailed;
+}
+
+void*
+DumpWriter::MemoryWriterThread(void* context)
+{
+    return (void*)(size_t)((DumpWriter*)context)->WriteMemoryChunksOnThread();
+}
+
+// Returns the number of zero bytes that were skipped
+uint64_t
+DumpWriter::WriteMemoryChunksOnThread()
+{
+    uint64_t skipped = 0;
+    ArrayHolder<BYTE> buffer = new (std::nothrow) BYTE[MemoryReadSize];
+    if (buffer == nullptr) {
+        printf_error("Failed to allocate memory read buffer\n");
+        m_memoryWriteFailed = true;
+        return 0;
+    }
+
+    while (!m_memoryWriteFailed)
+    {
+        size_t index = (size_t)(InterlockedIncrement(&m_nextMemoryChunk) - 1);
+        if (index >= m_memoryChunks.size()) {
+            break;
+        }
+
+        const MemoryChunk& chunk = m_memoryChunks[index];
+        uint64_t address = chunk.Address;
+        size_t size = chunk.Size;
+        off_t offset = chunk.FileOffset;
+
+        while (size > 0)
+        {
+            size_t bytesToRead = std::min(size, MemoryReadSize);
+            size_t read = 0;
+
+            if (!m_crashInfo.ReadProcessMemory(address, buffer, bytesToRead, &read)) {
+                printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx FAILED %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
+                m_memoryWriteFailed = true;
+                break;
+            }
+
+            // This can happen if the target process dies before createdump is finished
+            if (read == 0) {
+                printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx returned 0 bytes read: %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
+                m_memoryWriteFailed = true;
+                break;
+            }
+
+            if (!WriteMemory(buffer, read, offset, &skipped)) {
+                m_memoryWriteFailed = true;
+                break;
+            }
+
+            address += read;
+            offset += read;
+            size -= read;
+        }
+    }
+
+    return skipped;
+}
+
+static bool
+IsZeroPage(const BYTE* data, size_t length)
+{
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t))
+    {
+        if (*(const uint64_t*)(data + i) != 0) {
+            return false;
+        }
+    }
+    for (; i < length; i++)
+    {
+        if (data[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//
+// Writes memory read from the target at the offset in the dump. Pages that are all zero are
+// not written, which leaves holes in the dump file that read back as zeros. Only the pages
+// with data take up disk space and I/O.
+//
+bool
+DumpWriter::WriteMemory(const BYTE* buffer, size_t length, off_t offset, uint64_t* skipped)
+{
+    size_t start = 0;
+    while (start < length)
+    {
+        // Skip the zero pages
+        size_t pageSize = std::min((size_t)PAGE_SIZE, length - start);
+        if (IsZeroPage(buffer + start, pageSize)) {
+            *skipped += pageSize;
+            start += pageSize;
+            continue;
+        }
+
+        // Write the pages up to the next zero page at once
+        size_t end = start + pageSize;
+        while (end < length)
+        {
+            pageSize = std::min((size_t)PAGE_SIZE, length - end);
+            if (IsZeroPage(buffer + end, pageSize)) {
+                break;
             }
+            end += pageSize;
         }
+
+        if (!WriteDataAt(m_fd, buffer + start, end - start, offset + start)) {
+            return false;
+        }
+        start = end;
     }
+    return true;
+}
 
-    printf_status("Written %" PRId64 " bytes (%" PRId64 " pages) to core file\n", total, total / PAGE_SIZE);
+// Write all of the given buffer at the file offset, handling short writes and EINTR. Return true iff successful.
+bool
+DumpWriter::WriteDataAt(int fd, const void* buffer, size_t length, off_t offset)
+{
+    const uint8_t* data = (const uint8_t*)buffer;
+
+    size_t done = 0;
+    while (done < length) {
+        ssize_t written;
+        do {
+            written = pwrite(fd, data + done, length - done, offset + done);
+        } while (written == -1 && errno == EINTR);
+
+        if (written < 1) {
+            printf_error("Error writing data to dump file: %s (%d)\n", strerror(errno), errno);
+            return false;
+        }
+        done += written;
+    }
     return true;
 }
 
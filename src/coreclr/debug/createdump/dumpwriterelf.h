@@ -37,6 +37,14 @@
 #define NT_SIGINFO	0x53494749
 #endif
 
+// Part of a memory region read and written by one of the memory writer threads
+struct MemoryChunk
+{
+    uint64_t Address;
+    size_t Size;
+    off_t FileOffset;
+};
+
 class DumpWriter
 {
 private:
@@ -44,6 +52,11 @@ private:
     CrashInfo& m_crashInfo;
     BYTE m_tempBuffer[0x4000];
 
+    // Memory regions are written by several threads, each reading a chunk of a region at a time
+    std::vector<MemoryChunk> m_memoryChunks;
+    LONG m_nextMemoryChunk;
+    volatile bool m_memoryWriteFailed;
+
     // no public copy constructor
     DumpWriter(const DumpWriter&) = delete;
     void operator=(const DumpWriter&) = delete;
@@ -63,6 +76,11 @@ private:
     bool WriteNTFileInfo();
     bool WriteThread(const ThreadInfo& thread);
     bool WriteData(const void* buffer, size_t length) { return WriteData(m_fd, buffer, length); }
+    static bool WriteDataAt(int fd, const void* buffer, size_t length, off_t offset);
+    bool WriteMemoryChunks(uint64_t* skipped);
+    bool WriteMemory(const BYTE* buffer, size_t length, off_t offset, uint64_t* skipped);
+    static void* MemoryWriterThread(void* context);
+    uint64_t WriteMemoryChunksOnThread();
 
     size_t GetProcessInfoSize() const { return sizeof(Nhdr) + 8 + sizeof(prpsinfo_t); }
     size_t GetAuxvInfoSize() const { return sizeof(Nhdr) + 8 + m_crashInfo.GetAuxvSize(); }
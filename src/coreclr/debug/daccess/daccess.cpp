@@ -2234,6 +2234,127 @@ DacInstanceManager::FreeAllBlocks(bool fSaveBlock)
     }
 }
 
+//----------------------------------------------------------------------------
+//
+// DacReadCache.
+//
+// The instance cache above only helps with data that is accessed more than
+// once at the same address and size.  Walks over large data structures, like
+// the objects of the GC heap, mostly touch each address once, so each access
+// becomes a separate read of the data target, and those reads dominate the
+// time spent walking a large dump.
+//
+// Reads smaller than a block are served from aligned blocks of target memory,
+// each read from the target in one piece on first use.  Since a dump can hold
+// memory at arbitrary granularity, a block may only be partly readable; ranges
+// a block cannot cover are read directly, exactly as before, so that the
+// cache never changes the outcome of a read.
+//
+//----------------------------------------------------------------------------
+
+DacReadCache::DacReadCache(void)
+{
+    ZeroMemory(m_blocks, sizeof(m_blocks));
+}
+
+DacReadCache::~DacReadCache(void)
+{
+    for (ULONG32 i = 0; i < BlockCount; i++)
+    {
+        delete [] m_blocks[i].data;
+    }
+}
+
+DacReadCache::Block*
+DacReadCache::GetBlock(ICorDebugDataTarget* pTarget, TADDR blockAddr)
+{
+    Block* block = &m_blocks[(blockAddr / BlockSize) % BlockCount];
+    if (block->loaded && block->addr == blockAddr)
+    {
+        return block;
+    }
+
+    if (block->data == NULL)
+    {
+        block->data = new (nothrow) BYTE[BlockSize];
+        if (block->data == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    ULONG32 returned = 0;
+    HRESULT status = pTarget->ReadVirtual(blockAddr, block->data, BlockSize, &returned);
+
+    // Remember failed reads too, so that the reads of an unreadable block
+    // don't each try to read the whole block first.
+    block->addr = blockAddr;
+    block->validSize = (status == S_OK && returned <= BlockSize) ? returned : 0;
+    block->loaded = true;
+    return block;
+}
+
+bool
+DacReadCache::Read(ICorDebugDataTarget* pTarget, TADDR addr, PBYTE buffer, ULONG32 size)
+{
+    // Large reads gain nothing from read-ahead.
+    if (size == 0 || size >= BlockSize)
+    {
+        return false;
+    }
+
+    TADDR end = addr + size;
+    while (addr < end)
+    {
+        TADDR blockAddr = addr & ~(TADDR)(BlockSize - 1);
+        Block* block = GetBlock(pTarget, blockAddr);
+        if (block == NULL)
+        {
+            return false;
+        }
+
+        ULONG32 offset = (ULONG32)(addr - blockAddr);
+        ULONG32 count = BlockSize - offset;
+        if (end - addr < count)
+        {
+            count = (ULONG32)(end - addr);
+        }
+        if (offset + count > block->validSize)
+        {
+            return false;
+        }
+
+        memcpy(buffer, block->data + offset, count);
+        buffer += count;
+        addr += count;
+    }
+
+    return true;
+}
+
+void
+DacReadCache::Invalidate(TADDR addr, ULONG32 size)
+{
+    for (ULONG32 i = 0; i < BlockCount; i++)
+    {
+        Block* block = &m_blocks[i];
+        if (block->loaded && block->addr < addr + size && addr < block->addr + BlockSize)
+        {
+            block->loaded = false;
+        }
+    }
+}
+
+void
+DacReadCache::Flush(void)
+{
+    // Keep the buffers, the next stop will most likely need them again.
+    for (ULONG32 i = 0; i < BlockCount; i++)
+    {
+        m_blocks[i].loaded = false;
+    }
+}
+
 //----------------------------------------------------------------------------
 //
 // DacStreamManager.
@@ -3286,6 +3407,7 @@ ClrDataAccess::Flush(void)
 
     // Free instance memory.
     m_instances.Flush();
+    m_readCache.Flush();
 
     // When the host instance cache is flushed we
     // update the instance age count so that
@@ -5113,6 +5113,7 @@ void DacDbiInterfaceImpl::WriteExceptionRecordHelper(CORDB_ADDRESS pRemotePtr,
 
     // Use the data target to write to the remote target.  Here we are assuming that we are debugging a
     // live process, since this function is only called by the hijacking code for unhandled exceptions.
+    m_readCache.Invalidate(CORDB_ADDRESS_TO_TADDR(pRemotePtr), cbSize);
     HRESULT hr = m_pMutableTarget->WriteVirtual(pRemotePtr,
                                                 reinterpret_cast<const BYTE *>(pExcepRecord),
                                                 cbSize);
@@ -6304,7 +6305,7 @@ LinearReadCache::LinearReadCache()
 	GetSystemInfo(&si);
 
     mPageSize = si.dwPageSize;
-    mPage = new (nothrow) BYTE[mPageSize];
+    mPage = new (nothrow) BYTE[mPageSize * ReadAheadPages];
 }
 
 LinearReadCache::~LinearReadCache()
@@ -6316,7 +6317,12 @@ LinearReadCache::~LinearReadCache()
 bool LinearReadCache::MoveToPage(CORDB_ADDRESS addr)
 {
     mCurrPageStart = addr - (addr % mPageSize);
-    HRESULT hr = g_dacImpl->m_pTarget->ReadVirtual(mCurrPageStart, mPage, mPageSize, &mCurrPageSize);
+    HRESULT hr = g_dacImpl->m_pTarget->ReadVirtual(mCurrPageStart, mPage, mPageSize * ReadAheadPages, &mCurrPageSize);
+
+    // The pages past the one we need may not be readable (the end of a segment, or
+    // memory missing from the dump), so fall back to reading just that page.
+    if (hr != S_OK)
+        hr = g_dacImpl->m_pTarget->ReadVirtual(mCurrPageStart, mPage, mPageSize, &mCurrPageSize);
 
     if (hr != S_OK)
     {
@@ -158,8 +158,16 @@ DacReadAll(TADDR addr, PVOID buffer, ULONG32 size, bool throwEx)
     nStart = GetCycleCount();
 #endif // #if defined(DAC_MEASURE_PERF)
 
-    status = g_dacImpl->m_pTarget->
-        ReadVirtual(addr, (PBYTE)buffer, size, &returned);
+    if (g_dacImpl->m_readCache.Read(g_dacImpl->m_pTarget, addr, (PBYTE)buffer, size))
+    {
+        status = S_OK;
+        returned = size;
+    }
+    else
+    {
+        status = g_dacImpl->m_pTarget->
+            ReadVirtual(addr, (PBYTE)buffer, size, &returned);
+    }
 
 #if defined(DAC_MEASURE_PERF)
     nEnd = GetCycleCount();
@@ -199,6 +207,7 @@ DacWriteAll(TADDR addr, PVOID buffer, ULONG32 size, bool throwEx)
 
     HRESULT status;
 
+    g_dacImpl->m_readCache.Invalidate(addr, size);
     status = g_dacImpl->m_pMutableTarget->WriteVirtual(addr, (PBYTE)buffer, size);
     if (status != S_OK)
     {
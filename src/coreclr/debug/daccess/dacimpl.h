@@ -787,6 +787,45 @@ private:
     DAC_INSTANCE_PUSH* m_instPushed;
 };
 
+// Direct mapped cache of aligned blocks of target memory, used by DacReadAll
+// to turn the many small reads made while walking target data structures into
+// a few large reads of the data target.  It is flushed along with the instance
+// cache, since target memory is assumed not to change until then.
+class DacReadCache
+{
+public:
+    DacReadCache(void);
+    ~DacReadCache(void);
+
+    // Copies [addr, addr + size) out of the cache, reading the blocks it spans
+    // from the target if needed.  Returns false if the range could not be
+    // served from whole blocks, in which case the caller reads it directly.
+    bool Read(ICorDebugDataTarget* pTarget, TADDR addr, PBYTE buffer, ULONG32 size);
+
+    // Drops the blocks overlapping [addr, addr + size) after a write to the target.
+    void Invalidate(TADDR addr, ULONG32 size);
+
+    void Flush(void);
+
+private:
+    static const ULONG32 BlockSize = 0x10000;
+    static const ULONG32 BlockCount = 64;
+
+    struct Block
+    {
+        TADDR addr;
+        // Number of bytes at the start of the block the target returned, zero
+        // if it could not be read.
+        ULONG32 validSize;
+        bool loaded;
+        BYTE* data;
+    };
+
+    Block* GetBlock(ICorDebugDataTarget* pTarget, TADDR blockAddr);
+
+    Block m_blocks[BlockCount];
+};
+
 
 #ifdef FEATURE_MINIMETADATA_IN_TRIAGEDUMPS
 
@@ -1431,6 +1470,7 @@ public:
     TADDR m_globalBase;
     DacGlobals m_dacGlobals;
     DacInstanceManager m_instances;
+    DacReadCache m_readCache;
     ULONG32 m_instanceAge;
     bool m_debugMode;
 
@@ -1677,8 +1717,8 @@ struct HeapData
 };
 
 /* This cache is used to read data from the target process if the reads are known
- * to be sequential.  This will object will read one page of memory out of the
- * process at a time, aligned to the page boundary, to
+ * to be sequential.  This will object will read ReadAheadPages pages of memory out
+ * of the process at a time, starting at a page boundary, to
  */
 class LinearReadCache
 {
@@ -1764,6 +1804,9 @@ private:
     }
 
 private:
+    // Heap walks read each object once and in order, so read well ahead of them.
+    static const ULONG32 ReadAheadPages = 16;
+
     CORDB_ADDRESS mCurrPageStart;
     ULONG32 mPageSize, mCurrPageSize;
     BYTE *mPage;
@@ -488,6 +488,7 @@ ClrDataValue::SetBytes(
             else
             {
                 _ASSERT(FitsIn<ULONG32>(loc->size));
+                m_dac->m_readCache.Invalidate(TO_TADDR(loc->addr), static_cast<ULONG32>(loc->size));
                 status = m_dac->m_pMutableTarget->
                     WriteVirtual(loc->addr, buffer, static_cast<ULONG32>(loc->size));
                 if (status != S_OK)
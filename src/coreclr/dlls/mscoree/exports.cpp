@@ -15,6 +15,7 @@
 #include <corhost.h>
 #include <configuration.h>
 #include "../../vm/ceemain.h"
+#include "../../vm/startupcheckpoints.h"
 #ifdef FEATURE_GDBJIT
 #include "../../vm/gdbjithelpers.h"
 #endif // FEATURE_GDBJIT
@@ -138,7 +139,8 @@ static void ConvertConfigPropertiesToUnicode(
     LPCWSTR** propertyValuesWRef,
     BundleProbeFn** bundleProbe,
     PInvokeOverrideFn** pinvokeOverride,
-    host_runtime_contract** hostContract)
+    host_runtime_contract** hostContract,
+    const char** hostStartupCheckpoints)
 {
     LPCWSTR* propertyKeysW = new (nothrow) LPCWSTR[propertyCount];
     ASSERTE_ALL_BUILDS(propertyKeysW != nullptr);
@@ -169,6 +171,11 @@ static void ConvertConfigPropertiesToUnicode(
             if (*pinvokeOverride == nullptr)
                 *pinvokeOverride = (PInvokeOverrideFn*)u16_strtoui64(propertyValuesW[propertyIndex], nullptr, 0);
         }
+        else if (strcmp(propertyKeys[propertyIndex], HOST_PROPERTY_STARTUP_CHECKPOINTS) == 0)
+        {
+            // The host's part of the startup timeline, recorded once the PAL is initialized.
+            *hostStartupCheckpoints = propertyValues[propertyIndex];
+        }
         else if (strcmp(propertyKeys[propertyIndex], HOST_PROPERTY_RUNTIME_CONTRACT) == 0)
         {
             // Host contract is passed in as the value of HOST_RUNTIME_CONTRACT property (encoded as a string).
@@ -248,6 +255,7 @@ int coreclr_initialize(
     BundleProbeFn* bundleProbe = nullptr;
     PInvokeOverrideFn* pinvokeOverride = nullptr;
     host_runtime_contract* hostContract = nullptr;
+    const char* hostStartupCheckpoints = nullptr;
 
 #ifdef TARGET_UNIX
     HostingApiFrameHolder apiFrameHolder(_ReturnAddress());
@@ -261,7 +269,8 @@ int coreclr_initialize(
         &propertyValuesW,
         &bundleProbe,
         &pinvokeOverride,
-        &hostContract);
+        &hostContract,
+        &hostStartupCheckpoints);
 
 #ifdef TARGET_UNIX
     DWORD error = PAL_InitializeCoreCLR(exePath, g_coreclr_embedded);
@@ -275,6 +284,13 @@ int coreclr_initialize(
     }
 #endif
 
+    if (hostStartupCheckpoints != nullptr)
+    {
+        StartupCheckpoints::RecordHostCheckpoints(hostStartupCheckpoints);
+    }
+
+    StartupCheckpoints::Record("coreclr_initialize");
+
     if (hostContract != nullptr)
     {
         HostInformation::SetContract(hostContract);
@@ -322,6 +338,8 @@ int coreclr_initialize(
 
     if (SUCCEEDED(hr))
     {
+        StartupCheckpoints::Record("coreclr_initialize_complete");
+
         host.SuppressRelease();
         *hostHandle = host;
 #ifdef FEATURE_GDBJIT
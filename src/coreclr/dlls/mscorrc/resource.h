@@ -109,6 +109,7 @@
 #define IDS_EE_BADMARSHAL_ASANYRESTRICTION      0x175f
 #define IDS_EE_BADMARSHAL_VBBYVALSTRRESTRICTION 0x1760
 #define IDS_EE_BADMARSHAL_AWORESTRICTION        0x1761
+#define IDS_EE_BADMARSHAL_SPANRESTRICTION       0x1762
 #define IDS_EE_BADMARSHAL_ARGITERATORRESTRICTION 0x1765
 #define IDS_EE_BADMARSHAL_HANDLEREFRESTRICTION  0x1766
 
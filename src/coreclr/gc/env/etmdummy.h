@@ -19,6 +19,7 @@
 #define FireEtwGCRestartEEBegin_V1(ClrInstanceID) 0
 #define FireEtwGCSuspendEEEnd() 0
 #define FireEtwGCSuspendEEEnd_V1(ClrInstanceID) 0
+#define FireEtwGCSuspendEEEnd_V2(ClrInstanceID, HijackPassCount, SlowestThreadID, SlowestThreadIP) 0
 #define FireEtwGCSuspendEEBegin(Reason) 0
 #define FireEtwGCSuspendEEBegin_V1(Reason, Count, ClrInstanceID) 0
 #define FireEtwGCAllocationTick(AllocationAmount, AllocationKind) 0
@@ -96,6 +97,7 @@
 #define FireEtwExceptionFilterStart(EntryEIP, MethodID, MethodName, ClrInstanceID) 0
 #define FireEtwExceptionFilterStop() 0
 #define FireEtwExceptionThrownStop() 0
+#define FireEtwExceptionThrownStop_V1(FramesUnwound, FirstPassDurationNs, SecondPassDurationNs, ClrInstanceID) 0
 #define FireEtwContention() 0
 #define FireEtwContentionStart_V1(ContentionFlags, ClrInstanceID) 0
 #define FireEtwContentionStart_V2(ContentionFlags, ClrInstanceID, LockID, AssociatedObjectID, LockOwnerThreadID) 0
@@ -413,6 +415,7 @@
 #define FireEtwResolutionAttempted(ClrInstanceId, asmName, stage, assemblyLoadContextName, result, resultAsmName, resultAsmPath, errMsg) 0
 #define FireEtwKnownPathProbed(ClrInstanceId, path, source, hr) 0
 #define FireEtwContentionStop_V1(managedContention, ClrInstanceId, elapsedTimeInNanosecond) 0
+#define FireEtwContentionStop_V2(ContentionFlags, ClrInstanceID, DurationNs, LockID, LockContentionCount, LockSpinCount) 0
 #define FireEtwAssemblyLoadContextResolvingHandlerInvoked(ClrInstanceId, assemblyName, handlerName, alcName, resultAssemblyName, resultAssemblyPath) 0
 #define FireEtwAppDomainAssemblyResolveHandlerInvoked(ClrInstanceId, assemblyName, handlerName, resultAssemblyName, resultAssemblyPath) 0
 #define FireEtwAssemblyLoadFromResolveHandlerInvoked(ClrInstanceId, assemblyName, isTrackedAssembly, requestingAssemblyPath, requestedAssemblyPath) 0
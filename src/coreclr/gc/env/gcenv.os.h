@@ -371,6 +371,16 @@ public:
     //  Size of the cache
     static size_t GetCacheSizePerLogicalCpu(bool trueSize = true);
 
+    // Get the last level cache the specified processor shares with other processors
+    // Parameters:
+    //  procNo - the processor to query
+    //  cacheSize - receives the size of the cache
+    //  domainId - receives an id shared by all processors attached to the same cache
+    //             (the lowest numbered processor attached to it)
+    // Return:
+    //  true if the cache topology is available for the processor, false otherwise
+    static bool GetLastLevelCacheForProcessor(uint16_t procNo, size_t* cacheSize, uint16_t* domainId);
+
     // Sets the calling thread's affinity to only run on the processor specified.
     // Parameters:
     //  procNo - The requested affinity for the calling thread.
@@ -430,6 +440,15 @@ public:
     //  Any parameter can be null.
     static void GetMemoryStatus(uint64_t restricted_limit, uint32_t* memory_load, uint64_t* available_physical, uint64_t* available_page_file);
 
+    // Get memory pressure
+    // Parameters:
+    //  stall_percent - The percentage of the last 10 seconds some threads were stalled waiting on memory.
+    //  bytes_below_soft_limit - How far the memory usage is below the limit where the OS starts reclaiming
+    //      memory from this process, or UINT64_MAX if there's no such limit.
+    // Return:
+    //  true if the OS reports memory pressure, false otherwise.
+    static bool GetMemoryPressure(uint32_t* stall_percent, uint64_t* bytes_below_soft_limit);
+
     // Get size of an OS memory page
     static size_t GetPageSize();
 
@@ -42,10 +42,16 @@
 #endif // defined(FEATURE_SVR_GC)
 #endif // __INTELLISENSE__
 
-#ifdef TARGET_AMD64
+#if defined(TARGET_AMD64) || defined(TARGET_ARM64)
 #include "vxsort/do_vxsort.h"
 #endif
 
+#if defined(TARGET_AMD64)
+#include <emmintrin.h>
+#elif defined(TARGET_ARM64)
+#include <arm_neon.h>
+#endif
+
 #ifdef SERVER_GC
 namespace SVR {
 #else // SERVER_GC
@@ -55,7 +61,7 @@ namespace WKS {
 #include "gcimpl.h"
 #include "gcpriv.h"
 
-#ifdef TARGET_AMD64
+#if defined(TARGET_AMD64) || defined(TARGET_ARM64)
 #define USE_VXSORT
 #else
 #define USE_INTROSORT
@@ -433,6 +439,8 @@ float mb (size_t num)
 uint32_t bgc_alloc_spin_count = 140;
 uint32_t bgc_alloc_spin_count_uoh = 16;
 uint32_t bgc_alloc_spin = 2;
+// Percent of CPU time a BGC thread may use while running concurrently, 0 means no limit.
+uint32_t bgc_cpu_share = 0;
 
 inline
 void c_write (uint32_t& place, uint32_t value)
@@ -2281,7 +2289,10 @@ uint8_t**   gc_heap::g_mark_list;
 uint8_t**   gc_heap::g_mark_list_copy;
 size_t      gc_heap::mark_list_size;
 size_t      gc_heap::g_mark_list_total_size;
+size_t      gc_heap::g_mark_list_committed_size;
+size_t      gc_heap::g_mark_list_reserved_size;
 bool        gc_heap::mark_list_overflow;
+int32_t     gc_heap::mark_list_overflow_heaps;
 #ifdef USE_REGIONS
 uint8_t***  gc_heap::g_mark_list_piece;
 size_t      gc_heap::g_mark_list_piece_size;
@@ -2305,6 +2316,8 @@ VOLATILE(BOOL) gc_heap::gc_started;
 #ifdef MULTIPLE_HEAPS
 GCEvent     gc_heap::gc_start_event;
 bool        gc_heap::gc_thread_no_affinitize_p = false;
+bool        gc_heap::affinitize_allocating_threads_p = false;
+VOLATILE(int32_t) gc_heap::next_affinitized_heap = 0;
 uintptr_t   process_mask = 0;
 
 int         gc_heap::n_heaps;       // current number of heaps
@@ -2318,6 +2331,7 @@ size_t*     gc_heap::g_promoted;
 
 #ifdef MH_SC_MARK
 int*        gc_heap::g_mark_stack_busy;
+VOLATILE(int32_t) gc_heap::mark_steal_waiting_heaps = 0;
 #endif //MH_SC_MARK
 
 #ifdef BACKGROUND_GC
@@ -2382,6 +2396,8 @@ bool gc_heap::informational_event_enabled_p = false;
 
 uint64_t*   gc_heap::gc_time_info = 0;
 
+size_t      gc_heap::phase_histogram_gc_count = 0;
+
 #ifdef BACKGROUND_GC
 uint64_t*   gc_heap::bgc_time_info = 0;
 #endif //BACKGROUND_GC
@@ -2392,6 +2408,10 @@ size_t      gc_heap::gen0_min_budget_from_config = 0;
 
 size_t      gc_heap::gen0_max_budget_from_config = 0;
 
+size_t      gc_heap::gen0_min_budget_from_cache_topology = 0;
+
+int         gc_heap::type_census_sample_rate = 0;
+
 int         gc_heap::high_mem_percent_from_config = 0;
 
 bool        gc_heap::use_frozen_segments_p = false;
@@ -2562,6 +2582,12 @@ oom_history gc_heap::oomhist_per_heap[max_oom_history_count];
 
 fgm_history gc_heap::fgm_result;
 
+#ifdef FEATURE_EVENT_TRACE
+gc_heap::phase_histogram gc_heap::phase_histograms[max_pause_phase_count];
+
+uint64_t    gc_heap::plan_sub_phases_us = 0;
+#endif //FEATURE_EVENT_TRACE
+
 size_t      gc_heap::allocated_since_last_gc[total_oh_count];
 
 #ifndef USE_REGIONS
@@ -2723,6 +2749,12 @@ size_t      gc_heap::background_uoh_alloc_count = 0;
 
 uint8_t**   gc_heap::background_mark_stack_tos = 0;
 
+background_mark_queue_t gc_heap::background_mark_queue;
+
+uint32_t    gc_heap::bgc_throttle_check_count = 0;
+
+uint64_t    gc_heap::bgc_throttle_quantum_start_us = 0;
+
 uint8_t**   gc_heap::background_mark_stack_array = 0;
 
 size_t      gc_heap::background_mark_stack_array_length = 0;
@@ -2855,6 +2887,10 @@ size_t        gc_heap::last_gc_end_time_us = 0;
 #endif //HEAP_BALANCE_INSTRUMENTATION
 #ifdef USE_REGIONS
 bool          gc_heap::enable_special_regions_p = false;
+size_t        gc_heap::gen2_evac_budget = 0;
+#ifdef MARK_PHASE_PREFETCH
+bool          gc_heap::mark_prefetch_p = true;
+#endif //MARK_PHASE_PREFETCH
 #else //USE_REGIONS
 size_t        gc_heap::min_segment_size = 0;
 size_t        gc_heap::min_uoh_segment_size = 0;
@@ -2937,6 +2973,8 @@ size_t gc_heap::saved_pinned_plug_index = INVALID_SAVED_PINNED_PLUG_INDEX;
 
 #ifdef FEATURE_EVENT_TRACE
 etw_bucket_info gc_heap::bucket_info[NUM_GEN2_ALIST];
+
+type_census_entry* gc_heap::type_census_table = nullptr;
 #endif //FEATURE_EVENT_TRACE
 
 dynamic_data gc_heap::dynamic_data_table [total_generation_count];
@@ -3005,6 +3043,7 @@ mark_queue_t gc_heap::mark_queue;
 
 #ifdef USE_REGIONS
 bool gc_heap::special_sweep_p = false;
+int gc_heap::gen2_evac_surv_ratio_th = sip_surv_ratio_th;
 #endif //USE_REGIONS
 
 int gc_heap::loh_pinned_queue_decay = LOH_PIN_DECAY;
@@ -3261,6 +3300,142 @@ void gc_heap::fire_pevents()
 #endif //FEATURE_EVENT_TRACE
 }
 
+#ifdef FEATURE_EVENT_TRACE
+void gc_heap::phase_histogram::add (uint64_t elapsed_us)
+{
+    uint32_t value = (uint32_t)min (elapsed_us, (uint64_t)UINT32_MAX);
+    int bucket = (int)value;
+    if (value >= (1u << sub_bucket_bits))
+    {
+        int highest_bit = index_of_highest_set_bit (value);
+        int shift = highest_bit - sub_bucket_bits;
+        bucket = ((highest_bit - sub_bucket_bits + 1) << sub_bucket_bits) + ((value >> shift) & ((1 << sub_bucket_bits) - 1));
+    }
+    assert (bucket < bucket_count);
+
+    buckets[bucket]++;
+    count++;
+    max_us = max (max_us, value);
+}
+
+uint32_t gc_heap::phase_histogram::get_percentile (int percent)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t target = ((uint64_t)count * percent + 99) / 100;
+    uint64_t seen = 0;
+    int bucket = 0;
+    for (; bucket < bucket_count; bucket++)
+    {
+        seen += buckets[bucket];
+        if (seen >= target)
+        {
+            break;
+        }
+    }
+
+    // report the middle of the bucket
+    uint32_t value = (uint32_t)bucket;
+    if (bucket >= (1 << sub_bucket_bits))
+    {
+        int shift = (bucket >> sub_bucket_bits) - 1;
+        uint32_t bucket_start = ((1u << sub_bucket_bits) + (bucket & ((1 << sub_bucket_bits) - 1))) << shift;
+        value = bucket_start + ((1u << shift) >> 1);
+    }
+
+    return min (value, max_us);
+}
+
+uint64_t gc_heap::record_phase_time (int phase, uint64_t start_us, uint64_t excluded_us)
+{
+    if (phase_histogram_gc_count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t now = GetHighPrecisionTimeStamp();
+    uint64_t elapsed_us = now - start_us;
+    elapsed_us = (elapsed_us > excluded_us) ? (elapsed_us - excluded_us) : 0;
+    phase_histograms[phase].add (elapsed_us);
+
+    if ((phase == pause_phase_relocate) || (phase == pause_phase_compact) || (phase == pause_phase_sweep))
+    {
+        plan_sub_phases_us += elapsed_us;
+    }
+
+    return now;
+}
+
+void gc_heap::record_suspension_time()
+{
+    if (phase_histogram_gc_count == 0)
+    {
+        return;
+    }
+
+#ifdef MULTIPLE_HEAPS
+    gc_heap* hp = g_heaps[0];
+#else
+    gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+
+    hp->phase_histograms[pause_phase_suspension].add (GetHighPrecisionTimeStamp() - suspended_start_time);
+}
+
+// Fires the p50/p99 of each phase per heap every phase_histogram_gc_count GCs and starts over so they reflect
+// recent GCs. This is much cheaper than collecting these from the verbose events.
+void gc_heap::fire_phase_histogram_events()
+{
+    if ((phase_histogram_gc_count == 0) || ((settings.gc_index % phase_histogram_gc_count) != 0))
+    {
+        return;
+    }
+
+    bool fire_p = GCEventEnabledPausePhaseHistogram_V1();
+
+    for (int i = 0; i < n_heaps; i++)
+    {
+#ifdef MULTIPLE_HEAPS
+        gc_heap* hp = g_heaps[i];
+#else
+        gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+
+        for (int phase = 0; phase < max_pause_phase_count; phase++)
+        {
+            phase_histogram* histogram = &hp->phase_histograms[phase];
+            if (histogram->count == 0)
+            {
+                continue;
+            }
+
+            uint32_t p50_us = histogram->get_percentile (50);
+            uint32_t p99_us = histogram->get_percentile (99);
+
+            dprintf (6666, ("h%d phase %d: %d samples, p50 %dus, p99 %dus, max %dus",
+                i, phase, histogram->count, p50_us, p99_us, histogram->max_us));
+
+            if (fire_p)
+            {
+                GCEventFirePausePhaseHistogram_V1 (
+                    (uint64_t)settings.gc_index,
+                    (uint16_t)i,
+                    (uint16_t)phase,
+                    (uint32_t)histogram->count,
+                    p50_us,
+                    p99_us,
+                    histogram->max_us);
+            }
+
+            memset (histogram, 0, sizeof (*histogram));
+        }
+    }
+}
+#endif //FEATURE_EVENT_TRACE
+
 // This fires the amount of total committed in use, in free and on the decommit list.
 // It's fired on entry and exit of each blocking GC and on entry of each BGC (not firing this on exit of a GC
 // because EE is not suspended then. On entry it's fired after the GCStart event, on exit it's fire before the GCStop event.
@@ -3305,6 +3480,53 @@ void gc_heap::fire_committed_usage_event()
 #endif //FEATURE_EVENT_TRACE
 }
 
+// Logs the settings the GC actually ended up with, whether they came from GCProfile,
+// were specified on their own or are the defaults.
+void gc_heap::fire_gc_profile_event()
+{
+#ifdef FEATURE_EVENT_TRACE
+    uint8_t server_p =
+#ifdef MULTIPLE_HEAPS
+        1;
+#else
+        0;
+#endif //MULTIPLE_HEAPS
+    uint8_t concurrent_p =
+#ifdef BACKGROUND_GC
+        (gc_can_use_concurrent ? 1 : 0);
+#else
+        0;
+#endif //BACKGROUND_GC
+    int adaptation_mode =
+#ifdef DYNAMIC_HEAP_COUNT
+        dynamic_adaptation_mode;
+#else
+        0;
+#endif //DYNAMIC_HEAP_COUNT
+
+    // 0 for the cache topology budget means we used the default cache probe.
+    size_t gen0_min_budget = static_data_table[latency_level][0].min_size;
+
+    dprintf (1, ("GC profile %d: server %d, concurrent %d, retain VM %d, no affinitize %d, latency level %d, conserve mem %d, dynamic adaptation %d, heaps %d, gen0 min budget %zd (cache topology %zd)",
+        (int)GCConfig::GetProfile(), server_p, concurrent_p, (int)GCConfig::GetRetainVM(), (int)GCConfig::GetNoAffinitize(),
+        (int)latency_level, conserve_mem_setting, adaptation_mode, n_heaps, gen0_min_budget, gen0_min_budget_from_cache_topology));
+
+    GCEventFireGCProfileSettings_V1 (
+        (uint16_t)GCConfig::GetProfile(),
+        server_p,
+        concurrent_p,
+        (uint8_t)(GCConfig::GetRetainVM() ? 1 : 0),
+        (uint8_t)(GCConfig::GetNoAffinitize() ? 1 : 0),
+        (uint32_t)latency_level,
+        (uint32_t)conserve_mem_setting,
+        (uint32_t)adaptation_mode,
+        (uint32_t)n_heaps,
+        (uint64_t)gen0_min_budget,
+        (uint64_t)gen0_min_budget_from_cache_topology
+    );
+#endif //FEATURE_EVENT_TRACE
+}
+
 inline BOOL
 gc_heap::dt_low_ephemeral_space_p (gc_tuning_point tp)
 {
@@ -7156,6 +7378,9 @@ void gc_heap::gc_thread_function ()
             GCToEEInterface::SuspendEE(SUSPEND_FOR_GC);
             dprintf (9999, ("h0 suspended EE in GC!"));
             END_TIMING(suspend_ee_during_log);
+#ifdef FEATURE_EVENT_TRACE
+            record_suspension_time();
+#endif //FEATURE_EVENT_TRACE
 
             proceed_with_gc_p = TRUE;
 
@@ -8490,6 +8715,43 @@ void gc_heap::make_c_mark_list (uint8_t** arr)
 }
 #endif //BACKGROUND_GC
 
+// Returns the first non-zero word in [word, word_end), or word_end if they are all zero.
+//
+// The card table (and card bundle table) ranges we scan are mostly zero, so on 64-bit targets we test
+// 8 words at a time first. SSE2 and AdvSIMD are part of the baseline ISA there so there's nothing to
+// dispatch on.
+inline
+uint32_t* find_non_zero_card_word (uint32_t* word, uint32_t* word_end)
+{
+#if defined(TARGET_AMD64) || defined(TARGET_ARM64)
+    const ptrdiff_t words_per_step = 8;
+    while ((word_end - word) >= words_per_step)
+    {
+#ifdef TARGET_AMD64
+        __m128i words = _mm_or_si128 (_mm_loadu_si128 ((const __m128i*)word), _mm_loadu_si128 ((const __m128i*)(word + 4)));
+        if (_mm_movemask_epi8 (_mm_cmpeq_epi32 (words, _mm_setzero_si128 ())) != 0xffff)
+        {
+            break;
+        }
+#else //TARGET_AMD64
+        uint32x4_t words = vorrq_u32 (vld1q_u32 (word), vld1q_u32 (word + 4));
+        if (vmaxvq_u32 (words) != 0)
+        {
+            break;
+        }
+#endif //TARGET_AMD64
+        word += words_per_step;
+    }
+#endif //TARGET_AMD64 || TARGET_ARM64
+
+    while ((word < word_end) && !(*word))
+    {
+        word++;
+    }
+
+    return word;
+}
+
 #ifdef CARD_BUNDLE
 // The card bundle keeps track of groups of card words.
 static const size_t card_bundle_word_width = 32;
@@ -10193,12 +10455,40 @@ void gc_heap::remove_ro_segment (heap_segment* seg)
 }
 #endif //FEATURE_BASICFREEZE
 
-uint8_t** make_mark_list (size_t size)
+// The mark lists are reserved once for the largest size grow_mark_list can ask for
+// and committed on demand, so growing them never has to allocate and copy.
+uint8_t** reserve_mark_list (size_t reserved_size, size_t size)
 {
-    uint8_t** mark_list = new (nothrow) uint8_t* [size];
+    size_t reserved_bytes = align_on_page (reserved_size * sizeof (uint8_t*));
+    uint8_t** mark_list = (uint8_t**)GCToOSInterface::VirtualReserve (reserved_bytes, 0, 0);
+    if (mark_list == nullptr)
+        return nullptr;
+
+    if (!GCToOSInterface::VirtualCommit (mark_list, align_on_page (size * sizeof (uint8_t*))))
+    {
+        GCToOSInterface::VirtualRelease (mark_list, reserved_bytes);
+        return nullptr;
+    }
     return mark_list;
 }
 
+bool commit_mark_list (uint8_t** mark_list, size_t committed_size, size_t size)
+{
+    size_t committed_bytes = align_on_page (committed_size * sizeof (uint8_t*));
+    size_t new_committed_bytes = align_on_page (size * sizeof (uint8_t*));
+    if (new_committed_bytes <= committed_bytes)
+        return true;
+
+    return GCToOSInterface::VirtualCommit ((uint8_t*)mark_list + committed_bytes,
+                                           new_committed_bytes - committed_bytes);
+}
+
+void release_mark_list (uint8_t** mark_list, size_t reserved_size)
+{
+    if (mark_list != nullptr)
+        GCToOSInterface::VirtualRelease (mark_list, align_on_page (reserved_size * sizeof (uint8_t*)));
+}
+
 #define swap(a,b){uint8_t* t; t = a; a = b; b = t;}
 
 void verify_qsort_array (uint8_t* *low, uint8_t* *high)
@@ -10439,6 +10729,10 @@ private:
 #ifdef USE_VXSORT
 static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* range_low, uint8_t* range_high)
 {
+#ifdef TARGET_ARM64
+    // above this threshold, using NEON for sorting will likely pay off
+    const ptrdiff_t NEON_THRESHOLD_SIZE = 8 * 1024;
+#else //TARGET_ARM64
     // above this threshold, using AVX2 for sorting will likely pay off
     // despite possible downclocking on some devices
     const ptrdiff_t AVX2_THRESHOLD_SIZE = 8 * 1024;
@@ -10446,10 +10740,18 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
     // above this threshold, using AVX512F for sorting will likely pay off
     // despite possible downclocking on current devices
     const ptrdiff_t AVX512F_THRESHOLD_SIZE = 128 * 1024;
+#endif //TARGET_ARM64
 
     if (item_count <= 1)
         return;
 
+#ifdef TARGET_ARM64
+    if (IsSupportedInstructionSet (InstructionSet::NEON) && (item_count > NEON_THRESHOLD_SIZE))
+    {
+        dprintf(3, ("Sorting mark lists"));
+        do_vxsort_neon (item_array, &item_array[item_count - 1], range_low, range_high);
+    }
+#else //TARGET_ARM64
     if (IsSupportedInstructionSet (InstructionSet::AVX2) && (item_count > AVX2_THRESHOLD_SIZE))
     {
         dprintf(3, ("Sorting mark lists"));
@@ -10464,6 +10766,7 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
             do_vxsort_avx2 (item_array, &item_array[item_count - 1], range_low, range_high);
         }
     }
+#endif //TARGET_ARM64
     else
     {
         dprintf (3, ("Sorting mark lists"));
@@ -10585,6 +10888,7 @@ size_t gc_heap::sort_mark_list()
     {
         dprintf (2, ("h%d sort_mark_list overflow", heap_number));
         mark_list_overflow = true;
+        Interlocked::Increment (&mark_list_overflow_heaps);
         return 0;
     }
 
@@ -11093,59 +11397,55 @@ uint8_t** gc_heap::get_region_mark_list (BOOL& use_mark_list, uint8_t* start, ui
 #endif //USE_REGIONS
 #endif //MULTIPLE_HEAPS
 
-void gc_heap::grow_mark_list ()
+size_t gc_heap::get_max_mark_list_size()
 {
     // with vectorized sorting, we can use bigger mark lists
 #ifdef USE_VXSORT
+#ifdef TARGET_ARM64
+    bool vectorized_sort_p = IsSupportedInstructionSet (InstructionSet::NEON);
+#else //TARGET_ARM64
+    bool vectorized_sort_p = IsSupportedInstructionSet (InstructionSet::AVX2);
+#endif //TARGET_ARM64
 #ifdef MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
-        (1000 * 1024) : (200 * 1024);
+    return (vectorized_sort_p ? (1000 * 1024) : (200 * 1024));
 #else //MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
-        (32 * 1024) : (16 * 1024);
+    return (vectorized_sort_p ? (32 * 1024) : (16 * 1024));
 #endif //MULTIPLE_HEAPS
 #else //USE_VXSORT
 #ifdef MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = 200 * 1024;
+    return (200 * 1024);
 #else //MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = 16 * 1024;
+    return (16 * 1024);
 #endif //MULTIPLE_HEAPS
 #endif //USE_VXSORT
+}
 
-    size_t new_mark_list_size = min (mark_list_size * 2, MAX_MARK_LIST_SIZE);
+void gc_heap::grow_mark_list ()
+{
+    size_t new_mark_list_size = min (mark_list_size * 2, get_max_mark_list_size());
     size_t new_mark_list_total_size = new_mark_list_size*n_heaps;
     if (new_mark_list_total_size == g_mark_list_total_size)
         return;
 
+    // the reservation covers the max size for the max number of heaps, so this
+    // can only fail if we cannot commit more memory.
+    assert (new_mark_list_total_size <= g_mark_list_reserved_size);
+
+    // the contents of the mark lists don't need to survive across GCs so we
+    // just commit more of the reserved range in place.
+    if (!commit_mark_list (g_mark_list, g_mark_list_committed_size, new_mark_list_total_size))
+        return;
 #ifdef MULTIPLE_HEAPS
-    uint8_t** new_mark_list = make_mark_list (new_mark_list_total_size);
-    uint8_t** new_mark_list_copy = make_mark_list (new_mark_list_total_size);
+    if (!commit_mark_list (g_mark_list_copy, g_mark_list_committed_size, new_mark_list_total_size))
+        return;
+#endif //MULTIPLE_HEAPS
 
-    if ((new_mark_list != nullptr) && (new_mark_list_copy != nullptr))
-    {
-        delete[] g_mark_list;
-        g_mark_list = new_mark_list;
-        delete[] g_mark_list_copy;
-        g_mark_list_copy = new_mark_list_copy;
-        mark_list_size = new_mark_list_size;
-        g_mark_list_total_size = new_mark_list_total_size;
-    }
-    else
-    {
-        delete[] new_mark_list;
-        delete[] new_mark_list_copy;
-    }
+    g_mark_list_committed_size = max (g_mark_list_committed_size, new_mark_list_total_size);
+    dprintf (2, ("growing mark list from %zd to %zd per heap (%zd committed)",
+        mark_list_size, new_mark_list_size, g_mark_list_committed_size));
 
-#else //MULTIPLE_HEAPS
-    uint8_t** new_mark_list = make_mark_list (new_mark_list_size);
-    if (new_mark_list != nullptr)
-    {
-        delete[] mark_list;
-        g_mark_list = new_mark_list;
-        mark_list_size = new_mark_list_size;
-        g_mark_list_total_size = new_mark_list_size;
-    }
-#endif //MULTIPLE_HEAPS
+    mark_list_size = new_mark_list_size;
+    g_mark_list_total_size = new_mark_list_total_size;
 }
 
 #ifndef USE_REGIONS
@@ -12412,6 +12712,13 @@ void gc_heap::init_heap_segment (heap_segment* seg, gc_heap* hp
 #endif //MULTIPLE_HEAPS
 
 #ifdef USE_REGIONS
+#ifdef MULTIPLE_HEAPS
+    if (!existing_region_p)
+    {
+        heap_segment_numa_node (seg) = heap_select::find_numa_node_from_heap_no (hp->heap_number);
+    }
+#endif //MULTIPLE_HEAPS
+
     int gen_num_for_region = min (gen_num, (int)max_generation);
     set_region_gen_num (seg, gen_num_for_region);
     heap_segment_plan_gen_num (seg) = gen_num_for_region;
@@ -12797,6 +13104,28 @@ static int64_t add_regions (region_free_list* free_list, region_free_list* surpl
     return added_count;
 }
 
+#ifdef MULTIPLE_HEAPS
+// same as add_regions but only takes regions whose memory is on numa_node
+static int64_t add_regions_on_node (region_free_list* free_list, region_free_list* surplus_list, size_t target_count, uint16_t numa_node)
+{
+    int64_t added_count = 0;
+    heap_segment* next_region = nullptr;
+    for (heap_segment* region = surplus_list->get_first_free_region();
+         (region != nullptr) && (free_list->get_num_free_regions() < target_count);
+         region = next_region)
+    {
+        next_region = heap_segment_next (region);
+        if (heap_segment_numa_node (region) == numa_node)
+        {
+            added_count++;
+            region_free_list::unlink_region (region);
+            free_list->add_region_front (region);
+        }
+    }
+    return added_count;
+}
+#endif //MULTIPLE_HEAPS
+
 region_free_list::region_free_list() : num_free_regions (0),
                                        size_free_regions (0),
                                        size_committed_in_free_regions (0),
@@ -13655,6 +13984,30 @@ void gc_heap::distribute_free_regions()
                 remove_surplus_regions (&hp->free_regions[kind], &surplus_regions[kind], heap_budget_in_region_units[i][kind]);
             }
         }
+        // before handing out surplus regions to whoever needs them, let each heap take the ones whose memory
+        // is already on its own node - accesses to a region from another node are remote for as long as the
+        // region lives. Heap numbers are assigned contiguously per node so the first and last heap tell us
+        // whether the heaps span more than one node.
+        if (heap_select::find_numa_node_from_heap_no (0) != heap_select::find_numa_node_from_heap_no (n_heaps - 1))
+        {
+            for (int i = 0; i < n_heaps; i++)
+            {
+                gc_heap* hp = g_heaps[i];
+                if (hp->free_regions[kind].get_num_free_regions() < heap_budget_in_region_units[i][kind])
+                {
+                    int64_t num_added_regions = add_regions_on_node (&hp->free_regions[kind], &surplus_regions[kind],
+                                                                     heap_budget_in_region_units[i][kind],
+                                                                     heap_select::find_numa_node_from_heap_no (i));
+                    dprintf (REGIONS_LOG, ("added %zd %s regions on node %d to heap %d - now has %zd, budget is %zd",
+                        (size_t)num_added_regions,
+                        kind_name[kind],
+                        heap_select::find_numa_node_from_heap_no (i),
+                        i,
+                        hp->free_regions[kind].get_num_free_regions(),
+                        heap_budget_in_region_units[i][kind]));
+                }
+            }
+        }
         // finally go through all the heaps and distribute any surplus regions to heaps having too few free regions
         for (int i = 0; i < n_heaps; i++)
         {
@@ -13695,6 +14048,8 @@ void gc_heap::distribute_free_regions()
             break;
         }
     }
+
+    fire_region_numa_locality_events();
 #else //MULTIPLE_HEAPS
     // we want to limit the amount of decommit we do per time to indirectly
     // limit the amount of time spent in recommit and page faults
@@ -13724,6 +14079,67 @@ void gc_heap::distribute_free_regions()
 }
 #endif //USE_REGIONS
 
+#if defined(USE_REGIONS) && defined(MULTIPLE_HEAPS)
+// For each heap, count how many of its regions (in use and free) have their memory on the heap's own
+// NUMA node vs on another node.
+void gc_heap::fire_region_numa_locality_events()
+{
+#ifdef FEATURE_EVENT_TRACE
+    if (!GCEventEnabledRegionNumaLocality_V1())
+    {
+        return;
+    }
+
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[i];
+        uint16_t heap_numa_node = heap_select::find_numa_node_from_heap_no (i);
+        size_t local_regions = 0;
+        size_t remote_regions = 0;
+        size_t local_free_regions = 0;
+        size_t remote_free_regions = 0;
+
+        for (int gen_idx = 0; gen_idx < total_generation_count; gen_idx++)
+        {
+            heap_segment* region = heap_segment_rw (generation_start_segment (hp->generation_of (gen_idx)));
+            while (region)
+            {
+                if (heap_segment_numa_node (region) == heap_numa_node)
+                    local_regions++;
+                else
+                    remote_regions++;
+
+                region = heap_segment_next_rw (region);
+            }
+        }
+
+        for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
+        {
+            for (heap_segment* region = hp->free_regions[kind].get_first_free_region(); region != nullptr; region = heap_segment_next (region))
+            {
+                if (heap_segment_numa_node (region) == heap_numa_node)
+                    local_free_regions++;
+                else
+                    remote_free_regions++;
+            }
+        }
+
+        dprintf (REGIONS_LOG, ("h%d (node %d): %zd local %zd remote regions, %zd local %zd remote free regions",
+            i, heap_numa_node, local_regions, remote_regions, local_free_regions, remote_free_regions));
+
+        GCEventFireRegionNumaLocality_V1 (
+            (uint64_t)settings.gc_index,
+            (uint16_t)i,
+            (uint16_t)heap_numa_node,
+            (uint32_t)local_regions,
+            (uint32_t)remote_regions,
+            (uint32_t)local_free_regions,
+            (uint32_t)remote_free_regions);
+    }
+#endif //FEATURE_EVENT_TRACE
+}
+#endif //USE_REGIONS && MULTIPLE_HEAPS
+
 #ifdef WRITE_WATCH
 uint8_t* g_addresses [array_size+2]; // to get around the bug in GetWriteWatch
 
@@ -14233,6 +14649,10 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
 
     conserve_mem_setting = (int)GCConfig::GetGCConserveMem();
 
+#ifdef FEATURE_EVENT_TRACE
+    type_census_sample_rate = (int)max ((int64_t)0, GCConfig::GetGCTypeCensusSampleRate());
+#endif //FEATURE_EVENT_TRACE
+
 #ifdef DYNAMIC_HEAP_COUNT
     dynamic_adaptation_mode = (int)GCConfig::GetGCDynamicAdaptationMode();
     if (GCConfig::GetHeapCount() != 0)
@@ -14504,10 +14924,11 @@ gc_heap::init_semi_shared()
     {
         g_mark_list_total_size = mark_list_size*n_heaps;
     }
-    g_mark_list = make_mark_list (g_mark_list_total_size);
+    g_mark_list_reserved_size = max (mark_list_size, get_max_mark_list_size()) * n_max_heaps;
+    g_mark_list = reserve_mark_list (g_mark_list_reserved_size, g_mark_list_total_size);
 
     min_balance_threshold = alloc_quantum_balance_units * CLR_SIZE * 2;
-    g_mark_list_copy = make_mark_list (g_mark_list_total_size);
+    g_mark_list_copy = reserve_mark_list (g_mark_list_reserved_size, g_mark_list_total_size);
     if (!g_mark_list_copy)
     {
         goto cleanup;
@@ -14516,9 +14937,11 @@ gc_heap::init_semi_shared()
 
     mark_list_size = min((size_t)100*1024, max ((size_t)8192, soh_segment_size/(64*32)));
     g_mark_list_total_size = mark_list_size;
-    g_mark_list = make_mark_list (mark_list_size);
+    g_mark_list_reserved_size = max (mark_list_size, get_max_mark_list_size());
+    g_mark_list = reserve_mark_list (g_mark_list_reserved_size, mark_list_size);
 
 #endif //MULTIPLE_HEAPS
+    g_mark_list_committed_size = g_mark_list_total_size;
 
     dprintf (3, ("mark_list_size: %zd", mark_list_size));
 
@@ -14654,6 +15077,11 @@ gc_heap::init_semi_shared()
     memset (ephemeral_fgc_counts, 0, sizeof (ephemeral_fgc_counts));
     bgc_alloc_spin_count = static_cast<uint32_t>(GCConfig::GetBGCSpinCount());
     bgc_alloc_spin = static_cast<uint32_t>(GCConfig::GetBGCSpin());
+    bgc_cpu_share = static_cast<uint32_t>(GCConfig::GetBGCCpuShare());
+    if ((bgc_cpu_share >= 100) || (bgc_cpu_share == 0))
+    {
+        bgc_cpu_share = 0;
+    }
 
     {
         int number_bgc_threads = get_num_heaps();
@@ -15228,8 +15656,22 @@ gc_heap::init_gc_heap (int h_number)
     if (!arr)
         return 0;
 
+#ifdef FEATURE_EVENT_TRACE
+    if (type_census_sample_rate != 0)
+    {
+        type_census_table = new (nothrow) type_census_entry [type_census_table_length];
+        if (!type_census_table)
+            return 0;
+    }
+#endif //FEATURE_EVENT_TRACE
+
     make_mark_stack(arr);
 
+#ifdef MH_SC_MARK
+    if (!mark_steal_chunks.init())
+        return 0;
+#endif //MH_SC_MARK
+
 #ifdef BACKGROUND_GC
     for (int i = uoh_start_generation; i < total_generation_count; i++)
     {
@@ -15380,8 +15822,10 @@ gc_heap::destroy_semi_shared()
 //        delete c_mark_list;
 //#endif //BACKGROUND_GC
 
-    if (g_mark_list)
-        delete[] g_mark_list;
+    release_mark_list (g_mark_list, g_mark_list_reserved_size);
+#ifdef MULTIPLE_HEAPS
+    release_mark_list (g_mark_list_copy, g_mark_list_reserved_size);
+#endif //MULTIPLE_HEAPS
 
 #ifdef FEATURE_BASICFREEZE
     //destroy the segment map
@@ -15422,6 +15866,10 @@ gc_heap::self_destroy()
     // destroy the mark stack
     delete[] mark_stack_array;
 
+#ifdef FEATURE_EVENT_TRACE
+    delete[] type_census_table;
+#endif //FEATURE_EVENT_TRACE
+
 #ifdef FEATURE_PREMORTEM_FINALIZATION
     if (finalize_queue)
         delete finalize_queue;
@@ -17053,6 +17501,11 @@ size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_li
     // For SOH if the size asked for is very small, we want to allocate more than just what's asked for if possible.
     // Unless we were told not to clean, then we will not force it.
     size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? allocation_quantum : 0);
+    if (flags & GC_ALLOC_LARGE_QUANTUM)
+    {
+        // The EE told us this thread allocates heavily, hand it a bigger context so it comes back less often.
+        min_size_to_allocate *= GC_LARGE_ALLOC_QUANTUM_SCALE;
+    }
 
     size_t desired_size_to_allocate  = max (padded_size, min_size_to_allocate);
     size_t new_physical_limit = min (physical_limit, desired_size_to_allocate);
@@ -19118,7 +19571,27 @@ void gc_heap::balance_heaps (alloc_context* acontext)
     {
         if (acontext->get_alloc_count() == 0)
         {
-            int home_hp_num = heap_select::select_heap (acontext);
+            int home_hp_num = -1;
+
+            if (affinitize_allocating_threads_p)
+            {
+                // Spread allocating threads over the heaps and pin each one to its heap's processor.
+                // From then on select_heap keeps returning the same heap for it, so balancing only
+                // moves its allocations when that heap is actually running out of budget.
+                int hp_num = (int)((uint32_t)Interlocked::Increment (&next_affinitized_heap) % (uint32_t)n_heaps);
+                uint16_t proc_no = heap_select::find_proc_no_from_heap_no (hp_num);
+                if (GCToOSInterface::SetThreadAffinity (proc_no))
+                {
+                    home_hp_num = hp_num;
+                    dprintf (HEAP_BALANCE_LOG, ("[p%3d] pinned allocating thread to h%d", proc_no, hp_num));
+                }
+            }
+
+            if (home_hp_num < 0)
+            {
+                home_hp_num = heap_select::select_heap (acontext);
+            }
+
             acontext->set_home_heap (GCHeap::GetHeap (home_hp_num));
             gc_heap* hp = acontext->get_home_heap ()->pGenGCHeap;
             acontext->set_alloc_heap (acontext->get_home_heap ());
@@ -19440,6 +19913,12 @@ ptrdiff_t gc_heap::get_balance_heaps_uoh_effective_budget (int generation_num)
     }
 }
 
+inline
+bool gc_heap::uoh_msl_busy_p()
+{
+    return (VolatileLoadWithoutBarrier (&more_space_lock_uoh.lock) != lock_free);
+}
+
 gc_heap* gc_heap::balance_heaps_uoh (alloc_context* acontext, size_t alloc_size, int generation_num)
 {
     const int home_hp_num = heap_select::select_heap(acontext);
@@ -19452,6 +19931,8 @@ gc_heap* gc_heap::balance_heaps_uoh (alloc_context* acontext, size_t alloc_size,
     int start, end;
     heap_select::get_heap_range_for_heap(home_hp_num, &start, &end);
     const int finish = start + n_heaps;
+    const int node_start = start;
+    const int node_end = end;
 
 try_again:
     gc_heap* max_hp = home_hp;
@@ -19484,6 +19965,34 @@ try_again:
         goto try_again;
     }
 
+    // When many threads allocate UOH objects at the same time they would all pick the same heap - the one
+    // with the most budget left - and queue up on its more space lock even though every heap has its own
+    // UOH free lists. If that lock is taken, go to the heap on this node with the most budget whose lock is
+    // free instead, as long as it can still afford this allocation.
+    if (!heap_hard_limit && max_hp->uoh_msl_busy_p())
+    {
+        gc_heap* free_msl_hp = nullptr;
+        ptrdiff_t free_msl_size = (ptrdiff_t)alloc_size;
+
+        for (int i = node_start; i < node_end; i++)
+        {
+            gc_heap* hp = GCHeap::GetHeap(i%n_heaps)->pGenGCHeap;
+            const ptrdiff_t size = hp->get_balance_heaps_uoh_effective_budget (generation_num);
+
+            if ((size > free_msl_size) && !hp->uoh_msl_busy_p())
+            {
+                free_msl_hp = hp;
+                free_msl_size = size;
+            }
+        }
+
+        if (free_msl_hp != nullptr)
+        {
+            dprintf (3, ("uoh: h%d msl busy, going to h%d(%zd)", max_hp->heap_number, free_msl_hp->heap_number, free_msl_size));
+            max_hp = free_msl_hp;
+        }
+    }
+
     if (max_hp != home_hp)
     {
         dprintf (3, ("uoh: %d(%zd)->%d(%zd)",
@@ -21610,6 +22119,22 @@ int gc_heap::generation_to_condemn (int n_initial,
             dd_gc_new_allocation (dd) = dd_new_allocation (dd);
         }
 
+#ifdef DYNAMIC_HEAP_COUNT
+        datas_allocated_since_last_gc = 0;
+        for (i = 0; i < total_generation_count; i++)
+        {
+            if ((i == 0) || (i >= uoh_start_generation))
+            {
+                dynamic_data* dd = dynamic_data_of (i);
+                ptrdiff_t allocated = (ptrdiff_t)dd_desired_allocation (dd) - dd_new_allocation (dd);
+                if (allocated > 0)
+                {
+                    datas_allocated_since_last_gc += (size_t)allocated;
+                }
+            }
+        }
+#endif //DYNAMIC_HEAP_COUNT
+
         local_condemn_reasons->set_gen (gen_initial, n);
         temp_gen = n;
 
@@ -22440,7 +22965,13 @@ void gc_heap::gc1()
             concurrent_print_time_delta ("BGC");
 
             concurrent_print_time_delta ("RW");
+#ifdef FEATURE_EVENT_TRACE
+            uint64_t phase_start_us = (phase_histogram_gc_count ? GetHighPrecisionTimeStamp() : 0);
+#endif //FEATURE_EVENT_TRACE
             background_mark_phase();
+#ifdef FEATURE_EVENT_TRACE
+            record_phase_time (pause_phase_bgc_mark, phase_start_us);
+#endif //FEATURE_EVENT_TRACE
             free_list_info (max_generation, "after mark phase");
 
             background_sweep();
@@ -22449,13 +22980,23 @@ void gc_heap::gc1()
         else
 #endif //BACKGROUND_GC
         {
+#ifdef FEATURE_EVENT_TRACE
+            uint64_t phase_start_us = (phase_histogram_gc_count ? GetHighPrecisionTimeStamp() : 0);
+#endif //FEATURE_EVENT_TRACE
             mark_phase (n);
+#ifdef FEATURE_EVENT_TRACE
+            phase_start_us = record_phase_time (pause_phase_mark, phase_start_us);
+            plan_sub_phases_us = 0;
+#endif //FEATURE_EVENT_TRACE
 
             check_gen0_bricks();
 
             GCScan::GcRuntimeStructuresValid (FALSE);
             plan_phase (n);
             GCScan::GcRuntimeStructuresValid (TRUE);
+#ifdef FEATURE_EVENT_TRACE
+            record_phase_time (pause_phase_plan, phase_start_us, plan_sub_phases_us);
+#endif //FEATURE_EVENT_TRACE
 
             check_gen0_bricks();
         }
@@ -25644,6 +26185,26 @@ void gc_heap::calculate_new_heap_count ()
         median_throughput_cost_percent = min_tcp;
     }
 
+    // The tcp above reflects the allocation rate during these samples - see if the rate is about to go up
+    // enough that we want to grow now instead of waiting for the GCs it would cause.
+    size_t samples_allocated = 0;
+    uint64_t samples_elapsed = 0;
+    size_t samples_max_heap_allocated = 0;
+    for (int i = 0; i < dynamic_heap_count_data_t::sample_size; i++)
+    {
+        dynamic_heap_count_data_t::sample& sample = dynamic_heap_count_data.samples[i];
+        samples_allocated += sample.gc_allocated_size;
+        samples_elapsed += sample.elapsed_between_gcs;
+        samples_max_heap_allocated = max (samples_max_heap_allocated, sample.max_heap_allocated_size);
+    }
+
+    float samples_alloc_rate = (samples_elapsed ? ((float)samples_allocated / (float)samples_elapsed) : 0.0f);
+    float avg_alloc_rate = 0.0f;
+    float predicted_alloc_rate = dynamic_heap_count_data.predict_alloc_rate (&avg_alloc_rate);
+    dynamic_heap_count_data_t::alloc_rate_prediction_reason prediction_reason = dynamic_heap_count_data_t::alloc_rate_prediction_reason::not_enough_alloc_rates;
+    float predicted_tcp = dynamic_heap_count_data.get_predicted_tcp (median_throughput_cost_percent, samples_alloc_rate,
+                                                                     predicted_alloc_rate, &prediction_reason);
+
     dprintf (6666, ("median tcp: %.3f, avg tcp: %.3f, gen2 tcp %.3f(%.3f, %.3f, %.3f)",
         median_throughput_cost_percent, avg_throughput_cost_percent, median_gen2_tcp,
         dynamic_heap_count_data.gen2_samples[0].gc_percent, dynamic_heap_count_data.gen2_samples[1].gc_percent, dynamic_heap_count_data.gen2_samples[2].gc_percent));
@@ -25670,7 +26231,9 @@ void gc_heap::calculate_new_heap_count ()
 
     if (process_eph_samples_p)
     {
-        dynamic_heap_count_data.add_to_recorded_tcp (median_throughput_cost_percent);
+        // predicted_tcp is the same as the median tcp unless we decided to act on the prediction.
+        dprintf (6666, ("median tcp %.3f, predicted tcp %.3f", median_throughput_cost_percent, predicted_tcp));
+        dynamic_heap_count_data.add_to_recorded_tcp (predicted_tcp);
 
         float tcp_to_consider = 0.0f;
         int agg_factor = 0;
@@ -25689,7 +26252,7 @@ void gc_heap::calculate_new_heap_count ()
         int hc_change_freq_factor = 0;
         dynamic_heap_count_data_t::hc_change_freq_reason hc_freq_reason = (dynamic_heap_count_data_t::hc_change_freq_reason)0;
 
-        if (dynamic_heap_count_data.should_change (median_throughput_cost_percent, &tcp_to_consider, current_gc_index,
+        if (dynamic_heap_count_data.should_change (predicted_tcp, &tcp_to_consider, current_gc_index,
                                                    &change_decision, &recorded_tcp_count, &recorded_tcp_slope, &num_gcs_since_last_change, &current_around_target_accumulation))
         {
             total_soh_stable_size = get_total_soh_stable_size();
@@ -25793,6 +26356,17 @@ void gc_heap::calculate_new_heap_count ()
             (uint16_t)hc_change_freq_factor,
             (uint16_t)hc_freq_reason,
             (uint8_t)adj_metric);
+
+        GCEventFireSizeAdaptationAllocRate_V1 (
+            (uint16_t)n_heaps,
+            (uint16_t)new_n_heaps,
+            (uint64_t)current_gc_index,
+            (float)samples_alloc_rate,
+            (float)avg_alloc_rate,
+            (float)predicted_alloc_rate,
+            (uint64_t)samples_max_heap_allocated,
+            (float)predicted_tcp,
+            (uint8_t)prediction_reason);
     }
 
     size_t num_gen2s_since_last_change = 0;
@@ -26527,6 +27101,20 @@ void gc_heap::process_datas_sample()
         // could cache this - we will get it again soon in do_post_gc
         sample.gc_survived_size = get_total_promoted();
 
+        sample.gc_allocated_size = 0;
+        sample.max_heap_allocated_size = 0;
+        for (int i = 0; i < n_heaps; i++)
+        {
+            size_t heap_allocated = g_heaps[i]->datas_allocated_since_last_gc;
+            sample.gc_allocated_size += heap_allocated;
+            sample.max_heap_allocated_size = max (sample.max_heap_allocated_size, heap_allocated);
+        }
+
+        float alloc_rate = (sample.elapsed_between_gcs ? ((float)sample.gc_allocated_size / (float)sample.elapsed_between_gcs) : 0.0f);
+        dynamic_heap_count_data.add_to_recorded_alloc_rate (alloc_rate);
+        dprintf (6666, ("allocated %Id since last GC (max %Id on one heap), %.3f bytes/us",
+            sample.gc_allocated_size, sample.max_heap_allocated_size, alloc_rate));
+
         // We check to see if we want to adjust the budget here for DATAS.
         size_t desired_per_heap_datas = desired_per_heap;
         float tcp = (sample.elapsed_between_gcs ?
@@ -27283,18 +27871,22 @@ FORCEINLINE
 uint8_t *mark_queue_t::queue_mark(uint8_t *o)
 {
 #ifdef MARK_PHASE_PREFETCH
-    Prefetch (o);
+    uint8_t* old_o = o;
+    if (gc_heap::mark_prefetch_p)
+    {
+        Prefetch (o);
 
-    // while the prefetch is taking effect, park our object in the queue
-    // and fetch an object that has been sitting in the queue for a while
-    // and where (hopefully) the memory is already in the cache
-    size_t slot_index = curr_slot_index;
-    uint8_t* old_o = slot_table[slot_index];
-    slot_table[slot_index] = o;
+        // while the prefetch is taking effect, park our object in the queue
+        // and fetch an object that has been sitting in the queue for a while
+        // and where (hopefully) the memory is already in the cache
+        size_t slot_index = curr_slot_index;
+        old_o = slot_table[slot_index];
+        slot_table[slot_index] = o;
 
-    curr_slot_index = (slot_index + 1) % slot_count;
-    if (old_o == nullptr)
-        return nullptr;
+        curr_slot_index = (slot_index + 1) % slot_count;
+        if (old_o == nullptr)
+            return nullptr;
+    }
 #else //MARK_PHASE_PREFETCH
     uint8_t* old_o = o;
 #endif //MARK_PHASE_PREFETCH
@@ -27383,6 +27975,73 @@ void mark_queue_t::verify_empty()
 #endif //MARK_PHASE_PREFETCH
 }
 
+#ifdef BACKGROUND_GC
+background_mark_queue_t::background_mark_queue_t()
+#ifdef MARK_PHASE_PREFETCH
+    : curr_slot_index(0)
+#endif //MARK_PHASE_PREFETCH
+{
+#ifdef MARK_PHASE_PREFETCH
+    for (size_t i = 0; i < slot_count; i++)
+    {
+        slot_table[i] = nullptr;
+    }
+#endif //MARK_PHASE_PREFETCH
+}
+
+// place an object that was just marked in the mark array in the queue
+// returns a *different* marked object whose method table can now be read,
+// or nullptr
+FORCEINLINE
+uint8_t* background_mark_queue_t::queue_marked (uint8_t* o)
+{
+#ifdef MARK_PHASE_PREFETCH
+    if (gc_heap::mark_prefetch_p)
+    {
+        Prefetch (o);
+
+        size_t slot_index = curr_slot_index;
+        uint8_t* old_o = slot_table[slot_index];
+        slot_table[slot_index] = o;
+
+        curr_slot_index = (slot_index + 1) % slot_count;
+        return old_o;
+    }
+#endif //MARK_PHASE_PREFETCH
+    return o;
+}
+
+// retrieve an object still parked in the queue
+// returns nullptr if the queue is empty
+uint8_t* background_mark_queue_t::get_next_queued()
+{
+#ifdef MARK_PHASE_PREFETCH
+    for (size_t i = 0; i < slot_count; i++)
+    {
+        size_t slot_index = curr_slot_index;
+        uint8_t* o = slot_table[slot_index];
+        slot_table[slot_index] = nullptr;
+        curr_slot_index = (slot_index + 1) % slot_count;
+        if (o != nullptr)
+        {
+            return o;
+        }
+    }
+#endif //MARK_PHASE_PREFETCH
+    return nullptr;
+}
+
+void background_mark_queue_t::verify_empty()
+{
+#ifdef MARK_PHASE_PREFETCH
+    for (size_t slot_index = 0; slot_index < slot_count; slot_index++)
+    {
+        assert(slot_table[slot_index] == nullptr);
+    }
+#endif //MARK_PHASE_PREFETCH
+}
+#endif //BACKGROUND_GC
+
 void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL)
 {
     SERVER_SC_MARK_VOLATILE(uint8_t*)* mark_stack_tos = (SERVER_SC_MARK_VOLATILE(uint8_t*)*)mark_stack_array;
@@ -27603,6 +28262,12 @@ more_to_do:
 #endif //SORT_MARK_STACK
         }
     next_level:
+#ifdef MH_SC_MARK
+        if (VolatileLoadWithoutBarrier (&mark_steal_waiting_heaps) > 0)
+        {
+            mark_stack_tos = publish_mark_steal_chunk (mark_stack_tos, mark_stack_base);
+        }
+#endif //MH_SC_MARK
         if (!(mark_stack_empty_p()))
         {
             oo = *(--mark_stack_tos);
@@ -27612,6 +28277,23 @@ more_to_do:
             sorted_tos = min ((size_t)sorted_tos, (size_t)mark_stack_tos);
 #endif //SORT_MARK_STACK
         }
+#ifdef MH_SC_MARK
+        else if (!mark_steal_chunks.empty_p())
+        {
+            // Take back what we published but nobody took yet. We need to do this before
+            // we return so we are still marked busy while we have chunks in our queue.
+            size_t count = mark_steal_chunks.take (mark_steal_buffer);
+            for (size_t i = 0; i < count; i++)
+            {
+                *(mark_stack_tos++) = mark_steal_buffer[i];
+            }
+            if (count)
+            {
+                mark_steal_stats.chunks_reclaimed++;
+            }
+            oo = 0;
+        }
+#endif //MH_SC_MARK
         else
             break;
     }
@@ -27635,6 +28317,111 @@ int find_next_buddy_heap (int this_heap_number, int current_buddy, int n_heaps)
     return current_buddy;
 }
 
+// Moves a run of plain objects off the top of the mark stack into our steal queue so heaps
+// that are out of work can take it. We never touch the snooping range at the bottom and
+// stop at the first entry that isn't a plain object since partial mark tuples and stolen
+// entries need to stay where they are.
+SERVER_SC_MARK_VOLATILE(uint8_t*)*
+gc_heap::publish_mark_steal_chunk (SERVER_SC_MARK_VOLATILE(uint8_t*)* tos,
+                                   SERVER_SC_MARK_VOLATILE(uint8_t*)* base)
+{
+    if ((tos - base) < (max_snoop_level + 2 * mark_steal_queue::chunk_length))
+    {
+        return tos;
+    }
+
+    SERVER_SC_MARK_VOLATILE(uint8_t*)* run_start = tos;
+    SERVER_SC_MARK_VOLATILE(uint8_t*)* run_limit = tos - mark_steal_queue::chunk_length;
+    while (run_start > run_limit)
+    {
+        uint8_t* o = *(run_start - 1);
+        if (((size_t)o <= 4) || ((size_t)o & (stolen | partial)))
+        {
+            break;
+        }
+        run_start--;
+    }
+
+    size_t count = tos - run_start;
+    if ((count < (mark_steal_queue::chunk_length / 2)) ||
+        !mark_steal_chunks.publish (run_start, count))
+    {
+        return tos;
+    }
+
+    mark_steal_stats.chunks_published++;
+    dprintf (3, ("h%d published a steal chunk of %zd objects", heap_number, count));
+    return run_start;
+}
+
+// Takes a chunk from the first heap starting at start_heap_number that has one and marks
+// through the objects in it. Returns true if we got a chunk.
+bool gc_heap::mark_stolen_chunk (int start_heap_number)
+{
+    int hpn = start_heap_number;
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[hpn];
+        if ((hp != this) && !hp->mark_steal_chunks.empty_p())
+        {
+            // We need to be busy before we take the chunk so other heaps
+            // don't think everyone's done while we are marking it.
+            mark_stack_busy() = 1;
+
+            size_t count = hp->mark_steal_chunks.take (mark_steal_buffer);
+            if (count)
+            {
+                uint64_t start_time = GetHighPrecisionTimeStamp();
+
+                for (size_t obj_idx = 0; obj_idx < count; obj_idx++)
+                {
+                    uint8_t* o = mark_steal_buffer[obj_idx];
+                    mark_object_simple1 (o, o, heap_number);
+                }
+
+                //clear the mark stack in snooping range
+                for (int level = 0; level < max_snoop_level; level++)
+                {
+                    ((VOLATILE(uint8_t*)*)(mark_stack_array))[level] = 0;
+                }
+
+                mark_steal_stats.chunks_stolen++;
+                mark_steal_stats.objects_stolen += count;
+                mark_steal_stats.stolen_work_time += GetHighPrecisionTimeStamp() - start_time;
+                mark_stack_busy() = 0;
+                return true;
+            }
+
+            mark_stack_busy() = 0;
+        }
+
+        hpn = (hpn + 1) % n_heaps;
+    }
+
+    return false;
+}
+
+void gc_heap::fire_mark_steal_event()
+{
+    dprintf (3, ("h%d mark steal: published %zd, reclaimed %zd, stole %zd chunks (%zd objs), idle %zd, %I64dus (%I64dus on stolen work)",
+        heap_number, mark_steal_stats.chunks_published, mark_steal_stats.chunks_reclaimed,
+        mark_steal_stats.chunks_stolen, mark_steal_stats.objects_stolen, mark_steal_stats.idle_count,
+        mark_steal_stats.steal_time, mark_steal_stats.stolen_work_time));
+
+#ifdef FEATURE_EVENT_TRACE
+    GCEventFireMarkSteal_V1 (
+        (uint64_t)settings.gc_index,
+        (uint16_t)heap_number,
+        (uint32_t)mark_steal_stats.chunks_published,
+        (uint32_t)mark_steal_stats.chunks_reclaimed,
+        (uint32_t)mark_steal_stats.chunks_stolen,
+        (uint64_t)mark_steal_stats.objects_stolen,
+        (uint32_t)mark_steal_stats.idle_count,
+        (uint32_t)mark_steal_stats.steal_time,
+        (uint32_t)mark_steal_stats.stolen_work_time);
+#endif //FEATURE_EVENT_TRACE
+}
+
 void
 gc_heap::mark_steal()
 {
@@ -27645,6 +28432,9 @@ gc_heap::mark_steal()
         ((VOLATILE(uint8_t*)*)(mark_stack_array))[i] = 0;
     }
 
+    uint64_t steal_start_time = GetHighPrecisionTimeStamp();
+    Interlocked::Increment (&mark_steal_waiting_heaps);
+
     //pick the next heap as our buddy
     int thpn = find_next_buddy_heap (heap_number, heap_number, n_heaps);
 
@@ -27658,6 +28448,15 @@ gc_heap::mark_steal()
 
     while (1)
     {
+        // Taking a whole chunk is a lot cheaper than snooping single objects
+        // off the bottom of someone's mark stack so try that first.
+        if (mark_stolen_chunk (thpn))
+        {
+            idle_loop_count = 0;
+            first_not_ready_level = 0;
+            continue;
+        }
+
         gc_heap* hp = g_heaps [thpn];
         int level = first_not_ready_level;
         first_not_ready_level = 0;
@@ -27796,6 +28595,7 @@ gc_heap::mark_steal()
         {
             first_not_ready_level = 0;
             idle_loop_count++;
+            mark_steal_stats.idle_count++;
 
             if ((idle_loop_count % (6) )==1)
             {
@@ -27832,6 +28632,8 @@ gc_heap::mark_steal()
             }
         }
     }
+
+    mark_steal_stats.steal_time = GetHighPrecisionTimeStamp() - steal_start_time;
 }
 
 inline
@@ -28124,18 +28926,21 @@ void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
                     go_through_object_cl (method_table(oo), oo, s, ppslot,
                     {
                         uint8_t* o = *ppslot;
-                        Prefetch(o);
                         if (background_mark (o,
                                              background_saved_lowest_address,
                                              background_saved_highest_address))
                         {
-                            //m_boundary (o);
-                            size_t obj_size = size (o);
-                            bpromoted_bytes (thread) += obj_size;
-                            if (contain_pointers_or_collectible (o))
+                            o = background_mark_queue.queue_marked (o);
+                            if (o != nullptr)
                             {
-                                *(background_mark_stack_tos++) = o;
+                                //m_boundary (o);
+                                size_t obj_size = size (o);
+                                bpromoted_bytes (thread) += obj_size;
+                                if (contain_pointers_or_collectible (o))
+                                {
+                                    *(background_mark_stack_tos++) = o;
 
+                                }
                             }
                         }
                     }
@@ -28223,11 +29028,19 @@ void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
                                        start, use_start, (oo + s),
                     {
                         uint8_t* o = *ppslot;
-                        Prefetch(o);
 
                         if (background_mark (o,
                                             background_saved_lowest_address,
                                             background_saved_highest_address))
+                        {
+                            o = background_mark_queue.queue_marked (o);
+                        }
+                        else
+                        {
+                            o = nullptr;
+                        }
+
+                        if (o != nullptr)
                         {
                             //m_boundary (o);
                             size_t obj_size = size (o);
@@ -28284,6 +29097,20 @@ next_level:
 #endif // COLLECTIBLE_CLASS
         allow_fgc();
 
+        if (background_mark_stack_tos == background_mark_stack_array)
+        {
+            // Objects still parked in the queue are marked but haven't been looked at yet.
+            uint8_t* queued_o;
+            while ((queued_o = background_mark_queue.get_next_queued()) != nullptr)
+            {
+                bpromoted_bytes (thread) += size (queued_o);
+                if (contain_pointers_or_collectible (queued_o))
+                {
+                    *(background_mark_stack_tos++) = queued_o;
+                }
+            }
+        }
+
         if (!(background_mark_stack_tos == background_mark_stack_array))
         {
             oo = *(--background_mark_stack_tos);
@@ -28297,6 +29124,7 @@ next_level:
     }
 
     assert (background_mark_stack_tos == background_mark_stack_array);
+    background_mark_queue.verify_empty();
 
 
 }
@@ -28442,6 +29270,20 @@ gc_heap::scan_background_roots (promote_func* fn, int hn, ScanContext *pSC)
         mark_list_finger++;
     }
 
+#ifdef MARK_PHASE_PREFETCH
+    dprintf (3, ("Scanning background mark queue"));
+
+    for (size_t slot_index = 0; slot_index < background_mark_queue_t::slot_count; slot_index++)
+    {
+        uint8_t** slot = background_mark_queue.get_slot (slot_index);
+        if (*slot != nullptr)
+        {
+            dprintf(3,("background root %zx", (size_t)*slot));
+            (*fn) ((Object**)slot, pSC, 0);
+        }
+    }
+#endif //MARK_PHASE_PREFETCH
+
     //scan the mark stack
     dprintf (3, ("Scanning background mark stack"));
 
@@ -29366,12 +30208,12 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
             gc_t_join.restart();
         }
 
-        // If the portion of the dependent handle table managed by this worker has handles that could still be
-        // promoted perform a rescan. If the rescan resulted in at least one promotion note this fact since it
-        // could require a rescan of handles on this or other workers.
-        if (GCScan::GcDhUnpromotedHandlesExist(sc))
-            if (GCScan::GcDhReScan(sc))
-                s_fUnscannedPromotions = TRUE;
+        // Rescan the dependent handle table. Every worker needs to call this since the rescan may be split
+        // between all the workers - if it isn't, a worker whose portion of the table has no handles that could
+        // still be promoted returns right away. If the rescan resulted in at least one promotion note this fact
+        // since it could require a rescan of handles on this or other workers.
+        if (GCScan::GcDhReScan(sc))
+            s_fUnscannedPromotions = TRUE;
     }
 }
 #else //MULTIPLE_HEAPS
@@ -29677,6 +30519,9 @@ void gc_heap::mark_phase (int condemned_gen_number)
 
         mark_stack_busy() = 1;
     }
+
+    mark_steal_chunks.reset();
+    memset (&mark_steal_stats, 0, sizeof (mark_steal_stats));
 #endif //MH_SC_MARK
 
     static uint32_t num_sizedrefs = 0;
@@ -29785,6 +30630,8 @@ void gc_heap::mark_phase (int condemned_gen_number)
         {
             do_mark_steal_p = FALSE;
         }
+
+        mark_steal_waiting_heaps = 0;
 #endif //MH_SC_MARK
 
         gc_t_join.restart();
@@ -30025,6 +30872,7 @@ void gc_heap::mark_phase (int condemned_gen_number)
         mark_steal();
         drain_mark_queue();
         fire_mark_event (ETW::GC_ROOT_STEAL, current_promoted_bytes, last_promoted_bytes);
+        fire_mark_steal_event();
     }
 #endif //MH_SC_MARK
 
@@ -32514,6 +33362,145 @@ void gc_heap::add_plug_in_condemned_info (generation* gen, size_t plug_size)
     (bucket_info[bucket_index].count)++;
     bucket_info[bucket_index].size += plug_size;
 }
+
+// Tallies the survivors per type in a random 1 out of type_census_sample_rate of the
+// condemned regions (or segments). This runs before plan changes anything so the
+// regions are still walkable and the mark bits tell us what survived.
+void gc_heap::sample_type_census (int condemned_gen_number)
+{
+    if (!type_census_table || !GCEventEnabledTypeCensusSummary_V1())
+        return;
+
+    memset (type_census_table, 0, sizeof (type_census_entry) * type_census_table_length);
+
+    size_t regions_total = 0;
+    size_t regions_sampled = 0;
+    size_t objects_dropped = 0;
+
+#ifdef USE_REGIONS
+    int stop_gen_idx = get_stop_generation_index (condemned_gen_number);
+    for (int gen_idx = condemned_gen_number; gen_idx >= stop_gen_idx; gen_idx--)
+#else //USE_REGIONS
+    int gen_idx = condemned_gen_number;
+#endif //USE_REGIONS
+    {
+        generation* gen = generation_of (gen_idx);
+        heap_segment* seg = heap_segment_rw (generation_start_segment (gen));
+        uint8_t* start = get_soh_start_object (seg, gen);
+
+        while (seg)
+        {
+            regions_total++;
+            if (gc_rand::get_rand (type_census_sample_rate) == 0)
+            {
+                regions_sampled++;
+
+                uint8_t* o = start;
+                uint8_t* end = heap_segment_allocated (seg);
+                while (o < end)
+                {
+                    size_t s = Align (size (o));
+                    if (marked (o))
+                    {
+                        MethodTable* mt = method_table (o);
+                        size_t index = ((size_t)mt >> 3) & (type_census_table_length - 1);
+                        size_t probes = 0;
+                        while ((type_census_table[index].mt != nullptr) &&
+                               (type_census_table[index].mt != mt) &&
+                               (probes < type_census_table_length))
+                        {
+                            index = (index + 1) & (type_census_table_length - 1);
+                            probes++;
+                        }
+
+                        if (probes == type_census_table_length)
+                        {
+                            // table is full, we don't evict, we just report how much we missed.
+                            objects_dropped++;
+                        }
+                        else
+                        {
+                            type_census_table[index].mt = mt;
+                            type_census_table[index].count++;
+                            type_census_table[index].size += s;
+                        }
+                    }
+                    o += s;
+                }
+            }
+
+            seg = heap_segment_next_rw (seg);
+            if (seg)
+            {
+                start = heap_segment_mem (seg);
+            }
+        }
+    }
+
+    fire_type_census_events (condemned_gen_number, regions_total, regions_sampled, objects_dropped);
+}
+
+void gc_heap::fire_type_census_events (int condemned_gen_number,
+                                       size_t regions_total,
+                                       size_t regions_sampled,
+                                       size_t objects_dropped)
+{
+    // compact the used entries to the front; the table is cleared before the next census.
+    size_t type_count = 0;
+    size_t sampled_count = 0;
+    size_t sampled_size = 0;
+    for (size_t i = 0; i < type_census_table_length; i++)
+    {
+        if (type_census_table[i].mt != nullptr)
+        {
+            sampled_count += type_census_table[i].count;
+            sampled_size += type_census_table[i].size;
+            type_census_table[type_count++] = type_census_table[i];
+        }
+    }
+
+    dprintf (2, ("h%d type census gen%d: sampled %zd/%zd regions, %zd types, %zd objs, %zd bytes, dropped %zd objs",
+        heap_number, condemned_gen_number, regions_sampled, regions_total,
+        type_count, sampled_count, sampled_size, objects_dropped));
+
+    GCEventFireTypeCensusSummary_V1 (
+        (uint64_t)settings.gc_index,
+        (uint16_t)heap_number,
+        (uint16_t)condemned_gen_number,
+        (uint32_t)type_census_sample_rate,
+        (uint32_t)regions_total,
+        (uint32_t)regions_sampled,
+        (uint32_t)type_count,
+        (uint64_t)sampled_count,
+        (uint64_t)sampled_size,
+        (uint64_t)objects_dropped);
+
+    // only report the types with the most surviving bytes.
+    size_t top_count = min (type_count, (size_t)type_census_top_count);
+    for (size_t rank = 0; rank < top_count; rank++)
+    {
+        size_t largest = rank;
+        for (size_t i = rank + 1; i < type_count; i++)
+        {
+            if (type_census_table[i].size > type_census_table[largest].size)
+            {
+                largest = i;
+            }
+        }
+
+        type_census_entry largest_entry = type_census_table[largest];
+        type_census_table[largest] = type_census_table[rank];
+        type_census_table[rank] = largest_entry;
+
+        GCEventFireTypeCensusEntry_V1 (
+            (uint64_t)settings.gc_index,
+            (uint16_t)heap_number,
+            (uint16_t)rank,
+            (uint64_t)(size_t)largest_entry.mt,
+            (uint64_t)largest_entry.count,
+            (uint64_t)largest_entry.size);
+    }
+}
 #endif //FEATURE_EVENT_TRACE
 
 inline void save_allocated(heap_segment* seg)
@@ -32558,6 +33545,7 @@ void gc_heap::plan_phase (int condemned_gen_number)
         mark_list_index = mark_list_end + 1;
 #ifndef MULTIPLE_HEAPS // in Server GC, we check for mark list overflow in sort_mark_list
         mark_list_overflow = true;
+        mark_list_overflow_heaps = 1;
 #endif
     }
 #else //GC_CONFIG_DRIVEN
@@ -32590,6 +33578,10 @@ void gc_heap::plan_phase (int condemned_gen_number)
     sweep_ro_segments();
 #endif //FEATURE_BASICFREEZE
 
+#ifdef USE_REGIONS
+    decide_gen2_evac_surv_ratio_th();
+#endif //USE_REGIONS
+
 #ifndef MULTIPLE_HEAPS
     int condemned_gen_index = get_stop_generation_index (condemned_gen_number);
     for (; condemned_gen_index <= condemned_gen_number; condemned_gen_index++)
@@ -32714,6 +33706,10 @@ void gc_heap::plan_phase (int condemned_gen_number)
     }
 #endif //MULTIPLE_HEAPS
 
+#ifdef FEATURE_EVENT_TRACE
+    sample_type_census (condemned_gen_number);
+#endif //FEATURE_EVENT_TRACE
+
     heap_segment*  seg1 = heap_segment_rw (generation_start_segment (condemned_gen1));
 
     PREFIX_ASSUME(seg1 != NULL);
@@ -34169,9 +35165,18 @@ void gc_heap::plan_phase (int condemned_gen_number)
 
         GCToEEInterface::DiagWalkSurvivors(__this, true);
 
+#ifdef FEATURE_EVENT_TRACE
+        uint64_t phase_start_us = (phase_histogram_gc_count ? GetHighPrecisionTimeStamp() : 0);
+#endif //FEATURE_EVENT_TRACE
         relocate_phase (condemned_gen_number, first_condemned_address);
+#ifdef FEATURE_EVENT_TRACE
+        phase_start_us = record_phase_time (pause_phase_relocate, phase_start_us);
+#endif //FEATURE_EVENT_TRACE
         compact_phase (condemned_gen_number, first_condemned_address,
                        (!settings.demotion && settings.promotion));
+#ifdef FEATURE_EVENT_TRACE
+        record_phase_time (pause_phase_compact, phase_start_us);
+#endif //FEATURE_EVENT_TRACE
         fix_generation_bounds (condemned_gen_number, consing_gen);
         assert (generation_allocation_limit (youngest_generation) ==
                 generation_allocation_pointer (youngest_generation));
@@ -34417,7 +35422,13 @@ void gc_heap::plan_phase (int condemned_gen_number)
 
         GCToEEInterface::DiagWalkSurvivors(__this, false);
 
+#ifdef FEATURE_EVENT_TRACE
+        uint64_t phase_start_us = (phase_histogram_gc_count ? GetHighPrecisionTimeStamp() : 0);
+#endif //FEATURE_EVENT_TRACE
         make_free_lists (condemned_gen_number);
+#ifdef FEATURE_EVENT_TRACE
+        record_phase_time (pause_phase_sweep, phase_start_us);
+#endif //FEATURE_EVENT_TRACE
         size_t total_recovered_sweep_size = recover_saved_pinned_info();
         if (total_recovered_sweep_size > 0)
         {
@@ -35070,10 +36081,61 @@ void gc_heap::update_start_tail_regions (generation* gen,
 //
 // This new region we get needs to be temporarily recorded instead of being on the free_regions list because
 // we can't use it for other purposes.
+//
+// Evacuating surviving gen2 objects is what makes a full compacting GC's pause long. When
+// GCGen2EvacuationBudget is set, we bucket this heap's gen2 regions by survival ratio and only
+// compact the sparsest ones whose survivors fit in the budget - the denser ones are swept in
+// plan and left for later full GCs to compact once more of them has died.
+void gc_heap::decide_gen2_evac_surv_ratio_th()
+{
+    gen2_evac_surv_ratio_th = sip_surv_ratio_th;
+
+    if ((gen2_evac_budget == 0) ||
+        (settings.condemned_generation != max_generation) ||
+        (settings.reason == reason_induced_aggressive))
+    {
+        return;
+    }
+
+    const int surv_ratio_buckets = 101;
+    size_t surv_per_ratio[surv_ratio_buckets];
+    memset (surv_per_ratio, 0, sizeof (surv_per_ratio));
+
+    size_t basic_region_size = (size_t)1 << min_segment_size_shr;
+    heap_segment* region = heap_segment_rw (generation_start_segment (generation_of (max_generation)));
+
+    while (region)
+    {
+        size_t surv = heap_segment_survived (region);
+        int surv_ratio = (int)min ((size_t)100, ((surv * 100) / basic_region_size));
+        surv_per_ratio[surv_ratio] += surv;
+        region = heap_segment_next (region);
+    }
+
+    // We always allow completely dead regions to be compacted, otherwise they would not be freed.
+    size_t total_evac_surv = surv_per_ratio[0];
+    int surv_ratio_th = 1;
+
+    while ((surv_ratio_th < sip_surv_ratio_th) &&
+           ((total_evac_surv + surv_per_ratio[surv_ratio_th]) <= gen2_evac_budget))
+    {
+        total_evac_surv += surv_per_ratio[surv_ratio_th];
+        surv_ratio_th++;
+    }
+
+    gen2_evac_surv_ratio_th = surv_ratio_th;
+
+    dprintf (REGIONS_LOG, ("h%d gen2 evac budget %zd, evacuating %zd, gen2 regions >= %d%% will be SIP",
+        heap_number, gen2_evac_budget, total_evac_surv, gen2_evac_surv_ratio_th));
+}
+
 inline
 bool gc_heap::should_sweep_in_plan (heap_segment* region)
 {
-    if (!enable_special_regions_p)
+    int gen_num = get_region_gen_num (region);
+    bool gen2_evac_limited_p = ((gen_num == max_generation) && (gen2_evac_surv_ratio_th < sip_surv_ratio_th));
+
+    if (!enable_special_regions_p && !gen2_evac_limited_p)
     {
         return false;
     }
@@ -35083,8 +36145,8 @@ bool gc_heap::should_sweep_in_plan (heap_segment* region)
         return false;
     }
     bool sip_p = false;
-    int gen_num = get_region_gen_num (region);
     int new_gen_num = get_plan_gen_num (gen_num);
+    int surv_ratio_th = ((gen_num == max_generation) ? gen2_evac_surv_ratio_th : sip_surv_ratio_th);
     heap_segment_swept_in_plan (region) = false;
 
     dprintf (REGIONS_LOG, ("checking if region %p should be SIP", heap_segment_mem (region)));
@@ -35118,8 +36180,8 @@ bool gc_heap::should_sweep_in_plan (heap_segment* region)
             heap_segment_mem (region),
             heap_segment_survived (region),
             basic_region_size,
-            surv_ratio, sip_surv_ratio_th));
-        if (surv_ratio >= sip_surv_ratio_th)
+            surv_ratio, surv_ratio_th));
+        if (surv_ratio >= surv_ratio_th)
         {
             set_region_plan_gen_num (region, new_gen_num);
             sip_p = true;
@@ -37772,12 +38834,12 @@ void gc_heap::background_scan_dependent_handles (ScanContext *sc)
             bgc_t_join.restart();
         }
 
-        // If the portion of the dependent handle table managed by this worker has handles that could still be
-        // promoted perform a rescan. If the rescan resulted in at least one promotion note this fact since it
-        // could require a rescan of handles on this or other workers.
-        if (GCScan::GcDhUnpromotedHandlesExist(sc))
-            if (GCScan::GcDhReScan(sc))
-                s_fUnscannedPromotions = TRUE;
+        // Rescan the dependent handle table. Every worker needs to call this since the rescan may be split
+        // between all the workers - if it isn't, a worker whose portion of the table has no handles that could
+        // still be promoted returns right away. If the rescan resulted in at least one promotion note this fact
+        // since it could require a rescan of handles on this or other workers.
+        if (GCScan::GcDhReScan(sc))
+            s_fUnscannedPromotions = TRUE;
     }
 }
 #else
@@ -37834,6 +38896,60 @@ void gc_heap::allow_fgc()
             GCToEEInterface::DisablePreemptiveGC();
         }
     }
+
+    if (bgc_cpu_share != 0)
+    {
+        throttle_bgc_cpu();
+    }
+}
+
+// Called from allow_fgc, so it's a point where we are not holding anything a
+// foreground GC or a user thread could be waiting on. We only look at the time
+// every so often and once we have been busy for a whole quantum we sleep long
+// enough to bring this thread's share of CPU time back down to bgc_cpu_share.
+// This only applies when the user threads are running, ie, during concurrent
+// mark and concurrent sweep - we never want to make a BGC pause longer.
+void gc_heap::throttle_bgc_cpu()
+{
+    const uint32_t throttle_check_interval = 256;
+    const uint64_t throttle_quantum_us = 10 * 1000;
+    const uint64_t max_throttle_sleep_us = 100 * 1000;
+
+    if (++bgc_throttle_check_count < throttle_check_interval)
+    {
+        return;
+    }
+    bgc_throttle_check_count = 0;
+
+    if (!cm_in_progress && (current_c_gc_state != c_gc_state_planning))
+    {
+        // The EE is suspended (or about to be) - start a new quantum once we are concurrent again.
+        bgc_throttle_quantum_start_us = 0;
+        return;
+    }
+
+    uint64_t now_us = GetHighPrecisionTimeStamp();
+    if (bgc_throttle_quantum_start_us == 0)
+    {
+        bgc_throttle_quantum_start_us = now_us;
+        return;
+    }
+
+    uint64_t busy_us = now_us - bgc_throttle_quantum_start_us;
+    if (busy_us < throttle_quantum_us)
+    {
+        return;
+    }
+
+    uint64_t sleep_us = min ((busy_us * (100 - bgc_cpu_share) / bgc_cpu_share), max_throttle_sleep_us);
+    dprintf (2, ("h%d BGC busy for %I64dus, sleeping %I64dus (cpu share %d%%)",
+        heap_number, busy_us, sleep_us, bgc_cpu_share));
+
+    bool cooperative_mode = enable_preemptive ();
+    GCToOSInterface::Sleep ((uint32_t)(sleep_us / 1000));
+    disable_preemptive (cooperative_mode);
+
+    bgc_throttle_quantum_start_us = GetHighPrecisionTimeStamp();
 }
 
 BOOL gc_heap::is_bgc_in_progress()
@@ -41188,6 +42304,15 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
                 else
                 {
                     cardb += sizeof(cbw)*8 - card_bundle_bit (cardb);
+
+                    // skip over the bundle words that are entirely clear
+                    if (cardb < end_cardb)
+                    {
+                        uint32_t* cbw_start = &card_bundle_table[card_bundle_word (cardb)];
+                        uint32_t* cbw_end = &card_bundle_table[card_bundle_word (end_cardb - 1) + 1];
+                        uint32_t* next_cbw = find_non_zero_card_word (cbw_start, cbw_end);
+                        cardb += (next_cbw - cbw_start) * card_bundle_word_width;
+                    }
                 }
             }
             if (cardb >= end_cardb)
@@ -41195,10 +42320,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
 
             uint32_t* card_word = &card_table[max(card_bundle_cardw (cardb),cardw)];
             uint32_t* card_word_end = &card_table[min(card_bundle_cardw (cardb+1),cardw_end)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_non_zero_card_word (card_word, card_word_end);
 
             if (card_word != card_word_end)
             {
@@ -41212,10 +42334,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
             }
             // explore the end of the card bundle so we can possibly clear it
             card_word_end = &card_table[card_bundle_cardw (cardb+1)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_non_zero_card_word (card_word, card_word_end);
             if ((cardw <= card_bundle_cardw (cardb)) &&
                 (card_word == card_word_end))
             {
@@ -41232,18 +42351,12 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
     }
     else
     {
-        uint32_t* card_word = &card_table[cardw];
-        uint32_t* card_word_end = &card_table [cardw_end];
+        uint32_t* card_word = find_non_zero_card_word (&card_table[cardw], &card_table [cardw_end]);
 
-        while (card_word < card_word_end)
+        if (card_word < &card_table [cardw_end])
         {
-            if ((*card_word) != 0)
-            {
-                cardw = (card_word - &card_table [0]);
-                return TRUE;
-            }
-
-            card_word++;
+            cardw = (card_word - &card_table [0]);
+            return TRUE;
         }
         return FALSE;
 
@@ -41303,12 +42416,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 #else //CARD_BUNDLE
         // Go through the remaining card words between here and card_word_end until we find
         // one that is non-zero.
-        do
-        {
-            ++last_card_word;
-        }
-
-        while ((last_card_word < &card_table [card_word_end]) && !(*last_card_word));
+        last_card_word = find_non_zero_card_word (last_card_word + 1, &card_table [card_word_end]);
         if (last_card_word < &card_table [card_word_end])
         {
             card_word_value = *last_card_word;
@@ -44428,6 +45536,53 @@ void gc_heap::decommit_ephemeral_segment_pages()
 }
 #endif //!USE_REGIONS || MULTIPLE_HEAPS
 
+#ifdef USE_REGIONS
+// The default pace of DECOMMIT_SIZE_PER_MILLISECOND is meant to not take too much CPU time away from the
+// app but when we are in a container that's getting close to the point where the OS will start throttling
+// or reclaiming from us, handing the free regions back faster is more important. We go slower than the
+// default when there's plenty of room as there may be another GC that uses these regions again.
+size_t gc_heap::get_decommit_step_budget (uint64_t step_milliseconds, uint32_t* stall_percent, uint64_t* bytes_below_soft_limit)
+{
+    size_t budget = DECOMMIT_SIZE_PER_MILLISECOND * step_milliseconds;
+    *stall_percent = 0;
+    *bytes_below_soft_limit = UINT64_MAX;
+
+    if (!is_restricted_physical_mem ||
+        !GCToOSInterface::GetMemoryPressure (stall_percent, bytes_below_soft_limit))
+    {
+        return budget;
+    }
+
+    size_t regions_to_decommit_size = 0;
+    for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
+    {
+        regions_to_decommit_size += global_regions_to_decommit[kind].get_size_committed_in_free();
+    }
+
+    size_t factor_percent = 100;
+    if ((*stall_percent >= 10) || (*bytes_below_soft_limit <= (uint64_t)regions_to_decommit_size))
+    {
+        // we are already stalling or going to be once we've used what we have committed
+        factor_percent = 800;
+    }
+    else if ((*stall_percent >= 1) || (*bytes_below_soft_limit <= (uint64_t)regions_to_decommit_size * 4))
+    {
+        factor_percent = 300;
+    }
+    else if (*bytes_below_soft_limit >= (total_physical_mem / 4))
+    {
+        factor_percent = 50;
+    }
+
+    budget = max ((budget / 100) * factor_percent, (size_t)MIN_DECOMMIT_SIZE);
+
+    dprintf (REGIONS_LOG, ("decommit_step: stall %d%%, %zd below soft limit, %zd to decommit -> budget %zd (%zd%%)",
+        *stall_percent, (size_t)*bytes_below_soft_limit, regions_to_decommit_size, budget, factor_percent));
+
+    return budget;
+}
+#endif //USE_REGIONS
+
 #if defined(MULTIPLE_HEAPS) || defined(USE_REGIONS)
 // return true if we actually decommitted anything
 bool gc_heap::decommit_step (uint64_t step_milliseconds)
@@ -44441,8 +45596,11 @@ bool gc_heap::decommit_step (uint64_t step_milliseconds)
     size_t decommit_size = 0;
 
 #ifdef USE_REGIONS
-    const size_t max_decommit_step_size = DECOMMIT_SIZE_PER_MILLISECOND * step_milliseconds;
-    for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
+    uint32_t stall_percent = 0;
+    uint64_t bytes_below_soft_limit = 0;
+    const size_t max_decommit_step_size = get_decommit_step_budget (step_milliseconds, &stall_percent, &bytes_below_soft_limit);
+    bool budget_exhausted_p = false;
+    for (int kind = basic_free_region; (kind < count_free_region_kinds) && !budget_exhausted_p; kind++)
     {
         dprintf (REGIONS_LOG, ("decommit_step %d, regions_to_decommit = %zd",
             kind, global_regions_to_decommit[kind].get_num_free_regions()));
@@ -44453,10 +45611,35 @@ bool gc_heap::decommit_step (uint64_t step_milliseconds)
             decommit_size += size;
             if (decommit_size >= max_decommit_step_size)
             {
-                return true;
+                budget_exhausted_p = true;
+                break;
             }
         }
     }
+
+#ifdef FEATURE_EVENT_TRACE
+    if ((decommit_size != 0) && GCEventEnabledDecommitStep_V1())
+    {
+        size_t remaining_regions = 0;
+        for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
+        {
+            remaining_regions += global_regions_to_decommit[kind].get_num_free_regions();
+        }
+
+        GCEventFireDecommitStep_V1 (
+            (uint32_t)stall_percent,
+            (uint64_t)bytes_below_soft_limit,
+            (uint64_t)max_decommit_step_size,
+            (uint64_t)decommit_size,
+            (uint64_t)remaining_regions
+        );
+    }
+#endif //FEATURE_EVENT_TRACE
+
+    if (budget_exhausted_p)
+    {
+        return true;
+    }
     if (use_large_pages_p)
     {
         return (decommit_size != 0);
@@ -48695,6 +49878,10 @@ HRESULT GCHeap::Initialize()
     gc_heap::gc_thread_no_affinitize_p = (gc_heap::heap_hard_limit ?
         !affinity_config_specified_p : (GCConfig::GetNoAffinitize() != 0));
 
+    // Pinning allocating threads only makes sense if the heaps themselves stay on their processors.
+    gc_heap::affinitize_allocating_threads_p = !gc_heap::gc_thread_no_affinitize_p &&
+        (GCConfig::GetAffinitizeAllocatingThreads() != 0);
+
     if (!(gc_heap::gc_thread_no_affinitize_p))
     {
         uint32_t num_affinitized_processors = (uint32_t)process_affinity_set->Count();
@@ -48799,8 +49986,16 @@ HRESULT GCHeap::Initialize()
     loh_size_threshold = (size_t)GCConfig::GetLOHThreshold();
     loh_size_threshold = max (loh_size_threshold, LARGE_OBJECT_SIZE);
 
+#ifdef FEATURE_EVENT_TRACE
+    gc_heap::phase_histogram_gc_count = (size_t)GCConfig::GetGCPhaseHistogramGCs();
+#endif //FEATURE_EVENT_TRACE
+
 #ifdef USE_REGIONS
     gc_heap::enable_special_regions_p = (bool)GCConfig::GetGCEnableSpecialRegions();
+    gc_heap::gen2_evac_budget = (size_t)GCConfig::GetGCGen2EvacuationBudget();
+#ifdef MARK_PHASE_PREFETCH
+    gc_heap::mark_prefetch_p = GCConfig::GetGCMarkPrefetch();
+#endif //MARK_PHASE_PREFETCH
     size_t gc_region_size = (size_t)GCConfig::GetGCRegionSize();
 
     if (gc_region_size >= MAX_REGION_SIZE)
@@ -49085,6 +50280,8 @@ HRESULT GCHeap::Initialize()
 
         GCToEEInterface::DiagUpdateGenerationBounds();
 
+        gc_heap::fire_gc_profile_event();
+
 #if defined(STRESS_REGIONS) && defined(FEATURE_BASICFREEZE)
 #ifdef MULTIPLE_HEAPS
         gc_heap* hp = gc_heap::g_heaps[0];
@@ -50789,6 +51986,10 @@ void gc_heap::do_post_gc()
     is_last_recorded_bgc = settings.concurrent;
 #endif //BACKGROUND_GC
 
+#ifdef FEATURE_EVENT_TRACE
+    fire_phase_histogram_events();
+#endif //FEATURE_EVENT_TRACE
+
 #ifdef TRACE_GC
     if (heap_hard_limit)
     {
@@ -50892,9 +52093,22 @@ void gc_heap::do_post_gc()
 
     if (mark_list_overflow)
     {
+        size_t prev_mark_list_size = mark_list_size;
         grow_mark_list();
+
+#ifdef FEATURE_EVENT_TRACE
+        GCEventFireMarkListOverflow_V1 (
+            (uint64_t)settings.gc_index,
+            (uint32_t)mark_list_overflow_heaps,
+            (uint64_t)prev_mark_list_size,
+            (uint64_t)mark_list_size,
+            (uint64_t)(g_mark_list_committed_size * sizeof (uint8_t*)),
+            (uint64_t)(g_mark_list_reserved_size * sizeof (uint8_t*)));
+#endif //FEATURE_EVENT_TRACE
+
         mark_list_overflow = false;
     }
+    mark_list_overflow_heaps = 0;
 }
 
 unsigned GCHeap::GetGcCount()
@@ -50973,6 +52187,9 @@ GCHeap::GarbageCollectGeneration (unsigned int gen, gc_reason reason)
         BEGIN_TIMING(suspend_ee_during_log);
         GCToEEInterface::SuspendEE(SUSPEND_FOR_GC);
         END_TIMING(suspend_ee_during_log);
+#ifdef FEATURE_EVENT_TRACE
+        gc_heap::record_suspension_time();
+#endif //FEATURE_EVENT_TRACE
         gc_heap::proceed_with_gc_p = gc_heap::should_proceed_with_gc();
         gc_heap::disable_preemptive (cooperative_mode);
         if (gc_heap::proceed_with_gc_p)
@@ -51533,6 +52750,61 @@ size_t GCHeap::GetValidSegmentSize(bool large_seg)
 #endif //USE_REGIONS
 }
 
+#ifdef MULTIPLE_HEAPS
+// The default cache probe reports the size of a single last level cache. On parts where
+// that cache is split into domains that each serve a subset of the cores (eg, AMD CCXs),
+// all heaps affinitized to cores in one domain allocate into the same cache, so each heap
+// only gets its share of it. The gen0 budget is process wide, so we use the smallest share
+// of any heap. Returns 0 if the topology isn't available or heaps aren't affinitized.
+size_t gc_heap::get_gen0_min_size_from_cache_topology()
+{
+    if (!GCConfig::GetGCGen0CacheTopology() || gc_thread_no_affinitize_p)
+    {
+        return 0;
+    }
+
+    uint16_t domain_heap_count[MAX_SUPPORTED_CPUS];
+    size_t domain_cache_size[MAX_SUPPORTED_CPUS];
+    uint16_t heap_domain[MAX_SUPPORTED_CPUS];
+    memset (domain_heap_count, 0, sizeof (domain_heap_count));
+
+    for (int i = 0; i < n_heaps; i++)
+    {
+        uint16_t proc_no = heap_select::find_proc_no_from_heap_no (i);
+        size_t cache_size = 0;
+        uint16_t domain_id = 0;
+        if (!GCToOSInterface::GetLastLevelCacheForProcessor (proc_no, &cache_size, &domain_id))
+        {
+            dprintf (1, ("no cache topology for heap %d (proc %d)", i, proc_no));
+            return 0;
+        }
+
+        assert (domain_id < MAX_SUPPORTED_CPUS);
+        heap_domain[i] = domain_id;
+        domain_cache_size[domain_id] = cache_size;
+        domain_heap_count[domain_id]++;
+    }
+
+    size_t gen0size = SIZE_T_MAX;
+    for (int i = 0; i < n_heaps; i++)
+    {
+        uint16_t domain_id = heap_domain[i];
+        size_t heap_share = domain_cache_size[domain_id] / domain_heap_count[domain_id];
+        dprintf (1, ("heap %d: cache domain %d, %zd / %d heaps = %zd",
+            i, domain_id, domain_cache_size[domain_id], domain_heap_count[domain_id], heap_share));
+        gen0size = min (gen0size, heap_share);
+    }
+
+    gen0size = max (gen0size, (size_t)(256*1024));
+
+#ifdef FEATURE_EVENT_TRACE
+    gen0_min_budget_from_cache_topology = gen0size;
+#endif //FEATURE_EVENT_TRACE
+
+    return gen0size;
+}
+#endif //MULTIPLE_HEAPS
+
 size_t gc_heap::get_gen0_min_size()
 {
     size_t gen0size = static_cast<size_t>(GCConfig::GetGen0Size());
@@ -51551,6 +52823,15 @@ size_t gc_heap::get_gen0_min_size()
             GCToOSInterface::GetCacheSizePerLogicalCpu(FALSE),
             GCToOSInterface::GetCacheSizePerLogicalCpu(TRUE)));
 
+        // if we know which last level cache each heap's processor is attached to, make
+        // the heaps sharing a cache split it instead of each assuming it has it all.
+        size_t topology_gen0size = get_gen0_min_size_from_cache_topology();
+        if (topology_gen0size != 0)
+        {
+            gen0size = topology_gen0size;
+            trueSize = min (trueSize, topology_gen0size);
+        }
+
         int n_heaps = gc_heap::n_heaps;
 #else //SERVER_GC
         size_t trueSize = GCToOSInterface::GetCacheSizePerLogicalCpu(TRUE);
@@ -51666,6 +52947,41 @@ Object* GCHeap::GetNextFinalizableObject()
 
 }
 
+// Same as GetNextFinalizableObject, but starts at the queue of the given heap so concurrent
+// callers with different heap indices mostly take objects from (and the lock of) different queues.
+Object* GCHeap::GetNextFinalizableFromHeap(int heap_index, bool only_non_critical)
+{
+#ifdef MULTIPLE_HEAPS
+    int start = (heap_index >= 0) ? (heap_index % gc_heap::n_heaps) : 0;
+
+    //return the first non critical one, beginning with the queue of heap_index.
+    for (int i = 0; i < gc_heap::n_heaps; i++)
+    {
+        gc_heap* hp = gc_heap::g_heaps [(start + i) % gc_heap::n_heaps];
+        Object* O = hp->finalize_queue->GetNextFinalizableObject(TRUE);
+        if (O)
+            return O;
+    }
+
+    if (only_non_critical)
+        return 0;
+
+    //return the first non critical/critical one, beginning with the queue of heap_index.
+    for (int i = 0; i < gc_heap::n_heaps; i++)
+    {
+        gc_heap* hp = gc_heap::g_heaps [(start + i) % gc_heap::n_heaps];
+        Object* O = hp->finalize_queue->GetNextFinalizableObject(FALSE);
+        if (O)
+            return O;
+    }
+    return 0;
+
+#else //MULTIPLE_HEAPS
+    UNREFERENCED_PARAMETER(heap_index);
+    return pGenGCHeap->finalize_queue->GetNextFinalizableObject(only_non_critical ? TRUE : FALSE);
+#endif //MULTIPLE_HEAPS
+}
+
 size_t GCHeap::GetNumberFinalizableObjects()
 {
 #ifdef MULTIPLE_HEAPS
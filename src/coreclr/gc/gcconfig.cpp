@@ -79,6 +79,45 @@ void GCConfig::RefreshHeapHardLimitSettings()
     GCToEEInterface::GetIntConfigValue("GCHeapHardLimitPOHPercent", "System.GC.HeapHardLimitPOHPercent", &s_GCHeapHardLimitPOHPercent); s_UpdatedGCHeapHardLimitPOHPercent = s_GCHeapHardLimitPOHPercent;
 }
 
+GCConfig::GCProfileKind GCConfig::s_Profile = GCConfig::GC_PROFILE_NONE;
+
+GCConfig::GCProfileKind GCConfig::GetProfile()
+{
+    return s_Profile;
+}
+
+void GCConfig::ApplyProfile()
+{
+    GCConfigStringHolder profileName = GetGCProfile();
+    const char* name = profileName.Get();
+    if (name == nullptr)
+    {
+        return;
+    }
+
+#define GC_PROFILE(id, profile_name)          \
+    if (strcmp(name, profile_name) == 0)      \
+    {                                         \
+        s_Profile = id;                       \
+    }
+
+    GC_PROFILES
+
+#undef GC_PROFILE
+
+#define GC_PROFILE_SETTING(id, name, value)                 \
+    if ((s_Profile == id) && !s_##name##Provided)           \
+    {                                                       \
+        s_##name = value;                                   \
+        s_Updated##name = s_##name;                         \
+        s_##name##Provided = true;                          \
+    }
+
+    GC_PROFILE_SETTINGS
+
+#undef GC_PROFILE_SETTING
+}
+
 void GCConfig::Initialize()
 {
 #define BOOL_CONFIG(name, private_key, public_key, unused_default, unused_doc)                       \
@@ -96,6 +135,8 @@ GC_CONFIGURATION_KEYS
 #undef BOOL_CONFIG
 #undef INT_CONFIG
 #undef STRING_CONFIG
+
+    ApplyProfile();
 }
 
 // Parse an integer index or range of two indices separated by '-'.
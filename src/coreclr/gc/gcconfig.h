@@ -72,19 +72,24 @@ public:
                                                                                                                                           " (note that the same thing can be specified via API which is the supported way)")        \
     BOOL_CONFIG  (BreakOnOOM,                "GCBreakOnOOM",              NULL,                                false,              "Does a DebugBreak at the soonest time we detect an OOM")                                 \
     BOOL_CONFIG  (NoAffinitize,              "GCNoAffinitize",            "System.GC.NoAffinitize",            false,              "If set, do not affinitize server GC threads")                                             \
+    BOOL_CONFIG  (AffinitizeAllocatingThreads, "GCAffinitizeAllocatingThreads", "System.GC.AffinitizeAllocatingThreads", false, "If set with affinitized Server GC, pin each allocating thread to the processor of a heap, "    \
+                                                                                                                                          "picked round robin, so its allocations stay on that heap")                               \
     BOOL_CONFIG  (LogEnabled,                "GCLogEnabled",              NULL,                                false,              "Specifies if you want to turn on logging in GC")                                         \
     BOOL_CONFIG  (ConfigLogEnabled,          "GCConfigLogEnabled",        NULL,                                false,              "Specifies the name of the GC config log file")                                           \
     BOOL_CONFIG  (GCNumaAware,               "GCNumaAware",               NULL,                                true,               "Enables numa allocations in the GC")                                                     \
     BOOL_CONFIG  (GCCpuGroup,                "GCCpuGroup",                "System.GC.CpuGroup",                false,              "Enables CPU groups in the GC")                                                            \
     BOOL_CONFIG  (GCLargePages,              "GCLargePages",              "System.GC.LargePages",              false,              "Enables using Large Pages in the GC")                                                     \
+    BOOL_CONFIG  (GCMarkPrefetch,            "GCMarkPrefetch",            NULL,                                true,               "Specifies whether marking prefetches objects through a small queue before scanning them")                \
     INT_CONFIG   (HeapVerifyLevel,           "HeapVerify",                NULL,                                HEAPVERIFY_NONE,    "When set verifies the integrity of the managed heap on entry and exit of each GC")       \
     INT_CONFIG   (LOHCompactionMode,         "GCLOHCompact",              NULL,                                0,                  "Specifies the LOH compaction mode")                                                      \
     INT_CONFIG   (LOHThreshold,              "GCLOHThreshold",            "System.GC.LOHThreshold",            LARGE_OBJECT_SIZE,  "Specifies the size that will make objects go on LOH")                                    \
     INT_CONFIG   (BGCSpinCount,              "BGCSpinCount",              NULL,                                140,                "Specifies the bgc spin count")                                                           \
     INT_CONFIG   (BGCSpin,                   "BGCSpin",                   NULL,                                2,                  "Specifies the bgc spin time")                                                            \
+    INT_CONFIG   (BGCCpuShare,               "BGCCpuShare",               NULL,                                0,                  "Specifies the max percentage of CPU time a bgc thread uses while user threads are running - 0 means no limit")                                                            \
     INT_CONFIG   (HeapCount,                 "GCHeapCount",               "System.GC.HeapCount",               0,                  "Specifies the number of server GC heaps")                                                 \
     INT_CONFIG   (MaxHeapCount,              "GCMaxHeapCount",            "System.GC.MaxHeapCount",            0,                  "Specifies the max number of server GC heaps to adjust to")                                                 \
     INT_CONFIG   (Gen0Size,                  "GCgen0size",                NULL,                                0,                  "Specifies the smallest gen0 budget")                                                     \
+    BOOL_CONFIG  (GCGen0CacheTopology,       "GCGen0CacheTopology",       NULL,                                true,               "Specifies whether Server GC sizes gen0 from the last level cache shared by each heap's processors") \
     INT_CONFIG   (SegmentSize,               "GCSegmentSize",             NULL,                                0,                  "Specifies the managed heap segment size")                                                \
     INT_CONFIG   (LatencyMode,               "GCLatencyMode",             NULL,                                -1,                 "Specifies the GC latency mode - batch, interactive or low latency (note that the same "   \
                                                                                                                                            "thing can be specified via API which is the supported way")                             \
@@ -107,6 +112,8 @@ public:
     INT_CONFIG   (GCRegionRange,             "GCRegionRange",             NULL,                                0,                  "Specifies the range for the GC heap")                                                    \
     INT_CONFIG   (GCRegionSize,              "GCRegionSize",              NULL,                                0,                  "Specifies the size for a basic GC region")                                               \
     INT_CONFIG   (GCEnableSpecialRegions,    "GCEnableSpecialRegions",    NULL,                                0,                  "Specifies to enable special handling some regions like SIP")                             \
+    INT_CONFIG   (GCPhaseHistogramGCs,       "GCPhaseHistogramGCs",       NULL,                                100,                "Specifies how many GCs the per heap phase time histograms cover before they are fired and reset, 0 disables them")\
+    INT_CONFIG   (GCGen2EvacuationBudget,    "GCGen2EvacuationBudget",    NULL,                                0,                  "Specifies the max survived bytes per heap a full compacting GC evacuates from gen2 regions")\
     STRING_CONFIG(LogFile,                   "GCLogFile",                 NULL,                                                    "Specifies the name of the GC log file")                                                  \
     STRING_CONFIG(ConfigLogFile,             "GCConfigLogFile",           NULL,                                                    "Specifies the name of the GC config log file")                                           \
     INT_CONFIG   (BGCFLTuningEnabled,        "BGCFLTuningEnabled",        NULL,                                0,                  "Enables FL tuning")                                                                      \
@@ -134,14 +141,49 @@ public:
     INT_CONFIG   (GCHeapHardLimitSOHPercent, "GCHeapHardLimitSOHPercent", "System.GC.HeapHardLimitSOHPercent", 0,                  "Specifies the GC heap SOH usage as a percentage of the total memory")                    \
     INT_CONFIG   (GCHeapHardLimitLOHPercent, "GCHeapHardLimitLOHPercent", "System.GC.HeapHardLimitLOHPercent", 0,                  "Specifies the GC heap LOH usage as a percentage of the total memory")                    \
     INT_CONFIG   (GCHeapHardLimitPOHPercent, "GCHeapHardLimitPOHPercent", "System.GC.HeapHardLimitPOHPercent", 0,                  "Specifies the GC heap POH usage as a percentage of the total memory")                    \
-    INT_CONFIG   (GCEnabledInstructionSets,  "GCEnabledInstructionSets",  NULL,                                -1,                 "Specifies whether GC can use AVX2 or AVX512F - 0 for neither, 1 for AVX2, 3 for AVX512F")\
+    INT_CONFIG   (GCEnabledInstructionSets,  "GCEnabledInstructionSets",  NULL,                                -1,                 "Specifies whether GC can use AVX2 or AVX512F - 0 for neither, 1 for AVX2, 3 for AVX512F. On Arm64, 4 enables NEON")\
     INT_CONFIG   (GCConserveMem,             "GCConserveMemory",          "System.GC.ConserveMemory",          0,                  "Specifies how hard GC should try to conserve memory - values 0-9")                       \
     INT_CONFIG   (GCWriteBarrier,            "GCWriteBarrier",            NULL,                                0,                  "Specifies whether GC should use more precise but slower write barrier")                  \
+    INT_CONFIG   (GCTypeCensusSampleRate,    "GCTypeCensusSampleRate",    NULL,                                0,                  "Tally survivors per type in 1 out of N condemned regions during plan, 0 disables")       \
     STRING_CONFIG(GCName,                    "GCName",                    "System.GC.Name",                                        "Specifies the name of the standalone GC implementation.")                                \
     STRING_CONFIG(GCPath,                    "GCPath",                    "System.GC.Path",                                        "Specifies the path of the standalone GC implementation.")                                \
+    STRING_CONFIG(GCProfile,                 "GCProfile",                 "System.GC.Profile",                                     "Specifies a named set of GC settings to start with - latency, throughput or containerdense")   \
     INT_CONFIG   (GCSpinCountUnit,           "GCSpinCountUnit",           NULL,                                0,                  "Specifies the spin count unit used by the GC.")                                          \
     INT_CONFIG   (GCDynamicAdaptationMode,   "GCDynamicAdaptationMode",   "System.GC.DynamicAdaptationMode",   1,                  "Enable the GC to dynamically adapt to application sizes.")                               \
     INT_CONFIG   (GCDTargetTCP,              "GCDTargetTCP",              "System.GC.DTargetTCP",              0,                  "Specifies the target tcp for DATAS")
+// GC profiles are named presets of related configs, selected with GCProfile. A profile only
+// supplies values - a config that is specified on its own always wins over the profile.
+//
+// GC_PROFILE(id, name) declares a profile. GC_PROFILE_SETTING(id, config, value) gives the
+// value a profile uses for one of the configs above.
+//
+// latency        - keep pauses short: concurrent GC, and keep memory around instead of
+//                  decommitting and recommitting it.
+// throughput     - Server GC with all its heaps and no background GC.
+// containerdense - many processes sharing a machine: Server GC that adapts its heap count to
+//                  the application size, leans towards a smaller footprint and doesn't
+//                  hard affinitize its threads.
+#define GC_PROFILES                                          \
+    GC_PROFILE(GC_PROFILE_LATENCY,         "latency")        \
+    GC_PROFILE(GC_PROFILE_THROUGHPUT,      "throughput")     \
+    GC_PROFILE(GC_PROFILE_CONTAINER_DENSE, "containerdense")
+
+#define GC_PROFILE_SETTINGS                                                         \
+    GC_PROFILE_SETTING(GC_PROFILE_LATENCY,         ConcurrentGC,            true)   \
+    GC_PROFILE_SETTING(GC_PROFILE_LATENCY,         RetainVM,                true)   \
+    GC_PROFILE_SETTING(GC_PROFILE_LATENCY,         LatencyLevel,            1)      \
+    GC_PROFILE_SETTING(GC_PROFILE_LATENCY,         GCConserveMem,           0)      \
+    GC_PROFILE_SETTING(GC_PROFILE_THROUGHPUT,      ServerGC,                true)   \
+    GC_PROFILE_SETTING(GC_PROFILE_THROUGHPUT,      ConcurrentGC,            false)  \
+    GC_PROFILE_SETTING(GC_PROFILE_THROUGHPUT,      RetainVM,                true)   \
+    GC_PROFILE_SETTING(GC_PROFILE_THROUGHPUT,      GCDynamicAdaptationMode, 0)      \
+    GC_PROFILE_SETTING(GC_PROFILE_CONTAINER_DENSE, ServerGC,                true)   \
+    GC_PROFILE_SETTING(GC_PROFILE_CONTAINER_DENSE, ConcurrentGC,            true)   \
+    GC_PROFILE_SETTING(GC_PROFILE_CONTAINER_DENSE, GCDynamicAdaptationMode, 1)      \
+    GC_PROFILE_SETTING(GC_PROFILE_CONTAINER_DENSE, GCConserveMem,           5)      \
+    GC_PROFILE_SETTING(GC_PROFILE_CONTAINER_DENSE, LatencyLevel,            0)      \
+    GC_PROFILE_SETTING(GC_PROFILE_CONTAINER_DENSE, NoAffinitize,            true)
+
 // This class is responsible for retreiving configuration information
 // for how the GC should operate.
 class GCConfig
@@ -195,6 +237,24 @@ enum HeapVerifyFlags {
     HEAPVERIFY_DEEP_ON_COMPACT  = 0x80    // Performs deep object verfication only on compacting GCs.
 };
 
+enum GCProfileKind
+{
+    GC_PROFILE_NONE = 0,
+#define GC_PROFILE(id, unused_name) id,
+    GC_PROFILES
+#undef GC_PROFILE
+};
+
+// The profile GCProfile selected, GC_PROFILE_NONE if it wasn't specified or isn't a known name.
+static GCProfileKind GetProfile();
+
+private:
+  static GCProfileKind s_Profile;
+
+  static void ApplyProfile();
+
+public:
+
 enum WriteBarrierFlavor
 {
     WRITE_BARRIER_DEFAULT = 0,
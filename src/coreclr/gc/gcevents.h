@@ -52,6 +52,15 @@ DYNAMIC_EVENT(CommittedUsage, GCEventLevel_Information, GCEventKeyword_GC, 1)
 DYNAMIC_EVENT(SizeAdaptationTuning, GCEventLevel_Information, GCEventKeyword_GC, 1)
 DYNAMIC_EVENT(SizeAdaptationFullGCTuning, GCEventLevel_Information, GCEventKeyword_GC, 1)
 DYNAMIC_EVENT(SizeAdaptationSample, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(SizeAdaptationAllocRate, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(MarkSteal, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(RegionNumaLocality, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(DecommitStep, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(PausePhaseHistogram, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(GCProfileSettings, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(MarkListOverflow, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(TypeCensusSummary, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(TypeCensusEntry, GCEventLevel_Information, GCEventKeyword_GC, 1)
 
 #undef KNOWN_EVENT
 #undef DYNAMIC_EVENT
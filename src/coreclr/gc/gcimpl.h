@@ -318,6 +318,8 @@ protected:
     virtual unsigned int GetGenerationWithRange(Object* object, uint8_t** ppStart, uint8_t** ppAllocated, uint8_t** ppReserved);
 
     virtual void DiagWalkHeapWithACHandling(walk_fn fn, void* context, int gen_number, bool walk_large_object_heap_p);
+
+    virtual Object* GetNextFinalizableFromHeap(int heap_index, bool only_non_critical);
 public:
     Object * NextObj (Object * object);
 
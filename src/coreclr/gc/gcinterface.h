@@ -11,7 +11,7 @@
 // The minor version of the IGCHeap interface. Non-breaking changes are required
 // to bump the minor version number. GCs and EEs with minor version number
 // mismatches can still interoperate correctly, with some care.
-#define GC_INTERFACE_MINOR_VERSION 3
+#define GC_INTERFACE_MINOR_VERSION 4
 
 // The major version of the IGCToCLR interface. Breaking changes to this interface
 // require bumps in the major version number.
@@ -1030,6 +1030,11 @@ public:
 
     // Walk the heap object by object outside of a GC.
     virtual void DiagWalkHeapWithACHandling(walk_fn fn, void* context, int gen_number, bool walk_large_object_heap_p) PURE_VIRTUAL
+
+    // Gets the next finalizable object, searching the finalization queues starting with the queue of the
+    // given heap (modulo the number of heaps). If only_non_critical is true, critical finalizable objects
+    // are left in the queues. Available since GC_INTERFACE_MINOR_VERSION 4.
+    virtual Object* GetNextFinalizableFromHeap(int heap_index, bool only_non_critical) PURE_VIRTUAL
 };
 
 #ifdef WRITE_BARRIER_CHECK
@@ -1055,8 +1060,13 @@ enum GC_ALLOC_FLAGS
     GC_ALLOC_LARGE_OBJECT_HEAP  = 32,
     GC_ALLOC_PINNED_OBJECT_HEAP = 64,
     GC_ALLOC_USER_OLD_HEAP      = GC_ALLOC_LARGE_OBJECT_HEAP | GC_ALLOC_PINNED_OBJECT_HEAP,
+    GC_ALLOC_LARGE_QUANTUM      = 128, // Hint that the allocating thread allocates heavily and should be handed an
+                                       // allocation context of up to GC_LARGE_ALLOC_QUANTUM_SCALE times the
+                                       // regular quantum. GCs that predate this flag ignore it.
 };
 
+#define GC_LARGE_ALLOC_QUANTUM_SCALE 4
+
 inline GC_ALLOC_FLAGS operator|(GC_ALLOC_FLAGS a, GC_ALLOC_FLAGS b)
 {return (GC_ALLOC_FLAGS)((int)a | (int)b);}
 
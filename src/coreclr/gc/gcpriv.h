@@ -1329,6 +1329,133 @@ struct snoop_stats_data
 };
 #endif //SNOOP_STATS
 
+#ifdef MH_SC_MARK
+// Each heap has one of these during a full blocking mark. When other heaps have run
+// out of work the owner moves runs of marked objects (whose children still need to be
+// traced) off the top of its mark stack into chunks here. Any heap, including the owner,
+// can take a chunk from the top of the queue.
+//
+// Only the owner publishes (at bottom) and everyone takes from top with an interlocked
+// compare exchange. A taker copies the chunk out *before* it tries to claim it - if the
+// owner reused that slot in the meantime top has already moved past it and the claim fails.
+class mark_steal_queue
+{
+public:
+    static const int chunk_length = 64;
+    // Must be a power of 2.
+    static const int queue_length = 64;
+
+private:
+    struct mark_steal_chunk
+    {
+        size_t count;
+        uint8_t* objects[chunk_length];
+    };
+
+    uint32_t top;
+    uint8_t padding[HS_CACHE_LINE_SIZE - sizeof (uint32_t)];
+    uint32_t bottom;
+    mark_steal_chunk* chunks;
+
+public:
+    bool init()
+    {
+        top = 0;
+        bottom = 0;
+        chunks = new (nothrow) mark_steal_chunk[queue_length];
+        return (chunks != nullptr);
+    }
+
+    // Only called when no other heap can be looking at this queue.
+    void reset()
+    {
+        top = 0;
+        bottom = 0;
+    }
+
+    bool empty_p()
+    {
+        return (VolatileLoad (&top) == VolatileLoad (&bottom));
+    }
+
+    // Only called by the owning heap.
+    bool publish (SERVER_SC_MARK_VOLATILE(uint8_t*)* objects, size_t count)
+    {
+        assert ((count > 0) && (count <= (size_t)chunk_length));
+
+        uint32_t b = bottom;
+        if ((b - VolatileLoad (&top)) >= (uint32_t)queue_length)
+        {
+            return false;
+        }
+
+        mark_steal_chunk* chunk = &chunks[b & (queue_length - 1)];
+        for (size_t i = 0; i < count; i++)
+        {
+            chunk->objects[i] = objects[i];
+        }
+        chunk->count = count;
+
+        VolatileStore (&bottom, b + 1);
+        return true;
+    }
+
+    // Copies the oldest chunk into buffer (which must be able to hold chunk_length
+    // objects) and returns the number of objects in it, or 0 if there was nothing to
+    // take or another heap got it first.
+    size_t take (uint8_t** buffer)
+    {
+        uint32_t t = VolatileLoad (&top);
+        if ((int32_t)(VolatileLoad (&bottom) - t) <= 0)
+        {
+            return 0;
+        }
+
+        mark_steal_chunk* chunk = &chunks[t & (queue_length - 1)];
+        size_t count = min (VolatileLoad (&chunk->count), (size_t)chunk_length);
+        for (size_t i = 0; i < count; i++)
+        {
+            buffer[i] = VolatileLoad (&chunk->objects[i]);
+        }
+
+        if (Interlocked::CompareExchange (&top, (t + 1), t) != t)
+        {
+            return 0;
+        }
+
+        return count;
+    }
+};
+
+struct mark_steal_stats_data
+{
+    // number of chunks this heap made available to other heaps.
+    size_t chunks_published;
+    // number of its own chunks this heap took back.
+    size_t chunks_reclaimed;
+    // number of chunks this heap took from other heaps.
+    size_t chunks_stolen;
+    // number of objects in chunks this heap took from other heaps.
+    size_t objects_stolen;
+    // number of times this heap found no work anywhere in mark_steal.
+    size_t idle_count;
+    // time spent in mark_steal, and the part of that spent
+    // tracing objects stolen from other heaps, in us.
+    uint64_t steal_time;
+    uint64_t stolen_work_time;
+};
+#endif //MH_SC_MARK
+
+#ifdef FEATURE_EVENT_TRACE
+// Survivors of one type seen by the sampled type census in plan.
+struct type_census_entry
+{
+    MethodTable* mt;
+    size_t count;
+    size_t size;
+};
+#endif //FEATURE_EVENT_TRACE
+
 struct no_gc_region_info
 {
     size_t soh_allocation_size;
@@ -1457,6 +1584,40 @@ public:
     void verify_empty();
 };
 
+#ifdef BACKGROUND_GC
+// The background flavor of mark_queue_t. Objects parked here have already been
+// marked in the mark array - what gets deferred is reading their method table to
+// count their size and decide whether they need to go on the mark stack. The slots
+// are scanned by scan_background_roots like the background mark stack is.
+class background_mark_queue_t
+{
+#ifdef MARK_PHASE_PREFETCH
+public:
+    static const size_t slot_count = 16;
+
+private:
+    uint8_t* slot_table[slot_count];
+    size_t curr_slot_index;
+#endif //MARK_PHASE_PREFETCH
+
+public:
+    background_mark_queue_t();
+
+    uint8_t* queue_marked (uint8_t* o);
+
+    uint8_t* get_next_queued();
+
+#ifdef MARK_PHASE_PREFETCH
+    uint8_t** get_slot (size_t slot_index)
+    {
+        return &slot_table[slot_index];
+    }
+#endif //MARK_PHASE_PREFETCH
+
+    void verify_empty();
+};
+#endif //BACKGROUND_GC
+
 float median_of_3 (float a, float b, float c);
 
 //class definition of the internal class
@@ -1490,6 +1651,9 @@ class gc_heap
     friend void PopulateDacVars(GcDacVars *gcDacVars);
 
     friend class mark_queue_t;
+#ifdef BACKGROUND_GC
+    friend class background_mark_queue_t;
+#endif //BACKGROUND_GC
 
 #ifdef MULTIPLE_HEAPS
     typedef void (gc_heap::* card_fn) (uint8_t**, int);
@@ -1592,6 +1756,15 @@ private:
 
     PER_HEAP_ISOLATED_METHOD void fire_committed_usage_event();
 
+    PER_HEAP_ISOLATED_METHOD void fire_gc_profile_event();
+
+#ifdef FEATURE_EVENT_TRACE
+    // Returns the current time so the next phase can start from it, or 0 if we are not recording phases.
+    PER_HEAP_METHOD uint64_t record_phase_time (int phase, uint64_t start_us, uint64_t excluded_us=0);
+    PER_HEAP_ISOLATED_METHOD void record_suspension_time();
+    PER_HEAP_ISOLATED_METHOD void fire_phase_histogram_events();
+#endif //FEATURE_EVENT_TRACE
+
 #ifdef FEATURE_BASICFREEZE
     PER_HEAP_ISOLATED_METHOD void walk_read_only_segment(heap_segment *seg, void *pvContext, object_callback_func pfnMethodTable, object_callback_func pfnObjRef);
 #endif
@@ -1666,6 +1839,7 @@ private:
                                     heap_segment* prev_region,
                                     heap_segment* next_region);
     PER_HEAP_METHOD bool should_sweep_in_plan (heap_segment* region);
+    PER_HEAP_METHOD void decide_gen2_evac_surv_ratio_th();
 
     PER_HEAP_METHOD void sweep_region_in_plan (heap_segment* region,
                                BOOL use_mark_list,
@@ -1686,6 +1860,9 @@ private:
     PER_HEAP_ISOLATED_METHOD void compute_gc_and_ephemeral_range (int condemned_gen_number, bool end_of_gc_p);
 
     PER_HEAP_ISOLATED_METHOD void distribute_free_regions();
+#ifdef MULTIPLE_HEAPS
+    PER_HEAP_ISOLATED_METHOD void fire_region_numa_locality_events();
+#endif //MULTIPLE_HEAPS
 
     PER_HEAP_ISOLATED_METHOD void age_free_regions (const char* msg);
 
@@ -1740,6 +1917,7 @@ private:
 
     PER_HEAP_ISOLATED_METHOD void balance_heaps (alloc_context* acontext);
     PER_HEAP_METHOD ptrdiff_t get_balance_heaps_uoh_effective_budget (int generation_num);
+    PER_HEAP_METHOD bool uoh_msl_busy_p();
     PER_HEAP_ISOLATED_METHOD gc_heap* balance_heaps_uoh (alloc_context* acontext, size_t size, int generation_num);
     // Unlike balance_heaps_uoh, this may return nullptr if we failed to change heaps.
     PER_HEAP_ISOLATED_METHOD gc_heap* balance_heaps_uoh_hard_limit_retry (alloc_context* acontext, size_t size, int generation_num);
@@ -2408,6 +2586,10 @@ private:
     PER_HEAP_ISOLATED_METHOD bool decommit_step (uint64_t step_milliseconds);
 #endif //MULTIPLE_HEAPS || USE_REGIONS
 
+#ifdef USE_REGIONS
+    PER_HEAP_ISOLATED_METHOD size_t get_decommit_step_budget (uint64_t step_milliseconds, uint32_t* stall_percent, uint64_t* bytes_below_soft_limit);
+#endif //USE_REGIONS
+
 #ifdef USE_REGIONS
     PER_HEAP_ISOLATED_METHOD size_t decommit_region (heap_segment* region, int bucket, int h_number);
 #endif //USE_REGIONS
@@ -2674,6 +2856,10 @@ private:
 
 #ifdef MH_SC_MARK
     PER_HEAP_METHOD void mark_steal ();
+    PER_HEAP_METHOD SERVER_SC_MARK_VOLATILE(uint8_t*)* publish_mark_steal_chunk (SERVER_SC_MARK_VOLATILE(uint8_t*)* tos,
+                                                                                 SERVER_SC_MARK_VOLATILE(uint8_t*)* base);
+    PER_HEAP_METHOD bool mark_stolen_chunk (int start_heap_number);
+    PER_HEAP_METHOD void fire_mark_steal_event();
 #endif //MH_SC_MARK
 
 #ifdef BACKGROUND_GC
@@ -3081,6 +3267,10 @@ private:
 
     PER_HEAP_ISOLATED_METHOD size_t get_gen0_min_size();
 
+#ifdef MULTIPLE_HEAPS
+    PER_HEAP_ISOLATED_METHOD size_t get_gen0_min_size_from_cache_topology();
+#endif //MULTIPLE_HEAPS
+
     PER_HEAP_METHOD void set_static_data();
 
     PER_HEAP_ISOLATED_METHOD void init_static_data();
@@ -3182,6 +3372,7 @@ private:
 #endif //MULTIPLE_HEAPS
 
     PER_HEAP_ISOLATED_METHOD void grow_mark_list();
+    PER_HEAP_ISOLATED_METHOD size_t get_max_mark_list_size();
 
 #ifdef USE_REGIONS
     PER_HEAP_METHOD uint8_t** get_region_mark_list (BOOL& use_mark_list, uint8_t* start, uint8_t* end, uint8_t*** mark_list_end);
@@ -3203,6 +3394,8 @@ private:
 
     PER_HEAP_METHOD void allow_fgc();
 
+    PER_HEAP_METHOD void throttle_bgc_cpu();
+
     // Restores BGC settings if necessary.
     PER_HEAP_ISOLATED_METHOD void recover_bgc_settings();
 
@@ -3345,6 +3538,13 @@ private:
 
     PER_HEAP_METHOD void fire_etw_pin_object_event (uint8_t* object, uint8_t** ppObject);
 
+    PER_HEAP_METHOD void sample_type_census (int condemned_gen_number);
+
+    PER_HEAP_METHOD void fire_type_census_events (int condemned_gen_number,
+                                  size_t regions_total,
+                                  size_t regions_sampled,
+                                  size_t objects_dropped);
+
 #ifdef FEATURE_LOH_COMPACTION
     PER_HEAP_METHOD void loh_reloc_survivor_helper (uint8_t** pval,
                                     size_t& total_refs,
@@ -3514,6 +3714,14 @@ private:
 #endif //BGC_SERVO_TUNING
 #endif //BACKGROUND_GC
 
+#ifdef MH_SC_MARK
+    // Chunks of marked objects other heaps can take from us and the
+    // buffer we copy a chunk into when we take one.
+    PER_HEAP_FIELD_SINGLE_GC mark_steal_queue mark_steal_chunks;
+    PER_HEAP_FIELD_SINGLE_GC uint8_t* mark_steal_buffer[mark_steal_queue::chunk_length];
+    PER_HEAP_FIELD_SINGLE_GC mark_steal_stats_data mark_steal_stats;
+#endif //MH_SC_MARK
+
 #ifdef USE_REGIONS
     // This is the number of regions we would free up if we sweep.
     // It's used in the decision for compaction so we calculate it in plan.
@@ -3573,6 +3781,10 @@ private:
 
     PER_HEAP_FIELD_SINGLE_GC bool special_sweep_p;
 
+    // gen2 regions with a survival ratio at or above this are swept in plan instead of compacted.
+    // This is lowered from sip_surv_ratio_th in full GCs when GCGen2EvacuationBudget is set.
+    PER_HEAP_FIELD_SINGLE_GC int gen2_evac_surv_ratio_th;
+
 #else //USE_REGIONS
     PER_HEAP_FIELD_SINGLE_GC BOOL ro_segments_in_range;
 
@@ -3658,6 +3870,12 @@ private:
     PER_HEAP_FIELD_SINGLE_GC BOOL loh_compacted_p;
 #endif //FEATURE_LOH_COMPACTION
 
+#ifdef DYNAMIC_HEAP_COUNT
+    // How much was allocated on this heap (SOH and UOH) between the last GC and this one, recorded
+    // when this GC starts so DATAS can tell how the allocation rate is changing.
+    PER_HEAP_FIELD_SINGLE_GC size_t datas_allocated_since_last_gc;
+#endif //DYNAMIC_HEAP_COUNT
+
     /*****************************************/
     // PER_HEAP_FIELD_SINGLE_GC_ALLOC fields //
     /*****************************************/
@@ -3760,6 +3978,13 @@ private:
     PER_HEAP_FIELD_MAINTAINED uint8_t** background_mark_stack_array;
     PER_HEAP_FIELD_MAINTAINED size_t    background_mark_stack_array_length;
 
+    // Only ever non empty while background_mark_simple1 is running.
+    PER_HEAP_FIELD_MAINTAINED background_mark_queue_t background_mark_queue;
+
+    // Used by throttle_bgc_cpu to keep this heap's BGC thread within BGCCpuShare.
+    PER_HEAP_FIELD_MAINTAINED uint32_t bgc_throttle_check_count;
+    PER_HEAP_FIELD_MAINTAINED uint64_t bgc_throttle_quantum_start_us;
+
     // Loosedly maintained, can be reinit-ed in background_grow_c_mark_list.
     // The content of c_mark_list is only maintained during a single BGC, c_mark_list_index is init-ed to 0
     // at the beginning of a BGC.
@@ -3909,6 +4134,44 @@ private:
 
     PER_HEAP_FIELD_DIAG_ONLY fgm_history fgm_result;
 
+#ifdef FEATURE_EVENT_TRACE
+    enum pause_phase
+    {
+        // Suspension is for the whole process so it's only recorded on heap 0.
+        pause_phase_suspension = 0,
+        // Plan does not include the relocate, compact and sweep time.
+        pause_phase_mark = 1,
+        pause_phase_plan = 2,
+        pause_phase_relocate = 3,
+        pause_phase_compact = 4,
+        pause_phase_sweep = 5,
+        // This includes the concurrent part of BGC marking.
+        pause_phase_bgc_mark = 6,
+        max_pause_phase_count = 7
+    };
+
+    // A log-linear histogram of how long each phase took, in us. Each power of 2 is split into 4 buckets so
+    // the percentiles we report are within 12.5% of the actual values. From 2^31us (~36 mins) everything
+    // goes into the last bucket.
+    struct phase_histogram
+    {
+        static const int sub_bucket_bits = 2;
+        static const int bucket_count = (32 - sub_bucket_bits + 1) << sub_bucket_bits;
+
+        uint32_t count;
+        uint32_t max_us;
+        uint32_t buckets[bucket_count];
+
+        void add (uint64_t elapsed_us);
+        uint32_t get_percentile (int percent);
+    };
+
+    PER_HEAP_FIELD_DIAG_ONLY phase_histogram phase_histograms[max_pause_phase_count];
+
+    // What the relocate, compact and sweep phases took in this GC so we can take it out of the plan time.
+    PER_HEAP_FIELD_DIAG_ONLY uint64_t plan_sub_phases_us;
+#endif //FEATURE_EVENT_TRACE
+
     struct gc_history
     {
         size_t gc_index;
@@ -3986,6 +4249,13 @@ private:
     // items or plugs that we had to allocate in condemned. We only fire
     // these events on verbose level and stop at max_etw_item_count items.
     PER_HEAP_FIELD_DIAG_ONLY etw_bucket_info bucket_info[NUM_GEN2_ALIST];
+
+#define type_census_table_length 1024
+#define type_census_top_count 16
+
+    // Open addressed table of the types the sampled census saw during this GC's plan,
+    // only allocated when GCTypeCensusSampleRate is set.
+    PER_HEAP_FIELD_DIAG_ONLY type_census_entry* type_census_table;
 #endif //FEATURE_EVENT_TRACE
 
 #ifdef SPINLOCK_HISTORY
@@ -4077,6 +4347,10 @@ private:
 
     PER_HEAP_ISOLATED_FIELD_SINGLE_GC bool mark_list_overflow;
 
+    // Number of heaps whose mark list overflowed during this GC, reported with
+    // the MarkListOverflow event and reset in do_post_gc.
+    PER_HEAP_ISOLATED_FIELD_SINGLE_GC int32_t mark_list_overflow_heaps;
+
     PER_HEAP_ISOLATED_FIELD_SINGLE_GC BOOL proceed_with_gc_p;
 
     PER_HEAP_ISOLATED_FIELD_SINGLE_GC bool maxgen_size_inc_p;
@@ -4096,6 +4370,9 @@ private:
     PER_HEAP_ISOLATED_FIELD_SINGLE_GC BOOL gradual_decommit_in_progress_p;
 #ifdef MH_SC_MARK
     PER_HEAP_ISOLATED_FIELD_SINGLE_GC int* g_mark_stack_busy;
+    // Number of heaps that are done with their own roots and are in mark_steal. Heaps only
+    // publish chunks to their mark_steal_chunks when this is non zero.
+    PER_HEAP_ISOLATED_FIELD_SINGLE_GC VOLATILE(int32_t) mark_steal_waiting_heaps;
 #endif //MH_SC_MARK
 
 #if !defined(USE_REGIONS) || defined(_DEBUG)
@@ -4203,6 +4480,10 @@ private:
     // Loosely maintained,can be reinit-ed in grow_mark_list.
     PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t mark_list_size;
     PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t g_mark_list_total_size;
+    // Both mark lists are reserved for g_mark_list_reserved_size entries up front;
+    // grow_mark_list commits more of that range (up to g_mark_list_committed_size).
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t g_mark_list_committed_size;
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t g_mark_list_reserved_size;
 
     // Loosely maintained,can be reinit-ed in grow_mark_list.
     PER_HEAP_ISOLATED_FIELD_MAINTAINED uint8_t** g_mark_list;
@@ -4297,6 +4578,8 @@ private:
             uint64_t    msl_wait_time;
             size_t      gc_index;
             size_t      gc_survived_size;
+            size_t      gc_allocated_size;      // allocated on all heaps since the last GC
+            size_t      max_heap_allocated_size;
             int         gen0_budget_per_heap;
         };
 
@@ -4542,6 +4825,94 @@ private:
 
         int get_recorded_tcp_count () { return total_recorded_tcp; }
 
+        //
+        // tcp only goes up after the GCs caused by a burst of allocations have already happened. So we also
+        // keep a window of allocation rates (bytes/us) and extrapolate it to see if we are about to get a burst.
+        //
+        static const int recorded_alloc_rate_size = 8;
+        float           recorded_alloc_rates[recorded_alloc_rate_size];
+        int             recorded_alloc_rate_index;
+        int             total_recorded_alloc_rates;
+        // How much higher than the current rate the predicted rate needs to be before we act on it.
+        float           alloc_rate_ramp_factor = 1.5;
+
+        void add_to_recorded_alloc_rate (float alloc_rate)
+        {
+            total_recorded_alloc_rates++;
+            recorded_alloc_rates[recorded_alloc_rate_index] = alloc_rate;
+            recorded_alloc_rate_index = (recorded_alloc_rate_index + 1) % recorded_alloc_rate_size;
+        }
+
+        // Fits a line through the window and returns its value one sample past the last entry, or 0 if the
+        // window isn't full yet.
+        float predict_alloc_rate (float* avg_alloc_rate)
+        {
+            *avg_alloc_rate = 0.0f;
+            if (total_recorded_alloc_rates < recorded_alloc_rate_size)
+            {
+                dprintf (6666, ("only %d alloc rates recorded, not predicting", total_recorded_alloc_rates));
+                return 0.0f;
+            }
+
+            float alloc_rates[recorded_alloc_rate_size];
+            for (int i = 0; i < recorded_alloc_rate_size; i++)
+            {
+                alloc_rates[i] = recorded_alloc_rates[(recorded_alloc_rate_index + i) % recorded_alloc_rate_size];
+            }
+
+            float alloc_rate_slope = slope (alloc_rates, recorded_alloc_rate_size, avg_alloc_rate);
+            // The avg is at the middle of the window.
+            float distance_to_next = (float)recorded_alloc_rate_size - (float)(recorded_alloc_rate_size - 1) / 2.0f;
+            float predicted_alloc_rate = *avg_alloc_rate + alloc_rate_slope * distance_to_next;
+
+            dprintf (6666, ("alloc rate avg %.3f, slope %.3f -> predicted %.3f", *avg_alloc_rate, alloc_rate_slope, predicted_alloc_rate));
+            return max (predicted_alloc_rate, 0.0f);
+        }
+
+        void init_recorded_alloc_rate ()
+        {
+            total_recorded_alloc_rates = 0;
+            recorded_alloc_rate_index = 0;
+        }
+
+        enum alloc_rate_prediction_reason
+        {
+            not_enough_alloc_rates = 0,
+            alloc_rate_not_ramping = 1,
+            predicted_tcp_below_target = 2,
+            use_predicted_tcp = 3
+        };
+
+        // We only let the prediction make us grow sooner and only when the rate is going up by a lot. With the
+        // same HC and budget, GCs happen proportionally more often when the allocation rate goes up while each
+        // GC's pause stays about the same, so tcp scales the same way.
+        float get_predicted_tcp (float tcp, float alloc_rate, float predicted_alloc_rate, alloc_rate_prediction_reason* reason)
+        {
+            if (predicted_alloc_rate == 0.0f)
+            {
+                *reason = not_enough_alloc_rates;
+                return tcp;
+            }
+
+            if ((alloc_rate == 0.0f) || (predicted_alloc_rate < (alloc_rate * alloc_rate_ramp_factor)))
+            {
+                *reason = alloc_rate_not_ramping;
+                return tcp;
+            }
+
+            float predicted_tcp = min ((tcp * predicted_alloc_rate / alloc_rate), 100.0f);
+            if (predicted_tcp <= target_tcp)
+            {
+                *reason = predicted_tcp_below_target;
+                return tcp;
+            }
+
+            *reason = use_predicted_tcp;
+            dprintf (6666, ("alloc rate %.3f -> predicted %.3f, tcp %.3f -> predicted %.3f",
+                alloc_rate, predicted_alloc_rate, tcp, predicted_tcp));
+            return predicted_tcp;
+        }
+
         float           around_target_accumulation;
         float           around_target_threshold;
 
@@ -5239,6 +5610,10 @@ private:
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY gc_heap** g_heaps;
 
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool gc_thread_no_affinitize_p;
+    // Set by GCAffinitizeAllocatingThreads; only honored when the server GC threads are affinitized.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool affinitize_allocating_threads_p;
+    // Round robin cursor used to pick the heap an allocating thread gets pinned to.
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED_ALLOC VOLATILE(int32_t) next_affinitized_heap;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t min_gen0_balance_delta;
 
 #define alloc_quantum_balance_units (16)
@@ -5261,6 +5636,12 @@ private:
 #ifdef USE_REGIONS
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t regions_range;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool enable_special_regions_p;
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t gen2_evac_budget;
+#ifdef MARK_PHASE_PREFETCH
+    // Set from GCMarkPrefetch - when false the mark queues mark objects right away
+    // instead of parking them while their prefetch is in flight.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool mark_prefetch_p;
+#endif //MARK_PHASE_PREFETCH
 #else //USE_REGIONS
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t eph_gen_starts_size;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t min_segment_size;
@@ -5391,6 +5772,9 @@ private:
 
     PER_HEAP_ISOLATED_FIELD_DIAG_ONLY uint64_t* gc_time_info;
 
+    // We fire the phase histograms and start new ones every this many GCs, 0 means we don't record them.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t phase_histogram_gc_count;
+
 #ifdef BACKGROUND_GC
     PER_HEAP_ISOLATED_FIELD_DIAG_ONLY uint64_t* bgc_time_info;
 #endif //BACKGROUND_GC
@@ -5420,6 +5804,8 @@ private:
     PER_HEAP_ISOLATED_FIELD_DIAG_ONLY size_t physical_memory_from_config;
     PER_HEAP_ISOLATED_FIELD_DIAG_ONLY size_t gen0_min_budget_from_config;
     PER_HEAP_ISOLATED_FIELD_DIAG_ONLY size_t gen0_max_budget_from_config;
+    PER_HEAP_ISOLATED_FIELD_DIAG_ONLY size_t gen0_min_budget_from_cache_topology;
+    PER_HEAP_ISOLATED_FIELD_DIAG_ONLY int type_census_sample_rate;
     PER_HEAP_ISOLATED_FIELD_DIAG_ONLY int high_mem_percent_from_config;
     PER_HEAP_ISOLATED_FIELD_DIAG_ONLY bool use_frozen_segments_p;
 #endif //FEATURE_EVENT_TRACE
@@ -6081,6 +6467,11 @@ public:
     #define AGE_IN_FREE_TO_DECOMMIT 20
     #define MIN_AGE_TO_DECOMMIT_HUGE 2
     int             age_in_free;
+#ifdef MULTIPLE_HEAPS
+    // The NUMA node of the heap this region was handed out to by the region allocator. We commit
+    // on the committing heap's node so this is where the region's memory lives.
+    uint16_t        numa_node;
+#endif //MULTIPLE_HEAPS
     // This is currently only used by regions that are swept in plan -
     // we then thread this list onto the generation's free list.
     // We may keep per region free list later which requires more work.
@@ -6513,6 +6904,13 @@ int& heap_segment_age_in_free (heap_segment* inst)
 {
     return inst->age_in_free;
 }
+#ifdef MULTIPLE_HEAPS
+inline
+uint16_t& heap_segment_numa_node (heap_segment* inst)
+{
+    return inst->numa_node;
+}
+#endif //MULTIPLE_HEAPS
 inline
 size_t& heap_segment_survived (heap_segment* inst)
 {
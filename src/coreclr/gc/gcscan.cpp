@@ -90,6 +90,14 @@ bool GCScan::GcDhReScan(ScanContext* sc)
     // Locate our dependent handle context based on the GC context.
     DhContext *pDhContext = Ref_GetDependentHandleContext(sc);
 
+    // When the GC threads share the rescan every one of them has to take part. Otherwise the thread only
+    // scans its own tables and there's nothing to promote in them if it didn't see any unpromoted primaries.
+    if (Ref_ScanHandlesInParallel(sc))
+        return Ref_ScanDependentHandlesForPromotionInParallel(pDhContext);
+
+    if (!pDhContext->m_fUnpromotedPrimaries)
+        return false;
+
     return Ref_ScanDependentHandlesForPromotion(pDhContext);
 }
 
@@ -28,6 +28,8 @@ struct DhContext
     int             m_iCondemned;               // The condemned generation
     int             m_iMaxGen;                  // The maximum generation
     ScanContext    *m_pScanContext;             // The GC's scan context for this phase
+    bool            m_fAnyUnpromotedPrimaries;  // Parallel scans: did the last scan of any chunk we scanned find one?
+    bool            m_fAnyPromoted;             // Parallel scans: did we promote at least one secondary in any chunk?
 };
 
 class GCScan
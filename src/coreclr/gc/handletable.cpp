@@ -195,6 +195,10 @@ void HndDestroyHandleTable(HHANDLETABLE hTable)
     GetPerfCounters().m_GC.cHandles -= HndCountHandles(hTable);
 #endif
 
+    // threads must not return their cached handles to a table that is gone
+    if (pTable->fThreadCached)
+        TableInvalidateThreadCaches();
+
     // We are going to free the memory for this HandleTable.
     // Let us reset the copy in g_pHandleTableArray to NULL.
     // Otherwise, GC will think this HandleTable is still available.
@@ -234,6 +238,21 @@ void HndSetHandleTableIndex(HHANDLETABLE hTable, uint32_t uTableIndex)
 
     pTable->uTableIndex = uTableIndex;
 }
+
+/*
+ * HndEnableThreadCache
+ *
+ * Lets threads keep freed handles of this table for their next allocations.
+ */
+void HndEnableThreadCache(HHANDLETABLE hTable)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // fetch the handle table pointer
+    HandleTable *pTable = Table(hTable);
+
+    pTable->fThreadCached = true;
+}
 #endif // !DACCESS_COMPILE
 
 /*
@@ -803,6 +822,66 @@ void HndScanHandlesForGC(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t
 #ifndef DACCESS_COMPILE
 
 
+/*
+ * HndScanHandlesForGCInParallel
+ *
+ * Multiple type scanning entrypoint for GC threads that scan the same tables at once.
+ *
+ * This is the same as HndScanHandlesForGC except the blocks of the table are split
+ * between all the threads that make the call with the same scan epoch. It doesn't
+ * support async scans or aging only scans and does no maintenance on the segments.
+ *
+ */
+void HndScanHandlesForGCInParallel(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t param1, uintptr_t param2,
+                                   const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags,
+                                   uint32_t scanEpoch, HANDLECHUNKSCANNEDPROC pfnChunkScanned, uintptr_t lChunkParam)
+{
+    WRAPPER_NO_CONTRACT;
+
+    _ASSERTE(scanProc);
+    _ASSERTE((flags & HNDGCF_ASYNC) == 0);
+
+    // fetch the table pointer
+    PTR_HandleTable pTable = Table(hTable);
+
+    // do we need to support user data?
+    BOOL enumUserData =
+        ((flags & HNDGCF_EXTRAINFO) &&
+        TypesRequireUserDataScanning(pTable, types, typeCount));
+
+    // pick the per-block callback the same way HndScanHandlesForGC does
+    BLOCKSCANPROC pfnBlock;
+    if (condemned >= maxgen)
+    {
+        pfnBlock = enumUserData ? BlockScanBlocksWithUserData : BlockScanBlocksWithoutUserData;
+    }
+    else
+    {
+        pfnBlock = BlockScanBlocksEphemeral;
+    }
+
+    // set up parameters for scan callbacks
+    ScanCallbackInfo info;
+
+    info.uFlags          = flags;
+    info.fEnumUserData   = enumUserData;
+    info.dwAgeMask       = BuildAgeMask(condemned, maxgen);
+    info.pCurrentSegment = NULL;
+    info.pfnScan         = scanProc;
+    info.param1          = param1;
+    info.param2          = param2;
+
+#ifdef _DEBUG
+    info.DEBUG_BlocksScanned                = 0;
+    info.DEBUG_BlocksScannedNonTrivially    = 0;
+    info.DEBUG_HandleSlotsScanned           = 0;
+    info.DEBUG_HandlesActuallyScanned       = 0;
+#endif
+
+    TableScanHandlesInParallel(pTable, types, typeCount, scanEpoch, pfnBlock, &info, pfnChunkScanned, lChunkParam);
+}
+
+
 /*
  * HndResetAgeMap
  *
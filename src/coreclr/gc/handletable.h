@@ -62,6 +62,13 @@ void            HndDestroyHandleTable(HHANDLETABLE hTable);
 void            HndSetHandleTableIndex(HHANDLETABLE hTable, uint32_t uTableIndex);
 uint32_t        HndGetHandleTableIndex(HHANDLETABLE hTable);
 
+#ifndef DACCESS_COMPILE
+/*
+ * lets threads cache handles of a table that is only destroyed at shutdown
+ */
+void            HndEnableThreadCache(HHANDLETABLE hTable);
+#endif // !DACCESS_COMPILE
+
 #ifndef DACCESS_COMPILE
 /*
  * individual handle allocation and deallocation
@@ -123,6 +130,31 @@ void            HndScanHandlesForGC(HHANDLETABLE hTable,
                                     uint32_t maxgen,
                                     uint32_t flags);
 
+/*
+ * Parallel GC-time handle scanning
+ *
+ * All GC threads call this for every table with the same scan epoch and the blocks of each
+ * table are handed out in chunks to whichever thread gets to them first. The scan must not
+ * be async and the epoch must be different from the previous parallel scan's.
+ *
+ * If a chunk scanned callback is passed it's called after each chunk is scanned and the
+ * chunk is scanned again for as long as it returns true.
+ */
+typedef bool (CALLBACK *HANDLECHUNKSCANNEDPROC)(uintptr_t lParam);
+
+void            HndScanHandlesForGCInParallel(HHANDLETABLE hTable,
+                                              HANDLESCANPROC scanProc,
+                                              uintptr_t param1,
+                                              uintptr_t param2,
+                                              const uint32_t *types,
+                                              uint32_t typeCount,
+                                              uint32_t condemned,
+                                              uint32_t maxgen,
+                                              uint32_t flags,
+                                              uint32_t scanEpoch,
+                                              HANDLECHUNKSCANNEDPROC pfnChunkScanned,
+                                              uintptr_t lChunkParam);
+
 void            HndResetAgeMap(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags);
 void            HndVerifyTable(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags);
 
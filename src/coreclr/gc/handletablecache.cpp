@@ -703,6 +703,188 @@ void TableCacheMissOnFree(HandleTable *pTable, HandleTypeCache *pCache, uint32_t
 }
 
 
+/****************************************************************************
+ *
+ * THREAD CACHE
+ *
+ ****************************************************************************/
+
+/*
+ * Per-Thread Handle Cache
+ *
+ * Keeps a few handles of the most common types for the current thread, all from
+ * a single table, so that a thread that creates and frees handles at a high rate
+ * does not use interlocked operations in the steady state.  The cache is refilled
+ * and drained half a cache at a time, directly from and to the table's segments
+ * under the table lock, and is drained to its table when the thread exits.
+ *
+ * Only tables that live until shutdown use the thread cache.  Destroying one
+ * advances the epoch, which makes the threads drop their cached handles the next
+ * time they use the cache instead of returning them to a table that is gone.
+ *
+ */
+static VOLATILE(uint32_t) g_uThreadCacheEpoch = 0;
+
+struct HandleThreadCache
+{
+    HandleTable *pTable;
+    uint32_t     uEpoch;
+    uint32_t     rgCount[HANDLE_THREAD_CACHE_TYPES];
+    OBJECTHANDLE rgHandles[HANDLE_THREAD_CACHE_TYPES][HANDLES_PER_THREAD_CACHE];
+
+    ~HandleThreadCache()
+    {
+        WRAPPER_NO_CONTRACT;
+
+        Flush();
+    }
+
+    /*
+     * returns all the cached handles to their table
+     */
+    void Flush()
+    {
+        WRAPPER_NO_CONTRACT;
+
+        if (pTable && (uEpoch == g_uThreadCacheEpoch))
+        {
+            CrstHolder ch(&pTable->Lock);
+
+            for (uint32_t uType = 0; uType < HANDLE_THREAD_CACHE_TYPES; uType++)
+            {
+                if (rgCount[uType])
+                    TableFreeBulkUnpreparedHandles(pTable, uType, rgHandles[uType], rgCount[uType]);
+            }
+        }
+
+        memset(rgCount, 0, sizeof(rgCount));
+        pTable = NULL;
+    }
+};
+
+static thread_local HandleThreadCache t_HandleThreadCache;
+
+
+/*
+ * ThreadCacheUsable
+ *
+ * Returns whether handles of the specified table and type can go through the
+ * current thread's cache.  Allocations retarget the cache to the table they
+ * come from, frees only use it if it already holds handles of that table.
+ *
+ */
+static bool ThreadCacheUsable(HandleThreadCache *pCache, HandleTable *pTable, uint32_t uType, bool fRetarget)
+{
+    WRAPPER_NO_CONTRACT;
+
+    if ((uType >= HANDLE_THREAD_CACHE_TYPES) || !pTable->fThreadCached)
+        return false;
+
+    if (pCache->uEpoch != g_uThreadCacheEpoch)
+    {
+        // our table may be gone - drop what we have
+        memset(pCache->rgCount, 0, sizeof(pCache->rgCount));
+        pCache->pTable = NULL;
+        pCache->uEpoch = g_uThreadCacheEpoch;
+    }
+
+    if (pCache->pTable != pTable)
+    {
+        if (pCache->pTable && !fRetarget)
+            return false;
+
+        // the thread moved to another heap's table - give the old one its handles back
+        pCache->Flush();
+        pCache->pTable = pTable;
+    }
+
+    return true;
+}
+
+
+/*
+ * ThreadCacheAlloc
+ *
+ * Gets a handle from the current thread's cache, refilling it from the table if
+ * it is empty.  Returns NULL if the handle has to come from the table's cache.
+ *
+ */
+static OBJECTHANDLE ThreadCacheAlloc(HandleTable *pTable, uint32_t uType)
+{
+    WRAPPER_NO_CONTRACT;
+
+    HandleThreadCache *pCache = &t_HandleThreadCache;
+    if (!ThreadCacheUsable(pCache, pTable, uType, true))
+        return NULL;
+
+    uint32_t uCount = pCache->rgCount[uType];
+    if (!uCount)
+    {
+        CrstHolder ch(&pTable->Lock);
+
+        uCount = TableAllocBulkHandles(pTable, uType, pCache->rgHandles[uType], HANDLE_THREAD_CACHE_BATCH);
+
+        // out of memory - let the table's cache deal with it
+        if (!uCount)
+            return NULL;
+    }
+
+    uCount--;
+    pCache->rgCount[uType] = uCount;
+
+    return pCache->rgHandles[uType][uCount];
+}
+
+
+/*
+ * ThreadCacheFree
+ *
+ * Puts a zeroed handle in the current thread's cache, draining half of it to the
+ * table if it is full.  Returns false if the handle has to go to the table's cache.
+ *
+ */
+static bool ThreadCacheFree(HandleTable *pTable, uint32_t uType, OBJECTHANDLE handle)
+{
+    WRAPPER_NO_CONTRACT;
+
+    HandleThreadCache *pCache = &t_HandleThreadCache;
+    if (!ThreadCacheUsable(pCache, pTable, uType, false))
+        return false;
+
+    uint32_t uCount = pCache->rgCount[uType];
+    if (uCount == HANDLES_PER_THREAD_CACHE)
+    {
+        CrstHolder ch(&pTable->Lock);
+
+        // release the oldest half of the cache, the most recently freed handles are the warmest
+        TableFreeBulkUnpreparedHandles(pTable, uType, pCache->rgHandles[uType], HANDLE_THREAD_CACHE_BATCH);
+
+        uCount -= HANDLE_THREAD_CACHE_BATCH;
+        memmove(pCache->rgHandles[uType], pCache->rgHandles[uType] + HANDLE_THREAD_CACHE_BATCH, uCount * sizeof(OBJECTHANDLE));
+    }
+
+    pCache->rgHandles[uType][uCount] = handle;
+    pCache->rgCount[uType] = uCount + 1;
+
+    return true;
+}
+
+
+/*
+ * TableInvalidateThreadCaches
+ *
+ * Makes every thread drop the handles in its thread cache instead of
+ * returning them, called before a thread cached table is destroyed.
+ *
+ */
+void TableInvalidateThreadCaches()
+{
+    WRAPPER_NO_CONTRACT;
+
+    Interlocked::Increment(&g_uThreadCacheEpoch);
+}
+
+
 /*
  * TableAllocSingleHandleFromCache
  *
@@ -718,7 +900,12 @@ OBJECTHANDLE TableAllocSingleHandleFromCache(HandleTable *pTable, uint32_t uType
     // we use this in two places
     OBJECTHANDLE handle;
 
-    // first try to get a handle from the quick cache
+    // first try to get a handle from the thread's own cache
+    handle = ThreadCacheAlloc(pTable, uType);
+    if (handle)
+        return handle;
+
+    // then try to get a handle from the quick cache
     if (pTable->rgQuickCache[uType])
     {
         // try to grab the handle we saw
@@ -786,6 +973,10 @@ void TableFreeSingleHandleToCache(HandleTable *pTable, uint32_t uType, OBJECTHAN
     if (TypeHasUserData(pTable, uType))
         HandleQuickSetUserData(handle, 0L);
 
+    // keep the handle for this thread if we can
+    if (ThreadCacheFree(pTable, uType, handle))
+        return;
+
     // is there room in the quick cache?
     if (!pTable->rgQuickCache[uType])
     {
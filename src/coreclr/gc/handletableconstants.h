@@ -94,6 +94,15 @@
 #define HANDLE_MASKS_PER_BLOCK          (HANDLE_HANDLES_PER_BLOCK / HANDLE_HANDLES_PER_MASK)
 #define HANDLE_CLUMPS_PER_MASK          (HANDLE_HANDLES_PER_MASK / HANDLE_HANDLES_PER_CLUMP)
 
+// parallel scan metrics
+#define HANDLE_BLOCKS_PER_SCAN_CHUNK    (16)        // parallel GC scan work granularity
+#define HANDLE_SCAN_CHUNKS_PER_SEGMENT  ((HANDLE_BLOCKS_PER_SEGMENT + HANDLE_BLOCKS_PER_SCAN_CHUNK - 1) / HANDLE_BLOCKS_PER_SCAN_CHUNK)
+#define HANDLE_SCAN_CLAIM_CHUNK_BITS    (8)
+#define HANDLE_SCAN_CLAIM_CHUNK_MASK    ((1 << HANDLE_SCAN_CLAIM_CHUNK_BITS) - 1)
+
+// The next chunk to claim is kept in the low bits of the segment's claim word.
+C_ASSERT (HANDLE_SCAN_CHUNKS_PER_SEGMENT < HANDLE_SCAN_CLAIM_CHUNK_MASK);
+
 // We use this relation to check for free mask per block.
 C_ASSERT (HANDLE_HANDLES_PER_MASK * 2 == HANDLE_HANDLES_PER_BLOCK);
 
@@ -107,6 +116,11 @@ C_ASSERT (HANDLE_HANDLES_PER_MASK * 2 == HANDLE_HANDLES_PER_BLOCK);
 #define REBALANCE_LOWATER_MARK          (HANDLES_PER_CACHE_BANK - REBALANCE_TOLERANCE)
 #define REBALANCE_HIWATER_MARK          (HANDLES_PER_CACHE_BANK + REBALANCE_TOLERANCE)
 
+// per-thread cache metrics
+#define HANDLES_PER_THREAD_CACHE        16
+#define HANDLE_THREAD_CACHE_BATCH       (HANDLES_PER_THREAD_CACHE / 2)
+#define HANDLE_THREAD_CACHE_TYPES       4   // HNDTYPE_WEAK_SHORT through HNDTYPE_PINNED, the types behind GCHandle
+
 // bulk alloc policy defines
 #define SMALL_ALLOC_COUNT               (HANDLES_PER_CACHE_BANK / 10)
 
@@ -184,7 +184,18 @@ struct TableSegment : public _TableSegmentHeader
     /*
      * Filler
      */
-    uint8_t rgUnused[HANDLE_HEADER_SIZE - sizeof(_TableSegmentHeader)];
+    uint8_t rgUnused[HANDLE_HEADER_SIZE - sizeof(_TableSegmentHeader) - sizeof(uint32_t)];
+
+    /*
+     * Parallel Scan Claim
+     *
+     * The epoch of the last parallel scan that visited this segment in the high bits
+     * and the next chunk of blocks to be handed out in that scan in the low bits.
+     *
+     * This lives at the end of the header rather than in _TableSegmentHeader so
+     * it's naturally aligned for interlocked operations.
+     */
+    uint32_t dwScanClaim;
 
     /*
      * Handles
@@ -408,6 +419,12 @@ struct HandleTable
      */
     uint32_t uTableIndex;
 
+    /*
+     * whether threads may keep handles of this table in their thread caches
+     * (only set for tables that live until shutdown)
+     */
+    bool fThreadCached;
+
     /*
      * one-level per-type 'quick' handle cache
      */
@@ -751,6 +768,16 @@ OBJECTHANDLE TableAllocSingleHandleFromCache(HandleTable *pTable, uint32_t uType
 void TableFreeSingleHandleToCache(HandleTable *pTable, uint32_t uType, OBJECTHANDLE handle);
 
 
+/*
+ * TableInvalidateThreadCaches
+ *
+ * Makes every thread drop the handles in its thread cache instead of
+ * returning them, called before a thread cached table is destroyed.
+ *
+ */
+void TableInvalidateThreadCaches();
+
+
 /*
  * TableAllocHandlesFromCache
  *
@@ -795,6 +822,23 @@ void CALLBACK TableScanHandles(PTR_HandleTable pTable,
                                CrstHolderWithState *pCrstHolder);
 
 
+/*
+ * TableScanHandlesInParallel
+ *
+ * Implements handle scanning for a table that is being scanned by several
+ * GC threads at once, with each chunk of blocks scanned by exactly one of them.
+ *
+ */
+void TableScanHandlesInParallel(PTR_HandleTable pTable,
+                                const uint32_t *puType,
+                                uint32_t uTypeCount,
+                                uint32_t uScanEpoch,
+                                BLOCKSCANPROC pfnBlockHandler,
+                                ScanCallbackInfo *pInfo,
+                                HANDLECHUNKSCANNEDPROC pfnChunkScanned,
+                                uintptr_t lChunkParam);
+
+
 /*
  * xxxTableScanHandlesAsync
  *
@@ -1640,23 +1640,17 @@ void SegmentScanByTypeChain(PTR_TableSegment pSegment, uint32_t uType, BLOCKSCAN
 
 
 /*
- * SegmentScanByTypeMap
+ * SegmentScanRangeByTypeMap
  *
- * Implements the multi-type block scanning loop for a single segment.
+ * Implements the multi-type block scanning loop for a range of blocks in a single segment.
  *
  */
-void SegmentScanByTypeMap(PTR_TableSegment pSegment, const BOOL *rgTypeInclusion,
-                          BLOCKSCANPROC pfnBlockHandler, ScanCallbackInfo *pInfo)
+void SegmentScanRangeByTypeMap(PTR_TableSegment pSegment, const BOOL *rgTypeInclusion, uint32_t uBlock, uint32_t uLimit,
+                               BLOCKSCANPROC pfnBlockHandler, ScanCallbackInfo *pInfo)
 {
     WRAPPER_NO_CONTRACT;
 
-    // start scanning with the first block in the segment
-    uint32_t uBlock = 0;
-
-    // we don't need to scan the whole segment, just up to the empty line
-    uint32_t uLimit = pSegment->bEmptyLine;
-
-    // loop across the segment looking for blocks to scan
+    // loop across the range looking for blocks to scan
     for (;;)
     {
         // find the first block included by the type map
@@ -1701,6 +1695,62 @@ void SegmentScanByTypeMap(PTR_TableSegment pSegment, const BOOL *rgTypeInclusion
 }
 
 
+/*
+ * SegmentScanByTypeMap
+ *
+ * Implements the multi-type block scanning loop for a single segment.
+ *
+ */
+void SegmentScanByTypeMap(PTR_TableSegment pSegment, const BOOL *rgTypeInclusion,
+                          BLOCKSCANPROC pfnBlockHandler, ScanCallbackInfo *pInfo)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // we don't need to scan the whole segment, just up to the empty line
+    SegmentScanRangeByTypeMap(pSegment, rgTypeInclusion, 0, pSegment->bEmptyLine, pfnBlockHandler, pInfo);
+}
+
+
+#ifndef DACCESS_COMPILE
+/*
+ * SegmentClaimScanChunk
+ *
+ * Claims the next chunk of blocks in a segment for the parallel scan with the given epoch.
+ *
+ * Returns the first block of the claimed chunk or HANDLE_BLOCKS_PER_SEGMENT if all the
+ * chunks in the segment have already been handed out.
+ *
+ */
+uint32_t SegmentClaimScanChunk(PTR_TableSegment pSegment, uint32_t uScanEpoch)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // only the low bits of the epoch fit next to the chunk index - that's fine since every
+    // parallel scan touches every segment so a segment is never more than one epoch behind
+    uint32_t uEpochBits = uScanEpoch << HANDLE_SCAN_CLAIM_CHUNK_BITS;
+
+    uint32_t dwClaim = VolatileLoad(&pSegment->dwScanClaim);
+    for (;;)
+    {
+        // if the segment hasn't been visited in this scan yet then we start from the first chunk
+        uint32_t uChunk = 0;
+        if ((dwClaim & ~HANDLE_SCAN_CLAIM_CHUNK_MASK) == uEpochBits)
+            uChunk = (dwClaim & HANDLE_SCAN_CLAIM_CHUNK_MASK);
+
+        if (uChunk >= HANDLE_SCAN_CHUNKS_PER_SEGMENT)
+            return HANDLE_BLOCKS_PER_SEGMENT;
+
+        uint32_t dwSeen = Interlocked::CompareExchange(&pSegment->dwScanClaim, (uEpochBits | (uChunk + 1)), dwClaim);
+        if (dwSeen == dwClaim)
+            return (uChunk * HANDLE_BLOCKS_PER_SCAN_CHUNK);
+
+        // somebody else claimed a chunk first
+        dwClaim = dwSeen;
+    }
+}
+#endif // !DACCESS_COMPILE
+
+
 /*
  * TableScanHandles
  *
@@ -1761,6 +1811,68 @@ void CALLBACK TableScanHandles(PTR_HandleTable pTable,
 }
 
 
+#ifndef DACCESS_COMPILE
+/*
+ * TableScanHandlesInParallel
+ *
+ * Implements handle scanning for a table that is being scanned by several
+ * GC threads at once, with each chunk of blocks scanned by exactly one of them.
+ *
+ * Unlike TableScanHandles this only uses the quick segment iterator - the
+ * maintenance the other iterators do on the segments can't race with
+ * another thread scanning the same segment.
+ *
+ */
+void TableScanHandlesInParallel(PTR_HandleTable pTable,
+                                const uint32_t *puType,
+                                uint32_t uTypeCount,
+                                uint32_t uScanEpoch,
+                                BLOCKSCANPROC pfnBlockHandler,
+                                ScanCallbackInfo *pInfo,
+                                HANDLECHUNKSCANNEDPROC pfnChunkScanned,
+                                uintptr_t lChunkParam)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // sanity - caller must ALWAYS provide a valid ScanCallbackInfo
+    _ASSERTE(pInfo);
+    _ASSERTE(pfnBlockHandler && puType && uTypeCount);
+    _ASSERTE((pInfo->uFlags & HNDGCF_ASYNC) == 0);
+
+    // chunks aren't generally made of a single type's allocation chain so we
+    // always go by the type map, even for single type scans
+    BOOL rgTypeInclusion[INCLUSION_MAP_SIZE];
+    BuildInclusionMap(rgTypeInclusion, puType, uTypeCount);
+
+    PTR_TableSegment pSegment = NULL;
+    while ((pSegment = QuickSegmentIterator(pTable, pSegment)) != NULL)
+    {
+        pInfo->pCurrentSegment = pSegment;
+
+        for (;;)
+        {
+            uint32_t uBlock = SegmentClaimScanChunk(pSegment, uScanEpoch);
+
+            // the chunks past the empty line have nothing in them
+            uint32_t uLimit = pSegment->bEmptyLine;
+            if (uBlock >= uLimit)
+                break;
+
+            if (uLimit > (uBlock + HANDLE_BLOCKS_PER_SCAN_CHUNK))
+                uLimit = uBlock + HANDLE_BLOCKS_PER_SCAN_CHUNK;
+
+            do
+            {
+                SegmentScanRangeByTypeMap(pSegment, rgTypeInclusion, uBlock, uLimit, pfnBlockHandler, pInfo);
+            } while (pfnChunkScanned && pfnChunkScanned(lChunkParam));
+        }
+
+        pInfo->pCurrentSegment = NULL;
+    }
+}
+#endif // !DACCESS_COMPILE
+
+
 /*
  * xxxTableScanHandlesAsync
  *
@@ -679,6 +679,9 @@ bool Ref_Initialize()
             goto CleanupAndFail;
 
         HndSetHandleTableIndex(pBucket->pTable[uCPUindex], 0);
+
+        // the global handle store is only destroyed at shutdown, so its handles can be cached per thread
+        HndEnableThreadCache(pBucket->pTable[uCPUindex]);
     }
 
     pBuckets[0] = pBucket;
@@ -882,6 +885,62 @@ int getThreadCount(ScanContext* sc)
     return sc->thread_count;
 }
 
+// Handles are allocated in the table for the home heap of the allocating thread so some tables can have many
+// more handles than others. For scans that every GC thread does between the same two joins we don't give each
+// thread the tables for its own slots but let all the threads take chunks of blocks from all the tables.
+//
+// Every thread reads the epoch when it starts such a scan and the last one to finish moves it on, so a thread
+// can't start the next scan before all the others started this one as long as there's a join in between.
+static VOLATILE(uint32_t) s_uParallelScanEpoch = 0;
+static VOLATILE(int32_t) s_lParallelScanThreadsDone = 0;
+
+bool Ref_ScanHandlesInParallel(ScanContext* sc)
+{
+    WRAPPER_NO_CONTRACT;
+
+    return (IsServerHeap() && !sc->concurrent && (getThreadCount(sc) > 1));
+}
+
+void ScanHandlesForGCInParallel(ScanContext* sc, HANDLESCANPROC scanProc, uintptr_t param1, uintptr_t param2,
+                                const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags,
+                                HANDLECHUNKSCANNEDPROC pfnChunkScanned = NULL, uintptr_t lChunkParam = 0)
+{
+    WRAPPER_NO_CONTRACT;
+
+    _ASSERTE(Ref_ScanHandlesInParallel(sc));
+
+    uint32_t uEpoch = s_uParallelScanEpoch;
+    int uCPUlimit = getNumberOfSlots();
+
+    HandleTableMap *walk = &g_HandleTableMap;
+    while (walk)
+    {
+        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
+        {
+            if (walk->pBuckets[i] != NULL)
+            {
+                HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
+                for (int uCPUindex = 0; uCPUindex < uCPUlimit; uCPUindex++)
+                {
+                    HHANDLETABLE hTable = pTable[uCPUindex];
+                    if (hTable)
+                    {
+                        HndScanHandlesForGCInParallel(hTable, scanProc, param1, param2, types, typeCount, condemned, maxgen, flags,
+                                                      uEpoch, pfnChunkScanned, lChunkParam);
+                    }
+                }
+            }
+        }
+        walk = walk->pNext;
+    }
+
+    if (Interlocked::Increment(&s_lParallelScanThreadsDone) == getThreadCount(sc))
+    {
+        s_lParallelScanThreadsDone = 0;
+        s_uParallelScanEpoch = uEpoch + 1;
+    }
+}
+
 void SetDependentHandleSecondary(OBJECTHANDLE handle, OBJECTREF objref)
 {
     CONTRACTL
@@ -1042,6 +1101,21 @@ void TraceVariableHandlesBySingleThread(HANDLESCANPROC pfnTrace, uintptr_t lp1,
         walk = walk->pNext;
     }
 }
+
+/*
+  parallel scan version of TraceVariableHandles for Ref_* functions that scan the other handles in parallel
+  (see ScanHandlesForGCInParallel)
+*/
+void TraceVariableHandlesInParallel(HANDLESCANPROC pfnTrace, ScanContext *sc, uintptr_t lp2, uint32_t uEnableMask, uint32_t condemned, uint32_t maxgen, uint32_t flags)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // set up to scan variable handles with the specified mask and trace function
+    uint32_t type = HNDTYPE_VARIABLE;
+    struct VARSCANINFO info = { (uintptr_t)uEnableMask, pfnTrace, lp2 };
+
+    ScanHandlesForGCInParallel(sc, VariableTraceDispatcher, (uintptr_t)sc, (uintptr_t)&info, &type, 1, condemned, maxgen, HNDGCF_EXTRAINFO | flags);
+}
 #endif // FEATURE_VARIABLE_HANDLES
 
 //----------------------------------------------------------------------------
@@ -1224,31 +1298,41 @@ void Ref_CheckReachable(uint32_t condemned, uint32_t maxgen, ScanContext *sc)
     // check objects pointed to by short weak handles
     uint32_t flags = sc->concurrent ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk) {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-        {
-            if (walk->pBuckets[i] != NULL)
+    if (Ref_ScanHandlesInParallel(sc))
+    {
+        ScanHandlesForGCInParallel(sc, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+    }
+    else
+    {
+        HandleTableMap *walk = &g_HandleTableMap;
+        while (walk) {
+            for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
             {
-                int uCPUindex = getSlotNumber(sc);
-                int uCPUlimit = getNumberOfSlots();
-                assert(uCPUlimit > 0);
-                int uCPUstep = getThreadCount(sc);
-                HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
-                for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
+                if (walk->pBuckets[i] != NULL)
                 {
-                    HHANDLETABLE hTable = pTable[uCPUindex];
-                    if (hTable)
-                        HndScanHandlesForGC(hTable, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+                    int uCPUindex = getSlotNumber(sc);
+                    int uCPUlimit = getNumberOfSlots();
+                    assert(uCPUlimit > 0);
+                    int uCPUstep = getThreadCount(sc);
+                    HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
+                    for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
+                    {
+                        HHANDLETABLE hTable = pTable[uCPUindex];
+                        if (hTable)
+                            HndScanHandlesForGC(hTable, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+                    }
                 }
             }
+            walk = walk->pNext;
         }
-        walk = walk->pNext;
     }
 
 #ifdef FEATURE_VARIABLE_HANDLES
     // check objects pointed to by variable handles whose dynamic type is VHT_WEAK_LONG
-    TraceVariableHandles(CheckPromoted, sc, 0, VHT_WEAK_LONG, condemned, maxgen, flags);
+    if (Ref_ScanHandlesInParallel(sc))
+        TraceVariableHandlesInParallel(CheckPromoted, sc, 0, VHT_WEAK_LONG, condemned, maxgen, flags);
+    else
+        TraceVariableHandles(CheckPromoted, sc, 0, VHT_WEAK_LONG, condemned, maxgen, flags);
 #endif
 }
 
@@ -1353,6 +1437,57 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
     return fAnyPromotions;
 }
 
+// Called after each chunk of the dependent handle table is scanned by Ref_ScanDependentHandlesForPromotionInParallel.
+// Like the loop in Ref_ScanDependentHandlesForPromotion we keep scanning the chunk while it could still promote
+// something, and only what the last scan of the chunk saw counts towards whether there are unpromoted primaries.
+bool CALLBACK DependentHandleChunkScanned(uintptr_t lParam)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DhContext *pDhContext = (DhContext*)lParam;
+
+    bool fRescan = (pDhContext->m_fUnpromotedPrimaries && pDhContext->m_fPromoted);
+
+    if (pDhContext->m_fPromoted)
+        pDhContext->m_fAnyPromoted = true;
+    if (!fRescan && pDhContext->m_fUnpromotedPrimaries)
+        pDhContext->m_fAnyUnpromotedPrimaries = true;
+
+    pDhContext->m_fUnpromotedPrimaries = false;
+    pDhContext->m_fPromoted = false;
+
+    return fRescan;
+}
+
+// The same as Ref_ScanDependentHandlesForPromotion except the tables are scanned by all the GC threads together.
+// Every GC thread must call this between the same two joins.
+bool Ref_ScanDependentHandlesForPromotionInParallel(DhContext *pDhContext)
+{
+    LOG((LF_GC, LL_INFO10000, "Checking liveness of referents of dependent handles in generation %u in parallel\n", pDhContext->m_iCondemned));
+    uint32_t type = HNDTYPE_DEPENDENT;
+    uint32_t flags = HNDGCF_NORMAL | HNDGCF_EXTRAINFO;
+
+    pDhContext->m_fUnpromotedPrimaries = false;
+    pDhContext->m_fPromoted = false;
+    pDhContext->m_fAnyUnpromotedPrimaries = false;
+    pDhContext->m_fAnyPromoted = false;
+
+    ScanHandlesForGCInParallel(pDhContext->m_pScanContext,
+                               PromoteDependentHandle,
+                               uintptr_t(pDhContext->m_pScanContext),
+                               uintptr_t(pDhContext->m_pfnPromoteFunction),
+                               &type, 1,
+                               pDhContext->m_iCondemned,
+                               pDhContext->m_iMaxGen,
+                               flags,
+                               DependentHandleChunkScanned,
+                               uintptr_t(pDhContext));
+
+    pDhContext->m_fUnpromotedPrimaries = pDhContext->m_fAnyUnpromotedPrimaries;
+
+    return pDhContext->m_fAnyPromoted;
+}
+
 // Perform a scan of dependent handles for the purpose of clearing any that haven't had their primary
 // promoted.
 void Ref_ScanDependentHandlesForClearing(uint32_t condemned, uint32_t maxgen, ScanContext* sc)
@@ -1362,6 +1497,14 @@ void Ref_ScanDependentHandlesForClearing(uint32_t condemned, uint32_t maxgen, Sc
     uint32_t flags = (sc->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
     flags |= HNDGCF_EXTRAINFO;
 
+    // this follows the long weak handle scan without a join so it needs to be in parallel if that one was -
+    // the full segment iterator could otherwise free a segment another thread is still scanning
+    if (Ref_ScanHandlesInParallel(sc))
+    {
+        ScanHandlesForGCInParallel(sc, ClearDependentHandle, uintptr_t(sc), 0, &type, 1, condemned, maxgen, flags);
+        return;
+    }
+
     HandleTableMap *walk = &g_HandleTableMap;
     while (walk)
     {
@@ -1545,32 +1688,42 @@ void Ref_CheckAlive(uint32_t condemned, uint32_t maxgen, ScanContext *sc)
     };
     uint32_t flags = sc->concurrent ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk)
+    if (Ref_ScanHandlesInParallel(sc))
     {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
+        ScanHandlesForGCInParallel(sc, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+    }
+    else
+    {
+        HandleTableMap *walk = &g_HandleTableMap;
+        while (walk)
         {
-            if (walk->pBuckets[i] != NULL)
+            for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
             {
-                int uCPUindex = getSlotNumber(sc);
-                int uCPUlimit = getNumberOfSlots();
-                assert(uCPUlimit > 0);
-                int uCPUstep = getThreadCount(sc);
-                HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
-                for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
+                if (walk->pBuckets[i] != NULL)
                 {
-                    HHANDLETABLE hTable = pTable[uCPUindex];
-                    if (hTable)
-                        HndScanHandlesForGC(hTable, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+                    int uCPUindex = getSlotNumber(sc);
+                    int uCPUlimit = getNumberOfSlots();
+                    assert(uCPUlimit > 0);
+                    int uCPUstep = getThreadCount(sc);
+                    HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
+                    for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
+                    {
+                        HHANDLETABLE hTable = pTable[uCPUindex];
+                        if (hTable)
+                            HndScanHandlesForGC(hTable, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+                    }
                 }
             }
+            walk = walk->pNext;
         }
-        walk = walk->pNext;
     }
 
 #ifdef FEATURE_VARIABLE_HANDLES
     // check objects pointed to by variable handles whose dynamic type is VHT_WEAK_SHORT
-    TraceVariableHandles(CheckPromoted, sc, 0, VHT_WEAK_SHORT, condemned, maxgen, flags);
+    if (Ref_ScanHandlesInParallel(sc))
+        TraceVariableHandlesInParallel(CheckPromoted, sc, 0, VHT_WEAK_SHORT, condemned, maxgen, flags);
+    else
+        TraceVariableHandles(CheckPromoted, sc, 0, VHT_WEAK_SHORT, condemned, maxgen, flags);
 #endif
 }
 
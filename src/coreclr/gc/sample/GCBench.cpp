@@ -0,0 +1,549 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// GCBench.cpp
+//
+
+//
+//  A standalone GC benchmark built on the same GC environment as GCSample. It drives the GC through
+//  IGCHeap without the rest of CoreCLR, so GC changes can be measured with just a GC build:
+//
+//      gcbench [-scale <n>] [scenario ...]
+//
+//  The scenarios model common allocation patterns:
+//
+//  * gen0churn - short lived objects with a small, slowly changing live set
+//  * gen2cache - a large cache that has been promoted to gen2 and is mutated while allocating,
+//                so every GC has to scan the cards of the cache
+//  * lohfrag   - large arrays of random sizes replaced in random order, which fragments the LOH
+//  * pinning   - short lived objects with many short lived pinned handles to young objects
+//
+//  Each scenario reports its allocation throughput, the number of GCs of each generation and the
+//  GC pauses, measured from SuspendEE to RestartEE. Like the sample, everything runs on one thread
+//  and there are no stack roots: all live objects are reachable from handles, and no object
+//  reference is held across an allocation without being fetched from its handle again.
+//
+
+#include "common.h"
+
+#include "gcenv.h"
+
+#include "gc.h"
+#include "objecthandle.h"
+
+#include "gcdesc.h"
+
+#include <vector>
+#include <algorithm>
+
+#ifdef TARGET_X86
+#define LOCALGC_CALLCONV __cdecl
+#else
+#define LOCALGC_CALLCONV
+#endif
+
+// Allocations of this size and larger go to the LOH, as they do in the runtime.
+#define LARGE_OBJECT_SIZE 85000
+
+static uint64_t g_allocatedBytes;
+
+static Object * AllocateObject(MethodTable * pMT)
+{
+    alloc_context * acontext = GetThread()->GetAllocContext();
+    Object * pObject;
+
+    size_t size = pMT->GetBaseSize();
+    g_allocatedBytes += size;
+
+    uint8_t* result = acontext->alloc_ptr;
+    uint8_t* advance = result + size;
+    if (advance <= acontext->alloc_limit)
+    {
+        acontext->alloc_ptr = advance;
+        pObject = (Object *)result;
+    }
+    else
+    {
+        pObject = g_theGCHeap->Alloc(acontext, size, pMT->ContainsGCPointers() ? GC_ALLOC_CONTAINS_REF : 0);
+        if (pObject == NULL)
+            return NULL;
+    }
+
+    pObject->RawSetMethodTable(pMT);
+
+    return pObject;
+}
+
+static ArrayBase * AllocateArray(MethodTable * pMT, uint32_t numComponents)
+{
+    size_t size = pMT->GetBaseSize() + (size_t)numComponents * pMT->RawGetComponentSize();
+    size = (size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+    g_allocatedBytes += size;
+
+    uint32_t flags = pMT->ContainsGCPointers() ? GC_ALLOC_CONTAINS_REF : 0;
+    if (size >= LARGE_OBJECT_SIZE)
+        flags |= GC_ALLOC_LARGE_OBJECT_HEAP;
+
+    Object * pObject = g_theGCHeap->Alloc(GetThread()->GetAllocContext(), size, flags);
+    if (pObject == NULL)
+        return NULL;
+
+    pObject->RawSetMethodTable(pMT);
+    *(uint32_t *)((uint8_t *)pObject + ArrayBase::GetOffsetOfNumComponents()) = numComponents;
+
+    return (ArrayBase *)pObject;
+}
+
+#if defined(HOST_64BIT)
+// Card byte shift is different on 64bit.
+#define card_byte_shift     11
+#else
+#define card_byte_shift     10
+#endif
+
+#define card_byte(addr) (((size_t)(addr)) >> card_byte_shift)
+
+inline void ErectWriteBarrier(Object ** dst, Object * ref)
+{
+    // if the dst is outside of the heap (unboxed value classes) then we
+    //      simply exit
+    if (((uint8_t*)dst < g_gc_lowest_address) || ((uint8_t*)dst >= g_gc_highest_address))
+        return;
+
+    // volatile is used here to prevent fetch of g_card_table from being reordered
+    // with g_lowest/highest_address check above. See comments in StompWriteBarrier
+    uint8_t* pCardByte = (uint8_t *)*(volatile uint8_t **)(&g_gc_card_table) + card_byte((uint8_t *)dst);
+    if(*pCardByte != 0xFF)
+        *pCardByte = 0xFF;
+}
+
+static void WriteBarrier(Object ** dst, Object * ref)
+{
+    *dst = ref;
+    ErectWriteBarrier(dst, ref);
+}
+
+extern "C" HRESULT LOCALGC_CALLCONV GC_Initialize(IGCToCLR* clrToGC, IGCHeap** gcHeap, IGCHandleManager** gcHandleManager, GcDacVars* gcDacVars);
+
+//
+// Types
+//
+
+// A small object with two references, like the one in GCSample.
+class Node : Object {
+public:
+    Object * m_pNext;
+    int m_value;
+    Object * m_pOther;
+};
+
+static struct Node_MethodTable
+{
+    CGCDescSeries m_series[2];
+    size_t m_numSeries;
+    MethodTable m_MT;
+}
+g_nodeMT;
+
+// Arrays of references and of bytes. Arrays of references are described by a single series that
+// covers all the elements, whatever the length of the array.
+static struct Array_MethodTable
+{
+    CGCDescSeries m_series[1];
+    size_t m_numSeries;
+    MethodTable m_MT;
+}
+g_objectArrayMT, g_byteArrayMT;
+
+static void InitializeTypes()
+{
+    uint32_t baseSize = sizeof(Node) + sizeof(ObjHeader);
+    g_nodeMT.m_MT.m_baseSize = max(baseSize, (uint32_t)MIN_OBJECT_SIZE);
+    g_nodeMT.m_MT.m_componentSize = 0;
+    g_nodeMT.m_MT.m_flags = MTFlag_ContainsGCPointers;
+    g_nodeMT.m_numSeries = 2;
+
+    // The GC walks the series backwards. It expects the offsets to be sorted in descending order.
+    g_nodeMT.m_series[0].SetSeriesOffset(offsetof(Node, m_pOther));
+    g_nodeMT.m_series[0].SetSeriesCount(1);
+    g_nodeMT.m_series[0].seriessize -= g_nodeMT.m_MT.m_baseSize;
+    g_nodeMT.m_series[1].SetSeriesOffset(offsetof(Node, m_pNext));
+    g_nodeMT.m_series[1].SetSeriesCount(1);
+    g_nodeMT.m_series[1].seriessize -= g_nodeMT.m_MT.m_baseSize;
+
+    // ObjHeader, MethodTable* and the length, padded to a pointer; the elements start after the length.
+    uint32_t arrayBaseSize = 3 * sizeof(void*);
+    size_t firstElementOffset = 2 * sizeof(void*);
+
+    // m_componentSize shares the low 16 bits of m_flags, so it has to be set after them.
+    g_objectArrayMT.m_MT.m_flags = MTFlag_HasComponentSize | MTFlag_IsArray | MTFlag_ContainsGCPointers;
+    g_objectArrayMT.m_MT.m_componentSize = sizeof(Object *);
+    g_objectArrayMT.m_MT.m_baseSize = arrayBaseSize;
+    g_objectArrayMT.m_numSeries = 1;
+    g_objectArrayMT.m_series[0].SetSeriesOffset(firstElementOffset);
+    g_objectArrayMT.m_series[0].SetSeriesCount(0);
+    g_objectArrayMT.m_series[0].seriessize -= arrayBaseSize;
+
+    g_byteArrayMT.m_MT.m_flags = MTFlag_HasComponentSize | MTFlag_IsArray;
+    g_byteArrayMT.m_MT.m_componentSize = 1;
+    g_byteArrayMT.m_MT.m_baseSize = arrayBaseSize;
+    g_byteArrayMT.m_numSeries = 0;
+}
+
+static Object ** GetElements(ArrayBase * pArray)
+{
+    return (Object **)((uint8_t *)pArray + 2 * sizeof(void*));
+}
+
+static HHANDLETABLE GetHandleTable()
+{
+    return g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()];
+}
+
+static Object ** GetRootedElements(OBJECTHANDLE oh)
+{
+    return GetElements((ArrayBase *)HndFetchHandle(oh));
+}
+
+// An array of references held by a strong handle, which is how the scenarios keep objects alive.
+static OBJECTHANDLE CreateRootedArray(uint32_t length)
+{
+    ArrayBase * pArray = AllocateArray(&g_objectArrayMT.m_MT, length);
+    if (pArray == NULL)
+        return NULL;
+    return HndCreateHandle(GetHandleTable(), HNDTYPE_DEFAULT, pArray);
+}
+
+// Store a reference in element index of the array held by oh.
+static void StoreElement(OBJECTHANDLE oh, size_t index, Object * ref)
+{
+    WriteBarrier(&GetRootedElements(oh)[index], ref);
+}
+
+// A small, fast pseudo random number generator, so that runs are repeatable.
+static uint32_t g_random = 0x12345678;
+
+static uint32_t NextRandom()
+{
+    g_random ^= g_random << 13;
+    g_random ^= g_random >> 17;
+    g_random ^= g_random << 5;
+    return g_random;
+}
+
+//
+// Pause accounting
+//
+
+static int64_t g_suspendStart;
+static std::vector<int64_t> g_pauses;
+
+static void OnGCSuspend(bool suspending)
+{
+    int64_t now = GCToOSInterface::QueryPerformanceCounter();
+    if (suspending)
+        g_suspendStart = now;
+    else
+        g_pauses.push_back(now - g_suspendStart);
+}
+
+//
+// Scenarios. The optional setup runs before the measurement starts. Both return false if they
+// ran out of memory.
+//
+
+static bool Gen0Churn(int scale)
+{
+    const uint32_t liveSetSize = 4096;
+
+    OBJECTHANDLE live = CreateRootedArray(liveSetSize);
+    if (live == NULL)
+        return false;
+
+    for (uint64_t i = 0; i < 20000000ull * scale; i++)
+    {
+        Object * p = AllocateObject(&g_nodeMT.m_MT);
+        if (p == NULL)
+            return false;
+
+        // Keep every 64th object alive for a while.
+        if ((i % 64) == 0)
+            StoreElement(live, (i / 64) % liveSetSize, p);
+    }
+
+    HndDestroyHandle(GetHandleTable(), HNDTYPE_DEFAULT, live);
+    return true;
+}
+
+static OBJECTHANDLE g_cache;
+
+static bool Gen2CacheSetup(int scale)
+{
+    const uint32_t cacheSize = 1000000 * scale;
+
+    g_cache = CreateRootedArray(cacheSize);
+    if (g_cache == NULL)
+        return false;
+
+    for (uint32_t i = 0; i < cacheSize; i++)
+    {
+        Object * p = AllocateObject(&g_nodeMT.m_MT);
+        if (p == NULL)
+            return false;
+        StoreElement(g_cache, i, p);
+    }
+
+    // Promote the cache to gen2, as it would be in a long running server.
+    g_theGCHeap->GarbageCollect(2);
+    g_theGCHeap->GarbageCollect(2);
+    return true;
+}
+
+static bool Gen2Cache(int scale)
+{
+    const uint32_t cacheSize = 1000000 * scale;
+    OBJECTHANDLE cache = g_cache;
+
+    for (uint64_t i = 0; i < 10000000ull * scale; i++)
+    {
+        Object * p = AllocateObject(&g_nodeMT.m_MT);
+        if (p == NULL)
+            return false;
+
+        // Point the new object at a cached one, and replace a random cache entry with every 16th
+        // object, which dirties a card in gen2.
+        Object ** elements = GetRootedElements(cache);
+        WriteBarrier(&((Node *)p)->m_pOther, elements[NextRandom() % cacheSize]);
+        if ((i % 16) == 0)
+            WriteBarrier(&elements[NextRandom() % cacheSize], p);
+    }
+
+    HndDestroyHandle(GetHandleTable(), HNDTYPE_DEFAULT, cache);
+    return true;
+}
+
+static bool LohFragmentation(int scale)
+{
+    const uint32_t slotCount = 256;
+    const uint32_t maxSize = 1024 * 1024;
+
+    OBJECTHANDLE slots = CreateRootedArray(slotCount);
+    if (slots == NULL)
+        return false;
+
+    for (uint32_t i = 0; i < 20000 * scale; i++)
+    {
+        uint32_t length = LARGE_OBJECT_SIZE + NextRandom() % (maxSize - LARGE_OBJECT_SIZE);
+        ArrayBase * pArray = AllocateArray(&g_byteArrayMT.m_MT, length);
+        if (pArray == NULL)
+            return false;
+        StoreElement(slots, NextRandom() % slotCount, pArray);
+
+        // Some small allocations in between, so that ephemeral GCs happen too.
+        for (int j = 0; j < 64; j++)
+        {
+            if (AllocateObject(&g_nodeMT.m_MT) == NULL)
+                return false;
+        }
+    }
+
+    HndDestroyHandle(GetHandleTable(), HNDTYPE_DEFAULT, slots);
+    return true;
+}
+
+static bool PinningStorm(int scale)
+{
+    const uint32_t liveSetSize = 4096;
+    const uint32_t pinCount = 256;
+
+    OBJECTHANDLE live = CreateRootedArray(liveSetSize);
+    if (live == NULL)
+        return false;
+
+    std::vector<OBJECTHANDLE> pins(pinCount, (OBJECTHANDLE)NULL);
+
+    for (uint64_t i = 0; i < 10000000ull * scale; i++)
+    {
+        Object * p = AllocateObject(&g_nodeMT.m_MT);
+        if (p == NULL)
+            return false;
+
+        if ((i % 64) == 0)
+            StoreElement(live, (i / 64) % liveSetSize, p);
+
+        // Pin every 32nd object and keep the last pinCount of them pinned, which scatters pins across gen0.
+        if ((i % 32) == 0)
+        {
+            OBJECTHANDLE & pin = pins[(i / 32) % pinCount];
+            if (pin != NULL)
+                HndDestroyHandle(GetHandleTable(), HNDTYPE_PINNED, pin);
+            pin = HndCreateHandle(GetHandleTable(), HNDTYPE_PINNED, p);
+            if (pin == NULL)
+                return false;
+        }
+    }
+
+    for (OBJECTHANDLE pin : pins)
+    {
+        if (pin != NULL)
+            HndDestroyHandle(GetHandleTable(), HNDTYPE_PINNED, pin);
+    }
+    HndDestroyHandle(GetHandleTable(), HNDTYPE_DEFAULT, live);
+    return true;
+}
+
+struct Scenario
+{
+    const char * name;
+    bool (*setup)(int scale);
+    bool (*run)(int scale);
+};
+
+static const Scenario g_scenarios[] =
+{
+    { "gen0churn", NULL,           Gen0Churn },
+    { "gen2cache", Gen2CacheSetup, Gen2Cache },
+    { "lohfrag",   NULL,           LohFragmentation },
+    { "pinning",   NULL,           PinningStorm },
+};
+
+static double TicksToMilliseconds(int64_t ticks)
+{
+    return ticks * 1000.0 / GCToOSInterface::QueryPerformanceFrequency();
+}
+
+static bool RunScenario(IGCHeap * pGCHeap, const Scenario & scenario, int scale)
+{
+    // Start from an empty heap, so the scenarios don't affect each other.
+    pGCHeap->GarbageCollect(2);
+
+    if ((scenario.setup != NULL) && !scenario.setup(scale))
+    {
+        printf("%-10s ran out of memory\n", scenario.name);
+        return false;
+    }
+
+    int gcCounts[3];
+    for (int gen = 0; gen < 3; gen++)
+        gcCounts[gen] = pGCHeap->CollectionCount(gen);
+
+    g_pauses.clear();
+    g_allocatedBytes = 0;
+
+    int64_t start = GCToOSInterface::QueryPerformanceCounter();
+    if (!scenario.run(scale))
+    {
+        printf("%-10s ran out of memory\n", scenario.name);
+        return false;
+    }
+    double elapsed = TicksToMilliseconds(GCToOSInterface::QueryPerformanceCounter() - start);
+
+    // Counts of the GCs of exactly each generation; CollectionCount includes the older ones.
+    for (int gen = 0; gen < 3; gen++)
+        gcCounts[gen] = pGCHeap->CollectionCount(gen) - gcCounts[gen];
+    gcCounts[0] -= gcCounts[1];
+    gcCounts[1] -= gcCounts[2];
+
+    std::vector<int64_t> pauses = g_pauses;
+    std::sort(pauses.begin(), pauses.end());
+    int64_t totalPause = 0;
+    for (int64_t pause : pauses)
+        totalPause += pause;
+
+    double allocatedMB = g_allocatedBytes / (1024.0 * 1024.0);
+    printf("%-10s %10.0f %10.0f %10.0f %6d %6d %6d %7d %10.1f %8.2f %8.2f %8.2f %6.1f\n",
+        scenario.name, elapsed, allocatedMB, allocatedMB * 1000.0 / elapsed,
+        gcCounts[0], gcCounts[1], gcCounts[2], (int)pauses.size(),
+        TicksToMilliseconds(totalPause),
+        pauses.empty() ? 0.0 : TicksToMilliseconds(pauses.back()),
+        pauses.empty() ? 0.0 : TicksToMilliseconds(pauses[pauses.size() / 2]),
+        pauses.empty() ? 0.0 : TicksToMilliseconds(pauses[(pauses.size() * 99) / 100]),
+        100.0 * TicksToMilliseconds(totalPause) / elapsed);
+
+    return true;
+}
+
+int __cdecl main(int argc, char* argv[])
+{
+    int scale = 1;
+    std::vector<const Scenario *> selected;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-scale") == 0) && (i + 1 < argc))
+        {
+            scale = atoi(argv[++i]);
+            if (scale <= 0)
+                scale = 1;
+            continue;
+        }
+
+        const Scenario * pScenario = NULL;
+        for (const Scenario & scenario : g_scenarios)
+        {
+            if (strcmp(argv[i], scenario.name) == 0)
+                pScenario = &scenario;
+        }
+
+        if (pScenario == NULL)
+        {
+            printf("Usage: gcbench [-scale <n>] [scenario ...]\n");
+            printf("Scenarios:");
+            for (const Scenario & scenario : g_scenarios)
+                printf(" %s", scenario.name);
+            printf("\n");
+            return -1;
+        }
+        selected.push_back(pScenario);
+    }
+
+    if (selected.empty())
+    {
+        for (const Scenario & scenario : g_scenarios)
+            selected.push_back(&scenario);
+    }
+
+    //
+    // Initialize the GC the same way as GCSample
+    //
+    if (!GCToOSInterface::Initialize())
+    {
+        return -1;
+    }
+
+    GcDacVars dacVars;
+    IGCHeap *pGCHeap;
+    IGCHandleManager *pGCHandleManager;
+    if (GC_Initialize(nullptr, &pGCHeap, &pGCHandleManager, &dacVars) != S_OK)
+    {
+        return -1;
+    }
+
+    if (FAILED(pGCHeap->Initialize()))
+        return -1;
+
+    if (!pGCHandleManager->Initialize())
+        return -1;
+
+    ThreadStore::AttachCurrentThread();
+
+    InitializeTypes();
+    g_pauses.reserve(100000);
+    g_pfnGCSuspendCallback = OnGCSuspend;
+
+    printf("%-10s %10s %10s %10s %6s %6s %6s %7s %10s %8s %8s %8s %6s\n",
+        "Scenario", "Time ms", "Alloc MB", "MB/s", "Gen0", "Gen1", "Gen2", "Pauses",
+        "Paused ms", "Max ms", "P50 ms", "P99 ms", "GC %");
+
+    int result = 0;
+    for (const Scenario * pScenario : selected)
+    {
+        if (!RunScenario(pGCHeap, *pScenario, scale))
+            result = -1;
+    }
+
+    g_pfnGCSuspendCallback = NULL;
+
+    return result;
+}
@@ -124,8 +124,13 @@ void ThreadStore::AttachCurrentThread()
     g_pThreadList = pThread;
 }
 
+GCSuspendCallback g_pfnGCSuspendCallback = NULL;
+
 void GCToEEInterface::SuspendEE(SUSPEND_REASON reason)
 {
+    if (g_pfnGCSuspendCallback != NULL)
+        g_pfnGCSuspendCallback(true);
+
     g_theGCHeap->SetGCInProgress(true);
 
     // TODO: Implement
@@ -136,6 +141,9 @@ void GCToEEInterface::RestartEE(bool bFinishedGC)
     // TODO: Implement
 
     g_theGCHeap->SetGCInProgress(false);
+
+    if (g_pfnGCSuspendCallback != NULL)
+        g_pfnGCSuspendCallback(false);
 }
 
 void GCToEEInterface::GcScanRoots(promote_func* fn,  int condemned, int max_gen, ScanContext* sc)
@@ -137,6 +137,11 @@ public:
     static void AttachCurrentThread();
 };
 
+// Called with true when the GC suspends the EE and with false when it restarts it, so that a host
+// such as gcbench can measure GC pauses. May be null.
+typedef void (*GCSuspendCallback)(bool suspending);
+extern GCSuspendCallback g_pfnGCSuspendCallback;
+
 // -----------------------------------------------------------------------------------------------------------
 // Config file enumulation
 //
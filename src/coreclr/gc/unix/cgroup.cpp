@@ -52,6 +52,10 @@ Abstract:
 #define CGROUP1_MEMORY_STAT_HIERARCHICAL_MEMORY_LIMIT_FIELD "hierarchical_memory_limit "
 #define CGROUP1_MEMORY_STAT_INACTIVE_FIELD "total_inactive_file "
 #define CGROUP2_MEMORY_STAT_INACTIVE_FIELD "inactive_file "
+#define CGROUP2_MEMORY_HIGH_FILENAME "/memory.high"
+#define CGROUP2_MEMORY_PRESSURE_FILENAME "/memory.pressure"
+#define PROC_PRESSURE_MEMORY_FILENAME "/proc/pressure/memory"
+#define PRESSURE_SOME_AVG10_FIELD "some avg10="
 
 extern bool ReadMemoryValueFromFile(const char* filename, uint64_t* val);
 
@@ -107,6 +111,63 @@ public:
         }
     }
 
+    // memory.high is where the kernel starts throttling and reclaiming from the cgroup, only cgroup v2 has it.
+    static bool GetMemoryHighLimit(uint64_t *val)
+    {
+        if ((s_cgroup_version != 2) || (s_memory_cgroup_path == nullptr))
+            return false;
+
+        char* mem_high_filename = nullptr;
+        if (asprintf(&mem_high_filename, "%s%s", s_memory_cgroup_path, CGROUP2_MEMORY_HIGH_FILENAME) < 0)
+            return false;
+
+        // This is "max" if there's no limit which fails to parse.
+        bool result = ReadMemoryValueFromFile(mem_high_filename, val);
+        free(mem_high_filename);
+        return result;
+    }
+
+    // Gets the percentage of the last 10s that some tasks were stalled on memory (PSI "some avg10") for the
+    // cgroup, or for the whole system if we are not in a cgroup v2.
+    static bool GetMemoryStallPercent(uint32_t *val)
+    {
+        char* pressure_filename = nullptr;
+        if ((s_cgroup_version == 2) && (s_memory_cgroup_path != nullptr))
+        {
+            if (asprintf(&pressure_filename, "%s%s", s_memory_cgroup_path, CGROUP2_MEMORY_PRESSURE_FILENAME) < 0)
+                return false;
+        }
+
+        FILE* file = fopen((pressure_filename != nullptr) ? pressure_filename : PROC_PRESSURE_MEMORY_FILENAME, "r");
+        free(pressure_filename);
+        if (file == nullptr)
+            return false;
+
+        bool result = false;
+        char* line = nullptr;
+        size_t lineLen = 0;
+        size_t fieldLen = strlen(PRESSURE_SOME_AVG10_FIELD);
+        while (getline(&line, &lineLen, file) != -1)
+        {
+            if (strncmp(line, PRESSURE_SOME_AVG10_FIELD, fieldLen) == 0)
+            {
+                errno = 0;
+                char* endptr = nullptr;
+                double avg10 = strtod(line + fieldLen, &endptr);
+                if ((endptr != line + fieldLen) && (errno == 0))
+                {
+                    *val = (avg10 < 0.0) ? 0 : ((avg10 > 100.0) ? 100 : (uint32_t)avg10);
+                    result = true;
+                }
+                break;
+            }
+        }
+
+        free(line);
+        fclose(file);
+        return result;
+    }
+
 private:
     static int FindCGroupVersion()
     {
@@ -614,6 +675,23 @@ size_t GetRestrictedPhysicalMemoryLimit()
     }
 }
 
+bool GetMemoryPressure(uint32_t* stall_percent, uint64_t* bytes_below_soft_limit)
+{
+    if (!CGroup::GetMemoryStallPercent(stall_percent))
+        return false;
+
+    *bytes_below_soft_limit = std::numeric_limits<uint64_t>::max();
+
+    uint64_t memory_high = 0;
+    size_t used = 0;
+    if (CGroup::GetMemoryHighLimit(&memory_high) && CGroup::GetPhysicalMemoryUsage(&used))
+    {
+        *bytes_below_soft_limit = (memory_high > used) ? (memory_high - used) : 0;
+    }
+
+    return true;
+}
+
 bool GetPhysicalMemoryUsed(size_t* val)
 {
     bool result = false;
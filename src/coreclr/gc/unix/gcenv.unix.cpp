@@ -204,6 +204,7 @@ static pthread_mutex_t g_flushProcessWriteBuffersMutex;
 
 size_t GetRestrictedPhysicalMemoryLimit();
 bool GetPhysicalMemoryUsed(size_t* val);
+bool GetMemoryPressure(uint32_t* stall_percent, uint64_t* bytes_below_soft_limit);
 
 static size_t g_RestrictedPhysicalMemoryLimit = 0;
 
@@ -1057,6 +1058,78 @@ size_t GCToOSInterface::GetCacheSizePerLogicalCpu(bool trueSize)
     return trueSize ? maxTrueSize : maxSize;
 }
 
+// Get the last level cache the specified processor shares with other processors
+// Parameters:
+//  procNo - the processor to query
+//  cacheSize - receives the size of the cache
+//  domainId - receives the lowest numbered processor attached to the same cache
+// Return:
+//  true if the cache topology is available for the processor, false otherwise
+bool GCToOSInterface::GetLastLevelCacheForProcessor(uint16_t procNo, size_t* cacheSize, uint16_t* domainId)
+{
+#if defined(TARGET_LINUX)
+    // On parts where the L3 is split into several domains (eg, one per CCX), sysconf only
+    // tells us the size of one of them, not which processors share it. The per cpu cache
+    // directories in sysfs describe both.
+    size_t bestLevel = 0;
+    size_t bestSize = 0;
+    int bestIndex = -1;
+    char path[128];
+
+    for (int i = 0; i < 10; i++)
+    {
+        uint64_t level = 0;
+        uint64_t size = 0;
+
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%d/level", (unsigned)procNo, i);
+        if (!ReadMemoryValueFromFile(path, &level))
+        {
+            break;
+        }
+
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%d/size", (unsigned)procNo, i);
+        if (ReadMemoryValueFromFile(path, &size) && (size != 0) && ((size_t)level > bestLevel))
+        {
+            bestLevel = (size_t)level;
+            bestSize = (size_t)size;
+            bestIndex = i;
+        }
+    }
+
+    if (bestIndex < 0)
+    {
+        return false;
+    }
+
+    // shared_cpu_list is a list of ranges in ascending order, eg "0-7,64-71", so the
+    // first number is the lowest numbered processor attached to this cache.
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%d/shared_cpu_list", (unsigned)procNo, bestIndex);
+    FILE* file = fopen(path, "r");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    unsigned int firstProc = 0;
+    int fieldsParsed = fscanf(file, "%u", &firstProc);
+    fclose(file);
+
+    if ((fieldsParsed != 1) || (firstProc >= MAX_SUPPORTED_CPUS))
+    {
+        return false;
+    }
+
+    *cacheSize = bestSize;
+    *domainId = (uint16_t)firstProc;
+    return true;
+#else
+    UNREFERENCED_PARAMETER(procNo);
+    UNREFERENCED_PARAMETER(cacheSize);
+    UNREFERENCED_PARAMETER(domainId);
+    return false;
+#endif // TARGET_LINUX
+}
+
 // Sets the calling thread's affinity to only run on the processor specified
 // Parameters:
 //  procNo - The requested processor for the calling thread.
@@ -1350,6 +1423,18 @@ uint64_t GetAvailablePageFile()
     return available;
 }
 
+// Get memory pressure
+// Parameters:
+//  stall_percent - The percentage of the last 10 seconds some threads were stalled waiting on memory.
+//  bytes_below_soft_limit - How far the memory usage is below the limit where the OS starts reclaiming
+//      memory from this process, or UINT64_MAX if there's no such limit.
+// Return:
+//  true if the OS reports memory pressure (PSI on Linux), false otherwise.
+bool GCToOSInterface::GetMemoryPressure(uint32_t* stall_percent, uint64_t* bytes_below_soft_limit)
+{
+    return ::GetMemoryPressure(stall_percent, bytes_below_soft_limit);
+}
+
 // Get memory status
 // Parameters:
 //  restricted_limit - The amount of physical memory in bytes that the current process is being restricted to. If non-zero, it used to calculate
@@ -13,6 +13,7 @@
 #endif
 #ifdef _M_ARM64
 #define ARCH_ARM
+#define ARCH_ARM64
 #endif
 #else
 #ifdef __i386__
@@ -24,6 +25,9 @@
 #ifdef __arm__
 #define ARCH_ARM
 #endif
+#ifdef __aarch64__
+#define ARCH_ARM64
+#endif
 #endif
 
 #ifdef _MSC_VER
@@ -45,6 +49,21 @@
 #define NOINLINE __attribute__((noinline))
 #endif
 
+// Population count of a partitioning mask. On x64 this is the popcnt instruction, on Arm64
+// there is no scalar popcount so the compiler goes through the SIMD unit (cnt + addv).
+#ifdef ARCH_ARM64
+#ifdef _MSC_VER
+#define vxsort_popcnt_u32(mask) ((int)_CountOneBits((unsigned int)(mask)))
+#define vxsort_popcnt_u64(mask) ((int64_t)_CountOneBits64((unsigned __int64)(mask)))
+#else
+#define vxsort_popcnt_u32(mask) ((int)__builtin_popcount((unsigned int)(mask)))
+#define vxsort_popcnt_u64(mask) ((int64_t)__builtin_popcountll((unsigned long long)(mask)))
+#endif
+#else
+#define vxsort_popcnt_u32(mask) _mm_popcnt_u32(mask)
+#define vxsort_popcnt_u64(mask) _mm_popcnt_u64(mask)
+#endif
+
 using std::max;
 using std::min;
 #endif  // VXSORT_DEFS_H
@@ -8,7 +8,11 @@
 #include "alignment.h"
 #include "machine_traits.h"
 
+#ifdef ARCH_ARM64
+#include <arm_neon.h>
+#else
 #include <immintrin.h>
+#endif
 
 namespace vxsort {
 
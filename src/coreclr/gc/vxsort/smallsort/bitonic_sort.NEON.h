@@ -0,0 +1,106 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef BITONIC_SORT_NEON_H
+#define BITONIC_SORT_NEON_H
+
+#include <arm_neon.h>
+#include <limits>
+#include "bitonic_sort.h"
+
+namespace vxsort {
+namespace smallsort {
+
+// Unlike the AVX2/AVX512 versions this is not generated - with only 2 or 4 lanes per
+// vector we sort a copy padded to a power of 2 with a plain bitonic network. Steps
+// that compare elements at least a vector apart are done on whole vectors and the
+// (few) steps within a vector are done on scalars.
+
+static INLINE int64x2_t neon_load(const int64_t* p) { return vld1q_s64(p); }
+static INLINE void neon_store(int64_t* p, int64x2_t v) { vst1q_s64(p, v); }
+static INLINE int64x2_t neon_min(int64x2_t a, int64x2_t b) { return vbslq_s64(vcgtq_s64(a, b), b, a); }
+static INLINE int64x2_t neon_max(int64x2_t a, int64x2_t b) { return vbslq_s64(vcgtq_s64(a, b), a, b); }
+
+static INLINE int32x4_t neon_load(const int32_t* p) { return vld1q_s32(p); }
+static INLINE void neon_store(int32_t* p, int32x4_t v) { vst1q_s32(p, v); }
+static INLINE int32x4_t neon_min(int32x4_t a, int32x4_t b) { return vminq_s32(a, b); }
+static INLINE int32x4_t neon_max(int32x4_t a, int32x4_t b) { return vmaxq_s32(a, b); }
+
+template <typename T, int N, int MaxLength>
+static void neon_bitonic_sort(T* ptr, size_t length) {
+    assert(length <= (size_t)MaxLength);
+
+    alignas(16) T buffer[MaxLength];
+    size_t padded_length = 2 * N;
+    while (padded_length < length) {
+        padded_length *= 2;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        buffer[i] = ptr[i];
+    }
+    for (size_t i = length; i < padded_length; i++) {
+        buffer[i] = std::numeric_limits<T>::max();
+    }
+
+    for (size_t k = 2; k <= padded_length; k *= 2) {
+        for (size_t j = k / 2; j > 0; j /= 2) {
+            if (j >= (size_t)N) {
+                // All lanes of a vector agree on (i & j) and (i & k) here.
+                for (size_t i = 0; i < padded_length; i += N) {
+                    if ((i & j) != 0)
+                        continue;
+
+                    auto lo = neon_load(buffer + i);
+                    auto hi = neon_load(buffer + i + j);
+                    auto mn = neon_min(lo, hi);
+                    auto mx = neon_max(lo, hi);
+                    bool ascending = ((i & k) == 0);
+                    neon_store(buffer + i, ascending ? mn : mx);
+                    neon_store(buffer + i + j, ascending ? mx : mn);
+                }
+            } else {
+                for (size_t i = 0; i < padded_length; i++) {
+                    size_t l = i ^ j;
+                    if (l <= i)
+                        continue;
+
+                    T a = buffer[i];
+                    T b = buffer[l];
+                    bool ascending = ((i & k) == 0);
+                    if ((a > b) == ascending) {
+                        buffer[i] = b;
+                        buffer[l] = a;
+                    }
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        ptr[i] = buffer[i];
+    }
+}
+
+template<> struct bitonic<int64_t, NEON> {
+    static const int N = 2;
+    static const int MAX_LENGTH = 16 * N;
+public:
+    static NOINLINE void sort(int64_t* ptr, size_t length) {
+        neon_bitonic_sort<int64_t, N, MAX_LENGTH>(ptr, length);
+    }
+};
+
+template<> struct bitonic<int32_t, NEON> {
+    static const int N = 4;
+    static const int MAX_LENGTH = 16 * N;
+public:
+    static NOINLINE void sort(int32_t* ptr, size_t length) {
+        neon_bitonic_sort<int32_t, N, MAX_LENGTH>(ptr, length);
+    }
+};
+
+}  // namespace smallsort
+}  // namespace vxsort
+
+#endif  // BITONIC_SORT_NEON_H
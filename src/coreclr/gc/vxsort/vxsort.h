@@ -4,6 +4,9 @@
 #ifndef VXSORT_VXSORT_H
 #define VXSORT_VXSORT_H
 
+#include "defs.h"
+
+#ifndef ARCH_ARM64
 #ifdef __GNUC__
 #ifdef __clang__
 #pragma clang attribute push (__attribute__((target("popcnt"))), apply_to = any(function))
@@ -12,13 +15,18 @@
 #pragma GCC target("popcnt")
 #endif
 #endif
+#endif //!ARCH_ARM64
 
 #include <assert.h>
+#include <limits>
+#ifdef ARCH_ARM64
+#include <arm_neon.h>
+#else
 #include <immintrin.h>
+#endif
 
 #include <minipal/utils.h>
 
-#include "defs.h"
 #include "alignment.h"
 #include "machine_traits.h"
 #ifdef VXSORT_STATS
@@ -310,7 +318,7 @@ private:
         dataVec = MT::partition_vector(dataVec, mask);
         MT::store_vec(reinterpret_cast<TV*>(left), dataVec);
         MT::store_vec(reinterpret_cast<TV*>(right), dataVec);
-        auto popCount = -_mm_popcnt_u64(mask);
+        auto popCount = -vxsort_popcnt_u64(mask);
         right += popCount;
         left += popCount + N;
     }
@@ -320,7 +328,7 @@ private:
                                                      T*& left,
                                                      T*& right) {
         auto mask = MT::get_cmpgt_mask(dataVec, P);
-        auto popCount = -_mm_popcnt_u64(mask);
+        auto popCount = -vxsort_popcnt_u64(mask);
         MT::store_compress_vec(reinterpret_cast<TV*>(left), dataVec, ~mask);
         MT::store_compress_vec(reinterpret_cast<TV*>(right + N + popCount), dataVec, mask);
         right += popCount;
@@ -581,8 +589,8 @@ private:
         TV LT0 = MT::load_vec(preAlignedLeft);
         auto rtMask = MT::get_cmpgt_mask(RT0, P);
         auto ltMask = MT::get_cmpgt_mask(LT0, P);
-        const auto rtPopCountRightPart = max(_mm_popcnt_u32(rtMask), rightAlign);
-        const auto ltPopCountRightPart = _mm_popcnt_u32(ltMask);
+        const auto rtPopCountRightPart = max(vxsort_popcnt_u32(rtMask), rightAlign);
+        const auto ltPopCountRightPart = vxsort_popcnt_u32(ltMask);
         const auto rtPopCountLeftPart  = N - rtPopCountRightPart;
         const auto ltPopCountLeftPart  = N - ltPopCountRightPart;
 
@@ -656,6 +664,8 @@ private:
 
 }  // namespace gcsort
 
+#ifndef ARCH_ARM64
 #include "vxsort_targets_disable.h"
+#endif //!ARCH_ARM64
 
 #endif
@@ -866,6 +866,67 @@ size_t GCToOSInterface::GetCacheSizePerLogicalCpu(bool trueSize)
     return trueSize ? maxTrueSize : maxSize;
 }
 
+// Get the last level cache the specified processor shares with other processors
+// Parameters:
+//  procNo - the processor to query
+//  cacheSize - receives the size of the cache
+//  domainId - receives the lowest numbered processor attached to the same cache
+// Return:
+//  true if the cache topology is available for the processor, false otherwise
+bool GCToOSInterface::GetLastLevelCacheForProcessor(uint16_t procNo, size_t* cacheSize, uint16_t* domainId)
+{
+    GroupProcNo groupProcNo(procNo);
+
+    // GetLogicalProcessorInformation only describes the processor group of the calling
+    // thread, so we don't attempt this for processors in other groups.
+    if (groupProcNo.GetGroup() != 0)
+    {
+        return false;
+    }
+
+    DWORD nEntries = 0;
+    SYSTEM_LOGICAL_PROCESSOR_INFORMATION *pslpi = GetLPI(&nEntries);
+    if (pslpi == NULL)
+    {
+        return false;
+    }
+
+    ULONG_PTR procMask = (ULONG_PTR)1 << groupProcNo.GetProcIndex();
+    BYTE bestLevel = 0;
+    size_t bestSize = 0;
+    ULONG_PTR bestMask = 0;
+
+    for (DWORD i = 0; i < nEntries; i++)
+    {
+        if ((pslpi[i].Relationship == RelationCache) &&
+            (pslpi[i].Cache.Type != CacheInstruction) &&
+            ((pslpi[i].ProcessorMask & procMask) != 0) &&
+            (pslpi[i].Cache.Level > bestLevel))
+        {
+            bestLevel = pslpi[i].Cache.Level;
+            bestSize = pslpi[i].Cache.Size;
+            bestMask = pslpi[i].ProcessorMask;
+        }
+    }
+
+    delete[] pslpi;
+
+    if (bestSize == 0)
+    {
+        return false;
+    }
+
+    uint16_t lowestProc = 0;
+    while ((bestMask & ((ULONG_PTR)1 << lowestProc)) == 0)
+    {
+        lowestProc++;
+    }
+
+    *cacheSize = bestSize;
+    *domainId = lowestProc;
+    return true;
+}
+
 // Sets the calling thread's affinity to only run on the processor specified
 // Parameters:
 //  procNo - The requested processor for the calling thread.
@@ -995,6 +1056,19 @@ uint64_t GCToOSInterface::GetPhysicalMemoryLimit(bool* is_restricted)
     return memStatus.ullTotalPhys;
 }
 
+// Get memory pressure
+// Parameters:
+//  stall_percent - The percentage of the last 10 seconds some threads were stalled waiting on memory.
+//  bytes_below_soft_limit - How far the memory usage is below the limit where the OS starts reclaiming
+//      memory from this process, or UINT64_MAX if there's no such limit.
+// Return:
+//  true if the OS reports memory pressure, false otherwise.
+bool GCToOSInterface::GetMemoryPressure(uint32_t* stall_percent, uint64_t* bytes_below_soft_limit)
+{
+    // Windows doesn't expose stall information
+    return false;
+}
+
 // Get memory status
 // Parameters:
 //  restricted_limit - The amount of physical memory in bytes that the current process is being restricted to. If non-zero, it used to calculate
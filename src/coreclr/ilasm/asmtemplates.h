@@ -132,6 +132,106 @@ private:
     ULONG       m_ulArrLen;
 };
 
+// HASHINDEX indexes elements by a hash that the caller computes, and leaves comparing the
+// elements that have the same hash to the caller as well. It doesn't own the elements,
+// which are usually also kept in a FIFO. Elements with the same hash are enumerated in
+// the order they were pushed, so the first match is the same as with a scan of the FIFO.
+//
+//     ULONG iter = 0;
+//     for(T* p = index.FIND(uHash, &iter); p; p = index.FIND(uHash, &iter))
+//         if(<p matches>) break;
+template <class T>
+class HASHINDEX
+{
+    struct Entry
+    {
+        unsigned    Hash;
+        T*          Item;
+    };
+public:
+    HASHINDEX() { m_Arr = NULL; m_ulArrLen = 0; m_ulCount = 0; };
+    ~HASHINDEX() { delete [] m_Arr; };
+    void RESET()
+    {
+        if(m_Arr) memset(m_Arr,0,m_ulArrLen*sizeof(Entry));
+        m_ulCount = 0;
+    };
+    void PUSH(T *item, unsigned uHash)
+    {
+        if(item)
+        {
+            // keep the table at most half full, so that the probe sequences stay short
+            if(2*(m_ulCount+1) > m_ulArrLen)
+            {
+                ULONG ulNewLen = m_ulArrLen ? 2*m_ulArrLen : 16;
+                Entry* tmp = new Entry[ulNewLen];
+                if(tmp == NULL)
+                {
+                    fprintf(stderr,"
+Out of memory!
+");
+                    return;
+                }
+                memset(tmp,0,ulNewLen*sizeof(Entry));
+                Entry* old = m_Arr;
+                ULONG ulOldLen = m_ulArrLen;
+                m_Arr = tmp;
+                m_ulArrLen = ulNewLen;
+                m_ulCount = 0;
+                if(old)
+                {
+                    // Start at an empty slot, so that each probe sequence is reinserted from
+                    // its beginning and the elements with the same hash keep their order
+                    ULONG ulStart = 0;
+                    while(old[ulStart].Item) ulStart++;
+                    for(ULONG i = 1; i <= ulOldLen; i++)
+                    {
+                        Entry* e = &old[(ulStart+i) & (ulOldLen-1)];
+                        if(e->Item) Insert(e->Item, e->Hash);
+                    }
+                    delete [] old;
+                }
+            }
+            Insert(item, uHash);
+        }
+    };
+    ULONG COUNT() { return m_ulCount; };
+    // Returns the next element with the hash, starting from *pulIter (0 for the first call)
+    T* FIND(unsigned uHash, ULONG* pulIter)
+    {
+        if(m_ulCount)
+        {
+            ULONG mask = m_ulArrLen-1;
+            // *pulIter counts the slots already probed, so that FIND can resume after a match
+            for(ULONG i = *pulIter; i < m_ulArrLen; i++)
+            {
+                Entry* e = &m_Arr[(uHash+i) & mask];
+                if(e->Item == NULL) break;
+                if(e->Hash == uHash)
+                {
+                    *pulIter = i+1;
+                    return e->Item;
+                }
+            }
+        }
+        *pulIter = m_ulArrLen;
+        return NULL;
+    };
+private:
+    void Insert(T* item, unsigned uHash)
+    {
+        ULONG mask = m_ulArrLen-1;
+        ULONG i = uHash & mask;
+        while(m_Arr[i].Item) i = (i+1) & mask;
+        m_Arr[i].Hash = uHash;
+        m_Arr[i].Item = item;
+        m_ulCount++;
+    };
+    Entry*      m_Arr;
+    ULONG       m_ulCount;
+    ULONG       m_ulArrLen;
+};
+
 
 // Indx256 implements a trie (or prefix tree) on null-terminated sequences of BYTEs.
 //
@@ -645,7 +645,9 @@ void Assembler::StartMethod(_In_ __nullterminated char* name, BinStr* sig, CorMe
         Method* pMethod;
         Class* pClass = (m_pCurClass ? m_pCurClass : m_pModuleClass);
         DWORD L = (DWORD)strlen(name);
-        for(int j=0; (pMethod = pClass->m_MethodList.PEEK(j)); j++)
+        ULONG iter = 0;
+        unsigned uHash = MemberHash(name, L, sig->ptr(), sig->length());
+        for(pMethod = pClass->m_MethodIndex.FIND(uHash, &iter); pMethod; pMethod = pClass->m_MethodIndex.FIND(uHash, &iter))
         {
             if( (pMethod->m_dwName == L) &&
                 (!strcmp(pMethod->m_szName,name)) &&
@@ -804,7 +806,6 @@ void Assembler::EndMethod()
 void Assembler::AddField(__inout_z __inout char* name, BinStr* sig, CorFieldAttr flags, _In_ __nullterminated char* rvaLabel, BinStr* pVal, ULONG ulOffset)
 {
     FieldDescriptor*    pFD;
-    ULONG   i,n;
     mdToken tkParent = mdTokenNil;
     Class* pClass;
 
@@ -857,11 +858,11 @@ void Assembler::AddField(__inout_z __inout char* name, BinStr* sig, CorFieldAttr
         }
     }
     pClass = (m_pCurClass ? m_pCurClass : m_pModuleClass);
-    n = pClass->m_FieldDList.COUNT();
     DWORD L = (DWORD)strlen(name);
-    for(i = 0; i < n; i++)
+    ULONG iter = 0;
+    unsigned uHash = MemberHash(name, L, sig->ptr(), sig->length());
+    for(pFD = pClass->m_FieldIndex.FIND(uHash, &iter); pFD; pFD = pClass->m_FieldIndex.FIND(uHash, &iter))
     {
-        pFD = pClass->m_FieldDList.PEEK(i);
         if((pFD->m_tdClass == tkParent)&&(L==pFD->m_dwName)&&(!strcmp(pFD->m_szName,name))
             &&(pFD->m_pbsSig->length() == sig->length())
             &&(memcmp(pFD->m_pbsSig->ptr(),sig->ptr(),sig->length())==0))
@@ -873,7 +874,7 @@ void Assembler::AddField(__inout_z __inout char* name, BinStr* sig, CorFieldAttr
     if (rvaLabel && !IsFdStatic(flags))
         report->error("Only static fields can have 'at' clauses\n");
 
-    if(i >= n)
+    if(pFD == NULL)
     {
         if((pFD = new FieldDescriptor))
         {
@@ -894,6 +895,7 @@ void Assembler::AddField(__inout_z __inout char* name, BinStr* sig, CorFieldAttr
             m_pCustomDescrList = &(pFD->m_CustomDescrList);
 
             pClass->m_FieldDList.PUSH(pFD);
+            pClass->m_FieldIndex.PUSH(pFD, uHash);
             pClass->m_fNewMembers = TRUE;
         }
         else
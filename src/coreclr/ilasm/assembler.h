@@ -65,6 +65,12 @@ unsigned hash(                // defined in assem.cpp
      unsigned  length,   /* the length of the key */
      unsigned  initval);  /* the previous hash, or an arbitrary value */
 
+// hash of a method or field by name and signature, see Class::m_MethodIndex
+inline unsigned MemberHash(LPCUTF8 szName, DWORD dwName, const BYTE* pSig, DWORD cSig)
+{
+    return hash(pSig, cSig, hash((const BYTE*)szName, dwName, 10));
+}
+
 struct MemberRefDescriptor
 {
     mdToken             m_tdClass;
@@ -295,6 +301,7 @@ typedef LIFO<char> StringStack;
 typedef LIFO<SEH_Descriptor> SEHD_Stack;
 
 typedef FIFO<Method> MethodList;
+typedef HASHINDEX<Method> MethodIndex;
 //typedef SORTEDARRAY<Method> MethodSortedList;
 typedef FIFO<mdToken> TokenList;
 /**************************************************************************/
@@ -323,6 +330,7 @@ struct FieldDescriptor
     ~FieldDescriptor() { if(m_szName) delete [] m_szName; if(m_pbsSig) delete m_pbsSig; };
 };
 typedef FIFO<FieldDescriptor> FieldDList;
+typedef HASHINDEX<FieldDescriptor> FieldIndex;
 
 struct EventDescriptor
 {
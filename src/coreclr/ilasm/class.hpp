@@ -41,6 +41,10 @@ public:
     MethodList			m_MethodList;
     //MethodSortedList    m_MethodSList;
     FieldDList          m_FieldDList;
+    // m_MethodList and m_FieldDList hashed by MemberHash of name and signature, so that
+    // duplicate checks and local member ref resolution don't scan all the members
+    MethodIndex         m_MethodIndex;
+    FieldIndex          m_FieldIndex;
     EventDList          m_EventDList;
     PropDList           m_PropDList;
     CustomDescrList     m_CustDList;
@@ -75,6 +75,7 @@ Method::Method(Assembler *pAssembler, Class *pClass, _In_ __nullterminated char
     m_firstArgName = pAssembler->getArgNameList();
     if(pClass == NULL) pClass = pAssembler->m_pModuleClass; // fake "class" <Module>
     pClass->m_MethodList.PUSH(this);
+    pClass->m_MethodIndex.PUSH(this, MemberHash(m_szName, m_dwName, m_pMethodSig, m_dwMethodCSig));
     pClass->m_fNewMembers = TRUE;
 
 
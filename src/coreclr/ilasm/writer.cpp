@@ -716,7 +716,7 @@ HRESULT Assembler::ResolveLocalMemberRefs()
     {
         MemberRefDescriptor*    pMRD;
         mdToken         tkMemberDef = 0;
-        int i,j,k;
+        int i,k;
         Class   *pSearch;
 
         if(m_fReportProgress) printf("Resolving local member refs: ");
@@ -758,7 +758,9 @@ HRESULT Assembler::ResolveLocalMemberRefs()
                             pMRD_pSig = (PCOR_SIGNATURE)(qbSig.Ptr());
                             pMRD_dwCSig = L;
                         }
-                        for(j=0; (pListMD = pSearch->m_MethodList.PEEK(j)) != NULL; j++)
+                        ULONG iter = 0;
+                        unsigned uHash = MemberHash(pMRD_szName, pMRD_dwName, pMRD_pSig, pMRD_dwCSig);
+                        for(pListMD = pSearch->m_MethodIndex.FIND(uHash, &iter); pListMD != NULL; pListMD = pSearch->m_MethodIndex.FIND(uHash, &iter))
                         {
                             if(pListMD->m_dwName != pMRD_dwName) continue;
                             if(strcmp(pListMD->m_szName,pMRD_szName)) continue;
@@ -789,7 +791,9 @@ HRESULT Assembler::ResolveLocalMemberRefs()
                     else   // fields
                     {
                         FieldDescriptor* pListFD;
-                        for(j=0; (pListFD = pSearch->m_FieldDList.PEEK(j)) != NULL; j++)
+                        ULONG iter = 0;
+                        unsigned uHash = MemberHash(pMRD_szName, pMRD_dwName, pMRD_pSig, pMRD_dwCSig);
+                        for(pListFD = pSearch->m_FieldIndex.FIND(uHash, &iter); pListFD != NULL; pListFD = pSearch->m_FieldIndex.FIND(uHash, &iter))
                         {
                             if(pListFD->m_dwName != pMRD_dwName) continue;
                             if(strcmp(pListFD->m_szName,pMRD_szName)) continue;
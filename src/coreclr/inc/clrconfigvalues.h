@@ -281,6 +281,7 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_gcAllowVeryLargeObjects, W("gcAllowVeryLargeOb
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_GCStress, W("GCStress"), 0, "Trigger GCs at regular intervals")
 CONFIG_DWORD_INFO(INTERNAL_GcStressOnDirectCalls, W("GcStressOnDirectCalls"), 0, "Whether to trigger a GC on direct calls")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_HeapVerify, W("HeapVerify"), 0, "When set verifies the integrity of the managed heap on entry and exit of each GC")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_FinalizerThreadCount, W("FinalizerThreadCount"), 1, "Number of threads that run finalizers. Values above 1 start helper threads that run non-critical finalizers next to the finalizer thread")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_GCCpuGroup, W("GCCpuGroup"), 0, "Specifies if to enable GC to support CPU groups")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_GCName, W("GCName"), "")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_GCPath, W("GCPath"), "")
@@ -360,6 +361,8 @@ RETAIL_CONFIG_STRING_INFO(INTERNAL_MultiCoreJitProfile, W("MultiCoreJitProfile")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitProfileWriteDelay, W("MultiCoreJitProfileWriteDelay"), 12, "Set the delay after which the multi-core JIT profile will be written to disk.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitMinNumCpus, W("MultiCoreJitMinNumCpus"), 2, "Minimum number of cpus that must be present to allow MultiCoreJit usage.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitNoProfileGather, W("MultiCoreJitNoProfileGather"), 0, "Set to 1 to disable profile gathering (but leave possibly enabled profile usage).")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitPlayOptimizedTier, W("MultiCoreJitPlayOptimizedTier"), 1, "Set to 0 to play back methods that had reached an optimized tier in the recorded run at tier 0.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitPlayerThreads, W("MultiCoreJitPlayerThreads"), 2, "Number of threads used to play back a multi-core JIT profile. Threads beyond the first only compile methods at an optimized tier.")
 
 #endif
 
@@ -396,6 +399,8 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_InterpreterFallback, W("InterpreterFallback"),
 ///
 CONFIG_DWORD_INFO(INTERNAL_LoaderHeapCallTracing, W("LoaderHeapCallTracing"), 0, "Loader heap troubleshooting")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_CodeHeapReserveForJumpStubs, W("CodeHeapReserveForJumpStubs"), 1, "Percentage of code heap to reserve for jump stubs")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_CodeHeapSeparateOptimizedCode, W("CodeHeapSeparateOptimizedCode"), 0, "If non-zero, tier-1 code is allocated in code heaps separate from tier-0 code and stubs")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_CodeHeapOptimizedCodeLargePages, W("CodeHeapOptimizedCodeLargePages"), 0, "If non-zero, the tier-1 code heaps are reserved in 2MB multiples and the OS is asked to back them with large pages. Implies CodeHeapSeparateOptimizedCode")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_BreakOnOutOfMemoryWithinRange, W("BreakOnOutOfMemoryWithinRange"), 0, "Break before out of memory within range exception is thrown")
 
 ///
@@ -442,7 +447,10 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_SpinLimitProcCap, W("SpinLimitProcCap"), 0xFFF
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_SpinLimitProcFactor, W("SpinLimitProcFactor"), 0x4E20, "Hex value specifying the multiplier on NumProcs to use when calculating the maximum spin duration")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_SpinLimitConstant, W("SpinLimitConstant"), 0x0, "Hex value specifying the constant to add when calculating the maximum spin duration")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_SpinRetryCount, W("SpinRetryCount"), 0xA, "Hex value specifying the number of times the entire spin process is repeated (when applicable)")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_SimpleRWLockReadBias, W("SimpleRWLockReadBias"), 1, "If non-zero, readers of the read-biased SimpleRWLocks avoid writing to the lock until a writer revokes the bias")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_YieldProcessorPsPerYield, W("YieldProcessorPsPerYield"), 0, "If non-zero, the duration of a YieldProcessor in picoseconds, used instead of measuring it when the process starts")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_Monitor_SpinCount, W("Monitor_SpinCount"), 0x1e, "Hex value specifying the maximum number of spin iterations Monitor may perform upon contention on acquiring the lock before waiting.")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_Monitor_FairHandoff, W("Monitor_FairHandoff"), 0, "If non-zero, a contended Monitor is handed off to its waiters in FIFO order instead of allowing other threads to preempt them.")
 
 ///
 /// Native Binder
@@ -479,6 +487,7 @@ CONFIG_DWORD_INFO(INTERNAL_TestOnlyEnableObjectAllocatedHook, W("TestOnlyEnableO
 CONFIG_DWORD_INFO(INTERNAL_TestOnlyEnableSlowELTHooks, W("TestOnlyEnableSlowELTHooks"), 0, "Test-only flag that forces CLR to initialize on startup as if slow-ELT were requested, to enable post-attach ELT functionality.")
 
 RETAIL_CONFIG_STRING_INFO(UNSUPPORTED_ETW_ObjectAllocationEventsPerTypePerSec, W("ETW_ObjectAllocationEventsPerTypePerSec"), "Desired number of GCSampledObjectAllocation ETW events to be logged per type per second.  If 0, then the default built in to the implementation for the enabled event (e.g., High, Low), will be used.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_AllocationSamplingInterval, W("AllocationSamplingInterval"), 100 * 1024, "The mean number of bytes allocated by a thread between two AllocationSampled events.")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ProfAPI_ValidateNGENInstrumentation, W("ProfAPI_ValidateNGENInstrumentation"), 0, "This flag enables additional validations when using the IMetaDataEmit APIs for NGEN'ed images to ensure only supported edits are made.")
 
 #ifdef FEATURE_PERFMAP
@@ -486,6 +495,7 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapEnabled, W("PerfMapEnabled"), 0, "This
 RETAIL_CONFIG_STRING_INFO_EX(EXTERNAL_PerfMapJitDumpPath, W("PerfMapJitDumpPath"), "Specifies a path to write the perf jitdump file. Defaults to /tmp", CLRConfig::LookupOptions::TrimWhiteSpaceFromStringValue)
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapIgnoreSignal, W("PerfMapIgnoreSignal"), 0, "When perf map is enabled, this option will configure the specified signal to be accepted and ignored as a marker in the perf logs.  It is disabled by default")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapShowOptimizationTiers, W("PerfMapShowOptimizationTiers"), 1, "Shows optimization tiers in the perf map for methods, as part of the symbol name. Useful for seeing separate stack frames for different optimization tiers of each method.")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapBufferSize, W("PerfMapBufferSize"), 0, "Size in KB of the buffer that perf map file lines are staged in. Staged lines are written when the buffer is full, when they are older than a second and at shutdown. 0 writes every line as it is logged")
 #endif
 
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_StartupDelayMS, W("StartupDelayMS"), "")
@@ -499,6 +509,7 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StressLogSize, W("StressLogSize"), 0, "Stre
 RETAIL_CONFIG_STRING_INFO(UNSUPPORTED_StressLogFilename, W("StressLogFilename"), "Stress log filename for memory mapped stress log.")
 CONFIG_DWORD_INFO(INTERNAL_stressSynchronized, W("stressSynchronized"), 0, "Unknown if or where this is used; unless a test is specifically depending on this, it can be removed.")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TotalStressLogSize, W("TotalStressLogSize"), 0, "Total stress log size in bytes.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_FlightRecorder, W("FlightRecorder"), 0, "Turns on a small, low-volume stress log that records GC, suspension, contention, tiering and thread pool events when the full stress log is off.")
 
 ///
 /// Thread Suspend
@@ -577,6 +588,9 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TC_CallCountThreshold, W("TC_CallCountThreshol
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TC_CallCountingDelayMs, W("TC_CallCountingDelayMs"), TC_CallCountingDelayMs, "A perpetual delay in milliseconds that is applied to call counting in tier 0 and jitting at higher tiers, while there is startup-like activity.")
 
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_BackgroundWorkerTimeoutMs, W("TC_BackgroundWorkerTimeoutMs"), TC_BackgroundWorkerTimeoutMs, "How long in milliseconds the background worker thread may remain idle before exiting.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_CallCountingCacheLineAligned, W("TC_CallCountingCacheLineAligned"), 0, "Set to 1 to keep the call count of each method being counted on its own cache line, to reduce contention when many threads call different hot methods.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_BackgroundWorkerCount, W("TC_BackgroundWorkerCount"), 1, "Maximum number of background workers that rejit methods at higher tiers. Additional workers are only started while there is a backlog, and together are limited to half of the available processors.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_LargeMethodILSize, W("TC_LargeMethodILSize"), 0, "Methods with at least this many bytes of IL are rejitted on a separate background worker so they don't hold up the rest of the queue. Zero to disable.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DelaySingleProcMultiplier, W("TC_DelaySingleProcMultiplier"), TC_DelaySingleProcMultiplier, "Multiplier for TC_CallCountingDelayMs that is applied on a single-processor machine or when the process is affinitized to a single processor.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_CallCounting, W("TC_CallCounting"), 1, "Enabled by default (only activates when TieredCompilation is also enabled). If disabled immediately backpatches prestub, and likely prevents any promotion to higher tiers")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_UseCallCountingStubs, W("TC_UseCallCountingStubs"), 1, "Uses call counting stubs for faster call counting.")
@@ -594,6 +608,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DeleteCallCountingStubsAfter, W("TC_DeleteC
 #ifdef FEATURE_ON_STACK_REPLACEMENT
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_CounterBump, W("OSR_CounterBump"), 1000, "Counter reload value when a patchpoint is hit")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_HitLimit, W("OSR_HitLimit"), 10, "Number of times a patchpoint must call back to trigger an OSR transition")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_ReoptimizeLimit, W("OSR_ReoptimizeLimit"), 100, "Number of transitions through an OSR method after which it is jitted again with the profile data collected since, 0 to disable")
 CONFIG_DWORD_INFO(INTERNAL_OSR_LowId, W("OSR_LowId"), (DWORD)-1, "Low end of enabled patchpoint range (inclusive)");
 CONFIG_DWORD_INFO(INTERNAL_OSR_HighId, W("OSR_HighId"), 10000000, "High end of enabled patchpoint range (inclusive)");
 #endif
@@ -605,6 +620,7 @@ CONFIG_DWORD_INFO(INTERNAL_OSR_HighId, W("OSR_HighId"), 10000000, "High end of e
 RETAIL_CONFIG_STRING_INFO(INTERNAL_PGODataPath, W("PGODataPath"), "Read/Write PGO data from/to the indicated file.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ReadPGOData, W("ReadPGOData"), 0, "Read PGO data")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_WritePGOData, W("WritePGOData"), 0, "Write PGO data")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_PGODataFormat, W("PGODataFormat"), 0, "Format of the PGO data file: 0 for text, 1 for binary")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TieredPGO, W("TieredPGO"), 1, "Instrument Tier0 code and make counts available to Tier1")
 
 // TieredPGO_InstrumentOnlyHotCode values:
@@ -619,6 +635,11 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TieredPGO_InstrumentedTierAlwaysOptimized,
 // If scalable counters are used, set the threshold for approximate counting.
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TieredPGO_ScalableCountThreshold, W("TieredPGO_ScalableCountThreshold"), 13, "Log2 threshold where counting becomes approximate")
 
+// If scalable counters are used, only update a counter on (on average) one out of every 2^N increments, adding 2^N
+// to it each time. This cuts the cost and contention of counting in instrumented code at the expense of accuracy
+// for rarely executed blocks and edges. 0 counts every increment until the threshold above is reached.
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TieredPGO_ScalableCountSampling, W("TieredPGO_ScalableCountSampling"), 0, "Log2 sampling interval for scalable counters")
+
 #endif
 
 ///
@@ -630,12 +651,15 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_BackpatchEntryPointSlots, W("BackpatchEntry
 /// TypeLoader
 ///
 CONFIG_DWORD_INFO(INTERNAL_TypeLoader_InjectInterfaceDuplicates, W("INTERNAL_TypeLoader_InjectInterfaceDuplicates"), 0, "Injects duplicates in interface map for all types.")
+RETAIL_CONFIG_STRING_INFO(INTERNAL_TypePreloadList, W("TypePreloadList"), "If set, a file listing types (\"Namespace.TypeName, AssemblyName\", one per line) to load on background threads when the entry assembly starts.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TypePreloadThreads, W("TypePreloadThreads"), 2, "Number of background threads used to load the types in TypePreloadList.")
 
 ///
 /// Virtual call stubs
 ///
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubCollideMonoPct, W("VirtualCallStubCollideMonoPct"), 0, "Used only when STUB_LOGGING is defined, which by default is not.")
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubCollideWritePct, W("VirtualCallStubCollideWritePct"), 100, "Used only when STUB_LOGGING is defined, which by default is not.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_VirtualCallStubDispatchChainLength, W("VirtualCallStubDispatchChainLength"), 3, "Maximum number of types an interface call site checks in chained dispatch stubs before it falls back to its resolve stub (1 to 4). 1 keeps call sites monomorphic.")
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubDumpLogCounter, W("VirtualCallStubDumpLogCounter"), 0, "Used only when STUB_LOGGING is defined, which by default is not.")
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubDumpLogIncr, W("VirtualCallStubDumpLogIncr"), 0, "Used only when STUB_LOGGING is defined, which by default is not.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_VirtualCallStubLogging, W("VirtualCallStubLogging"), 0, "Worth keeping, but should be moved into \"#ifdef STUB_LOGGING\" blocks. This goes for most (or all) of the stub logging infrastructure.")
@@ -664,6 +688,7 @@ RETAIL_CONFIG_STRING_INFO(INTERNAL_NativeImageSearchPaths, W("NativeImageSearchP
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ReadyToRun, W("ReadyToRun"), 1, "Enable/disable use of ReadyToRun native code") // On by default for CoreCLR
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_ReadyToRunExcludeList, W("ReadyToRunExcludeList"), "List of assemblies that cannot use Ready to Run images")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_ReadyToRunLogFile, W("ReadyToRunLogFile"), "Name of file to log success/failure of using Ready to Run images")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ReadyToRun_PrefetchCodeSize, W("ReadyToRun_PrefetchCodeSize"), 0, "KB of code at the start of a ReadyToRun image to read ahead when the image is loaded, along with its method lookup tables. Meant for images compiled with methods in first-access order. 0 disables.")
 
 #if defined(FEATURE_EVENT_TRACE) || defined(FEATURE_EVENTSOURCE_XPLAT)
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_EnableEventLog, W("EnableEventLog"), 0, "Enable/disable use of EnableEventLogging mechanism ") // Off by default
@@ -676,6 +701,7 @@ RETAIL_CONFIG_STRING_INFO(INTERNAL_EventNameFilter, W("EventNameFilter"), "")
 ///
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_InteropValidatePinnedObjects, W("InteropValidatePinnedObjects"), 0, "After returning from a managed-to-unmanaged interop call, validate GC heap around objects pinned by IL stubs.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_InteropLogArguments, W("InteropLogArguments"), 0, "Log all pinned arguments passed to an interop call")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ShareILStubsAcrossLoaderAllocators, W("ShareILStubsAcrossLoaderAllocators"), 1, "Cache shared IL stubs of collectible assemblies in CoreLib when their signature only uses non-collectible types.")
 RETAIL_CONFIG_STRING_INFO(UNSUPPORTED_LogCCWRefCountChange, W("LogCCWRefCountChange"), "Outputs debug information and calls LogCCWRefCountChange_BREAKPOINT when AddRef or Release is called on a CCW.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EnableRCWCleanupOnSTAShutdown, W("EnableRCWCleanupOnSTAShutdown"), 0, "Performs RCW cleanup when STA shutdown is detected using IInitializeSpy in classic processes.")
 
@@ -691,6 +717,8 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeCircularMB, W("EventPipeCircularMB"),
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeProcNumbers, W("EventPipeProcNumbers"), 0, "Enable/disable capturing processor numbers in EventPipe event headers")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeOutputStreaming, W("EventPipeOutputStreaming"), 1, "Enable/disable streaming for trace file set in DOTNET_EventPipeOutputPath.  Non-zero values enable streaming.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeEnableStackwalk, W("EventPipeEnableStackwalk"), 1, "Set to 0 to disable collecting stacks for EventPipe events.")
+RETAIL_CONFIG_DWORD_INFO_EX(INTERNAL_EventPipeSampleIntervalMicroseconds, W("EventPipeSampleIntervalMicroseconds"), 1000, "The interval in microseconds between two ticks of the EventPipe sample profiler.", CLRConfig::LookupOptions::ParseIntegerAsBase10)
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeSampleCpuTimeOnly, W("EventPipeSampleCpuTimeOnly"), 0, "Set to 1 to only sample threads that consumed CPU time since the previous sample profiler tick.")
 
 //
 // UserEvents
@@ -826,6 +854,9 @@ CONFIG_DWORD_INFO(INTERNAL_CPUFeatures, W("CPUFeatures"), 0xFFFFFFFF, "")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_DisableConfigCache, W("DisableConfigCache"), 0, "Used to disable the \"probabilistic\" config cache, which walks through the appropriate config registry keys on init and probabilistically keeps track of which exist.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_DisableStackwalkCache, W("DisableStackwalkCache"), 0, "")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_DoubleArrayToLargeObjectHeap, W("DoubleArrayToLargeObjectHeap"), 0, "Controls double[] placement")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GenericDictionaryMinSlots, W("GenericDictionaryMinSlots"), 0, "Minimum number of slots in newly created generic dictionary layouts, for instance set from the layout sizes logged by a previous run")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_InterfaceMapHashThreshold, W("InterfaceMapHashThreshold"), 16, "Types with at least this many interfaces get a hashed index of their interface map for casting. 0 disables the index.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_MethodTableCacheLineAlign, W("MethodTableCacheLineAlign"), 0, "If set, MethodTables are allocated so that they start on a cache line boundary")
 CONFIG_STRING_INFO(INTERNAL_DumpOnClassLoad, W("DumpOnClassLoad"), "Dumps information about loaded class to log.")
 CONFIG_DWORD_INFO(INTERNAL_ExpandAllOnLoad, W("ExpandAllOnLoad"), 0, "")
 CONFIG_DWORD_INFO(INTERNAL_ForceRelocs, W("ForceRelocs"), 0, "")
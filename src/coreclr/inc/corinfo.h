@@ -1608,8 +1608,14 @@ struct CORINFO_THREAD_STATIC_BLOCKS_INFO
     uint32_t offsetOfMaxThreadStaticBlocks;
     uint32_t offsetOfThreadStaticBlocks;
     uint32_t offsetOfBaseOfThreadLocalData;
+    uint32_t offsetOfMaxCollectibleThreadStaticBlocks;
+    uint32_t offsetOfCollectibleThreadStaticBlocks;
 };
 
+// Set in the type index returned by getThreadLocalFieldInfo when the static block lives in the
+// collectible TLS array. Such an index is looked up through an object handle rather than directly.
+#define CORINFO_THREAD_STATIC_COLLECTIBLE_INDEX 0x01000000
+
 //----------------------------------------------------------------------------
 // getThreadLocalStaticInfo_NativeAOT and CORINFO_THREAD_STATIC_INFO_NATIVEAOT: The EE instructs the JIT about how to access a thread local field
 
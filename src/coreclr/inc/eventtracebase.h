@@ -749,11 +749,11 @@ namespace ETW
 #ifdef FEATURE_EVENT_TRACE
         static VOID SendThreadRundownEvent();
         static VOID SendGCRundownEvent();
-        static VOID IterateAppDomain(DWORD enumerationOptions);
+        static VOID IterateAppDomain(DWORD enumerationOptions, const MethodDescSet *pMethodFilter = NULL);
         static VOID IterateCollectibleLoaderAllocator(AssemblyLoaderAllocator *pLoaderAllocator, DWORD enumerationOptions);
         static VOID IterateAssembly(Assembly *pAssembly, DWORD enumerationOptions);
-        static VOID IterateModule(Module *pModule, DWORD enumerationOptions);
-        static VOID EnumerationHelper(Module *moduleFilter, DWORD enumerationOptions);
+        static VOID IterateModule(Module *pModule, DWORD enumerationOptions, const MethodDescSet *pMethodFilter = NULL);
+        static VOID EnumerationHelper(Module *moduleFilter, DWORD enumerationOptions, const MethodDescSet *pMethodFilter = NULL);
         static DWORD GetEnumerationOptionsFromRuntimeKeywords();
     public:
         typedef union _EnumerationStructs
@@ -794,13 +794,14 @@ namespace ETW
         static VOID ModuleRangeRundown();
         static VOID SendOneTimeRundownEvents();
         static VOID StartRundown();
-        static VOID EndRundown();
+        // pMethodFilter, when not NULL, limits the method events to the methods in the set.
+        static VOID EndRundown(const MethodDescSet *pMethodFilter = NULL);
         static VOID EnumerateForCaptureState();
 #else
     public:
         static VOID ProcessShutdown() {};
         static VOID StartRundown() {};
-        static VOID EndRundown() {};
+        static VOID EndRundown(const MethodDescSet *pMethodFilter = NULL) {};
 #endif // FEATURE_EVENT_TRACE
     };
 
@@ -902,7 +903,7 @@ namespace ETW
     {
         friend class ETW::EnumerationLog;
 #ifdef FEATURE_EVENT_TRACE
-        static VOID SendEventsForJitMethods(BOOL getCodeVersionIds, LoaderAllocator *pLoaderAllocatorFilter, DWORD dwEventOptions);
+        static VOID SendEventsForJitMethods(BOOL getCodeVersionIds, LoaderAllocator *pLoaderAllocatorFilter, DWORD dwEventOptions, const MethodDescSet *pMethodFilter = NULL);
         static VOID SendEventsForJitMethodsHelper(
             LoaderAllocator *pLoaderAllocatorFilter,
             DWORD dwEventOptions,
@@ -911,8 +912,9 @@ namespace ETW
             BOOL fSendMethodEvent,
             BOOL fSendILToNativeMapEvent,
             BOOL fSendRichDebugInfoEvent,
-            BOOL fGetCodeIds);
-        static VOID SendEventsForNgenMethods(Module *pModule, DWORD dwEventOptions);
+            BOOL fGetCodeIds,
+            const MethodDescSet *pMethodFilter);
+        static VOID SendEventsForNgenMethods(Module *pModule, DWORD dwEventOptions, const MethodDescSet *pMethodFilter = NULL);
         static VOID SendMethodJitStartEvent(MethodDesc *pMethodDesc, COR_ILMETHOD_DECODER* methodDecoder, SString *namespaceOrClassName=NULL, SString *methodName=NULL, SString *methodSignature=NULL);
         static VOID SendMethodILToNativeMapEvent(MethodDesc * pMethodDesc, DWORD dwEventOptions, PCODE pNativeCodeStartAddress, DWORD nativeCodeId, ReJITID ilCodeId);
         static VOID SendMethodRichDebugInfo(MethodDesc * pMethodDesc, PCODE pNativeCodeStartAddress, DWORD nativeCodeId, ReJITID ilCodeId, MethodDescSet* sentMethodDetailsSet);
@@ -1119,7 +1121,7 @@ namespace ETW
     public:
 #ifdef FEATURE_EVENT_TRACE
         static VOID ExceptionThrown(CrawlFrame  *pCf, BOOL bIsReThrownException, BOOL bIsNewException);
-        static VOID ExceptionThrownEnd();
+        static VOID ExceptionThrownEnd(UINT32 framesUnwound = 0, double firstPassTimeNs = 0, double secondPassTimeNs = 0);
         static VOID ExceptionCatchBegin(MethodDesc * pMethodDesc, PVOID pEntryEIP);
         static VOID ExceptionCatchEnd();
         static VOID ExceptionFinallyBegin(MethodDesc * pMethodDesc, PVOID pEntryEIP);
@@ -1129,7 +1131,7 @@ namespace ETW
 
 #else
         static VOID ExceptionThrown(CrawlFrame  *pCf, BOOL bIsReThrownException, BOOL bIsNewException) {};
-        static VOID ExceptionThrownEnd() {};
+        static VOID ExceptionThrownEnd(UINT32 framesUnwound = 0, double firstPassTimeNs = 0, double secondPassTimeNs = 0) {};
         static VOID ExceptionCatchBegin(MethodDesc * pMethodDesc, PVOID pEntryEIP) {};
         static VOID ExceptionCatchEnd() {};
         static VOID ExceptionFinallyBegin(MethodDesc * pMethodDesc, PVOID pEntryEIP) {};
@@ -117,6 +117,14 @@ private:
     // for platforms that don't use shared memory.
     size_t m_freeOffset = 0;
 
+    // Number of active write sessions (see ExecutableWriteSessionHolder)
+    LONG m_writeSessionCount = 0;
+
+    // Mapping statistics, updated under m_CriticalSection
+    uint64_t m_mapRWCallCount = 0;
+    uint64_t m_rwMappingsCreatedCount = 0;
+    uint64_t m_rwMappingsReleasedCount = 0;
+
 // Uncomment these to gather information to better choose caching parameters
 //#define VARIABLE_SIZED_CACHEDMAPPING_SIZE
 
@@ -257,11 +265,53 @@ public:
     // by one of the ReserveXXX methods.
     void Release(void* pRX);
 
+    // Hint the OS that the specified reserved range should be backed by large pages
+    // once it is committed. Returns false if the hint is not supported.
+    bool AdviseLargePages(void* pStart, size_t size);
+
     // Map the specified block of executable memory as RW
     void* MapRW(void* pRX, size_t size, CacheableMapping cacheMapping);
 
     // Unmap the RW mapping at the specified address
     void UnmapRW(void* pRW);
+
+    // While a write session is active, RW mappings created for a cache miss cover a window of up to
+    // WriteSessionMappingSize bytes around the requested range instead of just the pages containing it,
+    // so that a series of nearby code and stub writes can share a single cached mapping.
+    static const size_t WriteSessionMappingSize = 256 * 1024;
+
+    void BeginWriteSession();
+    void EndWriteSession();
+
+    struct MappingStatistics
+    {
+        // Number of MapRW calls
+        uint64_t MapRWCalls;
+        // Number of RW views created and released in the OS
+        uint64_t RWMappingsCreated;
+        uint64_t RWMappingsReleased;
+    };
+
+    void GetMappingStatistics(MappingStatistics* pStatistics);
+};
+
+// Holder for a write session of the ExecutableAllocator. Use it around code that writes to many
+// precodes, stubs or code blocks in a row.
+class ExecutableWriteSessionHolder
+{
+public:
+    ExecutableWriteSessionHolder()
+    {
+        ExecutableAllocator::Instance()->BeginWriteSession();
+    }
+
+    ~ExecutableWriteSessionHolder()
+    {
+        ExecutableAllocator::Instance()->EndWriteSession();
+    }
+
+    ExecutableWriteSessionHolder(const ExecutableWriteSessionHolder& other) = delete;
+    ExecutableWriteSessionHolder& operator=(const ExecutableWriteSessionHolder& other) = delete;
 };
 
 #define ExecutableWriterHolder ExecutableWriterHolderNoLog
@@ -23,6 +23,12 @@
 #define USE_GC_INFO_DECODER
 #endif
 
+// The tracked slots live at a given code offset are cached per thread by the runtime's
+// own decoder so that frames seen repeatedly in stack walks are not decoded every time.
+#if defined(USE_GC_INFO_DECODER) && !defined(DACCESS_COMPILE) && !defined(GCINFODECODER_NO_EE) && !defined(SOS_INCLUDE) && !defined(FEATURE_NATIVEAOT)
+#define GCINFODECODER_LIVE_SLOT_CACHE
+#endif
+
 #if !defined(GCINFODECODER_NO_EE)
 
 #include "eetwain.h"
@@ -566,6 +572,12 @@ public:
                 void *              hCallBack
                 );
 
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+    // Invalidates the live slot caches of all threads. Must be called whenever GC info
+    // may be freed, since its address is used as the cache key.
+    static void InvalidateLiveSlotCaches();
+#endif // GCINFODECODER_LIVE_SLOT_CACHE
+
     //------------------------------------------------------------------------
     // Miscellaneous method information
     //------------------------------------------------------------------------
@@ -632,6 +644,8 @@ private:
 
 #ifdef _DEBUG
     GcInfoDecoderFlags m_Flags;
+#endif
+#if defined(_DEBUG) || defined(GCINFODECODER_LIVE_SLOT_CACHE)
     PTR_CBYTE m_GcInfoAddress;
 #endif
     UINT32 m_Version;
@@ -43,11 +43,11 @@ typedef const GUID *LPCGUID;
 #define GUID_DEFINED
 #endif // !GUID_DEFINED
 
-constexpr GUID JITEEVersionIdentifier = { /* b75a5475-ff22-4078-9551-2024ce03d383 */
-    0xb75a5475,
-    0xff22,
-    0x4078,
-    {0x95, 0x51, 0x20, 0x24, 0xce, 0x03, 0xd3, 0x83}
+constexpr GUID JITEEVersionIdentifier = { /* bf61f5dd-c58c-47cc-b638-7479ebf6c874 */
+    0xbf61f5dd,
+    0xc58c,
+    0x47cc,
+    {0xb6, 0x38, 0x74, 0x79, 0xeb, 0xf6, 0xc8, 0x74}
   };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,6 +242,14 @@ private:
 
     LoaderHeapFreeBlock *m_pFirstFreeBlock;
 
+    // Bytes handed out by AllocMem and AllocAlignedMem that were not backed out, which includes the
+    // thread regions of a LoaderHeap
+    size_t              m_dwAllocatedBytes;
+
+    // Bytes carved into thread regions that were not returned to the free list, whether or not the
+    // threads have allocated from them yet
+    size_t              m_dwThreadRegionBytes;
+
     // This is used to hold on to a block of reserved memory provided to the
     // constructor. We do this instead of adding it as the first block because
     // that requires comitting the first page of the reserved block, and for
@@ -320,6 +328,23 @@ private:
     size_t GetBytesAvailCommittedRegion();
     size_t GetBytesAvailReservedRegion();
 
+public:
+    // The fragmentation and waste of the heap, as reported by the LoaderHeapStatistics event
+    struct Statistics
+    {
+        size_t ReservedBytes;
+        size_t CommittedBytes;
+        size_t AllocatedBytes;
+        size_t FreeListBytes;
+        size_t ThreadRegionBytes;
+    };
+
+protected:
+    void UnlockedGetStatistics(Statistics *pStats);
+
+private:
+    void UnlockedFireStatisticsEvent();
+
 protected:
     // number of bytes available in region
     size_t UnlockedGetReservedBytesFree()
@@ -408,6 +433,18 @@ protected:
 #endif
                                  );
 
+protected:
+    // Carves a thread region for LoaderHeap, and gives the unused end of the previous region of the thread
+    // back to the free list once the new one is allocated.
+    void *UnlockedAllocThreadRegion(size_t dwRegionSize
+                                   ,BYTE *pPrevAllocPtr
+                                   ,BYTE *pPrevEnd
+#ifdef _DEBUG
+                                   ,_In_ _In_z_ const char *szFile
+                                   ,int  lineNum
+#endif
+                                   );
+
 protected:
     // This frees memory allocated by UnlockAllocMem. It's given this horrible name to emphasize
     // that it's purpose is for error path leak prevention purposes. You shouldn't
@@ -472,6 +509,14 @@ class LoaderHeap : public UnlockedLoaderHeap, public ILoaderHeapBackout
 private:
     CRITSEC_COOKIE    m_CriticalSection;
 
+    // Set by EnableThreadRegions
+    BOOL              m_fThreadRegions;
+
+    // The allocations up to this size are served from the thread regions, which are carved from the
+    // heap ThreadRegionSize bytes at a time
+    static const size_t ThreadRegionMaxAllocSize = 256;
+    static const size_t ThreadRegionSize = 4096;
+
 #ifndef DACCESS_COMPILE
 public:
     LoaderHeap(DWORD dwReserveBlockSize,
@@ -489,7 +534,8 @@ public:
                            kind,
                            codePageGenerator,
                            dwGranularity),
-        m_CriticalSection(fUnlocked ? NULL : CreateLoaderHeapLock())
+        m_CriticalSection(fUnlocked ? NULL : CreateLoaderHeapLock()),
+        m_fThreadRegions(FALSE)
     {
         WRAPPER_NO_CONTRACT;
         m_fExplicitControl = FALSE;
@@ -513,12 +559,30 @@ public:
                            pRangeList,
                            kind,
                            codePageGenerator, dwGranularity),
-        m_CriticalSection(fUnlocked ? NULL : CreateLoaderHeapLock())
+        m_CriticalSection(fUnlocked ? NULL : CreateLoaderHeapLock()),
+        m_fThreadRegions(FALSE)
     {
         WRAPPER_NO_CONTRACT;
         m_fExplicitControl = FALSE;
     }
 
+    // Lets each thread serve the small allocations it makes from this heap out of a region of the heap
+    // reserved for it, without taking the lock. The regions cost up to ThreadRegionSize bytes per
+    // thread that allocates from the heap, so this is meant for the heaps that take most of the small
+    // allocations of the loader.
+    void EnableThreadRegions();
+
+private:
+    void *AllocMemFromThreadRegion(size_t dwSize
+#ifdef _DEBUG
+                                   ,_In_ _In_z_ const char *szFile
+                                   ,int  lineNum
+#endif
+                                   );
+
+    static void InvalidateThreadRegions();
+
+public:
 #endif // DACCESS_COMPILE
 
     virtual ~LoaderHeap()
@@ -526,6 +590,11 @@ public:
         WRAPPER_NO_CONTRACT;
 
 #ifndef DACCESS_COMPILE
+        if (m_fThreadRegions)
+        {
+            InvalidateThreadRegions();
+        }
+
         if (m_CriticalSection != NULL)
         {
             ClrDeleteCriticalSection(m_CriticalSection);
@@ -595,16 +664,19 @@ private:
     {
         WRAPPER_NO_CONTRACT;
 
-        void *pResult;
+        void *pResult = NULL;
         TaggedMemAllocPtr tmap;
 
-        CRITSEC_Holder csh(m_CriticalSection);
-        pResult = UnlockedAllocMem(dwSize
-#ifdef _DEBUG
-                                 , szFile
-                                 , lineNum
-#endif
-                                 );
+        if (m_fThreadRegions && dwSize != 0 && dwSize <= ThreadRegionMaxAllocSize)
+        {
+            pResult = AllocMemFromThreadRegion(dwSize COMMA_INDEBUG(szFile) COMMA_INDEBUG(lineNum));
+        }
+
+        if (pResult == NULL)
+        {
+            CRITSEC_Holder csh(m_CriticalSection);
+            pResult = UnlockedAllocMem(dwSize COMMA_INDEBUG(szFile) COMMA_INDEBUG(lineNum));
+        }
         tmap.m_pMem             = pResult;
         tmap.m_dwRequestedSize  = dwSize;
         tmap.m_pHeap            = this;
@@ -626,17 +698,19 @@ private:
     {
         WRAPPER_NO_CONTRACT;
 
-        void *pResult;
+        void *pResult = NULL;
         TaggedMemAllocPtr tmap;
 
-        CRITSEC_Holder csh(m_CriticalSection);
+        if (m_fThreadRegions && dwSize != 0 && dwSize <= ThreadRegionMaxAllocSize)
+        {
+            pResult = AllocMemFromThreadRegion(dwSize COMMA_INDEBUG(szFile) COMMA_INDEBUG(lineNum));
+        }
 
-        pResult = UnlockedAllocMem_NoThrow(dwSize
-#ifdef _DEBUG
-                                           , szFile
-                                           , lineNum
-#endif
-                                           );
+        if (pResult == NULL)
+        {
+            CRITSEC_Holder csh(m_CriticalSection);
+            pResult = UnlockedAllocMem_NoThrow(dwSize COMMA_INDEBUG(szFile) COMMA_INDEBUG(lineNum));
+        }
 
         tmap.m_pMem             = pResult;
         tmap.m_dwRequestedSize  = dwSize;
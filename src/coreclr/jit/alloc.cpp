@@ -38,6 +38,38 @@ size_t ArenaAllocator::getDefaultPageSize()
     return DEFAULT_PAGE_SIZE;
 }
 
+thread_local ArenaAllocator::PagePool ArenaAllocator::s_pagePool;
+
+//------------------------------------------------------------------------
+// ArenaAllocator::PagePool::~PagePool:
+//    Returns the pooled pages to the host when the thread exits.
+ArenaAllocator::PagePool::~PagePool()
+{
+    release();
+}
+
+//------------------------------------------------------------------------
+// ArenaAllocator::PagePool::release:
+//    Returns all of the pooled pages to the host.
+void ArenaAllocator::PagePool::release()
+{
+    for (PageDescriptor* next; m_pages != nullptr; m_pages = next)
+    {
+        next = m_pages->m_next;
+        freeHostMemory(m_pages, m_pages->m_pageBytes);
+    }
+
+    m_count = 0;
+}
+
+//------------------------------------------------------------------------
+// ArenaAllocator::releasePagePool:
+//    Returns the pages pooled by the current thread to the host.
+void ArenaAllocator::releasePagePool()
+{
+    s_pagePool.release();
+}
+
 //------------------------------------------------------------------------
 // ArenaAllocator::ArenaAllocator:
 //    Default-constructs an arena allocator.
@@ -46,6 +78,8 @@ ArenaAllocator::ArenaAllocator()
     , m_lastPage(nullptr)
     , m_nextFreeByte(nullptr)
     , m_lastFreeByte(nullptr)
+    , m_hostPageCount(0)
+    , m_pooledPageCount(0)
 {
 #if MEASURE_MEM_ALLOC
     memset(&m_stats, 0, sizeof(m_stats));
@@ -89,8 +123,21 @@ void* ArenaAllocator::allocateNewPage(size_t size)
         pageSize = roundUp(pageSize, DEFAULT_PAGE_SIZE);
     }
 
-    // Allocate the new page
-    PageDescriptor* newPage = static_cast<PageDescriptor*>(allocateHostMemory(pageSize, &pageSize));
+    // Allocate the new page, preferring one this thread kept from a previous compilation
+    PageDescriptor* newPage;
+    if ((pageSize == DEFAULT_PAGE_SIZE) && (s_pagePool.m_pages != nullptr))
+    {
+        newPage            = s_pagePool.m_pages;
+        s_pagePool.m_pages = newPage->m_next;
+        s_pagePool.m_count--;
+        pageSize = newPage->m_pageBytes;
+        m_pooledPageCount++;
+    }
+    else
+    {
+        newPage = static_cast<PageDescriptor*>(allocateHostMemory(pageSize, &pageSize));
+        m_hostPageCount++;
+    }
 
     // Append the new page to the end of the list
     newPage->m_next      = nullptr;
@@ -121,14 +168,30 @@ void* ArenaAllocator::allocateNewPage(size_t size)
 //------------------------------------------------------------------------
 // ArenaAllocator::destroy:
 //    Performs any necessary teardown for an `ArenaAllocator`.
+//
+// Notes:
+//    Up to `JitArenaPagePoolSize` default sized pages are kept in the
+//    current thread's page pool for the next compilation on this thread;
+//    the rest are given back to the host.
 void ArenaAllocator::destroy()
 {
     PageDescriptor* page = m_firstPage;
 
+    unsigned poolSize = bypassHostAllocator() ? 0 : (unsigned)JitConfig.JitArenaPagePoolSize();
+
     // Free all of the allocated pages
     for (PageDescriptor* next; page != nullptr; page = next)
     {
         next = page->m_next;
+
+        if ((page->m_pageBytes == DEFAULT_PAGE_SIZE) && (s_pagePool.m_count < poolSize))
+        {
+            page->m_next       = s_pagePool.m_pages;
+            s_pagePool.m_pages = page;
+            s_pagePool.m_count++;
+            continue;
+        }
+
         freeHostMemory(page, page->m_pageBytes);
     }
 
@@ -284,6 +347,18 @@ void ArenaAllocator::AggregateMemStats::Print(FILE* f)
     fprintf(f, "  allocateMemory   : %12llu (avg %7llu per method)\n", nraTotalSizeAlloc, nraTotalSizeAlloc / nMethods);
     fprintf(f, "  nraUsed    : %12llu (avg %7llu per method)\n", nraTotalSizeUsed, nraTotalSizeUsed / nMethods);
     PrintByKind(f);
+    PrintMaxByKind(f);
+}
+
+void ArenaAllocator::AggregateMemStats::PrintMaxByKind(FILE* f)
+{
+    fprintf(f, "\nMax alloc'd bytes by kind in one method:\n  %20s | %10s\n", "kind", "size");
+    fprintf(f, "  %20s-+-%10s\n", "--------------------", "----------");
+    for (int cmk = 0; cmk < CMK_Count; cmk++)
+    {
+        fprintf(f, "  %20s | %10llu\n", s_CompMemKindNames[cmk], allocSzMaxByKind[cmk]);
+    }
+    fprintf(f, "\n");
 }
 
 ArenaAllocator::MemStatsAllocator* ArenaAllocator::getMemStatsAllocator(CompMemKind kind)
@@ -42,6 +42,20 @@ private:
         DEFAULT_PAGE_SIZE = 0x10000,
     };
 
+    // Default sized pages that a thread keeps around between compilations so
+    // that back to back compilations don't have to go back to the host for
+    // every page. See ArenaAllocator::destroy.
+    struct PagePool
+    {
+        PageDescriptor* m_pages;
+        unsigned        m_count;
+
+        ~PagePool();
+        void release();
+    };
+
+    static thread_local PagePool s_pagePool;
+
     PageDescriptor* m_firstPage;
     PageDescriptor* m_lastPage;
 
@@ -49,6 +63,10 @@ private:
     BYTE* m_nextFreeByte;
     BYTE* m_lastFreeByte;
 
+    // # of pages this allocator got from the host and from the thread's page pool.
+    unsigned m_hostPageCount;
+    unsigned m_pooledPageCount;
+
     void* allocateNewPage(size_t size);
 
     static void* allocateHostMemory(size_t size, size_t* pActualSize);
@@ -84,6 +102,7 @@ private:
     struct AggregateMemStats : public MemStats
     {
         unsigned nMethods;
+        UINT64   allocSzMaxByKind[CMK_Count]; // Most bytes of each kind allocated by a single method.
 
         void Add(const MemStats& ms)
         {
@@ -94,12 +113,14 @@ private:
             for (int i = 0; i < CMK_Count; i++)
             {
                 allocSzByKind[i] += ms.allocSzByKind[i];
+                allocSzMaxByKind[i] = max(allocSzMaxByKind[i], ms.allocSzByKind[i]);
             }
             nraTotalSizeAlloc += ms.nraTotalSizeAlloc;
             nraTotalSizeUsed += ms.nraTotalSizeUsed;
         }
 
-        void Print(FILE* f); // Print these stats to file.
+        void Print(FILE* f);          // Print these stats to file.
+        void PrintMaxByKind(FILE* f); // Print the per method high-water mark of each kind.
     };
 
 public:
@@ -148,8 +169,19 @@ public:
     size_t getTotalBytesAllocated();
     size_t getTotalBytesUsed();
 
+    unsigned getHostPageCount() const
+    {
+        return m_hostPageCount;
+    }
+
+    unsigned getPooledPageCount() const
+    {
+        return m_pooledPageCount;
+    }
+
     static bool   bypassHostAllocator();
     static size_t getDefaultPageSize();
+    static void   releasePagePool();
 };
 
 //------------------------------------------------------------------------
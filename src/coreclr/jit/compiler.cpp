@@ -4496,6 +4496,14 @@ void Compiler::EndPhase(Phases phase)
     {
         pCompJitTimer->EndPhase(this, phase);
     }
+
+    // Let the host attribute the cost of the phase, e.g. for SuperPMI's per-phase throughput.
+    // Work done by inlinees is reported as part of the root's phase that invoked the inliner.
+    if ((JitConfig.JitReportPhaseEnds() != 0) && (impInlineRoot() == this))
+    {
+        const char* phaseName = PhaseNames[phase];
+        info.compCompHnd->reportMetadata("PhaseEnd", phaseName, strlen(phaseName));
+    }
 #endif
 
     mostRecentlyActivePhase = phase;
@@ -4961,6 +4969,7 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
         bool doOptimizeIVs             = true;
         bool doBranchOpt               = true;
         bool doCse                     = true;
+        bool doPre                     = true;
         bool doAssertionProp           = true;
         bool doVNBasedIntrinExpansion  = true;
         bool doRangeAnalysis           = true;
@@ -4974,6 +4983,7 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
         doCopyProp                = doValueNum && (JitConfig.JitDoCopyProp() != 0);
         doBranchOpt               = doValueNum && (JitConfig.JitDoRedundantBranchOpts() != 0);
         doCse                     = doValueNum;
+        doPre                     = doValueNum && (JitConfig.JitDoPartialRedundancyElim() != 0);
         doAssertionProp           = doValueNum && (JitConfig.JitDoAssertionProp() != 0);
         doRangeAnalysis           = doAssertionProp && (JitConfig.JitDoRangeAnalysis() != 0);
         doOptimizeIVs             = doAssertionProp && (JitConfig.JitDoOptimizeIVs() != 0);
@@ -4981,6 +4991,33 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
         doVNBasedIntrinExpansion  = doValueNum;
 #endif // defined(OPT_CONFIG)
 
+        // Dynamic methods and IL stubs are typically jitted once and are often
+        // tiny marshalling or forwarding shims, so when they have no loops the
+        // SSA-based optimizer costs more throughput than it gains in code quality.
+        //
+        if (doSsa && !fgMightHaveNaturalLoops &&
+            (info.compILCodeSize <= (unsigned)JitConfig.JitDynamicMethodFastOptILSize()) &&
+            (opts.jitFlags->IsSet(JitFlags::JIT_FLAG_IL_STUB) ||
+             (info.compCompHnd->getMethodDefFromMethod(info.compMethodHnd) == mdMethodDefNil)))
+        {
+            JITDUMP("Skipping SSA-based optimizations for small loop-free dynamic method\n");
+            Metrics.SsaOptsSkippedForDynamicMethod = 1;
+
+            doSsa                     = false;
+            doEarlyProp               = false;
+            doValueNum                = false;
+            doLoopHoisting            = false;
+            doCopyProp                = false;
+            doOptimizeIVs             = false;
+            doBranchOpt               = false;
+            doCse                     = false;
+            doPre                     = false;
+            doAssertionProp           = false;
+            doVNBasedIntrinExpansion  = false;
+            doRangeAnalysis           = false;
+            doVNBasedDeadStoreRemoval = false;
+        }
+
         if (opts.optRepeat)
         {
             opts.optRepeatActive = true;
@@ -5051,6 +5088,13 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
                 fgInvalidateDfsTree();
             }
 
+            if (doPre)
+            {
+                // Make partially redundant expressions fully redundant
+                //
+                DoPhase(this, PHASE_OPTIMIZE_PRE, &Compiler::optPartialRedundancyElimination);
+            }
+
             if (doCse)
             {
                 // Remove common sub-expressions
@@ -5257,6 +5301,12 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
             auto lateLayoutPhase = [this] {
                 fgDoReversePostOrderLayout();
                 fgMoveColdBlocks();
+
+                if (JitConfig.JitDoThreeOptLayout())
+                {
+                    fgSearchImprovedLayout();
+                }
+
                 return PhaseStatus::MODIFIED_EVERYTHING;
             };
 
@@ -5271,6 +5321,8 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
 
         // Now that the flowgraph is finalized, run post-layout optimizations.
         DoPhase(this, PHASE_OPTIMIZE_POST_LAYOUT, &Compiler::optOptimizePostLayout);
+
+        fgComputeFallThroughRatio();
     }
 
 #if FEATURE_LOOP_ALIGN
@@ -6512,6 +6564,9 @@ void Compiler::compCompileFinish()
     genMethodCnt++;
 #endif
 
+    Metrics.ArenaHostPages   = (int)compArenaAllocator->getHostPageCount();
+    Metrics.ArenaPooledPages = (int)compArenaAllocator->getPooledPageCount();
+
 #if MEASURE_MEM_ALLOC
     {
         compArenaAllocator->finishMemStats();
@@ -4630,6 +4630,7 @@ protected:
     GenTree* impExpandHalfConstEqualsSIMD(
         GenTreeLclVarCommon* data, WCHAR* cns, int len, int dataOffset, StringComparison cmpMode);
     GenTreeStrCon* impGetStrConFromSpan(GenTree* span);
+    GenTree*       impExpandSequenceEqualVariableLength(GenTreeCall* call);
 
     GenTree* impIntrinsic(CORINFO_CLASS_HANDLE    clsHnd,
                           CORINFO_METHOD_HANDLE   method,
@@ -6257,12 +6258,15 @@ public:
     bool fgReorderBlocks(bool useProfile);
     void fgDoReversePostOrderLayout();
     void fgMoveColdBlocks();
+    bool fgSearchImprovedLayout();
+    void fgComputeFallThroughRatio();
 
     template <bool hasEH>
     void fgMoveHotJumps();
 
     bool fgFuncletsAreCold();
 
+    bool        fgIsColdForSplitting(BasicBlock* block);
     PhaseStatus fgDetermineFirstColdBlock();
 
     bool fgIsForwardBranch(BasicBlock* bJump, BasicBlock* bDest, BasicBlock* bSrc = nullptr);
@@ -7340,6 +7344,8 @@ protected:
 
     void optOptimizeCSEs();
 
+    PhaseStatus optPartialRedundancyElimination();
+
 public:
     // VN based copy propagation.
 
@@ -7438,6 +7444,7 @@ public:
 #define OMF_HAS_SPECIAL_INTRINSICS             0x00020000 // Method contains special intrinsics expanded in late phases
 #define OMF_HAS_RECURSIVE_TAILCALL             0x00040000 // Method contains recursive tail call
 #define OMF_HAS_EXPANDABLE_CAST                0x00080000 // Method contains casts eligible for late expansion
+#define OMF_HAS_SPANREF                        0x00100000 // Method contains Span<T> element loads or stores.
 
     // clang-format on
 
@@ -7536,6 +7543,8 @@ public:
                  int*                   candidatesCount,
                  unsigned*              likelihoods);
 
+    int pickGDVChainLength(bool isInterface, const unsigned* likelihoods, int candidatesCount);
+
     void considerGuardedDevirtualization(GenTreeCall*            call,
                                          IL_OFFSET               ilOffset,
                                          bool                    isInterface,
@@ -7575,6 +7584,19 @@ public:
         return min(MAX_GDV_TYPE_CHECKS, typeChecks);
     }
 
+    // Max number of guesses for a virtual or interface call when the guard chain
+    // is sized by the cost model in pickGDVChainLength.
+    int getGDVMaxChainTypeChecks()
+    {
+        if ((JitConfig.JitGuardedDevirtualizationMaxTypeChecks() >= 0) ||
+            opts.jitFlags->IsSet(JitFlags::JIT_FLAG_SIZE_OPT))
+        {
+            return getGDVMaxTypeChecks();
+        }
+
+        return min(MAX_GDV_TYPE_CHECKS, 4);
+    }
+
     bool doesMethodHaveExpRuntimeLookup()
     {
         return (optMethodFlags & OMF_HAS_EXPRUNTIMELOOKUP) != 0;
@@ -7700,6 +7722,10 @@ public:
     bool optRemoveUnusedIVs(FlowGraphNaturalLoop* loop, LoopLocalOccurrences* loopLocals);
     bool optIsUpdateOfIVWithoutSideEffects(GenTree* tree, unsigned lclNum);
 
+#if defined(FEATURE_HW_INTRINSICS) && (defined(TARGET_XARCH) || defined(TARGET_ARM64))
+    bool optIsLoopVectorizationCandidate(ScalarEvolutionContext& scevContext, FlowGraphNaturalLoop* loop);
+#endif
+
     // Redundant branch opts
     //
     PhaseStatus   optRedundantBranches();
@@ -8188,6 +8214,9 @@ public:
     bool optExtractArrIndex(GenTree* tree, ArrIndex* result, unsigned lhsNum, bool* topLevelIsFinal);
     bool optReconstructArrIndexHelp(GenTree* tree, ArrIndex* result, unsigned lhsNum, bool* topLevelIsFinal);
     bool optReconstructArrIndex(GenTree* tree, ArrIndex* result);
+    bool optExtractSpanIndex(GenTree* tree, unsigned iterVar, unsigned* pLenLcl);
+    bool optExtractMdArrayIndex(
+        GenTree* tree, unsigned iterVar, GenTree** pBndsChk, unsigned* pArrLcl, unsigned* pDim, unsigned* pRank);
     bool optIdentifyLoopOptInfo(FlowGraphNaturalLoop* loop, LoopCloneContext* context);
     static fgWalkPreFn optCanOptimizeByLoopCloningVisitor;
     fgWalkResult       optCanOptimizeByLoopCloning(GenTree* tree, LoopCloneVisitorInfo* info);
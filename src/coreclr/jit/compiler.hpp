@@ -5149,6 +5149,46 @@ BasicBlockVisit FlowGraphNaturalLoop::VisitRegularExitBlocks(TFunc func)
     return BasicBlockVisit::Continue;
 }
 
+//------------------------------------------------------------------------
+// optVisitBoundingExitingBlocks: Visit all the exiting BBJ_COND blocks of the
+// loop that dominate all the loop's backedges. These exiting blocks bound the
+// trip count of the loop.
+//
+// Parameters:
+//   loop - The loop
+//   func - The functor, of type void(BasicBlock*).
+//
+template <typename TFunctor>
+void Compiler::optVisitBoundingExitingCondBlocks(FlowGraphNaturalLoop* loop, TFunctor func)
+{
+    BasicBlock* dominates = nullptr;
+
+    for (FlowEdge* backEdge : loop->BackEdges())
+    {
+        if (dominates == nullptr)
+        {
+            dominates = backEdge->getSourceBlock();
+        }
+        else
+        {
+            dominates = m_domTree->Intersect(dominates, backEdge->getSourceBlock());
+        }
+    }
+
+    bool changed = false;
+    while ((dominates != nullptr) && loop->ContainsBlock(dominates))
+    {
+        if (dominates->KindIs(BBJ_COND) &&
+            (!loop->ContainsBlock(dominates->GetTrueTarget()) || !loop->ContainsBlock(dominates->GetFalseTarget())))
+        {
+            // 'dominates' is an exiting block that dominates all backedges.
+            func(dominates);
+        }
+
+        dominates = dominates->bbIDom;
+    }
+}
+
 /*****************************************************************************/
 #endif //_COMPILER_HPP_
 /*****************************************************************************/
@@ -162,6 +162,9 @@ void jitShutdown(bool processIsTerminating)
 
     Compiler::compShutdown();
 
+    // Pages pooled by other threads are returned when those threads exit.
+    ArenaAllocator::releasePagePool();
+
     FILE* file = s_jitstdout;
     if ((file != nullptr) && (file != procstdout()))
     {
@@ -4808,6 +4808,44 @@ void emitter::emitJumpDistBind()
 
     int jmp_iteration = 1;
 
+    // The jumps that may still get a smaller encoding, in jump list order. Only the first iteration walks
+    // the whole jump list, the later ones only walk these. The key of a jump is the distance by which it
+    // missed the smaller encoding plus 'totalShrinkage' at the start of the iteration that computed it.
+    // Since the distance cannot have shrunk by more than the code removed since then, an iteration skips
+    // the jumps whose key is larger than 'totalShrinkage + adjIG'.
+    struct PendingJump
+    {
+        instrDescJmp*  jmp;
+        UNATIVE_OFFSET key;
+    };
+
+    ArrayStack<PendingJump> pendingJumps(emitComp->getAllocator(CMK_Codegen));
+    UNATIVE_OFFSET          totalShrinkage = 0; // Code size removed by the completed iterations
+    UNATIVE_OFFSET          minSkippedKey;
+    int                     pendingRead;
+    int                     pendingWrite;
+
+    auto nextJump = [&](instrDescJmp* cur) -> instrDescJmp* {
+        if (jmp_iteration == 1)
+        {
+            return (cur == nullptr) ? emitJumpList : cur->idjNext;
+        }
+
+        return (pendingRead < pendingJumps.Height()) ? pendingJumps.Bottom(pendingRead++).jmp : nullptr;
+    };
+
+    auto keepPending = [&](instrDescJmp* pendingJmp, UNATIVE_OFFSET key) {
+        if (jmp_iteration == 1)
+        {
+            pendingJumps.Push({pendingJmp, key});
+        }
+        else
+        {
+            // Entries are only ever moved down, so the jumps stay in order
+            pendingJumps.BottomRef(pendingWrite++) = {pendingJmp, key};
+        }
+    };
+
     /*****************************************************************************/
     /* If we iterate to look for more jumps to shorten, we start again here.     */
     /*****************************************************************************/
@@ -4832,12 +4870,15 @@ AGAIN:
     adjLJ         = 0;
     adjIG         = 0;
     minShortExtra = (UNATIVE_OFFSET)-1;
+    minSkippedKey = (UNATIVE_OFFSET)-1;
+    pendingRead   = 0;
+    pendingWrite  = 0;
 
 #if defined(TARGET_ARM)
     minMediumExtra = (UNATIVE_OFFSET)-1;
 #endif // TARGET_ARM
 
-    for (jmp = emitJumpList; jmp; jmp = jmp->idjNext)
+    for (jmp = nextJump(nullptr); jmp; jmp = nextJump(jmp))
     {
         insGroup* jmpIG;
         insGroup* tgtIG;
@@ -5016,6 +5057,17 @@ AGAIN:
 
         jmp->idjOffs -= adjLJ;
 
+        if (jmp_iteration > 1)
+        {
+            UNATIVE_OFFSET key = pendingJumps.Bottom(pendingRead - 1).key;
+            if (key > totalShrinkage + adjIG)
+            {
+                keepPending(jmp, key);
+                minSkippedKey = min(minSkippedKey, key);
+                continue;
+            }
+        }
+
         // If this is a jump via register, the instruction size does not change, so we are done.
 
 #if defined(TARGET_ARM64)
@@ -5056,7 +5108,8 @@ AGAIN:
                 goto SHORT_JMP;
             }
 
-            // Keep the large form.
+            // Keep the large form, and look at it again in the next iteration since the code size shrinks
+            keepPending(jmp, 0);
             continue;
         }
 #endif
@@ -5361,6 +5414,13 @@ AGAIN:
          * Go try the next one.
          */
 
+#if defined(TARGET_ARM)
+        keepPending(jmp, (emitIsCondJump(jmp) ? min((UNATIVE_OFFSET)extra, (UNATIVE_OFFSET)mextra)
+                                              : (UNATIVE_OFFSET)extra) +
+                             totalShrinkage);
+#else
+        keepPending(jmp, (UNATIVE_OFFSET)extra + totalShrinkage);
+#endif
         continue;
 
         /*****************************************************************************/
@@ -5448,6 +5508,14 @@ AGAIN:
 #endif
         noway_assert((unsigned short)sizeDif == sizeDif);
 
+#if defined(TARGET_ARM)
+        // A medium jump may still become short
+        if (!jmp->idjShort)
+        {
+            keepPending(jmp, (UNATIVE_OFFSET)extra + totalShrinkage);
+        }
+#endif
+
         adjIG += sizeDif;
         adjLJ += sizeDif;
         jmpIG->igSize -= (unsigned short)sizeDif;
@@ -5459,6 +5527,11 @@ AGAIN:
 
     } // end for each jump
 
+    if (jmp_iteration > 1)
+    {
+        pendingJumps.Pop(pendingJumps.Height() - pendingWrite);
+    }
+
     /* Did we shorten any jumps? */
 
     if (adjIG)
@@ -5503,13 +5576,14 @@ AGAIN:
 #endif
 #endif
 
-        if ((minShortExtra <= adjIG)
+        if ((minShortExtra <= adjIG) || (minSkippedKey <= totalShrinkage + adjIG)
 #if defined(TARGET_ARM)
             || (minMediumExtra <= adjIG)
 #endif // TARGET_ARM
         )
         {
             jmp_iteration++;
+            totalShrinkage += adjIG;
 
 #ifdef DEBUG
             if (EMITVERBOSE)
@@ -5521,6 +5595,9 @@ AGAIN:
             goto AGAIN;
         }
     }
+
+    emitComp->Metrics.JumpDistBindIterations += jmp_iteration;
+
 #ifdef DEBUG
     if (EMIT_INSTLIST_VERBOSE)
     {
@@ -7921,13 +7998,84 @@ void emitter::emitDataGenData(unsigned index, BasicBlock* label)
 
 void emitter::emitDataGenEnd()
 {
+    assert(emitDataSecCur);
+
+    // The contents of the constant are complete, make it available to emitDataGenFind
+    if (emitDataSecCur->dsType == dataSection::data)
+    {
+        assert(emitDataSecCur == emitConsDsc.dsdLast);
+        emitDataGenIndex(emitDataSecCur, emitConsDsc.dsdOffs - emitDataSecCur->dsSize);
+    }
 
 #ifdef DEBUG
-    assert(emitDataSecCur);
     emitDataSecCur = nullptr;
 #endif
 }
 
+//---------------------------------------------------------------------------
+// emitDataPrefixKey:
+//   - Returns the key under which a constant with the given contents is
+//     found in the data section prefix map
+//
+// Arguments:
+//    data       - A pointer to the contents of the constant
+//    size       - The size in bytes of the constant
+//
+unsigned emitter::emitDataPrefixKey(const void* data, unsigned size)
+{
+    // FNV-1a, seeded with the size so that a constant and a zero extended copy of it get different keys
+    unsigned       hash  = 2166136261u ^ size;
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    for (unsigned i = 0; i < size; i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+
+    return hash;
+}
+
+//---------------------------------------------------------------------------
+// emitDataGenIndex:
+//   - Adds a completed 'data' section to the data section prefix map, under
+//     its power of 2 sized prefixes and its whole contents
+//
+// Arguments:
+//    secDesc    - The data section
+//    secOffs    - The offset of the data section
+//
+void emitter::emitDataGenIndex(dataSection* secDesc, UNATIVE_OFFSET secOffs)
+{
+    assert(secDesc->dsType == dataSection::data);
+
+    if (emitConsDsc.dsdPrefixMap == nullptr)
+    {
+        CompAllocator allocator   = emitComp->getAllocator(CMK_Codegen);
+        emitConsDsc.dsdPrefixMap = new (allocator) DataSectionPrefixMap(allocator);
+    }
+
+    auto addPrefix = [this, secDesc, secOffs](unsigned prefixSize) {
+        unsigned           key    = emitDataPrefixKey(secDesc->dsCont, prefixSize);
+        dataSectionPrefix* prefix = new (emitComp, CMK_Codegen) dataSectionPrefix;
+        prefix->dspSection        = secDesc;
+        prefix->dspOffs           = secOffs;
+        prefix->dspNext           = nullptr;
+
+        // Sections are chained from the last one added
+        emitConsDsc.dsdPrefixMap->Lookup(key, &prefix->dspNext);
+        emitConsDsc.dsdPrefixMap->Set(key, prefix, DataSectionPrefixMap::Overwrite);
+    };
+
+    for (unsigned prefixSize = dataSection::MIN_DATA_ALIGN;
+         (prefixSize < secDesc->dsSize) && (prefixSize <= dataSection::MAX_DATA_ALIGN); prefixSize *= 2)
+    {
+        addPrefix(prefixSize);
+    }
+
+    // The whole contents also cover the sizes that aren't a power of 2
+    addPrefix(secDesc->dsSize);
+}
+
 //---------------------------------------------------------------------------
 // emitDataGenFind:
 //   - Returns the offset of an existing constant in the data section
@@ -7941,47 +8089,62 @@ void emitter::emitDataGenEnd()
 //
 UNATIVE_OFFSET emitter::emitDataGenFind(const void* cnsAddr, unsigned cnsSize, unsigned alignment, var_types dataType)
 {
-    UNATIVE_OFFSET cnum     = INVALID_UNATIVE_OFFSET;
-    unsigned       cmpCount = 0;
-    unsigned       curOffs  = 0;
-    dataSection*   secDesc  = emitConsDsc.dsdList;
-    while (secDesc != nullptr)
-    {
-        // Search the existing secDesc entries
+    UNATIVE_OFFSET cnum    = INVALID_UNATIVE_OFFSET;
+    dataSection*   matched = nullptr;
 
-        // We can match as smaller 'cnsSize' value at the start of a larger 'secDesc->dsSize' block
-        // We match the bit pattern, so the dataType can be different
-        // Only match constants when the dsType is 'data'
-        //
-        if ((secDesc->dsType == dataSection::data) && (secDesc->dsSize >= cnsSize) && ((curOffs % alignment) == 0))
+    // We can match as smaller 'cnsSize' value at the start of a larger 'secDesc->dsSize' block
+    // We match the bit pattern, so the dataType can be different
+    // Only match constants when the dsType is 'data', which are the only ones indexed
+    //
+    dataSectionPrefix* prefix = nullptr;
+    if ((emitConsDsc.dsdPrefixMap != nullptr) &&
+        emitConsDsc.dsdPrefixMap->Lookup(emitDataPrefixKey(cnsAddr, cnsSize), &prefix))
+    {
+        // Prefer the first matching constant, as a linear search would
+        for (; prefix != nullptr; prefix = prefix->dspNext)
         {
-            if (memcmp(cnsAddr, secDesc->dsCont, cnsSize) == 0)
+            dataSection* secDesc = prefix->dspSection;
+            if ((secDesc->dsSize >= cnsSize) && ((prefix->dspOffs % alignment) == 0) && (prefix->dspOffs < cnum) &&
+                (memcmp(cnsAddr, secDesc->dsCont, cnsSize) == 0))
             {
-                cnum = curOffs;
+                cnum    = prefix->dspOffs;
+                matched = secDesc;
+            }
+        }
+    }
 
-                // We also might want to update the dsDataType
-                //
-                if ((secDesc->dsDataType != dataType) && (secDesc->dsSize == cnsSize))
-                {
-                    // If the subsequent dataType is floating point then change the original dsDataType
-                    //
-                    if (varTypeIsFloating(dataType))
-                    {
-                        secDesc->dsDataType = dataType;
-                    }
-                }
+    // Prefixes that aren't a power of 2, or are larger than MAX_DATA_ALIGN, of larger blocks
+    // aren't indexed, look for those in the first 64 constants to avoid an O(n^2) search cost
+    //
+    if ((matched == nullptr) && (!isPow2(cnsSize) || (cnsSize > dataSection::MAX_DATA_ALIGN)))
+    {
+        unsigned     cmpCount = 0;
+        unsigned     curOffs  = 0;
+        dataSection* secDesc  = emitConsDsc.dsdList;
+        while ((secDesc != nullptr) && (++cmpCount <= 64))
+        {
+            if ((secDesc->dsType == dataSection::data) && (secDesc->dsSize >= cnsSize) &&
+                ((curOffs % alignment) == 0) && (memcmp(cnsAddr, secDesc->dsCont, cnsSize) == 0))
+            {
+                cnum    = curOffs;
+                matched = secDesc;
                 break;
             }
-        }
 
-        curOffs += secDesc->dsSize;
-        secDesc = secDesc->dsNext;
+            curOffs += secDesc->dsSize;
+            secDesc = secDesc->dsNext;
+        }
+    }
 
-        if (++cmpCount > 64)
+    // We also might want to update the dsDataType
+    //
+    if ((matched != nullptr) && (matched->dsDataType != dataType) && (matched->dsSize == cnsSize))
+    {
+        // If the subsequent dataType is floating point then change the original dsDataType
+        //
+        if (varTypeIsFloating(dataType))
         {
-            // If we don't find a match in the first 64, then we just add the new constant
-            // This prevents an O(n^2) search cost
-            break;
+            matched->dsDataType = dataType;
         }
     }
 
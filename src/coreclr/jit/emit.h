@@ -3297,20 +3297,32 @@ public:
         BYTE dsCont[0];
     };
 
+    // A 'data' section indexed by the contents of one of its prefixes, see emitDataGenFind
+    struct dataSectionPrefix
+    {
+        dataSectionPrefix* dspNext;
+        dataSection*       dspSection;
+        UNATIVE_OFFSET     dspOffs;
+    };
+
+    typedef JitHashTable<unsigned, JitSmallPrimitiveKeyFuncs<unsigned>, dataSectionPrefix*> DataSectionPrefixMap;
+
     /* These describe the entire initialized/uninitialized data sections */
 
     struct dataSecDsc
     {
-        dataSection*   dsdList;
-        dataSection*   dsdLast;
-        UNATIVE_OFFSET dsdOffs;
-        UNATIVE_OFFSET alignment; // in bytes, defaults to 4
+        dataSection*          dsdList;
+        dataSection*          dsdLast;
+        UNATIVE_OFFSET        dsdOffs;
+        UNATIVE_OFFSET        alignment; // in bytes, defaults to 4
+        DataSectionPrefixMap* dsdPrefixMap;
 
         dataSecDsc()
             : dsdList(nullptr)
             , dsdLast(nullptr)
             , dsdOffs(0)
             , alignment(4)
+            , dsdPrefixMap(nullptr)
         {
         }
     };
@@ -3319,6 +3331,9 @@ public:
 
     dataSection* emitDataSecCur;
 
+    static unsigned emitDataPrefixKey(const void* data, unsigned size);
+    void            emitDataGenIndex(dataSection* secDesc, UNATIVE_OFFSET secOffs);
+
     void emitOutputDataSec(dataSecDsc* sec, BYTE* dst);
     void emitDispDataSec(dataSecDsc* section, BYTE* dst);
 
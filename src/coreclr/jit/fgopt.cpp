@@ -3349,6 +3349,11 @@ bool Compiler::fgReorderBlocks(bool useProfile)
             fgDoReversePostOrderLayout();
             fgMoveColdBlocks();
 
+            if (JitConfig.JitDoThreeOptLayout())
+            {
+                fgSearchImprovedLayout();
+            }
+
             // Renumber blocks to facilitate LSRA's order of block visitation
             // TODO: Consider removing this, and using traversal order in lSRA
             //
@@ -5111,6 +5116,295 @@ void Compiler::fgMoveColdBlocks()
     ehUpdateTryLasts<decltype(getTryLast), decltype(setTryLast)>(getTryLast, setTryLast);
 }
 
+//-----------------------------------------------------------------------------
+// fgSearchImprovedLayout: Try to improve the layout of the hot blocks with
+//   3-opt style swaps of adjacent segments.
+//
+// Returns:
+//   True if any blocks were moved.
+//
+// Notes:
+//   The hot section is the run of blocks starting at fgFirstBB up to the
+//   first rarely run block; fgMoveColdBlocks is expected to have pushed the
+//   cold blocks to the end already. The score of a layout is the total
+//   profile weight of the edges that become fall-throughs, so improving it
+//   reduces the taken branches on the hot path.
+//
+//   Edges are visited from hottest to coldest. An edge that is not a
+//   fall-through yet is turned into one by swapping two adjacent segments,
+//   picking the segment boundary that improves the score the most:
+//
+//     forward edge:   [.. src][src+1 .. dst-1][dst .. k][..] -> [.. src][dst .. k][src+1 .. dst-1][..]
+//     backward edge:  [.. dst-1][dst .. k][k+1 .. src][..]   -> [.. dst-1][k+1 .. src][dst .. k][..]
+//
+//   Methods with EH are left alone, since moving blocks across regions
+//   would require fixing up the EH table. The layout ordinal of each hot
+//   block is kept in bbPreorderNum, so any DFS tree is invalidated.
+//
+bool Compiler::fgSearchImprovedLayout()
+{
+#ifdef DEBUG
+    if (verbose)
+    {
+        printf("*************** In fgSearchImprovedLayout()\n");
+    }
+#endif // DEBUG
+
+    if (compHndBBtabCount != 0)
+    {
+        JITDUMP("Method has EH; skipping\n");
+        return false;
+    }
+
+    // Bound the quadratic search below.
+    const unsigned maxHotBlocks = 1000;
+    unsigned       numHotBlocks = 0;
+
+    for (BasicBlock* const block : Blocks())
+    {
+        if ((block->isRunRarely() && !block->IsFirst()) || (numHotBlocks == maxHotBlocks))
+        {
+            break;
+        }
+
+        numHotBlocks++;
+    }
+
+    if (numHotBlocks < 3)
+    {
+        JITDUMP("Not enough hot blocks; skipping\n");
+        return false;
+    }
+
+    fgInvalidateDfsTree();
+
+    BasicBlock** const order   = new (this, CMK_BasicBlock) BasicBlock*[numHotBlocks];
+    BasicBlock** const scratch = new (this, CMK_BasicBlock) BasicBlock*[numHotBlocks];
+    BasicBlock*        block   = fgFirstBB;
+
+    for (unsigned i = 0; i < numHotBlocks; i++, block = block->Next())
+    {
+        order[i]             = block;
+        block->bbPreorderNum = i;
+    }
+
+    // The block laid out right after the hot section, if any.
+    BasicBlock* const afterHot = block;
+
+    auto isHot = [=](BasicBlock* b) {
+        return (b->bbPreorderNum < numHotBlocks) && (order[b->bbPreorderNum] == b);
+    };
+
+    auto blockAt = [=](unsigned pos) {
+        return (pos < numHotBlocks) ? order[pos] : afterHot;
+    };
+
+    // Weight saved by laying out 'dst' right after 'src'.
+    auto fallThroughWeight = [this](BasicBlock* src, BasicBlock* dst) -> weight_t {
+        if ((dst == nullptr) || !src->KindIs(BBJ_ALWAYS, BBJ_COND))
+        {
+            return BB_ZERO_WEIGHT;
+        }
+
+        FlowEdge* const edge = fgGetPredForBlock(dst, src);
+        return (edge != nullptr) ? edge->getLikelyWeight() : BB_ZERO_WEIGHT;
+    };
+
+    // Score change of swapping [i .. j] with [j+1 .. k], where 0 < i <= j < k.
+    auto swapGain = [=](unsigned i, unsigned j, unsigned k) {
+        BasicBlock* const beforeI = order[i - 1];
+        BasicBlock* const afterK  = blockAt(k + 1);
+
+        const weight_t oldWeight = fallThroughWeight(beforeI, order[i]) + fallThroughWeight(order[j], order[j + 1]) +
+                                   fallThroughWeight(order[k], afterK);
+        const weight_t newWeight = fallThroughWeight(beforeI, order[j + 1]) + fallThroughWeight(order[k], order[i]) +
+                                   fallThroughWeight(order[j], afterK);
+
+        return newWeight - oldWeight;
+    };
+
+    ArrayStack<FlowEdge*> edges(getAllocator(CMK_ArrayStack));
+    for (unsigned i = 0; i < numHotBlocks; i++)
+    {
+        BasicBlock* const src = order[i];
+        if (!src->KindIs(BBJ_ALWAYS, BBJ_COND))
+        {
+            continue;
+        }
+
+        for (FlowEdge* const edge : src->SuccEdges())
+        {
+            BasicBlock* const dst = edge->getDestinationBlock();
+            if ((dst != src) && !dst->IsFirst() && isHot(dst) && (edge->getLikelyWeight() > BB_ZERO_WEIGHT))
+            {
+                edges.Push(edge);
+            }
+        }
+    }
+
+    jitstd::sort(edges.Data(), edges.Data() + edges.Height(), [](FlowEdge* e1, FlowEdge* e2) {
+        return e1->getLikelyWeight() > e2->getLikelyWeight();
+    });
+
+    const unsigned maxPasses = 2;
+    bool           modified  = false;
+
+    for (unsigned pass = 0; pass < maxPasses; pass++)
+    {
+        bool improved = false;
+
+        for (int e = 0; e < edges.Height(); e++)
+        {
+            FlowEdge* const edge   = edges.Bottom(e);
+            const unsigned  srcPos = edge->getSourceBlock()->bbPreorderNum;
+            const unsigned  dstPos = edge->getDestinationBlock()->bbPreorderNum;
+
+            if (dstPos == (srcPos + 1))
+            {
+                continue;
+            }
+
+            weight_t bestGain = BB_ZERO_WEIGHT;
+            unsigned bestI    = 0;
+            unsigned bestJ    = 0;
+            unsigned bestK    = 0;
+
+            if (dstPos > srcPos)
+            {
+                const unsigned i = srcPos + 1;
+                const unsigned j = dstPos - 1;
+                for (unsigned k = dstPos; k < numHotBlocks; k++)
+                {
+                    const weight_t gain = swapGain(i, j, k);
+                    if (gain > bestGain)
+                    {
+                        bestGain = gain;
+                        bestI    = i;
+                        bestJ    = j;
+                        bestK    = k;
+                    }
+                }
+            }
+            else
+            {
+                const unsigned i = dstPos;
+                const unsigned k = srcPos;
+                for (unsigned j = dstPos; j < srcPos; j++)
+                {
+                    const weight_t gain = swapGain(i, j, k);
+                    if (gain > bestGain)
+                    {
+                        bestGain = gain;
+                        bestI    = i;
+                        bestJ    = j;
+                        bestK    = k;
+                    }
+                }
+            }
+
+            // Ignore changes that are lost in the noise of the profile.
+            if ((bestI == 0) || (bestGain <= (edge->getLikelyWeight() * 0.001)))
+            {
+                continue;
+            }
+
+            JITDUMP("Swapping [" FMT_BB " .. " FMT_BB "] with [" FMT_BB " .. " FMT_BB "] for a gain of %f\n",
+                    order[bestI]->bbNum, order[bestJ]->bbNum, order[bestJ + 1]->bbNum, order[bestK]->bbNum,
+                    bestGain);
+
+            unsigned next = 0;
+            for (unsigned p = bestJ + 1; p <= bestK; p++)
+            {
+                scratch[next++] = order[p];
+            }
+
+            for (unsigned p = bestI; p <= bestJ; p++)
+            {
+                scratch[next++] = order[p];
+            }
+
+            for (unsigned p = 0; p < next; p++)
+            {
+                order[bestI + p]                = scratch[p];
+                order[bestI + p]->bbPreorderNum = bestI + p;
+            }
+
+            improved = true;
+        }
+
+        if (!improved)
+        {
+            break;
+        }
+
+        modified = true;
+    }
+
+    if (!modified)
+    {
+        JITDUMP("No improved layout found\n");
+        return false;
+    }
+
+    // The first block stays put, and every hot block is moved right after
+    // its new predecessor in the layout.
+    for (unsigned i = 1; i < numHotBlocks; i++)
+    {
+        if (!order[i - 1]->NextIs(order[i]))
+        {
+            fgUnlinkBlock(order[i]);
+            fgInsertBBafter(order[i - 1], order[i]);
+        }
+    }
+
+#ifdef DEBUG
+    if (verbose)
+    {
+        printf("\nAfter fgSearchImprovedLayout");
+        fgDispBasicBlocks(verboseTrees);
+        printf("\n");
+    }
+#endif // DEBUG
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// fgComputeFallThroughRatio: Estimate how much of the profiled control flow
+//   out of the blocks falls through in the final layout, and report it as the
+//   FallThroughRatio metric.
+//
+void Compiler::fgComputeFallThroughRatio()
+{
+    weight_t totalWeight       = BB_ZERO_WEIGHT;
+    weight_t fallThroughWeight = BB_ZERO_WEIGHT;
+
+    for (BasicBlock* const block : Blocks())
+    {
+        if (!block->KindIs(BBJ_ALWAYS, BBJ_COND))
+        {
+            continue;
+        }
+
+        for (FlowEdge* const edge : block->SuccEdges())
+        {
+            const weight_t weight = edge->getLikelyWeight();
+            totalWeight += weight;
+
+            if (block->NextIs(edge->getDestinationBlock()))
+            {
+                fallThroughWeight += weight;
+            }
+        }
+    }
+
+    if (totalWeight > BB_ZERO_WEIGHT)
+    {
+        Metrics.FallThroughRatio = fallThroughWeight / totalWeight;
+        JITDUMP("Estimated fall-through ratio of the layout: %f\n", Metrics.FallThroughRatio);
+    }
+}
+
 //-------------------------------------------------------------
 // ehUpdateTryLasts: Iterates EH descriptors, updating each try region's
 // end block as determined by getTryLast.
@@ -3083,6 +3083,33 @@ bool Compiler::fgFuncletsAreCold()
     return true;
 }
 
+//------------------------------------------------------------------------
+// fgIsColdForSplitting: check if a block can be placed in the cold code
+//    section
+//
+// Arguments:
+//    block - block to check
+//
+// Returns:
+//    True if the block is rarely run, or if trusted profile data says it
+//    runs less often than JitSplitColdWeightPercent of the method's calls.
+//
+bool Compiler::fgIsColdForSplitting(BasicBlock* block)
+{
+    if (block->isRunRarely())
+    {
+        return true;
+    }
+
+    const unsigned coldWeightPercent = (unsigned)JitConfig.JitSplitColdWeightPercent();
+    if ((coldWeightPercent == 0) || !block->hasProfileWeight() || !fgHaveTrustedProfileWeights())
+    {
+        return false;
+    }
+
+    return block->getBBWeight(this) < (BB_UNITY_WEIGHT * coldWeightPercent / 100);
+}
+
 //------------------------------------------------------------------------
 // fgDetermineFirstColdBlock: figure out where we might split the block
 //    list to put some blocks into the cold code section
@@ -3094,7 +3121,9 @@ bool Compiler::fgFuncletsAreCold()
 //    Walk the basic blocks list to determine the first block to place in the
 //    cold section. This would be the first of a series of rarely executed blocks
 //    such that no succeeding blocks are in a try region or an exception handler
-//    or are rarely executed.
+//    or are rarely executed. With trusted profile data, blocks that are
+//    almost never executed are treated as rarely executed too; see
+//    fgIsColdForSplitting.
 //
 PhaseStatus Compiler::fgDetermineFirstColdBlock()
 {
@@ -3151,7 +3180,7 @@ PhaseStatus Compiler::fgDetermineFirstColdBlock()
                 // We have a candidate for first cold block
 
                 // Is this a hot block?
-                if (!block->isRunRarely())
+                if (!fgIsColdForSplitting(block))
                 {
                     // We have to restart the search for the first cold block
                     firstColdBlock       = nullptr;
@@ -3190,7 +3219,7 @@ PhaseStatus Compiler::fgDetermineFirstColdBlock()
                 }
 
                 // Is this a cold block?
-                if (block->isRunRarely())
+                if (fgIsColdForSplitting(block))
                 {
                     //
                     // If the last block that was hot was a BBJ_COND
@@ -21285,6 +21285,20 @@ GenTree* Compiler::gtNewSimdBinOpNode(
                 return gtNewSimdBinOpNode(GT_ADD, type, tmp0, tmp4, simdBaseJitType, simdSize);
             }
 #elif defined(TARGET_ARM64)
+            if (varTypeIsLong(simdBaseType) && (simdSize == 16) && (fgNodeThreading != NodeThreading::LIR) &&
+                compOpportunisticallyDependsOn(InstructionSet_Sve))
+            {
+                // AdvSimd has no 64-bit element multiply, but SVE does. SVE is only enabled
+                // when the vector length is 128 bits, so a Vector128 is exactly one SVE vector.
+                if (varTypeIsArithmetic(op2))
+                {
+                    op2 = gtNewSimdCreateBroadcastNode(type, op2, simdBaseJitType, simdSize);
+                }
+
+                // Lowering supplies the all-true predicate for the embedded masked operation.
+                return gtNewSimdHWIntrinsicNode(type, op1, op2, NI_Sve_Multiply, simdBaseJitType, simdSize);
+            }
+
             if (varTypeIsLong(simdBaseType))
             {
                 GenTree** op2ToDup = nullptr;
@@ -841,9 +841,20 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
     JITDUMP("offsetOfMaxThreadStaticBlocks= %u\n", dspOffset(threadStaticBlocksInfo.offsetOfMaxThreadStaticBlocks));
     JITDUMP("offsetOfThreadStaticBlocks= %u\n", dspOffset(threadStaticBlocksInfo.offsetOfThreadStaticBlocks));
     JITDUMP("offsetOfBaseOfThreadLocalData= %u\n", dspOffset(threadStaticBlocksInfo.offsetOfBaseOfThreadLocalData));
+    JITDUMP("offsetOfMaxCollectibleThreadStaticBlocks= %u\n",
+            dspOffset(threadStaticBlocksInfo.offsetOfMaxCollectibleThreadStaticBlocks));
+    JITDUMP("offsetOfCollectibleThreadStaticBlocks= %u\n",
+            dspOffset(threadStaticBlocksInfo.offsetOfCollectibleThreadStaticBlocks));
 
     assert(call->gtArgs.CountArgs() == 1);
 
+    if (!call->gtArgs.GetArgByIndex(0)->GetNode()->IsCnsIntOrI())
+    {
+        // The index type decides which TLS array to probe, so it has to be known here.
+        JITDUMP("Type index is not a constant, not expanding\n");
+        return false;
+    }
+
     // Split block right before the call tree
     BasicBlock* prevBb       = block;
     GenTree**   callUse      = nullptr;
@@ -1038,8 +1049,25 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
     }
     else
     {
-        size_t offsetOfThreadStaticBlocksVal    = threadStaticBlocksInfo.offsetOfThreadStaticBlocks;
-        size_t offsetOfMaxThreadStaticBlocksVal = threadStaticBlocksInfo.offsetOfMaxThreadStaticBlocks;
+        // Types in collectible assemblies keep their static blocks in a separate array of object
+        // handles. The VM flags such indices, so strip the flag before using it as an array index;
+        // the fallback helper still receives the flagged index so it can tell the arrays apart.
+        bool isCollectible = false;
+        if ((typeThreadStaticBlockIndexValue->AsIntCon()->IconValue() & CORINFO_THREAD_STATIC_COLLECTIBLE_INDEX) != 0)
+        {
+            isCollectible = true;
+            typeThreadStaticBlockIndexValue =
+                gtNewIconNode(typeThreadStaticBlockIndexValue->AsIntCon()->IconValue() &
+                                  ~(ssize_t)CORINFO_THREAD_STATIC_COLLECTIBLE_INDEX,
+                              TYP_INT);
+        }
+
+        size_t offsetOfThreadStaticBlocksVal    = isCollectible
+                                                      ? threadStaticBlocksInfo.offsetOfCollectibleThreadStaticBlocks
+                                                      : threadStaticBlocksInfo.offsetOfThreadStaticBlocks;
+        size_t offsetOfMaxThreadStaticBlocksVal = isCollectible
+                                                      ? threadStaticBlocksInfo.offsetOfMaxCollectibleThreadStaticBlocks
+                                                      : threadStaticBlocksInfo.offsetOfMaxThreadStaticBlocks;
 
         // Create tree for "maxThreadStaticBlocks = tls[offsetOfMaxThreadStaticBlocks]"
         GenTree* offsetOfMaxThreadStaticBlocks = gtNewIconNode(offsetOfMaxThreadStaticBlocksVal, TYP_I_IMPL);
@@ -1050,19 +1078,50 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
 
         GenTree* threadStaticBlocksRef = gtNewOperNode(GT_ADD, TYP_I_IMPL, gtCloneExpr(tlsLclValueUse),
                                                        gtNewIconNode(offsetOfThreadStaticBlocksVal, TYP_I_IMPL));
-        threadStaticBlocksValue = gtNewIndir(TYP_REF, threadStaticBlocksRef, GTF_IND_NONFAULTING | GTF_IND_INVARIANT);
+        threadStaticBlocksValue = gtNewIndir(isCollectible ? TYP_I_IMPL : TYP_REF, threadStaticBlocksRef,
+                                             GTF_IND_NONFAULTING | GTF_IND_INVARIANT);
 
         // Create tree for "if (maxThreadStaticBlocks < typeIndex)"
         GenTree* maxThreadStaticBlocksCond =
             gtNewOperNode(GT_LE, TYP_INT, maxThreadStaticBlocksValue, gtCloneExpr(typeThreadStaticBlockIndexValue));
         maxThreadStaticBlocksCond = gtNewOperNode(GT_JTRUE, TYP_VOID, maxThreadStaticBlocksCond);
 
-        // Create tree to "threadStaticBlockValue = threadStaticBlockBase[typeIndex]"
-        typeThreadStaticBlockIndexValue = gtNewOperNode(GT_MUL, TYP_INT, gtCloneExpr(typeThreadStaticBlockIndexValue),
-                                                        gtNewIconNode(TARGET_POINTER_SIZE, TYP_INT));
-        GenTree* typeThreadStaticBlockRef =
-            gtNewOperNode(GT_ADD, TYP_BYREF, threadStaticBlocksValue, typeThreadStaticBlockIndexValue);
-        GenTree* typeThreadStaticBlockValue = gtNewIndir(TYP_BYREF, typeThreadStaticBlockRef, GTF_IND_NONFAULTING);
+        GenTree* typeThreadStaticBlockValue = nullptr;
+        GenTree* tlsHandleDef               = nullptr;
+        GenTree* tlsHandleNullCond          = nullptr;
+        if (isCollectible)
+        {
+            // Create tree to "tlsHandle = collectibleThreadStaticBlocks[typeIndex]". The index is known
+            // here, so fold the scaling into the constant.
+            GenTree* typeThreadStaticBlockOffset =
+                gtNewIconNode(typeThreadStaticBlockIndexValue->AsIntCon()->IconValue() * TARGET_POINTER_SIZE,
+                              TYP_I_IMPL);
+            GenTree* tlsHandleRef =
+                gtNewOperNode(GT_ADD, TYP_I_IMPL, threadStaticBlocksValue, typeThreadStaticBlockOffset);
+
+            unsigned tlsHandleLclNum         = lvaGrabTemp(true DEBUGARG("Collectible TLS handle"));
+            lvaTable[tlsHandleLclNum].lvType = TYP_I_IMPL;
+            tlsHandleDef =
+                gtNewStoreLclVarNode(tlsHandleLclNum, gtNewIndir(TYP_I_IMPL, tlsHandleRef, GTF_IND_NONFAULTING));
+
+            // Create tree for "if (tlsHandle == nullptr)"
+            tlsHandleNullCond =
+                gtNewOperNode(GT_EQ, TYP_INT, gtNewLclVarNode(tlsHandleLclNum), gtNewIconNode(0, TYP_I_IMPL));
+            tlsHandleNullCond = gtNewOperNode(GT_JTRUE, TYP_VOID, tlsHandleNullCond);
+
+            // Create tree to "threadStaticBlockValue = *tlsHandle"
+            typeThreadStaticBlockValue = gtNewIndir(TYP_BYREF, gtNewLclVarNode(tlsHandleLclNum), GTF_IND_NONFAULTING);
+        }
+        else
+        {
+            // Create tree to "threadStaticBlockValue = threadStaticBlockBase[typeIndex]"
+            typeThreadStaticBlockIndexValue =
+                gtNewOperNode(GT_MUL, TYP_INT, gtCloneExpr(typeThreadStaticBlockIndexValue),
+                              gtNewIconNode(TARGET_POINTER_SIZE, TYP_INT));
+            GenTree* typeThreadStaticBlockRef =
+                gtNewOperNode(GT_ADD, TYP_BYREF, threadStaticBlocksValue, typeThreadStaticBlockIndexValue);
+            typeThreadStaticBlockValue = gtNewIndir(TYP_BYREF, typeThreadStaticBlockRef, GTF_IND_NONFAULTING);
+        }
 
         // Cache the threadStaticBlock value
         unsigned threadStaticBlockBaseLclNum         = lvaGrabTemp(true DEBUGARG("ThreadStaticBlockBase access"));
@@ -1084,8 +1143,14 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         //      if (maxThreadStaticBlocks <= typeIndex)
         //          goto fallbackBb;
         //
+        // tlsHandleNullCondBB (BBJ_COND):                                  [weight: 1.0]
+        //      (collectible types only)
+        //      tlsHandle = t_collectibleThreadStaticBlocks[typeIndex]
+        //      if (tlsHandle == nullptr)
+        //          goto fallbackBb;
+        //
         // threadStaticBlockNullCondBB (BBJ_COND):                          [weight: 1.0]
-        //      fastPathValue = t_threadStaticBlocks[typeIndex]
+        //      fastPathValue = t_threadStaticBlocks[typeIndex] (or *tlsHandle)
         //      if (fastPathValue != nullptr)
         //          goto fastPathBb;
         //
@@ -1108,9 +1173,18 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         fgInsertStmtAfter(maxThreadStaticBlocksCondBB, maxThreadStaticBlocksCondBB->firstStmt(),
                           fgNewStmtFromTree(maxThreadStaticBlocksCond));
 
+        BasicBlock* tlsHandleNullCondBB = nullptr;
+        if (isCollectible)
+        {
+            tlsHandleNullCondBB = fgNewBBFromTreeAfter(BBJ_COND, maxThreadStaticBlocksCondBB, tlsHandleDef, debugInfo);
+            fgInsertStmtAfter(tlsHandleNullCondBB, tlsHandleNullCondBB->firstStmt(),
+                              fgNewStmtFromTree(tlsHandleNullCond));
+        }
+
         // Similarly, set threadStaticBlockNulLCondBB to jump to fastPathBb once the latter exists.
         BasicBlock* threadStaticBlockNullCondBB =
-            fgNewBBFromTreeAfter(BBJ_COND, maxThreadStaticBlocksCondBB, threadStaticBlockBaseDef, debugInfo);
+            fgNewBBFromTreeAfter(BBJ_COND, isCollectible ? tlsHandleNullCondBB : maxThreadStaticBlocksCondBB,
+                                 threadStaticBlockBaseDef, debugInfo);
         fgInsertStmtAfter(threadStaticBlockNullCondBB, threadStaticBlockNullCondBB->firstStmt(),
                           fgNewStmtFromTree(threadStaticBlockNullCond));
 
@@ -1130,14 +1204,25 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         fgRedirectTargetEdge(prevBb, maxThreadStaticBlocksCondBB);
 
         {
-            FlowEdge* const trueEdge  = fgAddRefPred(fallbackBb, maxThreadStaticBlocksCondBB);
-            FlowEdge* const falseEdge = fgAddRefPred(threadStaticBlockNullCondBB, maxThreadStaticBlocksCondBB);
+            BasicBlock* const nextCondBB = isCollectible ? tlsHandleNullCondBB : threadStaticBlockNullCondBB;
+            FlowEdge* const   trueEdge   = fgAddRefPred(fallbackBb, maxThreadStaticBlocksCondBB);
+            FlowEdge* const   falseEdge  = fgAddRefPred(nextCondBB, maxThreadStaticBlocksCondBB);
             maxThreadStaticBlocksCondBB->SetTrueEdge(trueEdge);
             maxThreadStaticBlocksCondBB->SetFalseEdge(falseEdge);
             trueEdge->setLikelihood(0.0);
             falseEdge->setLikelihood(1.0);
         }
 
+        if (isCollectible)
+        {
+            FlowEdge* const trueEdge  = fgAddRefPred(fallbackBb, tlsHandleNullCondBB);
+            FlowEdge* const falseEdge = fgAddRefPred(threadStaticBlockNullCondBB, tlsHandleNullCondBB);
+            tlsHandleNullCondBB->SetTrueEdge(trueEdge);
+            tlsHandleNullCondBB->SetFalseEdge(falseEdge);
+            trueEdge->setLikelihood(0.0);
+            falseEdge->setLikelihood(1.0);
+        }
+
         {
             FlowEdge* const trueEdge  = fgAddRefPred(fastPathBb, threadStaticBlockNullCondBB);
             FlowEdge* const falseEdge = fgAddRefPred(fallbackBb, threadStaticBlockNullCondBB);
@@ -1162,6 +1247,10 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         maxThreadStaticBlocksCondBB->inheritWeight(prevBb);
         threadStaticBlockNullCondBB->inheritWeight(prevBb);
         fastPathBb->inheritWeight(prevBb);
+        if (isCollectible)
+        {
+            tlsHandleNullCondBB->inheritWeight(prevBb);
+        }
 
         // fallback will just execute first time
         fallbackBb->bbSetRunRarely();
@@ -1171,6 +1260,7 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         assert(BasicBlock::sameEHRegion(prevBb, maxThreadStaticBlocksCondBB));
         assert(BasicBlock::sameEHRegion(prevBb, threadStaticBlockNullCondBB));
         assert(BasicBlock::sameEHRegion(prevBb, fastPathBb));
+        assert(!isCollectible || BasicBlock::sameEHRegion(prevBb, tlsHandleNullCondBB));
     }
 
     return true;
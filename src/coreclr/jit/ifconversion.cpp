@@ -41,9 +41,14 @@ private:
         GenTree*    node  = nullptr;
     };
 
-    GenTree*           m_cond;          // The condition in the conversion
-    IfConvertOperation m_thenOperation; // The single operation in the Then case.
-    IfConvertOperation m_elseOperation; // The single operation in the Else case.
+    // Max number of operations to allow in both the Then and Else cases.
+    static const unsigned MaxOperations = 3;
+
+    GenTree*           m_cond;                          // The condition in the conversion
+    IfConvertOperation m_thenOperations[MaxOperations]; // The operations in the Then case, in order.
+    IfConvertOperation m_elseOperations[MaxOperations]; // The operations in the Else case, in order.
+    unsigned           m_thenCount = 0;                 // Number of operations in the Then case.
+    unsigned           m_elseCount = 0;                 // Number of operations in the Else case.
 
     int m_checkLimit = 4; // Max number of chained blocks to allow in both the True and Else cases.
 
@@ -54,8 +59,11 @@ private:
     bool IfConvertCheckInnerBlockFlow(BasicBlock* block);
     bool IfConvertCheckThenFlow();
     void IfConvertFindFlow();
-    bool IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOperation* foundOperation);
+    bool IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOperation* foundOperations, unsigned* foundCount);
+    bool IfConvertCheckOperationPairs();
+    bool IfConvertCheckProfile(bool* isUnpredictable);
     void IfConvertJoinStmts(BasicBlock* fromBlock);
+    void IfConvertJoinOperationStmts(IfConvertOperation* operations, unsigned count);
 
 #ifdef DEBUG
     void IfConvertDump();
@@ -208,20 +216,23 @@ void OptIfConversionDsc::IfConvertFindFlow()
 // IfConvertCheckStmts
 //
 // From the given block to the final block, check all the statements and nodes are
-// valid for an If conversion. Chain of blocks must contain only a single local
-// store and no other operations.
+// valid for an If conversion. Chain of blocks must contain only up to MaxOperations
+// local stores, optionally followed by a return, and no other operations.
 //
 // Arguments:
-//   fromBlock      - Block inside the if statement to start from (Either Then or Else path).
-//   foundOperation - Returns the found operation.
+//   fromBlock       - Block inside the if statement to start from (Either Then or Else path).
+//   foundOperations - Returns the found operations, in execution order.
+//   foundCount      - Returns the number of found operations.
 //
 // Returns:
-//   If everything is valid, then set foundOperation to the store and return true.
+//   If everything is valid, then set foundOperations to the stores and return true.
 //   Otherwise return false.
 //
-bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOperation* foundOperation)
+bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock*         fromBlock,
+                                             IfConvertOperation* foundOperations,
+                                             unsigned*           foundCount)
 {
-    bool found = false;
+    unsigned count = 0;
 
     for (BasicBlock* block = fromBlock; block != m_finalBlock; block = block->GetUniqueSucc())
     {
@@ -235,8 +246,10 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
             {
                 case GT_STORE_LCL_VAR:
                 {
-                    // Only one per operation per block can be conditionally executed.
-                    if (found)
+                    // Only a few operations can be conditionally executed, and
+                    // nothing may follow a return.
+                    if ((count == MaxOperations) ||
+                        ((count > 0) && foundOperations[count - 1].node->OperIs(GT_RETURN)))
                     {
                         return false;
                     }
@@ -278,10 +291,10 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
                         return false;
                     }
 
-                    found                 = true;
-                    foundOperation->block = block;
-                    foundOperation->stmt  = stmt;
-                    foundOperation->node  = tree;
+                    foundOperations[count].block = block;
+                    foundOperations[count].stmt  = stmt;
+                    foundOperations[count].node  = tree;
+                    count++;
                     break;
                 }
 
@@ -296,8 +309,10 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
                         return false;
                     }
 
-                    // Only one per operation per block can be conditionally executed.
-                    if (found || retVal == nullptr)
+                    // Only a few operations can be conditionally executed, and
+                    // nothing may follow a return.
+                    if ((count == MaxOperations) || (retVal == nullptr) ||
+                        ((count > 0) && foundOperations[count - 1].node->OperIs(GT_RETURN)))
                     {
                         return false;
                     }
@@ -333,10 +348,10 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
                         return false;
                     }
 
-                    found                 = true;
-                    foundOperation->block = block;
-                    foundOperation->stmt  = stmt;
-                    foundOperation->node  = tree;
+                    foundOperations[count].block = block;
+                    foundOperations[count].stmt  = stmt;
+                    foundOperations[count].node  = tree;
+                    count++;
                     break;
                 }
 
@@ -350,7 +365,124 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
             }
         }
     }
-    return found;
+
+    *foundCount = count;
+    return count > 0;
+}
+
+//-----------------------------------------------------------------------------
+// IfConvertCheckOperationPairs
+//
+// Check that the found Then and Else operations can be merged into SELECTs.
+//
+// Returns:
+//   True if the operations can be merged; otherwise false.
+//
+// Notes:
+//   Each operation becomes its own SELECT, evaluated in the original order,
+//   so the condition is evaluated again for every operation after the first.
+//   That is only correct if the condition does not read any local stored by
+//   an earlier operation, and has no side effects to duplicate.
+//
+//   With an Else case the operations are merged pairwise, so both cases must
+//   store the same locals in the same order. A value may then read a local
+//   stored by an earlier pair: on either path that local has already been
+//   given the value that path would have produced.
+//
+bool OptIfConversionDsc::IfConvertCheckOperationPairs()
+{
+    if (m_doElseConversion)
+    {
+        if (m_thenCount != m_elseCount)
+        {
+            return false;
+        }
+
+        for (unsigned i = 0; i < m_thenCount; i++)
+        {
+            GenTree* thenNode = m_thenOperations[i].node;
+            GenTree* elseNode = m_elseOperations[i].node;
+
+            // Both operations must be the same node type.
+            if (thenNode->OperGet() != elseNode->OperGet())
+            {
+                return false;
+            }
+
+            // Currently can only support Else Store Blocks that have the same destination as the Then block.
+            if (thenNode->OperIs(GT_STORE_LCL_VAR) &&
+                (thenNode->AsLclVarCommon()->GetLclNum() != elseNode->AsLclVarCommon()->GetLclNum()))
+            {
+                return false;
+            }
+        }
+    }
+
+    if (m_thenCount == 1)
+    {
+        return true;
+    }
+
+    if ((m_cond->gtFlags & GTF_SIDE_EFFECT) != 0)
+    {
+        return false;
+    }
+
+    for (unsigned i = 0; i < m_thenCount - 1; i++)
+    {
+        GenTree* node = m_thenOperations[i].node;
+        assert(node->OperIs(GT_STORE_LCL_VAR));
+
+        if (m_comp->gtHasRef(m_cond, node->AsLclVarCommon()->GetLclNum()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// IfConvertCheckProfile
+//
+// Use profile data to decide whether the branch is worth converting.
+//
+// Arguments:
+//   isUnpredictable - [out] Set to true if profile data shows the branch
+//                     going both ways about equally often.
+//
+// Returns:
+//   False if the branch is strongly biased and should be left alone.
+//
+// Notes:
+//   A strongly biased branch is well predicted, so converting it only
+//   turns a free branch into a data dependency on the condition.
+//
+bool OptIfConversionDsc::IfConvertCheckProfile(bool* isUnpredictable)
+{
+    *isUnpredictable = false;
+
+    if (!m_startBlock->hasProfileWeight())
+    {
+        return true;
+    }
+
+    const weight_t trueLikelihood = m_startBlock->GetTrueEdge()->getLikelihood();
+    const weight_t bias           = max(trueLikelihood, 1.0 - trueLikelihood);
+
+    // Branches going the same way at least this often are considered predictable.
+    const weight_t predictableBias = 0.9;
+    // Branches going either way at most this often are considered unpredictable.
+    const weight_t unpredictableBias = 0.7;
+
+    if (bias >= predictableBias)
+    {
+        JITDUMP("Skipping if-conversion of predictable branch (likelihood " FMT_WT ")\n", trueLikelihood);
+        return false;
+    }
+
+    *isUnpredictable = bias <= unpredictableBias;
+    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -373,6 +505,30 @@ void OptIfConversionDsc::IfConvertJoinStmts(BasicBlock* fromBlock)
     fromBlock->bbStmtList = nullptr;
 }
 
+//-----------------------------------------------------------------------------
+// IfConvertJoinOperationStmts
+//
+// Move the statements of all blocks holding one of the given operations onto
+// the end of the start block.
+//
+// Arguments:
+//   operations -- The operations, in order
+//   count      -- Number of operations
+//
+void OptIfConversionDsc::IfConvertJoinOperationStmts(IfConvertOperation* operations, unsigned count)
+{
+    for (unsigned i = 0; i < count; i++)
+    {
+        // Operations are in order, so operations in the same block are adjacent.
+        if ((i > 0) && (operations[i].block == operations[i - 1].block))
+        {
+            continue;
+        }
+
+        IfConvertJoinStmts(operations[i].block);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // IfConvertDump
 //
@@ -548,6 +704,10 @@ void OptIfConversionDsc::IfConvertDump()
 // ------------ BB04 [00D..010), preds={} succs={BB06}
 // ------------ BB05 [00D..010), preds={} succs={BB06}
 //
+// The Then and Else cases may also hold a few stores each, optionally followed
+// by a return (e.g. "if (x < y) { lo = x; hi = y; } else { lo = y; hi = x; }").
+// Each store then gets its own SELECT with a copy of the condition.
+//
 bool OptIfConversionDsc::optIfConvert()
 {
     // Does the block end by branching via a JTRUE after a compare?
@@ -572,91 +732,101 @@ bool OptIfConversionDsc::optIfConvert()
         return false;
     }
 
-    // Check the Then and Else blocks have a single operation each.
-    if (!IfConvertCheckStmts(m_startBlock->GetFalseTarget(), &m_thenOperation))
+    // Check the Then and Else blocks have only a few operations each.
+    if (!IfConvertCheckStmts(m_startBlock->GetFalseTarget(), m_thenOperations, &m_thenCount))
     {
         return false;
     }
-    assert(m_thenOperation.node->OperIs(GT_STORE_LCL_VAR, GT_RETURN));
+    assert(m_thenOperations[m_thenCount - 1].node->OperIs(GT_STORE_LCL_VAR, GT_RETURN));
     if (m_doElseConversion)
     {
-        if (!IfConvertCheckStmts(m_startBlock->GetTrueTarget(), &m_elseOperation))
+        if (!IfConvertCheckStmts(m_startBlock->GetTrueTarget(), m_elseOperations, &m_elseCount))
         {
             return false;
         }
+    }
 
-        // Both operations must be the same node type.
-        if (m_thenOperation.node->OperGet() != m_elseOperation.node->OperGet())
-        {
-            return false;
-        }
+    // A return must end both cases, or neither.
+    if ((m_mainOper == GT_RETURN) != m_thenOperations[m_thenCount - 1].node->OperIs(GT_RETURN))
+    {
+        return false;
+    }
 
-        // Currently can only support Else Store Blocks that have the same destination as the Then block.
-        if (m_thenOperation.node->OperIs(GT_STORE_LCL_VAR))
-        {
-            unsigned lclNumThen = m_thenOperation.node->AsLclVarCommon()->GetLclNum();
-            unsigned lclNumElse = m_elseOperation.node->AsLclVarCommon()->GetLclNum();
-            if (lclNumThen != lclNumElse)
-            {
-                return false;
-            }
-        }
+    if (!IfConvertCheckOperationPairs())
+    {
+        return false;
     }
 
 #ifdef DEBUG
     if (m_comp->verbose)
     {
-        JITDUMP("\nConditionally executing " FMT_BB, m_thenOperation.block->bbNum);
+        JITDUMP("\nConditionally executing %u operation(s) from " FMT_BB, m_thenCount,
+                m_thenOperations[0].block->bbNum);
         if (m_doElseConversion)
         {
-            JITDUMP(" and " FMT_BB, m_elseOperation.block->bbNum);
+            JITDUMP(" and " FMT_BB, m_elseOperations[0].block->bbNum);
         }
         JITDUMP(" inside " FMT_BB "\n", m_startBlock->bbNum);
         IfConvertDump();
     }
 #endif
 
+    bool isUnpredictable = false;
+
     // Using SELECT nodes means that both Then and Else operations are fully evaluated.
     // Put a limit on the original source and destinations.
     if (!m_comp->compStressCompile(Compiler::STRESS_IF_CONVERSION_COST, 25))
     {
-        int thenCost = 0;
-        int elseCost = 0;
-
-        if (m_mainOper == GT_STORE_LCL_VAR)
+        for (unsigned i = 0; i < m_thenCount; i++)
         {
-            thenCost = m_thenOperation.node->AsLclVar()->Data()->GetCostEx() +
-                       (m_comp->gtIsLikelyRegVar(m_thenOperation.node) ? 0 : 2);
-            if (m_doElseConversion)
+            int thenCost = 0;
+            int elseCost = 0;
+
+            GenTree* thenNode = m_thenOperations[i].node;
+            GenTree* elseNode = m_doElseConversion ? m_elseOperations[i].node : nullptr;
+
+            if (thenNode->OperIs(GT_STORE_LCL_VAR))
             {
-                elseCost = m_elseOperation.node->AsLclVar()->Data()->GetCostEx() +
-                           (m_comp->gtIsLikelyRegVar(m_elseOperation.node) ? 0 : 2);
+                thenCost = thenNode->AsLclVar()->Data()->GetCostEx() + (m_comp->gtIsLikelyRegVar(thenNode) ? 0 : 2);
+                if (m_doElseConversion)
+                {
+                    elseCost =
+                        elseNode->AsLclVar()->Data()->GetCostEx() + (m_comp->gtIsLikelyRegVar(elseNode) ? 0 : 2);
+                }
             }
-        }
-        else
-        {
-            assert(m_mainOper == GT_RETURN);
-            thenCost = m_thenOperation.node->AsOp()->GetReturnValue()->GetCostEx();
-            if (m_doElseConversion)
+            else
             {
-                elseCost = m_elseOperation.node->AsOp()->GetReturnValue()->GetCostEx();
+                assert(thenNode->OperIs(GT_RETURN));
+                thenCost = thenNode->AsOp()->GetReturnValue()->GetCostEx();
+                if (m_doElseConversion)
+                {
+                    elseCost = elseNode->AsOp()->GetReturnValue()->GetCostEx();
+                }
+            }
+
+            // Cost to allow for "x = cond ? a + b : c + d".
+            if (thenCost > 7 || elseCost > 7)
+            {
+                JITDUMP("Skipping if-conversion that will evaluate RHS unconditionally at costs %d,%d\n", thenCost,
+                        elseCost);
+                return false;
             }
         }
 
-        // Cost to allow for "x = cond ? a + b : c + d".
-        if (thenCost > 7 || elseCost > 7)
+        if (!IfConvertCheckProfile(&isUnpredictable))
         {
-            JITDUMP("Skipping if-conversion that will evaluate RHS unconditionally at costs %d,%d\n", thenCost,
-                    elseCost);
             return false;
         }
     }
 
-    if (!m_comp->compStressCompile(Compiler::STRESS_IF_CONVERSION_INNER_LOOPS, 25))
+    if (!isUnpredictable && !m_comp->compStressCompile(Compiler::STRESS_IF_CONVERSION_INNER_LOOPS, 25))
     {
         // Don't optimise the block if it is inside a loop. Loop-carried
         // dependencies can cause significant stalls if if-converted.
         // Detect via the block weight as that will be high when inside a loop.
+        //
+        // When profile data shows the branch is unpredictable the
+        // mispredictions cost more than the stalls, so convert anyway.
 
         if (m_startBlock->getBBWeight(m_comp) > BB_UNITY_WEIGHT * 1.05)
         {
@@ -672,54 +842,62 @@ bool OptIfConversionDsc::optIfConvert()
         }
     }
 
-    // Get the select node inputs.
-    var_types selectType;
-    GenTree*  selectTrueInput;
-    GenTree*  selectFalseInput;
-    if (m_mainOper == GT_STORE_LCL_VAR)
+    // Turn each operation into a SELECT. Each operation after the first
+    // evaluates its own copy of the condition.
+    for (unsigned i = 0; i < m_thenCount; i++)
     {
-        if (m_doElseConversion)
+        IfConvertOperation& thenOperation = m_thenOperations[i];
+        GenTree*            cond          = (i == 0) ? m_cond : m_comp->gtCloneExpr(m_cond);
+
+        // Get the select node inputs.
+        var_types selectType;
+        GenTree*  selectTrueInput;
+        GenTree*  selectFalseInput;
+        if (thenOperation.node->OperIs(GT_STORE_LCL_VAR))
         {
-            selectTrueInput  = m_elseOperation.node->AsLclVar()->Data();
-            selectFalseInput = m_thenOperation.node->AsLclVar()->Data();
+            if (m_doElseConversion)
+            {
+                selectTrueInput  = m_elseOperations[i].node->AsLclVar()->Data();
+                selectFalseInput = thenOperation.node->AsLclVar()->Data();
+            }
+            else // Duplicate the destination of the Then store.
+            {
+                GenTreeLclVar* store = thenOperation.node->AsLclVar();
+                selectTrueInput      = m_comp->gtNewLclVarNode(store->GetLclNum(), store->TypeGet());
+                selectFalseInput     = thenOperation.node->AsLclVar()->Data();
+            }
+
+            // Pick the type as the type of the local, which should always be compatible even for implicit coercions.
+            selectType = genActualType(thenOperation.node);
         }
-        else // Duplicate the destination of the Then store.
+        else
         {
-            GenTreeLclVar* store = m_thenOperation.node->AsLclVar();
-            selectTrueInput      = m_comp->gtNewLclVarNode(store->GetLclNum(), store->TypeGet());
-            selectFalseInput     = m_thenOperation.node->AsLclVar()->Data();
-        }
-
-        // Pick the type as the type of the local, which should always be compatible even for implicit coercions.
-        selectType = genActualType(m_thenOperation.node);
-    }
-    else
-    {
-        assert(m_mainOper == GT_RETURN);
-        assert(m_doElseConversion);
-        assert(m_thenOperation.node->TypeGet() == m_elseOperation.node->TypeGet());
+            assert(thenOperation.node->OperIs(GT_RETURN));
+            assert(m_doElseConversion);
+            assert(thenOperation.node->TypeGet() == m_elseOperations[i].node->TypeGet());
 
-        selectTrueInput  = m_elseOperation.node->AsOp()->GetReturnValue();
-        selectFalseInput = m_thenOperation.node->AsOp()->GetReturnValue();
-        selectType       = genActualType(m_thenOperation.node);
-    }
+            selectTrueInput  = m_elseOperations[i].node->AsOp()->GetReturnValue();
+            selectFalseInput = thenOperation.node->AsOp()->GetReturnValue();
+            selectType       = genActualType(thenOperation.node);
+        }
 
-    // Create a select node.
-    GenTreeConditional* select =
-        m_comp->gtNewConditionalNode(GT_SELECT, m_cond, selectTrueInput, selectFalseInput, selectType);
-    m_thenOperation.node->AddAllEffectsFlags(select);
+        // Create a select node.
+        GenTreeConditional* select =
+            m_comp->gtNewConditionalNode(GT_SELECT, cond, selectTrueInput, selectFalseInput, selectType);
+        thenOperation.node->AddAllEffectsFlags(select);
 
-    // Use the select as the source of the Then operation.
-    if (m_mainOper == GT_STORE_LCL_VAR)
-    {
-        m_thenOperation.node->AsLclVar()->Data() = select;
-    }
-    else
-    {
-        m_thenOperation.node->AsOp()->SetReturnValue(select);
+        // Use the select as the source of the Then operation.
+        if (thenOperation.node->OperIs(GT_STORE_LCL_VAR))
+        {
+            thenOperation.node->AsLclVar()->Data() = select;
+        }
+        else
+        {
+            thenOperation.node->AsOp()->SetReturnValue(select);
+        }
+        m_comp->gtSetEvalOrder(thenOperation.node);
+        m_comp->fgSetStmtSeq(thenOperation.stmt);
     }
-    m_comp->gtSetEvalOrder(m_thenOperation.node);
-    m_comp->fgSetStmtSeq(m_thenOperation.stmt);
 
     // Remove statements.
     last->gtBashToNOP();
@@ -727,16 +905,19 @@ bool OptIfConversionDsc::optIfConvert()
     m_comp->fgSetStmtSeq(m_startBlock->lastStmt());
     if (m_doElseConversion)
     {
-        m_elseOperation.node->gtBashToNOP();
-        m_comp->gtSetEvalOrder(m_elseOperation.node);
-        m_comp->fgSetStmtSeq(m_elseOperation.stmt);
+        for (unsigned i = 0; i < m_elseCount; i++)
+        {
+            m_elseOperations[i].node->gtBashToNOP();
+            m_comp->gtSetEvalOrder(m_elseOperations[i].node);
+            m_comp->fgSetStmtSeq(m_elseOperations[i].stmt);
+        }
     }
 
     // Merge all the blocks.
-    IfConvertJoinStmts(m_thenOperation.block);
+    IfConvertJoinOperationStmts(m_thenOperations, m_thenCount);
     if (m_doElseConversion)
     {
-        IfConvertJoinStmts(m_elseOperation.block);
+        IfConvertJoinOperationStmts(m_elseOperations, m_elseCount);
     }
 
     // Update the flow from the original block.
@@ -9787,6 +9787,7 @@ void Compiler::impImportBlockCode(BasicBlock* block)
 
                 // Remember that this function contains 'new' of an SD array.
                 optMethodFlags |= OMF_HAS_NEWARRAY;
+                compCurBB->SetFlags(BBF_HAS_NEWARR);
 
                 /* Push the result of the call on the stack */
 
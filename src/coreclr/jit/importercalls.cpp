@@ -1478,13 +1478,6 @@ DONE_CALL:
                     if (opts.IsOptimizedWithProfile())
                     {
                         call = impDuplicateWithProfiledArg(call->AsCall(), rawILOffset);
-                        if (call->OperIs(GT_QMARK))
-                        {
-                            // QMARK has to be a root node
-                            unsigned tmp = lvaGrabTemp(true DEBUGARG("Grabbing temp for Qmark"));
-                            impStoreToTemp(tmp, call, CHECK_SPILL_ALL);
-                            call = gtNewLclvNode(tmp, call->TypeGet());
-                        }
                     }
                     else if (opts.IsInstrumented())
                     {
@@ -1497,6 +1490,19 @@ DONE_CALL:
                         compCurBB->SetFlags(BBF_HAS_VALUE_PROFILE);
                     }
                 }
+
+                if (call->IsCall() && call->AsCall()->IsSpecialIntrinsic(this, NI_System_SpanHelpers_SequenceEqual))
+                {
+                    call = impExpandSequenceEqualVariableLength(call->AsCall());
+                }
+
+                if (call->OperIs(GT_QMARK))
+                {
+                    // QMARK has to be a root node
+                    unsigned tmp = lvaGrabTemp(true DEBUGARG("Grabbing temp for Qmark"));
+                    impStoreToTemp(tmp, call, CHECK_SPILL_ALL);
+                    call = gtNewLclvNode(tmp, call->TypeGet());
+                }
             }
 
             //-------------------------------------------------------------------------
@@ -3714,6 +3720,7 @@ GenTree* Compiler::impIntrinsic(CORINFO_CLASS_HANDLE    clsHnd,
                 lengthFieldAddr->SetIsSpanLength(true);
 
                 GenTree* boundsCheck = new (this, GT_BOUNDS_CHECK) GenTreeBoundsChk(index, length, SCK_RNGCHK_FAIL);
+                optMethodFlags |= OMF_HAS_SPANREF;
 
                 // Element access
                 index = indexClone;
@@ -6759,7 +6766,8 @@ void Compiler::pickGDV(GenTreeCall*           call,
     // Prefer class guess as it is cheaper
     if (numberOfClasses > 0)
     {
-        const int maxNumberOfGuesses = getGDVMaxTypeChecks();
+        const bool useCostModel       = !call->IsHelperCall() && (JitConfig.JitGuardedDevirtualizationCostModel() != 0);
+        const int  maxNumberOfGuesses = useCostModel ? getGDVMaxChainTypeChecks() : getGDVMaxTypeChecks();
         if (maxNumberOfGuesses == 0)
         {
             // DOTNET_JitGuardedDevirtualizationMaxTypeChecks=0 means we don't want to do any guarded devirtualization
@@ -6770,7 +6778,13 @@ void Compiler::pickGDV(GenTreeCall*           call,
         assert((maxNumberOfGuesses > 0) && (maxNumberOfGuesses <= MAX_GDV_TYPE_CHECKS));
 
         unsigned likelihoodThreshold;
-        if (maxNumberOfGuesses == 1)
+        if (useCostModel)
+        {
+            // Take every guess the histogram has; pickGDVChainLength below decides
+            // how many of them are worth a guard.
+            likelihoodThreshold = 1;
+        }
+        else if (maxNumberOfGuesses == 1)
         {
             // We're allowed to make only a single guess - it means we want to work only with dominating types
             if (call->IsHelperCall())
@@ -6838,6 +6852,11 @@ void Compiler::pickGDV(GenTreeCall*           call,
                 break;
             }
         }
+
+        if (useCostModel)
+        {
+            *candidatesCount = pickGDVChainLength(isInterface, likelihoods, *candidatesCount);
+        }
     }
 
     if (numberOfMethods > 0)
@@ -6857,6 +6876,62 @@ void Compiler::pickGDV(GenTreeCall*           call,
     }
 }
 
+//------------------------------------------------------------------------
+// pickGDVChainLength: Decide how many of the class guesses picked for a
+//    virtual or interface call are worth a guard.
+//
+// Arguments:
+//    isInterface     - whether or not the call target is defined on an interface
+//    likelihoods     - likelihoods of the guesses, in decreasing order
+//    candidatesCount - number of guesses picked from the class histogram
+//
+// Returns:
+//    Number of leading guesses to keep.
+//
+// Notes:
+//    Each guard is a method table compare and branch that runs whenever all
+//    the earlier guesses failed, while a successful guess replaces the vtable
+//    or stub dispatch with a direct, and possibly inlined, call. A guess is
+//    kept as long as its expected savings pay for its expected guard cost.
+//    The fallback indirect call is kept either way, so call sites in cold
+//    blocks get at most a single guess to keep them from growing the code.
+//
+int Compiler::pickGDVChainLength(bool isInterface, const unsigned* likelihoods, int candidatesCount)
+{
+    // Rough costs, in units of a compare and branch.
+    const unsigned guardCost    = 1;
+    const unsigned dispatchCost = isInterface ? 6 : 3;
+
+    // Percentage of calls that make it to the current guard.
+    unsigned reachLikelihood = 100;
+    int      chainLength     = 0;
+
+    for (; chainLength < candidatesCount; chainLength++)
+    {
+        const unsigned likelihood = likelihoods[chainLength];
+        if ((likelihood * dispatchCost) < (reachLikelihood * guardCost))
+        {
+            JITDUMP("Not guessing for guess %d with likelihood %u; its guard is reached by %u%% of the calls\n",
+                    chainLength, likelihood, reachLikelihood);
+            break;
+        }
+
+        reachLikelihood -= min(reachLikelihood, likelihood);
+    }
+
+    if ((chainLength > 1) && (compCurBB != nullptr) &&
+        (compCurBB->isRunRarely() ||
+         (compCurBB->hasProfileWeight() && (compCurBB->getBBWeight(this) < (BB_UNITY_WEIGHT / 10)))))
+    {
+        JITDUMP("Call site in " FMT_BB " is cold; keeping a single guess instead of %d\n", compCurBB->bbNum,
+                chainLength);
+        chainLength = 1;
+    }
+
+    JITDUMP("Guard chain cost model keeps %d of %d guesses\n", chainLength, candidatesCount);
+    return chainLength;
+}
+
 //------------------------------------------------------------------------
 // isCompatibleMethodGDV:
 //    Check if devirtualizing a call node as a specified target method call is
@@ -6988,7 +7063,7 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
     {
         pickGDV(call, ilOffset, isInterface, likelyClasses, likelyMethods, &candidatesCount, likelihoods);
         assert((unsigned)candidatesCount <= MAX_GDV_TYPE_CHECKS);
-        assert((unsigned)candidatesCount <= (unsigned)getGDVMaxTypeChecks());
+        assert((unsigned)candidatesCount <= (unsigned)getGDVMaxChainTypeChecks());
         if (candidatesCount == 0)
         {
             hasPgoData = false;
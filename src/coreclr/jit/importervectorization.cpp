@@ -29,6 +29,8 @@
 //   11) MemoryExtensions.EndsWith<char>(ROS<char>, ROS<char>)
 //   12) MemoryExtensions.EndsWith(ROS<char>, ROS<char>, Ordinal or OrdinalIgnoreCase)
 //
+//   13) SpanHelpers.SequenceEqual(ref byte, ref byte, nuint) with a non-constant length
+//
 // When one of the arguments is a constant string of a [0..32] size so we can inline
 // a vectorized comparison against it using SWAR or SIMD techniques (e.g. via two V256 vectors)
 //
@@ -896,3 +898,147 @@ GenTree* Compiler::impUtf16SpanComparison(StringComparisonKind kind, CORINFO_SIG
     }
     return unrolled;
 }
+
+//------------------------------------------------------------------------
+// impExpandSequenceEqualVariableLength: expand SpanHelpers.SequenceEqual(left, right, len)
+//    with a non-constant len into unrolled comparisons for short lengths, e.g.:
+//
+//    len > 64 ? SequenceEqual(left, right, len) :
+//    len >= 32 ? ((*(V256*)left ^ *(V256*)right) | (*(V256*)(left + len - 32) ^ *(V256*)(right + len - 32))) == 0 :
+//    len >= 16 ? <same with V128> :
+//    len >= 8  ? <same with ulong> :
+//    len >= 4  ? <same with uint> :
+//    len >= 2  ? <same with ushort> :
+//    len == 0  ? true : *(byte*)left == *(byte*)right
+//
+//    Each bucket covers lengths in [width..width*2] with two overlapping loads per side,
+//    so the largest bucket decides how long the inputs can be without calling the helper.
+//
+// Arguments:
+//    call - SpanHelpers.SequenceEqual call
+//
+// Return Value:
+//    A QMARK tree with the expansion, or the original call if the expansion is not
+//    possible or not profitable.
+//
+GenTree* Compiler::impExpandSequenceEqualVariableLength(GenTreeCall* call)
+{
+    assert(call->IsSpecialIntrinsic(this, NI_System_SpanHelpers_SequenceEqual));
+    assert(call->gtArgs.CountUserArgs() == 3);
+
+#ifdef TARGET_64BIT
+    if (!JitConfig.JitUnrollVariableLengthMemcmp() || !opts.OptimizationEnabled() || opts.IsInstrumented() ||
+        (compCodeOpt() == SMALL_CODE) || compCurBB->isRunRarely() || call->IsInlineCandidate())
+    {
+        return call;
+    }
+
+    if (call->gtArgs.GetUserArgByIndex(2)->GetNode()->OperIsConst())
+    {
+        // Lowering unrolls the constant length case.
+        return call;
+    }
+
+    unsigned maxLoadWidth = 8;
+#ifdef FEATURE_HW_INTRINSICS
+    if (IsBaselineSimdIsaSupported())
+    {
+        maxLoadWidth = 16;
+    }
+#ifdef TARGET_XARCH
+    if (compOpportunisticallyDependsOn(InstructionSet_AVX2))
+    {
+        // We need AVX2 for NI_Vector256_op_Equality
+        maxLoadWidth = 32;
+    }
+#endif // TARGET_XARCH
+#endif // FEATURE_HW_INTRINSICS
+
+    JITDUMP("Unrolling SequenceEqual [%06u] with non-constant length for lengths up to %u\n", dspTreeID(call),
+            maxLoadWidth * 2);
+
+    // Spill all the arguments to temp locals to preserve the execution order,
+    // the call keeps one copy and the expansion clones the other one.
+    GenTree* args[3];
+    for (unsigned i = 0; i < 3; i++)
+    {
+        GenTree** node = &call->gtArgs.GetUserArgByIndex(i)->EarlyNodeRef();
+        args[i]        = impCloneExpr(*node, node, CHECK_SPILL_ALL, nullptr DEBUGARG("spilling SequenceEqual arg"));
+    }
+
+    GenTree* const left  = args[0];
+    GenTree* const right = args[1];
+    GenTree* const len   = args[2];
+
+    // Compares [0..width) and [len - width..len) of both sides, valid for len in [width..width*2]
+    auto comparePair = [&](unsigned width) -> GenTree* {
+        var_types loadType;
+        switch (width)
+        {
+            case 2:
+                loadType = TYP_USHORT;
+                break;
+            case 4:
+                loadType = TYP_INT;
+                break;
+            case 8:
+                loadType = TYP_LONG;
+                break;
+            default:
+                loadType = getSIMDTypeForSize(width);
+                break;
+        }
+
+        GenTree* lOffs = gtNewOperNode(GT_SUB, TYP_I_IMPL, gtCloneExpr(len), gtNewIconNode(width, TYP_I_IMPL));
+        GenTree* rOffs = gtNewOperNode(GT_SUB, TYP_I_IMPL, gtCloneExpr(len), gtNewIconNode(width, TYP_I_IMPL));
+        GenTree* l1    = gtNewIndir(loadType, gtCloneExpr(left));
+        GenTree* r1    = gtNewIndir(loadType, gtCloneExpr(right));
+        GenTree* l2    = gtNewIndir(loadType, gtNewOperNode(GT_ADD, TYP_BYREF, gtCloneExpr(left), lOffs));
+        GenTree* r2    = gtNewIndir(loadType, gtNewOperNode(GT_ADD, TYP_BYREF, gtCloneExpr(right), rOffs));
+
+#ifdef FEATURE_HW_INTRINSICS
+        if (varTypeIsSIMD(loadType))
+        {
+            const CorInfoType baseType = CORINFO_TYPE_NATIVEUINT;
+
+            GenTree* xor1 = gtNewSimdBinOpNode(GT_XOR, loadType, l1, r1, baseType, width);
+            GenTree* xor2 = gtNewSimdBinOpNode(GT_XOR, loadType, l2, r2, baseType, width);
+            GenTree* orr  = gtNewSimdBinOpNode(GT_OR, loadType, xor1, xor2, baseType, width);
+            return gtNewSimdCmpOpAllNode(GT_EQ, TYP_INT, orr, gtNewZeroConNode(loadType), baseType, width);
+        }
+#endif // FEATURE_HW_INTRINSICS
+
+        const var_types actualType = genActualType(loadType);
+
+        GenTree* xor1 = gtNewOperNode(GT_XOR, actualType, l1, r1);
+        GenTree* xor2 = gtNewOperNode(GT_XOR, actualType, l2, r2);
+        GenTree* orr  = gtNewOperNode(GT_OR, actualType, xor1, xor2);
+        return gtNewOperNode(GT_EQ, TYP_INT, orr, gtNewZeroConNode(actualType));
+    };
+
+    // len == 0 ? true : (*(byte*)left == *(byte*)right)
+    GenTree* byteCmp = gtNewOperNode(GT_EQ, TYP_INT, gtNewIndir(TYP_UBYTE, gtCloneExpr(left)),
+                                     gtNewIndir(TYP_UBYTE, gtCloneExpr(right)));
+    GenTree* isEmpty = gtNewOperNode(GT_EQ, TYP_INT, gtCloneExpr(len), gtNewIconNode(0, TYP_I_IMPL));
+    GenTree* result  = gtNewQmarkNode(TYP_INT, isEmpty, gtNewColonNode(TYP_INT, gtNewIconNode(1), byteCmp));
+
+    for (unsigned width = 2; width <= maxLoadWidth; width *= 2)
+    {
+        GenTree* inBucket = gtNewOperNode(GT_GE, TYP_INT, gtCloneExpr(len), gtNewIconNode(width, TYP_I_IMPL));
+        inBucket->SetUnsigned();
+        result = gtNewQmarkNode(TYP_INT, inBucket, gtNewColonNode(TYP_INT, comparePair(width), result));
+    }
+
+    GenTree* tooLong = gtNewOperNode(GT_GT, TYP_INT, gtCloneExpr(len), gtNewIconNode(maxLoadWidth * 2, TYP_I_IMPL));
+    tooLong->SetUnsigned();
+    GenTreeQmark* qmark = gtNewQmarkNode(TYP_INT, tooLong, gtNewColonNode(TYP_INT, call, result));
+
+    JITDUMP("\n\nResulting tree:\n")
+    DISPTREE(qmark)
+
+    return qmark;
+#else  // !TARGET_64BIT
+    // Without 8-byte scalar loads the bucket widths can't double up to the SIMD width.
+    return call;
+#endif // !TARGET_64BIT
+}
@@ -978,46 +978,6 @@ bool Compiler::optWidenPrimaryIV(FlowGraphNaturalLoop* loop,
     return true;
 }
 
-//------------------------------------------------------------------------
-// optVisitBoundingExitingBlocks: Visit all the exiting BBJ_COND blocks of the
-// loop that dominate all the loop's backedges. These exiting blocks bound the
-// trip count of the loop.
-//
-// Parameters:
-//   loop - The loop
-//   func - The functor, of type void(BasicBlock*).
-//
-template <typename TFunctor>
-void Compiler::optVisitBoundingExitingCondBlocks(FlowGraphNaturalLoop* loop, TFunctor func)
-{
-    BasicBlock* dominates = nullptr;
-
-    for (FlowEdge* backEdge : loop->BackEdges())
-    {
-        if (dominates == nullptr)
-        {
-            dominates = backEdge->getSourceBlock();
-        }
-        else
-        {
-            dominates = m_domTree->Intersect(dominates, backEdge->getSourceBlock());
-        }
-    }
-
-    bool changed = false;
-    while ((dominates != nullptr) && loop->ContainsBlock(dominates))
-    {
-        if (dominates->KindIs(BBJ_COND) &&
-            (!loop->ContainsBlock(dominates->GetTrueTarget()) || !loop->ContainsBlock(dominates->GetFalseTarget())))
-        {
-            // 'dominates' is an exiting block that dominates all backedges.
-            func(dominates);
-        }
-
-        dominates = dominates->bbIDom;
-    }
-}
-
 //------------------------------------------------------------------------
 // optMakeLoopDownwardsCounted: Transform a loop to be downwards counted if
 // profitable and legal.
@@ -2379,6 +2339,224 @@ bool Compiler::optIsUpdateOfIVWithoutSideEffects(GenTree* tree, unsigned lclNum)
     return true;
 }
 
+#if defined(FEATURE_HW_INTRINSICS) && (defined(TARGET_XARCH) || defined(TARGET_ARM64))
+//------------------------------------------------------------------------
+// optIsLoopVectorizationCandidate: Check if a loop is a simple counted loop
+// whose body is an elementwise map or an integral reduction over contiguous
+// memory, such that it could be vectorized with a scalar epilogue.
+//
+// Parameters:
+//   scevContext - Context for scalar evolution
+//   loop        - Loop to check
+//
+// Returns:
+//   True if the loop is a vectorization candidate.
+//
+// Remarks:
+//   The loop must consist of a single block that exits through its own
+//   BBJ_COND with a computable trip count. Every indirection in the body has
+//   to be a non-volatile access to a primitive of the same type, with an
+//   address that is an add recurrence stepping by the element size, and no
+//   range checks may remain (loop cloning or RangeCheck must have removed
+//   them). The only loop-carried locals allowed are add recurrences and
+//   integral ADD/OR/AND/XOR reductions.
+//
+bool Compiler::optIsLoopVectorizationCandidate(ScalarEvolutionContext& scevContext, FlowGraphNaturalLoop* loop)
+{
+    if (loop->NumLoopBlocks() != 1)
+    {
+        JITDUMP("  Loop has %u blocks; not a vectorization candidate\n", loop->NumLoopBlocks());
+        return false;
+    }
+
+    BasicBlock* block = loop->GetHeader();
+    if (!block->KindIs(BBJ_COND) || (loop->ExitEdges().size() != 1))
+    {
+        JITDUMP("  Loop does not exit through a single conditional test; not a vectorization candidate\n");
+        return false;
+    }
+
+    Scev* backedgeCount = scevContext.ComputeExitNotTakenCount(block);
+    if (backedgeCount == nullptr)
+    {
+        JITDUMP("  Could not compute backedge count; not a vectorization candidate\n");
+        return false;
+    }
+
+    var_types elemType   = TYP_UNDEF;
+    unsigned  numLoads   = 0;
+    unsigned  numStores  = 0;
+    unsigned  numReduces = 0;
+
+    auto isVectorizableAccess = [&](GenTreeIndir* indir) {
+        var_types accessType = indir->TypeGet();
+        if (!varTypeIsArithmetic(accessType) || indir->IsVolatile())
+        {
+            JITDUMP("  [%06u] is not a simple primitive access\n", dspTreeID(indir));
+            return false;
+        }
+
+        if ((elemType != TYP_UNDEF) && (elemType != accessType))
+        {
+            JITDUMP("  [%06u] accesses %s while other accesses are %s\n", dspTreeID(indir), varTypeName(accessType),
+                    varTypeName(elemType));
+            return false;
+        }
+
+        Scev* addr = scevContext.Analyze(block, indir->Addr());
+        if (addr != nullptr)
+        {
+            addr = scevContext.Simplify(addr);
+        }
+
+        int64_t step;
+        if ((addr == nullptr) || !addr->OperIs(ScevOper::AddRec) ||
+            !static_cast<ScevAddRec*>(addr)->Step->GetConstantValue(this, &step) ||
+            (step != (int64_t)genTypeSize(accessType)))
+        {
+            JITDUMP("  [%06u] address is not a unit stride add recurrence\n", dspTreeID(indir));
+            return false;
+        }
+
+        elemType = accessType;
+        return true;
+    };
+
+    for (Statement* stmt : block->Statements())
+    {
+        GenTree* root = stmt->GetRootNode();
+        if (stmt->IsPhiDefnStmt() || root->OperIs(GT_JTRUE))
+        {
+            continue;
+        }
+
+        for (GenTree* node : stmt->TreeList())
+        {
+            if (node->OperIs(GT_BOUNDS_CHECK))
+            {
+                JITDUMP("  [%06u] is a remaining range check; not a vectorization candidate\n", dspTreeID(node));
+                return false;
+            }
+
+            if (node->IsCall() || node->OperIsAtomicOp() || node->OperIsBlk() || node->OperIsHWIntrinsic())
+            {
+                JITDUMP("  [%06u] has unsupported side effects; not a vectorization candidate\n", dspTreeID(node));
+                return false;
+            }
+
+            if (node->OperIs(GT_IND, GT_STOREIND))
+            {
+                if (!isVectorizableAccess(node->AsIndir()))
+                {
+                    return false;
+                }
+
+                if (node->OperIs(GT_STOREIND))
+                {
+                    numStores++;
+                }
+                else
+                {
+                    numLoads++;
+                }
+            }
+            else if (node->OperIsLocalStore() && ((node != root) || !node->OperIs(GT_STORE_LCL_VAR)))
+            {
+                JITDUMP("  [%06u] is an unsupported local store; not a vectorization candidate\n", dspTreeID(node));
+                return false;
+            }
+            else if (node->OperIs(GT_LCL_ADDR, GT_LCL_FLD))
+            {
+                JITDUMP("  [%06u] is an unsupported local access; not a vectorization candidate\n", dspTreeID(node));
+                return false;
+            }
+        }
+
+        if (!root->OperIs(GT_STORE_LCL_VAR))
+        {
+            if (!root->OperIs(GT_STOREIND))
+            {
+                JITDUMP("  " FMT_STMT " is not a store; not a vectorization candidate\n", stmt->GetID());
+                return false;
+            }
+
+            continue;
+        }
+
+        GenTreeLclVarCommon* store  = root->AsLclVarCommon();
+        unsigned             lclNum = store->GetLclNum();
+        if (!lvaInSsa(lclNum))
+        {
+            JITDUMP("  V%02u is not in SSA; not a vectorization candidate\n", lclNum);
+            return false;
+        }
+
+        bool isLoopCarried = false;
+        for (Statement* phiStmt : block->Statements())
+        {
+            if (!phiStmt->IsPhiDefnStmt())
+            {
+                break;
+            }
+
+            if (phiStmt->GetRootNode()->AsLclVarCommon()->GetLclNum() == lclNum)
+            {
+                isLoopCarried = true;
+                break;
+            }
+        }
+
+        if (!isLoopCarried)
+        {
+            // A temp that lives within a single iteration.
+            continue;
+        }
+
+        Scev* value = scevContext.Analyze(block, store);
+        if ((value != nullptr) && value->OperIs(ScevOper::AddRec))
+        {
+            // An induction variable; the vector loop will step it by the
+            // vector width instead.
+            continue;
+        }
+
+        GenTree* data = store->Data();
+        if (!varTypeIsIntegral(data) || !data->OperIs(GT_ADD, GT_OR, GT_AND, GT_XOR) || data->gtOverflow())
+        {
+            JITDUMP("  V%02u is loop carried but is not an induction variable or a reduction\n", lclNum);
+            return false;
+        }
+
+        GenTree* op1 = data->gtGetOp1();
+        GenTree* op2 = data->gtGetOp2();
+        if (!(op1->OperIs(GT_LCL_VAR) && (op1->AsLclVarCommon()->GetLclNum() == lclNum)) &&
+            !(op2->OperIs(GT_LCL_VAR) && (op2->AsLclVarCommon()->GetLclNum() == lclNum)))
+        {
+            JITDUMP("  V%02u is loop carried but is not a reduction of itself\n", lclNum);
+            return false;
+        }
+
+        numReduces++;
+    }
+
+    if ((elemType == TYP_UNDEF) || ((numStores == 0) && (numReduces == 0)))
+    {
+        JITDUMP("  Loop has no elementwise stores or reductions; not a vectorization candidate\n");
+        return false;
+    }
+
+    unsigned vectorByteLength = getPreferredVectorByteLength();
+    unsigned laneCount        = vectorByteLength / genTypeSize(elemType);
+
+    JITDUMP("  Loop is a vectorization candidate: %u loads, %u stores, %u reductions of %s, %u lanes, backedge count ",
+            numLoads, numStores, numReduces, varTypeName(elemType), laneCount);
+    DBEXEC(verbose, backedgeCount->Dump(this));
+    JITDUMP("\n");
+
+    return laneCount > 1;
+}
+#endif // FEATURE_HW_INTRINSICS && (TARGET_XARCH || TARGET_ARM64)
+
 //------------------------------------------------------------------------
 // optInductionVariables: Try and optimize induction variables in the method.
 //
@@ -2466,6 +2644,13 @@ PhaseStatus Compiler::optInductionVariables()
         {
             changed = true;
         }
+
+#if defined(FEATURE_HW_INTRINSICS) && (defined(TARGET_XARCH) || defined(TARGET_ARM64))
+        if ((JitConfig.JitEnableLoopVectorization() != 0) && optIsLoopVectorizationCandidate(scevContext, loop))
+        {
+            Metrics.LoopVectorizationCandidates++;
+        }
+#endif
     }
 
     fgInvalidateDfsTree();
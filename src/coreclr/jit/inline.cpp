@@ -1221,7 +1221,9 @@ void InlineStrategy::NoteOutcome(InlineContext* context)
 //     exceed the jit time budget for this method
 //
 // Arguments:
-//     ilSize - size of the method's IL
+//     ilSize        - size of the method's IL
+//     budgetPercent - share, in percent, of the budget headroom over the
+//                     root method's time estimate that may be used
 //
 // Return Value:
 //     true if the inline would go over budget
@@ -1229,15 +1231,22 @@ void InlineStrategy::NoteOutcome(InlineContext* context)
 // Notes:
 //     Presumes all IL in the method will be imported.
 
-bool InlineStrategy::BudgetCheck(unsigned ilSize)
+bool InlineStrategy::BudgetCheck(unsigned ilSize, unsigned budgetPercent)
 {
-    const int  timeDelta = EstimateInlineTime(ilSize);
-    const bool result    = (timeDelta + m_CurrentTimeEstimate > m_CurrentTimeBudget);
+    const int timeDelta = EstimateInlineTime(ilSize);
+    int       budget    = m_CurrentTimeBudget;
+
+    if (budgetPercent < 100)
+    {
+        budget = m_InitialTimeEstimate + (int)(((INT64)(budget - m_InitialTimeEstimate) * budgetPercent) / 100);
+    }
+
+    const bool result = (timeDelta + m_CurrentTimeEstimate > budget);
 
     if (result)
     {
-        JITDUMP("\nBudgetCheck: for IL Size %d, timeDelta %d +  currentEstimate %d > currentBudget %d\n", ilSize,
-                timeDelta, m_CurrentTimeEstimate, m_CurrentTimeBudget);
+        JITDUMP("\nBudgetCheck: for IL Size %d, timeDelta %d +  currentEstimate %d > currentBudget %d (%u%%)\n", ilSize,
+                timeDelta, m_CurrentTimeEstimate, budget, budgetPercent);
     }
 
     return result;
@@ -1012,9 +1012,9 @@ public:
     // Dump csv data for inline stats to indicated file.
     void DumpCsvData(FILE* f);
 
-    // See if an inline of this size would fit within the current jit
-    // time budget.
-    bool BudgetCheck(unsigned ilSize);
+    // See if an inline of this size would fit within the given share
+    // of the current jit time budget.
+    bool BudgetCheck(unsigned ilSize, unsigned budgetPercent = 100);
 
     // Check if inlining is disabled for the method being jitted
     bool IsInliningDisabled();
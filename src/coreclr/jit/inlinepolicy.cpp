@@ -1387,7 +1387,7 @@ void ExtendedDefaultPolicy::NoteInt(InlineObservation obs, int value)
             unsigned maxCodeSize = static_cast<unsigned>(JitConfig.JitExtDefaultPolicyMaxIL());
 
             // TODO: Enable for PgoSource::Static as well if it's not the generic profile we bundle.
-            if (m_HasProfileWeights && (m_RootCompiler->fgHaveTrustedProfileWeights()))
+            if (IsProfileHotCallsite())
             {
                 maxCodeSize = static_cast<unsigned>(JitConfig.JitExtDefaultPolicyMaxILProf());
             }
@@ -1412,8 +1412,17 @@ void ExtendedDefaultPolicy::NoteInt(InlineObservation obs, int value)
             }
             else if (m_CodeSize <= maxCodeSize)
             {
-                // Candidate, pending profitability evaluation
-                SetCandidate(InlineObservation::CALLEE_IS_DISCRETIONARY_INLINE);
+                if (IsProfileColdCallsite())
+                {
+                    // Profile data says this site barely runs; don't spend
+                    // budget on a discretionary inline here.
+                    SetFailure(InlineObservation::CALLSITE_IS_PROFILE_COLD);
+                }
+                else
+                {
+                    // Candidate, pending profitability evaluation
+                    SetCandidate(InlineObservation::CALLEE_IS_DISCRETIONARY_INLINE);
+                }
             }
             else
             {
@@ -1502,6 +1511,86 @@ unsigned ExtendedDefaultPolicy::EstimatedTotalILSize() const
     return (unsigned)codeSize;
 }
 
+//------------------------------------------------------------------------
+// BudgetCheck: see if this inline would exceed the current budget
+//
+// Returns:
+//   True if inline would exceed the budget.
+//
+// Notes:
+//   With trusted profile data, call sites that are not hot may only use
+//   part of the remaining budget, so that most of it is left for the hot
+//   sites that are likely to pay off.
+//
+bool ExtendedDefaultPolicy::BudgetCheck() const
+{
+    if (DefaultPolicy::BudgetCheck())
+    {
+        return true;
+    }
+
+    if (m_IsPrejitRoot || m_IsForceInline || !HasTrustedProfileFrequency() || IsProfileHotCallsite())
+    {
+        return false;
+    }
+
+    // Like the default budget check, let small getters/setters through.
+    const unsigned skipBudgetChecksSize = 12;
+    if (m_CodeSize <= skipBudgetChecksSize)
+    {
+        return false;
+    }
+
+    const unsigned  coldBudget = static_cast<unsigned>(JitConfig.JitExtDefaultPolicyProfColdBudget());
+    InlineStrategy* strategy   = m_RootCompiler->m_inlineStrategy;
+    if (!strategy->BudgetCheck(EstimatedTotalILSize(), coldBudget))
+    {
+        return false;
+    }
+
+    JITDUMP("\nCallsite frequency %g is not hot; inline exceeds the %u%% budget share for such sites\n",
+            m_ProfileFrequency, coldBudget);
+    return true;
+}
+
+//------------------------------------------------------------------------
+// HasTrustedProfileFrequency: check if the call site frequency comes from
+//   profile data that is trusted enough to base decisions on
+//
+// Returns:
+//   True if there is such profile data.
+//
+bool ExtendedDefaultPolicy::HasTrustedProfileFrequency() const
+{
+    return m_HasProfileWeights && m_RootCompiler->fgHaveTrustedProfileWeights();
+}
+
+//------------------------------------------------------------------------
+// IsProfileHotCallsite: check if profile data shows the call site is hot
+//
+// Returns:
+//   True if the site runs at least JitExtDefaultPolicyProfHotFreq percent
+//   as often as the root method's entry.
+//
+bool ExtendedDefaultPolicy::IsProfileHotCallsite() const
+{
+    return HasTrustedProfileFrequency() &&
+           (m_ProfileFrequency * 100.0 >= (double)JitConfig.JitExtDefaultPolicyProfHotFreq());
+}
+
+//------------------------------------------------------------------------
+// IsProfileColdCallsite: check if profile data shows the call site is cold
+//
+// Returns:
+//   True if the site runs less than JitExtDefaultPolicyProfColdFreq percent
+//   as often as the root method's entry.
+//
+bool ExtendedDefaultPolicy::IsProfileColdCallsite() const
+{
+    return !m_IsPrejitRoot && HasTrustedProfileFrequency() &&
+           (m_ProfileFrequency * 100.0 < (double)JitConfig.JitExtDefaultPolicyProfColdFreq());
+}
+
 //------------------------------------------------------------------------
 // DetermineMultiplier: determine benefit multiplier for this inline
 //
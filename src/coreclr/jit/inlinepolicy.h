@@ -234,6 +234,8 @@ public:
 
     double DetermineMultiplier() override;
 
+    bool BudgetCheck() const override;
+
     unsigned EstimatedTotalILSize() const override;
 
     bool RequiresPreciseScan() override
@@ -277,6 +279,11 @@ protected:
     bool     m_NonGenericCallsGeneric     : 1;
     bool     m_IsCallsiteInNoReturnRegion : 1;
     bool     m_HasProfileWeights          : 1;
+
+private:
+    bool HasTrustedProfileFrequency() const;
+    bool IsProfileHotCallsite() const;
+    bool IsProfileColdCallsite() const;
 };
 
 // DiscretionaryPolicy is a variant of the default policy.  It
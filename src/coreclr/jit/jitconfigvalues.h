@@ -530,6 +530,13 @@ RELEASE_CONFIG_INTEGER(JitEnableNoWayAssert, W("JitEnableNoWayAssert"), 1)
 // TODO-Cleanup: need to make 'MEASURE_MEM_ALLOC' well-defined here at all times.
 RELEASE_CONFIG_INTEGER(DisplayMemStats, W("JitMemStats"), 0) // Display JIT memory usage statistics
 
+// Number of default sized arena pages each thread keeps between compilations instead of
+// returning them to the host.
+RELEASE_CONFIG_INTEGER(JitArenaPagePoolSize, W("JitArenaPagePoolSize"), 4)
+
+// If 1, report the end of each phase to the host through reportMetadata("PhaseEnd", <phase name>)
+RELEASE_CONFIG_INTEGER(JitReportPhaseEnds, W("JitReportPhaseEnds"), 0)
+
 CONFIG_INTEGER(JitEnregStats, W("JitEnregStats"), 0) // Display JIT enregistration statistics
 
 RELEASE_CONFIG_INTEGER(JitAggressiveInlining, W("JitAggressiveInlining"), 0) // Aggressive inlining of all methods
@@ -553,6 +560,8 @@ OPT_CONFIG_INTEGER(JitDoRangeAnalysis, W("JitDoRangeAnalysis"), 1) // Perform ra
 OPT_CONFIG_INTEGER(JitDoVNBasedDeadStoreRemoval, W("JitDoVNBasedDeadStoreRemoval"), 1) // Perform VN-based dead store
                                                                                        // removal
 OPT_CONFIG_INTEGER(JitDoRedundantBranchOpts, W("JitDoRedundantBranchOpts"), 1) // Perform redundant branch optimizations
+OPT_CONFIG_INTEGER(JitDoPartialRedundancyElim, W("JitDoPartialRedundancyElim"), 1) // Perform partial redundancy
+                                                                                    // elimination
 OPT_CONFIG_STRING(JitEnableRboRange, W("JitEnableRboRange"))
 OPT_CONFIG_STRING(JitEnableHeadTailMergeRange, W("JitEnableHeadTailMergeRange"))
 OPT_CONFIG_STRING(JitEnableVNBasedDeadStoreRemovalRange, W("JitEnableVNBasedDeadStoreRemovalRange"))
@@ -643,6 +652,14 @@ RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyMaxBB, W("JitExtDefaultPolicyMaxBB"),
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfTrust, W("JitExtDefaultPolicyProfTrust"), 0x7)
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfScale, W("JitExtDefaultPolicyProfScale"), 0x2A)
 
+// With trusted (dynamic) PGO, call sites are classified by their frequency relative to the caller's entry,
+// in percent. Hot sites may inline callees up to JitExtDefaultPolicyMaxILProf, cold sites only get
+// always-inline candidates, and sites that are not hot may only spend JitExtDefaultPolicyProfColdBudget
+// percent of the remaining inlining time budget.
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfHotFreq, W("JitExtDefaultPolicyProfHotFreq"), 50)
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfColdFreq, W("JitExtDefaultPolicyProfColdFreq"), 1)
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfColdBudget, W("JitExtDefaultPolicyProfColdBudget"), 50)
+
 RELEASE_CONFIG_INTEGER(JitInlinePolicyModel, W("JitInlinePolicyModel"), 0)
 RELEASE_CONFIG_INTEGER(JitInlinePolicyProfile, W("JitInlinePolicyProfile"), 0)
 RELEASE_CONFIG_INTEGER(JitInlinePolicyProfileThreshold, W("JitInlinePolicyProfileThreshold"), 40)
@@ -650,6 +667,7 @@ CONFIG_STRING(JitObjectStackAllocationRange, W("JitObjectStackAllocationRange"))
 RELEASE_CONFIG_INTEGER(JitObjectStackAllocation, W("JitObjectStackAllocation"), 1)
 RELEASE_CONFIG_INTEGER(JitObjectStackAllocationRefClass, W("JitObjectStackAllocationRefClass"), 1)
 RELEASE_CONFIG_INTEGER(JitObjectStackAllocationBoxedValueClass, W("JitObjectStackAllocationBoxedValueClass"), 1)
+RELEASE_CONFIG_INTEGER(JitObjectStackAllocationArray, W("JitObjectStackAllocationArray"), 1)
 
 RELEASE_CONFIG_INTEGER(JitEECallTimingInfo, W("JitEECallTimingInfo"), 0)
 
@@ -664,6 +682,10 @@ RELEASE_CONFIG_INTEGER(JitEnableGuardedDevirtualization, W("JitEnableGuardedDevi
 // Max number is MAX_GDV_TYPE_CHECKS defined above ^. -1 means it's up to JIT to decide
 RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationMaxTypeChecks, W("JitGuardedDevirtualizationMaxTypeChecks"), -1)
 
+// Size the guard chain of virtual and interface call sites by comparing the expected
+// guard cost against the expected dispatch savings, instead of fixed likelihood thresholds
+RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationCostModel, W("JitGuardedDevirtualizationCostModel"), 1)
+
 // Various policies for GuardedDevirtualization (0x4B == 75)
 RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationChainLikelihood, W("JitGuardedDevirtualizationChainLikelihood"), 0x4B)
 RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationChainStatements, W("JitGuardedDevirtualizationChainStatements"), 1)
@@ -772,12 +794,34 @@ RELEASE_CONFIG_INTEGER(JitEnableCrossBlockLocalAssertionProp, W("JitEnableCrossB
 // Do greedy RPO-based layout in Compiler::fgReorderBlocks.
 RELEASE_CONFIG_INTEGER(JitDoReversePostOrderLayout, W("JitDoReversePostOrderLayout"), 1);
 
+// Refine the RPO-based layout of hot blocks with 3-opt segment swaps over profile weights.
+RELEASE_CONFIG_INTEGER(JitDoThreeOptLayout, W("JitDoThreeOptLayout"), 1)
+
+// With trusted profile data, blocks that run less often than this percentage of the
+// method's calls are cold for procedure splitting. 0 means only rarely run blocks are cold.
+RELEASE_CONFIG_INTEGER(JitSplitColdWeightPercent, W("JitSplitColdWeightPercent"), 1)
+
 // Enable strength reduction
 RELEASE_CONFIG_INTEGER(JitEnableStrengthReduction, W("JitEnableStrengthReduction"), 1)
 
 // Enable IV optimizations
 RELEASE_CONFIG_INTEGER(JitEnableInductionVariableOpts, W("JitEnableInductionVariableOpts"), 1)
 
+// Enable using scalar evolution of induction variables to remove bounds checks in counted loops
+RELEASE_CONFIG_INTEGER(JitEnableRangeCheckScev, W("JitEnableRangeCheckScev"), 1)
+
+// Skip the SSA-based optimizer for loop-free dynamic methods and IL stubs with at most this many bytes of IL
+RELEASE_CONFIG_INTEGER(JitDynamicMethodFastOptILSize, W("JitDynamicMethodFastOptILSize"), 32)
+
+// Enable hoisting of helper calls that may run a precise-init class constructor out of loop headers
+RELEASE_CONFIG_INTEGER(JitHoistPreciseInitHelpers, W("JitHoistPreciseInitHelpers"), 1)
+
+// Enable recognition of simple counted loops that can be vectorized
+RELEASE_CONFIG_INTEGER(JitEnableLoopVectorization, W("JitEnableLoopVectorization"), 0)
+
+// Unroll SpanHelpers.SequenceEqual with a non-constant length for short lengths
+RELEASE_CONFIG_INTEGER(JitUnrollVariableLengthMemcmp, W("JitUnrollVariableLengthMemcmp"), 1)
+
 // JitFunctionFile: Name of a file that contains a list of functions. If the currently compiled function is in the
 // file, certain other JIT config variables will be active. If the currently compiled function is not in the file,
 // the specific JIT config variables will not be active.
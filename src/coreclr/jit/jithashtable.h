@@ -864,6 +864,711 @@ private:
     unsigned     m_tableMax;      // maximum occupied count
 };
 
+// JitOpenHashTable is a variant of JitHashTable that stores the keys and values in the bucket
+// array itself, using open addressing with linear probing. It takes the same template parameters
+// as JitHashTable and has the same API, but it only allocates when the table grows and a lookup
+// doesn't chase per-node pointers, which suits the large, insert-mostly maps on hot paths.
+//
+// Unlike JitHashTable, growing the table (i.e. adding a key) and removing a key move the other
+// entries, so a pointer returned by LookupPointer, LookupPointerOrAdd or Emplace, or a Node*
+// from KeyValueIteration, is only valid until the next addition or removal. Keys and values are
+// moved as if by memcpy and are not destroyed, as is expected of arena allocated data.
+//
+// The table size is a power of two and the hash codes are scrambled with Fibonacci hashing
+// before being reduced to an index, so that KeyFuncs don't need to spread their hash codes.
+//
+template <typename Key,
+          typename KeyFuncs,
+          typename Value,
+          typename Allocator = CompAllocator,
+          typename Behavior  = JitHashTableBehavior>
+class JitOpenHashTable
+{
+public:
+    // The node type, i.e. a bucket of the table.
+    // The only reason this class is public is to support the NodeIterator and KeyValueIteration. Only GetKey()
+    // and GetValue() need to be public methods.
+    class Node
+    {
+        friend class JitOpenHashTable;
+
+        Key   m_key;
+        Value m_val;
+        bool  m_used;
+
+    public:
+        Key GetKey() const
+        {
+            return m_key;
+        }
+
+        Value GetValue() const
+        {
+            return m_val;
+        }
+    };
+
+    //------------------------------------------------------------------------
+    // JitOpenHashTable: Construct an empty JitOpenHashTable object.
+    //
+    // Arguments:
+    //    alloc - the allocator to be used by the new JitOpenHashTable object
+    //
+    // Notes:
+    //    JitOpenHashTable always starts out empty, with no allocation overhead.
+    //    Call Reallocate to prime with an initial size if desired.
+    //
+    JitOpenHashTable(Allocator alloc)
+        : m_alloc(alloc)
+        , m_table(nullptr)
+        , m_tableSize(0)
+        , m_tableShift(32)
+        , m_tableCount(0)
+        , m_tableMax(0)
+    {
+#ifndef __GNUC__ // these crash GCC
+        static_assert_no_msg(Behavior::s_growth_factor_numerator > Behavior::s_growth_factor_denominator);
+        static_assert_no_msg(Behavior::s_density_factor_numerator < Behavior::s_density_factor_denominator);
+#endif
+    }
+
+    //------------------------------------------------------------------------
+    // ~JitOpenHashTable: Destruct the JitOpenHashTable object.
+    //
+    // Notes:
+    //    Frees all owned memory.
+    //
+    ~JitOpenHashTable()
+    {
+        RemoveAll();
+    }
+
+    //------------------------------------------------------------------------
+    // Lookup: Get the value associated to the specified key, if any.
+    //
+    // Arguments:
+    //    k    - the key
+    //    pVal - pointer to a location used to store the associated value
+    //
+    // Return Value:
+    //    `true` if the key exists, `false` otherwise
+    //
+    // Notes:
+    //    If the key does not exist *pVal is not updated. pVal may be nullptr
+    //    so this function can be used to simply check if the key exists.
+    //
+    bool Lookup(Key k, Value* pVal = nullptr) const
+    {
+        Node* pN = FindNode(k);
+
+        if (pN != nullptr)
+        {
+            if (pVal != nullptr)
+            {
+                *pVal = pN->m_val;
+            }
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // LookupPointer: Get a pointer to the value associated to the specified key.
+    // if any.
+    //
+    // Arguments:
+    //    k - the key
+    //
+    // Return Value:
+    //    A pointer to the value associated with the specified key or nullptr
+    //    if the key is not found. The pointer is valid until the next addition
+    //    or removal.
+    //
+    Value* LookupPointer(Key k) const
+    {
+        Node* pN = FindNode(k);
+
+        if (pN != nullptr)
+        {
+            return &(pN->m_val);
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // LookupPointerOrAdd: Get a pointer to the value associated to the specified key.
+    // If not present, add it with the specified default value and return a pointer to it.
+    //
+    // Arguments:
+    //    k - the key
+    //    defaultValue - Default value to add to the table if the key was not present
+    //
+    // Return Value:
+    //    A pointer to the value associated with the specified key, valid until
+    //    the next addition or removal.
+    //
+    Value* LookupPointerOrAdd(Key k, Value defaultValue)
+    {
+        CheckGrowth();
+
+        Node* n = FindNodeOrEmpty(k);
+        if (!n->m_used)
+        {
+            new (&n->m_key, jitstd::placement_t()) Key(k);
+            new (&n->m_val, jitstd::placement_t()) Value(defaultValue);
+            n->m_used = true;
+            m_tableCount++;
+        }
+
+        return &n->m_val;
+    }
+
+    enum SetKind
+    {
+        None,
+        Overwrite
+    };
+
+    //------------------------------------------------------------------------
+    // Set: Associate the specified value with the specified key.
+    //
+    // Arguments:
+    //    k - the key
+    //    v - the value
+    //    kind - Normal, we are not allowed to overwrite
+    //           Overwrite, we are allowed to overwrite
+    //           currently only used by CHK/DBG builds in an assert.
+    //
+    // Return Value:
+    //    `true` if the key exists and was overwritten,
+    //    `false` otherwise.
+    //
+    // Notes:
+    //    If the key already exists and kind is Normal
+    //    this method will assert
+    //
+    bool Set(Key k, Value v, SetKind kind = None)
+    {
+        CheckGrowth();
+
+        Node* n = FindNodeOrEmpty(k);
+        if (n->m_used)
+        {
+            assert(kind == Overwrite);
+            n->m_val = v;
+            return true;
+        }
+        else
+        {
+            new (&n->m_key, jitstd::placement_t()) Key(k);
+            new (&n->m_val, jitstd::placement_t()) Value(v);
+            n->m_used = true;
+            m_tableCount++;
+            return false;
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // Emplace: Associates the specified key with a value constructed in-place
+    // using the supplied args if the key is not already present.
+    //
+    // Arguments:
+    //    k - the key
+    //    args - the args used to construct the value
+    //
+    // Return Value:
+    //    A pointer to the existing or newly constructed value, valid until
+    //    the next addition or removal.
+    //
+    template <class... Args>
+    Value* Emplace(Key k, Args&&... args)
+    {
+        CheckGrowth();
+
+        Node* n = FindNodeOrEmpty(k);
+        if (!n->m_used)
+        {
+            new (&n->m_key, jitstd::placement_t()) Key(k);
+            new (&n->m_val, jitstd::placement_t()) Value(std::forward<Args>(args)...);
+            n->m_used = true;
+            m_tableCount++;
+        }
+
+        return &n->m_val;
+    }
+
+    //------------------------------------------------------------------------
+    // Remove: Remove the specified key and its associated value.
+    //
+    // Arguments:
+    //    k - the key
+    //
+    // Return Value:
+    //    `true` if the key exists, `false` otherwise.
+    //
+    // Notes:
+    //    Removing a inexistent key is not an error. The entries that follow
+    //    the removed one in its probe sequence are shifted back, so that no
+    //    tombstones are needed.
+    //
+    bool Remove(Key k)
+    {
+        Node* pN = FindNode(k);
+        if (pN == nullptr)
+        {
+            return false;
+        }
+
+        const unsigned mask  = m_tableSize - 1;
+        unsigned       index = (unsigned)(pN - m_table);
+        unsigned       next  = index;
+
+        while (true)
+        {
+            next = (next + 1) & mask;
+            if (!m_table[next].m_used)
+            {
+                break;
+            }
+
+            // The entry at `next` can fill the hole at `index` only if its home
+            // index isn't cyclically within (index, next].
+            unsigned home = GetIndexForKey(m_table[next].m_key);
+            if (((next - home) & mask) >= ((next - index) & mask))
+            {
+                memcpy((void*)&m_table[index], (void*)&m_table[next], sizeof(Node));
+                index = next;
+            }
+        }
+
+        m_table[index].m_used = false;
+        m_tableCount--;
+        return true;
+    }
+
+    //------------------------------------------------------------------------
+    // RemoveAll: Remove all keys and their associated values.
+    //
+    // Notes:
+    //    This also frees all the memory owned by the table.
+    //
+    void RemoveAll()
+    {
+        if (m_table != nullptr)
+        {
+            m_alloc.deallocate(m_table);
+        }
+
+        m_table      = nullptr;
+        m_tableSize  = 0;
+        m_tableShift = 32;
+        m_tableCount = 0;
+        m_tableMax   = 0;
+    }
+
+    //
+    // Iteration support
+    //
+
+    class NodeIterator
+    {
+    protected:
+        Node*    m_table;
+        Node*    m_node;
+        unsigned m_tableSize;
+        unsigned m_index;
+
+        //------------------------------------------------------------------------
+        // NodeIterator: Construct an iterator for the specified JitOpenHashTable.
+        //
+        // Arguments:
+        //    hash  - the hashtable
+        //    begin - `true` to construct an "begin" iterator,
+        //            `false` to construct an "end" iterator
+        //
+        NodeIterator(const JitOpenHashTable* hash, bool begin)
+            : m_table(hash->m_table)
+            , m_node(nullptr)
+            , m_tableSize(hash->m_tableSize)
+            , m_index(begin ? 0 : m_tableSize)
+        {
+            if (begin && (hash->m_tableCount > 0))
+            {
+                assert(m_table != nullptr);
+                FindUsed();
+            }
+        }
+
+        //------------------------------------------------------------------------
+        // FindUsed: Move to the first used bucket at or after m_index, if any.
+        //
+        void FindUsed()
+        {
+            while ((m_index < m_tableSize) && !m_table[m_index].m_used)
+            {
+                m_index++;
+            }
+
+            m_node = (m_index < m_tableSize) ? &m_table[m_index] : nullptr;
+        }
+
+        //------------------------------------------------------------------------
+        // Next: Advance the iterator to the next node.
+        //
+        // Notes:
+        //    Advancing the end iterator has no effect.
+        //
+        void Next()
+        {
+            if (m_node != nullptr)
+            {
+                m_index++;
+                FindUsed();
+            }
+        }
+
+    public:
+        // Advance the iterator to the next node
+        NodeIterator& operator++()
+        {
+            Next();
+            return *this;
+        }
+
+        bool operator!=(const NodeIterator& i) const
+        {
+            return i.m_node != m_node;
+        }
+    };
+
+    // KeyIterator: an iterator which yields only the hash table keys.
+    class KeyIterator : public NodeIterator
+    {
+    public:
+        KeyIterator(const JitOpenHashTable* hash, bool begin)
+            : NodeIterator(hash, begin)
+        {
+        }
+
+        Key operator*() const
+        {
+            return this->m_node->GetKey();
+        }
+    };
+
+    // ValueIterator: an iterator which yields only the hash table values.
+    class ValueIterator : public NodeIterator
+    {
+    public:
+        ValueIterator(const JitOpenHashTable* hash, bool begin)
+            : NodeIterator(hash, begin)
+        {
+        }
+
+        Value operator*() const
+        {
+            return this->m_node->GetValue();
+        }
+    };
+
+    // KeyValueIterator: an iterator which yields the hash table <key,value> pairs.
+    class KeyValueIterator : public NodeIterator
+    {
+    public:
+        KeyValueIterator(const JitOpenHashTable* hash, bool begin)
+            : NodeIterator(hash, begin)
+        {
+        }
+
+        Node* operator*() const
+        {
+            return this->m_node;
+        }
+    };
+
+    // KeyIteration: an adaptor to use for range-based `for` iteration over the hash table keys.
+    class KeyIteration
+    {
+        const JitOpenHashTable* const m_hash;
+
+    public:
+        KeyIteration(const JitOpenHashTable* hash)
+            : m_hash(hash)
+        {
+        }
+
+        KeyIterator begin() const
+        {
+            return KeyIterator(m_hash, true);
+        }
+
+        KeyIterator end() const
+        {
+            return KeyIterator(m_hash, false);
+        }
+    };
+
+    // ValueIteration: an adaptor to use for range-based `for` iteration over the hash table values.
+    class ValueIteration
+    {
+        const JitOpenHashTable* const m_hash;
+
+    public:
+        ValueIteration(const JitOpenHashTable* hash)
+            : m_hash(hash)
+        {
+        }
+
+        ValueIterator begin() const
+        {
+            return ValueIterator(m_hash, true);
+        }
+
+        ValueIterator end() const
+        {
+            return ValueIterator(m_hash, false);
+        }
+    };
+
+    // KeyValueIteration: an adaptor to use for range-based `for` iteration over the hash table <key,value> pairs.
+    class KeyValueIteration
+    {
+        const JitOpenHashTable* const m_hash;
+
+    public:
+        KeyValueIteration(const JitOpenHashTable* hash)
+            : m_hash(hash)
+        {
+        }
+
+        KeyValueIterator begin() const
+        {
+            return KeyValueIterator(m_hash, true);
+        }
+
+        KeyValueIterator end() const
+        {
+            return KeyValueIterator(m_hash, false);
+        }
+    };
+
+    // Get the number of keys currently stored in the table.
+    unsigned GetCount() const
+    {
+        return m_tableCount;
+    }
+
+    // Get the allocator used by this hash table.
+    Allocator GetAllocator()
+    {
+        return m_alloc;
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // GetIndexForKey: Get the home bucket index for the specified key.
+    //
+    // Arguments:
+    //    k - the key
+    //
+    // Return Value:
+    //    A bucket index
+    //
+    unsigned GetIndexForKey(Key k) const
+    {
+        unsigned hash = KeyFuncs::GetHashCode(k);
+
+        // Fibonacci hashing: keep the top bits of the product with 2^32 / phi.
+        // The shift is done in 64 bits so that a shift of 32 (an empty table) is defined.
+        return (unsigned)(((uint64_t)(hash * 0x9E3779B9u)) >> m_tableShift);
+    }
+
+    //------------------------------------------------------------------------
+    // FindNode: Return a pointer to the node having the specified key, if any.
+    //
+    // Arguments:
+    //    k - the key
+    //
+    // Return Value:
+    //    A pointer to the node or `nullptr` if the key is not found.
+    //
+    Node* FindNode(Key k) const
+    {
+        if (m_tableCount == 0)
+        {
+            return nullptr;
+        }
+
+        Node* pN = FindNodeOrEmpty(k);
+        return pN->m_used ? pN : nullptr;
+    }
+
+    //------------------------------------------------------------------------
+    // FindNodeOrEmpty: Return a pointer to the node having the specified key,
+    // or to the empty node where it would be added.
+    //
+    // Arguments:
+    //    k - the key
+    //
+    // Notes:
+    //    The table must not be full, so that the probe sequence ends.
+    //
+    Node* FindNodeOrEmpty(Key k) const
+    {
+        assert(m_tableCount < m_tableSize);
+
+        const unsigned mask  = m_tableSize - 1;
+        unsigned       index = GetIndexForKey(k);
+
+        while (m_table[index].m_used && !KeyFuncs::Equals(k, m_table[index].m_key))
+        {
+            index = (index + 1) & mask;
+        }
+
+        return &m_table[index];
+    }
+
+    //------------------------------------------------------------------------
+    // Grow: Increase the size of the bucket table.
+    //
+    // Notes:
+    //    The new size is computed based on the current population, growth factor,
+    //    and maximum density factor.
+    //
+    void Grow()
+    {
+        unsigned newSize =
+            (unsigned)(m_tableCount * Behavior::s_growth_factor_numerator / Behavior::s_growth_factor_denominator *
+                       Behavior::s_density_factor_denominator / Behavior::s_density_factor_numerator);
+
+        if (newSize < Behavior::s_minimum_allocation)
+        {
+            newSize = Behavior::s_minimum_allocation;
+        }
+
+        // handle potential overflow
+        if (newSize < m_tableCount)
+        {
+            Behavior::NoMemory();
+        }
+
+        Reallocate(newSize);
+    }
+
+    //------------------------------------------------------------------------
+    // CheckGrowth: Check if the maximum hashtable density has been reached
+    // and increase the size of the bucket table if necessary.
+    //
+    void CheckGrowth()
+    {
+        if (m_tableCount == m_tableMax)
+        {
+            Grow();
+        }
+    }
+
+public:
+    //------------------------------------------------------------------------
+    // Reallocate: Replace the bucket table with a larger one and move all entries
+    // from the existing bucket table.
+    //
+    // Notes:
+    //    The new size must be large enough to hold all existing keys in
+    //    the table without exceeding the density. The actual table size is
+    //    the specified size rounded up to a power of two.
+    //
+    void Reallocate(unsigned newTableSize)
+    {
+        assert(newTableSize >=
+               (GetCount() * Behavior::s_density_factor_denominator / Behavior::s_density_factor_numerator));
+
+        unsigned newShift = 32;
+        unsigned newSize  = 1;
+        while (newSize < newTableSize)
+        {
+            if (newSize >= (1u << 31))
+            {
+                Behavior::NoMemory();
+            }
+
+            newSize <<= 1;
+            newShift--;
+        }
+
+        // Keep at least one bucket empty so that probe sequences end
+        unsigned newMax = (unsigned)((uint64_t)newSize * Behavior::s_density_factor_numerator /
+                                     Behavior::s_density_factor_denominator);
+        if (newMax >= newSize)
+        {
+            newMax = newSize - 1;
+        }
+
+        Node* oldTable = m_table;
+        Node* newTable = m_alloc.template allocate<Node>(newSize);
+
+        for (unsigned i = 0; i < newSize; i++)
+        {
+            newTable[i].m_used = false;
+        }
+
+        unsigned oldSize = m_tableSize;
+        m_table          = newTable;
+        m_tableSize      = newSize;
+        m_tableShift     = newShift;
+        m_tableMax       = newMax;
+
+        // Move all entries over to the new table.
+        for (unsigned i = 0; i < oldSize; i++)
+        {
+            if (oldTable[i].m_used)
+            {
+                Node* pN = FindNodeOrEmpty(oldTable[i].m_key);
+                assert(!pN->m_used);
+                memcpy((void*)pN, (void*)&oldTable[i], sizeof(Node));
+            }
+        }
+
+        if (oldTable != nullptr)
+        {
+            m_alloc.deallocate(oldTable);
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // operator[]: Get a reference to the value associated with the specified key.
+    //
+    // Arguments:
+    //    k - the key
+    //
+    // Return Value:
+    //    A reference to the value associated with the specified key.
+    //
+    // Notes:
+    //    The specified key must exist.
+    //
+    Value& operator[](Key k) const
+    {
+        Value* p = LookupPointer(k);
+        assert(p);
+        return *p;
+    }
+
+private:
+    // Instance members
+    Allocator m_alloc;      // Allocator to use in this table.
+    Node*     m_table;      // pointer to table
+    unsigned  m_tableSize;  // size of table (a power of two)
+    unsigned  m_tableShift; // 32 - log2(m_tableSize), for Fibonacci hashing
+    unsigned  m_tableCount; // number of elements in table
+    unsigned  m_tableMax;   // maximum occupied count
+};
+
 // Commonly used KeyFuncs types:
 
 // Base class for types whose equality function is the same as their "==".
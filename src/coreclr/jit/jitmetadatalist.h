@@ -30,6 +30,8 @@ JITMETADATAINFO(TieringName,                             const char*,      0)
 JITMETADATAMETRIC(PhysicallyPromotedFields,              int,              0)
 JITMETADATAMETRIC(LoopsFoundDuringOpts,                  int,              0)
 JITMETADATAMETRIC(LoopsCloned,                           int,              0)
+JITMETADATAMETRIC(LoopCloneSpanChecksRemoved,            int,              0)
+JITMETADATAMETRIC(LoopCloneMDArrayChecksRemoved,         int,              0)
 JITMETADATAMETRIC(LoopsUnrolled,                         int,              0)
 JITMETADATAMETRIC(LoopAlignmentCandidates,               int,              0)
 JITMETADATAMETRIC(LoopsAligned,                          int,              0)
@@ -38,14 +40,22 @@ JITMETADATAMETRIC(WidenedIVs,                            int,              0)
 JITMETADATAMETRIC(UnusedIVsRemoved,                      int,              0)
 JITMETADATAMETRIC(LoopsMadeDownwardsCounted,             int,              0)
 JITMETADATAMETRIC(LoopsStrengthReduced,                  int,              0)
+JITMETADATAMETRIC(LoopVectorizationCandidates,           int,              0)
+JITMETADATAMETRIC(RangeChecksRemoved,                    int,              JIT_METADATA_HIGHER_IS_BETTER)
+JITMETADATAMETRIC(RangeChecksRemovedByScev,              int,              JIT_METADATA_HIGHER_IS_BETTER)
+JITMETADATAMETRIC(SsaOptsSkippedForDynamicMethod,         int,              0)
 JITMETADATAMETRIC(VarsInSsa,                             int,              0)
 JITMETADATAMETRIC(HoistedExpressions,                    int,              0)
 JITMETADATAMETRIC(RedundantBranchesEliminated,           int,              JIT_METADATA_HIGHER_IS_BETTER)
 JITMETADATAMETRIC(JumpThreadingsPerformed,               int,              JIT_METADATA_HIGHER_IS_BETTER)
 JITMETADATAMETRIC(CseCount,                              int,              0)
+JITMETADATAMETRIC(PartialRedundanciesEliminated,         int,              JIT_METADATA_HIGHER_IS_BETTER)
 JITMETADATAMETRIC(BasicBlocksAtCodegen,                  int,              0)
+JITMETADATAMETRIC(FallThroughRatio,                      double,           JIT_METADATA_HIGHER_IS_BETTER)
 JITMETADATAMETRIC(PerfScore,                             double,           JIT_METADATA_LOWER_IS_BETTER)
 JITMETADATAMETRIC(BytesAllocated,                        int64_t,          JIT_METADATA_LOWER_IS_BETTER)
+JITMETADATAMETRIC(ArenaHostPages,                        int,              JIT_METADATA_LOWER_IS_BETTER)
+JITMETADATAMETRIC(ArenaPooledPages,                      int,              0)
 JITMETADATAMETRIC(ImporterBranchFold,                    int,              0)
 JITMETADATAMETRIC(ImporterSwitchFold,                    int,              0)
 JITMETADATAMETRIC(DevirtualizedCall,                     int,              0)
@@ -77,6 +87,9 @@ JITMETADATAMETRIC(NewRefClassHelperCalls,                int,              0)
 JITMETADATAMETRIC(StackAllocatedRefClasses,              int,              0)
 JITMETADATAMETRIC(NewBoxedValueClassHelperCalls,         int,              0)
 JITMETADATAMETRIC(StackAllocatedBoxedValueClasses,       int,              0)
+JITMETADATAMETRIC(NewArrayHelperCalls,                   int,              0)
+JITMETADATAMETRIC(StackAllocatedArrays,                  int,              0)
+JITMETADATAMETRIC(JumpDistBindIterations,                int,              JIT_METADATA_LOWER_IS_BETTER)
 
 #undef JITMETADATA
 #undef JITMETADATAINFO
@@ -163,6 +163,10 @@ GenTree* LC_Ident::ToGenTree(Compiler* comp, BasicBlock* bb)
             GenTree* indir = comp->gtNewIndir(TYP_I_IMPL, slot, GTF_IND_NONFAULTING | GTF_IND_INVARIANT);
             return indir;
         }
+        case MdArrLength:
+            return comp->gtNewMDArrLen(comp->gtNewLclvNode(mdArrLclNum, TYP_REF), mdArrDim, mdArrRank, bb);
+        case MdArrLowerBound:
+            return comp->gtNewMDArrLowerBound(comp->gtNewLclvNode(mdArrLclNum, TYP_REF), mdArrDim, mdArrRank, bb);
         default:
             assert(!"Could not convert LC_Ident to GenTree");
             unreached();
@@ -1144,6 +1148,8 @@ bool Compiler::optDeriveLoopCloningConditions(FlowGraphNaturalLoop* loop, LoopCl
         {
             case LcOptInfo::LcJaggedArray:
             case LcOptInfo::LcMdArray:
+            case LcOptInfo::LcSpan:
+            case LcOptInfo::LcMdArrayDim:
                 checkIterationBehavior = true;
                 break;
 
@@ -1378,6 +1384,29 @@ bool Compiler::optDeriveLoopCloningConditions(FlowGraphNaturalLoop* loop, LoopCl
                 // TODO: ensure array is dereference-able?
             }
             break;
+            case LcOptInfo::LcSpan:
+            {
+                // The span length is a local, so there is nothing to dereference.
+                LcSpanOptInfo* spanInfo = optInfo->AsLcSpanOptInfo();
+                LC_Condition   cond(opLimitCondition, LC_Expr(ident), LC_Expr(LC_Ident::CreateVar(spanInfo->lenLcl)));
+                context->EnsureConditions(loop->GetIndex())->Push(cond);
+            }
+            break;
+            case LcOptInfo::LcMdArrayDim:
+            {
+                // The fast path requires a zero lower bound, so that the effective index is the iteration variable.
+                LcMdArrayDimOptInfo* mdInfo = optInfo->AsLcMdArrayDimOptInfo();
+                LC_Ident lowerBound = LC_Ident::CreateMdArrLowerBound(mdInfo->arrLcl, mdInfo->dim, mdInfo->rank);
+                LC_Ident length     = LC_Ident::CreateMdArrLength(mdInfo->arrLcl, mdInfo->dim, mdInfo->rank);
+                context->EnsureConditions(loop->GetIndex())
+                    ->Push(LC_Condition(GT_EQ, LC_Expr(lowerBound), LC_Expr(LC_Ident::CreateConst(0u))));
+                context->EnsureConditions(loop->GetIndex())
+                    ->Push(LC_Condition(opLimitCondition, LC_Expr(ident), LC_Expr(length)));
+
+                // Ensure that the array must be dereference-able, before executing the actual conditions.
+                context->EnsureObjDerefs(loop->GetIndex())->Push(LC_Ident::CreateVar(mdInfo->arrLcl));
+            }
+            break;
             case LcOptInfo::LcTypeTest:
                 // handled above
                 break;
@@ -1506,9 +1535,13 @@ bool Compiler::optComputeDerefConditions(FlowGraphNaturalLoop* loop, LoopCloneCo
     JitExpandArrayStack<LC_Array>* const arrayDeref = context->EnsureArrayDerefs(loop->GetIndex());
     JitExpandArrayStack<LC_Ident>* const objDeref   = context->EnsureObjDerefs(loop->GetIndex());
 
-    // We currently expect to have at least one of these.
+    // Span accesses don't need any dereference conditions.
     //
-    assert((arrayDeref->Size() != 0) || (objDeref->Size() != 0));
+    if ((arrayDeref->Size() == 0) && (objDeref->Size() == 0))
+    {
+        JITDUMP("No deref conditions\n");
+        return true;
+    }
 
     // Generate the array dereference checks.
     //
@@ -1609,7 +1642,7 @@ bool Compiler::optComputeDerefConditions(FlowGraphNaturalLoop* loop, LoopCloneCo
 
         for (unsigned i = 0; i < objDeref->Size(); ++i)
         {
-            // ObjDeref array has indir(lcl), we want lcl.
+            // ObjDeref array has indir(lcl) or lcl, we want lcl.
             //
             LC_Ident& mtIndirIdent = (*objDeref)[i];
             LC_Ident  ident        = LC_Ident::CreateVar(mtIndirIdent.LclNum());
@@ -1733,6 +1766,57 @@ void Compiler::optPerformStaticOptimizations(FlowGraphNaturalLoop*     loop,
             case LcOptInfo::LcMdArray:
                 // TODO-CQ: CLONE: Implement.
                 break;
+            case LcOptInfo::LcSpan:
+            case LcOptInfo::LcMdArrayDim:
+            {
+                GenTree*    bndsChkNode;
+                Statement*  stmt;
+                BasicBlock* useBlock;
+
+                if (optInfo->GetOptType() == LcOptInfo::LcSpan)
+                {
+                    LcSpanOptInfo* spanInfo = optInfo->AsLcSpanOptInfo();
+                    bndsChkNode             = spanInfo->bndsChk;
+                    stmt                    = spanInfo->stmt;
+                    useBlock                = spanInfo->useBlock;
+                }
+                else
+                {
+                    LcMdArrayDimOptInfo* mdInfo = optInfo->AsLcMdArrayDimOptInfo();
+                    bndsChkNode                 = mdInfo->bndsChk;
+                    stmt                        = mdInfo->stmt;
+                    useBlock                    = mdInfo->useBlock;
+                }
+
+                compCurBB = useBlock;
+
+                // As with jagged arrays, a nesting cloned loop may have removed this bounds check already.
+                if (bndsChkNode->gtGetOp1()->OperIs(GT_BOUNDS_CHECK))
+                {
+                    JITDUMP("Remove %s bounds check [%06u] for " FMT_STMT "\n",
+                            (optInfo->GetOptType() == LcOptInfo::LcSpan) ? "span" : "MD array",
+                            dspTreeID(bndsChkNode->gtGetOp1()), stmt->GetID());
+
+                    optRemoveCommaBasedRangeCheck(bndsChkNode, stmt);
+
+                    if (optInfo->GetOptType() == LcOptInfo::LcSpan)
+                    {
+                        Metrics.LoopCloneSpanChecksRemoved++;
+                    }
+                    else
+                    {
+                        Metrics.LoopCloneMDArrayChecksRemoved++;
+                    }
+                }
+                else
+                {
+                    JITDUMP("  Bounds check already removed\n");
+                    assert(bndsChkNode->gtGetOp1()->OperIs(GT_NOP));
+                }
+
+                DBEXEC(dynamicPath, optDebugLogLoopCloning(useBlock, stmt));
+                break;
+            }
             case LcOptInfo::LcTypeTest:
             case LcOptInfo::LcMethodAddrTest:
             {
@@ -1900,7 +1984,6 @@ BasicBlock* Compiler::optInsertLoopChoiceConditions(LoopCloneContext*     contex
                                                     BasicBlock*           insertAfter)
 {
     JITDUMP("Inserting loop " FMT_LP " loop choice conditions\n", loop->GetIndex());
-    assert(context->HasBlockConditions(loop->GetIndex()));
     assert(slowPreheader != nullptr);
 
     if (context->HasBlockConditions(loop->GetIndex()))
@@ -2039,9 +2122,7 @@ void Compiler::optCloneLoop(FlowGraphNaturalLoop* loop, LoopCloneContext* contex
     //      ...
     //      slowPreheader --> slowHeader
     //
-    // We should always have block conditions.
-
-    assert(context->HasBlockConditions(loop->GetIndex()));
+    // Loops cloned only for span accesses have no block conditions.
 
     // If any condition is false, go to slowPreheader (which branches or falls through to header of the slow loop).
     BasicBlock* slowHeader = nullptr;
@@ -2224,6 +2305,130 @@ bool Compiler::optExtractArrIndex(GenTree* tree, ArrIndex* result, unsigned lhsN
     return true;
 }
 
+//---------------------------------------------------------------------------------------------------------------
+//  optExtractSpanIndex: Try to extract a Span<T> access indexed by the loop iteration variable.
+//
+//  Arguments:
+//      tree     the tree to be checked if it is a bounds checked span access.
+//      iterVar  the loop iteration variable.
+//      pLenLcl  OUT: the local holding the span length.
+//
+//  Return Value:
+//      Returns true if "tree" is a COMMA whose op1 is a bounds check of "iterVar" against a
+//      TYP_INT local, which is how Span<T>.get_Item looks after the span has been promoted:
+//
+// *  COMMA     byref
+// +--*  BOUNDS_CHECK_Rng void
+// |  +--*  LCL_VAR   int    V02 loc1
+// |  \--*  LCL_VAR   int    V05 tmp1 (span._length)
+// \--*  ADD       byref
+//    ...
+//
+bool Compiler::optExtractSpanIndex(GenTree* tree, unsigned iterVar, unsigned* pLenLcl)
+{
+    assert(tree->OperIs(GT_COMMA));
+
+    GenTree* before = tree->gtGetOp1();
+    if (!before->OperIs(GT_BOUNDS_CHECK))
+    {
+        return false;
+    }
+
+    GenTreeBoundsChk* bndsChk = before->AsBoundsChk();
+    GenTree*          index   = bndsChk->GetIndex();
+    GenTree*          length  = bndsChk->GetArrayLength();
+
+    if (!index->OperIs(GT_LCL_VAR) || (index->AsLclVar()->GetLclNum() != iterVar))
+    {
+        return false;
+    }
+
+    if (!length->OperIs(GT_LCL_VAR) || !genActualTypeIsInt(length))
+    {
+        return false;
+    }
+
+    *pLenLcl = length->AsLclVar()->GetLclNum();
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------
+//  optExtractMdArrayIndex: Try to extract the bounds checked index of one dimension of an expanded
+//      multi-dimensional array access, where the index is the loop iteration variable.
+//
+//  Arguments:
+//      tree      the tree to be checked.
+//      iterVar   the loop iteration variable.
+//      pBndsChk  OUT: the COMMA node whose op1 is the bounds check.
+//      pArrLcl   OUT: the array local.
+//      pDim      OUT: the dimension.
+//      pRank     OUT: the rank of the array.
+//
+//  Return Value:
+//      Returns true if "tree" is the effective index computation that fgMorphArrayOps creates
+//      for a dimension:
+//
+// *  COMMA     int
+// +--*  STORE_LCL_VAR int    V06 tmp2
+// |  \--*  SUB       int
+// |     +--*  LCL_VAR   int    V02 loc1
+// |     \--*  MDARR_LOWER_BOUND int    (1)
+// |        \--*  LCL_VAR   ref    V00 arg0
+// \--*  COMMA     int
+//    +--*  BOUNDS_CHECK_Rng void
+//    |  +--*  LCL_VAR   int    V06 tmp2
+//    |  \--*  MDARR_LENGTH int    (1)
+//    |     \--*  LCL_VAR   ref    V00 arg0
+//    \--*  LCL_VAR   int    V06 tmp2
+//
+bool Compiler::optExtractMdArrayIndex(
+    GenTree* tree, unsigned iterVar, GenTree** pBndsChk, unsigned* pArrLcl, unsigned* pDim, unsigned* pRank)
+{
+    assert(tree->OperIs(GT_COMMA));
+
+    GenTree* store = tree->gtGetOp1();
+    GenTree* after = tree->gtGetOp2();
+    if (!store->OperIs(GT_STORE_LCL_VAR) || !after->OperIs(GT_COMMA) || !after->gtGetOp1()->OperIs(GT_BOUNDS_CHECK))
+    {
+        return false;
+    }
+
+    GenTree* effIndex = store->AsLclVar()->Data();
+    if (!effIndex->OperIs(GT_SUB) || !effIndex->gtGetOp1()->OperIs(GT_LCL_VAR) ||
+        (effIndex->gtGetOp1()->AsLclVar()->GetLclNum() != iterVar) ||
+        !effIndex->gtGetOp2()->OperIs(GT_MDARR_LOWER_BOUND))
+    {
+        return false;
+    }
+
+    GenTreeMDArr*     lowerBound = effIndex->gtGetOp2()->AsMDArr();
+    GenTreeBoundsChk* bndsChk    = after->gtGetOp1()->AsBoundsChk();
+    GenTree*          index      = bndsChk->GetIndex();
+    GenTree*          length     = bndsChk->GetArrayLength();
+
+    if (!index->OperIs(GT_LCL_VAR) || (index->AsLclVar()->GetLclNum() != store->AsLclVar()->GetLclNum()))
+    {
+        return false;
+    }
+
+    if (!length->OperIs(GT_MDARR_LENGTH) || (length->AsMDArr()->Dim() != lowerBound->Dim()))
+    {
+        return false;
+    }
+
+    GenTree* arrObj = lowerBound->ArrRef();
+    if (!arrObj->OperIs(GT_LCL_VAR) || !GenTree::Compare(arrObj, length->AsMDArr()->ArrRef()))
+    {
+        return false;
+    }
+
+    *pBndsChk = after;
+    *pArrLcl  = arrObj->AsLclVar()->GetLclNum();
+    *pDim     = lowerBound->Dim();
+    *pRank    = lowerBound->Rank();
+    return true;
+}
+
 //---------------------------------------------------------------------------------------------------------------
 //  optReconstructArrIndexHelp: Helper function for optReconstructArrIndex. See that function for more details.
 //
@@ -2487,6 +2692,51 @@ Compiler::fgWalkResult Compiler::optCanOptimizeByLoopCloning(GenTree* tree, Loop
         return WALK_SKIP_SUBTREES;
     }
 
+    if (info->cloneForArrayBounds && tree->OperIs(GT_COMMA))
+    {
+        NaturalLoopIterInfo* iterInfo = info->context->GetLoopIterInfo(info->loop->GetIndex());
+
+        unsigned lenLcl;
+        if (optExtractSpanIndex(tree, iterInfo->IterVar, &lenLcl))
+        {
+            if (optIsStackLocalInvariant(info->loop, lenLcl))
+            {
+                JITDUMP("Loop " FMT_LP " can be cloned for span access [%06u] with length V%02u\n",
+                        info->loop->GetIndex(), dspTreeID(tree), lenLcl);
+
+                info->context->EnsureLoopOptInfo(info->loop->GetIndex())
+                    ->Push(new (this, CMK_LoopOpt) LcSpanOptInfo(tree, lenLcl, info->stmt, compCurBB));
+            }
+            else
+            {
+                JITDUMP("Span length V%02u of [%06u] is not loop invariant\n", lenLcl, dspTreeID(tree));
+            }
+            return WALK_CONTINUE;
+        }
+
+        GenTree* bndsChk;
+        unsigned arrLcl;
+        unsigned dim;
+        unsigned rank;
+        if (optExtractMdArrayIndex(tree, iterInfo->IterVar, &bndsChk, &arrLcl, &dim, &rank))
+        {
+            if (optIsStackLocalInvariant(info->loop, arrLcl))
+            {
+                JITDUMP("Loop " FMT_LP " can be cloned for MD array access [%06u] on V%02u dim %u\n",
+                        info->loop->GetIndex(), dspTreeID(tree), arrLcl, dim);
+
+                info->context->EnsureLoopOptInfo(info->loop->GetIndex())
+                    ->Push(new (this, CMK_LoopOpt)
+                               LcMdArrayDimOptInfo(bndsChk, arrLcl, dim, rank, info->stmt, compCurBB));
+            }
+            else
+            {
+                JITDUMP("MD array V%02u of [%06u] is not loop invariant\n", arrLcl, dspTreeID(tree));
+            }
+            return WALK_CONTINUE;
+        }
+    }
+
     if (info->cloneForGDVTests && tree->OperIs(GT_JTRUE))
     {
         JITDUMP("...GDV considering [%06u]\n", dspTreeID(tree));
@@ -2784,7 +3034,8 @@ Compiler::fgWalkResult Compiler::optCanOptimizeByLoopCloningVisitor(GenTree** pT
 bool Compiler::optIdentifyLoopOptInfo(FlowGraphNaturalLoop* loop, LoopCloneContext* context)
 {
     NaturalLoopIterInfo* iterInfo               = context->GetLoopIterInfo(loop->GetIndex());
-    const bool           canCloneForArrayBounds = ((optMethodFlags & OMF_HAS_ARRAYREF) != 0) && (iterInfo != nullptr);
+    const bool           canCloneForArrayBounds =
+        ((optMethodFlags & (OMF_HAS_ARRAYREF | OMF_HAS_SPANREF | OMF_HAS_MDARRAYREF)) != 0) && (iterInfo != nullptr);
     const bool           canCloneForTypeTests   = ((optMethodFlags & OMF_HAS_GUARDEDDEVIRT) != 0);
 
     if (!canCloneForArrayBounds && !canCloneForTypeTests)
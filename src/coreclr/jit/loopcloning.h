@@ -317,6 +317,54 @@ struct LcJaggedArrayOptInfo : public LcOptInfo
     }
 };
 
+/**
+ *
+ * Optimization info for a Span<T> access, whose bounds check is against a
+ * loop invariant length local.
+ */
+struct LcSpanOptInfo : public LcOptInfo
+{
+    GenTree*    bndsChk;  // COMMA node whose op1 is the bounds check.
+    unsigned    lenLcl;   // Local holding the span length.
+    Statement*  stmt;     // "stmt" where the optimization opportunity occurs.
+    BasicBlock* useBlock; // Block where the access occurs.
+
+    LcSpanOptInfo(GenTree* bndsChk, unsigned lenLcl, Statement* stmt, BasicBlock* useBlock)
+        : LcOptInfo(LcSpan)
+        , bndsChk(bndsChk)
+        , lenLcl(lenLcl)
+        , stmt(stmt)
+        , useBlock(useBlock)
+    {
+    }
+};
+
+/**
+ *
+ * Optimization info for one dimension of an expanded multi-dimensional array access.
+ */
+struct LcMdArrayDimOptInfo : public LcOptInfo
+{
+    GenTree*    bndsChk;  // COMMA node whose op1 is the bounds check for "dim".
+    unsigned    arrLcl;   // The array base local num.
+    unsigned    dim;      // The dimension indexed by the loop iteration variable.
+    unsigned    rank;     // Rank of the array.
+    Statement*  stmt;     // "stmt" where the optimization opportunity occurs.
+    BasicBlock* useBlock; // Block where the access occurs.
+
+    LcMdArrayDimOptInfo(
+        GenTree* bndsChk, unsigned arrLcl, unsigned dim, unsigned rank, Statement* stmt, BasicBlock* useBlock)
+        : LcOptInfo(LcMdArrayDim)
+        , bndsChk(bndsChk)
+        , arrLcl(arrLcl)
+        , dim(dim)
+        , rank(rank)
+        , stmt(stmt)
+        , useBlock(useBlock)
+    {
+    }
+};
+
 // Optimization info for a type test
 //
 struct LcTypeTestOptInfo : public LcOptInfo
@@ -486,6 +534,8 @@ struct LC_Ident
         IndirOfLocal,
         MethodAddr,
         IndirOfMethodAddrSlot,
+        MdArrLength,
+        MdArrLowerBound,
     };
 
 private:
@@ -497,6 +547,12 @@ private:
             unsigned lclNum;
             unsigned indirOffs;
         };
+        struct
+        {
+            unsigned mdArrLclNum;
+            unsigned mdArrDim;
+            unsigned mdArrRank;
+        };
         LC_Array             arrAccess;
         CORINFO_CLASS_HANDLE clsHnd;
         struct
@@ -548,6 +604,9 @@ public:
                 return (methAddr == that.methAddr);
             case IndirOfMethodAddrSlot:
                 return (methAddr == that.methAddr);
+            case MdArrLength:
+            case MdArrLowerBound:
+                return (mdArrLclNum == that.mdArrLclNum) && (mdArrDim == that.mdArrDim);
             default:
                 assert(!"Unknown LC_Ident type");
                 unreached();
@@ -596,6 +655,12 @@ public:
             case IndirOfMethodAddrSlot:
                 printf("[%p]", methAddr);
                 break;
+            case MdArrLength:
+                printf("V%02u.GetLength(%u)", mdArrLclNum, mdArrDim);
+                break;
+            case MdArrLowerBound:
+                printf("V%02u.GetLowerBound(%u)", mdArrLclNum, mdArrDim);
+                break;
             default:
                 printf("INVALID");
                 break;
@@ -621,6 +686,24 @@ public:
         return id;
     }
 
+    static LC_Ident CreateMdArrLength(unsigned lclNum, unsigned dim, unsigned rank)
+    {
+        LC_Ident id(MdArrLength);
+        id.mdArrLclNum = lclNum;
+        id.mdArrDim    = dim;
+        id.mdArrRank   = rank;
+        return id;
+    }
+
+    static LC_Ident CreateMdArrLowerBound(unsigned lclNum, unsigned dim, unsigned rank)
+    {
+        LC_Ident id(MdArrLowerBound);
+        id.mdArrLclNum = lclNum;
+        id.mdArrDim    = dim;
+        id.mdArrRank   = rank;
+        return id;
+    }
+
     static LC_Ident CreateConst(unsigned value)
     {
         LC_Ident id(Const);
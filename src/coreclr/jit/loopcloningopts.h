@@ -13,5 +13,7 @@ LC_OPT(LcMdArray)
 LC_OPT(LcJaggedArray)
 LC_OPT(LcTypeTest)
 LC_OPT(LcMethodAddrTest)
+LC_OPT(LcSpan)
+LC_OPT(LcMdArrayDim)
 
 #undef LC_OPT
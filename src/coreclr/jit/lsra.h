@@ -443,10 +443,265 @@ inline bool RefTypeIsDef(RefType refType)
 
 typedef regNumberSmall* VarToRegMap;
 
-typedef jitstd::list<Interval>                      IntervalList;
-typedef jitstd::list<RefPosition>                   RefPositionList;
-typedef jitstd::list<RefPosition>::iterator         RefPositionIterator;
-typedef jitstd::list<RefPosition>::reverse_iterator RefPositionReverseIterator;
+//------------------------------------------------------------------------
+// LsraChunkedList: An append-only list used for the Intervals and RefPositions.
+//
+// Notes:
+//    Elements are stored in arena allocated chunks of ChunkSize elements, so appending
+//    costs one allocation per chunk rather than one per element, there is no per-element
+//    link overhead, and walking the list in order touches contiguous memory.
+//    Elements never move once they are added, so pointers to them remain valid.
+//
+//    An iterator to the last element that is obtained via 'backPosition()' remains valid
+//    as more elements are appended, and incrementing it then reaches the first of them.
+//
+template <typename T, unsigned ChunkSize>
+class LsraChunkedList
+{
+    struct Chunk
+    {
+        Chunk*   prev;
+        Chunk*   next;
+        unsigned count;
+        alignas(T) BYTE storage[sizeof(T) * ChunkSize];
+
+        T* Items()
+        {
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    CompAllocator m_allocator;
+    Chunk*        m_head;
+    Chunk*        m_tail;
+    size_t        m_size;
+
+public:
+    class iterator
+    {
+        friend class LsraChunkedList;
+
+        Chunk*   m_chunk;
+        unsigned m_index;
+
+        iterator(Chunk* chunk, unsigned index)
+            : m_chunk(chunk)
+            , m_index(index)
+        {
+        }
+
+    public:
+        iterator()
+            : m_chunk(nullptr)
+            , m_index(0)
+        {
+        }
+
+        iterator& operator++()
+        {
+            m_index++;
+            // Only a full chunk can have a successor, so this moves to the next chunk
+            // exactly when we step past the last element of a full chunk.
+            if ((m_index == m_chunk->count) && (m_chunk->next != nullptr))
+            {
+                m_chunk = m_chunk->next;
+                m_index = 0;
+            }
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator result = *this;
+            ++(*this);
+            return result;
+        }
+
+        iterator& operator--()
+        {
+            if (m_index == 0)
+            {
+                m_chunk = m_chunk->prev;
+                m_index = ChunkSize;
+            }
+            m_index--;
+            return *this;
+        }
+
+        iterator operator--(int)
+        {
+            iterator result = *this;
+            --(*this);
+            return result;
+        }
+
+        bool operator==(const iterator& it) const
+        {
+            return (m_chunk == it.m_chunk) && (m_index == it.m_index);
+        }
+
+        bool operator!=(const iterator& it) const
+        {
+            return !(*this == it);
+        }
+
+        T& operator*() const
+        {
+            assert(m_index < m_chunk->count);
+            return m_chunk->Items()[m_index];
+        }
+
+        T* operator->() const
+        {
+            return &**this;
+        }
+
+        operator T*() const
+        {
+            return &**this;
+        }
+    };
+
+    class reverse_iterator
+    {
+        friend class LsraChunkedList;
+
+        Chunk* m_chunk;
+        int    m_index;
+
+        reverse_iterator(Chunk* chunk, int index)
+            : m_chunk(chunk)
+            , m_index(index)
+        {
+        }
+
+    public:
+        reverse_iterator()
+            : m_chunk(nullptr)
+            , m_index(-1)
+        {
+        }
+
+        reverse_iterator& operator++()
+        {
+            m_index--;
+            if ((m_index < 0) && (m_chunk->prev != nullptr))
+            {
+                m_chunk = m_chunk->prev;
+                m_index = (int)ChunkSize - 1;
+            }
+            return *this;
+        }
+
+        reverse_iterator operator++(int)
+        {
+            reverse_iterator result = *this;
+            ++(*this);
+            return result;
+        }
+
+        bool operator==(const reverse_iterator& it) const
+        {
+            return (m_chunk == it.m_chunk) && (m_index == it.m_index);
+        }
+
+        bool operator!=(const reverse_iterator& it) const
+        {
+            return !(*this == it);
+        }
+
+        T& operator*() const
+        {
+            assert((m_index >= 0) && ((unsigned)m_index < m_chunk->count));
+            return m_chunk->Items()[m_index];
+        }
+
+        T* operator->() const
+        {
+            return &**this;
+        }
+
+        operator T*() const
+        {
+            return &**this;
+        }
+    };
+
+    LsraChunkedList(CompAllocator allocator)
+        : m_allocator(allocator)
+        , m_head(nullptr)
+        , m_tail(nullptr)
+        , m_size(0)
+    {
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args)
+    {
+        if ((m_tail == nullptr) || (m_tail->count == ChunkSize))
+        {
+            Chunk* chunk = new (m_allocator.allocate<Chunk>(1), jitstd::placement_t()) Chunk;
+            chunk->prev  = m_tail;
+            chunk->next  = nullptr;
+            chunk->count = 0;
+
+            if (m_tail == nullptr)
+            {
+                m_head = chunk;
+            }
+            else
+            {
+                m_tail->next = chunk;
+            }
+            m_tail = chunk;
+        }
+
+        new (&m_tail->Items()[m_tail->count], jitstd::placement_t()) T(std::forward<Args>(args)...);
+        m_tail->count++;
+        m_size++;
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    T& back()
+    {
+        assert(m_size != 0);
+        return m_tail->Items()[m_tail->count - 1];
+    }
+
+    iterator begin()
+    {
+        return iterator(m_head, 0);
+    }
+
+    iterator end()
+    {
+        return iterator(m_tail, (m_tail == nullptr) ? 0 : m_tail->count);
+    }
+
+    iterator backPosition()
+    {
+        return (m_size == 0) ? end() : iterator(m_tail, m_tail->count - 1);
+    }
+
+    reverse_iterator rbegin()
+    {
+        return reverse_iterator(m_tail, (m_tail == nullptr) ? -1 : (int)m_tail->count - 1);
+    }
+
+    reverse_iterator rend()
+    {
+        return reverse_iterator(m_head, -1);
+    }
+};
+
+typedef LsraChunkedList<Interval, 32>    IntervalList;
+typedef LsraChunkedList<RefPosition, 64> RefPositionList;
+typedef RefPositionList::iterator         RefPositionIterator;
+typedef RefPositionList::reverse_iterator RefPositionReverseIterator;
 
 class Referenceable
 {
@@ -20,19 +20,21 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 //------------------------------------------------------------------------
 // DoPhase: Run analysis (if object stack allocation is enabled) and then
 //          morph each GT_ALLOCOBJ node either into an allocation helper
-//          call or stack allocation.
+//          call or stack allocation, and each non-escaping new array
+//          helper call into a stack allocation.
 //
 // Returns:
 //    PhaseStatus indicating, what, if anything, was modified
 //
 // Notes:
-//    Runs only if Compiler::optMethodFlags has flag OMF_HAS_NEWOBJ set.
+//    Runs only if Compiler::optMethodFlags has flag OMF_HAS_NEWOBJ or
+//    OMF_HAS_NEWARRAY set.
 //
 PhaseStatus ObjectAllocator::DoPhase()
 {
-    if ((comp->optMethodFlags & OMF_HAS_NEWOBJ) == 0)
+    if ((comp->optMethodFlags & (OMF_HAS_NEWOBJ | OMF_HAS_NEWARRAY)) == 0)
     {
-        JITDUMP("no newobjs in this method; punting\n");
+        JITDUMP("no newobjs or newarrs in this method; punting\n");
         return PhaseStatus::MODIFIED_NOTHING;
     }
 
@@ -360,13 +362,16 @@ void ObjectAllocator::ComputeStackObjectPointers(BitVecTraits* bitVecTraits)
 
 //------------------------------------------------------------------------
 // MorphAllocObjNodes: Morph each GT_ALLOCOBJ node either into an
-//                     allocation helper call or stack allocation.
+//                     allocation helper call or stack allocation, and
+//                     each new array helper call that can be stack
+//                     allocated into a stack allocation.
 //
 // Returns:
 //    true if any allocation was done as a stack allocation.
 //
 // Notes:
-//    Runs only over the blocks having bbFlags BBF_HAS_NEWOBJ set.
+//    Runs only over the blocks having bbFlags BBF_HAS_NEWOBJ or
+//    BBF_HAS_NEWARR set.
 
 bool ObjectAllocator::MorphAllocObjNodes()
 {
@@ -377,9 +382,10 @@ bool ObjectAllocator::MorphAllocObjNodes()
     for (BasicBlock* const block : comp->Blocks())
     {
         const bool basicBlockHasNewObj       = block->HasFlag(BBF_HAS_NEWOBJ);
+        const bool basicBlockHasNewArr       = block->HasFlag(BBF_HAS_NEWARR);
         const bool basicBlockHasBackwardJump = block->HasFlag(BBF_BACKWARD_JUMP);
 #ifndef DEBUG
-        if (!basicBlockHasNewObj)
+        if (!basicBlockHasNewObj && !basicBlockHasNewArr)
         {
             continue;
         }
@@ -391,6 +397,7 @@ bool ObjectAllocator::MorphAllocObjNodes()
             GenTree* data     = nullptr;
 
             bool canonicalAllocObjFound = false;
+            bool canonicalNewArrFound   = false;
 
             if (stmtExpr->OperIs(GT_STORE_LCL_VAR) && stmtExpr->TypeIs(TYP_REF))
             {
@@ -400,9 +407,60 @@ bool ObjectAllocator::MorphAllocObjNodes()
                 {
                     canonicalAllocObjFound = true;
                 }
+                else if (basicBlockHasNewArr && IsNewArrHelperCall(comp, data))
+                {
+                    canonicalNewArrFound = true;
+                }
             }
 
-            if (canonicalAllocObjFound)
+            if (canonicalNewArrFound)
+            {
+                //------------------------------------------------------------------------
+                // We expect the following expression tree at this point
+                //  STMTx (IL 0x... ???)
+                //    * STORE_LCL_VAR   ref
+                //    \--*  CALL help ref    CORINFO_HELP_NEWARR_1_VC
+                //       +--*  CNS_INT(h) long
+                //       \--*  CNS_INT    long
+                //------------------------------------------------------------------------
+
+                GenTreeCall* const         asCall       = data->AsCall();
+                unsigned int const         lclNum       = stmtExpr->AsLclVar()->GetLclNum();
+                CORINFO_CLASS_HANDLE const clsHnd       = (CORINFO_CLASS_HANDLE)asCall->compileTimeHelperArgumentHandle;
+                GenTree* const             length       = asCall->gtArgs.GetArgByIndex(1)->GetNode();
+                const char*                onHeapReason = nullptr;
+                unsigned int               blockSize    = 0;
+
+                comp->Metrics.NewArrayHelperCalls++;
+
+                if (!IsObjectStackAllocationEnabled())
+                {
+                    onHeapReason = "[object stack allocation disabled]";
+                }
+                else if (basicBlockHasBackwardJump)
+                {
+                    onHeapReason = "[alloc in loop]";
+                }
+                else if (CanAllocateArrayLclVarOnStack(lclNum, clsHnd, length, &blockSize, &onHeapReason))
+                {
+                    JITDUMP("Allocating V%02u on the stack\n", lclNum);
+                    const unsigned int stackLclNum = MorphNewArrNodeIntoStackAlloc(asCall, blockSize, block, stmt);
+                    m_HeapLocalToStackLocalMap.AddOrUpdate(lclNum, stackLclNum);
+                    MarkLclVarAsDefinitelyStackPointing(lclNum);
+                    MarkLclVarAsPossiblyStackPointing(lclNum);
+                    stmt->GetRootNode()->gtBashToNOP();
+                    comp->optMethodFlags |= OMF_HAS_OBJSTACKALLOC;
+                    comp->Metrics.StackAllocatedArrays++;
+                    didStackAllocate = true;
+                    onHeapReason     = nullptr;
+                }
+
+                if (onHeapReason != nullptr)
+                {
+                    JITDUMP("Allocating V%02u on the heap: %s\n", lclNum, onHeapReason);
+                }
+            }
+            else if (canonicalAllocObjFound)
             {
                 assert(basicBlockHasNewObj);
                 //------------------------------------------------------------------------
@@ -626,6 +684,110 @@ unsigned int ObjectAllocator::MorphAllocObjNodeIntoStackAlloc(
     return lclNum;
 }
 
+//------------------------------------------------------------------------
+// IsNewArrHelperCall: Check if a tree is a call to one of the helpers that
+//                     allocate a single-dimensional array that the object
+//                     allocator knows how to stack allocate.
+//
+// Arguments:
+//    comp - Compiler instance
+//    tree - Tree to check
+//
+// Return Value:
+//    true if so.
+//
+// Notes:
+//    The aligning and frozen allocators, and the R2R helper whose arguments
+//    do not include the array type handle, are not handled.
+//
+bool ObjectAllocator::IsNewArrHelperCall(Compiler* comp, GenTree* tree)
+{
+    if (!tree->IsHelperCall())
+    {
+        return false;
+    }
+
+    GenTreeCall* const call = tree->AsCall();
+    if (!call->IsHelperCall(comp, CORINFO_HELP_NEWARR_1_VC) && !call->IsHelperCall(comp, CORINFO_HELP_NEWARR_1_DIRECT))
+    {
+        return false;
+    }
+
+    return call->compileTimeHelperArgumentHandle != nullptr;
+}
+
+//------------------------------------------------------------------------
+// MorphNewArrNodeIntoStackAlloc: Morph a new array helper call into stack
+//                                allocation.
+// Arguments:
+//    newArr    - new array helper call that will be replaced by a stack allocation
+//    blockSize - size of the stack allocated array, including its header
+//    block     - a basic block where newArr is
+//    stmt      - a statement where newArr is
+//
+// Return Value:
+//    local num for the new stack allocated local
+//
+// Notes:
+//    This function can insert additional statements before stmt.
+//
+unsigned int ObjectAllocator::MorphNewArrNodeIntoStackAlloc(GenTreeCall* newArr,
+                                                            unsigned int blockSize,
+                                                            BasicBlock*  block,
+                                                            Statement*   stmt)
+{
+    assert(newArr != nullptr);
+    assert(m_AnalysisDone);
+
+    const bool         shortLifetime = false;
+    const unsigned int lclNum        = comp->lvaGrabTemp(shortLifetime DEBUGARG("stack allocated array temp"));
+
+    comp->lvaSetStruct(lclNum, comp->typGetBlkLayout(blockSize), /* unsafeValueClsCheck */ false);
+
+    // Initialize the array memory if necessary.
+    bool             bbInALoop  = block->HasFlag(BBF_BACKWARD_JUMP);
+    bool             bbIsReturn = block->KindIs(BBJ_RETURN);
+    LclVarDsc* const lclDsc     = comp->lvaGetDesc(lclNum);
+    if (comp->fgVarNeedsExplicitZeroInit(lclNum, bbInALoop, bbIsReturn))
+    {
+        GenTree*   init     = comp->gtNewStoreLclVarNode(lclNum, comp->gtNewIconNode(0));
+        Statement* initStmt = comp->gtNewStmt(init);
+
+        comp->fgInsertStmtBefore(block, stmt, initStmt);
+    }
+    else
+    {
+        JITDUMP("\nSuppressing zero-init for V%02u -- expect to zero in prolog\n", lclNum);
+        lclDsc->lvSuppressedZeroInit = 1;
+        comp->compSuppressedZeroInit = true;
+    }
+
+    // Initialize the method table pointer and the length.
+    //
+    //------------------------------------------------------------------------
+    // STMTx (IL 0x... ???)
+    //   * STORE_LCL_FLD    long
+    //   \--*  CNS_INT(h) long
+    //
+    // STMTy (IL 0x... ???)
+    //   * STORE_LCL_FLD    int    [+8]
+    //   \--*  CNS_INT    int
+    //------------------------------------------------------------------------
+
+    GenTree* const mtNode     = newArr->gtArgs.GetArgByIndex(0)->GetNode();
+    GenTree*       mtInit     = comp->gtNewStoreLclFldNode(lclNum, TYP_I_IMPL, 0, mtNode);
+    Statement*     mtInitStmt = comp->gtNewStmt(mtInit);
+    comp->fgInsertStmtBefore(block, stmt, mtInitStmt);
+
+    const ssize_t numElements = newArr->gtArgs.GetArgByIndex(1)->GetNode()->AsIntCon()->IconValue();
+    GenTree*      lenInit     = comp->gtNewStoreLclFldNode(lclNum, TYP_INT, OFFSETOF__CORINFO_Array__length,
+                                                           comp->gtNewIconNode(numElements, TYP_INT));
+    Statement*    lenInitStmt = comp->gtNewStmt(lenInit);
+    comp->fgInsertStmtBefore(block, stmt, lenInitStmt);
+
+    return lclNum;
+}
+
 //------------------------------------------------------------------------
 // CanLclVarEscapeViaParentStack: Check if the local variable escapes via the given parent stack.
 //                                Update the connection graph as necessary.
@@ -682,6 +844,7 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
             case GT_EQ:
             case GT_NE:
             case GT_NULLCHECK:
+            case GT_ARR_LENGTH:
                 canLclVarEscapeViaParentStack = false;
                 break;
 
@@ -698,6 +861,7 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
             case GT_ADD:
             case GT_BOX:
             case GT_FIELD_ADDR:
+            case GT_INDEX_ADDR:
                 // Check whether the local escapes via its grandparent.
                 ++parentIndex;
                 keepChecking = true;
@@ -726,6 +890,12 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
                     canLclVarEscapeViaParentStack =
                         !Compiler::s_helperCallProperties.IsNoEscape(comp->eeGetHelperNum(asCall->gtCallMethHnd));
                 }
+                else if (asCall->IsDelegateInvoke() && (asCall->gtArgs.GetThisArg()->GetNode() == tree))
+                {
+                    // Delegate.Invoke only reads the fields of the delegate to find the target, so a delegate that
+                    // is created and invoked locally (with its constructor inlined) can live on the stack.
+                    canLclVarEscapeViaParentStack = false;
+                }
                 break;
             }
 
@@ -778,6 +948,7 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
             case GT_EQ:
             case GT_NE:
             case GT_NULLCHECK:
+            case GT_ARR_LENGTH:
                 break;
 
             case GT_COMMA:
@@ -790,6 +961,7 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
             case GT_QMARK:
             case GT_ADD:
             case GT_FIELD_ADDR:
+            case GT_INDEX_ADDR:
                 if (parent->TypeGet() == TYP_REF)
                 {
                     parent->ChangeType(newType);
@@ -48,6 +48,11 @@ protected:
 
 private:
     bool         CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd, const char** reason);
+    bool         CanAllocateArrayLclVarOnStack(unsigned int         lclNum,
+                                               CORINFO_CLASS_HANDLE clsHnd,
+                                               GenTree*             length,
+                                               unsigned int*        blockSize,
+                                               const char**         reason);
     bool         CanLclVarEscape(unsigned int lclNum);
     void         MarkLclVarAsPossiblyStackPointing(unsigned int lclNum);
     void         MarkLclVarAsDefinitelyStackPointing(unsigned int lclNum);
@@ -64,6 +69,11 @@ private:
     GenTree*     MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* allocObj);
     unsigned int MorphAllocObjNodeIntoStackAlloc(
         GenTreeAllocObj* allocObj, CORINFO_CLASS_HANDLE clsHnd, bool isValueClass, BasicBlock* block, Statement* stmt);
+    unsigned int MorphNewArrNodeIntoStackAlloc(GenTreeCall* newArr,
+                                               unsigned int blockSize,
+                                               BasicBlock*  block,
+                                               Statement*   stmt);
+    static bool  IsNewArrHelperCall(Compiler* comp, GenTree* tree);
     struct BuildConnGraphVisitorCallbackData;
     bool CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parentStack, unsigned int lclNum);
     void UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* parentStack, var_types newType);
@@ -184,6 +194,98 @@ inline bool ObjectAllocator::CanAllocateLclVarOnStack(unsigned int         lclNu
     return true;
 }
 
+//------------------------------------------------------------------------
+// CanAllocateArrayLclVarOnStack: Returns true iff local variable holding a
+//                                new single-dimensional array can be
+//                                allocated on the stack.
+//
+// Arguments:
+//    lclNum    - Local variable number
+//    clsHnd    - Class handle of the array type
+//    length    - Length operand of the allocation
+//    blockSize - [out] if result is true, size of the stack allocated array
+//    reason    - [out, required] if result is false, reason why
+//
+// Return Value:
+//    Returns true iff local variable can be allocated on the stack.
+//
+// Notes:
+//    Only arrays with a constant length and elements that do not contain GC
+//    pointers are stack allocated, so the stack local needs no GC layout.
+//
+inline bool ObjectAllocator::CanAllocateArrayLclVarOnStack(unsigned int         lclNum,
+                                                           CORINFO_CLASS_HANDLE clsHnd,
+                                                           GenTree*             length,
+                                                           unsigned int*        blockSize,
+                                                           const char**         reason)
+{
+    assert(m_AnalysisDone);
+
+    *reason = "[ok]";
+
+#ifdef DEBUG
+    if (JitConfig.JitObjectStackAllocationArray() == 0)
+    {
+        *reason = "[disabled by config]";
+        return false;
+    }
+#endif
+
+    if ((clsHnd == NO_CLASS_HANDLE) || !length->IsCnsIntOrI())
+    {
+        *reason = "[non-constant length]";
+        return false;
+    }
+
+    const ssize_t numElements = length->AsIntCon()->IconValue();
+    if ((numElements < 0) || (numElements > (ssize_t)s_StackAllocMaxSize))
+    {
+        *reason = "[invalid or too large length]";
+        return false;
+    }
+
+    CORINFO_CLASS_HANDLE elemClsHnd = NO_CLASS_HANDLE;
+    const var_types      elemType   = JITtype2varType(comp->info.compCompHnd->getChildType(clsHnd, &elemClsHnd));
+    unsigned int         elemSize   = 0;
+
+    if (elemType == TYP_STRUCT)
+    {
+        ClassLayout* const elemLayout = comp->typGetObjLayout(elemClsHnd);
+        if (elemLayout->HasGCPtr())
+        {
+            *reason = "[elements contain gc refs]";
+            return false;
+        }
+
+        elemSize = elemLayout->GetSize();
+    }
+    else if (varTypeIsGC(elemType) || (elemType == TYP_UNDEF))
+    {
+        *reason = "[elements contain gc refs]";
+        return false;
+    }
+    else
+    {
+        elemSize = genTypeSize(elemType);
+    }
+
+    const uint64_t size = OFFSETOF__CORINFO_Array__data + (uint64_t)numElements * elemSize;
+    if (size > s_StackAllocMaxSize)
+    {
+        *reason = "[too large]";
+        return false;
+    }
+
+    if (CanLclVarEscape(lclNum))
+    {
+        *reason = "[escapes]";
+        return false;
+    }
+
+    *blockSize = (unsigned int)size;
+    return true;
+}
+
 //------------------------------------------------------------------------
 // CanLclVarEscape:          Returns true iff local variable can
 //                           potentially escape from the method
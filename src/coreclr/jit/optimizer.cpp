@@ -4333,6 +4333,25 @@ void Compiler::optHoistLoopBlocks(FlowGraphNaturalLoop*    loop,
         LoopHoistContext*     m_hoistContext;
         BasicBlock*           m_currentBlock;
 
+        //------------------------------------------------------------------------
+        // CanHoistCctorTrigger: Check if a helper call that may run a precise-init
+        //   class constructor can be hoisted at the current point of the walk.
+        //
+        // Returns:
+        //   True if the call is in the loop header before any side effect.
+        //
+        // Notes:
+        //   The pre-header falls through into the header unconditionally, so a
+        //   call that is reached in the header before any observable effect would
+        //   run the constructor at the same point on loop entry either way. Later
+        //   iterations only repeat an initialization check that is now a no-op.
+        //
+        bool CanHoistCctorTrigger()
+        {
+            return m_beforeSideEffect && (m_currentBlock == m_loop->GetHeader()) &&
+                   (JitConfig.JitHoistPreciseInitHelpers() != 0);
+        }
+
         bool IsNodeHoistable(GenTree* node)
         {
             // TODO-CQ: This is a more restrictive version of a check that optIsCSEcandidate already does - it allows
@@ -4656,7 +4675,7 @@ void Compiler::optHoistLoopBlocks(FlowGraphNaturalLoop*    loop,
                             treeIsHoistable = false;
                         }
                         else if (s_helperCallProperties.MayRunCctor(helpFunc) &&
-                                 ((call->gtFlags & GTF_CALL_HOISTABLE) == 0))
+                                 ((call->gtFlags & GTF_CALL_HOISTABLE) == 0) && !CanHoistCctorTrigger())
                         {
                             INDEBUG(failReason = "non-hoistable helper call";)
                             treeIsHoistable = false;
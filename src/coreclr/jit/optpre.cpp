@@ -0,0 +1,503 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+/*XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+XX                                                                           XX
+XX                      Partial Redundancy Elimination                       XX
+XX                                                                           XX
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+*/
+
+#include "jitpch.h"
+#ifdef _MSC_VER
+#pragma hdrstop
+#endif
+
+#include "sideeffects.h"
+
+//-----------------------------------------------------------------------------
+// OptPartialRedundancy: Value number based elimination of expressions that
+// are redundant on some, but not all, paths into a join.
+//
+// Consider a join block J with two predecessors P1 and P2, where J computes
+// an expression E that was already computed in P1 (with the same value
+// number) but not in P2:
+//
+//   P1: ... E ...          P2: ...
+//          \                 /
+//           J: ... E ...
+//
+// If P2 always flows to J, E can be computed at the end of P2 instead, which
+// makes it fully redundant in J:
+//
+//   P1: ... (t = E) ...    P2: ... t = E
+//          \                 /
+//           J: ... t ...
+//
+// This covers both diamonds and loop-carried redundancies (J being a loop
+// header, P1 its latch and P2 its preheader). No path evaluates E more often
+// than it did before.
+//
+// Loads may throw and may be affected by stores, so E is only moved to P2 if
+// nothing in J that executes before it interferes with it, as determined by
+// side effect analysis. Additionally, the locals E uses cannot be defined in
+// J, so E evaluates to the same value at the end of P2.
+//
+class OptPartialRedundancy
+{
+    Compiler*   m_comp;
+    BasicBlock* m_join;
+    BasicBlock* m_preds[2];
+
+    bool     IsCandidate(GenTree* tree);
+    bool     IsCandidateOperand(GenTree* tree, bool* hasLoad);
+    bool     CanEvaluateAtPredEnd(Statement* stmt, GenTree* expr, const SideEffectSet& priorEffects);
+    bool     TryEliminate(Statement* stmt, GenTree* expr);
+    GenTree* FindOccurrence(BasicBlock* block, GenTree* expr, Statement** occurrenceStmt);
+    void     Eliminate(Statement*  stmt,
+                       GenTree*    expr,
+                       BasicBlock* availPred,
+                       Statement*  occurrenceStmt,
+                       GenTree*    occurrence,
+                       BasicBlock* insertPred);
+    void     ReplaceNode(Statement* stmt, GenTree* node, GenTree* replacement);
+
+public:
+    OptPartialRedundancy(Compiler* comp, BasicBlock* join)
+        : m_comp(comp)
+        , m_join(join)
+    {
+    }
+
+    bool     CanOptimize();
+    unsigned Optimize();
+};
+
+//-----------------------------------------------------------------------------
+// CanOptimize: Check whether the join has the shape we can handle.
+//
+// Returns:
+//   True if the join has exactly two predecessors in its EH region and at
+//   least one of them unconditionally flows into it.
+//
+bool OptPartialRedundancy::CanOptimize()
+{
+    if ((m_join == m_comp->fgFirstBB) || (m_join->countOfInEdges() != 2) || m_comp->bbIsHandlerBeg(m_join))
+    {
+        return false;
+    }
+
+    unsigned numPreds = 0;
+    for (BasicBlock* const pred : m_join->PredBlocks())
+    {
+        if ((numPreds == 2) || (pred == m_join) || !BasicBlock::sameEHRegion(pred, m_join))
+        {
+            return false;
+        }
+
+        m_preds[numPreds++] = pred;
+    }
+
+    if ((numPreds != 2) || (m_preds[0] == m_preds[1]))
+    {
+        return false;
+    }
+
+    return m_preds[0]->KindIs(BBJ_ALWAYS) || m_preds[1]->KindIs(BBJ_ALWAYS);
+}
+
+//-----------------------------------------------------------------------------
+// Optimize: Eliminate partially redundant expressions in the join.
+//
+// Returns:
+//   The number of eliminated expressions.
+//
+unsigned OptPartialRedundancy::Optimize()
+{
+    JITDUMP("Looking for partially redundant expressions in " FMT_BB " with preds " FMT_BB " and " FMT_BB "\n",
+            m_join->bbNum, m_preds[0]->bbNum, m_preds[1]->bbNum);
+
+    // Side effects of the statements of the join that precede the one being
+    // looked at.
+    SideEffectSet priorEffects;
+    unsigned      numEliminated = 0;
+
+    for (Statement* const stmt : m_join->NonPhiStatements())
+    {
+        // Walk the statement in reverse execution order, so that outer
+        // expressions are considered before the expressions nested in them.
+        // After a change the statement is resequenced, so at most one change
+        // is made per statement.
+        for (GenTree* tree = stmt->GetRootNode(); tree != nullptr; tree = tree->gtPrev)
+        {
+            if (IsCandidate(tree) && CanEvaluateAtPredEnd(stmt, tree, priorEffects) && TryEliminate(stmt, tree))
+            {
+                numEliminated++;
+                break;
+            }
+        }
+
+        for (GenTree* const tree : stmt->TreeList())
+        {
+            priorEffects.AddNode(m_comp, tree);
+        }
+    }
+
+    return numEliminated;
+}
+
+//-----------------------------------------------------------------------------
+// IsCandidate: Check whether an expression in the join may be considered.
+//
+// Arguments:
+//   tree - The expression
+//
+// Returns:
+//   True if the expression is a load, or an expensive enough computation,
+//   that is unaffected by the definitions made in the join.
+//
+bool OptPartialRedundancy::IsCandidate(GenTree* tree)
+{
+    if (!varTypeIsIntegralOrI(tree) && !varTypeIsFloating(tree))
+    {
+        return false;
+    }
+
+    // Small typed loads would need to be normalized into the temp.
+    if (varTypeIsSmall(tree) || tree->OperIsConst() || tree->OperIsLocal() || !tree->CanCSE())
+    {
+        return false;
+    }
+
+    ValueNum vn = m_comp->vnStore->VNConservativeNormalValue(tree->gtVNPair);
+    if ((vn == ValueNumStore::NoVN) || m_comp->vnStore->IsVNConstant(vn))
+    {
+        return false;
+    }
+
+    bool hasLoad = false;
+    if (!IsCandidateOperand(tree, &hasLoad))
+    {
+        return false;
+    }
+
+    // Moving cheap computations and keeping their result alive across the
+    // join is not worth it.
+    return hasLoad || (tree->GetCostEx() >= 3 * Compiler::MIN_CSE_COST);
+}
+
+//-----------------------------------------------------------------------------
+// IsCandidateOperand: Check whether an operand of a candidate is something
+// that can be cloned into a predecessor of the join.
+//
+// Arguments:
+//   tree    - The operand
+//   hasLoad - [out] set to true if the operand contains a load
+//
+// Returns:
+//   True if the operand is made up of loads, pure operations, constants and
+//   locals that are not defined in the join.
+//
+bool OptPartialRedundancy::IsCandidateOperand(GenTree* tree, bool* hasLoad)
+{
+    switch (tree->OperGet())
+    {
+        case GT_CNS_INT:
+        case GT_CNS_LNG:
+        case GT_CNS_DBL:
+        case GT_LCL_ADDR:
+            return true;
+
+        case GT_LCL_VAR:
+        {
+            GenTreeLclVarCommon* lcl = tree->AsLclVarCommon();
+            if (!m_comp->lvaInSsa(lcl->GetLclNum()) || !lcl->HasSsaName())
+            {
+                return false;
+            }
+
+            // The local must have the same value at the end of the
+            // predecessors, so it cannot be defined by a phi in the join.
+            LclSsaVarDsc* ssaDsc = m_comp->lvaGetDesc(lcl)->GetPerSsaData(lcl->GetSsaNum());
+            return ssaDsc->GetBlock() != m_join;
+        }
+
+        case GT_IND:
+        case GT_ARR_LENGTH:
+            if (((tree->gtFlags & GTF_IND_VOLATILE) != 0) || varTypeIsStruct(tree))
+            {
+                return false;
+            }
+
+            *hasLoad = true;
+            break;
+
+        case GT_ADD:
+        case GT_SUB:
+        case GT_MUL:
+        case GT_AND:
+        case GT_OR:
+        case GT_XOR:
+        case GT_LSH:
+        case GT_RSH:
+        case GT_RSZ:
+        case GT_NEG:
+        case GT_NOT:
+        case GT_CAST:
+            if (tree->gtOverflowEx())
+            {
+                return false;
+            }
+            break;
+
+        default:
+            return false;
+    }
+
+    if ((tree->gtFlags & (GTF_ASG | GTF_CALL | GTF_ORDER_SIDEEFF)) != 0)
+    {
+        return false;
+    }
+
+    bool result = true;
+    tree->VisitOperands([=, &result](GenTree* op) {
+        result = IsCandidateOperand(op, hasLoad);
+        return result ? GenTree::VisitResult::Continue : GenTree::VisitResult::Abort;
+    });
+
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// CanEvaluateAtPredEnd: Check whether an expression of the join can be
+// evaluated at the end of a predecessor instead.
+//
+// Arguments:
+//   stmt         - The statement containing the expression
+//   expr         - The expression
+//   priorEffects - Side effects of the statements before "stmt" in the join
+//
+// Returns:
+//   True if nothing executed before "expr" in the join interferes with it,
+//   such that evaluating it earlier produces the same value, and the same
+//   exception, if any.
+//
+bool OptPartialRedundancy::CanEvaluateAtPredEnd(Statement*           stmt,
+                                                GenTree*             expr,
+                                                const SideEffectSet& priorEffects)
+{
+    GenTree* const firstNode = Compiler::fgGetFirstNode(expr);
+
+    SideEffectSet exprEffects;
+    for (GenTree* node = firstNode; node != expr->gtNext; node = node->gtNext)
+    {
+        exprEffects.AddNode(m_comp, node);
+    }
+
+    if (priorEffects.InterferesWith(exprEffects, /* strict */ true))
+    {
+        return false;
+    }
+
+    SideEffectSet stmtEffects;
+    for (GenTree* node = stmt->GetTreeList(); node != firstNode; node = node->gtNext)
+    {
+        stmtEffects.AddNode(m_comp, node);
+    }
+
+    return !stmtEffects.InterferesWith(exprEffects, /* strict */ true);
+}
+
+//-----------------------------------------------------------------------------
+// TryEliminate: Try to make an expression of the join fully redundant.
+//
+// Arguments:
+//   stmt - The statement containing the expression
+//   expr - The expression
+//
+// Returns:
+//   True if the expression is computed by one predecessor and could be
+//   computed at the end of the other, and the IR was changed accordingly.
+//
+bool OptPartialRedundancy::TryEliminate(Statement* stmt, GenTree* expr)
+{
+    for (unsigned i = 0; i < 2; i++)
+    {
+        BasicBlock* const availPred  = m_preds[i];
+        BasicBlock* const insertPred = m_preds[1 - i];
+
+        if (!insertPred->KindIs(BBJ_ALWAYS))
+        {
+            continue;
+        }
+
+        Statement* occurrenceStmt = nullptr;
+        GenTree*   occurrence     = FindOccurrence(availPred, expr, &occurrenceStmt);
+        if (occurrence == nullptr)
+        {
+            continue;
+        }
+
+        // If both predecessors compute it, it is fully redundant; leave it to CSE.
+        Statement* otherStmt = nullptr;
+        if (FindOccurrence(insertPred, expr, &otherStmt) != nullptr)
+        {
+            return false;
+        }
+
+        Eliminate(stmt, expr, availPred, occurrenceStmt, occurrence, insertPred);
+        return true;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// FindOccurrence: Find the last computation of an expression's value in a
+// block.
+//
+// Arguments:
+//   block          - The block to look in
+//   expr           - The expression
+//   occurrenceStmt - [out] the statement containing the occurrence
+//
+// Returns:
+//   A node of the same kind and with the same value as "expr", or nullptr if
+//   there is none.
+//
+GenTree* OptPartialRedundancy::FindOccurrence(BasicBlock* block, GenTree* expr, Statement** occurrenceStmt)
+{
+    GenTree* occurrence = nullptr;
+    for (Statement* const stmt : block->NonPhiStatements())
+    {
+        for (GenTree* const tree : stmt->TreeList())
+        {
+            if ((tree->OperGet() == expr->OperGet()) && (tree->TypeGet() == expr->TypeGet()) && tree->CanCSE() &&
+                (m_comp->vnStore->VNPNormalPair(tree->gtVNPair) == m_comp->vnStore->VNPNormalPair(expr->gtVNPair)))
+            {
+                occurrence      = tree;
+                *occurrenceStmt = stmt;
+            }
+        }
+    }
+
+    return occurrence;
+}
+
+//-----------------------------------------------------------------------------
+// Eliminate: Make an expression of the join fully redundant by evaluating it
+// into a temp at its occurrence in one predecessor and at the end of the
+// other predecessor.
+//
+// Arguments:
+//   stmt           - The statement in the join containing the expression
+//   expr           - The expression
+//   availPred      - The predecessor computing the expression
+//   occurrenceStmt - The statement containing the occurrence in "availPred"
+//   occurrence     - The occurrence in "availPred"
+//   insertPred     - The predecessor to insert a computation into
+//
+void OptPartialRedundancy::Eliminate(Statement*  stmt,
+                                     GenTree*    expr,
+                                     BasicBlock* availPred,
+                                     Statement*  occurrenceStmt,
+                                     GenTree*    occurrence,
+                                     BasicBlock* insertPred)
+{
+    JITDUMP("[%06u] in " FMT_BB " is available from " FMT_BB " ([%06u]); computing it at the end of " FMT_BB "\n",
+            Compiler::dspTreeID(expr), m_join->bbNum, availPred->bbNum, Compiler::dspTreeID(occurrence),
+            insertPred->bbNum);
+
+    ValueNumStore* const vnStore = m_comp->vnStore;
+    var_types const      type    = genActualType(expr);
+    unsigned const       lclNum  = m_comp->lvaGrabTemp(false DEBUGARG("PRE temp"));
+
+    m_comp->lvaGetDesc(lclNum)->lvType = type;
+
+    // Compute the value into the temp at the existing occurrence.
+    GenTree* occurrenceStore  = m_comp->gtNewTempStore(lclNum, occurrence);
+    occurrenceStore->gtVNPair = ValueNumStore::VNPForVoid();
+
+    GenTree* occurrenceUse    = m_comp->gtNewLclvNode(lclNum, type);
+    occurrenceUse->gtVNPair   = vnStore->VNPNormalPair(occurrence->gtVNPair);
+    GenTree* occurrenceComma  = m_comp->gtNewOperNode(GT_COMMA, type, occurrenceStore, occurrenceUse);
+    occurrenceComma->gtVNPair = occurrence->gtVNPair;
+    ReplaceNode(occurrenceStmt, occurrence, occurrenceComma);
+
+    // Compute the value into the temp at the end of the other predecessor.
+    GenTree* insertStore  = m_comp->gtNewTempStore(lclNum, m_comp->gtCloneExpr(expr));
+    insertStore->gtVNPair = ValueNumStore::VNPForVoid();
+    Statement* insertStmt = m_comp->fgNewStmtAtEnd(insertPred, insertStore, stmt->GetDebugInfo());
+    m_comp->gtSetStmtInfo(insertStmt);
+    m_comp->fgSetStmtSeq(insertStmt);
+
+    // The clone has new uses of the SSA locals.
+    for (GenTree* const node : insertStmt->TreeList())
+    {
+        if (node->OperIs(GT_LCL_VAR) && node->AsLclVarCommon()->HasSsaName())
+        {
+            GenTreeLclVarCommon* lcl = node->AsLclVarCommon();
+            m_comp->lvaGetDesc(lcl)->GetPerSsaData(lcl->GetSsaNum())->AddUse(insertPred);
+        }
+    }
+
+    // And use the temp in the join.
+    GenTree* joinUse  = m_comp->gtNewLclvNode(lclNum, type);
+    joinUse->gtVNPair = vnStore->VNPNormalPair(expr->gtVNPair);
+    ReplaceNode(stmt, expr, joinUse);
+
+    DISPSTMT(occurrenceStmt);
+    DISPSTMT(insertStmt);
+    DISPSTMT(stmt);
+}
+
+//-----------------------------------------------------------------------------
+// ReplaceNode: Replace a node in a statement and update the statement.
+//
+// Arguments:
+//   stmt        - The statement
+//   node        - The node to replace
+//   replacement - The replacement
+//
+void OptPartialRedundancy::ReplaceNode(Statement* stmt, GenTree* node, GenTree* replacement)
+{
+    Compiler::FindLinkData linkData = m_comp->gtFindLink(stmt, node);
+    noway_assert(linkData.result != nullptr);
+    *linkData.result = replacement;
+
+    m_comp->gtUpdateStmtSideEffects(stmt);
+    m_comp->gtSetStmtInfo(stmt);
+    m_comp->fgSetStmtSeq(stmt);
+}
+
+//-----------------------------------------------------------------------------
+// optPartialRedundancyElimination: Eliminate expressions that are redundant
+// on one of the two paths into a join, by computing them on the other path.
+//
+// Returns:
+//   Suitable phase status.
+//
+PhaseStatus Compiler::optPartialRedundancyElimination()
+{
+    if (!opts.OptimizationEnabled())
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    unsigned numEliminated = 0;
+    for (BasicBlock* const block : Blocks())
+    {
+        OptPartialRedundancy pre(this, block);
+        if (pre.CanOptimize())
+        {
+            numEliminated += pre.Optimize();
+        }
+    }
+
+    JITDUMP("Eliminated %u partially redundant expressions\n", numEliminated);
+    Metrics.PartialRedundanciesEliminated += (int)numEliminated;
+
+    return (numEliminated > 0) ? PhaseStatus::MODIFIED_EVERYTHING : PhaseStatus::MODIFIED_NOTHING;
+}
@@ -709,6 +709,20 @@ public:
                     }
 
                     unsigned layoutOffset = access.Offset - otherAccess.Offset;
+
+                    // HFAs are passed with one float register per element, so
+                    // a field covering exactly one element maps to a register
+                    // even when it is not pointer-aligned.
+                    if (GlobalJitOptions::compFeatureHfa && !otherAccess.Layout->IsBlockLayout())
+                    {
+                        var_types hfaType = comp->GetHfaType(otherAccess.Layout->GetClassHandle());
+                        if ((hfaType != TYP_UNDEF) && (access.AccessType == hfaType) &&
+                            ((layoutOffset % genTypeSize(hfaType)) == 0))
+                        {
+                            return true;
+                        }
+                    }
+
                     if ((layoutOffset % TARGET_POINTER_SIZE) != 0)
                     {
                         return false;
@@ -2138,8 +2152,10 @@ bool ReplaceVisitor::ReplaceCallArgWithFieldList(GenTreeCall* call, GenTreeLclVa
         const ABIPassingSegment& seg = callArg->NewAbiInfo.Segment(i);
 
         Replacement* rep = nullptr;
+        // Prefer the replacement whenever it is up to date, even if the
+        // struct local is as well; that avoids a stack load of the field.
         if (agg->OverlappingReplacements(argNode->GetLclOffs() + seg.Offset, seg.Size, &rep, nullptr) &&
-            rep->NeedsWriteBack)
+            !rep->NeedsReadBack)
         {
             GenTreeLclVar* fieldValue = m_compiler->gtNewLclvNode(rep->LclNum, rep->AccessType);
 
@@ -5,6 +5,7 @@
 
 #include "jitpch.h"
 #include "rangecheck.h"
+#include "scev.h"
 
 //------------------------------------------------------------------------
 // rangeCheckPhase: optimize bounds checks via range analysis
@@ -38,6 +39,7 @@ RangeCheck::RangeCheck(Compiler* pCompiler)
     , m_alloc(pCompiler->getAllocator(CMK_RangeCheck))
     , m_nVisitBudget(MAX_VISIT_BUDGET)
     , m_updateStmt(false)
+    , m_scevContext(nullptr)
 {
 }
 
@@ -269,8 +271,7 @@ void RangeCheck::OptimizeRangeCheck(BasicBlock* block, Statement* stmt, GenTree*
         if ((idxVal < arrSize) && (idxVal >= 0))
         {
             JITDUMP("Removing range check\n");
-            m_pCompiler->optRemoveRangeCheck(bndsChk, comma, stmt);
-            m_updateStmt = true;
+            RemoveRangeCheck(bndsChk, comma, stmt);
             return;
         }
     }
@@ -318,8 +319,7 @@ void RangeCheck::OptimizeRangeCheck(BasicBlock* block, Statement* stmt, GenTree*
                     (lenLowerLimit >= -delta))
                 {
                     JITDUMP("[RangeCheck::OptimizeRangeCheck] Between bounds\n");
-                    m_pCompiler->optRemoveRangeCheck(bndsChk, comma, stmt);
-                    m_updateStmt = true;
+                    RemoveRangeCheck(bndsChk, comma, stmt);
                     return;
                 }
             }
@@ -335,12 +335,57 @@ void RangeCheck::OptimizeRangeCheck(BasicBlock* block, Statement* stmt, GenTree*
         if (funcApp.m_args[1] == arrLenVn)
         {
             JITDUMP("[RangeCheck::OptimizeRangeCheck] UMOD(X, ARR_LEN) is always between bounds\n");
-            m_pCompiler->optRemoveRangeCheck(bndsChk, comma, stmt);
-            m_updateStmt = true;
+            RemoveRangeCheck(bndsChk, comma, stmt);
             return;
         }
     }
 
+    if (IsInBoundsByRange(block, bndsChk, arrSize))
+    {
+        JITDUMP("[RangeCheck::OptimizeRangeCheck] Between bounds\n");
+        RemoveRangeCheck(bndsChk, comma, stmt);
+        return;
+    }
+
+    if (IsInBoundsByScev(block, bndsChk, arrSize))
+    {
+        JITDUMP("[RangeCheck::OptimizeRangeCheck] In bounds on every iteration of the containing loop\n");
+        RemoveRangeCheck(bndsChk, comma, stmt);
+        m_pCompiler->Metrics.RangeChecksRemovedByScev++;
+    }
+}
+
+//------------------------------------------------------------------------
+// RemoveRangeCheck: Remove a bounds check that was proven to be redundant.
+//
+// Arguments:
+//    bndsChk - The bounds check
+//    comma   - The COMMA node the bounds check is the first operand of, or nullptr
+//    stmt    - The statement containing the bounds check
+//
+void RangeCheck::RemoveRangeCheck(GenTreeBoundsChk* bndsChk, GenTree* comma, Statement* stmt)
+{
+    m_pCompiler->optRemoveRangeCheck(bndsChk, comma, stmt);
+    m_pCompiler->Metrics.RangeChecksRemoved++;
+    m_updateStmt = true;
+}
+
+//------------------------------------------------------------------------
+// IsInBoundsByRange: Check whether the index of a bounds check is within
+// bounds by computing its range.
+//
+// Arguments:
+//    block   - The block containing the bounds check
+//    bndsChk - The bounds check
+//    arrSize - Known lower bound of the length, or 0 if not known
+//
+// Returns:
+//    True if the index was proven to be within bounds.
+//
+bool RangeCheck::IsInBoundsByRange(BasicBlock* block, GenTreeBoundsChk* bndsChk, int arrSize)
+{
+    GenTree* treeIndex = bndsChk->GetIndex();
+
     // Get the range for this index.
     Range range = GetRange(block, treeIndex, false DEBUGARG(0));
 
@@ -350,13 +395,13 @@ void RangeCheck::OptimizeRangeCheck(BasicBlock* block, Statement* stmt, GenTree*
     {
         // Note: If we had stack depth too deep in the GetRange call, we'd be
         // too deep even in the DoesOverflow call. So return early.
-        return;
+        return false;
     }
 
     if (DoesOverflow(block, treeIndex, range))
     {
         JITDUMP("Method determined to overflow.\n");
-        return;
+        return false;
     }
 
     JITDUMP("Range value %s\n", range.ToString(m_pCompiler));
@@ -366,16 +411,210 @@ void RangeCheck::OptimizeRangeCheck(BasicBlock* block, Statement* stmt, GenTree*
     // If upper or lower limit is unknown, then return.
     if (range.UpperLimit().IsUnknown() || range.LowerLimit().IsUnknown())
     {
-        return;
+        return false;
     }
 
     // Is the range between the lower and upper bound values.
-    if (BetweenBounds(range, bndsChk->GetArrayLength(), arrSize))
+    return BetweenBounds(range, bndsChk->GetArrayLength(), arrSize);
+}
+
+//------------------------------------------------------------------------
+// IsInBoundsByScev: Check whether the index of a bounds check is within
+// bounds on every iteration of the innermost loop containing it.
+//
+// Arguments:
+//    block   - The block containing the bounds check
+//    bndsChk - The bounds check
+//    arrSize - Known lower bound of the length, or 0 if not known
+//
+// Returns:
+//    True if the index was proven to be within bounds.
+//
+// Remarks:
+//    The index must be an add recurrence <L, start, step> with a constant
+//    non-negative start and a constant positive step. Any exiting block that
+//    dominates all backedges of the loop bounds the backedge count BC, so the
+//    index is within bounds if its last value (start + step * BC) is less
+//    than the length. This catches indices that range analysis cannot reason
+//    about, e.g. ones bounded by the trip count of the loop rather than by a
+//    dominating compare against the length, as is common in loop nests.
+//
+bool RangeCheck::IsInBoundsByScev(BasicBlock* block, GenTreeBoundsChk* bndsChk, int arrSize)
+{
+    if (!m_pCompiler->fgMightHaveNaturalLoops || (JitConfig.JitEnableRangeCheckScev() == 0))
     {
-        JITDUMP("[RangeCheck::OptimizeRangeCheck] Between bounds\n");
-        m_pCompiler->optRemoveRangeCheck(bndsChk, comma, stmt);
-        m_updateStmt = true;
+        return false;
+    }
+
+    if (m_scevContext == nullptr)
+    {
+        // The loop structures may have been invalidated by RBO and assertion prop;
+        // recompute them. Removing bounds checks does not change the flow graph,
+        // so they stay valid for the rest of this phase.
+        m_pCompiler->optReachableBitVecTraits = nullptr;
+        m_pCompiler->m_dfsTree                = m_pCompiler->fgComputeDfs();
+        m_pCompiler->m_domTree                = FlowGraphDominatorTree::Build(m_pCompiler->m_dfsTree);
+        m_pCompiler->m_loops                  = FlowGraphNaturalLoops::Find(m_pCompiler->m_dfsTree);
+        m_pCompiler->m_blockToLoop            = BlockToNaturalLoopMap::Build(m_pCompiler->m_loops);
+        m_scevContext                         = new (m_alloc) ScalarEvolutionContext(m_pCompiler);
+    }
+
+    if (!m_pCompiler->m_dfsTree->Contains(block))
+    {
+        return false;
+    }
+
+    FlowGraphNaturalLoop* loop = m_pCompiler->m_blockToLoop->GetLoop(block);
+    if ((loop == nullptr) || loop->MayExecuteBlockMultipleTimesPerIteration(block))
+    {
+        return false;
+    }
+
+    m_scevContext->ResetForLoop(loop);
+
+    Scev* scev = m_scevContext->Analyze(block, bndsChk->GetIndex());
+    if (scev == nullptr)
+    {
+        return false;
+    }
+
+    scev = m_scevContext->Simplify(scev);
+    if (!scev->OperIs(ScevOper::AddRec) || !scev->TypeIs(TYP_INT))
+    {
+        return false;
+    }
+
+    ScevAddRec* addRec = (ScevAddRec*)scev;
+    int64_t     startCns;
+    int64_t     stepCns;
+    if (!addRec->Start->GetConstantValue(m_pCompiler, &startCns) || (startCns < 0) ||
+        !addRec->Step->GetConstantValue(m_pCompiler, &stepCns) || (stepCns <= 0))
+    {
+        return false;
     }
+
+    JITDUMP("[RangeCheck::IsInBoundsByScev] Index is ");
+    DBEXEC(m_pCompiler->verbose, addRec->Dump(m_pCompiler));
+    JITDUMP(" in " FMT_LP "\n", loop->GetIndex());
+
+    ValueNum arrLenVN = m_pCompiler->vnStore->VNConservativeNormalValue(bndsChk->GetArrayLength()->gtVNPair);
+    bool     inBounds = false;
+
+    m_pCompiler->optVisitBoundingExitingCondBlocks(loop, [=, &inBounds](BasicBlock* exiting) {
+        if (inBounds || loop->MayExecuteBlockMultipleTimesPerIteration(exiting))
+        {
+            return;
+        }
+
+        Scev* backedgeCount = m_scevContext->ComputeExitNotTakenCount(exiting);
+        if ((backedgeCount == nullptr) || !backedgeCount->TypeIs(TYP_INT))
+        {
+            return;
+        }
+
+        int64_t backedgeCountCns;
+        if (backedgeCount->GetConstantValue(m_pCompiler, &backedgeCountCns))
+        {
+            // All operands are int32 values, so this cannot overflow int64.
+            int64_t lastCns = startCns + stepCns * backedgeCountCns;
+            if ((backedgeCountCns >= 0) && (lastCns <= INT32_MAX))
+            {
+                ValueNum lastVN = m_pCompiler->vnStore->VNForIntCon(static_cast<int32_t>(lastCns));
+                inBounds        = IsLastValueInBounds(lastVN, arrLenVN, arrSize);
+            }
+
+            return;
+        }
+
+        // With a symbolic backedge count we can only reason about the index
+        // when it is exactly the iteration number (0, 1, ..., BC), since that
+        // cannot wrap around without exceeding the length first.
+        if ((startCns != 0) || (stepCns != 1))
+        {
+            return;
+        }
+
+        ValueNum lastVN = m_scevContext->MaterializeVN(backedgeCount).GetConservative();
+        if (lastVN != ValueNumStore::NoVN)
+        {
+            inBounds = IsLastValueInBounds(lastVN, arrLenVN, arrSize);
+        }
+    });
+
+    return inBounds;
+}
+
+//------------------------------------------------------------------------
+// IsLastValueInBounds: Check whether the last value of an index that
+// starts at zero and counts up by one is less than the length.
+//
+// Arguments:
+//    lastVN   - The value of the index in the last iteration of the loop
+//    arrLenVN - The length
+//    arrSize  - Known lower bound of the length, or 0 if not known
+//
+// Returns:
+//    True if the index is known to be less than the length.
+//
+// Remarks:
+//    Since the length never exceeds INT32_MAX, an unsigned compare also
+//    establishes that the count did not wrap around.
+//
+bool RangeCheck::IsLastValueInBounds(ValueNum lastVN, ValueNum arrLenVN, int arrSize)
+{
+    ValueNumStore* vnStore = m_pCompiler->vnStore;
+
+    if (vnStore->IsVNInt32Constant(lastVN))
+    {
+        int lastCns = vnStore->GetConstantInt32(lastVN);
+        if ((lastCns >= 0) && (lastCns < arrSize))
+        {
+            return true;
+        }
+    }
+
+    ValueNum relop = vnStore->VNForFunc(TYP_INT, VNF_LT_UN, lastVN, arrLenVN);
+    if (m_scevContext->EvaluateRelop(relop) == RelopEvaluationResult::True)
+    {
+        return true;
+    }
+
+    // Counted loops usually have a backedge count of the form (n - c); see if
+    // we can prove c <= n <= length instead, which implies 0 <= n - c < length.
+    VNFuncApp funcApp;
+    if (!vnStore->GetVNFunc(lastVN, &funcApp) || (funcApp.m_func != (VNFunc)GT_ADD))
+    {
+        return false;
+    }
+
+    ValueNum bound;
+    ValueNum deltaVN;
+    if (vnStore->IsVNInt32Constant(funcApp.m_args[1]))
+    {
+        bound   = funcApp.m_args[0];
+        deltaVN = funcApp.m_args[1];
+    }
+    else if (vnStore->IsVNInt32Constant(funcApp.m_args[0]))
+    {
+        bound   = funcApp.m_args[1];
+        deltaVN = funcApp.m_args[0];
+    }
+    else
+    {
+        return false;
+    }
+
+    // Negative delta (n + -c), with c small enough to not overflow on negation.
+    const int delta = vnStore->GetConstantInt32(deltaVN);
+    if ((delta >= 0) || (delta <= -CORINFO_Array_MaxLength))
+    {
+        return false;
+    }
+
+    ValueNum lowerRelop = vnStore->VNForFunc(TYP_INT, VNF_GE, bound, vnStore->VNForIntCon(-delta));
+    ValueNum upperRelop = vnStore->VNForFunc(TYP_INT, VNF_LE_UN, bound, arrLenVN);
+    return (m_scevContext->EvaluateRelop(lowerRelop) == RelopEvaluationResult::True) &&
+           (m_scevContext->EvaluateRelop(upperRelop) == RelopEvaluationResult::True);
 }
 
 void RangeCheck::Widen(BasicBlock* block, GenTree* tree, Range* pRange)
@@ -657,6 +657,23 @@ public:
     // contain the tree.
     void OptimizeRangeCheck(BasicBlock* block, Statement* stmt, GenTree* tree);
 
+    // Remove the bounds check "bndsChk" that was proven redundant, and note that its
+    // statement needs to be re-threaded.
+    void RemoveRangeCheck(GenTreeBoundsChk* bndsChk, GenTree* comma, Statement* stmt);
+
+    // Check whether the index of "bndsChk" is within bounds by computing its range
+    // from its SSA definitions and the assertions that hold at "block".
+    bool IsInBoundsByRange(BasicBlock* block, GenTreeBoundsChk* bndsChk, int arrSize);
+
+    // Check whether the index of "bndsChk" is within bounds on every iteration of the
+    // loop containing "block", by using the scalar evolution of the index and the
+    // backedge count of the loop.
+    bool IsInBoundsByScev(BasicBlock* block, GenTreeBoundsChk* bndsChk, int arrSize);
+
+    // Is "lastVN", the value reached in the last iteration of the loop by an index
+    // that starts at zero and increases by one, known to be less than the length?
+    bool IsLastValueInBounds(ValueNum lastVN, ValueNum arrLenVN, int arrSize);
+
     // Given the index expression try to find its range.
     // The range of a variable depends on its rhs which in turn depends on its constituent variables.
     // The "path" is the path taken in the search for the rhs' range and its constituents' range.
@@ -758,4 +775,9 @@ private:
 
     // Set to "true" whenever we remove a check and need to re-thread the statement.
     bool m_updateStmt;
+
+    // Scalar evolution context used to reason about induction variables; created
+    // along with the loop structures the first time a bounds check in a loop fails
+    // to be removed by range analysis.
+    ScalarEvolutionContext* m_scevContext;
 };
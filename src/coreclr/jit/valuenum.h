@@ -250,23 +250,29 @@ public:
     // VNMap - map from something to ValueNum, where something is typically a constant value or a VNFunc
     //         This class has two purposes - to abstract the implementation and to validate the ValueNums
     //         being stored or retrieved.
-    template <class fromType, class keyfuncs = JitLargePrimitiveKeyFuncs<fromType>>
-    class VNMap : public JitHashTable<fromType, keyfuncs, ValueNum>
+    //
+    //         The maps are JitOpenHashTables by default, so the pointers returned by LookupPointerOrAdd
+    //         must not be held across anything that may add to the same map. Maps whose users do so use
+    //         JitHashTable as the base instead.
+    template <class fromType,
+              class keyfuncs = JitLargePrimitiveKeyFuncs<fromType>,
+              class base     = JitOpenHashTable<fromType, keyfuncs, ValueNum>>
+    class VNMap : public base
     {
     public:
         VNMap(CompAllocator alloc)
-            : JitHashTable<fromType, keyfuncs, ValueNum>(alloc)
+            : base(alloc)
         {
         }
 
         bool Set(fromType k, ValueNum val)
         {
             assert(val != RecursiveVN);
-            return JitHashTable<fromType, keyfuncs, ValueNum>::Set(k, val);
+            return base::Set(k, val);
         }
         bool Lookup(fromType k, ValueNum* pVal = nullptr) const
         {
-            bool result = JitHashTable<fromType, keyfuncs, ValueNum>::Lookup(k, pVal);
+            bool result = base::Lookup(k, pVal);
             assert(!result || *pVal != RecursiveVN);
             return result;
         }
@@ -1967,7 +1973,11 @@ private:
         return m_VNFunc0Map;
     }
 
-    typedef VNMap<VNDefFuncApp<1>, VNDefFuncAppKeyFuncs<1>> VNFunc1ToValueNumMap;
+    // VNForFunc folds while it holds the pointer to the new entry, which may add to these maps again
+    typedef VNMap<VNDefFuncApp<1>,
+                  VNDefFuncAppKeyFuncs<1>,
+                  JitHashTable<VNDefFuncApp<1>, VNDefFuncAppKeyFuncs<1>, ValueNum>>
+        VNFunc1ToValueNumMap;
     VNFunc1ToValueNumMap*                                   m_VNFunc1Map;
     VNFunc1ToValueNumMap*                                   GetVNFunc1Map()
     {
@@ -1978,7 +1988,10 @@ private:
         return m_VNFunc1Map;
     }
 
-    typedef VNMap<VNDefFuncApp<2>, VNDefFuncAppKeyFuncs<2>> VNFunc2ToValueNumMap;
+    typedef VNMap<VNDefFuncApp<2>,
+                  VNDefFuncAppKeyFuncs<2>,
+                  JitHashTable<VNDefFuncApp<2>, VNDefFuncAppKeyFuncs<2>, ValueNum>>
+        VNFunc2ToValueNumMap;
     VNFunc2ToValueNumMap*                                   m_VNFunc2Map;
     VNFunc2ToValueNumMap*                                   GetVNFunc2Map()
     {
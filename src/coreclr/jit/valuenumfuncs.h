@@ -37,6 +37,8 @@ ValueNumFuncDef(ReadyToRunCastClass, 2, false, false, false)          // Args: 0
 ValueNumFuncDef(ReadyToRunIsInstanceOf, 2, false, false, false)       // Args: 0: Helper stub address, 1: object being queried.
 ValueNumFuncDef(TypeHandleToRuntimeType, 1, false, false, false)      // Args: 0: TypeHandle to translate
 ValueNumFuncDef(TypeHandleToRuntimeTypeHandle, 1, false, false, false)      // Args: 0: TypeHandle to translate
+ValueNumFuncDef(TypeHandleToRuntimeTypeMaybeNull, 1, false, false, false)      // Args: 0: TypeHandle to translate, may be null
+ValueNumFuncDef(TypeHandleToRuntimeTypeHandleMaybeNull, 1, false, false, false)      // Args: 0: TypeHandle to translate, may be null
 
 ValueNumFuncDef(LdElemA, 3, false, false, false)            // Args: 0: array value; 1: index value; 2: type handle of element.
 
@@ -187,6 +187,14 @@ public:
 	    return (p);
     }
 
+//*****************************************************************************
+// Return the number of bytes used by the buckets and the entries.
+//*****************************************************************************
+	SIZE_T GetAllocatedSize()
+    {
+        return m_iBuckets * sizeof(int) + m_Heap.Count() * sizeof(Entry);
+    }
+
 private:
 	CDynArray<Entry>  m_Heap;	        // First heap in the list.
 	int			*m_rgBuckets;			// Bucket list.
@@ -54,12 +54,18 @@ HRESULT MDApplyEditAndContinue(         // S_OK or error.
     IMDInternalImport **ppIMD,          // [in, out] The metadata to be updated.
     IMDInternalImportENC *pDeltaMD);    // [in] The delta metadata.
 
+// Tables with fewer rows than this are searched linearly instead of through a lookup hash.
+#define LOOKUP_HASH_ROW_COUNT_THRESHOLD 25
+
 
 //*****************************************************************************
 // Constructor
 //*****************************************************************************
 MDInternalRO::MDInternalRO()
  :  m_pMethodSemanticsMap(0),
+    m_pTypeDefHash(NULL),
+    m_pMethodDefHash(NULL),
+    m_cbLookupHashes(0),
     m_cRefs(1)
 {
 } // MDInternalRO::MDInternalRO
@@ -75,6 +81,10 @@ MDInternalRO::~MDInternalRO()
     if (m_pMethodSemanticsMap)
         delete[] m_pMethodSemanticsMap;
     m_pMethodSemanticsMap = 0;
+    delete m_pTypeDefHash;
+    m_pTypeDefHash = NULL;
+    delete m_pMethodDefHash;
+    m_pMethodDefHash = NULL;
 } // MDInternalRO::~MDInternalRO
 
 //*****************************************************************************
@@ -838,56 +848,170 @@ HRESULT MDInternalRO::FindMethodDefUsingCompare(    // S_OK or error.
         pvSigBlob = (PCCOR_SIGNATURE) qbSig.Ptr();
     }
 
-    // Do a linear search on compressed version
-    //
-    RID         ridMax;
-    MethodRec   *pMethodRec;
-    LPCUTF8     szCurMethodName;
-    void const  *pvCurMethodSig;
-    ULONG       cbSig;
-    TypeDefRec  *pRec;
-    RID         ridStart;
+    // Use the hash for a large table, keeping the first match in table order like the linear search
+    if (CMemberDefHash *pHash = GetMethodDefHash())
+    {
+        ULONG   iHash = HashMethodDef(classdef, szName);
+        RID     ridFound = 0;
+        int     pos;
 
-    // get the typedef record
-    IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(RidFromToken(classdef), &pRec));
+        for (MEMBERDEFHASHENTRY *pEntry = pHash->FindFirst(iHash, pos);
+             pEntry != NULL;
+             pEntry = pHash->FindNext(pos))
+        {
+            if ((pEntry->ulHash != iHash) || (pEntry->tkParent != classdef))
+                continue;
+
+            RID rid = RidFromToken(pEntry->tok);
+            if ((ridFound != 0) && (rid > ridFound))
+                continue;
+
+            IfFailGo(CompareMethodDef(rid, szName, pvSigBlob, cbSigBlob, SigCompare, pSigArgs));
+            if (hr == S_OK)
+                ridFound = rid;
+        }
+
+        if (ridFound != 0)
+        {
+            *pmethoddef = TokenFromRid(ridFound, mdtMethodDef);
+            hr = S_OK;
+            goto ErrExit;
+        }
 
-    // get the range of methoddef rids given the classdef
-    ridStart = m_LiteWeightStgdb.m_MiniMd.getMethodListOfTypeDef(pRec);
-    IfFailGo(m_LiteWeightStgdb.m_MiniMd.getEndMethodListOfTypeDef(RidFromToken(classdef), &ridMax));
+        hr = CLDB_E_RECORD_NOTFOUND;
+        goto ErrExit;
+    }
 
-    // loop through each methoddef
-    for (; ridStart < ridMax; ridStart++)
     {
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetMethodRecord(ridStart, &pMethodRec));
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNameOfMethod(pMethodRec, &szCurMethodName));
-        if (strcmp(szCurMethodName, szName) == 0)
+        // Do a linear search on compressed version
+        //
+        RID         ridMax;
+        TypeDefRec  *pRec;
+        RID         ridStart;
+
+        // get the typedef record
+        IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(RidFromToken(classdef), &pRec));
+
+        // get the range of methoddef rids given the classdef
+        ridStart = m_LiteWeightStgdb.m_MiniMd.getMethodListOfTypeDef(pRec);
+        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getEndMethodListOfTypeDef(RidFromToken(classdef), &ridMax));
+
+        // loop through each methoddef
+        for (; ridStart < ridMax; ridStart++)
         {
-            // name match, now check the signature if specified.
-            if (cbSigBlob && SigCompare)
+            IfFailGo(CompareMethodDef(ridStart, szName, pvSigBlob, cbSigBlob, SigCompare, pSigArgs));
+            if (hr == S_OK)
             {
-                IfFailGo(m_LiteWeightStgdb.m_MiniMd.getSignatureOfMethod(pMethodRec, (PCCOR_SIGNATURE *)&pvCurMethodSig, &cbSig));
-                // Signature comparison is required
-                // Note that if pvSigBlob is vararg, we already preprocess it so that
-                // it only contains the fix part. Therefore, it still should be an exact
-                // match!!!.
-                //
-                if(SigCompare((PCCOR_SIGNATURE) pvCurMethodSig, cbSig, pvSigBlob, cbSigBlob, pSigArgs) == FALSE)
-                    continue;
-            }
-            // Ignore PrivateScope methods.
-            if (IsMdPrivateScope(m_LiteWeightStgdb.m_MiniMd.getFlagsOfMethod(pMethodRec)))
-               continue;
-                    // found the match
-                    *pmethoddef = TokenFromRid(ridStart, mdtMethodDef);
-                    goto ErrExit;
-                }
+                // found the match
+                *pmethoddef = TokenFromRid(ridStart, mdtMethodDef);
+                goto ErrExit;
             }
+        }
+    }
     hr = CLDB_E_RECORD_NOTFOUND;
 
 ErrExit:
     return hr;
 }
 
+//*****************************************************************************
+// Check whether a MethodDef has the given name and, if specified, signature.
+//*****************************************************************************
+__checkReturn
+HRESULT MDInternalRO::CompareMethodDef( // S_OK match, S_FALSE no match.
+    RID         rid,                    // [IN] MethodDef to check.
+    LPCSTR      szName,                 // [IN] Name of the member in utf8.
+    PCCOR_SIGNATURE pvSigBlob,          // [IN] Fixed part of the signature, or NULL.
+    ULONG       cbSigBlob,              // [IN] count of bytes in the signature blob
+    PSIGCOMPARE SigCompare,             // [IN] Signature comparison routine
+    void*       pSigArgs)               // [IN] Additional arguments passed to signature compare
+{
+    HRESULT     hr;
+    MethodRec   *pMethodRec;
+    LPCUTF8     szCurMethodName;
+    void const  *pvCurMethodSig;
+    ULONG       cbSig;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetMethodRecord(rid, &pMethodRec));
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfMethod(pMethodRec, &szCurMethodName));
+    if (strcmp(szCurMethodName, szName) != 0)
+        return S_FALSE;
+
+    // name match, now check the signature if specified.
+    if (cbSigBlob && SigCompare)
+    {
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.getSignatureOfMethod(pMethodRec, (PCCOR_SIGNATURE *)&pvCurMethodSig, &cbSig));
+        // Signature comparison is required
+        // Note that if pvSigBlob is vararg, we already preprocess it so that
+        // it only contains the fix part. Therefore, it still should be an exact
+        // match!!!.
+        //
+        if (SigCompare((PCCOR_SIGNATURE) pvCurMethodSig, cbSig, pvSigBlob, cbSigBlob, pSigArgs) == FALSE)
+            return S_FALSE;
+    }
+
+    // Ignore PrivateScope methods.
+    if (IsMdPrivateScope(m_LiteWeightStgdb.m_MiniMd.getFlagsOfMethod(pMethodRec)))
+        return S_FALSE;
+
+    return S_OK;
+}
+
+//*****************************************************************************
+// Return the MethodDef hash, building it on first use for a large table.
+// Returns NULL if the table is small or the hash could not be built.
+//*****************************************************************************
+CMemberDefHash *MDInternalRO::GetMethodDefHash()
+{
+    HRESULT hr = S_OK;
+
+    if (m_pMethodDefHash != NULL)
+        return m_pMethodDefHash;
+
+    ULONG cMethods = m_LiteWeightStgdb.m_MiniMd.getCountMethods();
+    if (cMethods < LOOKUP_HASH_ROW_COUNT_THRESHOLD)
+        return NULL;
+
+    NewHolder<CMemberDefHash> pHash = new (nothrow) CMemberDefHash();
+    IfNullGo(pHash);
+    IfFailGo(pHash->NewInit((cMethods / REHASH_THREADSHOLD) | 1));
+
+    for (RID iType = 1; iType <= m_LiteWeightStgdb.m_MiniMd.getCountTypeDefs(); iType++)
+    {
+        TypeDefRec *pTypeDefRec;
+        RID         ridStart;
+        RID         ridEnd;
+
+        IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(iType, &pTypeDefRec));
+        ridStart = m_LiteWeightStgdb.m_MiniMd.getMethodListOfTypeDef(pTypeDefRec);
+        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getEndMethodListOfTypeDef(iType, &ridEnd));
+
+        for (; ridStart < ridEnd; ridStart++)
+        {
+            MethodRec  *pMethodRec;
+            LPCUTF8     szName;
+
+            IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetMethodRecord(ridStart, &pMethodRec));
+            IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNameOfMethod(pMethodRec, &szName));
+
+            MEMBERDEFHASHENTRY *pEntry = pHash->Add(HashMethodDef(TokenFromRid(iType, mdtTypeDef), szName));
+            IfNullGo(pEntry);
+            pEntry->tok = TokenFromRid(ridStart, mdtMethodDef);
+            pEntry->tkParent = TokenFromRid(iType, mdtTypeDef);
+        }
+    }
+
+    if (InterlockedCompareExchangeT<CMemberDefHash *>(&m_pMethodDefHash, pHash, NULL) == NULL)
+    {   // We won the initialization race
+        InterlockedExchangeAdd(&m_cbLookupHashes, (LONG)pHash->GetAllocatedSize());
+        pHash.SuppressRelease();
+    }
+
+ErrExit:
+    // A metadata error is reported by the linear search instead
+    return m_pMethodDefHash;
+}
+
 //*****************************************************************************
 // Find a given param of a Method.
 //*****************************************************************************
@@ -1725,12 +1849,9 @@ MDInternalRO::FindTypeDef(
     if (szTypeDefNamespace == NULL)
         szTypeDefNamespace = "";
 
-    // Do a linear search
     ULONG        cTypeDefRecs = m_LiteWeightStgdb.m_MiniMd.getCountTypeDefs();
-    TypeDefRec * pTypeDefRec;
     LPCUTF8      szName;
     LPCUTF8      szNamespace;
-    DWORD        dwFlags;
 
     // Get TypeDef of the tkEnclosingClass passed in
     if (TypeFromToken(tkEnclosingClass) == mdtTypeRef)
@@ -1752,55 +1873,158 @@ MDInternalRO::FindTypeDef(
         _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
     }
 
-    // Search for the TypeDef
-    for (ULONG i = 1; i <= cTypeDefRecs; i++)
+    // Use the hash for a large table, keeping the first match in table order like the linear search
+    if (CMetaDataHashBase *pHash = GetTypeDefHash())
     {
-        IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(i, &pTypeDefRec));
+        ULONG   iHash = HashTypeDef(szTypeDefNamespace, szTypeDefName);
+        RID     ridFound = 0;
+        int     pos;
 
-        dwFlags = m_LiteWeightStgdb.m_MiniMd.getFlagsOfTypeDef(pTypeDefRec);
-
-        if (!IsTdNested(dwFlags) && !IsNilToken(tkEnclosingClass))
+        for (TOKENHASHENTRY *pEntry = pHash->FindFirst(iHash, pos);
+             pEntry != NULL;
+             pEntry = pHash->FindNext(pos))
         {
-            // If the class is not Nested and EnclosingClass passed in is not nil
-            continue;
+            if (pEntry->ulHash != iHash)
+                continue;
+
+            RID rid = RidFromToken(pEntry->tok);
+            if ((ridFound != 0) && (rid > ridFound))
+                continue;
+
+            IfFailRet(CompareTypeDef(rid, szTypeDefNamespace, szTypeDefName, tkEnclosingClass));
+            if (hr == S_OK)
+                ridFound = rid;
         }
-        else if (IsTdNested(dwFlags) && IsNilToken(tkEnclosingClass))
+
+        if (ridFound != 0)
         {
-            // If the class is nested and EnclosingClass passed is nil
-            continue;
+            *ptkTypeDef = TokenFromRid(ridFound, mdtTypeDef);
+            return S_OK;
         }
-        else if (!IsNilToken(tkEnclosingClass))
-        {
-            _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
 
-            RID              iNestedClassRec;
-            NestedClassRec * pNestedClassRec;
-            mdTypeDef        tkEnclosingClassTmp;
-
-            IfFailRet(m_LiteWeightStgdb.m_MiniMd.FindNestedClassFor(i, &iNestedClassRec));
-            if (InvalidRid(iNestedClassRec))
-                continue;
-            IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetNestedClassRecord(iNestedClassRec, &pNestedClassRec));
-            tkEnclosingClassTmp = m_LiteWeightStgdb.m_MiniMd.getEnclosingClassOfNestedClass(pNestedClassRec);
-            if (tkEnclosingClass != tkEnclosingClassTmp)
-                continue;
-        }
+        // Cannot find the TypeDef by name
+        return CLDB_E_RECORD_NOTFOUND;
+    }
 
-        IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
-        if (strcmp(szTypeDefName, szName) == 0)
+    // Do a linear search for the TypeDef
+    for (ULONG i = 1; i <= cTypeDefRecs; i++)
+    {
+        IfFailRet(CompareTypeDef(i, szTypeDefNamespace, szTypeDefName, tkEnclosingClass));
+        if (hr == S_OK)
         {
-            IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
-            if (strcmp(szTypeDefNamespace, szNamespace) == 0)
-            {
-                *ptkTypeDef = TokenFromRid(i, mdtTypeDef);
-                return S_OK;
-            }
+            *ptkTypeDef = TokenFromRid(i, mdtTypeDef);
+            return S_OK;
         }
     }
     // Cannot find the TypeDef by name
     return CLDB_E_RECORD_NOTFOUND;
 } // MDInternalRO::FindTypeDef
 
+//*****************************************************************************
+// Check whether a TypeDef has the given namespace, name and enclosing class.
+//*****************************************************************************
+__checkReturn
+HRESULT
+MDInternalRO::CompareTypeDef(           // S_OK match, S_FALSE no match.
+    RID         rid,                    // [IN] TypeDef to check.
+    LPCSTR      szTypeDefNamespace,     // [IN] Namespace for the TypeDef.
+    LPCSTR      szTypeDefName,          // [IN] Name of the TypeDef.
+    mdToken     tkEnclosingClass)       // [IN] TypeDef of enclosing class, or nil.
+{
+    HRESULT      hr;
+    TypeDefRec * pTypeDefRec;
+    LPCUTF8      szName;
+    LPCUTF8      szNamespace;
+    DWORD        dwFlags;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(rid, &pTypeDefRec));
+
+    dwFlags = m_LiteWeightStgdb.m_MiniMd.getFlagsOfTypeDef(pTypeDefRec);
+
+    if (!IsTdNested(dwFlags) && !IsNilToken(tkEnclosingClass))
+    {
+        // If the class is not Nested and EnclosingClass passed in is not nil
+        return S_FALSE;
+    }
+    else if (IsTdNested(dwFlags) && IsNilToken(tkEnclosingClass))
+    {
+        // If the class is nested and EnclosingClass passed is nil
+        return S_FALSE;
+    }
+    else if (!IsNilToken(tkEnclosingClass))
+    {
+        _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
+
+        RID              iNestedClassRec;
+        NestedClassRec * pNestedClassRec;
+        mdTypeDef        tkEnclosingClassTmp;
+
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.FindNestedClassFor(rid, &iNestedClassRec));
+        if (InvalidRid(iNestedClassRec))
+            return S_FALSE;
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetNestedClassRecord(iNestedClassRec, &pNestedClassRec));
+        tkEnclosingClassTmp = m_LiteWeightStgdb.m_MiniMd.getEnclosingClassOfNestedClass(pNestedClassRec);
+        if (tkEnclosingClass != tkEnclosingClassTmp)
+            return S_FALSE;
+    }
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
+    if (strcmp(szTypeDefName, szName) != 0)
+        return S_FALSE;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
+    if (strcmp(szTypeDefNamespace, szNamespace) != 0)
+        return S_FALSE;
+
+    return S_OK;
+} // MDInternalRO::CompareTypeDef
+
+//*****************************************************************************
+// Return the TypeDef hash, building it on first use for a large table.
+// Returns NULL if the table is small or the hash could not be built.
+//*****************************************************************************
+CMetaDataHashBase *MDInternalRO::GetTypeDefHash()
+{
+    HRESULT hr = S_OK;
+
+    if (m_pTypeDefHash != NULL)
+        return m_pTypeDefHash;
+
+    ULONG cTypeDefs = m_LiteWeightStgdb.m_MiniMd.getCountTypeDefs();
+    if (cTypeDefs < LOOKUP_HASH_ROW_COUNT_THRESHOLD)
+        return NULL;
+
+    NewHolder<CMetaDataHashBase> pHash = new (nothrow) CMetaDataHashBase();
+    IfNullGo(pHash);
+    IfFailGo(pHash->NewInit((cTypeDefs / REHASH_THREADSHOLD) | 1));
+
+    for (RID i = 1; i <= cTypeDefs; i++)
+    {
+        TypeDefRec *pTypeDefRec;
+        LPCUTF8     szName;
+        LPCUTF8     szNamespace;
+
+        IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(i, &pTypeDefRec));
+        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
+        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
+
+        TOKENHASHENTRY *pEntry = pHash->Add(HashTypeDef(szNamespace, szName));
+        IfNullGo(pEntry);
+        pEntry->tok = TokenFromRid(i, mdtTypeDef);
+    }
+
+    if (InterlockedCompareExchangeT<CMetaDataHashBase *>(&m_pTypeDefHash, pHash, NULL) == NULL)
+    {   // We won the initialization race
+        InterlockedExchangeAdd(&m_cbLookupHashes, (LONG)pHash->GetAllocatedSize());
+        pHash.SuppressRelease();
+    }
+
+ErrExit:
+    // A metadata error is reported by the linear search instead
+    return m_pTypeDefHash;
+} // MDInternalRO::GetTypeDefHash
+
+
 //*****************************************************************************
 // Given a memberref, return a pointer to memberref's name and signature
 //*****************************************************************************
@@ -12,6 +12,7 @@
 #define __MDInternalRO__h__
 
 #include "metamodel.h"
+#include "metadatahash.h"
 
 #ifdef FEATURE_METADATA_INTERNAL_APIS
 
@@ -754,6 +755,40 @@ private:
     };
     CMethodSemanticsMap *m_pMethodSemanticsMap; // Possible array of method semantics pointers, ordered by method token.
 
+    // Lazily built for large tables so that lookups by name don't scan the whole table.
+    CMetaDataHashBase   *m_pTypeDefHash;        // TypeDefs by namespace and name.
+    CMemberDefHash      *m_pMethodDefHash;      // MethodDefs by parent and name.
+    LONG                m_cbLookupHashes;       // Bytes allocated for the two hashes above.
+
+    CMetaDataHashBase *GetTypeDefHash();
+    CMemberDefHash *GetMethodDefHash();
+
+    static ULONG HashTypeDef(LPCUTF8 szNamespace, LPCUTF8 szName)
+    {
+        return HashStringA(szNamespace) * 31 + HashStringA(szName);
+    }
+
+    static ULONG HashMethodDef(mdTypeDef tkParent, LPCUTF8 szName)
+    {
+        return HashBytes((const BYTE *) &tkParent, sizeof(mdToken)) + HashStringA(szName);
+    }
+
+    __checkReturn
+    HRESULT CompareTypeDef(             // S_OK match, S_FALSE no match.
+        RID         rid,                // [IN] TypeDef to check.
+        LPCSTR      szTypeDefNamespace, // [IN] Namespace for the TypeDef.
+        LPCSTR      szTypeDefName,      // [IN] Name of the TypeDef.
+        mdToken     tkEnclosingClass);  // [IN] TypeDef of enclosing class, or nil.
+
+    __checkReturn
+    HRESULT CompareMethodDef(           // S_OK match, S_FALSE no match.
+        RID         rid,                // [IN] MethodDef to check.
+        LPCSTR      szName,             // [IN] Name of the member in utf8.
+        PCCOR_SIGNATURE pvSigBlob,      // [IN] Fixed part of the signature, or NULL.
+        ULONG       cbSigBlob,          // [IN] count of bytes in the signature blob
+        PSIGCOMPARE SigCompare,         // [IN] Signature comparison routine
+        void*       pSigArgs);          // [IN] Additional arguments passed to signature compare
+
 #ifndef DACCESS_COMPILE
     class CMethodSemanticsMapSorter : public CQuickSort<CMethodSemanticsMap>
     {
@@ -778,6 +813,12 @@ private:
     LONG                m_cRefs;            // Ref count.
 
 public:
+    // Bytes allocated for the lookup hashes, for memory accounting.
+    ULONG GetLookupHashesSize()
+    {
+        return (ULONG)m_cbLookupHashes;
+    }
+
     STDMETHODIMP_(DWORD) GetMetadataStreamVersion()
     {
         return (DWORD)m_LiteWeightStgdb.m_MiniMd.m_Schema.m_minor |
@@ -236,3 +236,12 @@ bool VMToOSInterface::ReleaseRWMapping(void* pStart, size_t size)
 {
     return munmap(pStart, size) != -1;
 }
+
+bool VMToOSInterface::AdviseLargePages(void* pStart, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+    return madvise(pStart, size, MADV_HUGEPAGE) == 0;
+#else
+    return false;
+#endif
+}
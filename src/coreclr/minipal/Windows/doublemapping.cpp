@@ -210,3 +210,10 @@ bool VMToOSInterface::ReleaseRWMapping(void* pStart, size_t size)
 {
     return UnmapViewOfFile(pStart);
 }
+
+bool VMToOSInterface::AdviseLargePages(void* pStart, size_t size)
+{
+    // Large pages on Windows must be requested when the memory is committed (MEM_LARGE_PAGES),
+    // which does not fit the reserve / commit on demand scheme used for executable memory
+    return false;
+}
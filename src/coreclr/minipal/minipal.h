@@ -75,4 +75,12 @@ public:
     // Return:
     //  true if it succeeded, false if it failed
     static bool ReleaseRWMapping(void* pStart, size_t size);
+
+    // Hint the OS to back the specified range of virtual memory by large pages
+    // Parameters:
+    //  pStart       - Start address of the virtual address range.
+    //  size         - Size of the range.
+    // Return:
+    //  true if the hint was accepted, false if it failed or is not supported
+    static bool AdviseLargePages(void* pStart, size_t size);
 };
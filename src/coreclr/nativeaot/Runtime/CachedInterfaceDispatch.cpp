@@ -56,6 +56,10 @@ extern "C"
     uint32_t CID_g_cInterfaceDispatches = 0;
     uint32_t CID_g_cbMemoryAllocated = 0;
     uint32_t CID_g_rgAllocatesBySize[CID_MAX_CACHE_SIZE_LOG2 + 1] = { 0 };
+    uint32_t CID_g_cOverflowCacheHits = 0;
+    uint32_t CID_g_cOverflowCacheInserts = 0;
+    uint32_t CID_g_cOverflowCacheFull = 0;
+    uint32_t CID_g_cOverflowCacheFlushes = 0;
 };
 
 #define CID_COUNTER_INC(_counter_name) CID_g_c##_counter_name++
@@ -181,13 +185,19 @@ static InterfaceDispatchCache * UpdateCellStubAndCache(InterfaceDispatchCell * p
 //
 // We can't re-use discarded cache blocks immediately since there may be code that is still using them.
 // Instead we link them into a global list and then at the next GC (when no code can hold a reference to these
-// any more) we can place them on one of several free lists based on their size.
+// any more) we can place them on one of several free lists based on their size. In other words each GC
+// suspension ends a reclamation epoch: blocks discarded during an epoch are recycled at the GC that ends it.
+//
+// None of this requires a lock. The cache update path below runs in cooperative mode and so can never span a
+// GC, while the only pushes onto the free lists (and pops off the discarded list) happen during a GC. Outside
+// of a GC the free lists are therefore only ever popped and the discarded list only ever pushed, which makes
+// plain compare-exchange loops on the list heads safe from ABA problems.
 //
 
 #ifndef INTERFACE_DISPATCH_CACHE_HAS_CELL_BACKPOINTER
 
 // Head of the list of discarded cache blocks that can't be re-used just yet.
-InterfaceDispatchCache * g_pDiscardedCacheList; // m_pCell is not used and we can link the discarded blocks themselves
+InterfaceDispatchCache * volatile g_pDiscardedCacheList; // m_pCell is not used and we can link the discarded blocks themselves
 
 #else // INTERFACE_DISPATCH_CACHE_HAS_CELL_BACKPOINTER
 
@@ -198,20 +208,54 @@ struct DiscardedCacheBlock
 };
 
 // Head of the list of discarded cache blocks that can't be re-used just yet.
-static DiscardedCacheBlock * g_pDiscardedCacheList = NULL;
+static DiscardedCacheBlock * volatile g_pDiscardedCacheList = NULL;
 
 // Free list of DiscardedCacheBlock items
-static DiscardedCacheBlock * g_pDiscardedCacheFree = NULL;
+static DiscardedCacheBlock * volatile g_pDiscardedCacheFree = NULL;
 
 #endif // INTERFACE_DISPATCH_CACHE_HAS_CELL_BACKPOINTER
 
 // Free lists for each cache size up to the maximum. We allocate from these in preference to new memory.
-static InterfaceDispatchCache * g_rgFreeLists[CID_MAX_CACHE_SIZE_LOG2 + 1];
+static InterfaceDispatchCache * volatile g_rgFreeLists[CID_MAX_CACHE_SIZE_LOG2 + 1];
 
-// Lock protecting both g_pDiscardedCacheList and g_rgFreeLists. We don't use the OS SLIST support here since
-// it imposes too much space overhead on list entries on 64-bit (each is actually 16 bytes).
+// Lock protecting the overflow cache free list and the per-cell overflow statistics. The cache free lists and
+// the discarded list are lock-free (see above). We don't use the OS SLIST support for those since it imposes
+// too much space overhead on list entries on 64-bit (each is actually 16 bytes).
 static CrstStatic g_sListLock;
 
+// Pops the head of a list that, outside of a GC, is only ever popped. See the comment on cache allocation
+// above for why this is safe without a lock.
+template <typename T>
+static T * PopListHeadOutsideOfGC(T * volatile * ppHead, T * T::* pNextField)
+{
+    T * pHead = *ppHead;
+    while (pHead != NULL)
+    {
+        // If another thread popped pHead first the value read for its next pointer may be stale, but then the
+        // compare-exchange below fails and we retry with the new head.
+        T * pPrevHead = (T *)PalInterlockedCompareExchangePointer((void * volatile *)ppHead, pHead->*pNextField, pHead);
+        if (pPrevHead == pHead)
+            break;
+
+        pHead = pPrevHead;
+    }
+
+    return pHead;
+}
+
+// Pushes an item onto a list that, outside of a GC, is only ever pushed.
+template <typename T>
+static void PushListHeadOutsideOfGC(T * volatile * ppHead, T * T::* pNextField, T * pItem)
+{
+    T * pHead;
+    do
+    {
+        pHead = *ppHead;
+        pItem->*pNextField = pHead;
+    }
+    while (PalInterlockedCompareExchangePointer((void * volatile *)ppHead, pItem, pHead) != pHead);
+}
+
 // The base memory allocator.
 static AllocHeap * g_pAllocHeap = NULL;
 
@@ -284,16 +328,10 @@ static uintptr_t AllocateCache(uint32_t cCacheEntries, InterfaceDispatchCache *
     uint32_t idxCacheSize = CacheSizeToIndex(cCacheEntries);
 
     // Attempt to allocate the head of the free list of the correct cache size.
-    if (g_rgFreeLists[idxCacheSize] != NULL)
+    pCache = PopListHeadOutsideOfGC(&g_rgFreeLists[idxCacheSize], &InterfaceDispatchCache::m_pNextFree);
+    if (pCache != NULL)
     {
-        CrstHolder lh(&g_sListLock);
-
-        pCache = g_rgFreeLists[idxCacheSize];
-        if (pCache != NULL)
-        {
-            g_rgFreeLists[idxCacheSize] = pCache->m_pNextFree;
-            CID_COUNTER_INC(CacheReallocates);
-        }
+        CID_COUNTER_INC(CacheReallocates);
     }
 
     if (pCache == NULL)
@@ -346,13 +384,10 @@ static void DiscardCache(InterfaceDispatchCache * pCache)
 {
     CID_COUNTER_INC(CacheDiscards);
 
-    CrstHolder lh(&g_sListLock);
-
 #ifndef INTERFACE_DISPATCH_CACHE_HAS_CELL_BACKPOINTER
 
     // we can thread the list through the blocks directly
-    pCache->m_pNextFree = g_pDiscardedCacheList;
-    g_pDiscardedCacheList = pCache;
+    PushListHeadOutsideOfGC(&g_pDiscardedCacheList, &InterfaceDispatchCache::m_pNextFree, pCache);
 
 #else // INTERFACE_DISPATCH_CACHE_HAS_CELL_BACKPOINTER
 
@@ -361,22 +396,198 @@ static void DiscardCache(InterfaceDispatchCache * pCache)
     // pointer to the dispatch cell.
 
     // instead, allocate an auxiliary node (with its own auxiliary free list)
-    DiscardedCacheBlock * pDiscardedCacheBlock = g_pDiscardedCacheFree;
-    if (pDiscardedCacheBlock != NULL)
-        g_pDiscardedCacheFree = pDiscardedCacheBlock->m_pNext;
-    else
+    DiscardedCacheBlock * pDiscardedCacheBlock = PopListHeadOutsideOfGC(&g_pDiscardedCacheFree, &DiscardedCacheBlock::m_pNext);
+    if (pDiscardedCacheBlock == NULL)
         pDiscardedCacheBlock = (DiscardedCacheBlock *)g_pAllocHeap->Alloc(sizeof(DiscardedCacheBlock));
 
     if (pDiscardedCacheBlock != NULL) // if we did NOT get the memory, we leak the discarded block
     {
-        pDiscardedCacheBlock->m_pNext = g_pDiscardedCacheList;
         pDiscardedCacheBlock->m_pCache = pCache;
-
-        g_pDiscardedCacheList = pDiscardedCacheBlock;
+        PushListHeadOutsideOfGC(&g_pDiscardedCacheList, &DiscardedCacheBlock::m_pNext, pDiscardedCacheBlock);
     }
 #endif // INTERFACE_DISPATCH_CACHE_HAS_CELL_BACKPOINTER
 }
 
+//
+// Megamorphic overflow cache.
+//
+// Once a cell's cache has grown to CID_MAX_CACHE_SIZE entries further mappings can't be added to it, so without
+// anything else every additional instance type seen at that call site would go through full resolution on each
+// call. Instead such mappings are stored in a single global hashed table shared by all overflowing cells and keyed
+// by the (cell, instance type) pair. The stubs still only search the per-cell cache; RhpSearchDispatchCellCache
+// consults the overflow table on the slow path before the caller falls back to full resolution.
+//
+// Slots hold pointers to immutable entries and outside of a GC are only ever transitioned from NULL to non-NULL,
+// so lookups need no synchronization and a probe sequence can stop at the first empty slot. When the table gets
+// close to full (or a probe sequence is exhausted) it is flushed at the next GC, when no thread can be reading it,
+// and its entries are recycled.
+//
+
+#define CID_OVERFLOW_CACHE_SIZE_LOG2  12
+#define CID_OVERFLOW_CACHE_SIZE       (1 << CID_OVERFLOW_CACHE_SIZE_LOG2)
+#define CID_OVERFLOW_CACHE_MAX_PROBES 8
+
+struct InterfaceDispatchOverflowEntry
+{
+    InterfaceDispatchCell *             m_pCell;
+    MethodTable *                       m_pInstanceType;
+    PCODE                               m_pTargetCode;
+    InterfaceDispatchOverflowEntry *    m_pNextFree;    // next in free list
+};
+
+static InterfaceDispatchOverflowEntry * volatile g_rgOverflowCache[CID_OVERFLOW_CACHE_SIZE];
+
+// Number of occupied slots in g_rgOverflowCache and whether the table should be flushed at the next GC.
+static int32_t volatile g_cOverflowCacheEntries = 0;
+static bool volatile g_fOverflowCacheFlushRequested = false;
+
+// Free list of overflow entries, protected by g_sListLock.
+static InterfaceDispatchOverflowEntry * g_pOverflowEntryFreeList = NULL;
+
+// Per-cell overflow diagnostics. Records the cells that ran out of room in their own cache along with the number of
+// mappings each of them has pushed into the overflow cache, so megamorphic call sites can be identified from a
+// debugger or a dump. Protected by g_sListLock.
+#define CID_OVERFLOW_CELL_STATS_SIZE 64
+
+struct InterfaceDispatchOverflowCellStats
+{
+    InterfaceDispatchCell * m_pCell;
+    uint32_t                m_cOverflows;
+};
+
+extern "C"
+{
+    InterfaceDispatchOverflowCellStats CID_g_rgOverflowCellStats[CID_OVERFLOW_CELL_STATS_SIZE] = { };
+    uint32_t CID_g_cOverflowCells = 0;          // number of distinct cells that overflowed (may exceed the table size)
+};
+
+static void RecordCellOverflow(InterfaceDispatchCell * pCell)
+{
+    CrstHolder lh(&g_sListLock);
+
+    for (uint32_t i = 0; i < CID_OVERFLOW_CELL_STATS_SIZE; i++)
+    {
+        InterfaceDispatchOverflowCellStats * pStats = &CID_g_rgOverflowCellStats[i];
+        if (pStats->m_pCell == pCell)
+        {
+            pStats->m_cOverflows++;
+            return;
+        }
+
+        if (pStats->m_pCell == NULL)
+        {
+            pStats->m_pCell = pCell;
+            pStats->m_cOverflows = 1;
+            CID_g_cOverflowCells++;
+            return;
+        }
+    }
+
+    // The table is full; only keep track of how many cells we could not record.
+    CID_g_cOverflowCells++;
+}
+
+static uint32_t OverflowCacheHash(InterfaceDispatchCell * pCell, MethodTable * pInstanceType)
+{
+    uintptr_t key = (((uintptr_t)pCell >> 3) * 2654435761u) ^ ((uintptr_t)pInstanceType >> 3);
+#if defined(HOST_64BIT)
+    key ^= key >> 32;
+#endif
+    uint32_t hash = (uint32_t)key;
+    hash ^= hash >> 15;
+    return hash & (CID_OVERFLOW_CACHE_SIZE - 1);
+}
+
+static PCODE LookupOverflowCache(InterfaceDispatchCell * pCell, MethodTable * pInstanceType)
+{
+    uint32_t idx = OverflowCacheHash(pCell, pInstanceType);
+    for (uint32_t i = 0; i < CID_OVERFLOW_CACHE_MAX_PROBES; i++, idx = (idx + 1) & (CID_OVERFLOW_CACHE_SIZE - 1))
+    {
+        InterfaceDispatchOverflowEntry * pEntry = g_rgOverflowCache[idx];
+        if (pEntry == NULL)
+            break;
+
+        if (pEntry->m_pCell == pCell && pEntry->m_pInstanceType == pInstanceType)
+        {
+            CID_COUNTER_INC(OverflowCacheHits);
+            return pEntry->m_pTargetCode;
+        }
+    }
+
+    return (PCODE)nullptr;
+}
+
+static void FreeOverflowEntry(InterfaceDispatchOverflowEntry * pEntry)
+{
+    CrstHolder lh(&g_sListLock);
+
+    pEntry->m_pNextFree = g_pOverflowEntryFreeList;
+    g_pOverflowEntryFreeList = pEntry;
+}
+
+static void AddOverflowCacheEntry(InterfaceDispatchCell * pCell, MethodTable * pInstanceType, PCODE pTargetCode)
+{
+    if (g_fOverflowCacheFlushRequested)
+        return;
+
+    InterfaceDispatchOverflowEntry * pEntry = NULL;
+    if (g_pOverflowEntryFreeList != NULL)
+    {
+        CrstHolder lh(&g_sListLock);
+
+        pEntry = g_pOverflowEntryFreeList;
+        if (pEntry != NULL)
+            g_pOverflowEntryFreeList = pEntry->m_pNextFree;
+    }
+
+    if (pEntry == NULL)
+    {
+        pEntry = (InterfaceDispatchOverflowEntry *)g_pAllocHeap->Alloc(sizeof(InterfaceDispatchOverflowEntry));
+        if (pEntry == NULL)
+        {
+            CID_COUNTER_INC(CacheOutOfMemory);
+            return;
+        }
+    }
+
+    pEntry->m_pCell = pCell;
+    pEntry->m_pInstanceType = pInstanceType;
+    pEntry->m_pTargetCode = pTargetCode;
+    pEntry->m_pNextFree = NULL;
+
+    uint32_t idx = OverflowCacheHash(pCell, pInstanceType);
+    for (uint32_t i = 0; i < CID_OVERFLOW_CACHE_MAX_PROBES; i++, idx = (idx + 1) & (CID_OVERFLOW_CACHE_SIZE - 1))
+    {
+        InterfaceDispatchOverflowEntry * pExisting = g_rgOverflowCache[idx];
+        if (pExisting == NULL)
+        {
+            // The interlocked operation also orders the initialization of the entry before its publication.
+            pExisting = (InterfaceDispatchOverflowEntry *)PalInterlockedCompareExchangePointer(
+                (void * volatile *)&g_rgOverflowCache[idx], pEntry, NULL);
+            if (pExisting == NULL)
+            {
+                CID_COUNTER_INC(OverflowCacheInserts);
+                if (PalInterlockedIncrement(&g_cOverflowCacheEntries) >= (CID_OVERFLOW_CACHE_SIZE / 4) * 3)
+                    g_fOverflowCacheFlushRequested = true;
+                return;
+            }
+        }
+
+        if (pExisting->m_pCell == pCell && pExisting->m_pInstanceType == pInstanceType)
+        {
+            // Another thread added the same mapping first.
+            FreeOverflowEntry(pEntry);
+            return;
+        }
+    }
+
+    // Every slot in the probe sequence is taken. Drop this mapping and start over with an empty table at the
+    // next GC.
+    CID_COUNTER_INC(OverflowCacheFull);
+    g_fOverflowCacheFlushRequested = true;
+    FreeOverflowEntry(pEntry);
+}
+
 // Called during a GC to empty the list of discarded caches (which we can now guarantee aren't being accessed)
 // and sort the results into the free lists we maintain for each cache size.
 void ReclaimUnusedInterfaceDispatchCaches()
@@ -428,6 +639,25 @@ void ReclaimUnusedInterfaceDispatchCaches()
 
     // We processed all the discarded entries, so we can simply NULL the list head.
     g_pDiscardedCacheList = NULL;
+
+    // Flush the overflow cache if it got too full. No thread can be in the middle of a lookup at this point.
+    if (g_fOverflowCacheFlushRequested)
+    {
+        for (uint32_t i = 0; i < CID_OVERFLOW_CACHE_SIZE; i++)
+        {
+            InterfaceDispatchOverflowEntry * pEntry = g_rgOverflowCache[i];
+            if (pEntry != NULL)
+            {
+                pEntry->m_pNextFree = g_pOverflowEntryFreeList;
+                g_pOverflowEntryFreeList = pEntry;
+                g_rgOverflowCache[i] = NULL;
+            }
+        }
+
+        CID_COUNTER_INC(OverflowCacheFlushes);
+        g_cOverflowCacheEntries = 0;
+        g_fOverflowCacheFlushRequested = false;
+    }
 }
 
 // One time initialization of interface dispatch.
@@ -473,12 +703,12 @@ FCIMPL4(PCODE, RhpUpdateDispatchCellCache, InterfaceDispatchCell * pCell, PCODE
 
     if (cOldCacheEntries == CID_MAX_CACHE_SIZE)
     {
-        // We already reached the maximum cache size we wish to allocate. For now don't attempt to cache
-        // the mapping we just did: there's no safe way to update the existing cache right now if it
-        // doesn't have an empty entries. There are schemes that would let us do this at the next GC point
-        // but it's not clear whether we should do this or re-tune the cache max size, we need to measure
-        // this.
+        // We already reached the maximum cache size we wish to allocate and there's no safe way to update
+        // the existing cache right now if it doesn't have an empty entry. Record the mapping in the shared
+        // overflow cache instead so that RhpSearchDispatchCellCache can find it without a full resolution.
         CID_COUNTER_INC(CacheSizeOverflows);
+        RecordCellOverflow(pCell);
+        AddOverflowCacheEntry(pCell, pInstanceType, pTargetCode);
         return (PCODE)pTargetCode;
     }
 
@@ -527,6 +757,10 @@ FCIMPL2(PCODE, RhpSearchDispatchCellCache, InterfaceDispatchCell * pCell, Method
         for (uint32_t i = 0; i < pCache->m_cEntries; i++, pCacheEntry++)
             if (pCacheEntry->m_pInstanceType == pInstanceType)
                 return pCacheEntry->m_pTargetCode;
+
+        // Only cells whose cache is already at the maximum size have mappings in the overflow cache.
+        if (pCache->m_cEntries == CID_MAX_CACHE_SIZE)
+            return LookupOverflowCache(pCell, pInstanceType);
     }
 
     return (PCODE)nullptr;
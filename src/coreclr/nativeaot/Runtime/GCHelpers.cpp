@@ -536,6 +536,12 @@ static Object* GcAllocInternal(MethodTable* pEEType, uint32_t uFlags, uintptr_t
             return NULL;
     }
 
+    // Threads that keep coming back here for a new allocation context get bigger ones.
+    if (!(uFlags & GC_ALLOC_USER_OLD_HEAP))
+    {
+        uFlags |= pThread->RecordAllocContextRefill();
+    }
+
     // Save the MethodTable for instrumentation purposes.
     tls_pLastAllocationEEType = pEEType;
 
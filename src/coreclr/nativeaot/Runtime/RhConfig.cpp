@@ -11,6 +11,15 @@
 
 #include <string.h>
 
+#ifndef TARGET_WINDOWS
+#ifdef __APPLE__
+#include <crt_externs.h>
+#define environ (*_NSGetEnviron())
+#else
+extern char** environ;
+#endif
+#endif // !TARGET_WINDOWS
+
 #define DOTNET_PREFIX _T("DOTNET_")
 #define DOTNET_PREFIX_LEN STRING_LENGTH(DOTNET_PREFIX)
 
@@ -31,6 +40,43 @@ namespace
         strcpy(buffer + DOTNET_PREFIX_LEN, name);
     #endif
     }
+
+#ifndef TARGET_WINDOWS
+    // Probing for a variable that isn't set walks the whole environment, and the GC alone asks for around a
+    // hundred settings during startup. Scan the environment once instead and skip the probes entirely when no
+    // DOTNET_ variable is set, which is the common case for deployed binaries. Managed code doesn't modify the
+    // native environment on Unix, so the answer can't change under us.
+    bool HasDotnetEnvironmentVariables()
+    {
+        static int s_hasDotnetVariables = -1;
+
+        int hasDotnetVariables = s_hasDotnetVariables;
+        if (hasDotnetVariables < 0)
+        {
+            hasDotnetVariables = 0;
+            for (char** ppVariable = environ; (ppVariable != NULL) && (*ppVariable != NULL); ppVariable++)
+            {
+                if (strncmp(*ppVariable, DOTNET_PREFIX, DOTNET_PREFIX_LEN) == 0)
+                {
+                    hasDotnetVariables = 1;
+                    break;
+                }
+            }
+
+            s_hasDotnetVariables = hasDotnetVariables;
+        }
+
+        return hasDotnetVariables != 0;
+    }
+#endif // !TARGET_WINDOWS
+
+    char* CopyConfigString(const char* value)
+    {
+        char* copy = new (nothrow) char[strlen(value) + 1];
+        if (copy != NULL)
+            strcpy(copy, value);
+        return copy;
+    }
 }
 
 bool RhConfig::Environment::TryGetBooleanValue(const char* name, bool* value)
@@ -45,6 +91,11 @@ bool RhConfig::Environment::TryGetBooleanValue(const char* name, bool* value)
 
 bool RhConfig::Environment::TryGetIntegerValue(const char* name, uint64_t* value, bool decimal)
 {
+#ifndef TARGET_WINDOWS
+    if (!HasDotnetEnvironmentVariables())
+        return false;
+#endif
+
     TCHAR variableName[64];
     GetEnvironmentConfigName(name, variableName, ARRAY_SIZE(variableName));
 
@@ -90,6 +141,11 @@ bool RhConfig::Environment::TryGetIntegerValue(const char* name, uint64_t* value
 
 bool RhConfig::Environment::TryGetStringValue(const char* name, char** value)
 {
+#ifndef TARGET_WINDOWS
+    if (!HasDotnetEnvironmentVariables())
+        return false;
+#endif
+
     TCHAR variableName[64];
     GetEnvironmentConfigName(name, variableName, ARRAY_SIZE(variableName));
 
@@ -139,18 +195,47 @@ bool RhConfig::ReadConfigValue(_In_z_ const char *name, uint64_t* pValue, bool d
     return false;
 }
 
+bool RhConfig::ReadConfigStringValue(_In_z_ const char *name, char** pValue)
+{
+    if (Environment::TryGetStringValue(name, pValue))
+        return true;
+
+    // Check the embedded configuration
+    const char *embeddedValue = nullptr;
+    if (GetEmbeddedVariable(&g_compilerEmbeddedSettingsBlob, name, true, &embeddedValue))
+    {
+        *pValue = CopyConfigString(embeddedValue);
+        return *pValue != NULL;
+    }
+
+    return false;
+}
+
 bool RhConfig::ReadKnobUInt64Value(_In_z_ const char *name, uint64_t* pValue)
 {
     const char *embeddedValue = nullptr;
     if (GetEmbeddedVariable(&g_compilerEmbeddedKnobsBlob, name, false, &embeddedValue))
     {
-        *pValue = strtoull(embeddedValue, NULL, 10);
+        // Like runtimeconfig.json knobs in CoreCLR, accept decimal as well as 0x-prefixed hex values
+        *pValue = strtoull(embeddedValue, NULL, 0);
         return true;
     }
 
     return false;
 }
 
+bool RhConfig::ReadKnobStringValue(_In_z_ const char *name, char** pValue)
+{
+    const char *embeddedValue = nullptr;
+    if (GetEmbeddedVariable(&g_compilerEmbeddedKnobsBlob, name, false, &embeddedValue))
+    {
+        *pValue = CopyConfigString(embeddedValue);
+        return *pValue != NULL;
+    }
+
+    return false;
+}
+
 bool RhConfig::ReadKnobBooleanValue(_In_z_ const char *name, bool* pValue)
 {
     const char *embeddedValue = nullptr;
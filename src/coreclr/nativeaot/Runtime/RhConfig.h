@@ -48,6 +48,10 @@ public:
     bool ReadKnobUInt64Value(_In_z_ const char* wszName, uint64_t* pValue);
     bool ReadKnobBooleanValue(_In_z_ const char* wszName, bool* pValue);
 
+    // On success, the caller owns the returned string value and must free it with delete[].
+    bool ReadConfigStringValue(_In_z_ const char* wszName, char** pValue);
+    bool ReadKnobStringValue(_In_z_ const char* wszName, char** pValue);
+
     char** GetKnobNames();
     char** GetKnobValues();
     uint32_t GetKnobCount();
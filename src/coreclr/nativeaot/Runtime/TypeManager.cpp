@@ -17,6 +17,8 @@
 #include "thread.h"
 #include "event.h"
 #include "threadstore.h"
+#include "MethodTable.h"
+#include "ObjectLayout.h"
 #include "TypeManager.h"
 
 /* static */
@@ -37,18 +39,47 @@ TypeManager * TypeManager::Create(HANDLE osModule, void * pModuleHeader, void**
         (pReadyToRunHeader->MinorVersion != ReadyToRunHeaderConstants::CurrentMinorVersion))
         return nullptr;
 
-    return new (nothrow) TypeManager(osModule, pReadyToRunHeader, pClasslibFunctions, nClasslibFunctions);
+    TypeManager * pTypeManager = new (nothrow) TypeManager(osModule, pReadyToRunHeader, pClasslibFunctions, nClasslibFunctions);
+    if (pTypeManager == nullptr)
+        return nullptr;
+
+    // The statics of the module may point into the preinitialized heap, so the module can't be used
+    // unless the GC knows about it.
+    if (!pTypeManager->RegisterPreinitializedHeap())
+    {
+        delete pTypeManager;
+        return nullptr;
+    }
+
+    return pTypeManager;
 }
 
 TypeManager::TypeManager(HANDLE osModule, ReadyToRunHeader * pHeader, void** pClasslibFunctions, uint32_t nClasslibFunctions)
     : m_osModule(osModule), m_pHeader(pHeader),
-      m_pClasslibFunctions(pClasslibFunctions), m_nClasslibFunctions(nClasslibFunctions)
+      m_pClasslibFunctions(pClasslibFunctions), m_nClasslibFunctions(nClasslibFunctions),
+      m_hPreinitializedHeapSegment(nullptr)
 {
     int length;
     m_pStaticsGCDataSection = (uint8_t*)GetModuleSection(ReadyToRunSectionType::GCStaticRegion, &length);
     m_pThreadStaticsDataSection = (uint8_t*)GetModuleSection(ReadyToRunSectionType::ThreadStaticRegion, &length);
 }
 
+EXTERN_C void* QCALLTYPE RhRegisterFrozenSegment(void* pSection, size_t allocSize, size_t commitSize, size_t reservedSize);
+
+// The preinitialized heap is a snapshot of objects taken after running a startup phase at build time. It is
+// part of the image's data section, so mapping the image maps the heap; all that is left to do at runtime is
+// to tell the GC about it. The section starts with an ObjHeader like a frozen object region does.
+bool TypeManager::RegisterPreinitializedHeap()
+{
+    int length;
+    void * pSection = GetModuleSection(ReadyToRunSectionType::PreinitializedHeapRegion, &length);
+    if (pSection == nullptr || (size_t)length <= sizeof(ObjHeader))
+        return true;
+
+    m_hPreinitializedHeapSegment = RhRegisterFrozenSegment(pSection, (size_t)length, (size_t)length, (size_t)length);
+    return m_hPreinitializedHeapSegment != nullptr;
+}
+
 void * TypeManager::GetModuleSection(ReadyToRunSectionType sectionId, int * length)
 {
     ModuleInfoRow * pModuleInfoRows = (ModuleInfoRow *)(m_pHeader + 1);
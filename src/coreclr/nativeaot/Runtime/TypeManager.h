@@ -13,9 +13,12 @@ class TypeManager
     uint8_t*                    m_pThreadStaticsDataSection;
     void**                      m_pClasslibFunctions;
     uint32_t                    m_nClasslibFunctions;
+    void*                       m_hPreinitializedHeapSegment;
 
     TypeManager(HANDLE osModule, ReadyToRunHeader * pHeader, void** pClasslibFunctions, uint32_t nClasslibFunctions);
 
+    bool RegisterPreinitializedHeap();
+
 public:
     static TypeManager * Create(HANDLE osModule, void * pModuleHeader, void** pClasslibFunctions, uint32_t nClasslibFunctions);
     void * GetModuleSection(ReadyToRunSectionType sectionId, int * length);
@@ -122,6 +122,52 @@ endif
     cmp     REFREG, [g_ephemeral_high]
     jae     &BASENAME&_NoBarrierRequired_&REFREG&
 
+    ;; With regions the ephemeral range is coarse, so look up the actual generations. Note that rax is not
+    ;; touched here since RhpCheckedLockCmpXchg and RhpCheckedXchg return their result in it.
+    movzx   r9d, byte ptr [g_region_shr]
+    test    r9d, r9d
+    je      &BASENAME&_SkipRegionCheck_&REFREG&
+
+    ;; check if the reference is to gen 2 - then it's not an ephemeral pointer
+    mov     r8, rcx
+    mov     ecx, r9d
+    mov     r10, REFREG
+    shr     r10, cl
+    add     r10, [g_region_to_generation_table]
+    cmp     byte ptr [r10], 82h
+    je      &BASENAME&_NoBarrierRequired_&REFREG&
+
+    ;; check if the destination happens to be in gen 0
+    mov     r10, r8
+    shr     r10, cl
+    add     r10, [g_region_to_generation_table]
+    mov     rcx, r8
+    cmp     byte ptr [r10], 0
+    je      &BASENAME&_NoBarrierRequired_&REFREG&
+
+&BASENAME&_SkipRegionCheck_&REFREG&:
+    cmp     byte ptr [g_region_use_bitwise_write_barrier], 0
+    je      &BASENAME&_CheckCardTableByte_&REFREG&
+
+    ;; The GC asked for precise card marking, so set just the bit for the 256 byte chunk being written.
+    ;; Other threads may be setting neighboring bits of the same byte, hence the interlocked update.
+    mov     r8, rcx
+    shr     rcx, 8
+    and     ecx, 7
+    mov     r11d, 1
+    shl     r11d, cl
+
+    mov     rcx, r8
+    shr     rcx, 0Bh
+    mov     r10, [g_card_table]
+    test    byte ptr [rcx + r10], r11b
+    jne     &BASENAME&_NoBarrierRequired_&REFREG&
+
+    lock or byte ptr [rcx + r10], r11b
+    jmp     &BASENAME&_CheckCardBundle_&REFREG&
+
+&BASENAME&_CheckCardTableByte_&REFREG&:
+
     ;; We have a location on the GC heap being updated with a reference to an ephemeral object so we must
     ;; track this write. The location address is translated into an offset in the card table bitmap. We set
     ;; an entire byte in the card table since it's quicker than messing around with bitmasks and we only write
@@ -134,6 +180,8 @@ endif
     ;; We get here if it's necessary to update the card table.
     mov     byte ptr [rcx + r10], 0FFh
 
+&BASENAME&_CheckCardBundle_&REFREG&:
+
 ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
     ;; Shift rcx by 0Ah more to get the card bundle byte (we shifted by 0x0B already)
     shr     rcx, 0Ah
@@ -311,6 +359,49 @@ RhpByRefAssignRef_CheckCardTable:
     cmp     rcx, [g_ephemeral_high]
     jae     RhpByRefAssignRef_NoBarrierRequired
 
+    ;; With regions the ephemeral range is coarse, so look up the actual generations.
+    mov     rax, rcx
+    mov     cl, [g_region_shr]
+    test    cl, cl
+    je      RhpByRefAssignRef_SkipRegionCheck
+
+    ;; check if the reference is to gen 2 - then it's not an ephemeral pointer
+    shr     rax, cl
+    add     rax, [g_region_to_generation_table]
+    cmp     byte ptr [rax], 82h
+    je      RhpByRefAssignRef_NoBarrierRequired
+
+    ;; check if the destination happens to be in gen 0
+    mov     rax, rdi
+    shr     rax, cl
+    add     rax, [g_region_to_generation_table]
+    cmp     byte ptr [rax], 0
+    je      RhpByRefAssignRef_NoBarrierRequired
+
+RhpByRefAssignRef_SkipRegionCheck:
+    cmp     byte ptr [g_region_use_bitwise_write_barrier], 0
+    je      RhpByRefAssignRef_CheckCardTableByte
+
+    ;; The GC asked for precise card marking, so set just the bit for the 256 byte chunk being written.
+    mov     rcx, rdi
+    mov     al, 1
+    shr     rcx, 8
+    and     cl, 7
+    shl     al, cl
+
+    mov     rcx, rdi
+    shr     rcx, 0Bh
+    add     rcx, [g_card_table]
+    test    byte ptr [rcx], al
+    jne     RhpByRefAssignRef_NoBarrierRequired
+
+    lock or byte ptr [rcx], al
+
+    ;; rebase rcx to the card index so that the card bundle update below works for both paths
+    sub     rcx, [g_card_table]
+    jmp     RhpByRefAssignRef_CheckCardBundle
+
+RhpByRefAssignRef_CheckCardTableByte:
     ;; move current rdi value into rcx, we need to keep rdi and eventually increment by 8
     mov     rcx, rdi
 
@@ -326,6 +417,8 @@ RhpByRefAssignRef_CheckCardTable:
 ;; We get here if it's necessary to update the card table.
     mov     byte ptr [rcx + rax], 0FFh
 
+RhpByRefAssignRef_CheckCardBundle:
+
 ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
     ;; Shift rcx by 0Ah more to get the card bundle byte (we shifted by 0Bh already)
     shr     rcx, 0Ah
@@ -202,6 +202,17 @@ ds_rt_generate_core_dump (
     return result;
 }
 
+static
+inline
+ds_ipc_result_t
+ds_rt_generate_heap_snapshot (
+    DiagnosticsGenerateHeapSnapshotCommandPayload *payload,
+    DiagnosticsHeapSnapshotWriter *writer)
+{
+    // TODO: Implement.
+    return DS_IPC_E_NOTSUPPORTED;
+}
+
 /*
  * DiagnosticsIpc.
  */
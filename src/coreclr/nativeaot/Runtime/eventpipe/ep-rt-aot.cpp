@@ -23,6 +23,7 @@
 #include "thread.h"
 #include "threadstore.h"
 #include "threadstore.inl"
+#include "thread.inl"
 #include "eventtrace_context.h"
 
 // Uses _rt_aot_lock_internal_t that has CrstStatic as a field
@@ -39,14 +40,73 @@ uint32_t *_ep_rt_aot_proc_group_offsets;
  * Forward declares of all static functions.
  */
 
+static
+void
+walk_managed_stack_for_threads (
+    ep_rt_thread_handle_t sampling_thread,
+    EventPipeEvent *sampling_event);
 
 bool
 ep_rt_aot_walk_managed_stack_for_thread (
     ep_rt_thread_handle_t thread,
     EventPipeStackContents *stack_contents)
 {
-    // NativeAOT does not support getting the call stack
-    return false;
+    EP_ASSERT (thread != NULL);
+    EP_ASSERT (stack_contents != NULL);
+
+    // Stacks can only be captured for threads held at a safe point by the current thread,
+    // i.e. while the sample profiler has the runtime suspended.
+    Thread *current_thread = ThreadStore::GetCurrentThreadIfAvailable ();
+    if (current_thread == NULL || current_thread == thread || ThreadStore::GetSuspendingThread () != current_thread)
+        return false;
+
+    // The cost of a sample is bounded by the capacity of the stack buffer.
+    uintptr_t ips [EP_MAX_STACK_DEPTH];
+    uint32_t frame_count = thread->CaptureManagedStackForSample (ips, EP_MAX_STACK_DEPTH);
+    for (uint32_t i = 0; i < frame_count; i++)
+        ep_stack_contents_append (stack_contents, ips [i], NULL);
+
+    return true;
+}
+
+// The thread store lock must already be held and the runtime suspended by the
+// sampling thread before this function is called.
+static
+void
+walk_managed_stack_for_threads (
+    ep_rt_thread_handle_t sampling_thread,
+    EventPipeEvent *sampling_event)
+{
+    EP_ASSERT (sampling_thread != NULL);
+
+    // Only the sampling thread uses this, so a single buffer is reused for every thread and
+    // every sample instead of being set up each time.
+    static EventPipeStackContents stack_contents;
+    EventPipeStackContents *current_stack_contents = ep_stack_contents_init (&stack_contents);
+
+    FOREACH_THREAD (target_thread)
+    {
+        // GC special threads never run managed code.
+        if (target_thread == sampling_thread || target_thread->IsGCSpecial ())
+            continue;
+
+        ep_stack_contents_reset (current_stack_contents);
+
+        if (ep_rt_aot_walk_managed_stack_for_thread (target_thread, current_stack_contents) && !ep_stack_contents_is_empty (current_stack_contents)) {
+            // Threads that had to be brought to a safe point were running managed code. Threads that were
+            // already in preemptive mode are qualified as external, matching CoreCLR.
+            uint32_t payload_data = target_thread->WasSuspendedInCooperativeMode () ? EP_SAMPLE_PROFILER_SAMPLE_TYPE_MANAGED : EP_SAMPLE_PROFILER_SAMPLE_TYPE_EXTERNAL;
+
+            ep_write_sample_profile_event (
+                sampling_thread,
+                sampling_event,
+                target_thread,
+                current_stack_contents,
+                (uint8_t *)&payload_data,
+                sizeof (payload_data));
+        }
+    }
+    END_FOREACH_THREAD
 }
 
 bool
@@ -61,6 +121,23 @@ ep_rt_aot_sample_profiler_write_sampling_event_for_threads (
     ep_rt_thread_handle_t sampling_thread,
     EventPipeEvent *sampling_event)
 {
+    EP_ASSERT (sampling_thread != NULL);
+
+    // Do not pile a sample on top of a GC or another suspension that is already in progress.
+    if (ThreadStore::IsTrapThreadsRequested ())
+        return;
+
+    // Threads are brought to safe points through the regular suspension mechanism (hijacking and,
+    // where supported, signal/APC based redirection), so their stacks can be walked without any
+    // async-signal-safe unwinding on the target threads themselves.
+    ThreadStore *thread_store = GetThreadStore ();
+    thread_store->LockThreadStore ();
+    thread_store->SuspendAllThreads (/* waitForGCEvent = */ false);
+
+    walk_managed_stack_for_threads (sampling_thread, sampling_event);
+
+    thread_store->ResumeAllThreads (/* waitForGCEvent = */ false);
+    thread_store->UnlockThreadStore ();
 }
 
 const ep_char8_t *
@@ -495,6 +495,34 @@ ep_rt_config_value_get_enable_stackwalk (void)
     return false;
 }
 
+static
+inline
+uint32_t
+ep_rt_config_value_get_sample_interval_us (void)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    uint64_t value;
+    if (RhConfig::Environment::TryGetIntegerValue("EventPipeSampleIntervalMicroseconds", &value, true))
+    {
+        EP_ASSERT(value <= UINT32_MAX);
+        return static_cast<uint32_t>(value);
+    }
+
+    return 0;
+}
+
+static
+inline
+bool
+ep_rt_config_value_get_sample_cpu_time_only (void)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    // Not supported, all threads are sampled.
+    return false;
+}
+
 /*
  * EventPipeSampleProfiler.
  */
@@ -512,6 +540,16 @@ ep_rt_sample_profiler_write_sampling_event_for_threads (
     ep_rt_aot_sample_profiler_write_sampling_event_for_threads (sampling_thread, sampling_event);
 }
 
+static
+inline
+void
+ep_rt_sample_profiler_stopped (void)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    // Hardware counters are not supported, nothing is kept per sampled thread.
+}
+
 static
 inline
 void
@@ -687,7 +725,10 @@ ep_rt_is_running (void)
 static
 inline
 void
-ep_rt_execute_rundown (dn_vector_ptr_t *execution_checkpoints)
+ep_rt_execute_rundown (
+    dn_vector_ptr_t *execution_checkpoints,
+    const uintptr_t *method_ips,
+    uint32_t method_ips_len)
 {
     STATIC_CONTRACT_NOTHROW;
 
@@ -95,6 +95,10 @@ void GCToEEInterface::GcScanRoots(ScanFunc* fn, int condemned, int max_gen, Scan
 {
     // STRESS_LOG1(LF_GCROOTS, LL_INFO10, "GCScan: Phase = %s\n", sc->promotion ? "promote" : "relocate");
 
+    // Time the stack walks so that slow suspensions with many threads can be diagnosed from the stress log.
+    uint64_t startTicks = PalQueryPerformanceCounter();
+    uint32_t cThreadsScanned = 0;
+
     FOREACH_THREAD(pThread)
     {
         // Skip "GC Special" threads which are really background workers that will never have any roots.
@@ -120,6 +124,7 @@ void GCToEEInterface::GcScanRoots(ScanFunc* fn, int condemned, int max_gen, Scan
             sc->dwEtwRootKind = kEtwGCRootKindStack;
 #endif
             pThread->GcScanRoots(fn, sc);
+            cThreadsScanned++;
 
 #if defined(FEATURE_EVENT_TRACE) && !defined(DACCESS_COMPILE)
             sc->dwEtwRootKind = kEtwGCRootKindOther;
@@ -130,6 +135,10 @@ void GCToEEInterface::GcScanRoots(ScanFunc* fn, int condemned, int max_gen, Scan
     END_FOREACH_THREAD
 
     sc->thread_under_crawl = NULL;
+
+    uint64_t elapsedMicroseconds = (PalQueryPerformanceCounter() - startTicks) * 1000000 / PalQueryPerformanceFrequency();
+    STRESS_LOG4(LF_GC | LF_GCROOTS, LL_INFO10, "GcScanRoots: heap %d %s scan of %u thread stacks took %u us\n",
+        sc->thread_number, sc->promotion ? "promote" : "relocate", cThreadsScanned, (uint32_t)elapsedMicroseconds);
 }
 
 void GCToEEInterface::GcEnumAllocContexts(enum_alloc_context_func* fn, void* param)
@@ -348,7 +357,9 @@ void GCToEEInterface::DiagWalkBGCSurvivors(void* gcContext)
 void GCToEEInterface::StompWriteBarrier(WriteBarrierParameters* args)
 {
     // NativeAOT doesn't patch the write barrier like CoreCLR does, but it
-    // still needs to record the changes in the GC heap.
+    // still needs to record the changes in the GC heap. The barriers pick
+    // the region-aware and bitwise card marking paths based on the region
+    // globals recorded here rather than being swapped out.
 
     bool is_runtime_suspended = args->is_runtime_suspended;
 
@@ -415,6 +426,9 @@ void GCToEEInterface::StompWriteBarrier(WriteBarrierParameters* args)
         assert(args->ephemeral_high != nullptr);
         g_ephemeral_low = args->ephemeral_low;
         g_ephemeral_high = args->ephemeral_high;
+        g_region_to_generation_table = args->region_to_generation_table;
+        g_region_shr = args->region_shr;
+        g_region_use_bitwise_write_barrier = args->region_use_bitwise_write_barrier;
         return;
     case WriteBarrierOp::Initialize:
         // This operation should only be invoked once, upon initialization.
@@ -444,6 +458,9 @@ void GCToEEInterface::StompWriteBarrier(WriteBarrierParameters* args)
         g_highest_address = args->highest_address;
         g_ephemeral_low = args->ephemeral_low;
         g_ephemeral_high = args->ephemeral_high;
+        g_region_to_generation_table = args->region_to_generation_table;
+        g_region_shr = args->region_shr;
+        g_region_use_bitwise_write_barrier = args->region_use_bitwise_write_barrier;
         return;
     case WriteBarrierOp::SwitchToWriteWatch:
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
@@ -596,13 +613,12 @@ bool GCToEEInterface::CreateThread(void (*threadStart)(void*), void* arg, bool i
         {
             ThreadStubArguments* pStartContext = (ThreadStubArguments*)argument;
 
-            // Initialize the Thread for this thread. The false being passed indicates that the thread store lock
-            // should not be acquired as part of this operation. This is necessary because this thread is created in
-            // the context of a garbage collection and the lock is already held by the GC.
+            // Initialize the Thread for this thread. This thread is created in the context of a garbage collection
+            // and the thread store lock is already held by the GC, which is fine since attaching does not take it.
             // This also implies that creation and initialization must proceed sequentially, one thread after another.
             // GCToEEInterface::CreateThread will not return until the thread is done attaching itself.
             ASSERT(GCHeapUtilities::IsGCInProgress());
-            ThreadStore::AttachCurrentThread(false);
+            ThreadStore::AttachCurrentThread();
 
             ThreadStore::RawGetCurrentThread()->SetGCSpecial();
 
@@ -766,9 +782,23 @@ void GCToEEInterface::LogErrorToHost(const char *message)
 
 bool GCToEEInterface::GetStringConfigValue(const char* privateKey, const char* publicKey, const char** value)
 {
-    UNREFERENCED_PARAMETER(privateKey);
-    UNREFERENCED_PARAMETER(publicKey);
-    UNREFERENCED_PARAMETER(value);
+    // String settings such as GCHeapAffinitizeRanges come from the environment or the embedded settings
+    // first and from the embedded runtimeconfig knobs second, the same lookup order as the integer settings.
+    char* configValue;
+    if (g_pRhConfig->ReadConfigStringValue(privateKey, &configValue))
+    {
+        *value = configValue;
+        return true;
+    }
+
+    if (publicKey)
+    {
+        if (g_pRhConfig->ReadKnobStringValue(publicKey, &configValue))
+        {
+            *value = configValue;
+            return true;
+        }
+    }
 
     return false;
 }
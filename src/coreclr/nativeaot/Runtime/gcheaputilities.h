@@ -28,6 +28,13 @@ extern "C" uint32_t* g_card_bundle_table;
 extern "C" uint8_t* g_ephemeral_low;
 extern "C" uint8_t* g_ephemeral_high;
 
+// With regions the write barriers use these to skip card marking when the destination is in gen0 or the
+// reference is to gen2, and to mark individual card bits instead of whole bytes when requested by the GC.
+// g_region_shr is zero when the GC is not using the region-aware write barrier.
+extern "C" uint8_t* g_region_to_generation_table;
+extern "C" uint8_t  g_region_shr;
+extern "C" bool g_region_use_bitwise_write_barrier;
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 extern "C" bool g_sw_ww_enabled_for_gc_heap;
 extern "C" uint8_t* g_write_watch_table;
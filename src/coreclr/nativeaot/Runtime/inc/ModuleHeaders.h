@@ -53,6 +53,8 @@ enum class ReadyToRunSectionType
     // 210 is unused - it was used by ThreadStaticIndex
     // 211 is unused - it was used by LoopHijackFlag
     ImportAddressTables         = 212,
+    PreinitializedHeapRegion    = 213, // Snapshot of objects captured from a startup phase, laid out like
+                                       // FrozenObjectRegion and registered as a frozen segment at module load
 
     // Sections 300 - 399 are reserved for RhFindBlob backwards compatibility
     ReadonlyBlobRegionStart     = 300,
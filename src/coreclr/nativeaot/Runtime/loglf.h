@@ -10,6 +10,7 @@ DEFINE_LOG_FACILITY(LF_GCALLOC      ,0x00000004)
 DEFINE_LOG_FACILITY(LF_GCROOTS      ,0x00000008)
 DEFINE_LOG_FACILITY(LF_STARTUP      ,0x00000010)  // Log startup and shutdown failures
 DEFINE_LOG_FACILITY(LF_STACKWALK    ,0x00000020)
+DEFINE_LOG_FACILITY(LF_SYNC         ,0x00000040)  // Thread store attach/detach
 //                  LF_ALWAYS        0x80000000   // make certain you don't try to use this bit for a real facility
 //                  LF_ALL           0xFFFFFFFF
 //
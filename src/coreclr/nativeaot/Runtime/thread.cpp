@@ -114,7 +114,13 @@ bool Thread::CacheTransitionFrameForSuspend()
     // Make sure compiler emits only one read.
     PInvokeTransitionFrame* temp = VolatileLoadWithoutBarrier(&m_pTransitionFrame);
     if (temp == NULL)
+    {
+        // Remember that the thread was running managed code for the sample profiler.
+        if (!IsStateSet(TSF_SuspendedInCoopMode))
+            SetState(TSF_SuspendedInCoopMode);
+
         return false;
+    }
 
     m_pCachedTransitionFrame = temp;
     return true;
@@ -123,6 +129,9 @@ bool Thread::CacheTransitionFrameForSuspend()
 void Thread::ResetCachedTransitionFrame()
 {
     m_pCachedTransitionFrame = NULL;
+
+    if (IsStateSet(TSF_SuspendedInCoopMode))
+        ClearState(TSF_SuspendedInCoopMode);
 }
 
 // This function simulates a PInvoke transition using a frame pointer from somewhere further up the stack that
@@ -328,11 +337,72 @@ bool Thread::IsGCSpecial()
     return IsStateSet(TSF_IsGcSpecialThread);
 }
 
+bool Thread::WasSuspendedInCooperativeMode()
+{
+    ASSERT(ThreadStore::GetCurrentThread() == ThreadStore::GetSuspendingThread());
+    return IsStateSet(TSF_SuspendedInCoopMode);
+}
+
+// Records the IPs of up to maxFrames managed frames of this thread into a caller provided buffer,
+// innermost first, and returns the number of frames recorded. The thread must be held at a safe
+// point by the calling thread, so the walk only reads the target's stack and never blocks or allocates.
+uint32_t Thread::CaptureManagedStackForSample(uintptr_t* pIPs, uint32_t maxFrames)
+{
+    ASSERT(this != ThreadStore::GetCurrentThread());
+    ASSERT(ThreadStore::GetCurrentThread() == ThreadStore::GetSuspendingThread());
+
+    // The stack walk cannot start from a hijacked return address. If the thread still needs
+    // to be hijacked, the next suspension will do so.
+    CrossThreadUnhijack();
+
+    uint32_t cFrames = 0;
+    StackFrameIterator frameIterator(this, GetTransitionFrame());
+    while (frameIterator.IsValid() && (cFrames < maxFrames))
+    {
+        pIPs[cFrames++] = (uintptr_t)frameIterator.GetRegisterSet()->IP;
+        frameIterator.Next();
+    }
+
+    return cFrames;
+}
+
 uint64_t Thread::GetPalThreadIdForLogging()
 {
     return m_threadId;
 }
 
+// Number of regular-quantum-sized refills of the allocation context between two GCs past which a thread is
+// handed larger allocation contexts. Refills done with a large quantum count GC_LARGE_ALLOC_QUANTUM_SCALE
+// units so that the decision does not flip back and forth once the thread switches to larger contexts.
+static const uint32_t AllocContextRefillUnitsForLargeQuantum = 64;
+
+uint32_t Thread::RecordAllocContextRefill()
+{
+    size_t gcIndex = GCHeapUtilities::GetGCHeap()->GetGcCount();
+    if (gcIndex != m_allocQuantumGcIndex)
+    {
+        // A GC ended the previous window, go back to the regular quantum if the thread slowed down.
+        if (m_fLargeAllocQuantum && (m_allocContextRefillUnits < AllocContextRefillUnitsForLargeQuantum))
+        {
+            m_fLargeAllocQuantum = false;
+            FireEtwAllocationContextQuantumChange(m_threadId, 1, m_allocContextRefillUnits, GetClrInstanceId());
+        }
+
+        m_allocQuantumGcIndex = gcIndex;
+        m_allocContextRefillUnits = 0;
+    }
+
+    m_allocContextRefillUnits += m_fLargeAllocQuantum ? GC_LARGE_ALLOC_QUANTUM_SCALE : 1;
+
+    if (!m_fLargeAllocQuantum && (m_allocContextRefillUnits >= AllocContextRefillUnitsForLargeQuantum))
+    {
+        m_fLargeAllocQuantum = true;
+        FireEtwAllocationContextQuantumChange(m_threadId, GC_LARGE_ALLOC_QUANTUM_SCALE, m_allocContextRefillUnits, GetClrInstanceId());
+    }
+
+    return m_fLargeAllocQuantum ? GC_ALLOC_LARGE_QUANTUM : GC_ALLOC_NO_FLAGS;
+}
+
 uint64_t Thread::s_DeadThreadsNonAllocBytes = 0;
 
 /* static*/
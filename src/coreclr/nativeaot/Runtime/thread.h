@@ -118,6 +118,9 @@ struct RuntimeThreadLocals
 #ifdef FEATURE_GC_STRESS
     uint32_t                m_uRand;                                // current per-thread random number
 #endif // FEATURE_GC_STRESS
+    size_t                  m_allocQuantumGcIndex;                  // GC count at the start of the current refill window
+    uint32_t                m_allocContextRefillUnits;              // regular-quantum-sized refills in the current window
+    bool                    m_fLargeAllocQuantum;                   // see Thread::RecordAllocContextRefill
 };
 
 struct ReversePInvokeFrame
@@ -161,6 +164,9 @@ public:
                                                     //
                                                     // On Unix this is an optimization to not queue up more signals when one is
                                                     // still being processed.
+
+        TSF_SuspendedInCoopMode = 0x00000200,       // Set by suspension when the thread was found running in cooperative mode
+                                                    // and had to be brought to a safe point. Cleared when the runtime resumes.
     };
 private:
 
@@ -217,6 +223,10 @@ public:
 
     gc_alloc_context *  GetAllocContext();
 
+    // Returns the GC_ALLOC_LARGE_QUANTUM hint if this thread refills its allocation context often enough
+    // between GCs to benefit from larger contexts.
+    uint32_t            RecordAllocContextRefill();
+
     uint64_t            GetPalThreadIdForLogging();
 
     void                GcScanRoots(ScanFunc* pfnEnumCallback, ScanContext * pvCallbackData);
@@ -292,6 +302,12 @@ public:
     void SetGCSpecial();
     bool IsGCSpecial();
 
+    //
+    // Sampling support - only valid while the runtime is suspended by the calling thread
+    //
+    bool WasSuspendedInCooperativeMode();
+    uint32_t CaptureManagedStackForSample(uintptr_t* pIPs, uint32_t maxFrames);
+
     //
     // Managed/unmanaged interop transitions support APIs
     //
@@ -69,7 +69,8 @@ PTR_Thread ThreadStore::GetSuspendingThread()
 
 ThreadStore::ThreadStore() :
     m_ThreadList(),
-    m_Lock(CrstThreadStore)
+    m_Lock(CrstThreadStore),
+    m_pPendingThreads(NULL)
 {
     SaveCurrentThreadOffsetForDAC();
 }
@@ -103,7 +104,7 @@ void ThreadStore::Destroy()
 }
 
 // static
-void ThreadStore::AttachCurrentThread(bool fAcquireThreadStoreLock)
+void ThreadStore::AttachCurrentThread()
 {
     //
     // step 1: ThreadStore::InitCurrentThread
@@ -129,25 +130,53 @@ void ThreadStore::AttachCurrentThread(bool fAcquireThreadStoreLock)
     pAttachingThread->Construct();
     ASSERT(pAttachingThread->m_ThreadStateFlags == Thread::TSF_Unknown);
 
-    // fAcquireThreadStoreLock is false when threads are created/attached for GC purpose
-    // in such case the lock is already held and GC takes care to ensure safe access to the threadstore
-
-    ThreadStore* pTS = GetThreadStore();
-    CrstHolderWithState threadStoreLock(&pTS->m_Lock, fAcquireThreadStoreLock);
+    uint64_t startTicks = PalQueryPerformanceCounter();
 
     //
     // Set thread state to be attached
     //
-    ASSERT(pAttachingThread->m_ThreadStateFlags == Thread::TSF_Unknown);
     pAttachingThread->m_ThreadStateFlags = Thread::TSF_Attached;
 
-    pTS->m_ThreadList.PushHead(pAttachingThread);
+    // Publish the thread on the pending list instead of taking the threadstore lock. The lock is held by
+    // the suspending thread for the entire duration of a GC, so taking it here would stall every thread
+    // that starts up while a GC is in progress. Whoever holds the lock next moves the thread to the main
+    // list, and SuspendAllThreads does so after setting RhpTrapThreads.
+    //
+    // This is safe because the thread is attached in preemptive mode and has no managed frames yet.
+    // The interlocked push below is a full barrier, which pairs with the write buffer flush done by
+    // SuspendAllThreads: either the suspending thread sees this thread when it merges the pending list,
+    // or this thread sees RhpTrapThreads set when it first switches to cooperative mode and waits for
+    // the GC to complete.
+    ThreadStore* pTS = GetThreadStore();
+    while (true)
+    {
+        Thread * pHead = pTS->m_pPendingThreads;
+        pAttachingThread->m_pNext = pHead;
+        if (PalInterlockedCompareExchangePointer((void * volatile *)&pTS->m_pPendingThreads, pAttachingThread, pHead) == pHead)
+            break;
+    }
+
+    uint64_t elapsedMicroseconds = (PalQueryPerformanceCounter() - startTicks) * 1000000 / PalQueryPerformanceFrequency();
+    STRESS_LOG2(LF_SYNC, LL_INFO100, "AttachCurrentThread: thread %p attached in %u us\n",
+        pAttachingThread, (uint32_t)elapsedMicroseconds);
 }
 
-// static
-void ThreadStore::AttachCurrentThread()
+// Moves the threads that attached without taking the lock to the main thread list.
+// Must be called with the threadstore lock held.
+void ThreadStore::MergePendingThreads()
 {
-    AttachCurrentThread(true);
+    ASSERT(m_Lock.OwnedByCurrentThread());
+
+    if (m_pPendingThreads == NULL)
+        return;
+
+    Thread * pThread = (Thread *)PalInterlockedExchangePointer((void * volatile *)&m_pPendingThreads, NULL);
+    while (pThread != NULL)
+    {
+        Thread * pNext = pThread->m_pNext;
+        m_ThreadList.PushHead(pThread);
+        pThread = pNext;
+    }
 }
 
 void ThreadStore::DetachCurrentThread()
@@ -180,12 +209,22 @@ void ThreadStore::DetachCurrentThread()
     ASSERT(!pDetachingThread->IsCurrentThreadInCooperativeMode());
 
     // The following makes the thread no longer able to run managed code or participate in GC.
-    // We need to hold threadstore lock while doing that.
+    // We need to hold threadstore lock while doing that. Unlike attaching, this cannot avoid the lock:
+    // a GC in progress may still be walking this thread and its thread-local storage goes away as soon
+    // as we return, so waiting for the lock is what guarantees no such walk is still running.
     {
+        uint64_t startTicks = PalQueryPerformanceCounter();
+
         ThreadStore* pTS = GetThreadStore();
         // Note that when process is shutting down, the threads may be rudely terminated,
         // possibly while holding the threadstore lock. That is ok, since the process is being torn down.
         CrstHolder threadStoreLock(&pTS->m_Lock);
+
+        uint64_t elapsedMicroseconds = (PalQueryPerformanceCounter() - startTicks) * 1000000 / PalQueryPerformanceFrequency();
+        STRESS_LOG2(LF_SYNC, LL_INFO100, "DetachCurrentThread: thread %p waited %u us for the threadstore lock\n",
+            pDetachingThread, (uint32_t)elapsedMicroseconds);
+
+        pTS->MergePendingThreads();
         ASSERT(rh::std::count(pTS->m_ThreadList.Begin(), pTS->m_ThreadList.End(), pDetachingThread) == 1);
         // remove the thread from the list of managed threads.
         pTS->m_ThreadList.RemoveFirst(pDetachingThread);
@@ -213,6 +252,8 @@ void ThreadStore::LockThreadStore()
 
     m_Lock.Enter();
 
+    MergePendingThreads();
+
     if (wasCooperative)
     {
         // we just got the lock thus EE can't be suspending, so no waiting here
@@ -242,6 +283,11 @@ void ThreadStore::SuspendAllThreads(bool waitForGCEvent)
     // reason for this is that we essentially implement Dekker's algorithm, which requires write ordering.
     PalFlushProcessWriteBuffers();
 
+    // Threads that attached before the trap was visible may already be running in cooperative mode,
+    // so they must be on the main list before we start looking for threads to suspend. Threads that
+    // attach from now on will observe the trap before they can run managed code. See AttachCurrentThread.
+    MergePendingThreads();
+
     int prevRemaining = INT32_MAX;
     bool observeOnly = true;
     uint32_t rehijackDelay = 8;
@@ -26,8 +26,15 @@ class ThreadStore
     PTR_RuntimeInstance m_pRuntimeInstance;
     Crst                m_Lock;
 
+    // Threads that attached without taking m_Lock. They are pushed here with interlocked operations and
+    // moved to m_ThreadList by whoever holds m_Lock next (see MergePendingThreads).
+    Thread * volatile   m_pPendingThreads;
+
 private:
     ThreadStore();
+#ifndef DACCESS_COMPILE
+    void                    MergePendingThreads();
+#endif
 
 public:
     void                    LockThreadStore();
@@ -50,7 +57,6 @@ public:
     static Thread *         GetCurrentThreadIfAvailable();
     static PTR_Thread       GetSuspendingThread();
     static void             AttachCurrentThread();
-    static void             AttachCurrentThread(bool fAcquireThreadStoreLock);
     static void             DetachCurrentThread();
 #ifndef DACCESS_COMPILE
     static void             SaveCurrentThreadOffsetForDAC();
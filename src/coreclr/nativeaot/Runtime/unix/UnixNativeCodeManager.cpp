@@ -46,6 +46,103 @@ struct UnixNativeMethodInfo
 // Ensure that UnixNativeMethodInfo fits into the space reserved by MethodInfo
 static_assert(sizeof(UnixNativeMethodInfo) <= sizeof(MethodInfo), "UnixNativeMethodInfo too big");
 
+//
+// Cache of unwind info lookups keyed by code address.
+//
+// Stack walks done while the runtime is suspended keep looking up the same return addresses, and each lookup
+// searches the module's unwind sections. Managed code is never unloaded, so cached results never need to be
+// invalidated and the cache can be shared by all code managers and all suspensions.
+//
+// Entries are published seqlock style: a writer claims an entry by swapping its key to UNWIND_CACHE_KEY_BUSY,
+// fills in the data and then stores the new key with release semantics. A reader validates the key both
+// before and after copying the data out and treats any mismatch as a miss.
+//
+
+#define UNWIND_CACHE_SIZE_LOG2  10
+#define UNWIND_CACHE_SIZE       (1 << UNWIND_CACHE_SIZE_LOG2)
+#define UNWIND_CACHE_KEY_BUSY   ((TADDR)1)
+
+//#define FEATURE_UNWIND_CACHE_STATS 1
+
+#ifdef FEATURE_UNWIND_CACHE_STATS
+extern "C"
+{
+    uint32_t g_cUnwindCacheHits = 0;
+    uint32_t g_cUnwindCacheMisses = 0;
+};
+#define UNWIND_CACHE_COUNTER_INC(_counter_name) g_cUnwindCache##_counter_name++
+#else
+#define UNWIND_CACHE_COUNTER_INC(_counter_name)
+#endif // FEATURE_UNWIND_CACHE_STATS
+
+struct UnwindCacheEntry
+{
+    TADDR       key;
+    unw_word_t  start_ip;
+    unw_word_t  end_ip;
+    unw_word_t  lsda;
+    unw_word_t  unwind_info;
+    uint32_t    format;
+};
+
+static UnwindCacheEntry s_unwindCache[UNWIND_CACHE_SIZE];
+
+static UnwindCacheEntry * GetUnwindCacheEntry(TADDR controlPC)
+{
+    // Instructions are at least 2 byte aligned on all the platforms we support
+    TADDR hash = (controlPC >> 1) ^ (controlPC >> (1 + UNWIND_CACHE_SIZE_LOG2));
+    return &s_unwindCache[hash & (UNWIND_CACHE_SIZE - 1)];
+}
+
+static bool LookupUnwindCache(TADDR controlPC, unw_proc_info_t * pProcInfo)
+{
+    UnwindCacheEntry * pEntry = GetUnwindCacheEntry(controlPC);
+
+    if (__atomic_load_n(&pEntry->key, __ATOMIC_ACQUIRE) != controlPC)
+    {
+        UNWIND_CACHE_COUNTER_INC(Misses);
+        return false;
+    }
+
+    pProcInfo->start_ip = pEntry->start_ip;
+    pProcInfo->end_ip = pEntry->end_ip;
+    pProcInfo->lsda = pEntry->lsda;
+    pProcInfo->unwind_info = pEntry->unwind_info;
+    pProcInfo->format = pEntry->format;
+
+    // Make sure the copy above is complete before checking that no writer took over the entry meanwhile
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&pEntry->key, __ATOMIC_RELAXED) != controlPC)
+    {
+        UNWIND_CACHE_COUNTER_INC(Misses);
+        return false;
+    }
+
+    UNWIND_CACHE_COUNTER_INC(Hits);
+    return true;
+}
+
+static void AddToUnwindCache(TADDR controlPC, const unw_proc_info_t * pProcInfo)
+{
+    UnwindCacheEntry * pEntry = GetUnwindCacheEntry(controlPC);
+
+    // Don't wait for a racing writer, caching is best effort
+    TADDR oldKey = __atomic_load_n(&pEntry->key, __ATOMIC_RELAXED);
+    if (oldKey == UNWIND_CACHE_KEY_BUSY ||
+        !__atomic_compare_exchange_n(&pEntry->key, &oldKey, UNWIND_CACHE_KEY_BUSY, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+    {
+        return;
+    }
+
+    pEntry->start_ip = pProcInfo->start_ip;
+    pEntry->end_ip = pProcInfo->end_ip;
+    pEntry->lsda = pProcInfo->lsda;
+    pEntry->unwind_info = pProcInfo->unwind_info;
+    pEntry->format = pProcInfo->format;
+
+    __atomic_store_n(&pEntry->key, controlPC, __ATOMIC_RELEASE);
+}
+
 UnixNativeCodeManager::UnixNativeCodeManager(TADDR moduleBase,
                                              PTR_VOID pvManagedCodeStartRange, uint32_t cbManagedCodeRange,
                                              PTR_PTR_VOID pClasslibFunctions, uint32_t nClasslibFunctions)
@@ -87,9 +184,14 @@ bool UnixNativeCodeManager::FindMethodInfo(PTR_VOID        ControlPC,
 
     unw_proc_info_t procInfo;
 
-    if (!UnwindHelpers::GetUnwindProcInfo((TADDR)ControlPC, m_UnwindInfoSections, &procInfo))
+    if (!LookupUnwindCache((TADDR)ControlPC, &procInfo))
     {
-        return false;
+        if (!UnwindHelpers::GetUnwindProcInfo((TADDR)ControlPC, m_UnwindInfoSections, &procInfo))
+        {
+            return false;
+        }
+
+        AddToUnwindCache((TADDR)ControlPC, &procInfo);
     }
 
     assert((procInfo.start_ip <= (TADDR)ControlPC) && ((TADDR)ControlPC < procInfo.end_ip));
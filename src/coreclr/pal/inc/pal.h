@@ -2961,6 +2961,20 @@ VirtualQuery(
          OUT PMEMORY_BASIC_INFORMATION lpBuffer,
          IN SIZE_T dwLength);
 
+typedef struct _WIN32_MEMORY_RANGE_ENTRY {
+    PVOID VirtualAddress;
+    SIZE_T NumberOfBytes;
+} WIN32_MEMORY_RANGE_ENTRY, *PWIN32_MEMORY_RANGE_ENTRY;
+
+PALIMPORT
+BOOL
+PALAPI
+PrefetchVirtualMemory(
+         IN HANDLE hProcess,
+         IN ULONG_PTR NumberOfEntries,
+         IN PWIN32_MEMORY_RANGE_ENTRY VirtualAddresses,
+         IN ULONG Flags);
+
 #define MoveMemory memmove
 #define CopyMemory memcpy
 #define FillMemory(Destination,Length,Fill) memset((Destination),(Fill),(Length))
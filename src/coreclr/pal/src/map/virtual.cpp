@@ -1231,6 +1231,58 @@ ExitVirtualProtect:
     return bRetVal;
 }
 
+/*++
+Function:
+  PrefetchVirtualMemory
+
+  Only the current process is supported. The ranges are passed to the kernel
+  as read-ahead hints, so a failure for one range does not stop the others.
+
+See MSDN doc.
+--*/
+BOOL
+PALAPI
+PrefetchVirtualMemory(
+           IN HANDLE hProcess,
+           IN ULONG_PTR NumberOfEntries,
+           IN PWIN32_MEMORY_RANGE_ENTRY VirtualAddresses,
+           IN ULONG Flags)
+{
+    BOOL bRetVal = TRUE;
+
+    ENTRY("PrefetchVirtualMemory(hProcess=%p, NumberOfEntries=%zu, VirtualAddresses=%p, Flags=%#x)\n",
+          hProcess, (size_t)NumberOfEntries, VirtualAddresses, Flags);
+
+    if (hProcess != GetCurrentProcess() || Flags != 0)
+    {
+        ERROR("Only the current process and no flags are supported\n");
+        SetLastError(ERROR_INVALID_PARAMETER);
+        bRetVal = FALSE;
+        goto ExitPrefetchVirtualMemory;
+    }
+
+    for (ULONG_PTR i = 0; i < NumberOfEntries; i++)
+    {
+        if (VirtualAddresses[i].NumberOfBytes == 0)
+        {
+            continue;
+        }
+
+        UINT_PTR StartBoundary = ALIGN_DOWN((UINT_PTR)VirtualAddresses[i].VirtualAddress, GetVirtualPageSize());
+        SIZE_T MemSize = ALIGN_UP((UINT_PTR)VirtualAddresses[i].VirtualAddress + VirtualAddresses[i].NumberOfBytes, GetVirtualPageSize()) - StartBoundary;
+
+        if (posix_madvise((LPVOID)StartBoundary, MemSize, POSIX_MADV_WILLNEED) != 0)
+        {
+            WARN("posix_madvise(POSIX_MADV_WILLNEED) failed for [%p, %p)\n",
+                 (LPVOID)StartBoundary, (LPVOID)(StartBoundary + MemSize));
+        }
+    }
+
+ExitPrefetchVirtualMemory:
+    LOGEXIT("PrefetchVirtualMemory returning BOOL %d\n", bRetVal);
+    return bRetVal;
+}
+
 #if defined(HOST_OSX) && defined(HOST_ARM64)
 PALAPI VOID PAL_JitWriteProtect(bool writeEnable)
 {
@@ -38,6 +38,10 @@ SET_DEFAULT_DEBUG_CHANNEL(SYNC); // some headers have code with asserts, so do t
 #else
 #include "pal/fakepoll.h"
 #endif // HAVE_POLL
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
 
 #include <algorithm>
 
@@ -451,6 +455,60 @@ namespace CorUnix
         TRACE("ThreadNativeWait(ptnwdNativeWaitData=%p, dwTimeout=%u, ...)\n",
               ptnwdNativeWaitData, dwTimeout);
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        if (dwTimeout != INFINITE)
+        {
+            // FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC timeout
+            iRet = clock_gettime(CLOCK_MONOTONIC, &tsAbsTmo);
+            if (0 != iRet)
+            {
+                ERROR("clock_gettime(CLOCK_MONOTONIC) failed [errno=%d (%s)]\n",
+                      errno, strerror(errno));
+                palErr = ERROR_INTERNAL_ERROR;
+                *ptwrWakeupReason = WaitFailed;
+                goto TNW_exit;
+            }
+
+            tsAbsTmo.tv_sec += dwTimeout / tccSecondsToMillieSeconds;
+            tsAbsTmo.tv_nsec += (dwTimeout % tccSecondsToMillieSeconds) * tccMillieSecondsToNanoSeconds;
+            if (tsAbsTmo.tv_nsec >= tccSecondsToNanoSeconds)
+            {
+                tsAbsTmo.tv_sec += 1;
+                tsAbsTmo.tv_nsec -= tccSecondsToNanoSeconds;
+            }
+        }
+
+        // The predicate is the futex word: the signaling side sets it and wakes us up,
+        // we consume it. As with the condition, a signal that races with a timeout
+        // leaves the predicate set for the 'second native wait' (see BlockThread).
+        while (TRUE != __atomic_exchange_n(&ptnwdNativeWaitData->iPred, FALSE, __ATOMIC_ACQUIRE))
+        {
+            iRet = syscall(SYS_futex,
+                           &ptnwdNativeWaitData->iPred,
+                           FUTEX_WAIT_BITSET_PRIVATE,
+                           FALSE,
+                           (INFINITE == dwTimeout) ? NULL : &tsAbsTmo,
+                           NULL,
+                           FUTEX_BITSET_MATCH_ANY);
+            if (0 != iRet)
+            {
+                if (ETIMEDOUT == errno)
+                {
+                    _ASSERT_MSG(INFINITE != dwTimeout,
+                                "Got ETIMEDOUT despite timeout being INFINITE\n");
+                    iWaitRet = ETIMEDOUT;
+                    break;
+                }
+                else if ((EAGAIN != errno) && (EINTR != errno))
+                {
+                    ERROR("futex wait failed [errno=%d (%s)]\n", errno, strerror(errno));
+                    iWaitRet = errno;
+                    palErr = ERROR_INTERNAL_ERROR;
+                    break;
+                }
+            }
+        }
+#else // SYNCHMGR_FUTEX_NATIVE_WAIT
         if (dwTimeout != INFINITE)
         {
             // Calculate absolute timeout
@@ -532,6 +590,7 @@ namespace CorUnix
         }
 
         _ASSERT_MSG(ETIMEDOUT != iRet || INFINITE != dwTimeout, "Got timeout return code with INFINITE timeout\n");
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
 
         if (0 == iWaitRet)
         {
@@ -2480,6 +2539,27 @@ namespace CorUnix
         PAL_ERROR palErr = NO_ERROR;
         int iRet;
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        // Set the predicate, publishing the wakeup reason and object index
+        // set by the caller, then wake up the target thread
+        __atomic_store_n(&ptnwdNativeWaitData->iPred, TRUE, __ATOMIC_RELEASE);
+
+        iRet = syscall(SYS_futex,
+                       &ptnwdNativeWaitData->iPred,
+                       FUTEX_WAKE_PRIVATE,
+                       1,
+                       NULL,
+                       NULL,
+                       0);
+        if (-1 == iRet)
+        {
+            ERROR("futex wake failed [errno=%d (%s)]\n", errno, strerror(errno));
+            palErr = ERROR_INTERNAL_ERROR;
+        }
+
+        return palErr;
+#else // SYNCHMGR_FUTEX_NATIVE_WAIT
+
         // Lock the mutex
         iRet = pthread_mutex_lock(&ptnwdNativeWaitData->mutex);
         if (0 != iRet)
@@ -2511,6 +2591,7 @@ namespace CorUnix
         }
 
         return palErr;
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
     }
 
     /*++
@@ -40,6 +40,15 @@ Abstract:
 // #define SYNCH_STATISTICS
 #endif
 
+// On Linux, threads block for a wait or a sleep on a futex rather than on their
+// condition/mutex pair, so waking up a thread is a single system call that does
+// not contend for the target thread's mutex with the target thread itself.
+#if defined(__linux__)
+#define SYNCHMGR_FUTEX_NATIVE_WAIT 1
+#else
+#define SYNCHMGR_FUTEX_NATIVE_WAIT 0
+#endif
+
 #ifdef SYNCH_OBJECT_VALIDATION
 #define VALIDATEOBJECT(obj) ((obj)->ValidateObject())
 #else
@@ -7,6 +7,7 @@
 #include <stdint.h>
 #include <math.h>
 #include <algorithm>
+#include <vector>
 
 #ifndef INFINITY
 #define INFINITY 1e300 // Practically good enough - not sure why we miss this in our Linux build.
@@ -332,6 +333,17 @@ int GcLogLevel(uint32_t facility)
     return 0;
 }
 
+// The facility that -i compares with
+static uint32_t FilterFacility(uint32_t facility)
+{
+    if ((facility & (LF_ALWAYS | 0xfffe | LF_GC)) == (LF_ALWAYS | LF_GC))
+    {
+        // specially encoded GC message including dprintf level
+        return LF_GC;
+    }
+    return facility;
+}
+
 static void RememberThreadForHeap(uint64_t threadId, int64_t heapNumber, GcThreadKind threadKind)
 {
     if (s_maxHeapNumberSeen == -1 && heapNumber == 0)
@@ -369,20 +381,9 @@ bool FilterMessage(StressLog::StressLogHeader* hdr, ThreadStressLog* tsl, uint32
         }
     }
 
-    if (s_facilityIgnore != 0)
+    if ((s_facilityIgnore & FilterFacility(facility)) != 0)
     {
-        if ((facility & (LF_ALWAYS | 0xfffe | LF_GC)) == (LF_ALWAYS | LF_GC))
-        {
-            // specially encoded GC message including dprintf level
-            if ((s_facilityIgnore & LF_GC) != 0)
-            {
-                return false;
-            }
-        }
-        else if ((s_facilityIgnore & facility) != 0)
-        {
-            return false;
-        }
+        return false;
     }
 
     InterestingStringId isd = FindStringId(hdr, format);
@@ -533,6 +534,55 @@ bool FilterMessage(StressLog::StressLogHeader* hdr, ThreadStressLog* tsl, uint32
     return fLevelFilter || s_interestingStringFilter[isd];
 }
 
+// Record what a message tells about the GC threads and the GCs, like FilterMessage does, but
+// regardless of the options. The index does this for the whole log, so that the GC thread and
+// GC index filters don't depend on which messages a query happens to read.
+static void NoteGcMessage(ThreadStressLog* tsl, InterestingStringId isd, double deltaTime, void** args)
+{
+    switch (isd)
+    {
+    case    IS_THREAD_WAIT:
+    case    IS_THREAD_WAIT_DONE:
+    case    IS_MARK_START:
+    case    IS_PLAN_START:
+    case    IS_RELOCATE_START:
+    case    IS_RELOCATE_END:
+    case    IS_COMPACT_START:
+    case    IS_COMPACT_END:
+        RememberThreadForHeap(tsl->threadId, (int64_t)args[0], GC_THREAD_FG);
+        break;
+
+    case    IS_DESIRED_NEW_ALLOCATION:
+        // only for gen 0 and 1, because otherwise it may be background GC
+        if ((int)(int64_t)args[1] <= 1)
+        {
+            RememberThreadForHeap(tsl->threadId, (int64_t)args[0], GC_THREAD_FG);
+        }
+        break;
+
+    case    IS_START_BGC_THREAD:
+        RememberThreadForHeap(tsl->threadId, (int64_t)args[0], GC_THREAD_BG);
+        break;
+
+    case    IS_GCSTART:
+    case    IS_GCEND:
+    {
+        int gcIndex = (int)(size_t)args[0];
+        if (gcIndex < MAX_GC_INDEX)
+        {
+            if (isd == IS_GCSTART)
+                s_gcStartEnd[gcIndex].startTime = deltaTime;
+            else
+                s_gcStartEnd[gcIndex].endTime = deltaTime;
+        }
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
 struct StressThreadAndMsg
 {
     uint64_t    threadId;
@@ -564,14 +614,42 @@ int CmpMsg(const void* p1, const void* p2)
     return 0;
 }
 
+// The index of a stress log is built the first time it is processed and reused by every query
+// that follows. It lists the chunks of each thread's log in the order they are read, newest
+// messages first, with the time range and the facilities of their messages. Queries use it to
+// skip the chunks that can't contain messages they print, and to split the reading of large
+// thread logs between worker threads.
+struct IndexedChunk
+{
+    void*       firstMsg;
+    void*       lastMsg;
+    void*       endMsg;
+    uint64_t    newestTimeStamp;
+    uint64_t    oldestTimeStamp;
+    uint32_t    facilities;         // union of the FilterFacility of the messages
+    bool        hasUnfilteredMsg;   // some message has no facility, so -i can't ignore it
+    uint32_t    msgCount;
+};
+
+struct ThreadStressLogIndex
+{
+    ThreadStressLog* tsl;
+    std::vector<IndexedChunk> chunks;
+};
+
+static void* s_indexBaseAddress;
+static std::vector<ThreadStressLogIndex> s_index;
+static volatile LONG s_nextIndexWorkItem;
+static int64_t s_indexMaxHeapNumberSeen;
+static uint64_t s_indexThreadIdOfHeap[MAX_NUMBER_OF_HEAPS][2];
+
 struct ThreadStressLogDesc
 {
-    volatile LONG workStarted;
-    volatile LONG workFinished;
     ThreadStressLog* tsl;
+    ThreadStressLogIndex* index;
     StressMsgReader earliestMessage;
 
-    ThreadStressLogDesc() : workStarted(0), workFinished(0), tsl(nullptr), earliestMessage(nullptr)
+    ThreadStressLogDesc() : tsl(nullptr), index(nullptr), earliestMessage(nullptr)
     {
     }
 };
@@ -581,6 +659,16 @@ static ThreadStressLogDesc s_threadStressLogDesc[MAX_THREADSTRESSLOGS];
 static int s_threadStressLogCount;
 static LONG64 s_wrappedWriteThreadCount;
 
+// A chunk that a query reads, which is the unit of work of ProcessStresslogWorker
+struct ChunkWorkItem
+{
+    int threadStressLogIndex;
+    int chunkIndex;
+};
+
+static std::vector<ChunkWorkItem> s_chunkWorkItems;
+static volatile LONG s_nextChunkWorkItem;
+
 static const LONG MAX_MESSAGE_COUNT = 64 * 1024 * 1024;
 static StressThreadAndMsg* s_threadMsgBuf;
 static volatile LONG64 s_msgCount = 0;
@@ -641,6 +729,9 @@ void Usage()
     printf("\n");
     printf(" -d: suppress default messages\n");
     printf("\n");
+    printf("The log is indexed by thread, time and facility when it is first processed,\n");
+    printf("so the queries after it ('r') only read the parts of the log they need.\n");
+    printf("\n");
 }
 
 // Translate escape sequences like "\n" - only common ones are handled
@@ -1072,63 +1163,60 @@ static void IncludeMessage(uint64_t threadId, StressMsgReader msg)
     }
 }
 
-DWORD WINAPI ProcessStresslogWorker(LPVOID)
+static double DeltaTime(uint64_t timeStamp)
 {
-    StressLog::StressLogHeader* hdr = s_hdr;
-    LONG totalMsgCount = 0;
-    int wrappedWriteThreadCount = 0;
-    bool fTimeFilter = s_timeFilterStart != 0.0 || s_timeFilterEnd != 0.0;
-    for (int threadStressLogIndex = 0; threadStressLogIndex < s_threadStressLogCount; threadStressLogIndex++)
+    return ((double)(timeStamp - s_hdr->startTimeStamp)) / s_hdr->tickFrequency;
+}
+
+static DWORD GetWorkerThreadCount()
+{
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+
+    return min(systemInfo.dwNumberOfProcessors, (DWORD)MAXIMUM_WAIT_OBJECTS);
+}
+
+// Run worker on as many threads as there are processors and wait for all of them to finish
+static bool RunWorkers(LPTHREAD_START_ROUTINE worker)
+{
+    DWORD threadCount = GetWorkerThreadCount();
+    HANDLE threadHandle[MAXIMUM_WAIT_OBJECTS];
+    for (DWORD i = 0; i < threadCount; i++)
     {
-        // is another thread already working on this thread stress log?
-        if (s_threadStressLogDesc[threadStressLogIndex].workStarted != 0 || InterlockedIncrement(&s_threadStressLogDesc[threadStressLogIndex].workStarted) != 1)
-            continue;
+        threadHandle[i] = CreateThread(NULL, 0, worker, nullptr, 0, nullptr);
+        if (threadHandle[i] == 0)
+        {
+            printf("CreateThread failed\n");
+            WaitForMultipleObjects(i, threadHandle, TRUE, INFINITE);
+            return false;
+        }
+    }
+    WaitForMultipleObjects(threadCount, threadHandle, TRUE, INFINITE);
 
-        ThreadStressLog* tsl = s_threadStressLogDesc[threadStressLogIndex].tsl;
-        if (!tsl->IsValid())
-            continue;
-        if (!FilterThread(tsl))
-            continue;
-        if (tsl->writeHasWrapped)
+    for (DWORD i = 0; i < threadCount; i++)
+    {
+        CloseHandle(threadHandle[i]);
+    }
+    return true;
+}
+
+static void IndexThreadStressLog(ThreadStressLogIndex* index)
+{
+    StressLog::StressLogHeader* hdr = s_hdr;
+    ThreadStressLog* tsl = index->tsl;
+    void* msg = StressLog::TranslateMemoryMappedPointer(tsl->curPtr);
+    StressLogChunk* slc = StressLog::TranslateMemoryMappedPointer(tsl->curWriteChunk);
+    int chunkCount = 0;
+    while (true)
+    {
+        if (!slc->IsValid())
         {
-            wrappedWriteThreadCount++;
+            printf("oops, invalid stress log chunk\n");
         }
-        // printf("thread: %zx\n", tsl->threadId);
-        void* msg = StressLog::TranslateMemoryMappedPointer(tsl->curPtr);
-        StressLogChunk* slc = StressLog::TranslateMemoryMappedPointer(tsl->curWriteChunk);
-        int chunkCount = 0;
-        void* prevMsg = nullptr;
-        while (true)
+        else
         {
-            // printf("stress log chunk %zx\n", (size_t)slc);
-            if (!slc->IsValid())
-            {
-                printf("oops, invalid stress log chunk\n");
-                slc = slc->next;
-                if (slc == tsl->curWriteChunk)
-                    break;
-                chunkCount++;
-                if (chunkCount >= tsl->chunkListLength)
-                {
-                    printf("oops, more chunks on list than expected\n");
-                    break;
-                }
-                msg = nullptr;
-            }
             assert(StressLog::TranslateMemoryMappedPointer(StressLog::TranslateMemoryMappedPointer(slc->next)->prev) == slc);
             assert(StressLog::TranslateMemoryMappedPointer(StressLog::TranslateMemoryMappedPointer(slc->prev)->next) == slc);
-#ifdef _DEBUG
-            int chunkCount1 = 0;
-            for (StressLogChunk* slc1 = StressLog::TranslateMemoryMappedPointer(tsl->curWriteChunk); slc1 != slc; slc1 = StressLog::TranslateMemoryMappedPointer(slc1->next))
-            {
-                chunkCount1++;
-            }
-            if (chunkCount != chunkCount1)
-            {
-                printf("oops, we have a loop\n");
-                break;
-            }
-#endif //_DEBUG
 
             size_t* p = (size_t*)slc->StartPtr();
             size_t* end = (size_t*)slc->EndPtr();
@@ -1142,79 +1230,265 @@ DWORD WINAPI ProcessStresslogWorker(LPVOID)
                     p++;
                 msg = (void*)p;
             }
-            void* endMsg = (void*)end;
-            while (msg < endMsg)
+
+            IndexedChunk chunk = {};
+            chunk.firstMsg = msg;
+            chunk.endMsg = (void*)end;
+            while (msg < chunk.endMsg)
             {
                 StressMsgReader msgReader(msg);
-                totalMsgCount++;
+                uint64_t timeStamp = msgReader.GetTimeStamp();
+                uint32_t facility = FilterFacility(msgReader.GetFacility());
+                if (chunk.msgCount == 0)
+                {
+                    chunk.newestTimeStamp = timeStamp;
+                }
+                chunk.oldestTimeStamp = timeStamp;
+                chunk.facilities |= facility;
+                chunk.hasUnfilteredMsg |= (facility == 0);
+                chunk.lastMsg = msg;
+                chunk.msgCount++;
+
                 char* format = (char*)(hdr->moduleImage + msgReader.GetFormatOffset());
-                double deltaTime = ((double)(msgReader.GetTimeStamp() - hdr->startTimeStamp)) / hdr->tickFrequency;
-                bool fIgnoreMessage = false;
-                if (fTimeFilter)
+                NoteGcMessage(tsl, FindStringId(hdr, format), DeltaTime(timeStamp), msgReader.GetArgs());
+
+                msg = (StressMsg*)&msgReader.GetArgs()[msgReader.GetNumberOfArgs()];
+            }
+
+            if (chunk.msgCount > 0)
+            {
+                index->chunks.push_back(chunk);
+            }
+        }
+
+        if (slc == StressLog::TranslateMemoryMappedPointer(tsl->chunkListTail) && !tsl->writeHasWrapped)
+            break;
+        slc = StressLog::TranslateMemoryMappedPointer(slc->next);
+        if (slc == StressLog::TranslateMemoryMappedPointer(tsl->curWriteChunk))
+            break;
+        chunkCount++;
+        if (chunkCount >= tsl->chunkListLength)
+        {
+            printf("oops, more chunks on list than expected\n");
+            break;
+        }
+        msg = nullptr;
+    }
+}
+
+DWORD WINAPI IndexStresslogWorker(LPVOID)
+{
+    LONG workItem;
+    while ((workItem = InterlockedIncrement(&s_nextIndexWorkItem) - 1) < (LONG)s_index.size())
+    {
+        IndexThreadStressLog(&s_index[workItem]);
+    }
+    return 0;
+}
+
+static bool BuildIndex(void* baseAddress, StressLog::StressLogHeader* hdr)
+{
+    if (s_indexBaseAddress == baseAddress)
+        return true;
+
+    s_index.clear();
+    for (ThreadStressLog* tsl = StressLog::TranslateMemoryMappedPointer(hdr->logs.t); tsl != nullptr; tsl = StressLog::TranslateMemoryMappedPointer(tsl->next))
+    {
+        if (!tsl->IsValid())
+            continue;
+        if (s_index.size() >= MAX_THREADSTRESSLOGS)
+        {
+            printf("too many threads\n");
+            return false;
+        }
+        s_index.push_back({ tsl, {} });
+    }
+
+    s_maxHeapNumberSeen = -1;
+    memset((void*)s_threadIdOfHeap, 0, sizeof(s_threadIdOfHeap));
+    s_nextIndexWorkItem = 0;
+    if (!RunWorkers(IndexStresslogWorker))
+        return false;
+
+    s_indexMaxHeapNumberSeen = s_maxHeapNumberSeen;
+    memcpy(s_indexThreadIdOfHeap, (void*)s_threadIdOfHeap, sizeof(s_indexThreadIdOfHeap));
+    s_indexBaseAddress = baseAddress;
+    return true;
+}
+
+// Can -i tell that FilterMessage rejects every message in the chunk?
+static bool IsChunkIgnoredByFacility(const IndexedChunk& chunk)
+{
+    if (s_facilityIgnore == 0 || s_showAllMessages || s_valueFilterCount > 0 || chunk.hasUnfilteredMsg)
+        return false;
+    return (chunk.facilities & ~s_facilityIgnore) == 0;
+}
+
+// The messages are read newest first, so the earliest message a query reads from a thread is the
+// last one that isn't before the start of the time filter.
+static void* FindEarliestMessage(ThreadStressLogIndex* index, bool fTimeFilter)
+{
+    void* earliestMessage = nullptr;
+    for (const IndexedChunk& chunk : index->chunks)
+    {
+        if (fTimeFilter && DeltaTime(chunk.newestTimeStamp) < s_timeFilterStart)
+            break;
+        if (!fTimeFilter || DeltaTime(chunk.oldestTimeStamp) >= s_timeFilterStart)
+        {
+            earliestMessage = chunk.lastMsg;
+            continue;
+        }
+
+        // the start of the time filter is in this chunk
+        for (void* msg = chunk.firstMsg; msg < chunk.endMsg; )
+        {
+            StressMsgReader msgReader(msg);
+            if (DeltaTime(msgReader.GetTimeStamp()) < s_timeFilterStart)
+                break;
+            earliestMessage = msg;
+            msg = (StressMsg*)&msgReader.GetArgs()[msgReader.GetNumberOfArgs()];
+        }
+        break;
+    }
+    return earliestMessage;
+}
+
+DWORD WINAPI ProcessStresslogWorker(LPVOID)
+{
+    StressLog::StressLogHeader* hdr = s_hdr;
+    LONG64 totalMsgCount = 0;
+    bool fTimeFilter = s_timeFilterStart != 0.0 || s_timeFilterEnd != 0.0;
+    LONG workItem;
+    while ((workItem = InterlockedIncrement(&s_nextChunkWorkItem) - 1) < (LONG)s_chunkWorkItems.size())
+    {
+        ThreadStressLogDesc& desc = s_threadStressLogDesc[s_chunkWorkItems[workItem].threadStressLogIndex];
+        const IndexedChunk& chunk = desc.index->chunks[s_chunkWorkItems[workItem].chunkIndex];
+        ThreadStressLog* tsl = desc.tsl;
+
+        // we may have learned that this isn't one of the GC threads we're looking for
+        if (s_hadGcThreadFilters && !FilterThread(tsl))
+            continue;
+
+        void* msg = chunk.firstMsg;
+        while (msg < chunk.endMsg)
+        {
+            StressMsgReader msgReader(msg);
+            totalMsgCount++;
+            char* format = (char*)(hdr->moduleImage + msgReader.GetFormatOffset());
+            double deltaTime = DeltaTime(msgReader.GetTimeStamp());
+            bool fIgnoreMessage = false;
+            if (fTimeFilter)
+            {
+                if (deltaTime < s_timeFilterStart)
                 {
-                    if (deltaTime < s_timeFilterStart)
-                    {
-                        // we know the times will only get smaller, so can stop here
-                        break;
-                    }
-                    if (deltaTime > s_timeFilterEnd)
-                    {
-                        fIgnoreMessage = true;
-                    }
+                    // we know the times will only get smaller, so can stop here
+                    break;
                 }
-                int numberOfArgs = msgReader.GetNumberOfArgs();
-                if (!fIgnoreMessage)
+                if (deltaTime > s_timeFilterEnd)
                 {
-                    bool fIncludeMessage = s_showAllMessages || FilterMessage(hdr, tsl, msgReader.GetFacility(), format, deltaTime, numberOfArgs, msgReader.GetArgs());
-                    if (!fIncludeMessage && s_valueFilterCount > 0)
+                    fIgnoreMessage = true;
+                }
+            }
+            int numberOfArgs = msgReader.GetNumberOfArgs();
+            if (!fIgnoreMessage)
+            {
+                bool fIncludeMessage = s_showAllMessages || FilterMessage(hdr, tsl, msgReader.GetFacility(), format, deltaTime, numberOfArgs, msgReader.GetArgs());
+                if (!fIncludeMessage && s_valueFilterCount > 0)
+                {
+                    for (int i = 0; i < numberOfArgs; i++)
                     {
-                        for (int i = 0; i < numberOfArgs; i++)
+                        for (int j = 0; j < s_valueFilterCount; j++)
                         {
-                            for (int j = 0; j < s_valueFilterCount; j++)
+                            if (s_valueFilter[j].start <= (size_t)msgReader.GetArgs()[i] && (size_t)msgReader.GetArgs()[i] <= s_valueFilter[j].end)
                             {
-                                if (s_valueFilter[j].start <= (size_t)msgReader.GetArgs()[i] && (size_t)msgReader.GetArgs()[i] <= s_valueFilter[j].end)
-                                {
-                                    fIncludeMessage = true;
-                                    break;
-                                }
-                            }
-                            if (fIncludeMessage)
+                                fIncludeMessage = true;
                                 break;
+                            }
                         }
-                    }
-                    if (fIncludeMessage)
-                    {
-                        IncludeMessage(tsl->threadId, msg);
+                        if (fIncludeMessage)
+                            break;
                     }
                 }
-                prevMsg = msg;
-                msg = (StressMsg*)&msgReader.GetArgs()[numberOfArgs];
-            }
-            if (slc == StressLog::TranslateMemoryMappedPointer(tsl->chunkListTail) && !tsl->writeHasWrapped)
-                break;
-            slc = StressLog::TranslateMemoryMappedPointer(slc->next);
-            if (slc == StressLog::TranslateMemoryMappedPointer(tsl->curWriteChunk))
-                break;
-            if (s_hadGcThreadFilters && !FilterThread(tsl))
-                break;
-            chunkCount++;
-            if (chunkCount >= tsl->chunkListLength)
-            {
-                printf("oops, more chunks on list than expected\n");
-                break;
+                if (fIncludeMessage)
+                {
+                    IncludeMessage(tsl->threadId, msg);
+                }
             }
-            msg = nullptr;
+            msg = (StressMsg*)&msgReader.GetArgs()[numberOfArgs];
         }
-        s_threadStressLogDesc[threadStressLogIndex].earliestMessage = prevMsg;
-        s_threadStressLogDesc[threadStressLogIndex].workFinished = 1;
     }
 
     InterlockedAdd64(&s_totalMsgCount, totalMsgCount);
-    InterlockedAdd64(&s_wrappedWriteThreadCount, wrappedWriteThreadCount);
 
     return 0;
 }
 
+// The order of CmpMsg
+static bool MsgLess(const StressThreadAndMsg& msg1, const StressThreadAndMsg& msg2)
+{
+    if (msg1.msg.GetTimeStamp() != msg2.msg.GetTimeStamp())
+        return msg1.msg.GetTimeStamp() > msg2.msg.GetTimeStamp();
+    if (msg1.threadId != msg2.threadId)
+        return msg1.threadId < msg2.threadId;
+    return msg1.msgId < msg2.msgId;
+}
+
+static StressThreadAndMsg* s_sortMsgs;
+static LONG64 s_sortMsgCount;
+static LONG64 s_sortRunLength;
+static bool s_sortMerging;
+static LONG s_sortWorkItemCount;
+static volatile LONG s_nextSortWorkItem;
+
+// Each work item is a run of s_sortRunLength messages. The first pass sorts the runs, and each
+// pass after it merges the two sorted halves of the runs.
+DWORD WINAPI SortMessagesWorker(LPVOID)
+{
+    LONG workItem;
+    while ((workItem = InterlockedIncrement(&s_nextSortWorkItem) - 1) < s_sortWorkItemCount)
+    {
+        LONG64 start = workItem * s_sortRunLength;
+        LONG64 end = min(start + s_sortRunLength, s_sortMsgCount);
+        if (s_sortMerging)
+        {
+            LONG64 mid = min(start + s_sortRunLength / 2, end);
+            std::inplace_merge(&s_sortMsgs[start], &s_sortMsgs[mid], &s_sortMsgs[end], MsgLess);
+        }
+        else
+        {
+            std::sort(&s_sortMsgs[start], &s_sortMsgs[end], MsgLess);
+        }
+    }
+    return 0;
+}
+
+static bool SortMessages(StressThreadAndMsg* msgs, LONG64 msgCount)
+{
+    const LONG64 minParallelSortCount = 64 * 1024;
+    if (msgCount < minParallelSortCount)
+    {
+        std::sort(msgs, msgs + msgCount, MsgLess);
+        return true;
+    }
+
+    DWORD threadCount = GetWorkerThreadCount();
+    s_sortMsgs = msgs;
+    s_sortMsgCount = msgCount;
+    s_sortRunLength = (msgCount + threadCount - 1) / threadCount;
+    s_sortMerging = false;
+    while (true)
+    {
+        s_sortWorkItemCount = (LONG)((msgCount + s_sortRunLength - 1) / s_sortRunLength);
+        s_nextSortWorkItem = 0;
+        if (!RunWorkers(SortMessagesWorker))
+            return false;
+        if (s_sortRunLength >= msgCount)
+            return true;
+        s_sortRunLength *= 2;
+        s_sortMerging = true;
+    }
+}
+
 static double FindLatestTime(StressLog::StressLogHeader* hdr)
 {
     double latestTime = 0.0;
@@ -1266,11 +1540,6 @@ static void PrintMessage(CorClrData& corClrData, FILE *outputFile, uint64_t thre
 
 int ProcessStressLog(void* baseAddress, int argc, char* argv[])
 {
-    for (int threadStressLogIndex = 0; threadStressLogIndex < s_threadStressLogCount; threadStressLogIndex++)
-    {
-        s_threadStressLogDesc[threadStressLogIndex].workStarted = 0;
-        s_threadStressLogDesc[threadStressLogIndex].workFinished = 0;
-    }
     s_msgCount = 0;
     s_totalMsgCount = 0;
     s_timeFilterStart = 0;
@@ -1323,45 +1592,93 @@ int ProcessStressLog(void* baseAddress, int argc, char* argv[])
     auto temp = new StressThreadAndMsg[MAX_MESSAGE_COUNT];
     s_threadMsgBuf = temp;
 
-    int threadStressLogIndex = 0;
+    if (!BuildIndex(baseAddress, hdr))
+        return 1;
+
+    // start from what the index found out about the GC threads
+    s_maxHeapNumberSeen = s_indexMaxHeapNumberSeen;
+    for (int heap = 0; heap < MAX_NUMBER_OF_HEAPS; heap++)
+    {
+        for (int k = GC_THREAD_FG; k <= GC_THREAD_BG; k++)
+        {
+            s_threadIdOfHeap[heap][k] = s_indexThreadIdOfHeap[heap][k];
+        }
+    }
+
     double latestTime = FindLatestTime(hdr);
     if (s_timeFilterStart < 0)
     {
         s_timeFilterStart = max(latestTime + s_timeFilterStart, 0.0);
         s_timeFilterEnd = latestTime;
     }
-    for (ThreadStressLog* tsl = StressLog::TranslateMemoryMappedPointer(hdr->logs.t); tsl != nullptr; tsl = StressLog::TranslateMemoryMappedPointer(tsl->next))
+    bool fTimeFilter = s_timeFilterStart != 0.0 || s_timeFilterEnd != 0.0;
+
+    // the chunks that may contain messages in the time interval we print
+    double chunkFilterStart = fTimeFilter ? s_timeFilterStart : -INFINITY;
+    double chunkFilterEnd = fTimeFilter ? s_timeFilterEnd : INFINITY;
+
+    double gcStartTime = INFINITY;
+    double gcEndTime = 0.0;
+    if (s_gcFilterStart != 0)
     {
-        if (!tsl->IsValid())
-            continue;
+        // find the time interval that includes the GCs in question - the index
+        // has seen all GC start and end messages
+        for (unsigned long i = s_gcFilterStart; i <= s_gcFilterEnd; i++)
+        {
+            gcStartTime = min(gcStartTime, s_gcStartEnd[i].startTime);
+            if (s_gcStartEnd[i].endTime != 0.0)
+            {
+                gcEndTime = max(gcEndTime, s_gcStartEnd[i].endTime);
+            }
+            else
+            {
+                // haven't seen the end - assume it's still in progress
+                gcEndTime = latestTime;
+            }
+        }
+        chunkFilterStart = max(chunkFilterStart, gcStartTime);
+        chunkFilterEnd = min(chunkFilterEnd, gcEndTime);
+    }
+
+    int threadStressLogIndex = 0;
+    s_wrappedWriteThreadCount = 0;
+    s_chunkWorkItems.clear();
+    for (ThreadStressLogIndex& index : s_index)
+    {
+        ThreadStressLog* tsl = index.tsl;
         if (!FilterThread(tsl))
             continue;
-        if (threadStressLogIndex >= MAX_THREADSTRESSLOGS)
+        if (tsl->writeHasWrapped)
         {
-            printf("too many threads\n");
-            return 1;
+            s_wrappedWriteThreadCount++;
         }
         s_threadStressLogDesc[threadStressLogIndex].tsl = tsl;
-        threadStressLogIndex++;
-    }
-    s_threadStressLogCount = threadStressLogIndex;
-    s_wrappedWriteThreadCount = 0;
-
-    SYSTEM_INFO systemInfo;
-    GetSystemInfo(&systemInfo);
+        s_threadStressLogDesc[threadStressLogIndex].index = &index;
+        s_threadStressLogDesc[threadStressLogIndex].earliestMessage = FindEarliestMessage(&index, fTimeFilter);
 
-    DWORD threadCount = min(systemInfo.dwNumberOfProcessors, (DWORD)MAXIMUM_WAIT_OBJECTS);
-    HANDLE threadHandle[64];
-    for (DWORD i = 0; i < threadCount; i++)
-    {
-        threadHandle[i] = CreateThread(NULL, 0, ProcessStresslogWorker, nullptr, 0, nullptr);
-        if (threadHandle[i] == 0)
+        for (int chunkIndex = 0; chunkIndex < (int)index.chunks.size(); chunkIndex++)
         {
-            printf("CreateThread failed\n");
-            return 1;
+            const IndexedChunk& chunk = index.chunks[chunkIndex];
+            if (DeltaTime(chunk.newestTimeStamp) < chunkFilterStart)
+            {
+                // this chunk and all the ones after it are older
+                break;
+            }
+            if (DeltaTime(chunk.oldestTimeStamp) > chunkFilterEnd || IsChunkIgnoredByFacility(chunk))
+            {
+                // none of the messages would be printed
+                s_totalMsgCount += chunk.msgCount;
+                continue;
+            }
+            s_chunkWorkItems.push_back({ threadStressLogIndex, chunkIndex });
         }
+        threadStressLogIndex++;
     }
-    WaitForMultipleObjects(threadCount, threadHandle, TRUE, INFINITE);
+    s_threadStressLogCount = threadStressLogIndex;
+
+    s_nextChunkWorkItem = 0;
+    if (!RunWorkers(ProcessStresslogWorker))
+        return 1;
 
     // the interlocked increment may have increased s_msgCount beyond MAX_MESSAGE_COUNT -
     // make sure we don't go beyond the end of the buffer
@@ -1369,30 +1686,13 @@ int ProcessStressLog(void* baseAddress, int argc, char* argv[])
 
     if (s_gcFilterStart != 0)
     {
-        // find the time interval that includes the GCs in question
-        double startTime = INFINITY;
-        double endTime = 0.0;
-        for (unsigned long i = s_gcFilterStart; i <= s_gcFilterEnd; i++)
-        {
-            startTime = min(startTime, s_gcStartEnd[i].startTime);
-            if (s_gcStartEnd[i].endTime != 0.0)
-            {
-                endTime = max(endTime, s_gcStartEnd[i].endTime);
-            }
-            else
-            {
-                // haven't seen the end - assume it's still in progress
-                endTime = latestTime;
-            }
-        }
-
-        // remove all messages outside of this time interval
+        // remove all messages outside of the time interval of the GCs
         int remMsgCount = 0;
         for (int msgIndex = 0; msgIndex < s_msgCount; msgIndex++)
         {
             StressMsgReader msg = s_threadMsgBuf[msgIndex].msg;
             double deltaTime = ((double)(msg.GetTimeStamp() - hdr->startTimeStamp)) / hdr->tickFrequency;
-            if (startTime <= deltaTime && deltaTime <= endTime)
+            if (gcStartTime <= deltaTime && deltaTime <= gcEndTime)
             {
                 s_threadMsgBuf[remMsgCount] = s_threadMsgBuf[msgIndex];
                 remMsgCount++;
@@ -1451,10 +1751,8 @@ int ProcessStressLog(void* baseAddress, int argc, char* argv[])
         s_msgCount = remMsgCount;
     }
 
-    // if the sort becomes a bottleneck, we can do a bucket sort by time
-    // (say fractions of a second), then sort the individual buckets,
-    // perhaps on multiple threads
-    qsort(s_threadMsgBuf, s_msgCount, sizeof(s_threadMsgBuf[0]), CmpMsg);
+    if (!SortMessages(s_threadMsgBuf, s_msgCount))
+        return 1;
 
     CorClrData corClrData(hdr);
     FILE* outputFile = stdout;
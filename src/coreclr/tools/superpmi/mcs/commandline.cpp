@@ -48,11 +48,21 @@ void CommandLine::DumpHelp(const char* program)
     printf("     file2 is appended to file1.\n");
     printf("     e.g. -concat a.mch b.mch\n");
     printf("\n");
+    printf(" -compress inputfile outputfile\n");
+    printf("     Write the methodContexts of inputfile to outputfile in the compressed MCZ format, which stores\n");
+    printf("     duplicates once and deflates the rest with a dictionary shared by the whole file. An MCZ file\n");
+    printf("     can be used anywhere an MCH file can, and doesn't need a TOC.\n");
+    printf("     e.g. -compress a.mch a.mcz\n");
+    printf("\n");
     printf(" -copy range file1 file2\n");
     printf("     Copy methodContext numbers in range from file1 to file2.\n");
     printf("     file1 is read and file2 is written\n");
     printf("     e.g. -copy a.mch b.mch\n");
     printf("\n");
+    printf(" -decompress inputfile outputfile\n");
+    printf("     Write the methodContexts of the MCZ file inputfile to outputfile as an MCH file.\n");
+    printf("     e.g. -decompress a.mcz a.mch\n");
+    printf("\n");
     printf(" -dump {optional range} inputfile [-simple]\n");
     printf("     Dump details for each methodContext.\n");
     printf("     With -simple, don't display the function name/arguments in the header (useful for debugging mcs itself).\n");
@@ -203,6 +213,12 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
                 foundVerb       = true;
                 o->actionConcat = true;
             }
+            else if ((_strnicmp(&argv[i][1], "compress", argLen) == 0))
+            {
+                tempLen           = strlen(argv[i]);
+                foundVerb         = true;
+                o->actionCompress = true;
+            }
             else if ((_strnicmp(&argv[i][1], "copy", argLen) == 0))
             {
                 tempLen       = strlen(argv[i]);
@@ -219,6 +235,12 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
                 if (i + 1 < argc) // Peek to see if we have an mcl file or an integer next
                     goto processMCL;
             }
+            else if ((_strnicmp(&argv[i][1], "decompress", argLen) == 0))
+            {
+                tempLen             = strlen(argv[i]);
+                foundVerb           = true;
+                o->actionDecompress = true;
+            }
             else if ((_strnicmp(&argv[i][1], "fracture", argLen) == 0))
             {
                 tempLen           = strlen(argv[i]);
@@ -485,6 +507,17 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
         }
         return true;
     }
+    if (o->actionCompress || o->actionDecompress)
+    {
+        if ((!foundFile1) || (!foundFile2))
+        {
+            LogError("CommandLine::Parse() '-%s' needs one input and one output.",
+                     o->actionCompress ? "compress" : "decompress");
+            DumpHelp(argv[0]);
+            return false;
+        }
+        return true;
+    }
     if (o->actionMerge)
     {
         if ((!foundFile1) || (!foundFile2))
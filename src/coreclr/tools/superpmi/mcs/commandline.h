@@ -16,7 +16,9 @@ public:
         Options()
             : actionASMDump(false)
             , actionConcat(false)
+            , actionCompress(false)
             , actionCopy(false)
+            , actionDecompress(false)
             , actionDump(false)
             , actionDumpMap(false)
             , actionDumpToc(false)
@@ -45,7 +47,9 @@ public:
 
         bool  actionASMDump;
         bool  actionConcat;
+        bool  actionCompress;
         bool  actionCopy;
+        bool  actionDecompress;
         bool  actionDump;
         bool  actionDumpMap;
         bool  actionDumpToc;
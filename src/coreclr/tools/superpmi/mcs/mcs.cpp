@@ -16,6 +16,7 @@
 #include "verbremovedup.h"
 #include "verbstat.h"
 #include "verbconcat.h"
+#include "verbcompress.h"
 #include "verbmerge.h"
 #include "verbstrip.h"
 #include "verbprintjiteeversion.h"
@@ -49,6 +50,14 @@ int __cdecl main(int argc, char* argv[])
     {
         exitCode = verbConcat::DoWork(o.nameOfFile1, o.nameOfFile2);
     }
+    if (o.actionCompress)
+    {
+        exitCode = verbCompress::DoWork(o.nameOfFile1, o.nameOfFile2, false);
+    }
+    if (o.actionDecompress)
+    {
+        exitCode = verbCompress::DoWork(o.nameOfFile1, o.nameOfFile2, true);
+    }
     if (o.actionMerge)
     {
         exitCode = verbMerge::DoWork(o.nameOfFile1, o.nameOfFile2, o.recursive, o.dedup, o.stripCR);
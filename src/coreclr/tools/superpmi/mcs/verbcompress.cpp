@@ -0,0 +1,46 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "standardpch.h"
+#include "verbcompress.h"
+#include "mczfile.h"
+#include "simpletimer.h"
+#include "logging.h"
+
+int verbCompress::DoWork(const char* nameOfInput, const char* nameOfOutput, bool decompress)
+{
+    SimpleTimer st1;
+
+    LogVerbose("%s '%s' into '%s'", decompress ? "Decompressing" : "Compressing", nameOfInput, nameOfOutput);
+
+    st1.Start();
+    bool success = decompress ? MczFile::Decompress(nameOfInput, nameOfOutput)
+                              : MczFile::Compress(nameOfInput, nameOfOutput);
+    st1.Stop();
+
+    if (!success)
+    {
+        return -1;
+    }
+
+    HANDLE hFileIn =
+        CreateFileA(nameOfInput, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    HANDLE hFileOut =
+        CreateFileA(nameOfOutput, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    LARGE_INTEGER inputSize  = {};
+    LARGE_INTEGER outputSize = {};
+    if (hFileIn != INVALID_HANDLE_VALUE)
+    {
+        GetFileSizeEx(hFileIn, &inputSize);
+        CloseHandle(hFileIn);
+    }
+    if (hFileOut != INVALID_HANDLE_VALUE)
+    {
+        GetFileSizeEx(hFileOut, &outputSize);
+        CloseHandle(hFileOut);
+    }
+
+    LogInfo("Wrote %lld bytes from %lld bytes (%.2fx) in %fms", outputSize.QuadPart, inputSize.QuadPart,
+            outputSize.QuadPart == 0 ? 0.0 : (double)inputSize.QuadPart / outputSize.QuadPart, st1.GetMilliseconds());
+    return 0;
+}
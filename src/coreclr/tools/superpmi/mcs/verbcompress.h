@@ -0,0 +1,15 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//----------------------------------------------------------
+// verbCompress.h - verbs that convert between MCH files and compressed MCZ files
+//----------------------------------------------------------
+#ifndef _verbCompress
+#define _verbCompress
+
+class verbCompress
+{
+public:
+    static int DoWork(const char* nameOfInput, const char* nameOfOutput, bool decompress);
+};
+#endif
@@ -64,7 +64,7 @@ int verbStrip::DoWork(
             st1->Start();
         }
 
-        if (!MethodContext::Initialize(loadedCount, mcb.buff, mcb.size, &mc))
+        if (!MethodContext::Initialize(loadedCount, mcb.buff, mcb.size, &mc, mcb.mapped))
             return -1;
 
         if (stripCR)
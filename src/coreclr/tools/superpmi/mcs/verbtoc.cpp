@@ -27,6 +27,12 @@ int verbTOC::DoWork(const char* nameOfInput)
     if (!mci.Initialize(nameOfInput))
         return -1;
 
+    if (mci.IsCompressed())
+    {
+        LogError("'%s' is an MCZ file, which doesn't need a TOC.", nameOfInput);
+        return -1;
+    }
+
     int savedCount = 0;
 
     TOCElementNode* head    = nullptr;
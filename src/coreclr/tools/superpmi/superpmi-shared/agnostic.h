@@ -542,6 +542,8 @@ struct Agnostic_GetThreadLocalStaticBlocksInfo
     DWORD                         offsetOfMaxThreadStaticBlocks;
     DWORD                         offsetOfThreadStaticBlocks;
     DWORD                         offsetOfBaseOfThreadLocalData;
+    DWORD                         offsetOfMaxCollectibleThreadStaticBlocks;
+    DWORD                         offsetOfCollectibleThreadStaticBlocks;
 };
 
 struct Agnostic_GetThreadStaticInfo_NativeAOT
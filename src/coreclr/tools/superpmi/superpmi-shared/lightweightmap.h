@@ -39,7 +39,8 @@ public:
 
     ~LightWeightMapBuffer()
     {
-        delete[] buffer;
+        if (ownsBuffer)
+            delete[] buffer;
     }
 
     unsigned int AddBuffer(const unsigned char* buff, unsigned int len)
@@ -70,9 +71,10 @@ public:
         memcpy(newbuffer + bufferLength + sizeof(unsigned int), buff, len);
         *((unsigned int*)(newbuffer + bufferLength)) = len;
         bufferLength += sizeof(unsigned int) + len;
-        if (buffer != nullptr)
+        if ((buffer != nullptr) && ownsBuffer)
             delete[] buffer;
-        buffer = newbuffer;
+        buffer     = newbuffer;
+        ownsBuffer = true;
         return newOffset + sizeof(unsigned int);
     }
 
@@ -97,9 +99,10 @@ public:
         memset(newbuffer + bufferLength + sizeof(unsigned int), 0, len);
         *((unsigned int*)(newbuffer + bufferLength)) = len;
         bufferLength += sizeof(unsigned int) + len;
-        if (buffer != nullptr)
+        if ((buffer != nullptr) && ownsBuffer)
             delete[] buffer;
-        buffer = newbuffer;
+        buffer     = newbuffer;
+        ownsBuffer = true;
         return buffer + newOffset + sizeof(unsigned int);
     }
 
@@ -168,12 +171,23 @@ protected:
         buffer       = nullptr;
         bufferLength = 0;
         locked       = false;
+        ownsBuffer   = true;
+    }
+
+    // Whether the raw data read by ReadFromArray() can be used in place rather than copied. The data
+    // must outlive the map, and must be writable (a copy-on-write mapping is fine) since items can be
+    // updated in place.
+    template <typename _T>
+    static bool CanBorrow(bool borrow, const unsigned char* ptr)
+    {
+        return borrow && (((size_t)ptr % alignof(_T)) == 0);
     }
 
     unsigned char* buffer; // TODO-Cleanup: this should really be a linked list; we reallocate it with every call to
                            // AddBuffer().
     unsigned int bufferLength;
     bool         locked;
+    bool         ownsBuffer; // false if buffer points into data borrowed by ReadFromArray()
 };
 
 template <typename _Key, typename _Item>
@@ -215,13 +229,17 @@ public:
 
     ~LightWeightMap()
     {
+        if (!ownsArrays)
+            return;
         if (pKeys != nullptr)
             delete[] pKeys;
         if (pItems != nullptr)
             delete[] pItems;
     }
 
-    void ReadFromArray(const unsigned char* rawData, unsigned int size)
+    // If borrow is true, the raw buffer is used in place from rawData, and so are the keys and items
+    // when rawData happens to be suitably aligned for them (see CanBorrow()).
+    void ReadFromArray(const unsigned char* rawData, unsigned int size, bool borrow = false)
     {
         unsigned int         sizeOfKey  = sizeof(_Key);
         unsigned int         sizeOfItem = sizeof(_Item);
@@ -245,21 +263,41 @@ public:
             ptr += sizeof(unsigned int);
 
             AssertCodeMsg(pKeys == nullptr, EXCEPTIONCODE_LWM, "Found existing pKeys");
-            pKeys = new _Key[numItems];
-            // Set the Keys
-            memcpy(pKeys, ptr, sizeOfKey * numItems);
-            ptr += sizeOfKey * numItems;
-
             AssertCodeMsg(pItems == nullptr, EXCEPTIONCODE_LWM, "Found existing pItems");
-            pItems = new _Item[numItems];
-            // Set the Items
-            memcpy(pItems, ptr, sizeOfItem * numItems);
-            ptr += sizeOfItem * numItems;
-
             AssertCodeMsg(buffer == nullptr, EXCEPTIONCODE_LWM, "Found existing buffer");
-            buffer = new unsigned char[bufferLength];
-            // Read the buffer
-            memcpy(buffer, ptr, bufferLength * sizeof(unsigned char));
+
+            if (CanBorrow<_Key>(borrow, ptr) && CanBorrow<_Item>(borrow, ptr + sizeOfKey * numItems))
+            {
+                pKeys = (_Key*)ptr;
+                ptr += sizeOfKey * numItems;
+                pItems = (_Item*)ptr;
+                ptr += sizeOfItem * numItems;
+                ownsArrays = false;
+            }
+            else
+            {
+                pKeys = new _Key[numItems];
+                // Set the Keys
+                memcpy(pKeys, ptr, sizeOfKey * numItems);
+                ptr += sizeOfKey * numItems;
+
+                pItems = new _Item[numItems];
+                // Set the Items
+                memcpy(pItems, ptr, sizeOfItem * numItems);
+                ptr += sizeOfItem * numItems;
+            }
+
+            if (CanBorrow<unsigned char>(borrow, ptr))
+            {
+                buffer     = (unsigned char*)ptr;
+                ownsBuffer = false;
+            }
+            else
+            {
+                buffer = new unsigned char[bufferLength];
+                // Read the buffer
+                memcpy(buffer, ptr, bufferLength * sizeof(unsigned char));
+            }
             ptr += bufferLength * sizeof(unsigned char);
         }
 
@@ -339,8 +377,12 @@ public:
             pItems = new _Item[(strideSize * 2) + 4];
             memcpy(pItems, tItems, strideSize * sizeof(_Item));
             strideSize = (strideSize * 2) + 4;
-            delete[] tKeys;
-            delete[] tItems;
+            if (ownsArrays)
+            {
+                delete[] tKeys;
+                delete[] tItems;
+            }
+            ownsArrays = true;
         }
         unsigned int insert = 0;
         // Find the right place to insert O(n) version
@@ -466,12 +508,14 @@ private:
         strideSize = 0;
         pKeys      = nullptr;
         pItems     = nullptr;
+        ownsArrays = true;
     }
 
     unsigned int numItems;   // Number of active items in the pKeys and pItems arrays.
     unsigned int strideSize; // Allocated count of items in the pKeys and pItems arrays.
     _Key*        pKeys;
     _Item*       pItems;
+    bool         ownsArrays; // false if pKeys and pItems point into data borrowed by ReadFromArray()
 };
 
 // Second implementation of LightWeightMap where the Key type is an unsigned int in the range [0 .. numItems - 1] (where
@@ -509,11 +553,13 @@ public:
 
     ~DenseLightWeightMap()
     {
-        if (pItems != nullptr)
+        if ((pItems != nullptr) && ownsItems)
             delete[] pItems;
     }
 
-    void ReadFromArray(const unsigned char* rawData, unsigned int size)
+    // If borrow is true, the raw buffer is used in place from rawData, and so are the items when
+    // rawData happens to be suitably aligned for them (see CanBorrow()).
+    void ReadFromArray(const unsigned char* rawData, unsigned int size, bool borrow = false)
     {
         unsigned int         sizeOfItem = sizeof(_Item);
         const unsigned char* ptr        = rawData;
@@ -537,15 +583,32 @@ public:
             ptr += sizeof(unsigned int);
 
             AssertCodeMsg(pItems == nullptr, EXCEPTIONCODE_LWM, "Found existing pItems");
-            pItems = new _Item[numItems];
-            // Set the Items
-            memcpy(pItems, ptr, sizeOfItem * numItems);
+            AssertCodeMsg(buffer == nullptr, EXCEPTIONCODE_LWM, "Found existing buffer");
+
+            if (CanBorrow<_Item>(borrow, ptr))
+            {
+                pItems    = (_Item*)ptr;
+                ownsItems = false;
+            }
+            else
+            {
+                pItems = new _Item[numItems];
+                // Set the Items
+                memcpy(pItems, ptr, sizeOfItem * numItems);
+            }
             ptr += sizeOfItem * numItems;
 
-            AssertCodeMsg(buffer == nullptr, EXCEPTIONCODE_LWM, "Found existing buffer");
-            buffer = new unsigned char[bufferLength];
-            // Read the buffer
-            memcpy(buffer, ptr, bufferLength * sizeof(unsigned char));
+            if (CanBorrow<unsigned char>(borrow, ptr))
+            {
+                buffer     = (unsigned char*)ptr;
+                ownsBuffer = false;
+            }
+            else
+            {
+                buffer = new unsigned char[bufferLength];
+                // Read the buffer
+                memcpy(buffer, ptr, bufferLength * sizeof(unsigned char));
+            }
             ptr += bufferLength * sizeof(unsigned char);
         }
 
@@ -671,7 +734,9 @@ public:
             pItems        = new _Item[(strideSize * 2) + 4];
             memcpy(pItems, tItems, strideSize * sizeof(_Item));
             strideSize = (strideSize * 2) + 4;
-            delete[] tItems;
+            if (ownsItems)
+                delete[] tItems;
+            ownsItems = true;
         }
 
         pItems[numItems] = item;
@@ -715,6 +780,7 @@ private:
         numItems   = 0;
         strideSize = 0;
         pItems     = nullptr;
+        ownsItems  = true;
     }
 
     static int CompareKeys(unsigned int key1, unsigned int key2)
@@ -730,6 +796,7 @@ private:
     unsigned int numItems;   // Number of active items in the pKeys and pItems arrays.
     unsigned int strideSize; // Allocated count of items in the pKeys and pItems arrays.
     _Item*       pItems;
+    bool         ownsItems; // false if pItems points into data borrowed by ReadFromArray()
 };
 
 #define dumpLWM(ptr, mapName)                                                                                          \
@@ -0,0 +1,494 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//----------------------------------------------------------
+// MczFile.cpp - Compressed, content-addressed method context collections
+//----------------------------------------------------------
+
+#include "standardpch.h"
+#include "mczfile.h"
+#include "methodcontextreader.h"
+#include "logging.h"
+
+#include <zlib.h>
+
+// Raw deflate: the blobs don't need the zlib header and checksum, the tables already describe them.
+static const int MczWindowBits = -15;
+
+MczFile::MczFile() : m_hFile(INVALID_HANDLE_VALUE), m_view(nullptr), m_fileSize(0), m_inflater(nullptr)
+{
+    memset(&m_header, 0, sizeof(m_header));
+}
+
+MczFile::~MczFile()
+{
+    if (m_inflater != nullptr)
+    {
+        inflateEnd(m_inflater);
+        delete m_inflater;
+    }
+}
+
+// static
+bool MczFile::IsMczFile(HANDLE hFile)
+{
+    uint32_t magic     = 0;
+    DWORD    bytesRead = 0;
+    bool     isMcz     = (ReadFile(hFile, &magic, sizeof(magic), &bytesRead, NULL) == TRUE) &&
+                         (bytesRead == sizeof(magic)) && (magic == Magic);
+
+    int64_t pos = 0;
+    SetFilePointerEx(hFile, *(PLARGE_INTEGER)&pos, NULL, FILE_BEGIN);
+    return isMcz;
+}
+
+bool MczFile::ReadAt(int64_t offset, void* buffer, size_t size)
+{
+    if ((offset < 0) || (offset + (int64_t)size > m_fileSize))
+    {
+        return false;
+    }
+
+    if (m_view != nullptr)
+    {
+        memcpy(buffer, m_view + offset, size);
+        return true;
+    }
+
+    DWORD bytesRead = 0;
+    return (SetFilePointerEx(m_hFile, *(PLARGE_INTEGER)&offset, NULL, FILE_BEGIN) == TRUE) &&
+           (ReadFile(m_hFile, buffer, (DWORD)size, &bytesRead, NULL) == TRUE) && (bytesRead == size);
+}
+
+bool MczFile::Load(HANDLE hFile, const unsigned char* view, int64_t fileSize)
+{
+    m_hFile    = hFile;
+    m_view     = view;
+    m_fileSize = fileSize;
+
+    int64_t pos = 0;
+    if (!ReadAt(pos, &m_header, sizeof(m_header)) || (m_header.Magic != Magic))
+    {
+        LogError("Not an MCZ file");
+        return false;
+    }
+    if (m_header.Version != Version)
+    {
+        LogError("Unsupported MCZ file version %u (expected %u)", m_header.Version, Version);
+        return false;
+    }
+    pos += sizeof(m_header);
+
+    m_dictionary.resize(m_header.DictionarySize);
+    m_blobs.resize(m_header.BlobCount);
+    m_contextBlobs.resize(m_header.ContextCount);
+
+    int64_t blobsPos        = pos + m_dictionary.size();
+    int64_t contextBlobsPos = blobsPos + m_blobs.size() * sizeof(MczBlob);
+    if (!ReadAt(pos, m_dictionary.data(), m_dictionary.size()) ||
+        !ReadAt(blobsPos, m_blobs.data(), m_blobs.size() * sizeof(MczBlob)) ||
+        !ReadAt(contextBlobsPos, m_contextBlobs.data(), m_contextBlobs.size() * sizeof(uint32_t)))
+    {
+        LogError("Truncated MCZ file");
+        return false;
+    }
+
+    for (uint32_t blob : m_contextBlobs)
+    {
+        if (blob >= m_header.BlobCount)
+        {
+            LogError("Corrupt MCZ file: invalid blob index %u", blob);
+            return false;
+        }
+    }
+
+    m_inflater = new z_stream();
+    memset(m_inflater, 0, sizeof(z_stream));
+    if (inflateInit2(m_inflater, MczWindowBits) != Z_OK)
+    {
+        LogError("inflateInit2 failed");
+        delete m_inflater;
+        m_inflater = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+unsigned char* MczFile::ReadMethodContext(unsigned int number, DWORD* size)
+{
+    if ((number == 0) || (number > m_header.ContextCount) || (m_inflater == nullptr))
+    {
+        return nullptr;
+    }
+
+    const MczBlob& blob = m_blobs[m_contextBlobs[number - 1]];
+
+    const unsigned char* compressed;
+    if (m_view != nullptr)
+    {
+        if (blob.Offset + blob.CompressedSize > (uint64_t)m_fileSize)
+        {
+            LogError("Corrupt MCZ file: method context %u is out of bounds", number);
+            return nullptr;
+        }
+        compressed = m_view + blob.Offset;
+    }
+    else
+    {
+        m_compressed.resize(blob.CompressedSize);
+        if (!ReadAt((int64_t)blob.Offset, m_compressed.data(), blob.CompressedSize))
+        {
+            LogError("Failed to read method context %u. GetLastError()=%u", number, GetLastError());
+            return nullptr;
+        }
+        compressed = m_compressed.data();
+    }
+
+    unsigned char* buff = new unsigned char[blob.Size + 2];
+
+    // Resetting drops the dictionary along with the window, so it has to be set for every blob.
+    inflateReset(m_inflater);
+    if (!m_dictionary.empty())
+    {
+        inflateSetDictionary(m_inflater, m_dictionary.data(), (uInt)m_dictionary.size());
+    }
+
+    m_inflater->next_in   = (Bytef*)compressed;
+    m_inflater->avail_in  = blob.CompressedSize;
+    m_inflater->next_out  = buff;
+    m_inflater->avail_out = blob.Size;
+
+    if ((inflate(m_inflater, Z_FINISH) != Z_STREAM_END) || (m_inflater->total_out != blob.Size))
+    {
+        LogError("Failed to decompress method context %u", number);
+        delete[] buff;
+        return nullptr;
+    }
+
+    buff[blob.Size]     = '4';
+    buff[blob.Size + 1] = '2';
+
+    *size = blob.Size;
+    return buff;
+}
+
+// Build a preset dictionary out of the byte sequences that the most samples have in common. The
+// samples are cut into short segments, and every segment is scored by the number of samples it
+// occurs in. The best ones make up the dictionary, with the most common at the end, where deflate
+// reaches them with the shortest distances.
+//
+// static
+std::vector<unsigned char> MczFile::TrainDictionary(const std::vector<std::vector<unsigned char>>& samples)
+{
+    const size_t SegmentSize = 16;
+    const size_t SegmentStep = 8;
+
+    struct Segment
+    {
+        uint32_t             Count;
+        uint32_t             LastSample;
+        const unsigned char* Data;
+    };
+
+    std::unordered_map<uint64_t, Segment> segments;
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        const std::vector<unsigned char>& sample = samples[i];
+        for (size_t offset = 0; offset + SegmentSize <= sample.size(); offset += SegmentStep)
+        {
+            uint64_t lo, hi;
+            memcpy(&lo, &sample[offset], sizeof(lo));
+            memcpy(&hi, &sample[offset + sizeof(lo)], sizeof(hi));
+            uint64_t key = (lo * 0x9e3779b97f4a7c15ULL) ^ (hi + 0x632be59bd9b4e019ULL + (lo << 6) + (lo >> 2));
+
+            Segment& segment = segments[key];
+            if (segment.Count == 0)
+            {
+                segment.Count      = 1;
+                segment.LastSample = (uint32_t)i;
+                segment.Data       = &sample[offset];
+            }
+            else if (segment.LastSample != (uint32_t)i)
+            {
+                segment.Count++;
+                segment.LastSample = (uint32_t)i;
+            }
+        }
+    }
+
+    std::vector<const Segment*> common;
+    for (const auto& entry : segments)
+    {
+        if (entry.second.Count > 1)
+        {
+            common.push_back(&entry.second);
+        }
+    }
+    std::sort(common.begin(), common.end(), [](const Segment* a, const Segment* b) { return a->Count > b->Count; });
+    if (common.size() > MaxDictionarySize / SegmentSize)
+    {
+        common.resize(MaxDictionarySize / SegmentSize);
+    }
+
+    std::vector<unsigned char> dictionary;
+    dictionary.reserve(common.size() * SegmentSize);
+    for (auto it = common.rbegin(); it != common.rend(); ++it)
+    {
+        dictionary.insert(dictionary.end(), (*it)->Data, (*it)->Data + SegmentSize);
+    }
+    return dictionary;
+}
+
+// static
+bool MczFile::Compress(const char* inputFileName, const char* outputFileName)
+{
+    // The dictionary is trained on the start of up to SampleBudget / SampleSize distinct method
+    // contexts, which is where most of the map headers and common signatures are.
+    const size_t SampleSize   = 4 * 1024;
+    const size_t SampleBudget = 8 * 1024 * 1024;
+
+    MethodContextReader reader(inputFileName);
+    if (!reader.isValid())
+    {
+        return false;
+    }
+
+    // First pass: find the distinct method contexts and collect the dictionary samples.
+    MczHeader header;
+    memset(&header, 0, sizeof(header));
+    header.Magic   = Magic;
+    header.Version = Version;
+
+    std::unordered_map<std::string, uint32_t> blobsByHash;
+    std::vector<MczBlob>                      blobs;
+    std::vector<uint32_t>                     contextBlobs;
+    std::vector<std::vector<unsigned char>>   samples;
+    size_t                                    sampleBytes = 0;
+
+    while (true)
+    {
+        MethodContextBuffer mcb = reader.GetNextMethodContext();
+        if (mcb.Error())
+        {
+            return false;
+        }
+        if (mcb.allDone())
+        {
+            break;
+        }
+
+        char hash[MM3_HASH_BUFFER_SIZE];
+        Hash::HashBuffer(mcb.buff, mcb.size, hash, MM3_HASH_BUFFER_SIZE);
+
+        auto it = blobsByHash.find(hash);
+        if (it != blobsByHash.end())
+        {
+            contextBlobs.push_back(it->second);
+        }
+        else
+        {
+            MczBlob blob;
+            memset(&blob, 0, sizeof(blob));
+            blob.Size = mcb.size;
+            memcpy(blob.Hash, hash, sizeof(blob.Hash));
+
+            blobsByHash.insert({hash, (uint32_t)blobs.size()});
+            contextBlobs.push_back((uint32_t)blobs.size());
+            blobs.push_back(blob);
+
+            if (sampleBytes < SampleBudget)
+            {
+                size_t len = min((size_t)mcb.size, SampleSize);
+                samples.emplace_back(mcb.buff, mcb.buff + len);
+                sampleBytes += len;
+            }
+        }
+
+        if (!mcb.mapped)
+        {
+            delete[] mcb.buff;
+        }
+    }
+
+    std::vector<unsigned char> dictionary = TrainDictionary(samples);
+    samples.clear();
+
+    header.ContextCount   = (uint32_t)contextBlobs.size();
+    header.BlobCount      = (uint32_t)blobs.size();
+    header.DictionarySize = (uint32_t)dictionary.size();
+
+    LogVerbose("Compressing %u method contexts, %u distinct, with a %u byte dictionary", header.ContextCount,
+               header.BlobCount, header.DictionarySize);
+
+    HANDLE hFileOut = CreateFileA(outputFileName, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (hFileOut == INVALID_HANDLE_VALUE)
+    {
+        LogError("Failed to open output '%s'. GetLastError()=%u", outputFileName, GetLastError());
+        return false;
+    }
+
+    z_stream deflater;
+    memset(&deflater, 0, sizeof(deflater));
+    if (deflateInit2(&deflater, Z_BEST_COMPRESSION, Z_DEFLATED, MczWindowBits, 9, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        LogError("deflateInit2 failed");
+        CloseHandle(hFileOut);
+        return false;
+    }
+
+    // Second pass: write the blobs after the tables, in the order they first occur, then go back
+    // and write the header and tables now that the blob offsets are known.
+    int64_t offset = sizeof(header) + dictionary.size() + blobs.size() * sizeof(MczBlob) +
+                     contextBlobs.size() * sizeof(uint32_t);
+    bool success = SetFilePointerEx(hFileOut, *(PLARGE_INTEGER)&offset, NULL, FILE_BEGIN) == TRUE;
+
+    std::vector<bool>          written(blobs.size(), false);
+    std::vector<unsigned char> compressed;
+    DWORD                      bytesWritten;
+
+    reader.Reset(nullptr, -1);
+    for (size_t i = 0; success && (i < contextBlobs.size()); i++)
+    {
+        MethodContextBuffer mcb = reader.GetNextMethodContext();
+        if (mcb.Error() || mcb.allDone())
+        {
+            LogError("Failed to read method context %u the second time", (unsigned)(i + 1));
+            success = false;
+            break;
+        }
+
+        uint32_t index = contextBlobs[i];
+        if (!written[index])
+        {
+            MczBlob& blob = blobs[index];
+            compressed.resize(deflateBound(&deflater, mcb.size));
+
+            deflateReset(&deflater);
+            if (!dictionary.empty())
+            {
+                deflateSetDictionary(&deflater, dictionary.data(), (uInt)dictionary.size());
+            }
+
+            deflater.next_in   = mcb.buff;
+            deflater.avail_in  = mcb.size;
+            deflater.next_out  = compressed.data();
+            deflater.avail_out = (uInt)compressed.size();
+
+            if (deflate(&deflater, Z_FINISH) != Z_STREAM_END)
+            {
+                LogError("Failed to compress method context %u", (unsigned)(i + 1));
+                success = false;
+            }
+            else
+            {
+                blob.Offset         = (uint64_t)offset;
+                blob.CompressedSize = (uint32_t)deflater.total_out;
+                success = (WriteFile(hFileOut, compressed.data(), blob.CompressedSize, &bytesWritten, NULL) == TRUE) &&
+                          (bytesWritten == blob.CompressedSize);
+                offset += blob.CompressedSize;
+                written[index] = true;
+            }
+        }
+
+        if (!mcb.mapped)
+        {
+            delete[] mcb.buff;
+        }
+    }
+
+    deflateEnd(&deflater);
+
+    int64_t start = 0;
+    success = success && (SetFilePointerEx(hFileOut, *(PLARGE_INTEGER)&start, NULL, FILE_BEGIN) == TRUE) &&
+              (WriteFile(hFileOut, &header, sizeof(header), &bytesWritten, NULL) == TRUE) &&
+              (dictionary.empty() ||
+               (WriteFile(hFileOut, dictionary.data(), (DWORD)dictionary.size(), &bytesWritten, NULL) == TRUE)) &&
+              (blobs.empty() ||
+               (WriteFile(hFileOut, blobs.data(), (DWORD)(blobs.size() * sizeof(MczBlob)), &bytesWritten, NULL) ==
+                TRUE)) &&
+              (contextBlobs.empty() || (WriteFile(hFileOut, contextBlobs.data(),
+                                                  (DWORD)(contextBlobs.size() * sizeof(uint32_t)), &bytesWritten,
+                                                  NULL) == TRUE));
+
+    if (!success)
+    {
+        LogError("Failed to write '%s'. GetLastError()=%u", outputFileName, GetLastError());
+    }
+
+    if (CloseHandle(hFileOut) == 0)
+    {
+        LogError("CloseHandle failed. GetLastError()=%u", GetLastError());
+        return false;
+    }
+
+    return success;
+}
+
+// static
+bool MczFile::Decompress(const char* inputFileName, const char* outputFileName)
+{
+    HANDLE hFileIn = CreateFileA(inputFileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFileIn == INVALID_HANDLE_VALUE)
+    {
+        LogError("Failed to open input '%s'. GetLastError()=%u", inputFileName, GetLastError());
+        return false;
+    }
+
+    int64_t fileSize = 0;
+    GetFileSizeEx(hFileIn, (PLARGE_INTEGER)&fileSize);
+
+    MczFile mcz;
+    if (!IsMczFile(hFileIn) || !mcz.Load(hFileIn, nullptr, fileSize))
+    {
+        LogError("'%s' is not a valid MCZ file", inputFileName);
+        CloseHandle(hFileIn);
+        return false;
+    }
+
+    HANDLE hFileOut = CreateFileA(outputFileName, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (hFileOut == INVALID_HANDLE_VALUE)
+    {
+        LogError("Failed to open output '%s'. GetLastError()=%u", outputFileName, GetLastError());
+        CloseHandle(hFileIn);
+        return false;
+    }
+
+    bool success = true;
+    for (unsigned int number = 1; success && (number <= mcz.GetContextCount()); number++)
+    {
+        DWORD          size;
+        unsigned char* buff = mcz.ReadMethodContext(number, &size);
+        if (buff == nullptr)
+        {
+            success = false;
+            break;
+        }
+
+        // Same framing as MethodContext::saveToFile; buff already ends with the canary.
+        unsigned char prefix[2 + sizeof(unsigned int)] = {'m', 'c'};
+        memcpy(&prefix[2], &size, sizeof(unsigned int));
+
+        DWORD bytesWritten;
+        success = (WriteFile(hFileOut, prefix, sizeof(prefix), &bytesWritten, NULL) == TRUE) &&
+                  (WriteFile(hFileOut, buff, size + 2, &bytesWritten, NULL) == TRUE) && (bytesWritten == size + 2);
+        delete[] buff;
+    }
+
+    if (!success)
+    {
+        LogError("Failed to write '%s'. GetLastError()=%u", outputFileName, GetLastError());
+    }
+
+    CloseHandle(hFileIn);
+    if (CloseHandle(hFileOut) == 0)
+    {
+        LogError("CloseHandle failed. GetLastError()=%u", GetLastError());
+        return false;
+    }
+
+    return success;
+}
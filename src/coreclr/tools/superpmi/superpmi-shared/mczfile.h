@@ -0,0 +1,99 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//----------------------------------------------------------
+// MczFile.h - Compressed, content-addressed method context collections
+//----------------------------------------------------------
+#ifndef _MczFile
+#define _MczFile
+
+#include "hash.h"
+
+// An MCZ file holds the same method contexts as the MCH file it was made from, with the same
+// numbering, but stores each distinct method context only once, deflated with a preset dictionary
+// that is shared by the whole file:
+//
+//   MczHeader
+//   the dictionary: DictionarySize bytes
+//   MczBlob[BlobCount]: the distinct method contexts, identified by the hash of their contents
+//   uint32_t[ContextCount]: the index of the blob that holds each method context
+//   the compressed blobs
+//
+// MethodContextReader and MethodContextIterator read MCZ files transparently, and the tables
+// give random access to any method context, so no TOC is needed. "mcs -compress" and
+// "mcs -decompress" convert between the two formats.
+struct MczHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t ContextCount;
+    uint32_t BlobCount;
+    uint32_t DictionarySize;
+    uint32_t Reserved;
+};
+
+struct MczBlob
+{
+    uint64_t Offset;         // Of the compressed data, from the start of the file
+    uint32_t CompressedSize;
+    uint32_t Size;           // Of the method context data, excluding the header and end canary
+    char     Hash[MM3_HASH_BUFFER_SIZE - 1]; // Of the method context data, not null terminated
+};
+
+struct z_stream_s;
+
+class MczFile
+{
+public:
+    static const uint32_t Magic   = 0x315a434d; // "MCZ1"
+    static const uint32_t Version = 1;
+
+    // The largest useful preset dictionary is the deflate window.
+    static const uint32_t MaxDictionarySize = 32 * 1024;
+
+    MczFile();
+    ~MczFile();
+
+    // Does hFile start with an MCZ header? Leaves the file pointer at the start of the file.
+    static bool IsMczFile(HANDLE hFile);
+
+    // Load the dictionary and tables of an MCZ file. If view is not null, it maps the whole file and
+    // the compressed data is read from it; otherwise it is read through hFile, and the caller must
+    // not rely on the file pointer.
+    bool Load(HANDLE hFile, const unsigned char* view, int64_t fileSize);
+
+    unsigned int GetContextCount()
+    {
+        return m_header.ContextCount;
+    }
+
+    // Decompress method context #number (1-based) into a new[] allocated buffer that, like a
+    // buffer read from an MCH file, is followed by the 2 byte end canary. Returns nullptr on failure.
+    unsigned char* ReadMethodContext(unsigned int number, DWORD* size);
+
+    // Write the method contexts of an MCH (or MCZ) file to a new MCZ file.
+    static bool Compress(const char* inputFileName, const char* outputFileName);
+
+    // Write the method contexts of an MCZ file to a new MCH file.
+    static bool Decompress(const char* inputFileName, const char* outputFileName);
+
+private:
+    HANDLE               m_hFile;
+    const unsigned char* m_view;
+    int64_t              m_fileSize;
+
+    MczHeader                  m_header;
+    std::vector<unsigned char> m_dictionary;
+    std::vector<MczBlob>       m_blobs;
+    std::vector<uint32_t>      m_contextBlobs;
+
+    // Reused across method contexts to save setting up the inflater and reading buffer each time.
+    z_stream_s*                m_inflater;
+    std::vector<unsigned char> m_compressed;
+
+    bool ReadAt(int64_t offset, void* buffer, size_t size);
+
+    static std::vector<unsigned char> TrainDictionary(const std::vector<std::vector<unsigned char>>& samples);
+};
+
+#endif
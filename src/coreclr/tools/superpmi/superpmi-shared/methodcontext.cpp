@@ -86,7 +86,7 @@ void MethodContext::Destroy()
     case Packet_##target:                                                                                              \
     {                                                                                                                  \
         target = new LightWeightMap<key, value>();                                                                     \
-        target->ReadFromArray(&buff2[buffIndex], localsize);                                                           \
+        target->ReadFromArray(&buff2[buffIndex], localsize, mapped);                                                   \
         break;                                                                                                         \
     }
 
@@ -94,7 +94,7 @@ void MethodContext::Destroy()
     case PacketCR_##target:                                                                                            \
     {                                                                                                                  \
         cr->target = new LightWeightMap<key, value>();                                                                 \
-        cr->target->ReadFromArray(&buff2[buffIndex], localsize);                                                       \
+        cr->target->ReadFromArray(&buff2[buffIndex], localsize, mapped);                                               \
         break;                                                                                                         \
     }
 
@@ -102,7 +102,7 @@ void MethodContext::Destroy()
     case Packet_##target:                                                                                              \
     {                                                                                                                  \
         target = new DenseLightWeightMap<value>();                                                                     \
-        target->ReadFromArray(&buff2[buffIndex], localsize);                                                           \
+        target->ReadFromArray(&buff2[buffIndex], localsize, mapped);                                                   \
         break;                                                                                                         \
     }
 
@@ -110,7 +110,7 @@ void MethodContext::Destroy()
     case PacketCR_##target:                                                                                            \
     {                                                                                                                  \
         cr->target = new DenseLightWeightMap<value>();                                                                 \
-        cr->target->ReadFromArray(&buff2[buffIndex], localsize);                                                       \
+        cr->target->ReadFromArray(&buff2[buffIndex], localsize, mapped);                                               \
         break;                                                                                                         \
     }
 
@@ -174,12 +174,12 @@ unsigned int MethodContext::saveToFile(HANDLE hFile)
 // (and sets *ppmc with new MethodContext), false on failure.
 //
 // static
-bool MethodContext::Initialize(int mcIndex, unsigned char* buff, DWORD size, /* OUT */ MethodContext** ppmc)
+bool MethodContext::Initialize(int mcIndex, unsigned char* buff, DWORD size, /* OUT */ MethodContext** ppmc, bool mapped)
 {
     MethodContext* mc = new MethodContext();
     mc->index         = mcIndex;
     *ppmc             = mc;
-    return mc->Initialize(mcIndex, buff, size);
+    return mc->Initialize(mcIndex, buff, size, mapped);
 }
 
 // static
@@ -191,7 +191,7 @@ bool MethodContext::Initialize(int mcIndex, HANDLE hFile, /* OUT */ MethodContex
     return mc->Initialize(mcIndex, hFile);
 }
 
-bool MethodContext::Initialize(int mcIndex, unsigned char* buff, DWORD size)
+bool MethodContext::Initialize(int mcIndex, unsigned char* buff, DWORD size, bool mapped)
 {
     bool result = true;
 
@@ -199,15 +199,17 @@ bool MethodContext::Initialize(int mcIndex, unsigned char* buff, DWORD size)
     {
         unsigned char* buff;
         DWORD          size;
+        bool           mapped;
         MethodContext* pThis;
     } param;
-    param.buff  = buff;
-    param.size  = size;
-    param.pThis = this;
+    param.buff   = buff;
+    param.size   = size;
+    param.mapped = mapped;
+    param.pThis  = this;
 
     PAL_TRY(Param*, pParam, &param)
     {
-        pParam->pThis->MethodInitHelper(pParam->buff, pParam->size);
+        pParam->pThis->MethodInitHelper(pParam->buff, pParam->size, pParam->mapped);
     }
     PAL_EXCEPT_FILTER(FilterSuperPMIExceptions_CatchMC)
     {
@@ -258,10 +260,10 @@ void MethodContext::MethodInitHelperFile(HANDLE hFile)
     unsigned char* buff2 = new unsigned char[totalLen + 2]; // total + End Canary
     AssertCode(ReadFile(hFile, buff2, totalLen + 2, &bytesRead, NULL) == TRUE, EXCEPTIONCODE_MC);
     AssertCodeMsg((buff2[totalLen] == '4') && (buff2[totalLen + 1] == '2'), EXCEPTIONCODE_MC, "Didn't find end canary");
-    MethodInitHelper(buff2, totalLen);
+    MethodInitHelper(buff2, totalLen, false);
 }
 
-void MethodContext::MethodInitHelper(unsigned char* buff2, unsigned int totalLen)
+void MethodContext::MethodInitHelper(unsigned char* buff2, unsigned int totalLen, bool mapped)
 {
     unsigned int   buffIndex = 0;
     unsigned int   localsize = 0;
@@ -297,7 +299,8 @@ void MethodContext::MethodInitHelper(unsigned char* buff2, unsigned int totalLen
     }
     AssertCodeMsg((buff2[buffIndex++] == '4') && (buff2[buffIndex++] == '2'), EXCEPTIONCODE_MC,
                   "Didn't find trailing canary for map");
-    delete[] buff2;
+    if (!mapped)
+        delete[] buff2;
 }
 
 #define dumpStat(target)                                                                                               \
@@ -3659,6 +3662,8 @@ void MethodContext::recGetThreadLocalStaticBlocksInfo(CORINFO_THREAD_STATIC_BLOC
     value.offsetOfMaxThreadStaticBlocks         = pInfo->offsetOfMaxThreadStaticBlocks;
     value.offsetOfThreadStaticBlocks            = pInfo->offsetOfThreadStaticBlocks;
     value.offsetOfBaseOfThreadLocalData         = pInfo->offsetOfBaseOfThreadLocalData;
+    value.offsetOfMaxCollectibleThreadStaticBlocks = pInfo->offsetOfMaxCollectibleThreadStaticBlocks;
+    value.offsetOfCollectibleThreadStaticBlocks    = pInfo->offsetOfCollectibleThreadStaticBlocks;
 
     // This data is same for entire process, so just add it against key '0'.
     DWORD key = 0;
@@ -3674,10 +3679,13 @@ void MethodContext::dmpGetThreadLocalStaticBlocksInfo(DWORD key, const Agnostic_
            ", offsetOfThreadLocalStoragePointer-%u"
            ", offsetOfMaxThreadStaticBlocks-%u"
            ", offsetOfThreadStaticBlocks-%u"
-           ", offsetOfBaseOfThreadLocalData-%u",
+           ", offsetOfBaseOfThreadLocalData-%u"
+           ", offsetOfMaxCollectibleThreadStaticBlocks-%u"
+           ", offsetOfCollectibleThreadStaticBlocks-%u",
            key, SpmiDumpHelper::DumpAgnostic_CORINFO_CONST_LOOKUP(value.tlsIndex).c_str(), value.tlsGetAddrFtnPtr,
            value.tlsIndexObject, value.threadVarsSection, value.offsetOfThreadLocalStoragePointer,
-           value.offsetOfMaxThreadStaticBlocks, value.offsetOfThreadStaticBlocks, value.offsetOfBaseOfThreadLocalData);
+           value.offsetOfMaxThreadStaticBlocks, value.offsetOfThreadStaticBlocks, value.offsetOfBaseOfThreadLocalData,
+           value.offsetOfMaxCollectibleThreadStaticBlocks, value.offsetOfCollectibleThreadStaticBlocks);
 }
 
 void MethodContext::repGetThreadLocalStaticBlocksInfo(CORINFO_THREAD_STATIC_BLOCKS_INFO* pInfo)
@@ -3695,6 +3703,8 @@ void MethodContext::repGetThreadLocalStaticBlocksInfo(CORINFO_THREAD_STATIC_BLOC
     pInfo->offsetOfMaxThreadStaticBlocks        = value.offsetOfMaxThreadStaticBlocks;
     pInfo->offsetOfThreadStaticBlocks           = value.offsetOfThreadStaticBlocks;
     pInfo->offsetOfBaseOfThreadLocalData        = value.offsetOfBaseOfThreadLocalData;
+    pInfo->offsetOfMaxCollectibleThreadStaticBlocks = value.offsetOfMaxCollectibleThreadStaticBlocks;
+    pInfo->offsetOfCollectibleThreadStaticBlocks    = value.offsetOfCollectibleThreadStaticBlocks;
 }
 
 void MethodContext::recGetThreadLocalStaticInfo_NativeAOT(CORINFO_THREAD_STATIC_INFO_NATIVEAOT* pInfo)
@@ -67,16 +67,18 @@ public:
     MethodContext();
 
 private:
-    void MethodInitHelper(unsigned char* buff, unsigned int totalLen);
+    void MethodInitHelper(unsigned char* buff, unsigned int totalLen, bool mapped);
     void MethodInitHelperFile(HANDLE hFile);
 
-    bool Initialize(int mcIndex, unsigned char* buff, DWORD size);
+    bool Initialize(int mcIndex, unsigned char* buff, DWORD size, bool mapped);
     bool Initialize(int mcIndex, HANDLE hFile);
 
     int dumpHashToBuffer(BYTE* pBuffer, int bufLen, char* buff, int len);
 
 public:
-    static bool Initialize(int mcIndex, unsigned char* buff, DWORD size, /* OUT */ MethodContext** ppmc);
+    // If mapped is true, buff points into a file mapping that outlives the MethodContext; the maps are
+    // then decoded in place instead of being copied, and buff is not freed.
+    static bool Initialize(int mcIndex, unsigned char* buff, DWORD size, /* OUT */ MethodContext** ppmc, bool mapped = false);
     static bool Initialize(int mcIndex, HANDLE hFile, /* OUT */ MethodContext** ppmc);
     ~MethodContext();
     void Destroy();
@@ -26,6 +26,18 @@ bool MethodContextIterator::Initialize(const char* fileName)
 
     m_fileSize = DataTemp.QuadPart;
 
+    if (MczFile::IsMczFile(m_hFile))
+    {
+        m_mcz = new MczFile();
+        if (!m_mcz->Load(m_hFile, nullptr, m_fileSize))
+        {
+            LogError("Failed to load compressed method context file '%s'", fileName);
+            CloseHandle(m_hFile);
+            m_hFile = INVALID_HANDLE_VALUE;
+            return false;
+        }
+    }
+
     if (m_progressReport)
     {
         m_timer->Start();
@@ -49,6 +61,9 @@ bool MethodContextIterator::Destroy()
     delete m_mc;
     m_mc = nullptr;
 
+    delete m_mcz;
+    m_mcz = nullptr;
+
     if (m_index < m_indexCount)
     {
         LogWarning("Didn't use all of index count input: %d < %d (i.e., didn't see MC #%d)", m_index, m_indexCount,
@@ -71,18 +86,29 @@ bool MethodContextIterator::MoveNext()
 
     while (true)
     {
-        // Figure out where the pointer is currently.
-        LARGE_INTEGER pos;
-        pos.QuadPart = 0;
-        if (SetFilePointerEx(m_hFile, pos, &m_pos, FILE_CURRENT) == 0)
+        if (m_mcz != nullptr)
         {
-            LogError("SetFilePointerEx failed. GetLastError()=%u", GetLastError());
-            return false; // any failure causes us to bail out.
+            m_pos.QuadPart = 0;
+            if (m_methodContextNumber >= (int)m_mcz->GetContextCount())
+            {
+                return false;
+            }
         }
-
-        if (m_pos.QuadPart >= m_fileSize)
+        else
         {
-            return false;
+            // Figure out where the pointer is currently.
+            LARGE_INTEGER pos;
+            pos.QuadPart = 0;
+            if (SetFilePointerEx(m_hFile, pos, &m_pos, FILE_CURRENT) == 0)
+            {
+                LogError("SetFilePointerEx failed. GetLastError()=%u", GetLastError());
+                return false; // any failure causes us to bail out.
+            }
+
+            if (m_pos.QuadPart >= m_fileSize)
+            {
+                return false;
+            }
         }
 
         // Load the current method context.
@@ -99,7 +125,7 @@ bool MethodContextIterator::MoveNext()
             }
         }
 
-        if (!MethodContext::Initialize(m_methodContextNumber, m_hFile, &m_mc))
+        if (!LoadNext())
             return false;
 
         // If we have an array of indexes, skip the loaded indexes that have not been specified.
@@ -124,3 +150,22 @@ bool MethodContextIterator::MoveNext()
 
     return true;
 }
+
+// Load method context number m_methodContextNumber into m_mc.
+bool MethodContextIterator::LoadNext()
+{
+    if (m_mcz == nullptr)
+    {
+        return MethodContext::Initialize(m_methodContextNumber, m_hFile, &m_mc);
+    }
+
+    DWORD          size = 0;
+    unsigned char* buff = m_mcz->ReadMethodContext(m_methodContextNumber, &size);
+    if (buff == nullptr)
+    {
+        return false;
+    }
+
+    // The MethodContext takes ownership of buff.
+    return MethodContext::Initialize(m_methodContextNumber, buff, size, &m_mc);
+}
@@ -2,6 +2,7 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "simpletimer.h"
+#include "mczfile.h"
 
 // Class to implement method context hive reading and iterating.
 
@@ -13,6 +14,7 @@ public:
         , m_fileSize(0)
         , m_methodContextNumber(0)
         , m_mc(nullptr)
+        , m_mcz(nullptr)
         , m_indexCount(-1)
         , m_index(0)
         , m_indexes(nullptr)
@@ -31,6 +33,7 @@ public:
         , m_fileSize(0)
         , m_methodContextNumber(0)
         , m_mc(nullptr)
+        , m_mcz(nullptr)
         , m_indexCount(indexCount)
         , m_index(0)
         , m_indexes(indexes)
@@ -70,7 +73,7 @@ public:
         return ret;
     }
 
-    // Return the file position offset of the current method context.
+    // Return the file position offset of the current method context. Meaningless for an MCZ file.
     int64_t CurrentPos()
     {
         return m_pos.QuadPart;
@@ -81,6 +84,11 @@ public:
         return m_methodContextNumber;
     }
 
+    bool IsCompressed()
+    {
+        return m_mcz != nullptr;
+    }
+
 private:
     HANDLE         m_hFile;
     int64_t        m_fileSize;
@@ -88,6 +96,11 @@ private:
     MethodContext* m_mc;
     LARGE_INTEGER  m_pos;
 
+    // Set if the file is a compressed MCZ file, see MczFile.
+    MczFile* m_mcz;
+
+    bool LoadNext();
+
     // If m_indexCount==-1, use all method contexts. Otherwise, m_indexCount is the number of elements in the
     // m_indexes array, which contains a sorted set of method context indexes to return. In this case, m_index
     // is the index of the current element in m_indexes.
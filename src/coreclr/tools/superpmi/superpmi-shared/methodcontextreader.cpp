@@ -70,6 +70,14 @@ MethodContextReader::MethodContextReader(
     const char* inputFileName, const int* indexes, int indexCount, char* hash, int offset, int increment)
     : fileHandle(INVALID_HANDLE_VALUE)
     , fileSize(0)
+    , fileMapping(nullptr)
+    , fileView(nullptr)
+    , filePos(0)
+    , prefetchThread(nullptr)
+    , prefetchEvent(nullptr)
+    , prefetchShutdown(false)
+    , prefetchPos(0)
+    , mczFile(nullptr)
     , curMCIndex(0)
     , Indexes(indexes)
     , IndexCount(indexCount)
@@ -78,6 +86,11 @@ MethodContextReader::MethodContextReader(
     , curTOCIndex(0)
     , Offset(offset)
     , Increment(increment)
+    , workQueueFile(INVALID_HANDLE_VALUE)
+    , workQueueMapping(nullptr)
+    , workQueue(nullptr)
+    , curChunkPos(0)
+    , curChunkEnd(0)
 {
     this->mutex = CreateMutexW(NULL, FALSE, nullptr);
 
@@ -113,6 +126,25 @@ MethodContextReader::MethodContextReader(
     if (this->fileHandle != INVALID_HANDLE_VALUE)
     {
         GetFileSizeEx(this->fileHandle, (PLARGE_INTEGER) & this->fileSize);
+
+        MapFile();
+
+        if (MczFile::IsMczFile(this->fileHandle))
+        {
+            this->mczFile = new MczFile();
+            if (!this->mczFile->Load(this->fileHandle, this->fileView, this->fileSize))
+            {
+                LogError("Failed to load compressed method context file '%s'", mchFileName.c_str());
+                CloseHandle(this->fileHandle);
+                this->fileHandle = INVALID_HANDLE_VALUE;
+            }
+        }
+        // With both a TOC and an index we jump straight to the requested methods, so there is
+        // nothing to read ahead. The blobs of an MCZ file aren't read in file order.
+        else if ((this->fileView != nullptr) && !(this->hasTOC() && this->hasIndex()))
+        {
+            StartPrefetch();
+        }
     }
 
     ReadExcludedMethods(mchFileName);
@@ -120,6 +152,35 @@ MethodContextReader::MethodContextReader(
 
 MethodContextReader::~MethodContextReader()
 {
+    StopPrefetch();
+
+    delete this->mczFile;
+
+    if (workQueue != nullptr)
+    {
+        UnmapViewOfFile(this->workQueue);
+    }
+
+    if (workQueueMapping != nullptr)
+    {
+        CloseHandle(this->workQueueMapping);
+    }
+
+    if (workQueueFile != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(this->workQueueFile);
+    }
+
+    if (fileView != nullptr)
+    {
+        UnmapViewOfFile(this->fileView);
+    }
+
+    if (fileMapping != nullptr)
+    {
+        CloseHandle(this->fileMapping);
+    }
+
     if (fileHandle != INVALID_HANDLE_VALUE)
     {
         CloseHandle(this->fileHandle);
@@ -141,12 +202,142 @@ void MethodContextReader::ReleaseLock()
     ReleaseMutex(this->mutex);
 }
 
-bool MethodContextReader::atEof()
+// Map the whole file so method contexts can be decoded straight from the view. The mapping is
+// copy-on-write since the LightWeightMaps decoded in place may be updated during replay. Only done
+// on 64-bit hosts, where even the largest collections fit in the address space.
+void MethodContextReader::MapFile()
+{
+#ifdef HOST_64BIT
+    if (this->fileSize == 0)
+    {
+        return;
+    }
+
+    this->fileMapping = CreateFileMappingW(this->fileHandle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    if (this->fileMapping == nullptr)
+    {
+        LogDebug("Failed to map the method context file, reading it instead. GetLastError()=%u", GetLastError());
+        return;
+    }
+
+    this->fileView = (unsigned char*)MapViewOfFile(this->fileMapping, FILE_MAP_COPY, 0, 0, 0);
+    if (this->fileView == nullptr)
+    {
+        LogDebug("Failed to map a view of the method context file, reading it instead. GetLastError()=%u",
+                 GetLastError());
+        CloseHandle(this->fileMapping);
+        this->fileMapping = nullptr;
+    }
+#endif // HOST_64BIT
+}
+
+// Touch every page from prefetchPos up to PrefetchWindow bytes past the reader's position, then
+// sleep until the reader has consumed half of that.
+DWORD WINAPI MethodContextReader::PrefetchThreadProc(LPVOID param)
+{
+    MethodContextReader* pThis    = (MethodContextReader*)param;
+    const int64_t        pageSize = 0x1000;
+    volatile unsigned char sink   = 0;
+
+    while (!pThis->prefetchShutdown && (pThis->prefetchPos < pThis->fileSize))
+    {
+        int64_t target = min(pThis->filePos + PrefetchWindow, pThis->fileSize);
+        for (int64_t pos = pThis->prefetchPos; (pos < target) && !pThis->prefetchShutdown; pos += pageSize)
+        {
+            sink = pThis->fileView[pos];
+            pThis->prefetchPos = pos + pageSize;
+        }
+
+        if (pThis->prefetchPos < pThis->fileSize)
+        {
+            WaitForSingleObject(pThis->prefetchEvent, INFINITE);
+        }
+    }
+
+    (void)sink;
+    return 0;
+}
+
+void MethodContextReader::StartPrefetch()
+{
+    this->prefetchEvent = CreateEventW(NULL, FALSE, FALSE, NULL);
+    if (this->prefetchEvent == nullptr)
+    {
+        return;
+    }
+
+    this->prefetchThread = CreateThread(NULL, 0, PrefetchThreadProc, this, 0, NULL);
+    if (this->prefetchThread == nullptr)
+    {
+        LogDebug("Failed to start the method context prefetch thread. GetLastError()=%u", GetLastError());
+        CloseHandle(this->prefetchEvent);
+        this->prefetchEvent = nullptr;
+    }
+}
+
+void MethodContextReader::StopPrefetch()
+{
+    if (this->prefetchThread != nullptr)
+    {
+        this->prefetchShutdown = true;
+        SetEvent(this->prefetchEvent);
+        WaitForSingleObject(this->prefetchThread, INFINITE);
+        CloseHandle(this->prefetchThread);
+        this->prefetchThread = nullptr;
+    }
+
+    if (this->prefetchEvent != nullptr)
+    {
+        CloseHandle(this->prefetchEvent);
+        this->prefetchEvent = nullptr;
+    }
+}
+
+// Wake the prefetch thread once the reader gets within half a window of what has been touched.
+void MethodContextReader::SignalPrefetch()
+{
+    if ((this->prefetchThread != nullptr) && (this->filePos + PrefetchWindow / 2 > this->prefetchPos))
+    {
+        SetEvent(this->prefetchEvent);
+    }
+}
+
+int64_t MethodContextReader::GetFilePos()
 {
+    if (this->fileView != nullptr)
+    {
+        return this->filePos;
+    }
+
     int64_t pos = 0;
     SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos,
                      FILE_CURRENT); // LARGE_INTEGER is a crime against humanity
-    return pos == this->fileSize;
+    return pos;
+}
+
+bool MethodContextReader::SetFilePos(int64_t pos)
+{
+    if (this->fileView != nullptr)
+    {
+        if ((pos < 0) || (pos > this->fileSize))
+        {
+            return false;
+        }
+        this->filePos = pos;
+        SignalPrefetch();
+        return true;
+    }
+
+    return SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, NULL, FILE_BEGIN) == TRUE;
+}
+
+bool MethodContextReader::atEof()
+{
+    if (this->mczFile != nullptr)
+    {
+        return curMCIndex >= (int)this->mczFile->GetContextCount();
+    }
+    return GetFilePos() == this->fileSize;
 }
 
 MethodContextBuffer MethodContextReader::ReadMethodContextNoLock(bool justSkip)
@@ -158,6 +349,43 @@ MethodContextBuffer MethodContextReader::ReadMethodContextNoLock(bool justSkip)
     {
         return MethodContextBuffer();
     }
+    if (this->mczFile != nullptr)
+    {
+        // Increment curMCIndex as we read (or skipped) another MC
+        ++curMCIndex;
+
+        if (justSkip)
+        {
+            return MethodContextBuffer(0);
+        }
+
+        DWORD          size = 0;
+        unsigned char* buff = this->mczFile->ReadMethodContext(curMCIndex, &size);
+        AssertMsg(buff != nullptr, "Failed to decompress method context %d", curMCIndex);
+        return MethodContextBuffer(buff, size);
+    }
+    if (this->fileView != nullptr)
+    {
+        const int64_t headerLen = 2 + sizeof(unsigned int);
+        AssertMsg(this->filePos + headerLen <= this->fileSize, "Truncated method context header");
+
+        unsigned char* header = this->fileView + this->filePos;
+        AssertMsg((header[0] == 'm') && (header[1] == 'c'), "Didn't find magic number");
+        memcpy(&totalLen, &header[2], sizeof(unsigned int));
+        AssertMsg(this->filePos + headerLen + totalLen + 2 <= this->fileSize, "Truncated method context");
+
+        this->filePos += headerLen + totalLen + 2; // total + End Canary
+        SignalPrefetch();
+
+        // Increment curMCIndex as we read (or skipped) another MC
+        ++curMCIndex;
+
+        if (justSkip)
+        {
+            return MethodContextBuffer(0);
+        }
+        return MethodContextBuffer(header + headerLen, totalLen, true);
+    }
     Assert(ReadFile(this->fileHandle, buff, 2 + sizeof(unsigned int), &bytesRead, NULL) == TRUE);
     AssertMsg((buff[0] == 'm') && (buff[1] == 'c'), "Didn't find magic number");
     memcpy(&totalLen, &buff[2], sizeof(unsigned int));
@@ -243,6 +471,10 @@ MethodContextBuffer MethodContextReader::GetNextMethodContext()
 
 MethodContextBuffer MethodContextReader::GetNextMethodContextHelper()
 {
+    // If we are one of the workers of a parallel replay
+    if (this->workQueue != nullptr)
+        return GetNextMethodContextFromWorkQueue();
+
     // If we have an offset/increment combo
     if (this->Offset > 0 && this->Increment > 0)
         return GetNextMethodContextFromOffsetIncrement();
@@ -273,7 +505,7 @@ MethodContextBuffer MethodContextReader::GetNextMethodContextFromIndexes()
     // Assert if we don't have an Index or we are done with all the indexes
     Assert(this->hasIndex() && this->curIndexPos < this->IndexCount);
 
-    if (this->hasTOC())
+    if (this->hasTOC() || (this->mczFile != nullptr))
     {
         // If we have an index & we have a TOC, we can just jump to that method!
         return this->GetSpecificMethodContext(this->Indexes[this->curIndexPos++]);
@@ -333,13 +565,18 @@ MethodContextBuffer MethodContextReader::GetNextMethodContextFromHash()
             char mcHash[MM3_HASH_BUFFER_SIZE];
 
             // Create a temporary copy of mcb.buff plus ending 2-byte canary
-            // this will get freed up by MethodContext constructor
-            unsigned char* buff = new unsigned char[mcb.size + 2];
-            memcpy(buff, mcb.buff, mcb.size + 2);
+            // this will get freed up by MethodContext constructor. A mapped buffer
+            // is not freed, so it can be used directly.
+            unsigned char* buff = mcb.buff;
+            if (!mcb.mapped)
+            {
+                buff = new unsigned char[mcb.size + 2];
+                memcpy(buff, mcb.buff, mcb.size + 2);
+            }
 
             MethodContext* mc;
 
-            if (!MethodContext::Initialize(-1, buff, mcb.size, &mc))
+            if (!MethodContext::Initialize(-1, buff, mcb.size, &mc, mcb.mapped))
                 return MethodContextBuffer(-1);
 
             mc->dumpMethodHashToBuffer(mcHash, MM3_HASH_BUFFER_SIZE);
@@ -366,7 +603,16 @@ MethodContextBuffer MethodContextReader::GetNextMethodContextFromOffsetIncrement
 
     int methodNumber = this->curMCIndex > 0 ? this->curMCIndex + this->Increment : this->Offset;
 
-    if (this->hasTOC())
+    if (this->mczFile != nullptr)
+    {
+        if ((int)this->mczFile->GetContextCount() >= methodNumber)
+        {
+            return this->GetSpecificMethodContext(methodNumber);
+        }
+        else
+            return MethodContextBuffer();
+    }
+    else if (this->hasTOC())
     {
         // Check if we are within the TOC
         if ((int)this->tocFile.GetTocCount() >= methodNumber)
@@ -391,6 +637,175 @@ MethodContextBuffer MethodContextReader::GetNextMethodContextFromOffsetIncrement
     return this->ReadMethodContext(true);
 }
 
+// Read a method context buffer from the ContextCollection using the work queue
+MethodContextBuffer MethodContextReader::GetNextMethodContextFromWorkQueue()
+{
+    Assert(this->workQueue != nullptr && this->hasTOC());
+
+    const LONG* chunkStarts = (const LONG*)(this->workQueue + 1);
+    const int*  entries     = (const int*)(chunkStarts + this->workQueue->ChunkCount + 1);
+
+    if (this->curChunkPos == this->curChunkEnd)
+    {
+        // Take the next chunk nobody has claimed yet
+        LONG chunk = InterlockedIncrement(&this->workQueue->NextChunk) - 1;
+        if (chunk >= this->workQueue->ChunkCount)
+            return MethodContextBuffer();
+
+        this->curChunkPos = chunkStarts[chunk];
+        this->curChunkEnd = chunkStarts[chunk + 1];
+        AssertMsg(this->curChunkPos < this->curChunkEnd && this->curChunkEnd <= this->workQueue->EntryCount,
+                  "Invalid work queue chunk %d", chunk);
+    }
+
+    return this->GetSpecificMethodContext(entries[this->curChunkPos++]);
+}
+
+// static
+bool MethodContextReader::CreateWorkQueue(
+    const char* inputFileName, const char* workQueueFileName, const int* indexes, int indexCount, int workerCount)
+{
+    std::string tocFileName = MethodContextReader::CheckForPairedFile(inputFileName, ".mch", ".mct");
+    if (tocFileName.empty())
+        return false;
+
+    TOCFile tocFile;
+    tocFile.LoadToc(tocFileName.c_str());
+    if (tocFile.GetTocCount() == 0)
+        return false;
+
+    HANDLE hFile = OpenFile(inputFileName);
+    if (hFile == INVALID_HANDLE_VALUE)
+        return false;
+    int64_t fileSize = 0;
+    GetFileSizeEx(hFile, (PLARGE_INTEGER)&fileSize);
+    CloseHandle(hFile);
+
+    struct Entry
+    {
+        int     number;
+        int64_t offset;
+        int64_t size;
+    };
+
+    // The size of a method context is the distance to the next one in the file.
+    std::vector<Entry> entries;
+    entries.reserve(tocFile.GetTocCount());
+    for (size_t i = 0; i < tocFile.GetTocCount(); i++)
+    {
+        const TOCElement* elem = tocFile.GetElementPtr(i);
+        entries.push_back({elem->Number, elem->Offset, 0});
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.offset < b.offset; });
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        int64_t end     = (i + 1 < entries.size()) ? entries[i + 1].offset : fileSize;
+        entries[i].size = end - entries[i].offset;
+    }
+
+    if (indexCount > 0)
+    {
+        std::vector<int> wanted(indexes, indexes + indexCount);
+        std::sort(wanted.begin(), wanted.end());
+        entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                     [&](const Entry& e) {
+                                         return !std::binary_search(wanted.begin(), wanted.end(), e.number);
+                                     }),
+                      entries.end());
+    }
+
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.size > b.size; });
+
+    // Cut the sorted entries into chunks of about the same total size. Method contexts bigger than
+    // that get a chunk of their own, at the front of the queue.
+    int64_t totalSize = 0;
+    for (const Entry& e : entries)
+        totalSize += e.size;
+    int64_t chunkTarget = max(totalSize / ((int64_t)max(workerCount, 1) * WorkQueueChunksPerWorker), (int64_t)1);
+
+    std::vector<LONG> chunkStarts;
+    int64_t           chunkSize = chunkTarget;
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        if (chunkSize >= chunkTarget)
+        {
+            chunkStarts.push_back((LONG)i);
+            chunkSize = 0;
+        }
+        chunkSize += entries[i].size;
+    }
+    LONG chunkCount = (LONG)chunkStarts.size();
+    chunkStarts.push_back((LONG)entries.size());
+
+    std::vector<int> numbers;
+    numbers.reserve(entries.size());
+    for (const Entry& e : entries)
+        numbers.push_back(e.number);
+
+    WorkQueueHeader header;
+    header.NextChunk  = 0;
+    header.ChunkCount = chunkCount;
+    header.EntryCount = (LONG)entries.size();
+
+    HANDLE hQueue = CreateFileA(workQueueFileName, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hQueue == INVALID_HANDLE_VALUE)
+    {
+        LogError("Failed to create work queue file '%s'. GetLastError()=%u", workQueueFileName, GetLastError());
+        return false;
+    }
+
+    DWORD bytesWritten;
+    bool  success =
+        WriteFile(hQueue, &header, sizeof(header), &bytesWritten, NULL) &&
+        WriteFile(hQueue, chunkStarts.data(), (DWORD)(chunkStarts.size() * sizeof(LONG)), &bytesWritten, NULL) &&
+        (numbers.empty() ||
+         WriteFile(hQueue, numbers.data(), (DWORD)(numbers.size() * sizeof(int)), &bytesWritten, NULL));
+    CloseHandle(hQueue);
+
+    if (!success)
+    {
+        LogError("Failed to write work queue file '%s'. GetLastError()=%u", workQueueFileName, GetLastError());
+        return false;
+    }
+
+    LogDebug("Work queue %s: %d method contexts in %d chunks", workQueueFileName, header.EntryCount, chunkCount);
+    return true;
+}
+
+bool MethodContextReader::OpenWorkQueue(const char* workQueueFileName)
+{
+    if (!this->hasTOC())
+    {
+        LogError("A work queue can only be used with a TOC file.");
+        return false;
+    }
+
+    this->workQueueFile = CreateFileA(workQueueFileName, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                      NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (this->workQueueFile == INVALID_HANDLE_VALUE)
+    {
+        LogError("Failed to open work queue file '%s'. GetLastError()=%u", workQueueFileName, GetLastError());
+        return false;
+    }
+
+    // The mapping is shared, so the workers see each other's claims on NextChunk.
+    this->workQueueMapping = CreateFileMappingW(this->workQueueFile, NULL, PAGE_READWRITE, 0, 0, NULL);
+    if (this->workQueueMapping != nullptr)
+    {
+        this->workQueue = (WorkQueueHeader*)MapViewOfFile(this->workQueueMapping, FILE_MAP_WRITE, 0, 0, 0);
+    }
+    if (this->workQueue == nullptr)
+    {
+        LogError("Failed to map work queue file '%s'. GetLastError()=%u", workQueueFileName, GetLastError());
+        return false;
+    }
+
+    // The queue decides the order, so there is nothing sequential to prefetch.
+    StopPrefetch();
+
+    return true;
+}
+
 bool MethodContextReader::hasIndex()
 {
     return this->IndexCount > 0;
@@ -408,7 +823,7 @@ bool MethodContextReader::isValid()
 
 // Return a measure of "progress" through the method contexts, as follows:
 // 1. With a given set of indices, this is the current index array position.
-// 2. With a TOC, this is the current method context number.
+// 2. With a TOC or an MCZ file, this is the current method context number.
 // 3. Otherwise, it is the current byte offset in the method context file.
 // Only useful when compared with `TotalWork()`.
 double MethodContextReader::Progress()
@@ -417,15 +832,14 @@ double MethodContextReader::Progress()
     {
         return (double)this->curIndexPos;
     }
-    else if (this->hasTOC())
+    else if (this->hasTOC() || (this->mczFile != nullptr))
     {
         return (double)this->curMCIndex;
     }
     else
     {
         this->AcquireLock();
-        int64_t pos = 0;
-        SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos, FILE_CURRENT);
+        int64_t pos = GetFilePos();
         this->ReleaseLock();
         return (double)pos;
     }
@@ -433,7 +847,7 @@ double MethodContextReader::Progress()
 
 // Return a measure of the total amount of work to be done, as follows:
 // 1. With a given set of indices, this is the total number of indices to return.
-// 2. With a TOC, this is the number of method contexts in the TOC.
+// 2. With a TOC or an MCZ file, this is the number of method contexts.
 // 3. Otherwise, it is the size in bytes of the method context file.
 // Only useful when compared with `Progress()`.
 double MethodContextReader::TotalWork()
@@ -442,6 +856,10 @@ double MethodContextReader::TotalWork()
     {
         return (double)this->IndexCount;
     }
+    else if (this->mczFile != nullptr)
+    {
+        return (double)this->mczFile->GetContextCount();
+    }
     else if (this->hasTOC())
     {
         return (double)this->tocFile.GetTocCount();
@@ -487,6 +905,22 @@ int64_t MethodContextReader::GetOffset(unsigned int methodNumber)
 
 MethodContextBuffer MethodContextReader::GetSpecificMethodContext(unsigned int methodNumber)
 {
+    if (this->mczFile != nullptr)
+    {
+        if ((methodNumber == 0) || (methodNumber > this->mczFile->GetContextCount()))
+        {
+            return MethodContextBuffer(-3);
+        }
+        if (!this->AcquireLock())
+        {
+            return MethodContextBuffer(-2);
+        }
+
+        // ReadMethodContext will release the lock, and counts methodNumber - 1 up to methodNumber
+        curMCIndex = methodNumber - 1;
+        return this->ReadMethodContext(false);
+    }
+
     int64_t pos = this->GetOffset(methodNumber);
     if (pos < 0)
     {
@@ -498,7 +932,7 @@ MethodContextBuffer MethodContextReader::GetSpecificMethodContext(unsigned int m
     {
         return MethodContextBuffer(-2);
     }
-    if (SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos, FILE_BEGIN))
+    if (SetFilePos(pos))
     {
         // ReadMethodContext will release the lock, but we already acquired it
         MethodContextBuffer mcb = this->ReadMethodContext(false);
@@ -622,8 +1056,7 @@ bool MethodContextReader::IsMethodExcluded(MethodContext* mc)
 
 void MethodContextReader::Reset(const int* newIndexes, int newIndexCount)
 {
-    int64_t pos    = 0;
-    BOOL    result = SetFilePointerEx(fileHandle, *(PLARGE_INTEGER)&pos, NULL, FILE_BEGIN);
+    bool result = SetFilePos(0);
     assert(result);
     
     Indexes     = newIndexes;
@@ -10,6 +10,7 @@
 
 #include "methodcontext.h"
 #include "tocfile.h"
+#include "mczfile.h"
 
 struct MethodContextBuffer
 {
@@ -19,14 +20,15 @@ private:
 public:
     unsigned char* buff;
     DWORD          size;
+    bool           mapped; // buff points into the reader's file mapping rather than being owned
 
-    MethodContextBuffer() : buff(nullptr), size(Completed)
+    MethodContextBuffer() : buff(nullptr), size(Completed), mapped(false)
     {
     }
-    MethodContextBuffer(DWORD error) : buff(nullptr), size(error)
+    MethodContextBuffer(DWORD error) : buff(nullptr), size(error), mapped(false)
     {
     }
-    MethodContextBuffer(unsigned char* b, DWORD e) : buff(b), size(e)
+    MethodContextBuffer(unsigned char* b, DWORD e, bool m = false) : buff(b), size(e), mapped(m)
     {
     }
 
@@ -52,6 +54,35 @@ private:
     // The size of the MC/MCH file
     int64_t fileSize;
 
+    // On 64-bit hosts the whole file is mapped copy-on-write and method contexts are decoded in
+    // place from the view (see MethodContextBuffer::mapped), so the view must outlive every
+    // MethodContext created from this reader. fileView is null if the mapping isn't available, in
+    // which case the file is read through fileHandle.
+    HANDLE           fileMapping;
+    unsigned char*   fileView;
+    volatile int64_t filePos;
+
+    // When the file is mapped and read sequentially, a thread faults in the pages up to
+    // PrefetchWindow bytes ahead of filePos so decoding doesn't wait on I/O.
+    static const int64_t PrefetchWindow = 64 * 1024 * 1024;
+    HANDLE               prefetchThread;
+    HANDLE               prefetchEvent;
+    volatile bool        prefetchShutdown;
+    volatile int64_t     prefetchPos;
+
+    static DWORD WINAPI PrefetchThreadProc(LPVOID param);
+    void   MapFile();
+    void   StartPrefetch();
+    void   StopPrefetch();
+    void   SignalPrefetch();
+
+    int64_t GetFilePos();
+    bool    SetFilePos(int64_t pos);
+
+    // Set if the input is a compressed MCZ file. Method contexts are then decompressed into buffers
+    // of their own, and any of them can be read directly by number, as if there was a TOC.
+    MczFile* mczFile;
+
     // Current MC index in the input MC/MCH file
     int curMCIndex;
 
@@ -81,6 +112,25 @@ private:
     int Offset;
     int Increment;
 
+    // Work queue shared by the workers of a parallel replay, see CreateWorkQueue(). The header is
+    // followed by ChunkCount + 1 chunk start positions and then EntryCount method context numbers;
+    // chunk i consists of the entries [ChunkStarts[i], ChunkStarts[i + 1]).
+    struct WorkQueueHeader
+    {
+        volatile LONG NextChunk;
+        LONG          ChunkCount;
+        LONG          EntryCount;
+    };
+
+    // The number of chunks per worker, which bounds how unevenly the work can end up spread.
+    static const int WorkQueueChunksPerWorker = 64;
+
+    HANDLE           workQueueFile;
+    HANDLE           workQueueMapping;
+    WorkQueueHeader* workQueue;
+    LONG             curChunkPos;
+    LONG             curChunkEnd;
+
     struct StringList
     {
         StringList* next;
@@ -102,6 +152,7 @@ private:
     MethodContextBuffer GetNextMethodContextFromIndexes();
     MethodContextBuffer GetNextMethodContextFromHash();
     MethodContextBuffer GetNextMethodContextFromOffsetIncrement();
+    MethodContextBuffer GetNextMethodContextFromWorkQueue();
     MethodContextBuffer GetNextMethodContextHelper();
 
     // Looks for a file named foo.origSuffix.newSuffix or foo.newSuffix
@@ -152,6 +203,20 @@ public:
 
     // Reset for reading a new sequence of method indices
     void Reset(const int* newIndexes, int newIndexCount);
+
+    // Write a work queue for a parallel replay of inputFileName (or of the given indexes of it) by
+    // workerCount workers. The method contexts are ordered by decreasing size and grouped into chunks
+    // of roughly equal total size, so the biggest methods are started first and the workers balance
+    // out on the small ones. Sizes come from the TOC, so this fails if there isn't one.
+    static bool CreateWorkQueue(const char* inputFileName,
+                                const char* workQueueFileName,
+                                const int*  indexes,
+                                int         indexCount,
+                                int         workerCount);
+
+    // Take the method contexts to read from a work queue written by CreateWorkQueue(), which may be
+    // shared with other processes, instead of from the indexes or offset/increment.
+    bool OpenWorkQueue(const char* workQueueFileName);
 };
 #pragma pack(pop)
 
@@ -68,6 +68,7 @@
 #include <string>
 #include <algorithm>
 #include <vector>
+#include <unordered_map>
 
 
 #ifdef USE_MSVCDIS
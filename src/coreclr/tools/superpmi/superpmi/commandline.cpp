@@ -88,6 +88,13 @@ void CommandLine::DumpHelp(const char* program)
     printf(" -details <file name.csv>\n");
     printf("     Emit detailed information about the replay/diff of each context into the specified file\n");
     printf("\n");
+    printf(" -phaseThroughput <file name.csv>\n");
+    printf("     Measure the cost of each JIT phase of every replayed context and write the totals per phase\n");
+    printf("     to the specified file. Costs are instruction counts when running under an instrumentor\n");
+    printf("     that provides Instrumentor_GetInsCount, and thread cycles otherwise. With two JITs the\n");
+    printf("     file compares them phase by phase, counting only contexts that both JITs compiled,\n");
+    printf("     sorted by the largest regression first. Not supported with -parallel or -streaming.\n");
+    printf("\n");
     printf(" -a[pplyDiff]\n");
     printf("     Compare the compile result generated from the provided JIT with the\n");
     printf("     compile result stored with the MC. If two JITs are provided, this\n");
@@ -405,6 +412,16 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
 
                 o->details = argv[i];
             }
+            else if ((_strnicmp(&argv[i][1], "phaseThroughput", argLen) == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->phaseThroughput = argv[i];
+            }
             else if ((_strnicmp(&argv[i][1], "applyDiff", argLen) == 0))
             {
                 o->applyDiff = true;
@@ -625,6 +642,23 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
                     return false;
                 }
             }
+            else if ((_strnicmp(&argv[i][1], "workQueue", argLen) == 0))
+            {
+                // "-workQueue" is an internal switch used by -parallel. Usage is:
+                //
+                // -workQueue filename
+                //
+                // It compiles the method contexts taken from the work queue in filename, which is
+                // shared with the other workers, until the queue is empty.
+
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->workQueue = argv[i];
+            }
             else if (_strnicmp(&argv[i][1], "jitoption", argLen) == 0)
             {
                 i++;
@@ -708,6 +742,25 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
         }
     }
 
+    if (o->phaseThroughput != nullptr)
+    {
+        if (o->parallel)
+        {
+            LogError("phase throughput mode and parallel mode are incompatible.");
+            return false;
+        }
+
+        if (o->streamFile != nullptr)
+        {
+            LogError("phase throughput mode and streaming mode are incompatible.");
+            return false;
+        }
+
+        // Have the JITs report the end of each phase; see MyICJI::reportMetadata.
+        AddForceJitOption(&o->forceJitOptions, W("JitReportPhaseEnds"), W("1"));
+        AddForceJitOption(&o->forceJit2Options, W("JitReportPhaseEnds"), W("1"));
+    }
+
     SPMI_TARGET_ARCHITECTURE defaultSpmiTargetArchitecture = GetSpmiTargetArchitecture();
     SetSuperPmiTargetArchitecture(o->targetArchitecture);
 
@@ -930,3 +983,28 @@ bool CommandLine::AddJitOption(int&  currArgument,
     delete[] value;
     return true;
 }
+
+//-------------------------------------------------------------
+// AddForceJitOption: Force a jit option, as if it was passed with -jitOption force.
+//
+// Arguments:
+//    pForceJitOptions - a jit options map, that forces the option even if it was already set.
+//                       Created if it doesn't exist yet.
+//    key              - the name of the option
+//    value            - the value of the option
+//
+void CommandLine::AddForceJitOption(LightWeightMap<DWORD, DWORD>** pForceJitOptions, const WCHAR* key, const WCHAR* value)
+{
+    if (*pForceJitOptions == nullptr)
+    {
+        *pForceJitOptions = new LightWeightMap<DWORD, DWORD>();
+    }
+
+    LightWeightMap<DWORD, DWORD>* targetjitOptions = *pForceJitOptions;
+
+    DWORD keyIndex =
+        (DWORD)targetjitOptions->AddBuffer((unsigned char*)key, sizeof(WCHAR) * ((unsigned int)u16_strlen(key) + 1));
+    DWORD valueIndex =
+        (DWORD)targetjitOptions->AddBuffer((unsigned char*)value, sizeof(WCHAR) * ((unsigned int)u16_strlen(value) + 1));
+    targetjitOptions->Add(keyIndex, valueIndex);
+}
@@ -40,11 +40,13 @@ public:
         char* hash = nullptr;
         char* methodStatsTypes = nullptr;
         char* details = nullptr;
+        char* phaseThroughput = nullptr;
         char* mclFilename = nullptr;
         char* targetArchitecture = nullptr;
         char* compileList = nullptr;
         int   offset = -1;
         int   increment = -1;
+        char* workQueue = nullptr;
         LightWeightMap<DWORD, DWORD>* forceJitOptions = nullptr;
         LightWeightMap<DWORD, DWORD>* forceJit2Options = nullptr;
         LightWeightMap<DWORD, DWORD>* jitOptions = nullptr;
@@ -61,6 +63,8 @@ public:
 
     static bool ParseJitOption(const char* optionString, WCHAR** key, WCHAR** value);
 
+    static void AddForceJitOption(LightWeightMap<DWORD, DWORD>** pForceJitOptions, const WCHAR* key, const WCHAR* value);
+
 private:
     static void DumpHelp(const char* program);
 };
@@ -1043,6 +1043,14 @@ void MyICJI::reportRichMappings(
 
 void MyICJI::reportMetadata(const char* key, const void* value, size_t length)
 {
+    // Reported by JITs run with JitReportPhaseEnds=1 (-phaseThroughput). Handled first
+    // to keep the cost of the bookkeeping out of the phases.
+    if (strcmp(key, "PhaseEnd") == 0)
+    {
+        jitInstance->EndPhase(static_cast<const char*>(value));
+        return;
+    }
+
     jitInstance->mc->cr->AddCall("reportMetadata");
 
     if (strcmp(key, "MethodFullName") == 0)
@@ -0,0 +1,393 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//----------------------------------------------------------
+// jitbench.cpp - Steady-state benchmark of JIT phases on recorded method contexts
+//
+// jitbench loads a set of method contexts into memory once, warms the JIT up on them and then
+// compiles all of them over and over, measuring what each JIT phase costs per iteration. The JIT
+// is run with JitReportPhaseEnds=1, the same mechanism as "superpmi -phaseThroughput", so any JIT
+// that supports it can be benchmarked; nothing is read from disk while measuring.
+//----------------------------------------------------------
+
+#include "standardpch.h"
+#include "lightweightmap.h"
+#include "jitinstance.h"
+#include "simpletimer.h"
+#include "methodcontext.h"
+#include "methodcontextreader.h"
+#include "mclist.h"
+#include "fileio.h"
+#include "logging.h"
+
+struct BenchOptions
+{
+    char* nameOfJit   = nullptr;
+    char* nameOfInput = nullptr;
+    char* phases      = nullptr; // Comma separated phase name substrings, or null for all phases
+    char* csv         = nullptr;
+    int   iterations  = 10;
+    int   warmup      = 2;
+    int   indexCount  = -1;
+    int*  indexes     = nullptr;
+    LightWeightMap<DWORD, DWORD>* forceJitOptions = nullptr;
+};
+
+static void DumpHelp(const char* program)
+{
+    printf("jitbench measures the steady-state cost of JIT phases on recorded method contexts.\n");
+    printf("\n");
+    printf("Usage: %s [options] jitname filename.mc\n", program);
+    printf(" jitname" PLATFORM_SHARED_LIB_SUFFIX_A " - path of jit to be benchmarked\n");
+    printf(" filename.mc - load method contexts from filename.mc (MCH or MCZ)\n");
+    printf("\n");
+    printf("Options:\n");
+    printf("\n");
+    printf(" -c[ompile] <indexes>\n");
+    printf("     Only benchmark the method contexts with these indexes, as a range or an .mcl file.\n");
+    printf("     All of them are held in memory, so pick a representative few thousand at most.\n");
+    printf("\n");
+    printf(" -phases <name>[,<name>...]\n");
+    printf("     Only report the phases whose names contain one of these, e.g.\n");
+    printf("     -phases \"Importation,Morph,Linear scan,Emit code\". Default is all phases.\n");
+    printf("\n");
+    printf(" -iterations <count>\n");
+    printf("     Number of measured passes over the method contexts. Default is 10.\n");
+    printf("\n");
+    printf(" -warmup <count>\n");
+    printf("     Number of passes before measuring. Default is 2.\n");
+    printf("\n");
+    printf(" -csv <file name.csv>\n");
+    printf("     Also write the cost of every phase in every iteration to the specified file.\n");
+    printf("\n");
+    printf(" -jitoption key=value\n");
+    printf("     Force the JIT option key to value, as superpmi's -jitoption force does.\n");
+    printf("\n");
+    printf("Costs are instruction counts when running under an instrumentor that provides\n");
+    printf("Instrumentor_GetInsCount, and thread cycles otherwise.\n");
+}
+
+static void AddForceJitOption(LightWeightMap<DWORD, DWORD>** pForceJitOptions, const char* key, size_t keyLen, const char* value)
+{
+    if (*pForceJitOptions == nullptr)
+    {
+        *pForceJitOptions = new LightWeightMap<DWORD, DWORD>();
+    }
+
+    std::vector<WCHAR> keyBuf(keyLen + 1);
+    MultiByteToWideChar(CP_UTF8, 0, key, (int)keyLen, keyBuf.data(), (int)keyLen);
+    keyBuf[keyLen] = 0;
+
+    size_t             valueLen = strlen(value);
+    std::vector<WCHAR> valueBuf(valueLen + 1);
+    MultiByteToWideChar(CP_UTF8, 0, value, (int)(valueLen + 1), valueBuf.data(), (int)(valueLen + 1));
+
+    DWORD keyIndex   = (DWORD)(*pForceJitOptions)->AddBuffer((unsigned char*)keyBuf.data(), (unsigned int)(sizeof(WCHAR) * keyBuf.size()));
+    DWORD valueIndex = (DWORD)(*pForceJitOptions)->AddBuffer((unsigned char*)valueBuf.data(), (unsigned int)(sizeof(WCHAR) * valueBuf.size()));
+    (*pForceJitOptions)->Add(keyIndex, valueIndex);
+}
+
+static bool ParseArgs(int argc, char* argv[], BenchOptions* o)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        if ((arg[0] == '-') || (arg[0] == '/'))
+        {
+            const char* name    = arg + 1;
+            bool        hasNext = (i + 1 < argc);
+
+            if (((_stricmp(name, "c") == 0) || (_stricmp(name, "compile") == 0)) && hasNext)
+            {
+                if (!MCList::processArgAsMCL(argv[++i], &o->indexCount, &o->indexes))
+                {
+                    LogError("Invalid method context list '%s'", argv[i]);
+                    return false;
+                }
+            }
+            else if ((_stricmp(name, "phases") == 0) && hasNext)
+            {
+                o->phases = argv[++i];
+            }
+            else if ((_stricmp(name, "iterations") == 0) && hasNext)
+            {
+                o->iterations = atoi(argv[++i]);
+            }
+            else if ((_stricmp(name, "warmup") == 0) && hasNext)
+            {
+                o->warmup = atoi(argv[++i]);
+            }
+            else if ((_stricmp(name, "csv") == 0) && hasNext)
+            {
+                o->csv = argv[++i];
+            }
+            else if ((_stricmp(name, "jitoption") == 0) && hasNext)
+            {
+                const char* option = argv[++i];
+                const char* equals = strchr(option, '=');
+                if (equals == nullptr)
+                {
+                    LogError("Expected key=value after -jitoption, got '%s'", option);
+                    return false;
+                }
+                AddForceJitOption(&o->forceJitOptions, option, equals - option, equals + 1);
+            }
+            else
+            {
+                return false;
+            }
+        }
+        else if (o->nameOfJit == nullptr)
+        {
+            o->nameOfJit = argv[i];
+        }
+        else if (o->nameOfInput == nullptr)
+        {
+            o->nameOfInput = argv[i];
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return (o->nameOfJit != nullptr) && (o->nameOfInput != nullptr) && (o->iterations > 0) && (o->warmup >= 0);
+}
+
+static bool IsSelectedPhase(const char* phase, const char* phases)
+{
+    if (phases == nullptr)
+    {
+        return true;
+    }
+
+    for (const char* start = phases; *start != '\0';)
+    {
+        const char* end = strchr(start, ',');
+        size_t      len = (end == nullptr) ? strlen(start) : (size_t)(end - start);
+        for (const char* p = phase; (len > 0) && (strlen(p) >= len); p++)
+        {
+            if (_strnicmp(p, start, len) == 0)
+            {
+                return true;
+            }
+        }
+        start += len + ((end == nullptr) ? 0 : 1);
+    }
+    return false;
+}
+
+// The cost of one phase in every measured iteration.
+struct PhaseSamples
+{
+    std::string           Phase;
+    std::vector<uint64_t> Costs;
+};
+
+// Compile every method context once. Returns false if a method failed to compile, in which case it
+// is left out of the benchmark.
+static bool CompileOnce(JitInstance* jit, MethodContext* mc)
+{
+    if (mc->WasEnvironmentChanged(jit->getEnvironment()) && !jit->resetConfig(mc))
+    {
+        LogError("JIT can't reset environment");
+    }
+
+    ReplayResults res = jit->CompileMethod(mc, mc->index, false);
+    mc->Reset();
+    return res.Result == ReplayResult::Success;
+}
+
+int __cdecl main(int argc, char* argv[])
+{
+#ifdef TARGET_UNIX
+    if (0 != PAL_Initialize(argc, argv))
+    {
+        fprintf(stderr, "Error: Fail to PAL_Initialize\n");
+        return -1;
+    }
+#endif // TARGET_UNIX
+
+    Logger::Initialize();
+
+    BenchOptions o;
+    if (!ParseArgs(argc, argv, &o))
+    {
+        DumpHelp(argv[0]);
+        return -1;
+    }
+
+    AddForceJitOption(&o.forceJitOptions, "JitReportPhaseEnds", strlen("JitReportPhaseEnds"), "1");
+
+    // Load everything up front, so the measurements don't include any I/O.
+    MethodContextReader reader(o.nameOfInput, o.indexes, o.indexCount);
+    if (!reader.isValid())
+    {
+        return -1;
+    }
+
+    std::vector<MethodContext*> methods;
+    while (true)
+    {
+        MethodContextBuffer mcb = reader.GetNextMethodContext();
+        if (mcb.Error())
+        {
+            return -1;
+        }
+        if (mcb.allDone())
+        {
+            break;
+        }
+
+        MethodContext* mc = nullptr;
+        if (!MethodContext::Initialize(reader.GetMethodContextIndex(), mcb.buff, mcb.size, &mc, mcb.mapped))
+        {
+            return -1;
+        }
+        methods.push_back(mc);
+    }
+
+    if (methods.empty())
+    {
+        LogError("No method contexts to benchmark");
+        return -1;
+    }
+
+    SimpleTimer  st;
+    JitInstance* jit = JitInstance::InitJit(o.nameOfJit, false, &st, methods[0], o.forceJitOptions, nullptr);
+    if (jit == nullptr)
+    {
+        // InitJit already printed a failure message
+        return -1;
+    }
+
+    // Warm up the JIT, its allocators and the caches, and drop the methods that don't compile.
+    size_t kept = 0;
+    for (MethodContext* mc : methods)
+    {
+        bool compiles = true;
+        for (int i = 0; compiles && (i < std::max(o.warmup, 1)); i++)
+        {
+            compiles = CompileOnce(jit, mc);
+        }
+
+        if (compiles && jit->phaseCosts.empty())
+        {
+            LogError("The JIT didn't report any phases; does it support JitReportPhaseEnds?");
+            return -1;
+        }
+
+        if (compiles)
+        {
+            methods[kept++] = mc;
+        }
+        else
+        {
+            LogWarning("Method context %d failed to compile, leaving it out", mc->index);
+            delete mc;
+        }
+    }
+    methods.resize(kept);
+
+    LogVerbose("Benchmarking %d method contexts, %d iterations after %d warmup iterations", (int)methods.size(),
+               o.iterations, o.warmup);
+
+    // The phase names point into the JIT, which stays loaded, so they can identify the phases.
+    std::vector<PhaseSamples>               samples;
+    std::unordered_map<const char*, size_t> phaseIndex;
+    std::vector<uint64_t>                   totals(o.iterations, 0);
+
+    for (int iteration = 0; iteration < o.iterations; iteration++)
+    {
+        for (MethodContext* mc : methods)
+        {
+            if (!CompileOnce(jit, mc))
+            {
+                LogWarning("Method context %d failed to compile in iteration %d", mc->index, iteration);
+                continue;
+            }
+
+            for (const PhaseCost& cost : jit->phaseCosts)
+            {
+                auto it = phaseIndex.find(cost.Phase);
+                if (it == phaseIndex.end())
+                {
+                    it = phaseIndex.insert({cost.Phase, samples.size()}).first;
+                    samples.emplace_back();
+                    samples.back().Phase = (cost.Phase == nullptr) ? "(after last phase)" : cost.Phase;
+                    samples.back().Costs.resize(o.iterations, 0);
+                }
+                samples[it->second].Costs[iteration] += cost.Cost;
+                totals[iteration] += cost.Cost;
+            }
+        }
+    }
+
+    samples.push_back({"(total)", totals});
+
+    const char* unit = JitInstance::PhaseCounterIsInstructionCount() ? "instructions" : "cycles";
+    printf("%-40s %16s %16s %16s %8s\n", "Phase", "Min", "Median", "Mean", "CV %");
+    for (PhaseSamples& phase : samples)
+    {
+        if ((&phase != &samples.back()) && !IsSelectedPhase(phase.Phase.c_str(), o.phases))
+        {
+            continue;
+        }
+
+        std::vector<uint64_t> sorted = phase.Costs;
+        std::sort(sorted.begin(), sorted.end());
+
+        double mean = 0;
+        for (uint64_t cost : sorted)
+        {
+            mean += (double)cost;
+        }
+        mean /= sorted.size();
+
+        double variance = 0;
+        for (uint64_t cost : sorted)
+        {
+            variance += ((double)cost - mean) * ((double)cost - mean);
+        }
+        variance /= sorted.size();
+
+        printf("%-40s %16llu %16llu %16.0f %8.2f\n", phase.Phase.c_str(), (unsigned long long)sorted.front(),
+               (unsigned long long)sorted[sorted.size() / 2], mean, mean == 0 ? 0.0 : 100.0 * sqrt(variance) / mean);
+    }
+    printf("Costs are %s per iteration over %d method contexts.\n", unit, (int)methods.size());
+
+    if (o.csv != nullptr)
+    {
+        FileWriter fw;
+        if (!FileWriter::CreateNew(o.csv, &fw))
+        {
+            LogError("Could not create file %s", o.csv);
+            return -1;
+        }
+
+        fw.Print("Phase");
+        for (int iteration = 0; iteration < o.iterations; iteration++)
+        {
+            fw.Printf(",%d", iteration);
+        }
+        fw.Print("\n");
+
+        for (const PhaseSamples& phase : samples)
+        {
+            fw.PrintQuotedCsvField(phase.Phase.c_str());
+            for (uint64_t cost : phase.Costs)
+            {
+                fw.Printf(",%llu", (unsigned long long)cost);
+            }
+            fw.Print("\n");
+        }
+    }
+
+    for (MethodContext* mc : methods)
+    {
+        delete mc;
+    }
+
+    Logger::Shutdown();
+    return 0;
+}
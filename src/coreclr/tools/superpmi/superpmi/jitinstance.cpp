@@ -31,6 +31,8 @@ JitInstance* JitInstance::InitJit(char*                         nameOfJit,
     // or to force it on, then propagate that to the jit flags.
     jit->forceClearAltJitFlag = false;
     jit->forceSetAltJitFlag = false;
+    jit->measuringPhases = false;
+    jit->lastPhaseEnd = 0;
     const WCHAR* altJitFlag = jit->getForceOption(W("AltJit"));
     if (altJitFlag != nullptr)
     {
@@ -297,6 +299,52 @@ extern "C" DLLEXPORT NOINLINE void Instrumentor_GetInsCount(UINT64* result)
     }
 }
 
+//-------------------------------------------------------------
+// ReadPhaseCounter: Read the counter used to measure the cost of JIT phases.
+//
+// Returns:
+//    The executed instruction count if an instrumentor provides one, since that is
+//    stable from run to run; the cycle time of the current thread otherwise.
+//
+uint64_t JitInstance::ReadPhaseCounter()
+{
+    UINT64 count = 0;
+    Instrumentor_GetInsCount(&count);
+    if (count == 0)
+    {
+        QueryThreadCycleTime(GetCurrentThread(), &count);
+    }
+    return count;
+}
+
+bool JitInstance::PhaseCounterIsInstructionCount()
+{
+    UINT64 count = 0;
+    Instrumentor_GetInsCount(&count);
+    return count != 0;
+}
+
+//-------------------------------------------------------------
+// EndPhase: Attribute the cost since the end of the previous phase (or since the start of the
+// compilation) to a phase that just ended.
+//
+// Arguments:
+//    phase - the name of the phase, or nullptr for the work after the last phase
+//
+void JitInstance::EndPhase(const char* phase)
+{
+    if (!measuringPhases)
+    {
+        // Phases of the extra compilations done to time the method.
+        return;
+    }
+
+    uint64_t now = ReadPhaseCounter();
+    phaseCosts.push_back({phase, now - lastPhaseEnd});
+    // Don't charge our own bookkeeping to the next phase.
+    lastPhaseEnd = ReadPhaseCounter();
+}
+
 ReplayResults JitInstance::CompileMethod(MethodContext* MethodToCompile, int mcIndex, bool collectThroughput)
 {
     struct Param : FilterSuperPMIExceptionsParam_CaptureException
@@ -326,6 +374,8 @@ ReplayResults JitInstance::CompileMethod(MethodContext* MethodToCompile, int mcI
     UINT64 insCountBefore = 0;
     Instrumentor_GetInsCount(&insCountBefore);
 
+    phaseCosts.clear();
+
     PAL_TRY(Param*, pParam, &param)
     {
         uint8_t*   NEntryBlock    = nullptr;
@@ -346,8 +396,15 @@ ReplayResults JitInstance::CompileMethod(MethodContext* MethodToCompile, int mcI
             pParam->pThis->lt.Start();
         }
         pParam->pThis->pJitInstance->setTargetOS(os);
+        pParam->pThis->measuringPhases = true;
+        pParam->pThis->lastPhaseEnd    = ReadPhaseCounter();
         CorJitResult jitResult = pParam->pThis->pJitInstance->compileMethod(pParam->pThis->icji, &pParam->info,
                                                                        pParam->flags, &NEntryBlock, &NCodeSizeBlock);
+        if (!pParam->pThis->phaseCosts.empty())
+        {
+            pParam->pThis->EndPhase(nullptr);
+        }
+        pParam->pThis->measuringPhases = false;
         if (pParam->collectThroughput)
         {
             pParam->pThis->lt.Stop();
@@ -422,6 +479,10 @@ ReplayResults JitInstance::CompileMethod(MethodContext* MethodToCompile, int mcI
     {
         SpmiException e(&param);
 
+        // The phases of an aborted compilation don't add up to a meaningful cost.
+        measuringPhases = false;
+        phaseCosts.clear();
+
         if (e.GetCode() == EXCEPTIONCODE_MC)
         {
             char* message = e.GetExceptionMessage();
@@ -16,6 +16,14 @@ enum class ReplayResult
     Miss,
 };
 
+// Cost of a phase of the last compilation, as reported by the JIT through reportMetadata("PhaseEnd").
+// Phase names point into the JIT and are only valid as long as it stays loaded.
+struct PhaseCost
+{
+    const char* Phase;
+    uint64_t    Cost;
+};
+
 struct ReplayResults
 {
     ReplayResult Result = ReplayResult::Success;
@@ -45,6 +53,9 @@ private:
     JitInstance(){};
     void timeResult(CORINFO_METHOD_INFO info, unsigned flags);
 
+    bool     measuringPhases;
+    uint64_t lastPhaseEnd;
+
 public:
 
     bool forceClearAltJitFlag;
@@ -55,6 +66,10 @@ public:
     ULONGLONG        times[2];
     ICorJitCompiler* pJitInstance;
 
+    // Cost of each phase of the last compilation, in the order the phases ended. The last entry
+    // covers the work after the last phase, including anything done outside the JIT phases.
+    std::vector<PhaseCost> phaseCosts;
+
     // Allocate and initialize the jit provided
     static JitInstance* InitJit(char*          nameOfJit,
                                 bool           breakOnAssert,
@@ -84,6 +99,10 @@ public:
     void freeLongLivedArray(void* array);
 
     void updateForceOptions(LightWeightMap<DWORD, DWORD>* newForceOptions);
+
+    static uint64_t ReadPhaseCounter();
+    static bool PhaseCounterIsInstructionCount();
+    void EndPhase(const char* phase);
 };
 
 #endif
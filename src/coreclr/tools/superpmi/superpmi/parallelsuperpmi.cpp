@@ -9,6 +9,7 @@
 #include "commandline.h"
 #include "errorhandling.h"
 #include "fileio.h"
+#include "methodcontextreader.h"
 
 // Forward declare the conversion method. Including spmiutil.h pulls in other headers
 // that cause build breaks.
@@ -585,6 +586,23 @@ int doParallelSuperPMI(CommandLine::Options& o)
         sprintf_s(wd.stdErrorPath, MAX_PATH, "%sParallelSuperPMI-stderr-%u-%d.txt", tempPath, randNumber, i);
     }
 
+    // Hand out the method contexts through a work queue the workers take chunks from as they go, starting with
+    // the biggest methods, so no worker is left with a slice that takes much longer than the others. That needs the
+    // method context sizes from the TOC; without one, each worker gets every workerCount'th method context.
+    char* workQueuePath = nullptr;
+    if (o.hash == nullptr)
+    {
+        workQueuePath = new char[MAX_PATH];
+        sprintf_s(workQueuePath, MAX_PATH, "%sParallelSuperPMI-WorkQueue-%u.bin", tempPath, randNumber);
+        if (!MethodContextReader::CreateWorkQueue(o.nameOfInputMethodContextFile, workQueuePath, o.indexes,
+                                                  o.indexCount, o.workerCount))
+        {
+            LogVerbose(" No TOC available, using static partitioning.");
+            delete[] workQueuePath;
+            workQueuePath = nullptr;
+        }
+    }
+
     char cmdLine[MAX_CMDLINE_SIZE];
     cmdLine[0] = '\0';
     int bytesWritten;
@@ -592,7 +610,15 @@ int doParallelSuperPMI(CommandLine::Options& o)
     HANDLE* hProcesses = new HANDLE[o.workerCount];
     for (int i = 0; i < o.workerCount; i++)
     {
-        bytesWritten = sprintf_s(cmdLine, MAX_CMDLINE_SIZE, "%s -stride %d %d", spmiFilename, i + 1, o.workerCount);
+        if (workQueuePath != nullptr)
+        {
+            bytesWritten = sprintf_s(cmdLine, MAX_CMDLINE_SIZE, "%s -workQueue %s", spmiFilename, workQueuePath);
+        }
+        else
+        {
+            bytesWritten =
+                sprintf_s(cmdLine, MAX_CMDLINE_SIZE, "%s -stride %d %d", spmiFilename, i + 1, o.workerCount);
+        }
 
         PerWorkerData& wd = perWorkerData[i];
 
@@ -775,6 +801,11 @@ int doParallelSuperPMI(CommandLine::Options& o)
             remove(wd.stdOutputPath);
             remove(wd.stdErrorPath);
         }
+
+        if (workQueuePath != nullptr)
+        {
+            remove(workQueuePath);
+        }
     }
 
     return (int)result;
@@ -0,0 +1,121 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//----------------------------------------------------------
+// PhaseThroughput.cpp - Aggregates the per-phase cost of replayed methods (-phaseThroughput)
+//----------------------------------------------------------
+
+#include "standardpch.h"
+#include "phasethroughput.h"
+#include "fileio.h"
+#include "logging.h"
+
+PhaseThroughput::PhaseTotals& PhaseThroughput::GetPhase(const char* phase)
+{
+    // The work after the last phase the JIT reported, i.e. its epilogue outside any phase.
+    std::string name = (phase == nullptr) ? "(after last phase)" : phase;
+
+    auto it = m_phaseIndex.find(name);
+    if (it != m_phaseIndex.end())
+    {
+        return m_phases[it->second];
+    }
+
+    m_phaseIndex.insert({name, m_phases.size()});
+    m_phases.emplace_back();
+    m_phases.back().Phase = std::move(name);
+    return m_phases.back();
+}
+
+void PhaseThroughput::AddMethod(const std::vector<PhaseCost>& baseCosts, const std::vector<PhaseCost>* diffCosts)
+{
+    if (baseCosts.empty() || ((diffCosts != nullptr) && diffCosts->empty()))
+    {
+        return;
+    }
+
+    for (const PhaseCost& cost : baseCosts)
+    {
+        GetPhase(cost.Phase).BaseCost += cost.Cost;
+        m_baseTotal += cost.Cost;
+    }
+
+    if (diffCosts != nullptr)
+    {
+        for (const PhaseCost& cost : *diffCosts)
+        {
+            GetPhase(cost.Phase).DiffCost += cost.Cost;
+            m_diffTotal += cost.Cost;
+        }
+    }
+
+    m_methodCount++;
+}
+
+bool PhaseThroughput::WriteReport(const char* path, bool hasDiff, bool isInstructionCount)
+{
+    FileWriter fw;
+    if (!FileWriter::CreateNew(path, &fw))
+    {
+        LogError("Could not create file %s", path);
+        return false;
+    }
+
+    std::vector<const PhaseTotals*> sorted;
+    sorted.reserve(m_phases.size());
+    for (const PhaseTotals& phase : m_phases)
+    {
+        sorted.push_back(&phase);
+    }
+
+    const char* unit = isInstructionCount ? "instructions" : "cycles";
+
+    if (hasDiff)
+    {
+        std::stable_sort(sorted.begin(), sorted.end(), [](const PhaseTotals* a, const PhaseTotals* b) {
+            return ((int64_t)(a->DiffCost - a->BaseCost)) > ((int64_t)(b->DiffCost - b->BaseCost));
+        });
+
+        fw.Printf("Phase,Base %s,Diff %s,Delta,Delta %%,Delta of total %%\n", unit, unit);
+        for (const PhaseTotals* phase : sorted)
+        {
+            int64_t delta = (int64_t)(phase->DiffCost - phase->BaseCost);
+            fw.PrintQuotedCsvField(phase->Phase.c_str());
+            fw.Printf(",%llu,%llu,%lld,%.4f,%.4f\n", (unsigned long long)phase->BaseCost,
+                      (unsigned long long)phase->DiffCost, (long long)delta,
+                      phase->BaseCost == 0 ? 0.0 : 100.0 * delta / phase->BaseCost,
+                      m_baseTotal == 0 ? 0.0 : 100.0 * delta / m_baseTotal);
+        }
+
+        int64_t totalDelta = (int64_t)(m_diffTotal - m_baseTotal);
+        fw.Printf("\"(total)\",%llu,%llu,%lld,%.4f,%.4f\n", (unsigned long long)m_baseTotal,
+                  (unsigned long long)m_diffTotal, (long long)totalDelta,
+                  m_baseTotal == 0 ? 0.0 : 100.0 * totalDelta / m_baseTotal,
+                  m_baseTotal == 0 ? 0.0 : 100.0 * totalDelta / m_baseTotal);
+    }
+    else
+    {
+        std::stable_sort(sorted.begin(), sorted.end(), [](const PhaseTotals* a, const PhaseTotals* b) {
+            return a->BaseCost > b->BaseCost;
+        });
+
+        fw.Printf("Phase,%s,Share %%\n", isInstructionCount ? "Instructions" : "Cycles");
+        for (const PhaseTotals* phase : sorted)
+        {
+            fw.PrintQuotedCsvField(phase->Phase.c_str());
+            fw.Printf(",%llu,%.4f\n", (unsigned long long)phase->BaseCost,
+                      m_baseTotal == 0 ? 0.0 : 100.0 * phase->BaseCost / m_baseTotal);
+        }
+
+        fw.Printf("\"(total)\",%llu,100.0000\n", (unsigned long long)m_baseTotal);
+    }
+
+    if (!fw.Flush())
+    {
+        LogError("Could not write file %s", path);
+        return false;
+    }
+
+    LogVerbose("Wrote the %s of %d JIT phases over %d methods to %s", unit, (int)m_phases.size(), m_methodCount, path);
+    return true;
+}
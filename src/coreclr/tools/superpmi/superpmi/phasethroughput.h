@@ -0,0 +1,45 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//-----------------------------------------------------------------------------
+// PhaseThroughput.h - Aggregates the per-phase cost of replayed methods (-phaseThroughput)
+//-----------------------------------------------------------------------------
+#ifndef _PhaseThroughput
+#define _PhaseThroughput
+
+#include "jitinstance.h"
+
+class PhaseThroughput
+{
+private:
+    struct PhaseTotals
+    {
+        std::string Phase;
+        uint64_t    BaseCost = 0;
+        uint64_t    DiffCost = 0;
+    };
+
+    std::vector<PhaseTotals>                m_phases;
+    std::unordered_map<std::string, size_t> m_phaseIndex;
+    uint64_t                                m_baseTotal = 0;
+    uint64_t                                m_diffTotal = 0;
+    int                                     m_methodCount = 0;
+
+    PhaseTotals& GetPhase(const char* phase);
+
+public:
+    // Add the phase costs of a method compiled by the base JIT and, if not null, by the diff JIT.
+    // Methods the JITs didn't report phases for are ignored.
+    void AddMethod(const std::vector<PhaseCost>& baseCosts, const std::vector<PhaseCost>* diffCosts);
+
+    int GetMethodCount()
+    {
+        return m_methodCount;
+    }
+
+    // Write the totals per phase as CSV, sorted by the largest regression (or cost, without a
+    // diff JIT) first.
+    bool WriteReport(const char* path, bool hasDiff, bool isInstructionCount);
+};
+
+#endif
@@ -17,6 +17,7 @@
 #include "methodcontextreader.h"
 #include "mclist.h"
 #include "methodstatsemitter.h"
+#include "phasethroughput.h"
 #include "spmiutil.h"
 #include "fileio.h"
 
@@ -258,6 +259,7 @@ int __cdecl main(int argc, char* argv[])
     bool   collectThroughput = false;
     MCList failingToReplayMCL;
     FileWriter detailsCsv;
+    PhaseThroughput phaseThroughput;
 
     CommandLine::Options o;
     if (!CommandLine::Parse(argc, argv, &o))
@@ -308,6 +310,10 @@ int __cdecl main(int argc, char* argv[])
 
     if (o.offset > 0 && o.increment > 0)
         LogVerbose(" offset=%d increment=%d", o.offset, o.increment);
+    if (o.workQueue != nullptr)
+        LogVerbose(" workQueue=%s", o.workQueue);
+    if (o.phaseThroughput != nullptr)
+        LogVerbose(" phaseThroughput=%s", o.phaseThroughput);
 
     if (o.methodStatsTypes != nullptr)
     {
@@ -339,6 +345,11 @@ int __cdecl main(int argc, char* argv[])
         return (int)SpmiResult::GeneralFailure;
     }
 
+    if ((o.workQueue != nullptr) && !reader->OpenWorkQueue(o.workQueue))
+    {
+        return (int)SpmiResult::GeneralFailure;
+    }
+
     int loadedCount       = 0;
     int jittedCount       = 0;
     int failToReplayCount = 0;
@@ -399,7 +410,7 @@ int __cdecl main(int argc, char* argv[])
         loadedCount++;
         const int mcIndex = reader->GetMethodContextIndex();
         MethodContext* mc = nullptr;
-        if (!MethodContext::Initialize(mcIndex, mcb.buff, mcb.size, &mc))
+        if (!MethodContext::Initialize(mcIndex, mcb.buff, mcb.size, &mc, mcb.mapped))
         {
             return (int)SpmiResult::GeneralFailure;
         }
@@ -552,6 +563,11 @@ int __cdecl main(int argc, char* argv[])
 
             if ((res.Result == ReplayResult::Success) && (res2.Result == ReplayResult::Success))
             {
+                if (o.phaseThroughput != nullptr)
+                {
+                    phaseThroughput.AddMethod(jit->phaseCosts, (jit2 != nullptr) ? &jit2->phaseCosts : nullptr);
+                }
+
                 if (collectThroughput)
                 {
                     if ((o.nameOfJit2 != nullptr) && (res2.Result == ReplayResult::Success))
@@ -795,6 +811,18 @@ doneRepeatCount:
     st2.Stop();
     LogVerbose("Total time: %fms", st2.GetMilliseconds());
 
+    bool phaseThroughputFailed = false;
+    if (o.phaseThroughput != nullptr)
+    {
+        if (phaseThroughput.GetMethodCount() == 0)
+        {
+            LogWarning("No JIT phases were reported; does the JIT support JitReportPhaseEnds?");
+        }
+
+        phaseThroughputFailed = !phaseThroughput.WriteReport(o.phaseThroughput, o.nameOfJit2 != nullptr,
+                                                             JitInstance::PhaseCounterIsInstructionCount());
+    }
+
     if (methodStatsEmitter != nullptr)
     {
         delete methodStatsEmitter;
@@ -808,7 +836,11 @@ doneRepeatCount:
 
     SpmiResult result = SpmiResult::Success;
 
-    if ((errorCount > 0) || (errorCount2 > 0))
+    if (phaseThroughputFailed)
+    {
+        result = SpmiResult::GeneralFailure;
+    }
+    else if ((errorCount > 0) || (errorCount2 > 0))
     {
         result = SpmiResult::Error;
     }
@@ -18,6 +18,68 @@ LPCWSTR *knobNames = nullptr;
 LPCWSTR *knobValues = nullptr;
 int numberOfKnobs = 0;
 
+// Open addressing hash table over knobNames, so that a lookup doesn't compare the name against
+// every property the host passed in. Hosts can pass large property bags and the knobs are looked
+// up many times during startup. If the table can't be allocated, lookups scan knobNames.
+struct KnobIndexSlot
+{
+    DWORD hash;
+    int knob; // Index in knobNames + 1, 0 for an empty slot
+};
+
+static KnobIndexSlot *knobIndex = nullptr;
+static DWORD knobIndexMask = 0;
+
+static DWORD HashKnobName(LPCWSTR name)
+{
+    // FNV-1a
+    DWORD hash = 2166136261;
+    for (; *name != W('\0'); ++name)
+    {
+        hash ^= (DWORD)*name;
+        hash *= 16777619;
+    }
+
+    return hash;
+}
+
+static void BuildKnobIndex()
+{
+    // Keep the table at most half full
+    DWORD size = 16;
+    while (size < (DWORD)numberOfKnobs * 2)
+        size *= 2;
+
+    KnobIndexSlot *index = new (nothrow) KnobIndexSlot[size];
+    if (index == nullptr)
+        return;
+
+    memset(index, 0, sizeof(KnobIndexSlot) * size);
+    for (int i = 0; i < numberOfKnobs; ++i)
+    {
+        _ASSERT(knobNames[i] != nullptr);
+        DWORD hash = HashKnobName(knobNames[i]);
+        DWORD slot = hash & (size - 1);
+        while (index[slot].knob != 0)
+        {
+            // The first of duplicate names wins, same as the linear search
+            if (index[slot].hash == hash && u16_strcmp(knobNames[index[slot].knob - 1], knobNames[i]) == 0)
+                break;
+
+            slot = (slot + 1) & (size - 1);
+        }
+
+        if (index[slot].knob == 0)
+        {
+            index[slot].hash = hash;
+            index[slot].knob = i + 1;
+        }
+    }
+
+    knobIndex = index;
+    knobIndexMask = size - 1;
+}
+
 void Configuration::InitializeConfigurationKnobs(int numberOfConfigs, LPCWSTR *names, LPCWSTR *values)
 {
     numberOfKnobs = numberOfConfigs;
@@ -27,6 +89,12 @@ void Configuration::InitializeConfigurationKnobs(int numberOfConfigs, LPCWSTR *n
 
     knobNames = names;
     knobValues = values;
+
+    // Built before the knobs are read, which happens on the thread initializing the runtime
+    delete[] knobIndex;
+    knobIndex = nullptr;
+    if (knobNames != nullptr && numberOfKnobs > 0)
+        BuildKnobIndex();
 }
 
 static LPCWSTR GetConfigurationValue(LPCWSTR name)
@@ -37,6 +105,21 @@ static LPCWSTR GetConfigurationValue(LPCWSTR name)
         return nullptr;
     }
 
+    if (knobIndex != nullptr)
+    {
+        DWORD hash = HashKnobName(name);
+        for (DWORD slot = hash & knobIndexMask; knobIndex[slot].knob != 0; slot = (slot + 1) & knobIndexMask)
+        {
+            int knob = knobIndex[slot].knob - 1;
+            if (knobIndex[slot].hash == hash && u16_strcmp(name, knobNames[knob]) == 0)
+            {
+                return knobValues[knob];
+            }
+        }
+
+        return nullptr;
+    }
+
     for (int i = 0; i < numberOfKnobs; ++i)
     {
         _ASSERT(knobNames[i] != nullptr);
@@ -322,6 +322,11 @@ void ExecutableAllocator::RemoveCachedMapping(size_t index)
         g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the RW mapping failed"));
     }
 
+    if (unmapAddress)
+    {
+        m_rwMappingsReleasedCount++;
+    }
+
     m_cachedMapping[index - 1] = NULL;
 #endif // ENABLE_CACHED_MAPPINGS
 }
@@ -502,6 +507,20 @@ void* ExecutableAllocator::Commit(void* pStart, size_t size, bool isExecutable)
     }
 }
 
+bool ExecutableAllocator::AdviseLargePages(void* pStart, size_t size)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (IsDoubleMappingEnabled())
+    {
+        // Committing double mapped memory replaces the reserved mapping, so the hint
+        // would not survive until the memory is used.
+        return false;
+    }
+
+    return VMToOSInterface::AdviseLargePages(pStart, size);
+}
+
 void ExecutableAllocator::Release(void* pRX)
 {
     LIMITED_METHOD_CONTRACT;
@@ -861,6 +880,7 @@ void* ExecutableAllocator::MapRW(void* pRX, size_t size, CacheableMapping cacheM
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
     ExecutableAllocator::g_MapRW_Calls++;
 #endif
+    m_mapRWCallCount++;
 
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
     StopWatch sw(&g_mapTimeSum);
@@ -898,6 +918,18 @@ void* ExecutableAllocator::MapRW(void* pRX, size_t size, CacheableMapping cacheM
             // Size of the block we will map
             size_t mapSize = ALIGN_UP(offset - mapOffset + size, Granularity());
 
+            if (m_writeSessionCount != 0)
+            {
+                // Map the aligned window containing the range, clipped to the RX block, so that the
+                // following writes of the session hit the cached mapping
+                size_t windowOffset = ALIGN_DOWN(offset, WriteSessionMappingSize);
+                size_t windowEnd = min(windowOffset + WriteSessionMappingSize, pBlock->size);
+
+                _ASSERTE(windowOffset <= mapOffset);
+                mapOffset = windowOffset;
+                mapSize = ALIGN_UP(max(windowEnd, offset + size), Granularity()) - mapOffset;
+            }
+
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
             StopWatch sw2(&g_mapCreateTimeSum);
 #endif
@@ -908,6 +940,8 @@ void* ExecutableAllocator::MapRW(void* pRX, size_t size, CacheableMapping cacheM
                 g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Failed to create RW mapping for RX memory. This can be caused by insufficient memory or hitting the limit of memory mappings on Linux (vm.map_max_count)."));
             }
 
+            m_rwMappingsCreatedCount++;
+
             AddRWBlock(pRW, (BYTE*)pBlock->baseRX + mapOffset, mapSize, cacheMapping);
 
             return (void*)((size_t)pRW + (offset - mapOffset));
@@ -961,4 +995,47 @@ void ExecutableAllocator::UnmapRW(void* pRW)
     {
         g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the RW mapping failed"));
     }
+
+    if (unmapAddress)
+    {
+        m_rwMappingsReleasedCount++;
+    }
+}
+
+void ExecutableAllocator::BeginWriteSession()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (IsDoubleMappingEnabled())
+    {
+        InterlockedIncrement(&m_writeSessionCount);
+    }
+}
+
+void ExecutableAllocator::EndWriteSession()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (IsDoubleMappingEnabled())
+    {
+        LONG writeSessionCount = InterlockedDecrement(&m_writeSessionCount);
+        _ASSERTE(writeSessionCount >= 0);
+    }
+}
+
+void ExecutableAllocator::GetMappingStatistics(MappingStatistics* pStatistics)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!IsDoubleMappingEnabled())
+    {
+        memset(pStatistics, 0, sizeof(MappingStatistics));
+        return;
+    }
+
+    CRITSEC_Holder csh(m_CriticalSection);
+
+    pStatistics->MapRWCalls = m_mapRWCallCount;
+    pStatistics->RWMappingsCreated = m_rwMappingsCreatedCount;
+    pStatistics->RWMappingsReleased = m_rwMappingsReleasedCount;
 }
@@ -34,9 +34,52 @@ namespace
     {
         FireEtwAllocRequest(pHeap, ptr, static_cast<unsigned int>(dwSize), 0, 0, GetClrInstanceId());
     }
+
+    inline bool EtwAllocRequestEnabled()
+    {
+        return EventEnabledAllocRequest();
+    }
+
+    inline void EtwLoaderHeapStatistics(UnlockedLoaderHeap * const pHeap, const UnlockedLoaderHeap::Statistics& stats)
+    {
+        FireEtwLoaderHeapStatistics(pHeap,
+                                    stats.ReservedBytes,
+                                    stats.CommittedBytes,
+                                    stats.AllocatedBytes,
+                                    stats.FreeListBytes,
+                                    stats.ThreadRegionBytes,
+                                    GetClrInstanceId());
+    }
+
+    inline bool EtwLoaderHeapStatisticsEnabled()
+    {
+        return EventEnabledLoaderHeapStatistics();
+    }
 #else
 #define EtwAllocRequest(pHeap, ptr, dwSize) ((void)0)
+#define EtwAllocRequestEnabled() false
+#define EtwLoaderHeapStatistics(pHeap, stats) ((void)0)
+#define EtwLoaderHeapStatisticsEnabled() false
 #endif // SELF_NO_HOST
+
+    // A region of a LoaderHeap that serves the small allocations of one thread. The heap carves it under its
+    // lock and the thread bump allocates from it without the lock.
+    struct LoaderHeapThreadRegion
+    {
+        LoaderHeap* m_pHeap;
+        LONG        m_epoch;
+        BYTE*       m_pAllocPtr;
+        BYTE*       m_pEnd;
+    };
+
+    // Each thread keeps the regions of a few heaps, the slot being picked by the address of the heap
+    const size_t NumThreadRegions = 4;
+    thread_local LoaderHeapThreadRegion t_threadRegions[NumThreadRegions];
+
+    // Bumped when a heap with thread regions is destroyed, which drops the regions of all the threads
+    // without touching them, so that no thread allocates from a heap that reused the address of a
+    // destroyed one.
+    Volatile<LONG> s_threadRegionEpoch = 1;
 }
 
 //
@@ -976,6 +1019,9 @@ UnlockedLoaderHeap::UnlockedLoaderHeap(DWORD dwReserveBlockSize,
 
     m_pFirstFreeBlock            = NULL;
 
+    m_dwAllocatedBytes           = 0;
+    m_dwThreadRegionBytes        = 0;
+
     if (dwReservedRegionAddress != NULL && dwReservedRegionSize > 0)
     {
         m_reservedBlock.Init((void *)dwReservedRegionAddress, dwReservedRegionSize, FALSE);
@@ -995,6 +1041,8 @@ UnlockedLoaderHeap::~UnlockedLoaderHeap()
 
     _ASSERTE(!m_fPermitStubsWithUnwindInfo || m_fStubUnwindInfoUnregistered);
 
+    UnlockedFireStatisticsEvent();
+
     if (m_pRangeList != NULL)
         m_pRangeList->RemoveRanges((void *) this);
 
@@ -1239,6 +1287,8 @@ BOOL UnlockedLoaderHeap::UnlockedReservePages(size_t dwSizeToCommit)
     m_pAllocPtr                  = (BYTE *) (pData);                            \
     m_pEndReservedRegion         = (BYTE *) (pData) + (dwSizeToReserve);
 
+    UnlockedFireStatisticsEvent();
+
     return TRUE;
 }
 
@@ -1501,6 +1551,7 @@ again:
 
 #endif
 
+            m_dwAllocatedBytes += dwSize;
             EtwAllocRequest(this, pData, dwSize);
             RETURN pData;
         }
@@ -1623,6 +1674,9 @@ void UnlockedLoaderHeap::UnlockedBackoutMem(void *pMem,
 
     size_t dwSize = AllocMem_TotalSize(dwRequestedSize);
 
+    _ASSERTE(m_dwAllocatedBytes >= dwSize);
+    m_dwAllocatedBytes -= dwSize;
+
 #ifdef _DEBUG
     if ((m_dwDebugFlags & kCallTracing) && !IsInterleaved())
     {
@@ -1776,6 +1830,7 @@ void *UnlockedLoaderHeap::UnlockedAllocAlignedMem_NoThrow(size_t  dwRequestedSiz
 
     size_t dwSize = AllocMem_TotalSize( cbAllocSize.Value());
     m_pAllocPtr += dwSize;
+    m_dwAllocatedBytes += dwSize;
 
 
     ((BYTE*&)pResult) += extra;
@@ -1911,6 +1966,157 @@ void *UnlockedLoaderHeap::UnlockedAllocMemForCode_NoThrow(size_t dwHeaderSize, s
     RETURN pResult;
 }
 
+void UnlockedLoaderHeap::UnlockedGetStatistics(Statistics *pStats)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    pStats->ReservedBytes = 0;
+    for (LoaderHeapBlock *pBlock = m_pFirstBlock; pBlock != NULL; pBlock = pBlock->pNext)
+    {
+        pStats->ReservedBytes += pBlock->dwVirtualSize;
+    }
+
+    pStats->FreeListBytes = 0;
+    for (LoaderHeapFreeBlock *pFree = m_pFirstFreeBlock; pFree != NULL; pFree = pFree->m_pNext)
+    {
+        pStats->FreeListBytes += pFree->m_dwSize;
+    }
+
+    pStats->CommittedBytes = m_dwTotalAlloc;
+    pStats->AllocatedBytes = m_dwAllocatedBytes;
+    pStats->ThreadRegionBytes = m_dwThreadRegionBytes;
+}
+
+// Fired whenever the heap reserves a new block and when it is destroyed. The committed bytes that are
+// neither allocated nor on the free list are the unused end of the current block and the ends of the
+// blocks that were too small for an allocation.
+void UnlockedLoaderHeap::UnlockedFireStatisticsEvent()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!EtwLoaderHeapStatisticsEnabled())
+        return;
+
+    Statistics stats;
+    UnlockedGetStatistics(&stats);
+    EtwLoaderHeapStatistics(this, stats);
+}
+
+void *UnlockedLoaderHeap::UnlockedAllocThreadRegion(size_t dwRegionSize,
+                                                    BYTE *pPrevAllocPtr,
+                                                    BYTE *pPrevEnd
+                                                    COMMA_INDEBUG(_In_ const char *szFile)
+                                                    COMMA_INDEBUG(int lineNum))
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    void *pRegion = UnlockedAllocMem_NoThrow(dwRegionSize COMMA_INDEBUG(szFile) COMMA_INDEBUG(lineNum));
+    if (pRegion == NULL)
+        return NULL;
+
+    m_dwThreadRegionBytes += dwRegionSize;
+
+    // The regions that a thread dropped for the region of another heap stay carved until the heap is destroyed
+    size_t dwRemainder = pPrevEnd - pPrevAllocPtr;
+    if (dwRemainder >= AllocMem_TotalSize(1))
+    {
+        LoaderHeapFreeBlock::InsertFreeBlock(&m_pFirstFreeBlock, pPrevAllocPtr, dwRemainder, this);
+        m_dwAllocatedBytes -= dwRemainder;
+        m_dwThreadRegionBytes -= dwRemainder;
+    }
+
+    return pRegion;
+}
+
+void LoaderHeap::EnableThreadRegions()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(!IsExecutable());
+    _ASSERTE(m_CriticalSection != NULL);
+
+#ifdef _DEBUG
+    // Call tracing records every allocation with the lock held
+    if (m_dwDebugFlags & kCallTracing)
+        return;
+#endif
+
+    m_fThreadRegions = TRUE;
+}
+
+void LoaderHeap::InvalidateThreadRegions()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    InterlockedIncrement((LONG*)&s_threadRegionEpoch);
+}
+
+// Returns NULL when the allocation has to be made with the lock held instead, including when the region
+// cannot be refilled.
+void *LoaderHeap::AllocMemFromThreadRegion(size_t dwRequestedSize
+                                           COMMA_INDEBUG(_In_ const char *szFile)
+                                           COMMA_INDEBUG(int lineNum))
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    // The allocation requests are traced with the lock held, in the order they are made
+    if (EtwAllocRequestEnabled())
+        return NULL;
+
+    size_t dwSize = AllocMem_TotalSize(dwRequestedSize);
+    LONG epoch = s_threadRegionEpoch;
+
+    LoaderHeapThreadRegion& region = t_threadRegions[((size_t)this / sizeof(LoaderHeap)) % NumThreadRegions];
+    BOOL fOwnRegion = (region.m_pHeap == this && region.m_epoch == epoch);
+
+    if (!fOwnRegion || (size_t)(region.m_pEnd - region.m_pAllocPtr) < dwSize)
+    {
+        CRITSEC_Holder csh(m_CriticalSection);
+
+        BYTE *pRegion = (BYTE *)UnlockedAllocThreadRegion(ThreadRegionSize,
+                                                          fOwnRegion ? region.m_pAllocPtr : NULL,
+                                                          fOwnRegion ? region.m_pEnd : NULL
+                                                          COMMA_INDEBUG(szFile)
+                                                          COMMA_INDEBUG(lineNum));
+        if (pRegion == NULL)
+            return NULL;
+
+        region.m_pHeap = this;
+        region.m_epoch = epoch;
+        region.m_pAllocPtr = pRegion;
+        region.m_pEnd = pRegion + ThreadRegionSize;
+    }
+
+    void *pData = region.m_pAllocPtr;
+    region.m_pAllocPtr += dwSize;
+
+#ifdef _DEBUG
+#if LOADER_HEAP_DEBUG_BOUNDARY > 0
+    memset((BYTE*)pData + dwRequestedSize, 0xEE, LOADER_HEAP_DEBUG_BOUNDARY);
+#endif
+
+    // Backout checks the tag of the block as for the blocks allocated with the lock held
+    LoaderHeapValidationTag *pTag = AllocMem_GetTag(pData, dwRequestedSize);
+    pTag->m_allocationType  = kAllocMem;
+    pTag->m_dwRequestedSize = dwRequestedSize;
+    pTag->m_szFile          = szFile;
+    pTag->m_lineNum         = lineNum;
+#endif
+
+    return pData;
+}
 
 #endif // #ifndef DACCESS_COMPILE
 
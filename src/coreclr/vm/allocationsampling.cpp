@@ -0,0 +1,219 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+#include "allocationsampling.h"
+#include "gcheaputilities.h"
+#include "eventtrace.h"
+#include "spinlock.h"
+
+#ifdef FEATURE_EVENT_TRACE
+
+namespace
+{
+    struct TrackedSample
+    {
+        // NULL for a free slot. Retired slots still own their handle, since handles cannot be destroyed
+        // at the end of a GC; the thread that reuses the slot destroys it.
+        OBJECTHANDLE Handle;
+        uint64_t SampleId;
+        uint32_t GCsSurvived;
+        uint32_t Generation;
+        bool Retired;
+    };
+
+    // Long-lived samples leave the table once they reach the oldest generation, so it only has to hold the
+    // young ones. Samples taken while it is full are reported but not tracked.
+    const uint32_t MaxTrackedSamples = 1024;
+
+    TrackedSample s_trackedSamples[MaxTrackedSamples];
+    Volatile<LONG> s_trackedSampleCount = 0;
+    DangerousNonHostedSpinLock s_trackedSamplesLock;
+
+    LONGLONG s_lastSampleId = 0;
+    uint32_t s_samplingInterval = 0;
+
+    uint32_t GetSamplingInterval()
+    {
+        WRAPPER_NO_CONTRACT;
+
+        if (s_samplingInterval == 0)
+        {
+            uint32_t interval = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_AllocationSamplingInterval);
+            s_samplingInterval = max(interval, (uint32_t)MIN_OBJECT_SIZE);
+        }
+        return s_samplingInterval;
+    }
+
+    // Draws the number of bytes until the next sample from an exponential distribution with a mean of the
+    // sampling interval, using the xorshift64* generator of the thread.
+    int64_t NextSamplingDistance()
+    {
+        WRAPPER_NO_CONTRACT;
+
+        uint64_t& state = t_runtime_thread_locals.alloc_sampling_random;
+        if (state == 0)
+        {
+            state = ((uint64_t)GetRandomInt(INT_MAX) << 32) | (uint64_t)GetRandomInt(INT_MAX) | 1;
+        }
+
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        uint64_t random = state * 0x2545F4914F6CDD1DULL;
+
+        // Uniform in (0, 1]
+        double u = (double)((random >> 11) + 1) * (1.0 / 9007199254740992.0);
+        return (int64_t)(-log(u) * GetSamplingInterval()) + 1;
+    }
+
+    void TrackSample(Object* pObject, uint64_t sampleId, uint32_t generation)
+    {
+        CONTRACTL
+        {
+            NOTHROW;
+            GC_NOTRIGGER;
+            MODE_COOPERATIVE;
+        }
+        CONTRACTL_END;
+
+        IGCHandleManager* pHandleManager = GCHandleUtilities::GetGCHandleManager();
+        OBJECTHANDLE handle = pHandleManager->GetGlobalHandleStore()->CreateHandleOfType(pObject, HNDTYPE_WEAK_SHORT);
+        if (handle == NULL)
+            return;
+
+        OBJECTHANDLE retiredHandle = handle;
+        {
+            DangerousNonHostedSpinLockHolder lockHolder(&s_trackedSamplesLock);
+
+            for (uint32_t i = 0; i < MaxTrackedSamples; i++)
+            {
+                TrackedSample& sample = s_trackedSamples[i];
+                if (sample.Handle != NULL && !sample.Retired)
+                    continue;
+
+                retiredHandle = sample.Handle;
+                sample.Handle = handle;
+                sample.SampleId = sampleId;
+                sample.GCsSurvived = 0;
+                sample.Generation = generation;
+                sample.Retired = false;
+                s_trackedSampleCount = s_trackedSampleCount + 1;
+                break;
+            }
+        }
+
+        // The handle of the slot that was reused, or the new one if the table is full
+        if (retiredHandle != NULL)
+            pHandleManager->DestroyHandleOfType(retiredHandle, HNDTYPE_WEAK_SHORT);
+    }
+}
+
+void AllocationSampling::OnSamplingPointReached(int64_t allocated, Object* pObject)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    RuntimeThreadLocals& locals = t_runtime_thread_locals;
+
+    // The first sampling point of the thread only starts the countdown, so that the bytes it allocated
+    // before sampling was enabled are not attributed to this object.
+    if (locals.alloc_sampling_next != 0)
+        locals.alloc_sampling_pending = pObject;
+
+    // Restarting the countdown at the current allocation is what the memoryless distribution allows,
+    // however far the previous sampling point was passed.
+    locals.alloc_sampling_next = allocated + NextSamplingDistance();
+}
+
+void AllocationSampling::SendSample(Object* pObject, GC_ALLOC_FLAGS flags)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    if (!ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, AllocationSampled))
+        return;
+
+    uint32_t allocationKind = 0;
+    if (flags & GC_ALLOC_LARGE_OBJECT_HEAP)
+        allocationKind = 1;
+    else if (flags & GC_ALLOC_PINNED_OBJECT_HEAP)
+        allocationKind = 2;
+
+    TypeHandle th = pObject->GetTypeHandle();
+    uint64_t sampleId = (uint64_t)InterlockedIncrement64(&s_lastSampleId);
+
+    // The TypeID is resolved to a name through the BulkType events, as for GCSampledObjectAllocation
+    ETW::TypeSystemLog::LogTypeAndParametersIfNecessary(
+        NULL,
+        th.AsTAddr(),
+        ETW::TypeSystemLog::kTypeLogBehaviorTakeLockAndLogIfFirstTime);
+
+    TrackSample(pObject, sampleId, GCHeapUtilities::GetGCHeap()->WhichGeneration(pObject));
+
+    FireEtwAllocationSampled(
+        allocationKind,
+        (LPVOID)th.AsTAddr(),
+        pObject,
+        (uint64_t)pObject->GetSize(),
+        GetSamplingInterval(),
+        sampleId,
+        GetClrInstanceId());
+}
+
+void AllocationSampling::OnGCDone(int condemned)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    if (s_trackedSampleCount == 0)
+        return;
+
+    IGCHeap* pHeap = GCHeapUtilities::GetGCHeap();
+    bool fireEvents = ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, AllocationSampleSurvival);
+
+    DangerousNonHostedSpinLockHolder lockHolder(&s_trackedSamplesLock);
+
+    for (uint32_t i = 0; i < MaxTrackedSamples; i++)
+    {
+        TrackedSample& sample = s_trackedSamples[i];
+        if (sample.Handle == NULL || sample.Retired)
+            continue;
+
+        Object* pObject = OBJECTREFToObject(ObjectFromHandle(sample.Handle));
+        SampleFate fate = SampleFateCollected;
+        if (pObject != NULL)
+        {
+            if (sample.Generation <= (uint32_t)condemned)
+                sample.GCsSurvived++;
+
+            sample.Generation = pHeap->WhichGeneration(pObject);
+            if (sample.Generation < (uint32_t)pHeap->GetMaxGeneration())
+                continue;
+
+            fate = SampleFateTenured;
+        }
+
+        if (fireEvents)
+            FireEtwAllocationSampleSurvival(sample.SampleId, (uint32_t)fate, sample.GCsSurvived, GetClrInstanceId());
+
+        sample.Retired = true;
+        s_trackedSampleCount = s_trackedSampleCount - 1;
+    }
+}
+
+#endif // FEATURE_EVENT_TRACE
@@ -0,0 +1,77 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef _ALLOCATIONSAMPLING_H_
+#define _ALLOCATIONSAMPLING_H_
+
+#ifdef FEATURE_EVENT_TRACE
+
+// Allocation sampling fires an AllocationSampled event, with the stack of the allocating thread, for a
+// random subset of the allocated objects whose size is proportional to the number of bytes allocated.
+// Each thread draws the number of bytes it allocates before its next sample from an exponential
+// distribution whose mean is the sampling interval, so the samples form a Poisson process over the bytes
+// allocated by the thread and an object of size S is sampled with probability 1 - exp(-S / interval).
+//
+// The JIT helpers allocate from the allocation context without calling into the runtime, so the number
+// of bytes allocated is only checked when the allocation context is refilled (and for the allocations
+// made by the runtime itself). The object that triggered the refill is sampled, which is the object
+// that contains the sampled byte up to the size of one allocation quantum.
+//
+// The sampled objects are tracked with short weak handles. At the end of each GC, the ones that were
+// collected or that reached the oldest generation get an AllocationSampleSurvival event with the number
+// of GCs they survived, and are no longer tracked.
+class AllocationSampling
+{
+public:
+    // The values of the Fate field of the AllocationSampleSurvival event
+    enum SampleFate
+    {
+        SampleFateCollected = 0,
+        SampleFateTenured = 1,
+    };
+
+    static bool IsEnabled()
+    {
+        WRAPPER_NO_CONTRACT;
+
+        return ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context,
+                                            TRACE_LEVEL_INFORMATION,
+                                            CLR_ALLOCATIONSAMPLING_KEYWORD);
+    }
+
+    // Called after each allocation from the thread's allocation context, before the object is initialized.
+    static void OnAllocation(gc_alloc_context* pAllocContext, Object* pObject)
+    {
+        WRAPPER_NO_CONTRACT;
+
+        // The bytes handed to the context less the part that has not been used yet
+        int64_t allocated = pAllocContext->alloc_bytes + pAllocContext->alloc_bytes_uoh
+            - (pAllocContext->alloc_limit - pAllocContext->alloc_ptr);
+
+        if (allocated >= t_runtime_thread_locals.alloc_sampling_next)
+            OnSamplingPointReached(allocated, pObject);
+    }
+
+    // Called once the object is initialized, fires the event if OnAllocation sampled it.
+    static void OnObjectPublished(Object* pObject, GC_ALLOC_FLAGS flags)
+    {
+        WRAPPER_NO_CONTRACT;
+
+        if (t_runtime_thread_locals.alloc_sampling_pending != pObject)
+            return;
+
+        t_runtime_thread_locals.alloc_sampling_pending = NULL;
+        SendSample(pObject, flags);
+    }
+
+    // Called at the end of each GC to report the fate of the tracked samples.
+    static void OnGCDone(int condemned);
+
+private:
+    static void OnSamplingPointReached(int64_t allocated, Object* pObject);
+    static void SendSample(Object* pObject, GC_ALLOC_FLAGS flags);
+};
+
+#endif // FEATURE_EVENT_TRACE
+
+#endif // _ALLOCATIONSAMPLING_H_
@@ -465,6 +465,8 @@ void AppDomain::ShutdownFreeLoaderAllocators()
 
     CrstHolder ch(GetLoaderAllocatorReferencesLock());
 
+    LoaderAllocatorUnloadPhaseHolder phase(LoaderAllocatorUnloadPhase::FreeHandles);
+
     // Shutdown the LoaderAllocators associated with collectible assemblies
     while (m_pDelayedLoaderAllocatorUnloadList != NULL)
     {
@@ -479,6 +481,7 @@ void AppDomain::ShutdownFreeLoaderAllocators()
         pCurrentLoaderAllocator->CleanupFailedTypeInit();
 
         pCurrentLoaderAllocator->CleanupHandles();
+        phase.AddLoaderAllocator();
 
         GCX_COOP();
         SystemDomain::System()->AddToDelayedUnloadList(pCurrentLoaderAllocator);
@@ -3998,11 +4001,13 @@ void SystemDomain::ProcessDelayedUnloadLoaderAllocators()
 
     // Delete collected loader allocators on the finalizer thread. We cannot offload it to appdomain unload thread because of
     // there is not guaranteed to be one, and it is not that expensive operation anyway.
+    LoaderAllocatorUnloadPhaseHolder phase(LoaderAllocatorUnloadPhase::Delete);
     while (pAllocatorsToDelete != NULL)
     {
         LoaderAllocator * pAllocator = pAllocatorsToDelete;
         pAllocatorsToDelete = pAllocator->m_pLoaderAllocatorDestroyNext;
         delete pAllocator;
+        phase.AddLoaderAllocator();
     }
 }
 
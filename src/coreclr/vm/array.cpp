@@ -305,8 +305,8 @@ MethodTable* Module::CreateArrayMethodTable(TypeHandle elemTypeHnd, CorElementTy
 
     // ArrayClass already includes one void*
     LoaderAllocator* pAllocator= this->GetLoaderAllocator();
-    BYTE* pMemory = (BYTE *)pamTracker->Track(pAllocator->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(cbArrayClass) +
-                                                                                            S_SIZE_T(cbMT)));
+    BYTE* pMemory = MethodTable::AllocateMethodTableMemory(pAllocator, pamTracker, cbArrayClass + cbCGCDescData,
+                                                           S_SIZE_T(cbArrayClass) + S_SIZE_T(cbMT));
 
     // Note: Memory allocated on loader heap is zero filled
     // memset(pMemory, 0, sizeof(ArrayClass) + cbMT);
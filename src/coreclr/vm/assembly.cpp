@@ -36,6 +36,7 @@
 #include "../md/compiler/custattr.h"
 
 #include "peimagelayout.inl"
+#include "startupcheckpoints.h"
 
 
 // Define these macro's to do strict validation for jit lock and class init entry leaks.
@@ -1408,6 +1409,7 @@ INT32 Assembly::ExecuteMainMethod(PTRARRAYREF *stringArgs, BOOL waitForOtherThre
 
             RunManagedStartup();
 
+            StartupCheckpoints::Record("main");
             hr = RunMain(pMeth, 1, &iRetVal, stringArgs);
 
             Thread::CleanUpForManagedThreadInNative(pThread);
@@ -28,7 +28,9 @@ CallCountingManager::CallCountingInfo::CallCountingInfo(NativeCodeVersion codeVe
     : m_codeVersion(codeVersion),
     m_callCountingStub(nullptr),
     m_remainingCallCount(0),
-    m_stage(Stage::Disabled)
+    m_stage(Stage::Disabled),
+    m_startTicks(0),
+    m_durationTicks(UINT64_MAX)
 {
     WRAPPER_NO_CONTRACT;
     _ASSERTE(!codeVersion.IsNull());
@@ -52,11 +54,17 @@ CallCountingManager::CallCountingInfo::CallCountingInfo(NativeCodeVersion codeVe
     : m_codeVersion(codeVersion),
     m_callCountingStub(nullptr),
     m_remainingCallCount(callCountThreshold),
-    m_stage(Stage::StubIsNotActive)
+    m_stage(Stage::StubIsNotActive),
+    m_startTicks(0),
+    m_durationTicks(UINT64_MAX)
 {
     WRAPPER_NO_CONTRACT;
     _ASSERTE(!codeVersion.IsNull());
     _ASSERTE(callCountThreshold != 0);
+
+    LARGE_INTEGER li;
+    QueryPerformanceCounter(&li);
+    m_startTicks = li.QuadPart;
 }
 
 CallCountingManager::CallCountingInfo::~CallCountingInfo()
@@ -66,6 +74,44 @@ CallCountingManager::CallCountingInfo::~CallCountingInfo()
     _ASSERTE(m_callCountingStub == nullptr);
 }
 
+void *CallCountingManager::CallCountingInfo::operator new(size_t size)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    // When enabled, start each info on its own cache line so that the remaining call count is not on the same cache line as
+    // another method's count. The allocation is preceded by a pointer to the start of the underlying allocation.
+    SIZE_T alignment =
+        g_pConfig->TieredCompilation_CallCountingCacheLineAligned() ? MAX_CACHE_LINE_SIZE : sizeof(void *);
+    S_SIZE_T allocationSize = S_SIZE_T(AlignUp(size, alignment)) + S_SIZE_T(alignment) + S_SIZE_T(sizeof(void *));
+    if (allocationSize.IsOverflow())
+    {
+        ThrowOutOfMemory();
+    }
+
+    BYTE *allocation = new BYTE[allocationSize.Value()];
+    BYTE *aligned = (BYTE *)AlignUp((SIZE_T)(allocation + sizeof(void *)), alignment);
+    _ASSERTE(aligned + size <= allocation + allocationSize.Value());
+
+    ((BYTE **)aligned)[-1] = allocation;
+    return aligned;
+}
+
+void CallCountingManager::CallCountingInfo::operator delete(void *p)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (p != nullptr)
+    {
+        delete[] ((BYTE **)p)[-1];
+    }
+}
+
 #endif // !DACCESS_COMPILE
 
 CallCountingManager::PTR_CallCountingInfo CallCountingManager::CallCountingInfo::From(PTR_CallCount remainingCallCountCell)
@@ -157,6 +203,12 @@ FORCEINLINE void CallCountingManager::CallCountingInfo::SetStage(Stage stage)
             {
                 ++s_activeCallCountingStubCount;
             }
+            if (stage == Stage::PendingCompletion)
+            {
+                LARGE_INTEGER li;
+                QueryPerformanceCounter(&li);
+                m_durationTicks = (UINT64)li.QuadPart - m_startTicks;
+            }
             break;
 
         case Stage::Complete:
@@ -178,6 +230,15 @@ FORCEINLINE void CallCountingManager::CallCountingInfo::SetStage(Stage stage)
 
     m_stage = stage;
 }
+
+// Returns the time it took for the code version to be called as many times as the call count threshold, or UINT64_MAX if the
+// threshold has not been reached. Since the threshold is the same for all code versions, a shorter duration indicates a higher
+// call rate. The duration may include time spent with call counting paused by the tiering delay, so it is an estimate.
+UINT64 CallCountingManager::CallCountingInfo::GetCallCountingDurationTicks() const
+{
+    WRAPPER_NO_CONTRACT;
+    return m_durationTicks;
+}
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -632,7 +693,10 @@ bool CallCountingManager::SetCodeEntryPoint(
                 {
                     GetAppDomain()
                         ->GetTieredCompilationManager()
-                        ->AsyncPromoteToTier1(activeCodeVersion, createTieringBackgroundWorkerRef);
+                        ->AsyncPromoteToTier1(
+                            activeCodeVersion,
+                            createTieringBackgroundWorkerRef,
+                            callCountingInfo->GetCallCountingDurationTicks());
                 }
                 methodDesc->SetCodeEntryPoint(codeEntryPoint);
                 callCountingInfo->SetStage(CallCountingInfo::Stage::Complete);
@@ -899,7 +963,10 @@ void CallCountingManager::CompleteCallCounting()
                 if (!codeVersion.GetILCodeVersion().HasAnyOptimizedNativeCodeVersion(codeVersion))
                 {
                     bool createTieringBackgroundWorker = false;
-                    tieredCompilationManager->AsyncPromoteToTier1(codeVersion, &createTieringBackgroundWorker);
+                    tieredCompilationManager->AsyncPromoteToTier1(
+                        codeVersion,
+                        &createTieringBackgroundWorker,
+                        callCountingInfo->GetCallCountingDurationTicks());
                     _ASSERTE(!createTieringBackgroundWorker); // the current thread is the background worker thread
                 }
 
@@ -1063,7 +1130,10 @@ void CallCountingManager::StopAllCallCounting(TieredCompilationManager *tieredCo
                 if (!codeVersion.GetILCodeVersion().HasAnyOptimizedNativeCodeVersion(codeVersion))
                 {
                     bool createTieringBackgroundWorker = false;
-                    tieredCompilationManager->AsyncPromoteToTier1(codeVersion, &createTieringBackgroundWorker);
+                    tieredCompilationManager->AsyncPromoteToTier1(
+                        codeVersion,
+                        &createTieringBackgroundWorker,
+                        callCountingInfo->GetCallCountingDurationTicks());
                     _ASSERTE(!createTieringBackgroundWorker); // the current thread is the background worker thread
                 }
 
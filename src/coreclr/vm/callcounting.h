@@ -51,6 +51,10 @@ Miscellaneous
     determined from it. On x64, it also indicates whether the stub is a short or long stub.
   - From a call counting stub, the call counting info can be determined using the remaining call count cell, and from the call
     counting info the code version and method can be determined
+- Call counting stubs decrement the remaining call count without synchronization. When many threads call the same or nearby
+  hot methods, the cache lines holding the counts bounce between cores. Optionally, each call counting info is allocated on its
+  own cache line so that counts of different methods don't share cache lines (see TC_CallCountingCacheLineAligned). Splitting
+  the count of one method across cores is not done, as the stubs only have a non-argument scratch register or two to work with.
 - Call counting is not stopped when the tiering delay is reactivated (often happens in larger and more realistic scenarios). The
   overhead necessary to stop and restart call counting (among other things, many methods will have to go through the prestub
   again) is greater than the overhead of completing call counting + calling the threshold-reached helper function, even for very
@@ -200,6 +204,10 @@ private:
         CallCount m_remainingCallCount;
         Stage m_stage;
 
+        // Used to estimate how frequently the code version is called, see GetCallCountingDurationTicks()
+        UINT64 m_startTicks;
+        UINT64 m_durationTicks;
+
     #ifndef DACCESS_COMPILE
     private:
         CallCountingInfo(NativeCodeVersion codeVersion);
@@ -207,6 +215,10 @@ private:
         static CallCountingInfo *CreateWithCallCountingDisabled(NativeCodeVersion codeVersion);
         CallCountingInfo(NativeCodeVersion codeVersion, CallCount callCountThreshold);
         ~CallCountingInfo();
+
+        // See TieredCompilation_CallCountingCacheLineAligned()
+        static void *operator new(size_t size);
+        static void operator delete(void *p);
     #endif
 
     public:
@@ -226,6 +238,7 @@ private:
     #ifndef DACCESS_COMPILE
     public:
         void SetStage(Stage stage);
+        UINT64 GetCallCountingDurationTicks() const;
     #endif
 
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -12,8 +12,15 @@
 BASEARRAYREF* CastCache::s_pTableRef = NULL;
 OBJECTHANDLE CastCache::s_sentinelTable = NULL;
 DWORD CastCache::s_lastFlushSize     = INITIAL_CACHE_SIZE;
+// starts at 1 so that zero-initialized per-thread caches are invalid.
+DWORD CastCache::s_flushEpoch        = 1;
+LONG64 CastCache::s_l0Hits           = 0;
+LONG64 CastCache::s_tableHits        = 0;
+LONG64 CastCache::s_misses           = 0;
 const DWORD CastCache::INITIAL_CACHE_SIZE;
 
+thread_local CastCache::CastCacheL0 CastCache::t_l0;
+
 BASEARRAYREF CastCache::CreateCastCache(DWORD size)
 {
     CONTRACTL
@@ -95,10 +102,70 @@ BOOL CastCache::MaybeReplaceCacheWithLarger(DWORD size)
         return FALSE;
     }
 
+    // the allocation could have triggered a GC, read the current table only now.
+    DWORD* oldTableData = TableData(*s_pTableRef);
+    if (TableMask(oldTableData) != 1)
+    {
+        // carry over what we have instead of starting cold.
+        // the new table is not published yet, so nobody else can be writing to it.
+        CopyEntries(oldTableData, TableData(newTable));
+    }
+
     SetObjectReference((OBJECTREF *)s_pTableRef, newTable);
     return TRUE;
 }
 
+void CastCache::CopyEntries(DWORD* fromTableData, DWORD* toTableData)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    DWORD fromCount = CacheElementCount(fromTableData);
+    for (DWORD i = 0; i < fromCount; i++)
+    {
+        CastCacheEntry* pFrom = &Elements(fromTableData)[i];
+
+        // same protocol as in TryGet - other threads may still be updating the old table.
+        DWORD version = VolatileLoad(&pFrom->version);
+        if (version == 0 || (version & 1) != 0)
+        {
+            continue;
+        }
+
+        TADDR source = pFrom->source;
+        TADDR targetAndResult = pFrom->targetAndResult;
+
+        VolatileLoadBarrier();
+        if (version != pFrom->version)
+        {
+            continue;
+        }
+
+        TADDR target = targetAndResult & ~(TADDR)1;
+        DWORD index = KeyToBucket(toTableData, source, target);
+        for (DWORD j = 0; j < BUCKET_SIZE;)
+        {
+            CastCacheEntry* pTo = &Elements(toTableData)[index];
+            if (pTo->version == 0)
+            {
+                pTo->source = source;
+                pTo->targetAndResult = targetAndResult;
+                pTo->version = (j << VERSION_NUM_SIZE) + 2;
+                break;
+            }
+
+            // quadratic reprobe, the entry is dropped if its bucket is already full
+            j++;
+            index = (index + j) & TableMask(toTableData);
+        }
+    }
+}
+
 void CastCache::FlushCurrentCache()
 {
     CONTRACTL
@@ -113,6 +180,34 @@ void CastCache::FlushCurrentCache()
     s_lastFlushSize = max(INITIAL_CACHE_SIZE, CacheElementCount(tableData));
 
     SetObjectReference((OBJECTREF *)s_pTableRef, ObjectFromHandle(s_sentinelTable));
+
+    // invalidate the per-thread caches.
+    InterlockedIncrement((LONG*)&s_flushEpoch);
+
+    LOG((LF_CLASSLOADER, LL_INFO100, "CastCache flushed: L0 hits %lld, table hits %lld, misses %lld\n",
+        VolatileLoad(&s_l0Hits), VolatileLoad(&s_tableHits), VolatileLoad(&s_misses)));
+}
+
+void CastCache::GetStatistics(UINT64* pL0Hits, UINT64* pTableHits, UINT64* pMisses)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    *pL0Hits = (UINT64)VolatileLoad(&s_l0Hits);
+    *pTableHits = (UINT64)VolatileLoad(&s_tableHits);
+    *pMisses = (UINT64)VolatileLoad(&s_misses);
+}
+
+void CastCache::PublishStatistics(CastCacheL0* pL0)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    InterlockedExchangeAdd64(&s_l0Hits, pL0->l0Hits);
+    InterlockedExchangeAdd64(&s_tableHits, pL0->tableHits);
+    InterlockedExchangeAdd64(&s_misses, pL0->misses);
+
+    pL0->l0Hits = 0;
+    pL0->tableHits = 0;
+    pL0->misses = 0;
 }
 
 void CastCache::Initialize()
@@ -153,6 +248,57 @@ TypeHandle::CastResult CastCache::TryGet(TADDR source, TADDR target)
     }
     CONTRACTL_END;
 
+    CastCacheL0* pL0 = &t_l0;
+
+    DWORD epoch = VolatileLoad(&s_flushEpoch);
+    if (pL0->epoch != epoch)
+    {
+        // flushed since this thread last looked, start over.
+        memset(pL0->sources, 0, sizeof(pL0->sources));
+        pL0->epoch = epoch;
+    }
+
+    TypeHandle::CastResult result;
+    DWORD l0Index = KeyToL0Index(source, target);
+    TADDR l0TargetAndResult = pL0->targetAndResults[l0Index] ^ target;
+    if (pL0->sources[l0Index] == source && l0TargetAndResult <= 1)
+    {
+        pL0->l0Hits++;
+        result = TypeHandle::CastResult(l0TargetAndResult);
+    }
+    else
+    {
+        result = TryGetFromTable(source, target);
+        if (result != TypeHandle::MaybeCast)
+        {
+            pL0->tableHits++;
+            pL0->sources[l0Index] = source;
+            pL0->targetAndResults[l0Index] = target | (TADDR)result;
+        }
+        else
+        {
+            pL0->misses++;
+        }
+    }
+
+    if (pL0->l0Hits + pL0->tableHits + pL0->misses >= STATISTICS_BATCH_SIZE)
+    {
+        PublishStatistics(pL0);
+    }
+
+    return result;
+}
+
+TypeHandle::CastResult CastCache::TryGetFromTable(TADDR source, TADDR target)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
     DWORD* tableData = TableData(*s_pTableRef);
 
     DWORD index = KeyToBucket(tableData, source, target);
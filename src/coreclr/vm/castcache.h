@@ -44,6 +44,12 @@
 //
 // Whenever we need to replace or resize the table, we simply allocate a new one and atomically
 // update the static handle. The old table may be still in use, but will eventually be collected by GC.
+// When resizing, the consistent entries of the old table are rehashed into the new one before it is published,
+// so growing the table does not cost the hit rate of a warm cache.
+//
+// In front of the shared table every thread has a small direct-mapped L0 cache of its recent lookups.
+// It keeps the hottest casts of a thread off the shared cache lines. Since the castability of fully loaded types
+// never changes, the only thing that invalidates the L0 caches is a flush, which bumps a global epoch.
 //
 class CastCache
 {
@@ -168,6 +174,10 @@ public:
     static void FlushCurrentCache();
     static void Initialize();
 
+    // Approximate number of lookups satisfied by the per-thread caches, by the shared table, and of misses.
+    // Threads publish their counts in batches, so the most recent lookups may not be reflected yet.
+    static void GetStatistics(UINT64* pL0Hits, UINT64* pTableHits, UINT64* pMisses);
+
 private:
 
 // The cache size is driven by demand and generally is fairly small. (casts are repetitive)
@@ -185,7 +195,7 @@ private:
     static const DWORD MAXIMUM_CACHE_SIZE = 512;  // make this lower than release to make it easier to reach this in tests.
 #else
     static const DWORD INITIAL_CACHE_SIZE = 128;  // MUST BE A POWER OF TWO
-    static const DWORD MAXIMUM_CACHE_SIZE = 4096; // 4096 * sizeof(CastCacheEntry) is 98304 bytes on 64bit. We will rarely need this much though.
+    static const DWORD MAXIMUM_CACHE_SIZE = 16384; // 16384 * sizeof(CastCacheEntry) is 393216 bytes on 64bit. Only interface-heavy apps get this far.
 #endif
 
 // Lower bucket size will cause the table to resize earlier
@@ -206,6 +216,33 @@ private:
 
     static DWORD          s_lastFlushSize;
 
+    // incremented on every flush, invalidates the per-thread caches.
+    static DWORD          s_flushEpoch;
+
+    // the per-thread cache has 16 entries, which is 256 bytes on 64bit.
+    static const DWORD L0_INDEX_BITS = 4;
+    static const DWORD L0_CACHE_SIZE = 1 << L0_INDEX_BITS;
+
+    // per-thread counts are published to the global counters once this many lookups have accumulated.
+    static const DWORD STATISTICS_BATCH_SIZE = 256;
+
+    struct CastCacheL0
+    {
+        DWORD               epoch;
+        DWORD               l0Hits;
+        DWORD               tableHits;
+        DWORD               misses;
+        TADDR               sources[L0_CACHE_SIZE];
+        // same encoding as CastCacheEntry::targetAndResult
+        TADDR               targetAndResults[L0_CACHE_SIZE];
+    };
+
+    static thread_local CastCacheL0 t_l0;
+
+    static LONG64         s_l0Hits;
+    static LONG64         s_tableHits;
+    static LONG64         s_misses;
+
     FORCEINLINE static TypeHandle::CastResult TryGetFromCache(TADDR source, TADDR target)
     {
         CONTRACTL
@@ -275,6 +312,20 @@ private:
 #endif
     }
 
+    FORCEINLINE static DWORD KeyToL0Index(TADDR source, TADDR target)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // same mixing as KeyToBucket, reduced to the L0 size.
+#if HOST_64BIT
+        UINT64 hash = (((UINT64)source << 32) | ((UINT64)source >> 32)) ^ (UINT64)target;
+        return (DWORD)((hash * 11400714819323198485llu) >> (64 - L0_INDEX_BITS));
+#else
+        UINT32 hash = (((UINT32)source << 16) | ((UINT32)source >> 16)) ^ (UINT32)target;
+        return (DWORD)((hash * 2654435769ul) >> (32 - L0_INDEX_BITS));
+#endif
+    }
+
     FORCEINLINE static DWORD* TableData(BASEARRAYREF table)
     {
         LIMITED_METHOD_CONTRACT;
@@ -318,6 +369,9 @@ private:
 
     static BASEARRAYREF CreateCastCache(DWORD size);
     static BOOL MaybeReplaceCacheWithLarger(DWORD size);
+    static void CopyEntries(DWORD* fromTableData, DWORD* toTableData);
+    static void PublishStatistics(CastCacheL0* pL0);
+    static TypeHandle::CastResult TryGetFromTable(TADDR source, TADDR target);
     static TypeHandle::CastResult TryGet(TADDR source, TADDR target);
     static void TrySet(TADDR source, TADDR target, BOOL result);
 
@@ -163,6 +163,7 @@
 #include "jithost.h"
 #include "pgo.h"
 #include "pendingload.h"
+#include "startupcheckpoints.h"
 
 #ifndef TARGET_UNIX
 #include "dwreport.h"
@@ -620,7 +621,7 @@ void EEStartupHelper()
     EX_TRY
     {
         g_fEEInit = true;
-
+        StartupCheckpoints::Record("ee_startup");
 
         // We cache the SystemInfo for anyone to use throughout the life of the EE.
         GetSystemInfo(&g_SystemInfo);
@@ -710,6 +711,17 @@ void EEStartupHelper()
             StressLog::Initialize(facilities, level, bytesPerThread, totalBytes, GetClrModuleBase(), logFilename);
             g_pStressLog = &StressLog::theLog;
         }
+        else if (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_FlightRecorder) != 0) {
+            // The flight recorder reuses the stress log buffers but only records a curated set of
+            // infrequent events, so it is cheap enough to leave on in production and its contents
+            // end up in dumps the same way the stress log does.
+            unsigned facilities = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_LogFacility,
+                LF_GC | LF_SYNC | LF_TIEREDCOMPILATION | LF_THREADPOOL);
+            unsigned bytesPerThread = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StressLogSize, STRESSLOG_CHUNK_SIZE);
+            unsigned totalBytes = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TotalStressLogSize, STRESSLOG_CHUNK_SIZE * 64);
+            StressLog::Initialize(facilities, LL_INFO10, bytesPerThread, totalBytes, GetClrModuleBase(), NULL);
+            g_pStressLog = &StressLog::theLog;
+        }
 #endif
 
 #ifdef FEATURE_PERFTRACING
@@ -919,6 +931,10 @@ void EEStartupHelper()
         // SampleProfiler needs to cooperate with the GC which hasn't fully finished setting up in the first part of the
         // EventPipe initialization, so this is done after the GC has been fully initialized.
         EventPipeAdapter::FinishInitialize();
+
+        // From here on startup checkpoints can be handed to EventPipe as they are reached.
+        StartupCheckpoints::Record("eventpipe_initialized");
+        StartupCheckpoints::Publish();
 #endif // FEATURE_PERFTRACING
         GenAnalysis::Initialize();
 
@@ -959,6 +975,7 @@ void EEStartupHelper()
         g_fEEInit = false;
 
         SystemDomain::System()->DefaultDomain()->LoadSystemAssemblies();
+        StartupCheckpoints::Record("corelib_loaded");
 
         SystemDomain::System()->DefaultDomain()->SetupSharedStatics();
 
@@ -981,6 +998,7 @@ void EEStartupHelper()
         g_EEStartupStatus = S_OK;
         hr = S_OK;
         STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "===================EEStartup Completed===================");
+        StartupCheckpoints::Record("ee_startup_complete");
 
 
 #ifdef _DEBUG
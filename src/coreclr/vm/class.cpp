@@ -53,6 +53,43 @@ void *EEClass::operator new(
     return p;
 }
 
+//*******************************************************************************
+/* static */
+InterfaceMapHash* InterfaceMapHash::Allocate(InterfaceInfo_t *pInterfaceMap, DWORD numInterfaces, LoaderHeap *pHeap, AllocMemTracker *pamTracker)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        INJECT_FAULT(COMPlusThrowOM());
+        PRECONDITION(numInterfaces >= INTERFACE_MAP_HASH_MIN_INTERFACES);
+        PRECONDITION(numInterfaces < UINT16_MAX);
+    }
+    CONTRACTL_END;
+
+    DWORD numBuckets = 1;
+    while (numBuckets < numInterfaces * 2)
+        numBuckets <<= 1;
+
+    S_SIZE_T cbHash = S_SIZE_T(offsetof(InterfaceMapHash, m_buckets)) + S_SIZE_T(numBuckets) * S_SIZE_T(sizeof(WORD));
+    InterfaceMapHash *pHash = (InterfaceMapHash *)pamTracker->Track(pHeap->AllocMem(cbHash));
+
+    // Loader heap memory is zero filled, so all buckets start out empty
+    pHash->m_numInterfaces = numInterfaces;
+    pHash->m_bucketMask = numBuckets - 1;
+
+    for (DWORD i = 0; i < numInterfaces; i++)
+    {
+        DWORD bucket = pInterfaceMap[i].GetMethodTable()->GetTypeDefRid() & pHash->m_bucketMask;
+        while (pHash->m_buckets[bucket] != 0)
+            bucket = (bucket + 1) & pHash->m_bucketMask;
+
+        pHash->m_buckets[bucket] = (WORD)(i + 1);
+    }
+
+    return pHash;
+}
+
 //*******************************************************************************
 void EEClass::Destruct(MethodTable * pOwningMT)
 {
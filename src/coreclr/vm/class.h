@@ -550,6 +550,33 @@ typedef struct
 // save memory and improve the density of accessed fields in the EEClasses themselves. This class is reached
 // via the m_rpOptionalFields field EEClass (use the GetOptionalFields() accessor rather than the field
 // itself).
+// Interface maps shorter than this are always searched linearly
+#define INTERFACE_MAP_HASH_MIN_INTERFACES 8
+
+//
+// Hashed index of a large interface map, used to find an exact interface in the map without a linear
+// scan. Buckets are keyed by the typedef rid of the interface. Every MethodTable sharing the EEClass has
+// an interface map of the same length, with the same generic interface definition at each position (only
+// the instantiations get replaced as exact interfaces are loaded), so the index is shared by all of them
+// and stays valid. Lookups still compare the MethodTable found in the map.
+//
+struct InterfaceMapHash
+{
+    // Length of the interface map the index was built for
+    DWORD m_numInterfaces;
+
+    // Number of buckets - 1. There are at least twice as many buckets as interfaces.
+    DWORD m_bucketMask;
+
+    // Index + 1 of an interface in the interface map, or 0 for an empty bucket (open addressing, linear probing)
+    WORD m_buckets[1];
+
+#ifndef DACCESS_COMPILE
+    static InterfaceMapHash* Allocate(InterfaceInfo_t *pInterfaceMap, DWORD numInterfaces, LoaderHeap *pHeap, AllocMemTracker *pamTracker);
+#endif
+};
+typedef DPTR(InterfaceMapHash) PTR_InterfaceMapHash;
+
 class EEClassOptionalFields
 {
     // All fields here are intentionally private. Use the corresponding accessor on EEClass instead (this
@@ -570,6 +597,13 @@ class EEClassOptionalFields
     // If NULL, this type has no type parameters that are co/contravariant
     PTR_BYTE m_pVarianceInfo;
 
+    //
+    // CASTING RELATED FIELDS.
+    //
+
+    // Index of the interface map for types with many interfaces, or NULL
+    PTR_InterfaceMapHash m_pInterfaceMapHash;
+
     //
     // COM RELATED FIELDS.
     //
@@ -1542,6 +1576,22 @@ public:
         GetOptionalFields()->m_pDictLayout = pLayout;
     }
 
+    PTR_InterfaceMapHash GetInterfaceMapHash()
+    {
+        SUPPORTS_DAC;
+        WRAPPER_NO_CONTRACT;
+        return HasOptionalFields() ? GetOptionalFields()->m_pInterfaceMapHash : NULL;
+    }
+
+#ifndef DACCESS_COMPILE
+    void SetInterfaceMapHash(InterfaceMapHash *pInterfaceMapHash)
+    {
+        LIMITED_METHOD_CONTRACT;
+        _ASSERTE(HasOptionalFields());
+        GetOptionalFields()->m_pInterfaceMapHash = pInterfaceMapHash;
+    }
+#endif // !DACCESS_COMPILE
+
 #ifndef DACCESS_COMPILE
     static CorGenericParamAttr GetVarianceOfTypeParameter(BYTE * pbVarianceInfo, DWORD i)
     {
@@ -21,6 +21,7 @@ inline void EEClassOptionalFields::Init()
     LIMITED_METHOD_CONTRACT;
     m_pDictLayout = NULL;
     m_pVarianceInfo = NULL;
+    m_pInterfaceMapHash = NULL;
 #ifdef FEATURE_COMINTEROP
     m_pSparseVTableMap = NULL;
     m_pCoClassForIntf = TypeHandle();
@@ -2770,6 +2770,10 @@ TypeHandle ClassLoader::PublishType(const TypeKey *pTypeKey, TypeHandle typeHnd)
         Module *pLoaderModule = ComputeLoaderModule(pTypeKey);
         EETypeHashTable *pTable = pLoaderModule->GetAvailableParamTypes();
 
+        // Allocate the entry before taking the lock, which every type published to this loader module contends on
+        AllocMemTracker amTracker;
+        EETypeHashEntry_t *pNewEntry = pTable->AllocNewEntry(&amTracker);
+
         CrstHolder ch(&pLoaderModule->GetClassLoader()->m_AvailableTypesLock);
 
         // The type could have been loaded by a different thread as side-effect of avoiding deadlocks caused by LoadsTypeViolation
@@ -2777,7 +2781,8 @@ TypeHandle ClassLoader::PublishType(const TypeKey *pTypeKey, TypeHandle typeHnd)
         if (!existing.IsNull())
             return existing;
 
-        pTable->InsertValue(typeHnd);
+        pTable->InsertValueUsingPreallocatedEntry(pNewEntry, typeHnd);
+        amTracker.SuppressRelease();
     }
     else
     {
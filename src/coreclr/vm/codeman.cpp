@@ -2334,6 +2334,32 @@ static size_t GetDefaultReserveForJumpStubs(size_t codeHeapSize)
 #endif
 }
 
+// Size of the large pages the optimized code heaps are reserved for.
+#define CODE_HEAP_LARGE_PAGE_SIZE (2 * 1024 * 1024)
+
+static bool UseLargePagesForOptimizedCodeHeaps()
+{
+    WRAPPER_NO_CONTRACT;
+
+    static ConfigDWORD configCodeHeapOptimizedCodeLargePages;
+    return configCodeHeapOptimizedCodeLargePages.val(CLRConfig::EXTERNAL_CodeHeapOptimizedCodeLargePages) != 0;
+}
+
+//
+// When enabled, tier-1 code is allocated in its own code heaps so that the hot
+// optimized code is packed together instead of being interleaved with tier-0
+// code and jump stubs. This reduces the number of pages (and iTLB entries) the
+// steady state of an application executes from.
+//
+static bool UseSeparateOptimizedCodeHeaps()
+{
+    WRAPPER_NO_CONTRACT;
+
+    static ConfigDWORD configCodeHeapSeparateOptimizedCode;
+    return (configCodeHeapSeparateOptimizedCode.val(CLRConfig::EXTERNAL_CodeHeapSeparateOptimizedCode) != 0) ||
+           UseLargePagesForOptimizedCodeHeaps();
+}
+
 HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap *pJitMetaHeap)
 {
     CONTRACT(HeapList *) {
@@ -2369,7 +2395,12 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
 #if defined(TARGET_AMD64) || defined(TARGET_ARM64) || defined(TARGET_LOONGARCH64) || defined(TARGET_RISCV64)
     allocationSize += pCodeHeap->m_LoaderHeap.AllocMem_TotalSize(JUMP_ALLOCATE_SIZE);
 #endif
-    pBaseAddr = (BYTE *)pInfo->m_pAllocator->GetCodeHeapInitialBlock(loAddr, hiAddr, (DWORD)allocationSize, &dwSizeAcquiredFromInitialBlock);
+    // Large page backed heaps need a reservation of their own, the initial block is too small for that
+    bool fUseLargePages = pInfo->IsOptimizedCode() && (loAddr == NULL) && (hiAddr == NULL) && UseLargePagesForOptimizedCodeHeaps();
+    if (!fUseLargePages)
+    {
+        pBaseAddr = (BYTE *)pInfo->m_pAllocator->GetCodeHeapInitialBlock(loAddr, hiAddr, (DWORD)allocationSize, &dwSizeAcquiredFromInitialBlock);
+    }
     if (pBaseAddr != NULL)
     {
         pCodeHeap->m_LoaderHeap.SetReservedRegion(pBaseAddr, dwSizeAcquiredFromInitialBlock, FALSE);
@@ -2415,6 +2446,11 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
             pBaseAddr = (BYTE*)ExecutableAllocator::Instance()->Reserve(reserveSize);
             if (!pBaseAddr)
                 ThrowOutOfMemory();
+
+            if (fUseLargePages && !ExecutableAllocator::Instance()->AdviseLargePages(pBaseAddr, reserveSize))
+            {
+                LOG((LF_JIT, LL_INFO100, "Large pages are not available for the optimized code heap at " FMT_ADDR "\n", DBG_ADDR(pBaseAddr)));
+            }
         }
         pCodeHeap->m_LoaderHeap.SetReservedRegion(pBaseAddr, reserveSize, TRUE);
     }
@@ -2451,9 +2487,11 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
     pHp->pHdrMap         = (DWORD*)(void*)pJitMetaHeap->AllocMem(S_SIZE_T(nibbleMapSize));
 
     pHp->pLoaderAllocator = pInfo->m_pAllocator;
+    pHp->isOptimizedCode = pInfo->IsOptimizedCode();
 
     LOG((LF_JIT, LL_INFO100,
-         "Created new CodeHeap(" FMT_ADDR ".." FMT_ADDR ")\n",
+         "Created new %sCodeHeap(" FMT_ADDR ".." FMT_ADDR ")\n",
+         pHp->isOptimizedCode ? "optimized " : "",
          DBG_ADDR(pHp->startAddress), DBG_ADDR(pHp->startAddress+pHp->maxCodeHeapSize)
          ));
 
@@ -2500,6 +2538,7 @@ void CodeHeapRequestInfo::Init()
         m_pAllocator = m_pMD->GetLoaderAllocator();
     m_isDynamicDomain = (m_pMD != NULL) && m_pMD->IsLCGMethod();
     m_isCollectible = m_pAllocator->IsCollectible();
+    m_isOptimizedCode = false;
     m_throwOnOutOfMemoryWithinRange = true;
 }
 
@@ -2586,6 +2625,14 @@ HeapList* EEJitManager::NewCodeHeap(CodeHeapRequestInfo *pInfo, DomainCodeHeapLi
         reserveSize = minReserveSize;
     reserveSize = ALIGN_UP(reserveSize, VIRTUAL_ALLOC_RESERVE_GRANULARITY);
 
+    if (pInfo->IsOptimizedCode() && (pInfo->m_loAddr == 0) && (pInfo->m_hiAddr == 0) && UseLargePagesForOptimizedCodeHeaps())
+    {
+        // The reservation is not guaranteed to be large page aligned. Reserving at least two
+        // large pages makes sure that it contains at least one fully aligned large page.
+        reserveSize = max(reserveSize, (size_t)(2 * CODE_HEAP_LARGE_PAGE_SIZE));
+        reserveSize = ALIGN_UP(reserveSize, CODE_HEAP_LARGE_PAGE_SIZE);
+    }
+
     pInfo->setReserveSize(reserveSize);
 
     HeapList *pHp = NULL;
@@ -2686,6 +2733,11 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
         pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap;
         pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap = NULL;
     }
+    else if (pInfo->IsOptimizedCode())
+    {
+        pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedOptimizedCodeHeap;
+        pInfo->m_pAllocator->m_pLastUsedOptimizedCodeHeap = NULL;
+    }
     else
     {
         pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedCodeHeap;
@@ -2746,6 +2798,10 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
     {
         pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap = pCodeHeap;
     }
+    else if (pInfo->IsOptimizedCode())
+    {
+        pInfo->m_pAllocator->m_pLastUsedOptimizedCodeHeap = pCodeHeap;
+    }
     else
     {
         pInfo->m_pAllocator->m_pLastUsedCodeHeap = pCodeHeap;
@@ -2765,7 +2821,7 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
     RETURN(mem);
 }
 
-void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
+void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool fOptimizedCode, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
                              size_t* pAllocatedSize, HeapList** ppCodeHeap
                            , BYTE** ppRealHeader
 #ifdef FEATURE_EH_FUNCLETS
@@ -2820,6 +2876,11 @@ void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveFo
 #endif
     requestInfo.setReserveForJumpStubs(reserveForJumpStubs);
 
+    if (fOptimizedCode && !requestInfo.IsDynamicDomain() && UseSeparateOptimizedCodeHeaps())
+    {
+        requestInfo.SetOptimizedCode();
+    }
+
 #ifdef FEATURE_EH_FUNCLETS
     SIZE_T realHeaderSize = offsetof(RealCodeHeader, unwindInfos[0]) + (sizeof(T_RUNTIME_FUNCTION) * nUnwindInfos);
 #else
@@ -2958,6 +3019,12 @@ bool EEJitManager::CanUseCodeHeap(CodeHeapRequestInfo *pInfo, HeapList *pCodeHea
             _ASSERTE(pCodeHeap->reserveForJumpStubs == 0);
             retVal = true;
         }
+        else if (pCodeHeap->isOptimizedCode != pInfo->IsOptimizedCode())
+        {
+            // Keep tier-1 code apart from tier-0 code and stubs. Requests with an address
+            // range constraint (jump stubs) are allowed to use either kind of heap below.
+            retVal = false;
+        }
         else
         {
             BYTE * lastAddr = (BYTE *) pCodeHeap->startAddress + pCodeHeap->maxCodeHeapSize;
@@ -3549,6 +3616,10 @@ void EEJitManager::FreeCodeMemory(HostCodeHeap *pCodeHeap, void * codeStart)
     // The caller of this method doesn't call HostCodeHeap->FreeMemForCode
     // directly because the operation should be protected by m_CodeHeapCritSec.
     pCodeHeap->FreeMemForCode(codeStart);
+
+#ifdef FEATURE_EH_FUNCLETS
+    EECodeInfo::InvalidateCachedLookups();
+#endif // FEATURE_EH_FUNCLETS
 }
 
 void ExecutionManager::CleanupCodeHeaps()
@@ -4782,6 +4853,10 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
     RangeSection *pCurr = FindCodeRangeWithLock(pStartRange);
     GetCodeRangeMap()->RemoveRangeSection(pCurr);
 
+#ifdef FEATURE_EH_FUNCLETS
+    EECodeInfo::InvalidateCachedLookups();
+#endif // FEATURE_EH_FUNCLETS
+
 
 #if defined(TARGET_AMD64)
     PTR_UnwindInfoTable unwindTable = pCurr->_pUnwindInfoTable;
@@ -4875,6 +4950,15 @@ void ExecutionManager::Unload(LoaderAllocator *pLoaderAllocator)
     }
 
     GetEEJitManager()->Unload(pLoaderAllocator);
+
+#ifdef FEATURE_EH_FUNCLETS
+    EECodeInfo::InvalidateCachedLookups();
+#endif // FEATURE_EH_FUNCLETS
+
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+    // The GC info of collectible methods is freed along with the loader allocator
+    GcInfoDecoder::InvalidateLiveSlotCaches();
+#endif // GCINFODECODER_LIVE_SLOT_CACHE
 }
 
 // This method is used by the JIT and the runtime for PreStubs. It will return
@@ -274,6 +274,7 @@ struct CodeHeapRequestInfo
     size_t       m_reserveForJumpStubs; // Amount to reserve for jump stubs (won't be allocated)
     bool         m_isDynamicDomain;
     bool         m_isCollectible;
+    bool         m_isOptimizedCode;  // request is for tier-1 code that should go into the optimized code heaps
     bool         m_throwOnOutOfMemoryWithinRange;
 
     bool   IsDynamicDomain()                    { return m_isDynamicDomain;    }
@@ -281,6 +282,9 @@ struct CodeHeapRequestInfo
 
     bool   IsCollectible()                      { return m_isCollectible;      }
 
+    bool   IsOptimizedCode()                    { return m_isOptimizedCode;    }
+    void   SetOptimizedCode()                   { m_isOptimizedCode = true;    }
+
     size_t getRequestSize()                     { return m_requestSize;        }
     void   setRequestSize(size_t requestSize)   { m_requestSize = requestSize; }
 
@@ -384,6 +388,7 @@ struct HeapList
     size_t              reserveForJumpStubs; // Amount of memory reserved for jump stubs in this block
 
     PTR_LoaderAllocator pLoaderAllocator; // LoaderAllocator of HeapList
+    bool                isOptimizedCode; // Heap only holds tier-1 code (see CodeHeapRequestInfo::IsOptimizedCode)
 #if defined(TARGET_AMD64) || defined(TARGET_ARM64) || defined(TARGET_LOONGARCH64) || defined(TARGET_RISCV64)
     BYTE*               CLRPersonalityRoutine;  // jump thunk to personality routine
 #endif
@@ -1773,7 +1778,7 @@ public:
 
     BOOL                LoadJIT();
 
-    void                allocCode(MethodDesc* pFD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
+    void                allocCode(MethodDesc* pFD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool fOptimizedCode, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
                                   size_t* pAllocatedSize, HeapList** ppCodeHeap
                                 , BYTE** ppRealHeader
 #ifdef FEATURE_EH_FUNCLETS
@@ -2438,6 +2443,17 @@ public:
     void Init(PCODE codeAddress);
     void Init(PCODE codeAddress, ExecutionManager::ScanFlag scanFlag);
 
+#if defined(FEATURE_EH_FUNCLETS) && !defined(DACCESS_COMPILE)
+    // Same as Init, but reuses the result of an earlier lookup of the same address on this
+    // thread, including the function entry. Used by exception dispatch, which walks the same
+    // frames every time an exception is thrown from the same place.
+    void InitCached(PCODE codeAddress, ExecutionManager::ScanFlag scanFlag);
+
+    // Must be called whenever code may be freed, so that a new method allocated at the same
+    // address is not resolved from a stale cache entry.
+    static void InvalidateCachedLookups();
+#endif // FEATURE_EH_FUNCLETS && !DACCESS_COMPILE
+
     TADDR       GetSavedMethodCode();
 
     TADDR       GetStartAddress();
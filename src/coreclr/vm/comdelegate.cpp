@@ -2168,6 +2168,12 @@ extern "C" PCODE QCALLTYPE Delegate_GetMulticastInvokeSlow(MethodTable* pDelegat
 
         DWORD dwLoopCounterNum = pCode->NewLocal(ELEMENT_TYPE_I4);
 
+        // Delegates are immutable, so the invocation list and count are loaded once rather than on each iteration
+        LocalDesc invocationListType(ELEMENT_TYPE_OBJECT);
+        invocationListType.MakeArray();
+        DWORD dwInvocationListNum = pCode->NewLocal(invocationListType);
+        DWORD dwInvocationCountNum = pCode->NewLocal(ELEMENT_TYPE_I);
+
         DWORD dwReturnValNum = -1;
         if (fReturnVal)
             dwReturnValNum = pCode->NewLocal(sig.GetRetTypeHandleNT());
@@ -2175,6 +2181,14 @@ extern "C" PCODE QCALLTYPE Delegate_GetMulticastInvokeSlow(MethodTable* pDelegat
         ILCodeLabel *nextDelegate = pCode->NewCodeLabel();
         ILCodeLabel *checkCount = pCode->NewCodeLabel();
 
+        pCode->EmitLoadThis();
+        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_LIST)));
+        pCode->EmitSTLOC(dwInvocationListNum);
+
+        pCode->EmitLoadThis();
+        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_COUNT)));
+        pCode->EmitSTLOC(dwInvocationCountNum);
+
         // initialize counter
         pCode->EmitLDC(0);
         pCode->EmitSTLOC(dwLoopCounterNum);
@@ -2186,8 +2200,7 @@ extern "C" PCODE QCALLTYPE Delegate_GetMulticastInvokeSlow(MethodTable* pDelegat
         pCode->EmitLabel(nextDelegate);
 
         // Load next delegate from array using LoopCounter as index
-        pCode->EmitLoadThis();
-        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_LIST)));
+        pCode->EmitLDLOC(dwInvocationListNum);
         pCode->EmitLDLOC(dwLoopCounterNum);
         pCode->EmitLDELEM_REF();
 
@@ -2230,8 +2243,7 @@ extern "C" PCODE QCALLTYPE Delegate_GetMulticastInvokeSlow(MethodTable* pDelegat
 
         // compare LoopCounter with InvocationCount. If less then branch to nextDelegate
         pCode->EmitLDLOC(dwLoopCounterNum);
-        pCode->EmitLoadThis();
-        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_COUNT)));
+        pCode->EmitLDLOC(dwInvocationCountNum);
         pCode->EmitBLT(nextDelegate);
 
         // load the return value. return value from the last delegate call is returned
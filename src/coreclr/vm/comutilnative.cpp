@@ -33,6 +33,7 @@
 #include "typestring.h"
 #include "finalizerthread.h"
 #include "threadsuspend.h"
+#include "frozenobjectheap.h"
 
 #ifdef FEATURE_COMINTEROP
     #include "comcallablewrapper.h"
@@ -502,6 +503,23 @@ extern "C" void QCALLTYPE Buffer_Clear(void *dst, size_t length)
 
         dst = ALIGN_UP((uint8_t*)dst + 1, 32);
         length = ALIGN_DOWN((uint8_t*)end - 1, 32) - (uint8_t*)dst;
+
+#if defined(HOST_AMD64)
+        if (length >= NonTemporalStoreThreshold)
+        {
+            // Clear very large blocks without pulling them into the cache
+            __m128 zero = _mm_setzero_ps();
+            for (uint8_t* p = (uint8_t*)dst; p < (uint8_t*)dst + length; p += 32)
+            {
+                _mm_stream_ps((float*)p, zero);
+                _mm_stream_ps((float*)(p + 16), zero);
+            }
+
+            // Non-temporal stores are weakly ordered
+            _mm_sfence();
+            return;
+        }
+#endif
     }
 #endif
 
@@ -869,6 +887,24 @@ extern "C" void* QCALLTYPE GCInterface_GetNextFinalizableObject(QCall::ObjectHan
     return (void*)funcPtr;
 }
 
+// Number of objects that are ready for finalization but haven't been handed to a finalizer
+// thread yet, for instance to report as an event counter.
+extern "C" INT64 QCALLTYPE GCInterface_GetFinalizationBacklog()
+{
+    QCALL_CONTRACT;
+
+    INT64 iRetVal = 0;
+
+    BEGIN_QCALL;
+
+    GCX_COOP();
+    iRetVal = (INT64) GCHeapUtilities::GetGCHeap()->GetNumberOfFinalizable();
+
+    END_QCALL;
+
+    return iRetVal;
+}
+
 /*==========================WaitForPendingFinalizers============================
 **Action: Run all Finalizers that haven't been run.
 **Arguments: None
@@ -1064,6 +1100,43 @@ extern "C" void QCALLTYPE GCInterface_UnregisterFrozenSegment(void* segment)
     END_QCALL;
 }
 
+/*===============================FreezeObjectGraph===============================
+**Action: Copies an immutable object graph onto a frozen segment
+**Returns: TRUE and the frozen copy of the root in ret, FALSE if the graph can't be frozen
+**Arguments: args-> root of the graph
+**Exceptions: OutOfMemoryException
+==============================================================================*/
+extern "C" BOOL QCALLTYPE GCInterface_FreezeObjectGraph(QCall::ObjectHandleOnStack pRoot, QCall::ObjectHandleOnStack ret)
+{
+    QCALL_CONTRACT;
+
+    BOOL frozen = FALSE;
+
+    BEGIN_QCALL;
+
+    GCX_COOP();
+
+    // Checked by the caller
+    _ASSERTE(pRoot.Get() != NULL);
+
+    Object* frozenRoot = nullptr;
+    OBJECTREF root = pRoot.Get();
+    GCPROTECT_BEGIN(root);
+    FrozenObjectHeapManager* foh = SystemDomain::GetFrozenObjectHeapManager();
+    frozenRoot = foh->TryFreezeObjectGraph(&root);
+    GCPROTECT_END();
+
+    if (frozenRoot != nullptr)
+    {
+        ret.Set(ObjectToOBJECTREF(frozenRoot));
+        frozen = TRUE;
+    }
+
+    END_QCALL;
+
+    return frozen;
+}
+
 #endif // FEATURE_BASICFREEZE
 
 /*==============================SuppressFinalize================================
@@ -210,11 +210,15 @@ extern "C" void QCALLTYPE GCInterface_Collect(INT32 generation, INT32 mode);
 
 extern "C" void* QCALLTYPE GCInterface_GetNextFinalizableObject(QCall::ObjectHandleOnStack pObj);
 
+extern "C" INT64 QCALLTYPE GCInterface_GetFinalizationBacklog();
+
 extern "C" void QCALLTYPE GCInterface_WaitForPendingFinalizers();
 #ifdef FEATURE_BASICFREEZE
 extern "C" void* QCALLTYPE GCInterface_RegisterFrozenSegment(void *pSection, SIZE_T sizeSection);
 
 extern "C" void QCALLTYPE GCInterface_UnregisterFrozenSegment(void *segmentHandle);
+
+extern "C" BOOL QCALLTYPE GCInterface_FreezeObjectGraph(QCall::ObjectHandleOnStack pRoot, QCall::ObjectHandleOnStack ret);
 #endif // FEATURE_BASICFREEZE
 
 extern "C" int QCALLTYPE GCInterface_WaitForFullGCApproach(int millisecondsTimeout);
@@ -558,8 +558,10 @@ DEFINE_FIELD(BYREFERENCE,           VALUE,                  Value)
 DEFINE_CLASS(SPAN,                  System,                 Span`1)
 DEFINE_METHOD(SPAN,                 CTOR_PTR_INT,           .ctor, IM_VoidPtr_Int_RetVoid)
 DEFINE_METHOD(SPAN,                 GET_ITEM,               get_Item, IM_Int_RetRefT)
+DEFINE_METHOD(SPAN,                 GET_PINNABLE_REFERENCE, GetPinnableReference, IM_RetRefT)
 DEFINE_CLASS(READONLY_SPAN,         System,                 ReadOnlySpan`1)
 DEFINE_METHOD(READONLY_SPAN,        GET_ITEM,               get_Item, IM_Int_RetReadOnlyRefT)
+DEFINE_METHOD(READONLY_SPAN,        GET_PINNABLE_REFERENCE, GetPinnableReference, IM_RetReadOnlyRefT)
 
 // Defined as element type alias
 // DEFINE_CLASS(OBJECT,                System,                 Object)
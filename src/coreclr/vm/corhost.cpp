@@ -37,6 +37,7 @@
 #endif // !TARGET_UNIX
 
 #include "nativelibrary.h"
+#include "typepreloader.h"
 
 #ifndef DACCESS_COMPILE
 
@@ -325,6 +326,18 @@ HRESULT CorHost2::ExecuteAssembly(DWORD dwAppDomainId,
     pCurDomain->GetMulticoreJitManager().AutoStartProfile(pCurDomain);
 #endif // defined(FEATURE_MULTICOREJIT)
 
+    TypePreloader::StartFromConfig();
+
+#ifdef LOGGING
+    if (ExecutableAllocator::IsWXORXEnabled())
+    {
+        ExecutableAllocator::MappingStatistics mappingStatistics;
+        ExecutableAllocator::Instance()->GetMappingStatistics(&mappingStatistics);
+        LOG((LF_STARTUP, LL_INFO10, "W^X before Main: %llu MapRW calls, %llu RW mappings created, %llu released\n",
+            mappingStatistics.MapRWCalls, mappingStatistics.RWMappingsCreated, mappingStatistics.RWMappingsReleased));
+    }
+#endif // LOGGING
+
     {
         GCX_COOP();
 
@@ -586,6 +599,7 @@ HRESULT CorHost2::CreateAppDomainWithManager(
 
     LPCWSTR pwzNativeDllSearchDirectories = NULL;
     LPCWSTR pwzTrustedPlatformAssemblies = NULL;
+    LPCWSTR pwzTrustedPlatformAssembliesIndex = NULL;
     LPCWSTR pwzPlatformResourceRoots = NULL;
     LPCWSTR pwzAppPaths = NULL;
 
@@ -601,6 +615,11 @@ HRESULT CorHost2::CreateAppDomainWithManager(
             pwzTrustedPlatformAssemblies = pPropertyValues[i];
         }
         else
+        if (u16_strcmp(pPropertyNames[i], _T(HOST_PROPERTY_TRUSTED_PLATFORM_ASSEMBLIES_INDEX)) == 0)
+        {
+            pwzTrustedPlatformAssembliesIndex = pPropertyValues[i];
+        }
+        else
         if (u16_strcmp(pPropertyNames[i], _T(HOST_PROPERTY_PLATFORM_RESOURCE_ROOTS)) == 0)
         {
             pwzPlatformResourceRoots = pPropertyValues[i];
@@ -628,6 +647,7 @@ HRESULT CorHost2::CreateAppDomainWithManager(
 
     {
         SString sTrustedPlatformAssemblies(pwzTrustedPlatformAssemblies);
+        SString sTrustedPlatformAssembliesIndex(pwzTrustedPlatformAssembliesIndex);
         SString sPlatformResourceRoots(pwzPlatformResourceRoots);
         SString sAppPaths(pwzAppPaths);
 
@@ -635,6 +655,7 @@ HRESULT CorHost2::CreateAppDomainWithManager(
         _ASSERTE(pBinder != NULL);
         IfFailThrow(pBinder->SetupBindingPaths(
             sTrustedPlatformAssemblies,
+            sTrustedPlatformAssembliesIndex,
             sPlatformResourceRoots,
             sAppPaths));
     }
@@ -256,6 +256,21 @@ protected:
     // manner) and associated with the given hash value. The entry should have been initialized prior to
     // insertion.
     void BaseInsertEntry(DacEnumerableHashValue iHash, VALUE *pEntry);
+
+    // Shape of the current bucket list. The average number of entries a successful lookup walks is
+    // m_cTotalProbes / m_cEntries.
+    struct BaseStatistics
+    {
+        DWORD   m_cBuckets;
+        DWORD   m_cEntries;
+        DWORD   m_cEmptyBuckets;
+        DWORD   m_cLongestChain;
+        UINT64  m_cTotalProbes;
+    };
+
+    // Walks the whole bucket list, so this is meant for diagnostics rather than for use on hot paths.
+    // Must be serialized with insertions like BaseInsertEntry.
+    void BaseGetStatistics(BaseStatistics *pStats);
 #endif // !DACCESS_COMPILE
 
     // Return the number of entries held in the table (does not include entries allocated but not inserted
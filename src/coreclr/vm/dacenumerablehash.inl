@@ -184,6 +184,19 @@ void DacEnumerableHashTable<DAC_ENUM_HASH_ARGS>::GrowTable()
     DPTR(PTR_VolatileEntry) curBuckets = GetBuckets();
     DWORD cBuckets = GetLength(curBuckets);
 
+#ifdef LOGGING
+    if (LoggingOn(LF_CLASSLOADER, LL_INFO100))
+    {
+        BaseStatistics stats;
+        BaseGetStatistics(&stats);
+        UINT64 probesPer100Entries = stats.m_cTotalProbes * 100 / max(stats.m_cEntries, (DWORD)1);
+        LOG((LF_CLASSLOADER, LL_INFO100,
+             "DacEnumerableHashTable %p: growing with %u entries in %u buckets, %u empty buckets, longest chain %u, average probe length %u.%02u\n",
+             this, stats.m_cEntries, stats.m_cBuckets, stats.m_cEmptyBuckets, stats.m_cLongestChain,
+             (DWORD)(probesPer100Entries / 100), (DWORD)(probesPer100Entries % 100)));
+    }
+#endif // LOGGING
+
     // Make the new bucket table larger by the scale factor requested by the subclass (but also prime).
     DWORD cNewBuckets = NextLargestPrime(cBuckets * SCALE_FACTOR);
 
@@ -280,6 +293,47 @@ void DacEnumerableHashTable<DAC_ENUM_HASH_ARGS>::GrowTable()
     VolatileStore(&m_pBuckets, pNewBuckets);
 }
 
+// Computes the shape of the current bucket list. Must be serialized with insertions, which also rules out a
+// concurrent GrowTable.
+template <DAC_ENUM_HASH_PARAMS>
+void DacEnumerableHashTable<DAC_ENUM_HASH_ARGS>::BaseGetStatistics(BaseStatistics *pStats)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        PRECONDITION(CheckPointer(pStats));
+    }
+    CONTRACTL_END;
+
+    DPTR(PTR_VolatileEntry) curBuckets = GetBuckets();
+    DWORD cBuckets = GetLength(curBuckets);
+
+    pStats->m_cBuckets = cBuckets;
+    pStats->m_cEntries = m_cEntries;
+    pStats->m_cEmptyBuckets = 0;
+    pStats->m_cLongestChain = 0;
+    pStats->m_cTotalProbes = 0;
+
+    for (DWORD i = 0; i < cBuckets; i++)
+    {
+        DWORD cChain = 0;
+        for (PTR_VolatileEntry pEntry = curBuckets[i + SKIP_SPECIAL_SLOTS]; !IsEndSentinel(pEntry); pEntry = pEntry->m_pNextEntry)
+        {
+            cChain++;
+
+            // Finding the entry walks it and all the ones ahead of it in the chain
+            pStats->m_cTotalProbes += cChain;
+        }
+
+        if (cChain == 0)
+            pStats->m_cEmptyBuckets++;
+        if (cChain > pStats->m_cLongestChain)
+            pStats->m_cLongestChain = cChain;
+    }
+}
+
 // Returns the next prime larger (or equal to) than the number given.
 template <DAC_ENUM_HASH_PARAMS>
 DWORD DacEnumerableHashTable<DAC_ENUM_HASH_ARGS>::NextLargestPrime(DWORD dwNumber)
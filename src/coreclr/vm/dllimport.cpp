@@ -4209,6 +4209,69 @@ namespace
 
         pCache->AddMethodDescChunkWithLockTaken(pMD);
     }
+
+    bool IsCollectibleTypeHandle(TypeHandle th)
+    {
+        WRAPPER_NO_CONTRACT;
+
+        return !th.IsNull() && th.GetLoaderAllocator()->IsCollectible();
+    }
+
+    // Shared stubs of collectible assemblies are normally cached (and freed) with their LoaderAllocator.
+    // When nothing the stub references can be unloaded, the stub is cached in CoreLib instead so that
+    // every LoaderAllocator using the same signature shares it and it survives the unload.
+    bool CanShareStubAcrossLoaderAllocators(
+        StubSigDesc*    pSigDesc,
+        DWORD           dwStubFlags,
+        int             nParamTokens,
+        mdParamDef*     pParamTokenArray)
+    {
+        STANDARD_VM_CONTRACT;
+
+        if (!SF_IsSharedStub(dwStubFlags))
+            return false;
+
+        if (!pSigDesc->m_pLoaderModule->GetLoaderAllocator()->IsCollectible())
+            return false;
+
+        static ConfigDWORD shareILStubs;
+        if (shareILStubs.val(CLRConfig::UNSUPPORTED_ShareILStubsAcrossLoaderAllocators) == 0)
+            return false;
+
+        if (pSigDesc->m_pMT != NULL && pSigDesc->m_pMT->Collectible())
+            return false;
+
+        // Custom marshalers and safe array element types are resolved by name against the module
+        // that declares the signature, so the hash blob does not identify them across modules.
+        IMDInternalImport* pInternalImport = pSigDesc->m_pModule->GetMDImport();
+        for (int idx = 0; idx < nParamTokens; idx++)
+        {
+            mdParamDef token = pParamTokenArray[idx];
+            if (TypeFromToken(token) != mdtParamDef || token == mdParamDefNil)
+                continue;
+
+            PCCOR_SIGNATURE pvNativeType;
+            ULONG cbNativeType;
+            if (pInternalImport->GetFieldMarshal(token, &pvNativeType, &cbNativeType) != S_OK || cbNativeType == 0)
+                continue;
+
+            if (*pvNativeType == NATIVE_TYPE_CUSTOMMARSHALER || *pvNativeType == NATIVE_TYPE_SAFEARRAY)
+                return false;
+        }
+
+        MetaSig msig(pSigDesc->m_sig, pSigDesc->m_pModule, &pSigDesc->m_typeContext);
+
+        if (IsCollectibleTypeHandle(msig.GetRetTypeHandleThrowing()))
+            return false;
+
+        while (msig.NextArg() != ELEMENT_TYPE_END)
+        {
+            if (IsCollectibleTypeHandle(msig.GetLastTypeHandleThrowing()))
+                return false;
+        }
+
+        return true;
+    }
 }
 
 //
@@ -4842,6 +4905,10 @@ namespace
         }
 #endif // FEATURE_COMINTEROP
 
+        // The loader module selects both the ILStubCache and the module of the stub MethodTable
+        if (CanShareStubAcrossLoaderAllocators(pSigDesc, dwStubFlags, nParamTokens, pParamTokenArray))
+            pLoaderModule = SystemDomain::SystemModule();
+
         // Otherwise, fall back to generating IL stub on-the-fly
         NDirectStubParameters    params(pSigDesc->m_sig,
                                 &pSigDesc->m_typeContext,
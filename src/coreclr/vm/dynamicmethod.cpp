@@ -467,6 +467,7 @@ HeapList* HostCodeHeap::InitializeHeapList(CodeHeapRequestInfo *pInfo)
 
     pHp->maxCodeHeapSize = m_TotalBytesAvailable - (pTracker ? pTracker->size : 0);
     pHp->reserveForJumpStubs = 0;
+    pHp->isOptimizedCode = false;
 
 #ifdef HOST_64BIT
     ExecutableWriterHolder<BYTE> personalityRoutineWriterHolder(pHp->CLRPersonalityRoutine, 12);
@@ -1046,6 +1047,11 @@ void LCGMethodResolver::Destroy()
     // Note that we need to do this before m_jitTempData is deleted
     RecycleIndCells();
 
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+    // The GC info of the method lives in the meta heap and its address may be reused
+    GcInfoDecoder::InvalidateLiveSlotCaches();
+#endif // GCINFODECODER_LIVE_SLOT_CACHE
+
     m_jitMetaHeap.Delete();
     m_jitTempData.Delete();
 
@@ -104,6 +104,7 @@ HRESULT EEConfig::Init()
     dwSpinLimitConstant = 0x0;
     dwSpinRetryCount = 0xA;
     dwMonitorSpinCount = 0;
+    fMonitorFairHandoff = false;
 
     dwJitHostMaxSlabCache = 0;
 
@@ -178,6 +179,10 @@ HRESULT EEConfig::Init()
     DoubleArrayToLargeObjectHeapThreshold = 1000;
 #endif
 
+    fCacheLineAlignMethodTables = false;
+    wGenericDictionaryMinSlots = 0;
+    dwInterfaceMapHashThreshold = 0;
+
 #ifdef _DEBUG
     // interop logging
     m_TraceWrapper = 0;
@@ -215,8 +220,11 @@ HRESULT EEConfig::Init()
     fTieredCompilation_QuickJitForLoops = false;
     fTieredCompilation_CallCounting = false;
     fTieredCompilation_UseCallCountingStubs = false;
+    fTieredCompilation_CallCountingCacheLineAligned = false;
     tieredCompilation_CallCountThreshold = 1;
     tieredCompilation_BackgroundWorkerTimeoutMs = 0;
+    tieredCompilation_BackgroundWorkerCount = 1;
+    tieredCompilation_LargeMethodILSize = 0;
     tieredCompilation_CallCountingDelayMs = 0;
     tieredCompilation_DeleteCallCountingStubsAfter = 0;
 #endif
@@ -225,6 +233,7 @@ HRESULT EEConfig::Init()
     fTieredPGO = false;
     tieredPGO_InstrumentOnlyHotCode = false;
     tieredPGO_ScalableCountThreshold = 13;
+    tieredPGO_ScalableCountSampling = 0;
 #endif
 
 #if defined(FEATURE_READYTORUN)
@@ -234,6 +243,7 @@ HRESULT EEConfig::Init()
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = 10;
     dwOSR_CounterBump = 5000;
+    dwOSR_ReoptimizeLimit = 100;
 #endif
 
     backpatchEntryPointSlots = false;
@@ -475,6 +485,14 @@ HRESULT EEConfig::sync()
     DoubleArrayToLargeObjectHeapThreshold = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_DoubleArrayToLargeObjectHeap, DoubleArrayToLargeObjectHeapThreshold);
 #endif
 
+    fCacheLineAlignMethodTables = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_MethodTableCacheLineAlign) != 0);
+    wGenericDictionaryMinSlots = (WORD)min(CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_GenericDictionaryMinSlots), (DWORD)UINT16_MAX);
+
+    // Lookups only consult the index for maps of at least INTERFACE_MAP_HASH_MIN_INTERFACES entries
+    dwInterfaceMapHashThreshold = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_InterfaceMapHashThreshold);
+    if (dwInterfaceMapHashThreshold != 0)
+        dwInterfaceMapHashThreshold = max(dwInterfaceMapHashThreshold, (DWORD)INTERFACE_MAP_HASH_MIN_INTERFACES);
+
 #ifdef _DEBUG
     IfFailRet (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_BreakOnClassLoad, (LPWSTR*) &pszBreakOnClassLoad));
     pszBreakOnClassLoad = NarrowWideChar((LPWSTR)pszBreakOnClassLoad);
@@ -495,6 +513,7 @@ HRESULT EEConfig::sync()
     dwSpinLimitConstant = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_SpinLimitConstant);
     dwSpinRetryCount = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_SpinRetryCount);
     dwMonitorSpinCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_Monitor_SpinCount);
+    fMonitorFairHandoff = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_Monitor_FairHandoff) != 0;
 
     dwJitHostMaxSlabCache = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_JitHostMaxSlabCache);
 
@@ -666,6 +685,14 @@ HRESULT EEConfig::sync()
 
         tieredCompilation_BackgroundWorkerTimeoutMs =
             CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerTimeoutMs);
+        tieredCompilation_BackgroundWorkerCount =
+            CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerCount);
+        if (tieredCompilation_BackgroundWorkerCount == 0)
+        {
+            tieredCompilation_BackgroundWorkerCount = 1;
+        }
+        tieredCompilation_LargeMethodILSize =
+            CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_LargeMethodILSize);
 
         fTieredCompilation_CallCounting = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_CallCounting) != 0;
 
@@ -704,6 +731,8 @@ HRESULT EEConfig::sync()
 
         if (fTieredCompilation_CallCounting)
         {
+            fTieredCompilation_CallCountingCacheLineAligned =
+                CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_CallCountingCacheLineAligned) != 0;
             fTieredCompilation_UseCallCountingStubs =
                 CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_UseCallCountingStubs) != 0;
             if (fTieredCompilation_UseCallCountingStubs)
@@ -738,6 +767,13 @@ HRESULT EEConfig::sync()
             tieredPGO_ScalableCountThreshold = scalableCountThreshold;
         }
 
+        DWORD scalableCountSampling = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TieredPGO_ScalableCountSampling);
+
+        if (scalableCountSampling < 16)
+        {
+            tieredPGO_ScalableCountSampling = scalableCountSampling;
+        }
+
         // We need quick jit for TieredPGO
         if (!fTieredCompilation_QuickJit)
         {
@@ -755,6 +791,7 @@ HRESULT EEConfig::sync()
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_HitLimit);
     dwOSR_CounterBump = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_CounterBump);
+    dwOSR_ReoptimizeLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_ReoptimizeLimit);
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -68,6 +68,7 @@ public:
     DWORD         SpinLimitConstant(void)         const {LIMITED_METHOD_CONTRACT;  return dwSpinLimitConstant; }
     DWORD         SpinRetryCount(void)            const {LIMITED_METHOD_CONTRACT;  return dwSpinRetryCount; }
     DWORD         MonitorSpinCount(void)          const {LIMITED_METHOD_CONTRACT;  return dwMonitorSpinCount; }
+    bool          MonitorFairHandoff(void)        const {LIMITED_METHOD_CONTRACT;  return fMonitorFairHandoff; }
 
     // Jit-config
 
@@ -85,10 +86,13 @@ public:
     bool          TieredCompilation_QuickJit() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_QuickJit; }
     bool          TieredCompilation_QuickJitForLoops() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_QuickJitForLoops; }
     DWORD         TieredCompilation_BackgroundWorkerTimeoutMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerTimeoutMs; }
+    DWORD         TieredCompilation_BackgroundWorkerCount() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerCount; }
+    DWORD         TieredCompilation_LargeMethodILSize() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_LargeMethodILSize; }
     bool          TieredCompilation_CallCounting()  const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_CallCounting; }
     UINT16        TieredCompilation_CallCountThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountThreshold; }
     DWORD         TieredCompilation_CallCountingDelayMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountingDelayMs; }
     bool          TieredCompilation_UseCallCountingStubs() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_UseCallCountingStubs; }
+    bool          TieredCompilation_CallCountingCacheLineAligned() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_CallCountingCacheLineAligned; }
     DWORD         TieredCompilation_DeleteCallCountingStubsAfter() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_DeleteCallCountingStubsAfter; }
 #endif
 
@@ -96,6 +100,7 @@ public:
     bool          TieredPGO(void) const { LIMITED_METHOD_CONTRACT;  return fTieredPGO; }
     bool          TieredPGO_InstrumentOnlyHotCode(void) const { LIMITED_METHOD_CONTRACT;  return tieredPGO_InstrumentOnlyHotCode; }
     DWORD         TieredPGO_ScalableCountThreshold() const { LIMITED_METHOD_CONTRACT;  return tieredPGO_ScalableCountThreshold; }
+    DWORD         TieredPGO_ScalableCountSampling() const { LIMITED_METHOD_CONTRACT;  return tieredPGO_ScalableCountSampling; }
 #endif
 
 #if defined(FEATURE_READYTORUN)
@@ -106,6 +111,7 @@ public:
     // OSR Config
     DWORD         OSR_CounterBump() const { LIMITED_METHOD_CONTRACT; return dwOSR_CounterBump; }
     DWORD         OSR_HitLimit() const { LIMITED_METHOD_CONTRACT; return dwOSR_HitLimit; }
+    DWORD         OSR_ReoptimizeLimit() const { LIMITED_METHOD_CONTRACT; return dwOSR_ReoptimizeLimit; }
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -310,6 +316,15 @@ public:
     unsigned int  GetDoubleArrayToLargeObjectHeapThreshold() const { LIMITED_METHOD_CONTRACT; return DoubleArrayToLargeObjectHeapThreshold; }
 #endif
 
+    // Start MethodTables on a cache line, so that the fixed part of the MethodTable doesn't straddle two lines
+    bool          CacheLineAlignMethodTables() const { LIMITED_METHOD_CONTRACT; return fCacheLineAlignMethodTables; }
+
+    // Lower bound on the number of slots of a new generic dictionary layout
+    WORD          GenericDictionaryMinSlots() const { LIMITED_METHOD_CONTRACT; return wGenericDictionaryMinSlots; }
+
+    // Minimum number of interfaces for a type to get an InterfaceMapHash, or 0 if disabled
+    DWORD         InterfaceMapHashThreshold() const { LIMITED_METHOD_CONTRACT; return dwInterfaceMapHashThreshold; }
+
 #ifdef TEST_DATA_CONSISTENCY
     // get the value of fTestDataConsistency, which controls whether we test that we can correctly detect
     // held locks in DAC builds. This is determined by an environment variable.
@@ -524,6 +539,10 @@ private: //----------------------------------------------------------------
     unsigned int DoubleArrayToLargeObjectHeapThreshold;  // double arrays of more than this number of elems go in large object heap
 #endif
 
+    bool fCacheLineAlignMethodTables;
+    WORD wGenericDictionaryMinSlots;
+    DWORD dwInterfaceMapHashThreshold;
+
 #ifdef _DEBUG
     bool fExpandAllOnLoad;              // True if we want to load all types/jit all methods in an assembly
                                         // at load time.
@@ -553,6 +572,7 @@ private: //----------------------------------------------------------------
     DWORD dwSpinLimitConstant;
     DWORD dwSpinRetryCount;
     DWORD dwMonitorSpinCount;
+    bool fMonitorFairHandoff;
 
 #ifdef VERIFY_HEAP
     int  iGCHeapVerify;
@@ -614,8 +634,11 @@ private: //----------------------------------------------------------------
     bool fTieredCompilation_QuickJitForLoops;
     bool fTieredCompilation_CallCounting;
     bool fTieredCompilation_UseCallCountingStubs;
+    bool fTieredCompilation_CallCountingCacheLineAligned;
     UINT16 tieredCompilation_CallCountThreshold;
     DWORD tieredCompilation_BackgroundWorkerTimeoutMs;
+    DWORD tieredCompilation_BackgroundWorkerCount;
+    DWORD tieredCompilation_LargeMethodILSize;
     DWORD tieredCompilation_CallCountingDelayMs;
     DWORD tieredCompilation_DeleteCallCountingStubsAfter;
 #endif
@@ -624,6 +647,7 @@ private: //----------------------------------------------------------------
     bool fTieredPGO;
     bool tieredPGO_InstrumentOnlyHotCode;
     DWORD tieredPGO_ScalableCountThreshold;
+    DWORD tieredPGO_ScalableCountSampling;
 #endif
 
 #if defined(FEATURE_READYTORUN)
@@ -633,6 +657,7 @@ private: //----------------------------------------------------------------
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     DWORD dwOSR_HitLimit;
     DWORD dwOSR_CounterBump;
+    DWORD dwOSR_ReoptimizeLimit;
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
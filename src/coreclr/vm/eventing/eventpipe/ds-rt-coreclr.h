@@ -14,6 +14,7 @@
 #include <eventpipe/ds-process-protocol.h>
 #include <eventpipe/ds-profiler-protocol.h>
 #include <eventpipe/ds-dump-protocol.h>
+#include "heapsnapshot.h"
 #ifdef FEATURE_PERFMAP
 #include "perfmap.h"
 #endif
@@ -213,6 +214,22 @@ ds_rt_generate_core_dump (
 	return result;
 }
 
+static
+inline
+ds_ipc_result_t
+ds_rt_generate_heap_snapshot (
+	DiagnosticsGenerateHeapSnapshotCommandPayload *payload,
+	DiagnosticsHeapSnapshotWriter *writer)
+{
+	STATIC_CONTRACT_NOTHROW;
+
+	if (!g_fEEStarted)
+		return DS_IPC_E_NOT_YET_AVAILABLE;
+
+	HRESULT hr = HeapSnapshot::Generate (writer);
+	return SUCCEEDED (hr) ? DS_IPC_S_OK : (ds_ipc_result_t)hr;
+}
+
 /*
  * DiagnosticsIpc.
  */
@@ -6,7 +6,9 @@
 #ifdef ENABLE_PERFTRACING
 #include <eventpipe/ep-types.h>
 #include <eventpipe/ep.h>
+#include <eventpipe/ep-event.h>
 #include <eventpipe/ep-stack-contents.h>
+#include <eventpipe/ep-sample-profiler.h>
 #include <eventpipe/ep-rt.h>
 #include "threadsuspend.h"
 
@@ -107,9 +109,21 @@ walk_managed_stack_for_threads (
 
 	EP_ASSERT (current_stack_contents != NULL);
 
+	const bool cpu_time_sampling = ep_sample_profiler_get_cpu_time_sampling ();
+
+	EventPipeEvent *hardware_counters_event = ep_sample_profiler_get_hardware_counters_event ();
+	const bool hardware_counters = hardware_counters_event != NULL && ep_event_is_enabled (hardware_counters_event);
+
 	// Iterate over all managed threads.
 	// Assumes that the ThreadStoreLock is held because we've suspended all threads.
 	while ((target_thread = ThreadStore::GetThreadList (target_thread)) != NULL) {
+		// A thread that didn't run since the previous tick is blocked or sleeping, skip the
+		// stack walk, which dominates the cost of a tick when most threads are idle.
+		if (cpu_time_sampling && !target_thread->ConsumedCpuTimeSinceLastSample ()) {
+			target_thread->ClearGCModeOnSuspension ();
+			continue;
+		}
+
 		ep_stack_contents_reset (current_stack_contents);
 
 		// Walk the stack and write it out as an event.
@@ -127,8 +141,26 @@ walk_managed_stack_for_threads (
 				current_stack_contents,
 				(uint8_t *)&payload_data,
 				sizeof (payload_data));
+
+			// The counts since the previous sample of the thread are attributed to this stack, like the time
+			// between two ticks is attributed to the sampled stack.
+			EventPipeHardwareCounterSample counts;
+			static_assert (sizeof (counts) == minipal_hw_counter_count * sizeof (uint64_t), "Hardware counter payload doesn't match the counters");
+			if (hardware_counters && target_thread->GetHardwareCountersSinceLastSample ((uint64_t *)&counts)) {
+				ep_write_sample_profile_event (
+					sampling_thread,
+					hardware_counters_event,
+					target_thread,
+					current_stack_contents,
+					(uint8_t *)&counts,
+					sizeof (counts));
+			}
 		}
 
+		// Stop counting when a session that wanted the counters ends while others keep sampling.
+		if (!hardware_counters)
+			target_thread->CloseSampleProfilerHardwareCounters ();
+
 		// Reset the GC mode.
 		target_thread->ClearGCModeOnSuspension ();
 	}
@@ -160,4 +192,16 @@ ep_rt_coreclr_sample_profiler_write_sampling_event_for_threads (
 	return;
 }
 
+void
+ep_rt_coreclr_sample_profiler_stopped (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+
+	ThreadStoreLockHolder thread_store_lock;
+
+	Thread *thread = NULL;
+	while ((thread = ThreadStore::GetThreadList (thread)) != NULL)
+		thread->CloseSampleProfilerHardwareCounters ();
+}
+
 #endif /* ENABLE_PERFTRACING */
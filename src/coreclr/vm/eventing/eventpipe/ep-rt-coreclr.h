@@ -548,6 +548,24 @@ ep_rt_config_value_get_enable_stackwalk (void)
 	return CLRConfig::GetConfigValue(CLRConfig::INTERNAL_EventPipeEnableStackwalk) != 0;
 }
 
+static
+inline
+uint32_t
+ep_rt_config_value_get_sample_interval_us (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+	return CLRConfig::GetConfigValue (CLRConfig::INTERNAL_EventPipeSampleIntervalMicroseconds);
+}
+
+static
+inline
+bool
+ep_rt_config_value_get_sample_cpu_time_only (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+	return CLRConfig::GetConfigValue (CLRConfig::INTERNAL_EventPipeSampleCpuTimeOnly) != 0;
+}
+
 /*
  * EventPipeSampleProfiler.
  */
@@ -565,6 +583,17 @@ ep_rt_sample_profiler_write_sampling_event_for_threads (
 	ep_rt_coreclr_sample_profiler_write_sampling_event_for_threads (sampling_thread, sampling_event);
 }
 
+static
+inline
+void
+ep_rt_sample_profiler_stopped (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+
+	extern void ep_rt_coreclr_sample_profiler_stopped (void);
+	ep_rt_coreclr_sample_profiler_stopped ();
+}
+
 static
 inline
 void
@@ -763,15 +792,53 @@ ep_rt_is_running (void)
 static
 inline
 void
-ep_rt_execute_rundown (dn_vector_ptr_t *execution_checkpoints)
+ep_rt_execute_rundown (
+	dn_vector_ptr_t *execution_checkpoints,
+	const uintptr_t *method_ips,
+	uint32_t method_ips_len)
 {
 	STATIC_CONTRACT_NOTHROW;
 
-	//TODO: Write execution checkpoint rundown events.
+	// Startup checkpoints describe process startup rather than runtime state, so they are written
+	// even when the rest of the rundown is disabled.
+	if (execution_checkpoints) {
+		DN_VECTOR_PTR_FOREACH_BEGIN (EventPipeExecutionCheckpoint *, checkpoint, execution_checkpoints) {
+			ep_char16_t *name = ep_rt_utf8_to_utf16le_string (checkpoint->name);
+			if (name != NULL) {
+				FireEtwExecutionCheckpointDCEnd (GetClrInstanceId (), reinterpret_cast<const WCHAR *>(name), checkpoint->timestamp);
+				ep_rt_utf16_string_free (name);
+			}
+		} DN_VECTOR_PTR_FOREACH_END;
+	}
+
 	if (CLRConfig::GetConfigValue (CLRConfig::INTERNAL_EventPipeRundown) > 0) {
 		// Ask the runtime to emit rundown events.
-		if (g_fEEStarted && !g_fEEShutDown)
-			ETW::EnumerationLog::EndRundown ();
+		if (g_fEEStarted && !g_fEEShutDown) {
+			if (method_ips == NULL) {
+				ETW::EnumerationLog::EndRundown ();
+				return;
+			}
+
+			// Resolve the ips up front, a set lookup per method is much cheaper than
+			// emitting events for every method in the code heaps.
+			MethodDescSet method_filter;
+			bool filter_valid = true;
+			EX_TRY
+			{
+				for (uint32_t i = 0; i < method_ips_len; ++i) {
+					MethodDesc *method = ExecutionManager::GetCodeMethodDesc ((PCODE)method_ips [i]);
+					if (method != NULL && !method_filter.Contains (method))
+						method_filter.Add (method);
+				}
+			}
+			EX_CATCH
+			{
+				filter_valid = false;
+			}
+			EX_END_CATCH(SwallowAllExceptions);
+
+			ETW::EnumerationLog::EndRundown (filter_valid ? &method_filter : NULL);
+		}
 	}
 }
 
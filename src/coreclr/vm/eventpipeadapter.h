@@ -173,6 +173,12 @@ public:
 		ep_finish_init();
 	}
 
+	static inline bool AddRundownExecutionCheckpoint(const char *name, int64_t timestamp)
+	{
+		STATIC_CONTRACT_NOTHROW;
+		return ep_add_rundown_execution_checkpoint(reinterpret_cast<const ep_char8_t *>(name), timestamp);
+	}
+
 	static inline void Shutdown()
 	{
 		CONTRACTL
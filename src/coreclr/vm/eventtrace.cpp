@@ -1254,6 +1254,16 @@ VOID ETW::TypeSystemLog::LogTypeAndParametersIfNecessary(BulkTypeEventLogger * p
 
     TypeHandle th = TypeHandle::FromTAddr((TADDR) thAsAddr);
 
+    // A logger used for a GC heap walk is asked about the type of every object, so
+    // before going to the hash, check whether it was already asked about this type.
+    // Either way, the type was logged (or found to be logged already) at that point.
+    if ((pLogger != NULL) &&
+        (typeLogBehavior == kTypeLogBehaviorTakeLockAndLogIfFirstTime) &&
+        pLogger->CheckAndMarkTypeSeen(thAsAddr))
+    {
+        return;
+    }
+
     // Check to see if we've already logged this type.  If so, bail immediately.
     // Otherwise, mark that it's getting logged (by adding it to the hash), and fall
     // through to the logging code below.  If caller doesn't care, then don't even
@@ -2141,7 +2151,7 @@ VOID ETW::EnumerationLog::EnumerateForCaptureState()
 /**************************************************************************************/
 /* Called when ETW is turned OFF on an existing process .Will be used by the controller for end rundown*/
 /**************************************************************************************/
-VOID ETW::EnumerationLog::EndRundown()
+VOID ETW::EnumerationLog::EndRundown(const MethodDescSet *pMethodFilter)
 {
     CONTRACTL {
         NOTHROW;
@@ -2226,7 +2236,7 @@ VOID ETW::EnumerationLog::EndRundown()
                 enumerationOptions |= ETW::EnumerationLog::EnumerationStructs::JittedMethodRichDebugInfo;
             }
 
-            ETW::EnumerationLog::EnumerationHelper(NULL, enumerationOptions);
+            ETW::EnumerationLog::EnumerationHelper(NULL, enumerationOptions, pMethodFilter);
 
             if (bIsThreadingRundownEnabled)
             {
@@ -2822,19 +2832,19 @@ VOID ETW::ExceptionLog::ExceptionThrown(CrawlFrame  *pCf, BOOL bIsReThrownExcept
 }
 
 
-VOID ETW::ExceptionLog::ExceptionThrownEnd()
+VOID ETW::ExceptionLog::ExceptionThrownEnd(UINT32 framesUnwound, double firstPassTimeNs, double secondPassTimeNs)
 {
     CONTRACTL{
         NOTHROW;
         GC_NOTRIGGER;
     } CONTRACTL_END;
 
-    if (!ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, ExceptionThrownStop))
+    if (!ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, ExceptionThrownStop_V1))
     {
         return;
     }
 
-    FireEtwExceptionThrownStop();
+    FireEtwExceptionThrownStop_V1(framesUnwound, firstPassTimeNs, secondPassTimeNs, GetClrInstanceId());
 }
 
 /****************************************************************************/
@@ -5086,7 +5096,7 @@ VOID ETW::MethodLog::SendHelperEvent(ULONGLONG ullHelperStartAddress, ULONG ulHe
 /* This routine sends back method events of type 'dwEventOptions', for all
    NGEN methods in pModule */
 /****************************************************************************/
-VOID ETW::MethodLog::SendEventsForNgenMethods(Module *pModule, DWORD dwEventOptions)
+VOID ETW::MethodLog::SendEventsForNgenMethods(Module *pModule, DWORD dwEventOptions, const MethodDescSet *pMethodFilter)
 {
     CONTRACTL {
         THROWS;
@@ -5104,7 +5114,7 @@ VOID ETW::MethodLog::SendEventsForNgenMethods(Module *pModule, DWORD dwEventOpti
         {
             // Call GetMethodDesc_NoRestore instead of GetMethodDesc to avoid restoring methods at shutdown.
             MethodDesc *hotDesc = (MethodDesc *)mi.GetMethodDesc_NoRestore();
-            if (hotDesc != NULL)
+            if (hotDesc != NULL && (pMethodFilter == NULL || pMethodFilter->Contains(hotDesc)))
             {
                 ETW::MethodLog::SendMethodEvent(hotDesc, dwEventOptions, FALSE);
             }
@@ -5124,7 +5134,8 @@ VOID ETW::MethodLog::SendEventsForJitMethodsHelper(LoaderAllocator *pLoaderAlloc
                                                    BOOL fSendMethodEvent,
                                                    BOOL fSendILToNativeMapEvent,
                                                    BOOL fSendRichDebugInfoEvent,
-                                                   BOOL fGetCodeIds)
+                                                   BOOL fGetCodeIds,
+                                                   const MethodDescSet *pMethodFilter)
 {
     CONTRACTL{
         THROWS;
@@ -5147,6 +5158,9 @@ VOID ETW::MethodLog::SendEventsForJitMethodsHelper(LoaderAllocator *pLoaderAlloc
         if (pMD == NULL)
             continue;
 
+        if (pMethodFilter != NULL && !pMethodFilter->Contains(pMD))
+            continue;
+
         PCODE codeStart = PINSTRToPCODE(heapIterator.GetMethodCode());
 
         // Get info relevant to the native code version. In some cases, such as collectible loader
@@ -5238,7 +5252,7 @@ VOID ETW::MethodLog::SendEventsForJitMethodsHelper(LoaderAllocator *pLoaderAlloc
    JITed methods in either a given LoaderAllocator (if pLoaderAllocatorFilter is non NULL)
    or all methods (if pLoaderAllocatorFilter is null) */
 /****************************************************************************/
-VOID ETW::MethodLog::SendEventsForJitMethods(BOOL getCodeVersionIds, LoaderAllocator *pLoaderAllocatorFilter, DWORD dwEventOptions)
+VOID ETW::MethodLog::SendEventsForJitMethods(BOOL getCodeVersionIds, LoaderAllocator *pLoaderAllocatorFilter, DWORD dwEventOptions, const MethodDescSet *pMethodFilter)
 {
     CONTRACTL {
         NOTHROW;
@@ -5310,7 +5324,8 @@ VOID ETW::MethodLog::SendEventsForJitMethods(BOOL getCodeVersionIds, LoaderAlloc
                 fSendMethodEvent,
                 fSendILToNativeMapEvent,
                 fSendRichDebugInfoEvent,
-                TRUE);
+                TRUE,
+                pMethodFilter);
         }
         else
 #endif
@@ -5323,7 +5338,8 @@ VOID ETW::MethodLog::SendEventsForJitMethods(BOOL getCodeVersionIds, LoaderAlloc
                 fSendMethodEvent,
                 fSendILToNativeMapEvent,
                 fSendRichDebugInfoEvent,
-                FALSE);
+                FALSE,
+                pMethodFilter);
         }
     } EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 #endif // !DACCESS_COMPILE
@@ -5342,7 +5358,7 @@ VOID ETW::MethodLog::SendEventsForJitMethods(BOOL getCodeVersionIds, LoaderAlloc
 // Arguments:
 //      enumerationOptions - Flags indicating what to enumerate.
 //
-VOID ETW::EnumerationLog::IterateAppDomain(DWORD enumerationOptions)
+VOID ETW::EnumerationLog::IterateAppDomain(DWORD enumerationOptions, const MethodDescSet *pMethodFilter)
 {
     CONTRACTL
     {
@@ -5368,7 +5384,7 @@ VOID ETW::EnumerationLog::IterateAppDomain(DWORD enumerationOptions)
         // DC End or Unload Jit Method events
         if (enumerationOptions & ETW::EnumerationLog::EnumerationStructs::JitMethodUnloadOrDCEndAny)
         {
-            ETW::MethodLog::SendEventsForJitMethods(TRUE /*getCodeVersionIds*/, NULL, enumerationOptions);
+            ETW::MethodLog::SendEventsForJitMethods(TRUE /*getCodeVersionIds*/, NULL, enumerationOptions, pMethodFilter);
         }
 
         AppDomain::AssemblyIterator assemblyIterator = pDomain->IterateAssembliesEx(
@@ -5383,7 +5399,7 @@ VOID ETW::EnumerationLog::IterateAppDomain(DWORD enumerationOptions)
             }
 
             Module * pModule = pDomainAssembly->GetModule();
-            ETW::EnumerationLog::IterateModule(pModule, enumerationOptions);
+            ETW::EnumerationLog::IterateModule(pModule, enumerationOptions, pMethodFilter);
 
             if((enumerationOptions & ETW::EnumerationLog::EnumerationStructs::DomainAssemblyModuleDCEnd) ||
                 (enumerationOptions & ETW::EnumerationLog::EnumerationStructs::DomainAssemblyModuleUnload))
@@ -5395,7 +5411,7 @@ VOID ETW::EnumerationLog::IterateAppDomain(DWORD enumerationOptions)
         // DC Start or Load Jit Method events
         if (enumerationOptions & ETW::EnumerationLog::EnumerationStructs::JitMethodLoadOrDCStartAny)
         {
-            ETW::MethodLog::SendEventsForJitMethods(TRUE /*getCodeVersionIds*/, NULL, enumerationOptions);
+            ETW::MethodLog::SendEventsForJitMethods(TRUE /*getCodeVersionIds*/, NULL, enumerationOptions, pMethodFilter);
         }
 
         // DC End or Unload events for Domain
@@ -5499,7 +5515,7 @@ VOID ETW::EnumerationLog::IterateAssembly(Assembly *pAssembly, DWORD enumeration
 /* This routine fires ETW events for Module, their range information and the NGEN methods in them
    based on enumerationOptions.*/
 /********************************************************************************/
-VOID ETW::EnumerationLog::IterateModule(Module *pModule, DWORD enumerationOptions)
+VOID ETW::EnumerationLog::IterateModule(Module *pModule, DWORD enumerationOptions, const MethodDescSet *pMethodFilter)
 {
     CONTRACTL {
         THROWS;
@@ -5522,7 +5538,7 @@ VOID ETW::EnumerationLog::IterateModule(Module *pModule, DWORD enumerationOption
            (enumerationOptions & ETW::EnumerationLog::EnumerationStructs::NgenMethodUnload) ||
            (enumerationOptions & ETW::EnumerationLog::EnumerationStructs::NgenMethodDCEnd))
         {
-            ETW::MethodLog::SendEventsForNgenMethods(pModule, enumerationOptions);
+            ETW::MethodLog::SendEventsForNgenMethods(pModule, enumerationOptions, pMethodFilter);
         }
 
         // DC End or Unload events for Module
@@ -5563,7 +5579,7 @@ VOID ETW::EnumerationLog::IterateModule(Module *pModule, DWORD enumerationOption
 //
 
 // static
-VOID ETW::EnumerationLog::EnumerationHelper(Module *moduleFilter, DWORD enumerationOptions)
+VOID ETW::EnumerationLog::EnumerationHelper(Module *moduleFilter, DWORD enumerationOptions, const MethodDescSet *pMethodFilter)
 {
     CONTRACTL {
         THROWS;
@@ -5596,7 +5612,7 @@ VOID ETW::EnumerationLog::EnumerationHelper(Module *moduleFilter, DWORD enumerat
     }
     else
     {
-        ETW::EnumerationLog::IterateAppDomain(enumerationOptions);
+        ETW::EnumerationLog::IterateAppDomain(enumerationOptions, pMethodFilter);
     }
 }
 
@@ -699,6 +699,41 @@ void BulkTypeEventLogger::FireBulkTypeEvent()
     m_nBulkTypeValueByteCount = 0;
 }
 
+//---------------------------------------------------------------------------------------
+//
+// Remembers that this logger was asked to log the type, so that the caller can skip the
+// lookup in the TypeSystemLog hash the next time. The cache is direct mapped, so a type
+// that was evicted by another one is simply looked up again.
+//
+// Arguments:
+//      thAsAddr - Type to check
+//
+// Return Value:
+//      nonzero iff this logger was already asked to log the type
+//
+
+BOOL BulkTypeEventLogger::CheckAndMarkTypeSeen(ULONGLONG thAsAddr)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_rgSeenTypes == NULL)
+    {
+        m_rgSeenTypes = new (nothrow) ULONGLONG[kSeenTypeCacheSize];
+        if (m_rgSeenTypes == NULL)
+            return FALSE;
+
+        ZeroMemory(m_rgSeenTypes, kSeenTypeCacheSize * sizeof(ULONGLONG));
+    }
+
+    // TypeHandles are pointer aligned, so drop the low bits before indexing
+    ULONGLONG * pEntry = &m_rgSeenTypes[(thAsAddr >> 3) % kSeenTypeCacheSize];
+    if (*pEntry == thAsAddr)
+        return TRUE;
+
+    *pEntry = thAsAddr;
+    return FALSE;
+}
+
 #ifndef FEATURE_NATIVEAOT
 
 //---------------------------------------------------------------------------------------
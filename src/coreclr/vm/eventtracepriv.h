@@ -293,6 +293,12 @@ private:
 
     BYTE *m_pBulkTypeEventBuffer;
 
+    // Direct mapped cache of the types this logger was already asked to log, so that a
+    // GC heap walk only looks up the type of each object in the TypeSystemLog hash the
+    // first few times it sees the type. Allocated on first use.
+    static const int kSeenTypeCacheSize = 4096;
+    ULONGLONG *m_rgSeenTypes;
+
 #ifdef FEATURE_NATIVEAOT
     int LogSingleType(EEType * pEEType);
 #else
@@ -304,6 +310,7 @@ public:
         m_nBulkTypeValueCount(0),
         m_nBulkTypeValueByteCount(0)
         , m_pBulkTypeEventBuffer(NULL)
+        , m_rgSeenTypes(NULL)
     {
         CONTRACTL
         {
@@ -328,10 +335,13 @@ public:
 
         delete[] m_pBulkTypeEventBuffer;
         m_pBulkTypeEventBuffer = NULL;
+        delete[] m_rgSeenTypes;
+        m_rgSeenTypes = NULL;
     }
 
     void LogTypeAndParameters(ULONGLONG thAsAddr, ETW::TypeSystemLog::TypeLogBehavior typeLogBehavior);
     void FireBulkTypeEvent();
+    BOOL CheckAndMarkTypeSeen(ULONGLONG thAsAddr);
 };
 
 
@@ -7731,6 +7731,8 @@ extern "C" void * QCALLTYPE CallCatchFunclet(QCall::ObjectHandleOnStack exceptio
         exInfo->m_csfEHClause = CallerStackFrame((UINT_PTR)GetCurrentSP());
         exInfo->m_csfEnclosingClause = CallerStackFrame::FromRegDisplay(exInfo->m_frameIter.m_crawl.GetRegisterSet());
 
+        EndExceptionDispatchSecondPass(exInfo);
+
         MethodDesc *pMD = exInfo->m_frameIter.m_crawl.GetFunction();
         // Profiler, debugger and ETW events
         TADDR spForDebugger = GetSpForDiagnosticReporting(pvRegDisplay);
@@ -8218,6 +8220,78 @@ void FailFastIfCorruptingStateException(ExInfo *pExInfo)
     }
 }
 
+// Statistics of the exception being dispatched on the current thread, reported by the ExceptionThrownStop
+// event once a catch handler is done. They are only collected while the event is enabled, and a nested
+// exception restarts them, so the outer exception is then reported without them.
+struct ExceptionDispatchStats
+{
+    ExInfo*         pExInfo;
+    UINT32          framesUnwound;
+    LARGE_INTEGER   passStartTicks;
+    double          firstPassTimeNs;
+    double          secondPassTimeNs;
+};
+
+static thread_local ExceptionDispatchStats t_exceptionDispatchStats;
+
+double ComputeElapsedTimeInNanosecond(LARGE_INTEGER startTicks, LARGE_INTEGER endTicks);
+
+static void StartExceptionDispatchPass(ExInfo *pExInfo)
+{
+    ExceptionDispatchStats* pStats = &t_exceptionDispatchStats;
+
+    if (pExInfo->m_passNumber == 1)
+    {
+        if (!ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, ExceptionThrownStop_V1))
+        {
+            pStats->pExInfo = NULL;
+            return;
+        }
+
+        pStats->pExInfo = pExInfo;
+        pStats->framesUnwound = 0;
+        pStats->firstPassTimeNs = 0;
+        pStats->secondPassTimeNs = 0;
+        QueryPerformanceCounter(&pStats->passStartTicks);
+    }
+    else if (pStats->pExInfo == pExInfo)
+    {
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        pStats->firstPassTimeNs = ComputeElapsedTimeInNanosecond(pStats->passStartTicks, now);
+        pStats->passStartTicks = now;
+    }
+}
+
+static void EndExceptionDispatchSecondPass(ExInfo *pExInfo)
+{
+    ExceptionDispatchStats* pStats = &t_exceptionDispatchStats;
+
+    if (pStats->pExInfo == pExInfo)
+    {
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        pStats->secondPassTimeNs = ComputeElapsedTimeInNanosecond(pStats->passStartTicks, now);
+    }
+}
+
+void FireExceptionThrownEnd(ExInfo *pExInfo)
+{
+    WRAPPER_NO_CONTRACT;
+
+    ExceptionDispatchStats* pStats = &t_exceptionDispatchStats;
+
+    if (pStats->pExInfo == pExInfo)
+    {
+        ETW::ExceptionLog::ExceptionThrownEnd(pStats->framesUnwound, pStats->firstPassTimeNs, pStats->secondPassTimeNs);
+        pStats->pExInfo = NULL;
+    }
+    else
+    {
+        ETW::ExceptionLog::ExceptionThrownEnd();
+    }
+}
+
 static bool IsTopmostDebuggerU2MCatchHandlerFrame(Frame *pFrame)
 {
     return (pFrame->GetVTablePtr() == DebuggerU2MCatchHandlerFrame::GetMethodFrameVPtr()) && (pFrame->PtrNextFrame() == FRAME_TOP);
@@ -8351,13 +8425,14 @@ extern "C" bool QCALLTYPE SfiInit(StackFrameIterator* pThis, CONTEXT* pStackwalk
 
     pFrame = pExInfo->m_pInitialFrame;
 
+    StartExceptionDispatchPass(pExInfo);
     NotifyExceptionPassStarted(pThis, pThread, pExInfo);
 
     REGDISPLAY* pRD = &pExInfo->m_regDisplay;
     pThread->FillRegDisplay(pRD, pStackwalkCtx);
 
     new (pThis) StackFrameIterator();
-    result = pThis->Init(pThread, pFrame, pRD, THREAD_EXECUTING_MANAGED_CODE | UNWIND_FLOATS) != FALSE;
+    result = pThis->Init(pThread, pFrame, pRD, THREAD_EXECUTING_MANAGED_CODE | UNWIND_FLOATS | CACHE_CODE_LOOKUPS) != FALSE;
 
     if (result && (pExInfo->m_passNumber == 1))
     {
@@ -8501,6 +8576,8 @@ extern "C" bool QCALLTYPE SfiNext(StackFrameIterator* pThis, uint* uExCollideCla
     // just clear the thread state.
     pThread->ResetThrowControlForThread();
 
+    t_exceptionDispatchStats.framesUnwound++;
+
     ExInfo* pExInfo = pThis->GetNextExInfo();
     bool isCollided = false;
 
@@ -504,7 +504,7 @@ void ExInfo::MakeCallbacksRelatedToHandler(
             else
             {
                 ETW::ExceptionLog::ExceptionCatchEnd();
-                ETW::ExceptionLog::ExceptionThrownEnd();
+                FireExceptionThrownEnd(this);
                 EEToProfilerExceptionInterfaceWrapper::ExceptionCatcherLeave();
             }
         }
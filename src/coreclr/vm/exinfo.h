@@ -289,5 +289,9 @@ struct ExInfo : public ExceptionTrackerBase
 
 };
 
+// Fires the ExceptionThrownStop event once a catch handler of the exception is done, along with
+// the frames unwound and the time spent in each pass if they were collected on this thread
+void FireExceptionThrownEnd(ExInfo *pExInfo);
+
 #endif // !FEATURE_EH_FUNCLETS
 #endif // __ExInfo_h__
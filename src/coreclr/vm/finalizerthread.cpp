@@ -31,11 +31,27 @@ CLREvent * FinalizerThread::hEventFinalizerToShutDown = NULL;
 
 HANDLE FinalizerThread::MHandles[kHandleCount];
 
+#define MAX_FINALIZER_THREADS 8
+
+DWORD FinalizerThread::s_helperThreadCount = 0;
+CLREvent * FinalizerThread::s_helperWorkEvents = NULL;
+CLREvent * FinalizerThread::hEventHelpersDone = NULL;
+LONG FinalizerThread::s_helpersPending = 0;
+
+// Index of the current finalizer helper thread, -1 on every other thread
+static thread_local int t_finalizerHelperIndex = -1;
+
+struct FinalizerHelperThreadArgs
+{
+    Thread * m_pThread;
+    int      m_index;
+};
+
 BOOL FinalizerThread::IsCurrentThreadFinalizer()
 {
     LIMITED_METHOD_CONTRACT;
 
-    return GetThreadNULLOk() == g_pFinalizerThread;
+    return (GetThreadNULLOk() == g_pFinalizerThread) || (t_finalizerHelperIndex >= 0);
 }
 
 void FinalizerThread::EnableFinalization()
@@ -98,7 +114,12 @@ Again:
     if (fQuitFinalizer)
         return NULL;
 
-    OBJECTREF obj = ObjectToOBJECTREF(GCHeapUtilities::GetGCHeap()->GetNextFinalizable());
+    // Helpers leave critical finalizers to the finalizer thread, which only runs them once the
+    // non-critical ones are gone from all the queues. Starting at a different heap per helper
+    // keeps the helpers off each other's finalization queue lock.
+    OBJECTREF obj = ObjectToOBJECTREF((t_finalizerHelperIndex >= 0) ?
+        GCHeapUtilities::GetGCHeap()->GetNextFinalizableFromHeap(t_finalizerHelperIndex + 1, true /* only_non_critical */) :
+        GCHeapUtilities::GetGCHeap()->GetNextFinalizable());
     if (obj == NULL)
         return NULL;
 
@@ -282,6 +303,173 @@ void FinalizerThread::WaitForFinalizerEvent (CLREvent *event)
 
 static BOOL s_FinalizerThreadOK = FALSE;
 static BOOL s_InitializedFinalizerThreadForPlatform = FALSE;
+static BOOL s_StartedFinalizerHelperThreads = FALSE;
+
+void FinalizerThread::StartHelperThreads()
+{
+    STANDARD_VM_CONTRACT;
+
+    DWORD nThreads = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_FinalizerThreadCount);
+    nThreads = min(nThreads, min((DWORD)MAX_FINALIZER_THREADS, (DWORD)g_SystemInfo.dwNumberOfProcessors));
+
+    if (nThreads <= 1)
+    {
+        return;
+    }
+
+    // Helpers need to be able to skip critical finalizable objects
+    if (!GCHeapUtilities::IsGCInterfaceMinorVersionAtLeast(4))
+    {
+        LOG((LF_GC, LL_INFO10, "Loaded GC doesn't support finalizer helper threads\n"));
+        return;
+    }
+
+    DWORD nHelpers = nThreads - 1;
+    DWORD started = 0;
+
+    EX_TRY
+    {
+        hEventHelpersDone = new CLREvent();
+        hEventHelpersDone->CreateManualEvent(FALSE);
+
+        s_helperWorkEvents = new CLREvent[nHelpers];
+        for (DWORD i = 0; i < nHelpers; i++)
+        {
+            s_helperWorkEvents[i].CreateAutoEvent(FALSE);
+        }
+
+        for (; started < nHelpers; started++)
+        {
+            NewHolder<FinalizerHelperThreadArgs> pArgs = new FinalizerHelperThreadArgs();
+            pArgs->m_pThread = SetupUnstartedThread();
+            pArgs->m_index = (int)started;
+
+            if (!pArgs->m_pThread->CreateNewThread(0, &FinalizerHelperThreadStart, pArgs, W(".NET Finalizer Helper")))
+            {
+                pArgs->m_pThread->DecExternalCount(FALSE);
+                break;
+            }
+
+            // The helper is responsible for deleting its arguments once it's created
+            Thread * pThread = pArgs->m_pThread;
+            pArgs.SuppressRelease();
+            pThread->StartThread();
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    s_helperThreadCount = started;
+
+    LOG((LF_GC, LL_INFO10, "Started %d finalizer helper threads\n", started));
+}
+
+void FinalizerThread::WakeHelperThreads()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Helpers are left waiting once we are shutting down
+    if ((s_helperThreadCount == 0) || fQuitFinalizer)
+    {
+        return;
+    }
+
+    s_helpersPending = (LONG)s_helperThreadCount;
+    hEventHelpersDone->Reset();
+
+    for (DWORD i = 0; i < s_helperThreadCount; i++)
+    {
+        s_helperWorkEvents[i].Set();
+    }
+}
+
+void FinalizerThread::WaitForHelperThreads()
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (s_helperThreadCount == 0)
+    {
+        return;
+    }
+
+    GCX_PREEMP();
+
+    while (VolatileLoad(&s_helpersPending) != 0)
+    {
+        hEventHelpersDone->Wait(INFINITE, FALSE);
+    }
+}
+
+void FinalizerThread::CompleteHelperPass()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (InterlockedDecrement(&s_helpersPending) == 0)
+    {
+        hEventHelpersDone->Set();
+    }
+}
+
+VOID FinalizerThread::FinalizerHelperThreadWorker(void *args)
+{
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    Thread *pThread = GetThread();
+    CLREvent *pWorkEvent = &s_helperWorkEvents[t_finalizerHelperIndex];
+
+    while (!fQuitFinalizer)
+    {
+        _ASSERTE(pThread->PreemptiveGCDisabled());
+        pThread->EnablePreemptiveGC();
+
+        pWorkEvent->Wait(INFINITE, FALSE);
+
+        pThread->DisablePreemptiveGC();
+
+        // The finalizer thread waits for every woken helper, even if a finalizer throws
+        // out of this pass
+        StateHolder<DoNothing, FinalizerThread::CompleteHelperPass> passHolder;
+
+        if (!fQuitFinalizer)
+        {
+            FinalizeAllObjects();
+        }
+    }
+}
+
+DWORD WINAPI FinalizerThread::FinalizerHelperThreadStart(void *args)
+{
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    FinalizerHelperThreadArgs * pArgs = (FinalizerHelperThreadArgs *) args;
+    Thread * pThread = pArgs->m_pThread;
+    t_finalizerHelperIndex = pArgs->m_index;
+    delete pArgs;
+
+    if (pThread->HasStarted())
+    {
+        INSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+        {
+            // Run as background thread, so ThreadStore::WaitForOtherThreads will not wait for it
+            pThread->SetBackground(TRUE);
+
+            while (!fQuitFinalizer)
+            {
+                // Same exception policy as the finalizer thread
+                ManagedThreadBase::FinalizerBase(FinalizerHelperThreadWorker);
+            }
+        }
+        UNINSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+    }
+
+    DestroyThread(pThread);
+
+    return 0;
+}
 
 VOID FinalizerThread::FinalizerThreadWorker(void *args)
 {
@@ -371,6 +559,12 @@ VOID FinalizerThread::FinalizerThreadWorker(void *args)
             Thread::InitializationForManagedThreadInNative(GetFinalizerThread());
         }
 
+        if (!s_StartedFinalizerHelperThreads)
+        {
+            s_StartedFinalizerHelperThreads = TRUE;
+            StartHelperThreads();
+        }
+
         JitHost::Reclaim();
 
         GetFinalizerThread()->DisablePreemptiveGC();
@@ -406,7 +600,9 @@ VOID FinalizerThread::FinalizerThreadWorker(void *args)
 
         int observedFullGcCount =
             GCHeapUtilities::GetGCHeap()->CollectionCount(GCHeapUtilities::GetGCHeap()->GetMaxGeneration());
+        WakeHelperThreads();
         FinalizeAllObjects();
+        WaitForHelperThreads();
 
         // Anyone waiting to drain the Q can now wake up.  Note that there is a
         // race in that another thread starting a drain, as we leave a drain, may
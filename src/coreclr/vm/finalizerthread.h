@@ -34,6 +34,23 @@ class FinalizerThread
 
     static void FinalizeAllObjects();
 
+    // Helper threads, started when DOTNET_FinalizerThreadCount is above 1. On every pass the
+    // finalizer thread wakes the helpers, runs finalizers itself and waits for the helpers to
+    // drain the queues before it signals the pass as done. Helpers only take non-critical
+    // finalizable objects, and each one starts at a different per-heap finalization queue.
+    static DWORD s_helperThreadCount;
+    static CLREvent *s_helperWorkEvents;
+    static CLREvent *hEventHelpersDone;
+    static LONG s_helpersPending;
+
+    static void StartHelperThreads();
+    static void WakeHelperThreads();
+    static void WaitForHelperThreads();
+    static void CompleteHelperPass();
+
+    static VOID FinalizerHelperThreadWorker(void *args);
+    static DWORD WINAPI FinalizerHelperThreadStart(void *args);
+
 public:
     static Thread* GetFinalizerThread()
     {
@@ -42,6 +59,7 @@ public:
         return g_pFinalizerThread;
     }
 
+    // TRUE on the finalizer thread and on the finalizer helper threads
     static BOOL IsCurrentThreadFinalizer();
 
     static void EnableFinalization();
@@ -56,8 +74,9 @@ public:
         fQuitFinalizer = TRUE;
         EnableFinalization();
 
-        // Do not wait for FinalizerThread if the current one is FinalizerThread.
-        if (GetThreadNULLOk() != GetFinalizerThread())
+        // Do not wait for FinalizerThread if the current one is FinalizerThread or one of its
+        // helpers, which the finalizer thread may be waiting for.
+        if (!IsCurrentThreadFinalizer())
         {
             // This wait must be alertable to handle cases where the current
             // thread's context is needed (i.e. RCW cleanup)
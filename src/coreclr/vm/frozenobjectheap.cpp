@@ -119,6 +119,309 @@ Object* FrozenObjectHeapManager::TryAllocateObject(PTR_MethodTable type, size_t
 #endif // !FEATURE_BASICFREEZE
 }
 
+#ifdef FEATURE_BASICFREEZE
+// Calls fn on every object reference slot of obj, walking the GCDesc the same way the GC does.
+template <typename TFunc>
+static void ForEachObjectRefSlot(Object* obj, TFunc fn)
+{
+    WRAPPER_NO_CONTRACT;
+
+    MethodTable* pMT = obj->GetMethodTable();
+    if (!pMT->ContainsGCPointers())
+    {
+        return;
+    }
+
+    uint8_t* o = reinterpret_cast<uint8_t*>(obj);
+    size_t size = obj->GetSize();
+    CGCDesc* map = CGCDesc::GetCGCDescFromMT(pMT);
+    CGCDescSeries* cur = map->GetHighestSeries();
+    ptrdiff_t cnt = (ptrdiff_t)map->GetNumSeries();
+
+    if (cnt >= 0)
+    {
+        CGCDescSeries* last = map->GetLowestSeries();
+        do
+        {
+            Object** slot = reinterpret_cast<Object**>(o + cur->GetSeriesOffset());
+            Object** stop = reinterpret_cast<Object**>((uint8_t*)slot + cur->GetSeriesSize() + size);
+            for (; slot < stop; slot++)
+            {
+                fn(slot);
+            }
+            cur--;
+        } while (cur >= last);
+    }
+    else
+    {
+        // Array of value types, the series repeat for every element
+        Object** slot = reinterpret_cast<Object**>(o + cur->startoffset);
+        while ((uint8_t*)slot < (o + size - sizeof(ObjHeader)))
+        {
+            for (ptrdiff_t i = 0; i > cnt; i--)
+            {
+                HALF_SIZE_T skip = (cur->val_serie + i)->skip;
+                HALF_SIZE_T nptrs = (cur->val_serie + i)->nptrs;
+                Object** stop = slot + nptrs;
+                for (; slot < stop; slot++)
+                {
+                    fn(slot);
+                }
+                slot = reinterpret_cast<Object**>((uint8_t*)stop + skip);
+            }
+        }
+    }
+}
+
+// Frozen objects are never collected, finalized or moved and we don't support
+// custom alignment on frozen segments yet.
+static bool IsFreezableType(MethodTable* pMT)
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (pMT->Collectible() || pMT->HasFinalizer())
+    {
+        return false;
+    }
+
+#ifdef FEATURE_64BIT_ALIGNMENT
+    if (pMT->RequiresAlign8())
+    {
+        return false;
+    }
+#endif
+
+    if (pMT->IsArray())
+    {
+        TypeHandle elementType = pMT->GetArrayElementTypeHandle();
+        if ((DATA_ALIGNMENT < sizeof(double)) && (elementType == CoreLibBinder::GetElementType(ELEMENT_TYPE_R8)))
+        {
+            return false;
+        }
+#ifdef FEATURE_64BIT_ALIGNMENT
+        MethodTable* pElementMT = elementType.GetMethodTable();
+        if (pElementMT->RequiresAlign8() && pElementMT->IsValueType())
+        {
+            return false;
+        }
+#endif
+    }
+
+    return true;
+}
+
+// Walks an object graph breadth first. Without a segment it only checks that every
+// object in the graph can be frozen and adds up their sizes. With one it also copies
+// every object into it and points the references of the copies at the other copies.
+// Nothing here may trigger a GC - the graph has to stay where it is for the whole walk.
+class FrozenObjectGraphWalker
+{
+public:
+    FrozenObjectGraphWalker(FrozenObjectSegment* pSegment) :
+        m_pSegment(pSegment),
+        m_pGCHeap(GCHeapUtilities::GetGCHeap()),
+        m_TotalSize(0),
+        m_pFrozenRoot(nullptr),
+        m_fFailed(false)
+    {
+    }
+
+    bool Walk(Object* root)
+    {
+        CONTRACTL
+        {
+            THROWS;
+            GC_NOTRIGGER;
+            MODE_COOPERATIVE;
+        }
+        CONTRACTL_END
+
+        m_pFrozenRoot = Visit(root);
+
+        for (COUNT_T i = 0; !m_fFailed && (i < m_Pending.GetCount()); i++)
+        {
+            Object* obj = m_Pending[i];
+            Object* copy = nullptr;
+            m_Copies.Lookup(obj, &copy);
+
+            ForEachObjectRefSlot(obj, [&](Object** slot)
+            {
+                Object* ref = *slot;
+                if ((ref == nullptr) || m_fFailed)
+                {
+                    return;
+                }
+
+                Object* refCopy = Visit(ref);
+                if ((m_pSegment != nullptr) && (refCopy != nullptr))
+                {
+                    size_t slotOffset = (uint8_t*)slot - (uint8_t*)obj;
+                    *reinterpret_cast<Object**>((uint8_t*)copy + slotOffset) = refCopy;
+                }
+            });
+        }
+
+        return !m_fFailed;
+    }
+
+    size_t GetTotalSize() const { return m_TotalSize; }
+    Object* GetFrozenRoot() const { return m_pFrozenRoot; }
+
+private:
+    // Returns what a reference to obj should point at in the frozen graph.
+    Object* Visit(Object* obj)
+    {
+        WRAPPER_NO_CONTRACT;
+
+        if (m_pGCHeap->IsInFrozenSegment(obj))
+        {
+            // E.g. a string literal, no need to copy it again
+            return obj;
+        }
+
+        Object* copy;
+        if (m_Copies.Lookup(obj, &copy))
+        {
+            return copy;
+        }
+
+        MethodTable* pMT = obj->GetMethodTable();
+        if (!IsFreezableType(pMT))
+        {
+            m_fFailed = true;
+            return nullptr;
+        }
+
+        size_t objectSize = ALIGN_UP(obj->GetSize(), DATA_ALIGNMENT);
+        m_TotalSize += objectSize;
+
+        if (m_pSegment == nullptr)
+        {
+            copy = obj;
+        }
+        else
+        {
+            copy = m_pSegment->TryAllocateObject(pMT, objectSize);
+            if (copy == nullptr)
+            {
+                // The graph grew since it was measured
+                m_fFailed = true;
+                return nullptr;
+            }
+
+            // The header stays clear, the sync block or hash code of obj doesn't belong to its copy.
+            memcpy((uint8_t*)copy + sizeof(MethodTable*), (uint8_t*)obj + sizeof(MethodTable*),
+                obj->GetSize() - sizeof(ObjHeader) - sizeof(MethodTable*));
+        }
+
+        m_Copies.Add(obj, copy);
+        if (pMT->ContainsGCPointers())
+        {
+            m_Pending.Append(obj);
+        }
+        return copy;
+    }
+
+    FrozenObjectSegment* m_pSegment;
+    IGCHeap* m_pGCHeap;
+    size_t m_TotalSize;
+    Object* m_pFrozenRoot;
+    bool m_fFailed;
+    MapSHash<Object*, Object*> m_Copies;
+    SArray<Object*> m_Pending;
+};
+#endif // FEATURE_BASICFREEZE
+
+// Copies the fully built object graph rooted at *pRoot onto a frozen segment of its own and
+// returns the copy of the root. The GC never marks, card-scans or compacts frozen objects, so
+// the copies must not be mutated afterwards - a reference stored into them would not be seen.
+// Objects that are already frozen (e.g. string literals) are referenced as they are.
+// Returns nullptr if the graph contains an object that can't be frozen, in such cases
+// the caller is expected to keep using the original graph.
+Object* FrozenObjectHeapManager::TryFreezeObjectGraph(OBJECTREF* pRoot)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        PRECONDITION(pRoot != nullptr && *pRoot != NULL);
+    }
+    CONTRACTL_END
+
+#ifndef FEATURE_BASICFREEZE
+    // GC is required to support frozen segments
+    return nullptr;
+#else // FEATURE_BASICFREEZE
+
+    if (GCHeapUtilities::GetGCHeap()->IsInFrozenSegment(OBJECTREFToObject(*pRoot)))
+    {
+        return OBJECTREFToObject(*pRoot);
+    }
+
+    // Measure the graph first so we can reserve a segment that fits all of it.
+    size_t totalSize = 0;
+    {
+        FrozenObjectGraphWalker walker(nullptr);
+        if (!walker.Walk(OBJECTREFToObject(*pRoot)))
+        {
+            return nullptr;
+        }
+        totalSize = walker.GetTotalSize();
+    }
+
+    // Leave room for the header of the first object and the one after the last object.
+    const size_t segmentSize = max((size_t)(2 * FOH_COMMIT_SIZE),
+        ALIGN_UP(totalSize + 2 * sizeof(ObjHeader), (size_t)FOH_COMMIT_SIZE));
+
+    NewHolder<FrozenObjectSegment> seg;
+    {
+        // The graph may be moved by a GC here so nothing from the walk above can be reused
+        GCX_PREEMP();
+        seg = new FrozenObjectSegment(segmentSize);
+    }
+
+    if (seg->m_Size < segmentSize)
+    {
+        // The reservation fell back to the default size
+        ThrowOutOfMemory();
+    }
+
+    Object* frozenRoot = nullptr;
+    {
+        FrozenObjectGraphWalker walker(seg);
+        if (!walker.Walk(OBJECTREFToObject(*pRoot)))
+        {
+            // Only possible if the graph was changed after it was measured
+            return nullptr;
+        }
+        frozenRoot = walker.GetFrozenRoot();
+    }
+
+    FrozenObjectSegment* curSeg = seg.Extract();
+    {
+        GCX_PREEMP();
+        {
+            CrstHolder ch(&m_Crst);
+            m_FrozenSegments.Append(curSeg);
+        }
+
+        {
+            CrstHolder regLock(&m_SegmentRegistrationCrst);
+            curSeg->RegisterOrUpdate(curSeg->m_pCurrent, curSeg->m_SizeCommitted);
+        }
+    }
+
+    for (Object* obj = curSeg->GetFirstObject(); obj != nullptr; obj = curSeg->GetNextObject(obj))
+    {
+        Object* publishedObj = obj;
+        PublishFrozenObject(publishedObj);
+    }
+
+    return frozenRoot;
+#endif // !FEATURE_BASICFREEZE
+}
+
 // Reserve sizeHint bytes of memory for the given frozen segment.
 // The requested size can be be ignored in case of memory pressure and FOH_SEGMENT_DEFAULT_SIZE is used instead.
 FrozenObjectSegment::FrozenObjectSegment(size_t sizeHint) :
@@ -167,6 +470,16 @@ FrozenObjectSegment::FrozenObjectSegment(size_t sizeHint) :
     _ASSERT(IS_ALIGNED(committedAlloc, DATA_ALIGNMENT));
 }
 
+// Only segments that never made it to the GC get deleted.
+FrozenObjectSegment::~FrozenObjectSegment()
+{
+    _ASSERT(m_pCurrentRegistered == nullptr);
+    if (m_pStart != nullptr)
+    {
+        ClrVirtualFree(m_pStart, 0, MEM_RELEASE);
+    }
+}
+
 void FrozenObjectSegment::RegisterOrUpdate(uint8_t* current, size_t sizeCommited)
 {
     CONTRACTL
@@ -215,7 +528,6 @@ Object* FrozenObjectSegment::TryAllocateObject(PTR_MethodTable type, size_t obje
     _ASSERT((m_pStart != nullptr) && (m_Size > 0));
     _ASSERT(IS_ALIGNED(m_pCurrent, DATA_ALIGNMENT));
     _ASSERT(IS_ALIGNED(objectSize, DATA_ALIGNMENT));
-    _ASSERT(objectSize <= FOH_COMMIT_SIZE);
     _ASSERT(m_pCurrent >= m_pStart + sizeof(ObjHeader));
 
     const size_t spaceUsed = (size_t)(m_pCurrent - m_pStart);
@@ -230,17 +542,19 @@ Object* FrozenObjectSegment::TryAllocateObject(PTR_MethodTable type, size_t obje
         return nullptr;
     }
 
-    // Check if we need to commit a new chunk
+    // Check if we need to commit more chunks, objects from a frozen graph can be larger than FOH_COMMIT_SIZE
     if (spaceUsed + objectSize + sizeof(ObjHeader) > m_SizeCommitted)
     {
+        const size_t sizeToCommit = ALIGN_UP(spaceUsed + objectSize + sizeof(ObjHeader) - m_SizeCommitted, FOH_COMMIT_SIZE);
+
         // Make sure we don't go out of bounds during this commit
-        _ASSERT(m_SizeCommitted + FOH_COMMIT_SIZE <= m_Size);
+        _ASSERT(m_SizeCommitted + sizeToCommit <= m_Size);
 
-        if (ClrVirtualAlloc(m_pStart + m_SizeCommitted, FOH_COMMIT_SIZE, MEM_COMMIT, PAGE_READWRITE) == nullptr)
+        if (ClrVirtualAlloc(m_pStart + m_SizeCommitted, sizeToCommit, MEM_COMMIT, PAGE_READWRITE) == nullptr)
         {
             ThrowOutOfMemory();
         }
-        m_SizeCommitted += FOH_COMMIT_SIZE;
+        m_SizeCommitted += sizeToCommit;
     }
 
     Object* object = reinterpret_cast<Object*>(m_pCurrent);
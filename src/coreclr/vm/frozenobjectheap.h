@@ -29,6 +29,7 @@ public:
     FrozenObjectHeapManager();
     Object* TryAllocateObject(PTR_MethodTable type, size_t objectSize,
         void(*initFunc)(Object*,void*) = nullptr, void* pParam = nullptr);
+    Object* TryFreezeObjectGraph(OBJECTREF* pRoot);
 
 private:
     Crst m_Crst;
@@ -44,6 +45,7 @@ class FrozenObjectSegment
 {
 public:
     FrozenObjectSegment(size_t sizeHint);
+    ~FrozenObjectSegment();
     Object* TryAllocateObject(PTR_MethodTable type, size_t objectSize);
     void RegisterOrUpdate(uint8_t* current, size_t sizeCommited);
 
@@ -25,6 +25,8 @@
 #include "configuration.h"
 #include "genanalysis.h"
 #include "eventpipeadapter.h"
+#include "heapsnapshot.h"
+#include "allocationsampling.h"
 
 // Finalizes a weak reference directly.
 extern void FinalizeWeakReference(Object* obj);
@@ -366,6 +368,10 @@ void GCToEEInterface::GcDone(int condemned)
     CONTRACTL_END;
 
     Interop::OnGCFinished(condemned);
+
+#ifdef FEATURE_EVENT_TRACE
+    AllocationSampling::OnGCDone(condemned);
+#endif // FEATURE_EVENT_TRACE
 }
 
 bool GCToEEInterface::RefCountedHandleCallbacks(Object * pObject)
@@ -850,6 +856,13 @@ void GCToEEInterface::DiagGCEnd(size_t index, int gen, int reason, bool fConcurr
         GarbageCollectionFinishedCallback();
     }
 #endif // GC_PROFILING
+
+#ifdef FEATURE_PERFTRACING
+    if (!fConcurrent)
+    {
+        HeapSnapshot::OnGCEnd();
+    }
+#endif // FEATURE_PERFTRACING
 }
 
 void GCToEEInterface::DiagWalkFReachableObjects(void* gcContext)
@@ -84,6 +84,15 @@ PTR_VOID GCHeapUtilities::GetGCModuleBase()
     return g_gc_module_base;
 }
 
+bool GCHeapUtilities::IsGCInterfaceMinorVersionAtLeast(uint32_t minorVersion)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    assert(g_gc_load_status == GC_LOAD_STATUS_LOAD_COMPLETE);
+    return (g_gc_version_info.MajorVersion > GC_INTERFACE_MAJOR_VERSION) ||
+           (g_gc_version_info.MinorVersion >= minorVersion);
+}
+
 namespace
 {
 // This block of code contains all of the state necessary to handle incoming
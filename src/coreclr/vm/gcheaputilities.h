@@ -198,6 +198,11 @@ public:
     // Gets a pointer to the module that contains the GC.
     static PTR_VOID GetGCModuleBase();
 
+    // Returns true if the loaded GC implements at least the given minor version of the
+    // IGCHeap interface. Methods added with a minor version bump must only be called
+    // when this returns true for that version.
+    static bool IsGCInterfaceMinorVersionAtLeast(uint32_t minorVersion);
+
     // Loads (if using a standalone GC) and initializes the GC.
     static HRESULT LoadAndInitialize();
 
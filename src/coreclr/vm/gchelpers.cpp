@@ -23,6 +23,7 @@
 #include "dynamicmethod.h"
 #include "stubhelpers.h"
 #include "eventtrace.h"
+#include "allocationsampling.h"
 
 #include "excep.h"
 
@@ -225,6 +226,13 @@ inline Object* Alloc(size_t size, GC_ALLOC_FLAGS flags)
         gc_alloc_context *threadContext = GetThreadAllocContext();
         GCStress<gc_on_alloc>::MaybeTrigger(threadContext);
         retVal = GCHeapUtilities::GetGCHeap()->Alloc(threadContext, size, flags);
+
+#ifdef FEATURE_EVENT_TRACE
+        if (retVal != NULL && AllocationSampling::IsEnabled())
+        {
+            AllocationSampling::OnAllocation(threadContext, retVal);
+        }
+#endif // FEATURE_EVENT_TRACE
     }
     else
     {
@@ -320,6 +328,11 @@ void PublishObjectAndNotify(TObj* &orObject, GC_ALLOC_FLAGS flags)
     LogAlloc(orObject);
 #endif // _LOGALLOC
 
+#ifdef FEATURE_EVENT_TRACE
+    // Before the profiler callback, which can move the object
+    AllocationSampling::OnObjectPublished(orObject, flags);
+#endif // FEATURE_EVENT_TRACE
+
     // Notify the profiler of the allocation
     // do this after initializing bounds so callback has size information
     if (TrackAllocations() ||
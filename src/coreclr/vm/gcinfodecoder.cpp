@@ -262,6 +262,8 @@ GcInfoDecoder::GcInfoDecoder(
             , m_ReturnKind(RT_Illegal)
 #ifdef _DEBUG
             , m_Flags( flags )
+#endif
+#if defined(_DEBUG) || defined(GCINFODECODER_LIVE_SLOT_CACHE)
             , m_GcInfoAddress(dac_cast<PTR_CBYTE>(gcInfoToken.Info))
 #endif
            , m_Version(gcInfoToken.Version)
@@ -710,6 +712,109 @@ UINT32  GcInfoDecoder::GetSizeOfStackParameterArea()
 #endif // FIXED_STACK_PARAMETER_SCRATCH_AREA
 
 
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+
+//------------------------------------------------------------------------------
+// Live slot cache
+//
+// Stack walks for GC root enumeration decode the same handful of call sites over
+// and over (the frames of long-lived threads rarely change between GCs). Each thread
+// keeps a small set-associative LRU cache mapping a (GC info, code offset) pair to
+// the set of live tracked slots, so only the slot table needs to be decoded on a hit.
+// The cache is per thread, so server GC threads walking stacks in parallel never
+// contend on it. Only methods with at most 64 tracked slots are cached.
+//------------------------------------------------------------------------------
+
+#define LIVE_SLOT_CACHE_SETS        64
+#define LIVE_SLOT_CACHE_WAYS        4
+#define LIVE_SLOT_CACHE_MAX_SLOTS   64
+
+struct LiveSlotCacheEntry
+{
+    PTR_CBYTE   pGcInfo;         // NULL if the entry is empty
+    UINT32      codeOffset;
+    UINT32      executionAborted;
+    UINT64      liveSlots;       // bit i set if tracked slot i is live
+};
+
+struct LiveSlotCache
+{
+    UINT32              epoch;
+    LiveSlotCacheEntry  sets[LIVE_SLOT_CACHE_SETS][LIVE_SLOT_CACHE_WAYS];   // each set in MRU order
+};
+
+static thread_local LiveSlotCache t_liveSlotCache;
+
+// Bumped whenever GC info may have been freed; a thread's cache is flushed when it
+// sees a different value.
+static LONG s_liveSlotCacheEpoch = 1;
+
+void GcInfoDecoder::InvalidateLiveSlotCaches()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    InterlockedIncrement(&s_liveSlotCacheEpoch);
+}
+
+static LiveSlotCacheEntry* GetLiveSlotCacheSet(PTR_CBYTE pGcInfo, UINT32 codeOffset)
+{
+    LiveSlotCache* pCache = &t_liveSlotCache;
+
+    UINT32 epoch = (UINT32)VolatileLoadWithoutBarrier(&s_liveSlotCacheEpoch);
+    if (pCache->epoch != epoch)
+    {
+        memset(pCache->sets, 0, sizeof(pCache->sets));
+        pCache->epoch = epoch;
+    }
+
+    size_t hash = (size_t)dac_cast<TADDR>(pGcInfo);
+    hash = (hash ^ (hash >> 7) ^ ((size_t)codeOffset * 0x9E3779B1)) >> 2;
+    return pCache->sets[hash % LIVE_SLOT_CACHE_SETS];
+}
+
+static bool LookupLiveSlotCache(LiveSlotCacheEntry* pSet, PTR_CBYTE pGcInfo, UINT32 codeOffset, UINT32 executionAborted, UINT64* pLiveSlots)
+{
+    for (UINT32 way = 0; way < LIVE_SLOT_CACHE_WAYS; way++)
+    {
+        if (pSet[way].pGcInfo == pGcInfo &&
+            pSet[way].codeOffset == codeOffset &&
+            pSet[way].executionAborted == executionAborted)
+        {
+            LiveSlotCacheEntry hit = pSet[way];
+            memmove(&pSet[1], &pSet[0], way * sizeof(LiveSlotCacheEntry));
+            pSet[0] = hit;
+
+            *pLiveSlots = hit.liveSlots;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void InsertLiveSlotCache(LiveSlotCacheEntry* pSet, PTR_CBYTE pGcInfo, UINT32 codeOffset, UINT32 executionAborted, UINT64 liveSlots)
+{
+    // Evict the least recently used entry
+    memmove(&pSet[1], &pSet[0], (LIVE_SLOT_CACHE_WAYS - 1) * sizeof(LiveSlotCacheEntry));
+
+    pSet[0].pGcInfo = pGcInfo;
+    pSet[0].codeOffset = codeOffset;
+    pSet[0].executionAborted = executionAborted;
+    pSet[0].liveSlots = liveSlots;
+}
+
+#define RECORD_LIVE_SLOT(slotIndex)                     \
+    do {                                                \
+        if (pCacheSet != NULL)                          \
+            liveSlots |= ((UINT64)1 << (slotIndex));    \
+    } while (0)
+
+#else // GCINFODECODER_LIVE_SLOT_CACHE
+
+#define RECORD_LIVE_SLOT(slotIndex) do { } while (0)
+
+#endif // GCINFODECODER_LIVE_SLOT_CACHE
+
 bool GcInfoDecoder::EnumerateLiveSlots(
                 PREGDISPLAY         pRD,
                 bool                reportScratchSlots,
@@ -747,6 +852,11 @@ bool GcInfoDecoder::EnumerateLiveSlots(
 
     GcSlotDecoder slotDecoder;
 
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+    LiveSlotCacheEntry* pCacheSet = NULL;
+    UINT64 liveSlots = 0;
+#endif // GCINFODECODER_LIVE_SLOT_CACHE
+
     UINT32 normBreakOffset = NORMALIZE_CODE_OFFSET(m_InstructionOffset);
 
     // Normalized break offset
@@ -843,6 +953,35 @@ bool GcInfoDecoder::EnumerateLiveSlots(
         if(!numSlots)
             goto ReportUntracked;
 
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+        if (numSlots <= LIVE_SLOT_CACHE_MAX_SLOTS)
+        {
+            LiveSlotCacheEntry* pSet = GetLiveSlotCacheSet(m_GcInfoAddress, m_InstructionOffset);
+            UINT64 cachedLiveSlots;
+            if (LookupLiveSlotCache(pSet, m_GcInfoAddress, m_InstructionOffset, executionAborted, &cachedLiveSlots))
+            {
+                for (UINT32 slotIndex = 0; cachedLiveSlots != 0; slotIndex++, cachedLiveSlots >>= 1)
+                {
+                    if (cachedLiveSlots & 1)
+                    {
+                        ReportSlotToGC(slotDecoder,
+                                       slotIndex,
+                                       pRD,
+                                       reportScratchSlots,
+                                       inputFlags,
+                                       pCallBack,
+                                       hCallBack
+                                       );
+                    }
+                }
+                goto ReportUntracked;
+            }
+
+            // Remember the slots reported below so the next walk can skip decoding them
+            pCacheSet = pSet;
+        }
+#endif // GCINFODECODER_LIVE_SLOT_CACHE
+
 #ifdef PARTIALLY_INTERRUPTIBLE_GC_SUPPORTED
 
         UINT32 numBitsPerOffset = 0;
@@ -888,6 +1027,7 @@ bool GcInfoDecoder::EnumerateLiveSlots(
                                                pCallBack,
                                                hCallBack
                                                );
+                                RECORD_LIVE_SLOT(slotIndex);
                             }
                         }
                         readSlots += cnt;
@@ -904,19 +1044,30 @@ bool GcInfoDecoder::EnumerateLiveSlots(
                 m_Reader.Skip(m_SafePointIndex * numSlots);
             }
 
-            for(UINT32 slotIndex = 0; slotIndex < numSlots; slotIndex++)
+            // Most slots are dead at any given call site, so read the live state a word at a time
+            // and only look at the bits up to the last live slot of each word
+            for(UINT32 slotBase = 0; slotBase < numSlots; slotBase += BITS_PER_SIZE_T)
             {
-                if(m_Reader.ReadOneFast())
+                UINT32 numBits = numSlots - slotBase;
+                if (numBits > (UINT32)BITS_PER_SIZE_T)
+                    numBits = (UINT32)BITS_PER_SIZE_T;
+
+                size_t liveBits = m_Reader.Read((int)numBits);
+                for(UINT32 slotIndex = slotBase; liveBits != 0; slotIndex++, liveBits >>= 1)
                 {
-                    ReportSlotToGC(
-                            slotDecoder,
-                            slotIndex,
-                            pRD,
-                            reportScratchSlots,
-                            inputFlags,
-                            pCallBack,
-                            hCallBack
-                            );
+                    if(liveBits & 1)
+                    {
+                        ReportSlotToGC(
+                                slotDecoder,
+                                slotIndex,
+                                pRD,
+                                reportScratchSlots,
+                                inputFlags,
+                                pCallBack,
+                                hCallBack
+                                );
+                        RECORD_LIVE_SLOT(slotIndex);
+                    }
                 }
             }
             goto ReportUntracked;
@@ -1073,6 +1224,7 @@ bool GcInfoDecoder::EnumerateLiveSlots(
                             pCallBack,
                             hCallBack
                             );
+                    RECORD_LIVE_SLOT(slotIndex);
                 }
 
                 slotIndex++;
@@ -1084,6 +1236,13 @@ bool GcInfoDecoder::EnumerateLiveSlots(
 
 ReportUntracked:
 
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+    if (pCacheSet != NULL)
+    {
+        InsertLiveSlotCache(pCacheSet, m_GcInfoAddress, m_InstructionOffset, executionAborted, liveSlots);
+    }
+#endif // GCINFODECODER_LIVE_SLOT_CACHE
+
     //------------------------------------------------------------------------------
     // Last report anything untracked
     // But only for the leaf funclet/frame
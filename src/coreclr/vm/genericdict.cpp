@@ -67,6 +67,19 @@ DictionaryLayout* DictionaryLayout::Allocate(WORD              numSlots,
     RETURN pD;
 }
 
+//---------------------------------------------------------------------------------------
+//
+//static
+WORD DictionaryLayout::GetInitialSlotCount(WORD estimatedSlots)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Every expansion takes the dictionary expansion lock and leaves the dictionaries allocated with the
+    // old layout to be reallocated on their next miss, so a layout that is known to grow is better off
+    // starting large.
+    return max(estimatedSlots, g_pConfig->GenericDictionaryMinSlots());
+}
+
 #endif //!DACCESS_COMPILE
 
 //---------------------------------------------------------------------------------------
@@ -291,6 +304,10 @@ DictionaryLayout* DictionaryLayout::ExpandDictionaryLayout(LoaderAllocator*
 #endif
 
     pNewDictionaryLayout->m_numInitialSlots = pCurrentDictLayout->m_numInitialSlots;
+    pNewDictionaryLayout->m_numSlowPathLookups = pCurrentDictLayout->m_numSlowPathLookups;
+
+    LOG((LF_JIT, LL_INFO1000, "GENERICS: Expanding dictionary layout from %d to %d slots (initially %d slots, %d slow path lookups)\n",
+        pCurrentDictLayout->m_numSlots, pNewDictionaryLayout->m_numSlots, pCurrentDictLayout->m_numInitialSlots, pCurrentDictLayout->m_numSlowPathLookups));
 
     for (DWORD iSlot = 0; iSlot < pCurrentDictLayout->m_numSlots; iSlot++)
         pNewDictionaryLayout->m_slots[iSlot] = pCurrentDictLayout->m_slots[iSlot];
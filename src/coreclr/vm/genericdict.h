@@ -106,6 +106,10 @@ private:
     // Number of non-type-argument slots of the initial layout before any expansion
     WORD m_numInitialSlots;
 
+    // Number of lookups through this layout that missed the dictionary and went to the generic
+    // handle helper's slow path, carried over when the layout is expanded
+    LONG m_numSlowPathLookups;
+
     // m_numSlots of these
     DictionaryEntryLayout m_slots[1];
 
@@ -139,6 +143,9 @@ public:
     // Create an initial dictionary layout containing numSlots slots
     static DictionaryLayout* Allocate(WORD numSlots, LoaderAllocator *pAllocator, AllocMemTracker *pamTracker);
 
+    // Number of slots to create a new layout with, given an estimate of the slots it needs
+    static WORD GetInitialSlotCount(WORD estimatedSlots);
+
     // Total number of bytes used for this dictionary, which might be stored inline in
     // another structure (e.g. MethodTable). This may include the final back-pointer
     // to previous dictionaries after dictionary expansion; pSlotSize is used to return
@@ -167,6 +174,18 @@ public:
     DWORD GetNumInitialSlots();
     DWORD GetNumUsedSlots();
 
+    void RecordSlowPathLookup()
+    {
+        LIMITED_METHOD_CONTRACT;
+        InterlockedIncrement(&m_numSlowPathLookups);
+    }
+
+    DWORD GetNumSlowPathLookups()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (DWORD)m_numSlowPathLookups;
+    }
+
     PTR_DictionaryEntryLayout GetEntryLayout(DWORD i)
     {
         LIMITED_METHOD_CONTRACT;
@@ -269,7 +269,7 @@ ClassLoader::CreateTypeHandleForNonCanonicalGenericInstantiation(
         ThrowHR(COR_E_OVERFLOW);
     }
 
-    BYTE* pMemory = (BYTE *) pamTracker->Track(pAllocator->GetHighFrequencyHeap()->AllocMem( allocSize ));
+    BYTE* pMemory = MethodTable::AllocateMethodTableMemory(pAllocator, pamTracker, cbGC, allocSize);
 
     // Head of MethodTable memory
     MethodTable *pMT = (MethodTable*) (pMemory + cbGC);
@@ -380,7 +380,7 @@ InstantiatedMethodDesc::NewInstantiatedMethodDesc(MethodTable *pExactMT,
             }
             else if (getWrappedCode)
             {
-                pDL = DictionaryLayout::Allocate(NUM_DICTIONARY_SLOTS, pAllocator, &amt);
+                pDL = DictionaryLayout::Allocate(DictionaryLayout::GetInitialSlotCount(NUM_DICTIONARY_SLOTS), pAllocator, &amt);
 #ifdef _DEBUG
                 {
                     SString name;
@@ -460,7 +460,9 @@ InstantiatedMethodDesc::NewInstantiatedMethodDesc(MethodTable *pExactMT,
             }
         }
 
-        // OK, now we have a candidate MethodDesc.
+        // OK, now we have a candidate MethodDesc. Its hash entry is also allocated before taking the lock.
+        InstMethodHashTable* pTable = pExactMDLoaderModule->GetInstMethodHashTable();
+        InstMethodHashEntry_t* pNewEntry = pTable->AllocNewEntry(&amt);
         {
             CrstHolder ch(&pExactMDLoaderModule->m_InstMethodHashTableCrst);
 
@@ -507,8 +509,7 @@ InstantiatedMethodDesc::NewInstantiatedMethodDesc(MethodTable *pExactMT,
                 _ASSERTE(!pNewMD->IsTightlyBoundToMethodTable());
 
                 // The method desc is fully set up; now add to the table
-                InstMethodHashTable* pTable = pExactMDLoaderModule->GetInstMethodHashTable();
-                pTable->InsertMethodDesc(pNewMD);
+                pTable->InsertMethodDescUsingPreallocatedEntry(pNewEntry, pNewMD);
             }
             else
                 pNewMD = pOldMD;
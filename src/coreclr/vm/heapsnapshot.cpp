@@ -0,0 +1,134 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+
+#ifdef FEATURE_PERFTRACING
+
+#include "heapsnapshot.h"
+#include "eventtrace.h"
+#include "gcheaputilities.h"
+#include <eventpipe/ds-dump-protocol.h>
+
+DiagnosticsHeapSnapshotWriter* volatile HeapSnapshot::s_pWriter = NULL;
+bool HeapSnapshot::s_fWalked = false;
+
+namespace
+{
+    bool CountReference(Object* pRef, void* pvContext)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        (*(uint32_t*)pvContext)++;
+        return true;
+    }
+
+    bool WriteReference(Object* pRef, void* pvContext)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        return ds_heap_snapshot_writer_write_reference((DiagnosticsHeapSnapshotWriter*)pvContext, (uint64_t)(size_t)pRef);
+    }
+}
+
+/* static */ HRESULT HeapSnapshot::Generate(DiagnosticsHeapSnapshotWriter* writer)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(writer != NULL);
+
+    if (!IsGarbageCollectorFullyInitialized())
+        return E_FAIL;
+
+    if (InterlockedCompareExchangeT(&s_pWriter, writer, (DiagnosticsHeapSnapshotWriter*)NULL) != NULL)
+        return HRESULT_FROM_WIN32(ERROR_BUSY);
+
+    s_fWalked = false;
+
+    // The walk happens on whichever blocking GC ends first, normally the one induced
+    // here. Every blocking GC leaves the whole heap walkable, not only the condemned
+    // generations, so an unrelated GC that gets there first produces an equally
+    // complete snapshot.
+    HRESULT hr = ETW::GCLog::ForceGCForDiagnostics();
+    if (SUCCEEDED(hr) && !s_fWalked)
+        hr = E_FAIL;
+
+    s_pWriter = NULL;
+    return hr;
+}
+
+/* static */ void HeapSnapshot::OnGCEnd()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    DiagnosticsHeapSnapshotWriter* writer = s_pWriter;
+    if (writer == NULL || s_fWalked)
+        return;
+
+    s_fWalked = true;
+
+    IGCHeap* pHeap = GCHeapUtilities::GetGCHeap();
+    pHeap->DiagWalkHeap(&HeapSnapshot::WalkObject, writer, pHeap->GetMaxGeneration(), true /* walk the large object heap */);
+}
+
+/* static */ bool HeapSnapshot::WalkObject(Object* pObject, void* pvContext)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    DiagnosticsHeapSnapshotWriter* writer = (DiagnosticsHeapSnapshotWriter*)pvContext;
+    MethodTable* pMT = pObject->GetGCSafeMethodTable();
+    uint64_t typeId = (uint64_t)(size_t)pMT;
+
+    if (ds_heap_snapshot_writer_add_type_id(writer, typeId))
+    {
+        // Names are best effort, same as the GCHeapDump events. The type is still
+        // described so that the client can resolve the id.
+        InlineSString<MAX_CLASSNAME_LENGTH> name;
+        EX_TRY
+        {
+            TypeHandle(pMT).GetName(name);
+            name.Normalize();
+        }
+        EX_CATCH
+        {
+            name.Clear();
+        }
+        EX_END_CATCH(RethrowTerminalExceptions);
+
+        if (!ds_heap_snapshot_writer_write_type(writer, typeId, reinterpret_cast<const ep_char16_t*>(name.GetUnicode()), name.GetCount()))
+            return false;
+    }
+
+    uint32_t cRefs = 0;
+    if (pMT->ContainsGCPointersOrCollectible())
+        GCHeapUtilities::GetGCHeap()->DiagWalkObject(pObject, &CountReference, &cRefs);
+
+    if (!ds_heap_snapshot_writer_write_object(writer, (uint64_t)(size_t)pObject, typeId, (uint64_t)pObject->GetSize(), cRefs))
+        return false;
+
+    // Both walks see the same references since the EE is suspended for the whole heap walk.
+    if (cRefs > 0)
+        GCHeapUtilities::GetGCHeap()->DiagWalkObject(pObject, &WriteReference, writer);
+
+    return !ds_heap_snapshot_writer_get_failed(writer);
+}
+
+#endif // FEATURE_PERFTRACING
@@ -0,0 +1,34 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef __HEAPSNAPSHOT_H__
+#define __HEAPSNAPSHOT_H__
+
+#ifdef FEATURE_PERFTRACING
+
+typedef struct _DiagnosticsHeapSnapshotWriter DiagnosticsHeapSnapshotWriter;
+
+// Streams the GC heap object graph (objects, types, sizes and references) to a
+// diagnostics client. The walk runs at the end of a blocking GC, while the EE is
+// suspended, and writes straight into the IPC stream so a slow client keeps the
+// runtime suspended rather than the snapshot being buffered in process.
+class HeapSnapshot
+{
+public:
+    // Induces a full blocking GC and walks the heap at the end of it. Only one
+    // snapshot can be in progress at a time.
+    static HRESULT Generate(DiagnosticsHeapSnapshotWriter* writer);
+
+    // Called by the GC at the end of every blocking collection.
+    static void OnGCEnd();
+
+private:
+    static bool WalkObject(Object* pObject, void* pvContext);
+
+    static DiagnosticsHeapSnapshotWriter* volatile s_pWriter;
+    static bool s_fWalked;
+};
+
+#endif // FEATURE_PERFTRACING
+
+#endif // __HEAPSNAPSHOT_H__
@@ -2693,6 +2693,77 @@ MarshalerOverrideStatus ILHandleRefMarshaler::ReturnOverride(NDirectStubLinker*
     return DISALLOWED;
 }
 
+MarshalerOverrideStatus ILBlittableSpanMarshaler::ArgumentOverride(NDirectStubLinker* psl,
+                                                BOOL               byref,
+                                                BOOL               fin,
+                                                BOOL               fout,
+                                                BOOL               fManagedToNative,
+                                                OverrideProcArgs*  pargs,
+                                                UINT*              pResID,
+                                                UINT               argidx)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (fManagedToNative && !byref)
+    {
+        ILCodeStream* pcsMarshal    = psl->GetMarshalCodeStream();
+        ILCodeStream* pcsDispatch   = psl->GetDispatchCodeStream();
+
+        pcsMarshal->SetStubTargetArgType(ELEMENT_TYPE_I);
+
+        MethodTable* pSpanMT = pargs->m_pMT;
+        BinderMethodID getPinnableReference = pSpanMT->HasSameTypeDefAs(CoreLibBinder::GetClass(CLASS__SPAN)) ?
+            METHOD__SPAN__GET_PINNABLE_REFERENCE : METHOD__READONLY_SPAN__GET_PINNABLE_REFERENCE;
+        MethodDesc* pGetPinnableReference = MethodDesc::FindOrCreateAssociatedMethodDesc(CoreLibBinder::GetMethod(getPinnableReference),
+            pSpanMT, FALSE, Instantiation(), FALSE);
+
+        // Same as a fixed statement over the span: GetPinnableReference returns a null
+        // reference for an empty span, so native code sees NULL.
+        LocalDesc pinnedLocal(pSpanMT->GetInstantiation()[0]);
+        pinnedLocal.MakeByRef();
+        pinnedLocal.MakePinned();
+        DWORD dwPinnedLocal = pcsMarshal->NewLocal(pinnedLocal);
+
+        pcsMarshal->EmitLDARGA(argidx);
+        pcsMarshal->EmitCALL(pcsMarshal->GetToken(pGetPinnableReference), 1, 1);
+        pcsMarshal->EmitSTLOC(dwPinnedLocal);
+
+        pcsDispatch->EmitLDLOC(dwPinnedLocal);
+        pcsDispatch->EmitCONV_I();
+
+        return OVERRIDDEN;
+    }
+    else
+    {
+        *pResID = IDS_EE_BADMARSHAL_SPANRESTRICTION;
+        return DISALLOWED;
+    }
+}
+
+MarshalerOverrideStatus ILBlittableSpanMarshaler::ReturnOverride(NDirectStubLinker* psl,
+                                              BOOL               fManagedToNative,
+                                              BOOL               fHresultSwap,
+                                              OverrideProcArgs*  pargs,
+                                              UINT*              pResID)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    *pResID = IDS_EE_BADMARSHAL_SPANRESTRICTION;
+    return DISALLOWED;
+}
+
 void ILSafeHandleMarshaler::EmitConvertContentsCLRToNative(ILCodeStream* pslILEmit)
 {
     _ASSERTE(IsFieldMarshal(m_dwMarshalFlags));
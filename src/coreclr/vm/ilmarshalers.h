@@ -2215,6 +2215,52 @@ public:
                                                   UINT*              pResID);
 };
 
+// Span<T> and ReadOnlySpan<T> of blittable T, passed by value from managed to native
+// code as a pinned pointer to the first element, without a copy. Like pinned blittable
+// arrays, this gives in/out semantics regardless of [In]/[Out].
+class ILBlittableSpanMarshaler : public ILMarshaler
+{
+public:
+    enum
+    {
+        c_fInOnly               = FALSE,
+        c_nativeSize            = TARGET_POINTER_SIZE,
+    };
+
+    LocalDesc GetManagedType()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return LocalDesc();
+    }
+
+    LocalDesc GetNativeType()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return LocalDesc();
+    }
+
+    virtual bool SupportsFieldMarshal(UINT* pErrorResID)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return false;
+    }
+
+    static MarshalerOverrideStatus ArgumentOverride(NDirectStubLinker* psl,
+                                                    BOOL               byref,
+                                                    BOOL               fin,
+                                                    BOOL               fout,
+                                                    BOOL               fManagedToNative,
+                                                    OverrideProcArgs*  pargs,
+                                                    UINT*              pResID,
+                                                    UINT               argidx);
+
+    static MarshalerOverrideStatus ReturnOverride(NDirectStubLinker* psl,
+                                                  BOOL               fManagedToNative,
+                                                  BOOL               fHresultSwap,
+                                                  OverrideProcArgs*  pargs,
+                                                  UINT*              pResID);
+};
+
 class ILSafeHandleMarshaler : public ILMarshaler
 {
 public:
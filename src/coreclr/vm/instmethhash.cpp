@@ -297,7 +297,37 @@ void InstMethodHashTable::InsertMethodDesc(MethodDesc *pMD)
     }
     CONTRACTL_END
 
-    InstMethodHashEntry_t * pNewEntry = (InstMethodHashEntry_t*)BaseAllocateEntry(NULL);
+    InsertMethodDescUsingPreallocatedEntry(AllocNewEntry(NULL), pMD);
+}
+
+InstMethodHashEntry_t *InstMethodHashTable::AllocNewEntry(AllocMemTracker *pamTracker)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END
+
+    return (InstMethodHashEntry_t*)BaseAllocateEntry(pamTracker);
+}
+
+// Add method desc to the hash table in an entry returned by AllocNewEntry; must not be present already
+void InstMethodHashTable::InsertMethodDescUsingPreallocatedEntry(InstMethodHashEntry_t *pNewEntry, MethodDesc *pMD)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(IsUnsealed());          // If we are sealed then we should not be adding to this hashtable
+        PRECONDITION(CheckPointer(pNewEntry));
+        PRECONDITION(CheckPointer(pMD));
+
+        // Generic method definitions (e.g. D.m<U> or C<int>.m<U>) belong in method tables, not here
+        PRECONDITION(!pMD->IsGenericMethodDefinition());
+    }
+    CONTRACTL_END
 
     DWORD dwKeyFlags = 0;
     if (pMD->RequiresInstArg())
@@ -104,6 +104,10 @@ public:
     // Add a method desc to the hash table
     void InsertMethodDesc(MethodDesc *pMD);
 
+    // Same, in an entry allocated by AllocNewEntry before taking the lock that serializes insertions
+    InstMethodHashEntry_t *AllocNewEntry(AllocMemTracker *pamTracker);
+    void InsertMethodDescUsingPreallocatedEntry(InstMethodHashEntry_t *pNewEntry, MethodDesc *pMD);
+
     // Look up a method in the hash table
     MethodDesc *FindMethodDesc(TypeHandle declaringType,
                                mdMethodDef token,
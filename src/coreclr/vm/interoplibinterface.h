@@ -41,6 +41,9 @@ public: // GC interaction
     static void OnFullGCStarted();
     static void OnFullGCFinished();
     static void AfterRefCountedHandleCallbacks();
+
+    // Frees the memory readers may have still been using before the runtime was suspended.
+    static void ReclaimAll();
 };
 // Native QCalls for the abstract ComWrappers managed type.
 extern "C" void QCALLTYPE ComWrappers_GetIUnknownImpl(
@@ -245,18 +245,155 @@ namespace
         }
 
     public: // Inner class definitions
-        class Traits : public DefaultSHashTraits<ExternalObjectContext *>
+        using Element = ExternalObjectContext*;
+
+        // Open addressed table of contexts that can be read without the lock.
+        //
+        // Writers hold the writer lock, or run on the GC thread while the runtime
+        // is suspended, and publish each slot with a single pointer store. When the
+        // table grows, the new table is published with a single pointer store as well,
+        // and the old one is only freed at the end of the next GC, since readers look
+        // up contexts in cooperative mode.
+        struct Table
+        {
+            Table* NextRetired;
+            count_t Size;       // Power of 2
+            count_t Shift;      // 32 - log2(Size)
+            count_t Count;      // Live contexts
+            count_t Occupied;   // Live and deleted contexts
+            Volatile<Element> Slots[1];
+
+            static const count_t MinimumSize = 16;
+
+            static Element Deleted() { LIMITED_METHOD_CONTRACT; return (Element)(INT_PTR)-1; }
+            static bool IsLive(_In_ Element e) { LIMITED_METHOD_CONTRACT; return e != NULL && e != Deleted(); }
+
+            static Table* Allocate(_In_ count_t size)
+            {
+                CONTRACTL
+                {
+                    THROWS;
+                    GC_NOTRIGGER;
+                    MODE_ANY;
+                }
+                CONTRACTL_END;
+
+                _ASSERTE(size >= MinimumSize && (size & (size - 1)) == 0);
+
+                BYTE* raw = new BYTE[offsetof(Table, Slots) + size * sizeof(Element)];
+                ZeroMemory(raw, offsetof(Table, Slots) + size * sizeof(Element));
+
+                Table* table = (Table*)raw;
+                table->Size = size;
+                table->Shift = 32;
+                for (count_t s = size; s > 1; s >>= 1)
+                    table->Shift--;
+                return table;
+            }
+
+            static void Free(_In_ Table* table)
+            {
+                LIMITED_METHOD_CONTRACT;
+                delete[] (BYTE*)table;
+            }
+
+            // Fibonacci hashing, since the identities are aligned pointers
+            count_t FirstSlot(_In_ const ExternalObjectContext::Key& key) const
+            {
+                LIMITED_METHOD_CONTRACT;
+                return (count_t)((key.Hash() * 2654435769u) >> Shift);
+            }
+
+            Element Lookup(_In_ const ExternalObjectContext::Key& key) const
+            {
+                LIMITED_METHOD_CONTRACT;
+
+                for (count_t i = FirstSlot(key); ; i = (i + 1) & (Size - 1))
+                {
+                    Element e = Slots[i];
+                    if (e == NULL)
+                        return NULL;
+
+                    if (e != Deleted() && e->GetKey() == key)
+                        return e;
+                }
+            }
+
+            void Add(_In_ Element cxt)
+            {
+                LIMITED_METHOD_CONTRACT;
+                _ASSERTE(Occupied < Size);
+
+                count_t i = FirstSlot(cxt->GetKey());
+                while (IsLive(Slots[i]))
+                    i = (i + 1) & (Size - 1);
+
+                if (Slots[i] == NULL)
+                    Occupied++;
+
+                Count++;
+                Slots[i] = cxt;
+            }
+
+            void Remove(_In_ Element cxt)
+            {
+                LIMITED_METHOD_CONTRACT;
+
+                for (count_t i = FirstSlot(cxt->GetKey()); Slots[i] != NULL; i = (i + 1) & (Size - 1))
+                {
+                    if (Slots[i] == cxt)
+                    {
+                        // Readers probing past this slot must keep going, so it can't be emptied.
+                        Slots[i] = Deleted();
+                        Count--;
+                        return;
+                    }
+                }
+            }
+        };
+
+        // Iterates over the live contexts of a table. The table must not be replaced
+        // while in use, which holding the lock or the runtime being suspended ensures.
+        class Iterator final
         {
+            Volatile<Element>* _curr;
+            Volatile<Element>* _end;
+
+            void SkipEmpty()
+            {
+                LIMITED_METHOD_CONTRACT;
+                while (_curr != _end && !Table::IsLive(*_curr))
+                    _curr++;
+            }
+
         public:
-            using key_t = ExternalObjectContext::Key;
-            static const key_t GetKey(_In_ element_t e) { LIMITED_METHOD_CONTRACT; return e->GetKey(); }
-            static count_t Hash(_In_ key_t key) { LIMITED_METHOD_CONTRACT; return (count_t)key.Hash(); }
-            static bool Equals(_In_ key_t lhs, _In_ key_t rhs) { LIMITED_METHOD_CONTRACT; return lhs == rhs; }
-        };
+            Iterator(_In_ Volatile<Element>* curr, _In_ Volatile<Element>* end)
+                : _curr{ curr }
+                , _end{ end }
+            {
+                SkipEmpty();
+            }
+
+            Element operator*() const { LIMITED_METHOD_CONTRACT; return *_curr; }
+            bool operator==(const Iterator& rhs) const { LIMITED_METHOD_CONTRACT; return _curr == rhs._curr; }
+            bool operator!=(const Iterator& rhs) const { LIMITED_METHOD_CONTRACT; return _curr != rhs._curr; }
+
+            Iterator& operator++()
+            {
+                LIMITED_METHOD_CONTRACT;
+                _curr++;
+                SkipEmpty();
+                return *this;
+            }
 
-        // Alias some useful types
-        using Element = SHash<Traits>::element_t;
-        using Iterator = SHash<Traits>::Iterator;
+            Iterator operator++(int)
+            {
+                LIMITED_METHOD_CONTRACT;
+                Iterator prev = *this;
+                ++(*this);
+                return prev;
+            }
+        };
 
         class ReaderLock final
         {
@@ -282,16 +419,33 @@ namespace
 
     private:
         friend struct InteropLibImports::RuntimeCallContext;
-        SHash<Traits> _hashMap;
+        Volatile<Table*> _table;
+        Table* _retiredTables;
         SimpleRWLock _lock;
         ExtObjCxtRefCache* _refCache;
 
         ExtObjCxtCache()
-            : _lock(COOPERATIVE, LOCK_TYPE_DEFAULT)
+            : _table(Table::Allocate(Table::MinimumSize))
+            , _retiredTables(NULL)
+            , _lock(COOPERATIVE, LOCK_TYPE_DEFAULT)
             , _refCache(GetAppDomain()->GetRCWRefCache())
         { }
         ~ExtObjCxtCache() = default;
 
+        Iterator Begin()
+        {
+            LIMITED_METHOD_CONTRACT;
+            Table* table = _table;
+            return Iterator{ &table->Slots[0], &table->Slots[table->Size] };
+        }
+
+        Iterator End()
+        {
+            LIMITED_METHOD_CONTRACT;
+            Table* table = _table;
+            return Iterator{ &table->Slots[table->Size], &table->Slots[table->Size] };
+        }
+
     public:
 #if _DEBUG
         bool IsLockHeld()
@@ -349,8 +503,8 @@ namespace
             SIZE_T objCountMax = 0;
             {
                 ReaderLock lock(this);
-                Iterator end = _hashMap.End();
-                for (Iterator curr = _hashMap.Begin(); curr != end; ++curr)
+                Iterator end = End();
+                for (Iterator curr = Begin(); curr != end; ++curr)
                 {
                     ExternalObjectContext* inst = *curr;
                     if (SELECT_OBJECT(inst))
@@ -371,8 +525,8 @@ namespace
             if (0 < objCountMax)
             {
                 ReaderLock lock(this);
-                Iterator end = _hashMap.End();
-                for (Iterator curr = _hashMap.Begin(); curr != end; ++curr)
+                Iterator end = End();
+                for (Iterator curr = Begin(); curr != end; ++curr)
                 {
                     ExternalObjectContext* inst = *curr;
                     if (SELECT_OBJECT(inst))
@@ -442,15 +596,14 @@ namespace
                 NOTHROW;
                 GC_NOTRIGGER;
                 MODE_COOPERATIVE;
-                PRECONDITION(IsLockHeld());
                 POSTCONDITION(CheckPointer(RETVAL, NULL_OK));
             }
             CONTRACT_END;
 
-            // Forbid the GC from messing with the hash table.
+            // The lock isn't needed, but the GC must not free the table while we look at it.
             GCX_FORBID();
 
-            RETURN _hashMap.Lookup(key);
+            RETURN _table.Load()->Lookup(key);
         }
 
         ExternalObjectContext* Add(_In_ ExternalObjectContext* cxt)
@@ -461,14 +614,38 @@ namespace
                 GC_NOTRIGGER;
                 MODE_COOPERATIVE;
                 PRECONDITION(IsLockHeld());
-                PRECONDITION(!Traits::IsNull(cxt) && !Traits::IsDeleted(cxt));
+                PRECONDITION(Table::IsLive(cxt));
                 PRECONDITION(cxt->Identity != NULL);
                 PRECONDITION(Find(cxt->GetKey()) == NULL);
                 POSTCONDITION(RETVAL == cxt);
             }
             CONTRACT_END;
 
-            _hashMap.Add(cxt);
+            Table* table = _table;
+
+            // Keep the table at most 3/4 occupied, counting deleted slots.
+            if ((table->Occupied + 1) * 4 > table->Size * 3)
+            {
+                count_t newSize = table->Size;
+                while ((table->Count + 1) * 2 > newSize)
+                    newSize *= 2;
+
+                Table* newTable = Table::Allocate(newSize);
+                for (count_t i = 0; i < table->Size; i++)
+                {
+                    Element e = table->Slots[i];
+                    if (Table::IsLive(e))
+                        newTable->Add(e);
+                }
+
+                // Readers may still be looking at the old table.
+                _table = newTable;
+                table->NextRetired = _retiredTables;
+                _retiredTables = table;
+                table = newTable;
+            }
+
+            table->Add(cxt);
             RETURN cxt;
         }
 
@@ -480,7 +657,7 @@ namespace
                 GC_NOTRIGGER;
                 MODE_COOPERATIVE;
                 PRECONDITION(IsLockHeld());
-                PRECONDITION(!Traits::IsNull(newCxt) && !Traits::IsDeleted(newCxt));
+                PRECONDITION(Table::IsLive(newCxt));
                 PRECONDITION(key == newCxt->GetKey());
                 POSTCONDITION(CheckPointer(RETVAL));
             }
@@ -503,7 +680,7 @@ namespace
                 NOTHROW;
                 GC_NOTRIGGER;
                 MODE_ANY;
-                PRECONDITION(!Traits::IsNull(cxt) && !Traits::IsDeleted(cxt));
+                PRECONDITION(Table::IsLive(cxt));
                 PRECONDITION(cxt->Identity != NULL);
 
                 // The GC thread doesn't have to take the lock
@@ -514,7 +691,28 @@ namespace
             }
             CONTRACTL_END;
 
-            _hashMap.Remove(cxt->GetKey());
+            _table.Load()->Remove(cxt);
+        }
+
+        void FreeRetiredTables()
+        {
+            CONTRACTL
+            {
+                NOTHROW;
+                GC_NOTRIGGER;
+                MODE_ANY;
+            }
+            CONTRACTL_END;
+
+            // Only called while the runtime is suspended, so no reader is in cooperative mode.
+            Table* table = _retiredTables;
+            _retiredTables = NULL;
+            while (table != NULL)
+            {
+                Table* next = table->NextRetired;
+                Table::Free(table);
+                table = next;
+            }
         }
 
         void DetachNotPromotedEOCs()
@@ -528,8 +726,8 @@ namespace
             }
             CONTRACTL_END;
 
-            Iterator curr = _hashMap.Begin();
-            Iterator end = _hashMap.End();
+            Iterator curr = Begin();
+            Iterator end = End();
 
             ExternalObjectContext* cxt;
             for (; curr != end; ++curr)
@@ -830,9 +1028,8 @@ namespace
             bool objectFound = false;
             bool tryRemove = false;
             {
-                // Perform a quick look up to determine if we know of the object and if
-                // we need to perform a more expensive cleanup operation below.
-                ExtObjCxtCache::ReaderLock lock(cache);
+                // Perform a quick look up, without the lock, to determine if we know of the
+                // object and if we need to perform a more expensive cleanup operation below.
                 extObjCxt = cache->Find(cacheKey);
                 objectFound = extObjCxt != NULL;
                 tryRemove = objectFound && extObjCxt->IsSet(ExternalObjectContext::Flags_Detached);
@@ -1394,8 +1591,8 @@ namespace InteropLibImports
         ExtObjCxtRefCache* RefCache;
 
         RuntimeCallContext(_In_ ExtObjCxtCache* cache)
-            : Curr{ cache->_hashMap.Begin() }
-            , End{ cache->_hashMap.End() }
+            : Curr{ cache->Begin() }
+            , End{ cache->End() }
             , RefCache{ cache->GetRefCache() }
         { }
     };
@@ -2055,6 +2252,21 @@ void ComWrappersNative::OnFullGCFinished()
     }
 }
 
+void ComWrappersNative::ReclaimAll()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    ExtObjCxtCache* cache = ExtObjCxtCache::GetInstanceNoThrow();
+    if (cache != NULL)
+        cache->FreeRetiredTables();
+}
+
 void ComWrappersNative::AfterRefCountedHandleCallbacks()
 {
     CONTRACTL
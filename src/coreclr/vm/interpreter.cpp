@@ -1817,7 +1817,7 @@ void Interpreter::JitMethodIfAppropriate(InterpreterMethodInfo* interpMethInfo,
         MODE_COOPERATIVE;
     } CONTRACTL_END;
 
-    unsigned int MaxInterpretCount = s_InterpreterJITThreshold.val(CLRConfig::INTERNAL_InterpreterJITThreshold);
+    unsigned int MaxInterpretCount = s_InterpreterJITThresholdValue;
     bool scheduleTieringBackgroundWork = false;
     TieredCompilationManager *tieredCompilationManager = GetAppDomain()->GetTieredCompilationManager();
 
@@ -6740,6 +6740,17 @@ void Interpreter::Initialize()
     s_InterpreterLooseRules = (s_InterpreterLooseRulesFlag.val(CLRConfig::INTERNAL_InterpreterLooseRules) != 0);
     s_InterpreterDoLoopMethods = (s_InterpreterDoLoopMethodsFlag.val(CLRConfig::INTERNAL_InterpreterDoLoopMethods) != 0);
 
+    // Interpreted code is the cold tier below tier 1. Unless the threshold is configured explicitly, promote
+    // interpreted methods after as many calls as call counting would allow tier 0 code.
+    if (g_pConfig->TieredCompilation_CallCounting() && !CLRConfig::IsConfigOptionSpecified(W("InterpreterJITThreshold")))
+    {
+        s_InterpreterJITThresholdValue = g_pConfig->TieredCompilation_CallCountThreshold();
+    }
+    else
+    {
+        s_InterpreterJITThresholdValue = s_InterpreterJITThreshold.val(CLRConfig::INTERNAL_InterpreterJITThreshold);
+    }
+
     // Initialize the lock used to protect method locks.
     // TODO: it would be better if this were a reader/writer lock.
     s_methodCacheLock.Init(CrstLeafLock, CRST_DEFAULT);
@@ -11626,6 +11637,7 @@ ConfigDWORD Interpreter::s_InterpreterLooseRulesFlag;
 bool Interpreter::s_InterpreterDoLoopMethods;
 bool Interpreter::s_InterpreterUseCaching;
 bool Interpreter::s_InterpreterLooseRules;
+unsigned Interpreter::s_InterpreterJITThresholdValue;
 
 CrstExplicitInit Interpreter::s_methodCacheLock;
 CrstExplicitInit Interpreter::s_interpStubToMDMapLock;
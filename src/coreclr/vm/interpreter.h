@@ -1557,6 +1557,7 @@ private:
     static ConfigDWORD s_InterpretMethHashMin;
     static ConfigDWORD s_InterpretMethHashMax;
     static ConfigDWORD s_InterpreterJITThreshold;
+    static unsigned    s_InterpreterJITThresholdValue;
     static ConfigDWORD s_InterpreterDoLoopMethodsFlag;
     static bool        s_InterpreterDoLoopMethods;
     static ConfigDWORD s_InterpreterUseCachingFlag;
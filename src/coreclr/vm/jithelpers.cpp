@@ -2153,6 +2153,12 @@ CORINFO_GENERIC_HANDLE JIT_GenericHandleWorker(MethodDesc * pMD, MethodTable * p
         }
     }
 
+    DictionaryLayout * pDictLayout = (pMT != NULL) ? pDeclaringMT->GetClass()->GetDictionaryLayout() : pMD->GetDictionaryLayout();
+    if (pDictLayout != NULL)
+    {
+        pDictLayout->RecordSlowPathLookup();
+    }
+
     DictionaryEntry * pSlot;
     CORINFO_GENERIC_HANDLE result = (CORINFO_GENERIC_HANDLE)Dictionary::PopulateEntry(pMD, pDeclaringMT, signature, FALSE, &pSlot, dictionaryIndexAndSlot, pModule);
 
@@ -3909,6 +3915,44 @@ void JIT_Patchpoint(int* counter, int ilOffset)
         ppInfo->m_osrMethodCode = osrMethodCode;
         isNewMethod = true;
     }
+    else
+    {
+        // The OSR method was jitted with the profile data the Tier0 method had collected
+        // when this patchpoint first triggered, which may only cover the first iterations
+        // of the loop. If new Tier0 frames keep transitioning here, the Tier0 method has
+        // since collected more profile data, so jit the OSR method once more with it and
+        // let later transitions use that version. Frames already running the first OSR
+        // method keep running it.
+        const int reoptimizeLimit = g_pConfig->OSR_ReoptimizeLimit();
+        LONG oldFlags = ppInfo->m_flags;
+
+        if ((reoptimizeLimit > 0) &&
+            ((oldFlags & PerPatchpointInfo::patchpoint_reoptimized) != PerPatchpointInfo::patchpoint_reoptimized) &&
+            (InterlockedIncrement(&ppInfo->m_transitionCount) >= reoptimizeLimit))
+        {
+            LONG newFlags = oldFlags | PerPatchpointInfo::patchpoint_reoptimized;
+            if (InterlockedCompareExchange(&ppInfo->m_flags, newFlags, oldFlags) == oldFlags)
+            {
+                LOG((LF_TIEREDCOMPILATION, LL_INFO10, "Jit_Patchpoint: patchpoint [%d] (0x%p) REOPTIMIZE after %d transitions\n",
+                    ppId, ip, reoptimizeLimit));
+
+                PCODE newMethodCode = HCCALL3(JIT_Patchpoint_Framed, pMD, codeInfo, ilOffset);
+
+                // If that failed, keep using the OSR method we already have.
+                if (newMethodCode != (PCODE)NULL)
+                {
+                    ppInfo->m_osrMethodCode = newMethodCode;
+                    osrMethodCode = newMethodCode;
+                    isNewMethod = true;
+                }
+                else
+                {
+                    STRESS_LOG3(LF_TIEREDCOMPILATION, LL_WARNING, "Jit_Patchpoint: patchpoint (0x%p) OSR method reoptimization failed,"
+                        " keeping the existing OSR method for Method=0x%pM il offset %d\n", ip, pMD, ilOffset);
+                }
+            }
+        }
+    }
 
     // If we get here, we have code to transition to...
     _ASSERTE(osrMethodCode != (PCODE)NULL);
@@ -4613,6 +4657,10 @@ HCIMPLEND
 // Here threshold = 13 means we count accurately up to 2^13 = 8192 and
 // then start counting probabilistically.
 //
+// With TieredPGO_ScalableCountSampling = N, we also count probabilistically
+// below the threshold: only one in 2^N updates (on average) touches the
+// counter, adding 2^N, so the expected count is unchanged.
+//
 // See docs/design/features/ScalableApproximateCounting.md
 //
 HCIMPL1(void, JIT_CountProfile32, volatile LONG* pCounter)
@@ -4623,21 +4671,27 @@ HCIMPL1(void, JIT_CountProfile32, volatile LONG* pCounter)
     LONG count = *pCounter;
     LONG delta = 1;
     DWORD threshold = g_pConfig->TieredPGO_ScalableCountThreshold();
+    DWORD logDelta = g_pConfig->TieredPGO_ScalableCountSampling();
 
     if (count > 0)
     {
         DWORD logCount = 0;
         BitScanReverse(&logCount, count);
 
-        if (logCount >= threshold)
+        if ((logCount >= threshold) && ((logCount - (threshold - 1)) > logDelta))
         {
-            delta = 1 << (logCount - (threshold - 1));
-            const unsigned rand = HandleHistogramProfileRand();
-            const bool update = (rand & (delta - 1)) == 0;
-            if (!update)
-            {
-                return;
-            }
+            logDelta = logCount - (threshold - 1);
+        }
+    }
+
+    if (logDelta > 0)
+    {
+        delta = 1 << logDelta;
+        const unsigned rand = HandleHistogramProfileRand();
+        const bool update = (rand & (delta - 1)) == 0;
+        if (!update)
+        {
+            return;
         }
     }
 
@@ -4653,21 +4707,27 @@ HCIMPL1(void, JIT_CountProfile64, volatile LONG64* pCounter)
     LONG64 count = *pCounter;
     LONG64 delta = 1;
     DWORD threshold = g_pConfig->TieredPGO_ScalableCountThreshold();
+    DWORD logDelta = g_pConfig->TieredPGO_ScalableCountSampling();
 
     if (count > 0)
     {
         DWORD logCount = 0;
         BitScanReverse64(&logCount, count);
 
-        if (logCount >= threshold)
+        if ((logCount >= threshold) && ((logCount - (threshold - 1)) > logDelta))
         {
-            delta = 1LL << (logCount - (threshold - 1));
-            const unsigned rand = HandleHistogramProfileRand();
-            const bool update = (rand & (delta - 1)) == 0;
-            if (!update)
-            {
-                return;
-            }
+            logDelta = logCount - (threshold - 1);
+        }
+    }
+
+    if (logDelta > 0)
+    {
+        delta = 1LL << logDelta;
+        const unsigned rand = HandleHistogramProfileRand();
+        const bool update = (rand & (delta - 1)) == 0;
+        if (!update)
+        {
+            return;
         }
     }
 
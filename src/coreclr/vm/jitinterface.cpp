@@ -94,6 +94,13 @@ thread_local int64_t t_cbILJittedForThread = 0;
 thread_local int64_t t_cMethodsJittedForThread = 0;
 thread_local int64_t t_c100nsTicksInJitForThread = 0;
 
+// Breakdown of the totals above for methods without metadata, which are usually
+// compiled once and whose JIT time is therefore pure startup overhead.
+Volatile<int64_t> g_cDynamicMethodsJitted = 0;
+Volatile<int64_t> g_c100nsTicksInJitForDynamicMethods = 0;
+Volatile<int64_t> g_cILStubsJitted = 0;
+Volatile<int64_t> g_c100nsTicksInJitForILStubs = 0;
+
 // This prevents tearing of 64 bit values on 32 bit systems
 static inline
 int64_t AtomicLoad64WithoutTearing(int64_t volatile *valueRef)
@@ -1304,13 +1311,19 @@ uint32_t CEEInfo::getThreadLocalFieldInfo (CORINFO_FIELD_HANDLE  field, bool isG
     MethodTable *pMT = fieldDesc->GetEnclosingMethodTable();
     pMT->EnsureTlsIndexAllocated();
 
-    if (isGCType)
+    ThreadStaticsInfo* pThreadStaticsInfo = MethodTableAuxiliaryData::GetThreadStaticsInfo(pMT->GetAuxiliaryData());
+    TLSIndex tlsIndex = isGCType ? pThreadStaticsInfo->GCTlsIndex : pThreadStaticsInfo->NonGCTlsIndex;
+
+    if (tlsIndex.GetTLSIndexType() == TLSIndexType::Collectible)
     {
-        typeIndex = MethodTableAuxiliaryData::GetThreadStaticsInfo(pMT->GetAuxiliaryData())->GCTlsIndex.GetIndexOffset();
+        // The JIT needs the index type to pick the collectible TLS array, and the optimized helpers
+        // accept the raw index as-is.
+        static_assert_no_msg(CORINFO_THREAD_STATIC_COLLECTIBLE_INDEX == (((uint32_t)TLSIndexType::Collectible) << 24));
+        typeIndex = tlsIndex.TLSIndexRawIndex;
     }
     else
     {
-        typeIndex = MethodTableAuxiliaryData::GetThreadStaticsInfo(pMT->GetAuxiliaryData())->NonGCTlsIndex.GetIndexOffset();
+        typeIndex = tlsIndex.GetIndexOffset();
     }
 
     assert(typeIndex != TypeIDProvider::INVALID_TYPE_ID);
@@ -1422,7 +1435,7 @@ void CEEInfo::getFieldInfo (CORINFO_RESOLVED_TOKEN * pResolvedToken,
                 fieldAccessor = intrinsicAccessor;
             }
             else
-            if (pFieldMT->Collectible())
+            if (pFieldMT->Collectible() && !pField->IsThreadStatic())
             {
                 // Static fields are not pinned in collectible types. We will always access
                 // them using a helper since the address cannot be embedded into the code.
@@ -1433,6 +1446,8 @@ void CEEInfo::getFieldInfo (CORINFO_RESOLVED_TOKEN * pResolvedToken,
             else if (pField->IsThreadStatic())
             {
                  // We always treat accessing thread statics as if we are in domain neutral code.
+                 // Thread statics of collectible types also come here: their blocks are found through
+                 // the TLS index rather than an embedded address, so the optimized access applies too.
                 fieldAccessor = CORINFO_FIELD_STATIC_SHARED_STATIC_HELPER;
 
                 pResult->helper = getSharedStaticsHelper(pField, pFieldMT);
@@ -12195,7 +12210,8 @@ void CEEJitInfo::allocMem (AllocMemArgs *pArgs)
             pArgs->hotCodeSize + pArgs->coldCodeSize, pArgs->roDataSize, totalSize.Value(), pArgs->flag, GetClrInstanceId());
     }
 
-    m_jitManager->allocCode(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), pArgs->flag, &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
+    m_jitManager->allocCode(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), pArgs->flag,
+                          m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER1), &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
                           , &m_pRealCodeHeader
 #ifdef FEATURE_EH_FUNCLETS
                           , m_totalUnwindInfos
@@ -13147,6 +13163,17 @@ PCODE UnsafeJitFunction(PrepareCodeConfig* config,
     InterlockedIncrement64((LONG64*)&g_cMethodsJitted);
     t_cMethodsJittedForThread++;
 
+    if (ftn->IsILStub())
+    {
+        InterlockedExchangeAdd64((LONG64*)&g_c100nsTicksInJitForILStubs, c100nsTicksInJit);
+        InterlockedIncrement64((LONG64*)&g_cILStubsJitted);
+    }
+    else if (ftn->IsLCGMethod())
+    {
+        InterlockedExchangeAdd64((LONG64*)&g_c100nsTicksInJitForDynamicMethods, c100nsTicksInJit);
+        InterlockedIncrement64((LONG64*)&g_cDynamicMethodsJitted);
+    }
+
     COOPERATIVE_TRANSITION_END();
     return ret;
 }
@@ -14490,6 +14517,93 @@ Invalid:
 #endif
 }
 
+#if defined(FEATURE_EH_FUNCLETS) && !defined(DACCESS_COMPILE)
+
+// Small direct-mapped cache of code lookups, kept per thread so that entries never need
+// to be synchronized. Exceptions used for control flow tend to be thrown repeatedly through
+// the same frames, and each frame otherwise costs a range section lookup, a nibble map scan
+// and a search for the function entry on both passes.
+#define CODE_LOOKUP_CACHE_SIZE 64
+
+struct CodeLookupCacheEntry
+{
+    PCODE                codeAddress;     // 0 if the entry is empty
+    RangeSection        *pRangeSection;
+    TADDR                pCodeHeader;
+    MethodDesc          *pMD;
+    IJitManager         *pJM;
+    DWORD                relOffset;
+    PTR_RUNTIME_FUNCTION pFunctionEntry;
+};
+
+struct CodeLookupCache
+{
+    LONG                 epoch;
+    CodeLookupCacheEntry entries[CODE_LOOKUP_CACHE_SIZE];
+};
+
+static thread_local CodeLookupCache t_codeLookupCache;
+
+// Bumped whenever code may have been freed; a thread's cache is flushed when it sees a
+// different value.
+static LONG s_codeLookupCacheEpoch = 1;
+
+void EECodeInfo::InvalidateCachedLookups()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    InterlockedIncrement(&s_codeLookupCacheEpoch);
+}
+
+void EECodeInfo::InitCached(PCODE codeAddress, ExecutionManager::ScanFlag scanFlag)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    CodeLookupCache* pCache = &t_codeLookupCache;
+
+    LONG epoch = VolatileLoadWithoutBarrier(&s_codeLookupCacheEpoch);
+    if (pCache->epoch != epoch)
+    {
+        memset(pCache->entries, 0, sizeof(pCache->entries));
+        pCache->epoch = epoch;
+    }
+
+    size_t hash = (size_t)codeAddress;
+    hash ^= hash >> 12;
+    CodeLookupCacheEntry* pEntry = &pCache->entries[(hash >> 2) % CODE_LOOKUP_CACHE_SIZE];
+
+    if (pEntry->codeAddress == codeAddress)
+    {
+        m_codeAddress = codeAddress;
+        m_methodToken = METHODTOKEN(pEntry->pRangeSection, pEntry->pCodeHeader);
+        m_pMD = pEntry->pMD;
+        m_pJM = pEntry->pJM;
+        m_relOffset = pEntry->relOffset;
+        m_pFunctionEntry = pEntry->pFunctionEntry;
+        return;
+    }
+
+    Init(codeAddress, scanFlag);
+
+    // Only managed code is cached; native frames are rare during exception dispatch
+    if (!IsValid())
+        return;
+
+    pEntry->codeAddress = codeAddress;
+    pEntry->pRangeSection = m_methodToken.m_pRangeSection;
+    pEntry->pCodeHeader = m_methodToken.m_pCodeHeader;
+    pEntry->pMD = m_pMD;
+    pEntry->pJM = m_pJM;
+    pEntry->relOffset = m_relOffset;
+    // Unwinding the frame needs the function entry, so look it up now for it to be cached too
+    pEntry->pFunctionEntry = GetFunctionEntry();
+}
+
+#endif // FEATURE_EH_FUNCLETS && !DACCESS_COMPILE
+
 TADDR EECodeInfo::GetSavedMethodCode()
 {
     CONTRACTL {
@@ -1135,6 +1135,10 @@ extern Volatile<int64_t> g_c100nsTicksInJit;
 extern thread_local int64_t t_cbILJittedForThread;
 extern thread_local int64_t t_cMethodsJittedForThread;
 extern thread_local int64_t t_c100nsTicksInJitForThread;
+extern Volatile<int64_t> g_cDynamicMethodsJitted;
+extern Volatile<int64_t> g_c100nsTicksInJitForDynamicMethods;
+extern Volatile<int64_t> g_cILStubsJitted;
+extern Volatile<int64_t> g_c100nsTicksInJitForILStubs;
 
 FCDECL1(INT64, GetCompiledILBytes, FC_BOOL_ARG currentThread);
 FCDECL1(INT64, GetCompiledMethodCount, FC_BOOL_ARG currentThread);
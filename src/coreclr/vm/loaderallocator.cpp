@@ -66,6 +66,7 @@ LoaderAllocator::LoaderAllocator(bool collectible) :
     m_pVSDHeapInitialAlloc = NULL;
     m_pLastUsedCodeHeap = NULL;
     m_pLastUsedDynamicCodeHeap = NULL;
+    m_pLastUsedOptimizedCodeHeap = NULL;
     m_pJumpStubCache = NULL;
     m_IsCollectible = collectible;
 
@@ -526,31 +527,36 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
     bool isOriginalLoaderAllocatorFound = false;
 
     // Iterate through free list, firing ETW events and notifying the debugger
-    LoaderAllocator * pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
-    while (pDomainLoaderAllocatorDestroyIterator != NULL)
     {
-        _ASSERTE(!pDomainLoaderAllocatorDestroyIterator->IsAlive());
-        // Fire ETW event
-        ETW::LoaderLog::CollectibleLoaderAllocatorUnload((AssemblyLoaderAllocator *)pDomainLoaderAllocatorDestroyIterator);
-
-        // Set the unloaded flag before notifying the debugger
-        pDomainLoaderAllocatorDestroyIterator->SetIsUnloaded();
+        LoaderAllocatorUnloadPhaseHolder phase(LoaderAllocatorUnloadPhase::NotifyUnload);
 
-        DomainAssemblyIterator domainAssemblyIt(pDomainLoaderAllocatorDestroyIterator->m_pFirstDomainAssemblyFromSameALCToDelete);
-        while (!domainAssemblyIt.end())
+        LoaderAllocator * pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
+        while (pDomainLoaderAllocatorDestroyIterator != NULL)
         {
-            // Call AssemblyUnloadStarted event
-            domainAssemblyIt->GetAssembly()->StartUnload();
-            // Notify the debugger
-            domainAssemblyIt->NotifyDebuggerUnload();
-            domainAssemblyIt++;
-        }
+            _ASSERTE(!pDomainLoaderAllocatorDestroyIterator->IsAlive());
+            // Fire ETW event
+            ETW::LoaderLog::CollectibleLoaderAllocatorUnload((AssemblyLoaderAllocator *)pDomainLoaderAllocatorDestroyIterator);
 
-        if (pDomainLoaderAllocatorDestroyIterator == pOriginalLoaderAllocator)
-        {
-            isOriginalLoaderAllocatorFound = true;
+            // Set the unloaded flag before notifying the debugger
+            pDomainLoaderAllocatorDestroyIterator->SetIsUnloaded();
+
+            DomainAssemblyIterator domainAssemblyIt(pDomainLoaderAllocatorDestroyIterator->m_pFirstDomainAssemblyFromSameALCToDelete);
+            while (!domainAssemblyIt.end())
+            {
+                // Call AssemblyUnloadStarted event
+                domainAssemblyIt->GetAssembly()->StartUnload();
+                // Notify the debugger
+                domainAssemblyIt->NotifyDebuggerUnload();
+                domainAssemblyIt++;
+            }
+
+            if (pDomainLoaderAllocatorDestroyIterator == pOriginalLoaderAllocator)
+            {
+                isOriginalLoaderAllocatorFound = true;
+            }
+            phase.AddLoaderAllocator();
+            pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
         }
-        pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
     }
 
     // If the original LoaderAllocator was not processed, it is most likely a LoaderAllocator without any loaded DomainAssembly
@@ -562,37 +568,51 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
     }
 
     // Iterate through free list, deleting DomainAssemblies
-    pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
-    while (pDomainLoaderAllocatorDestroyIterator != NULL)
     {
-        _ASSERTE(!pDomainLoaderAllocatorDestroyIterator->IsAlive());
+        LoaderAllocatorUnloadPhaseHolder phase(LoaderAllocatorUnloadPhase::DeleteAssemblies);
 
-        DomainAssemblyIterator domainAssemblyIt(pDomainLoaderAllocatorDestroyIterator->m_pFirstDomainAssemblyFromSameALCToDelete);
-        while (!domainAssemblyIt.end())
+        LoaderAllocator * pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
+        while (pDomainLoaderAllocatorDestroyIterator != NULL)
         {
-            delete (DomainAssembly*)domainAssemblyIt;
-            domainAssemblyIt++;
-        }
-        // We really don't have to set it to NULL as the assembly is not reachable anymore, but just in case ...
-        // (Also debugging NULL AVs if someone uses it accidentally is so much easier)
-        pDomainLoaderAllocatorDestroyIterator->m_pFirstDomainAssemblyFromSameALCToDelete = NULL;
+            _ASSERTE(!pDomainLoaderAllocatorDestroyIterator->IsAlive());
+
+            DomainAssemblyIterator domainAssemblyIt(pDomainLoaderAllocatorDestroyIterator->m_pFirstDomainAssemblyFromSameALCToDelete);
+            while (!domainAssemblyIt.end())
+            {
+                delete (DomainAssembly*)domainAssemblyIt;
+                domainAssemblyIt++;
+            }
+            // We really don't have to set it to NULL as the assembly is not reachable anymore, but just in case ...
+            // (Also debugging NULL AVs if someone uses it accidentally is so much easier)
+            pDomainLoaderAllocatorDestroyIterator->m_pFirstDomainAssemblyFromSameALCToDelete = NULL;
 
-        pDomainLoaderAllocatorDestroyIterator->ReleaseManagedAssemblyLoadContext();
+            pDomainLoaderAllocatorDestroyIterator->ReleaseManagedAssemblyLoadContext();
 
-        // The native objects in dependent handles may refer to the virtual call stub manager's heaps, so clear the dependent
-        // handles first
-        pDomainLoaderAllocatorDestroyIterator->CleanupDependentHandlesToNativeObjects();
+            // The native objects in dependent handles may refer to the virtual call stub manager's heaps, so clear the dependent
+            // handles first
+            pDomainLoaderAllocatorDestroyIterator->CleanupDependentHandlesToNativeObjects();
 
-        // The following code was previously happening on delete ~DomainAssembly->Terminate
-        // We are moving this part here in order to make sure that we can unload a LoaderAllocator
-        // that didn't have a DomainAssembly
-        // (we have now a LoaderAllocator with 0-n DomainAssembly)
+            phase.AddLoaderAllocator();
+            pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
+        }
+    }
 
-        // This cleanup code starts resembling parts of AppDomain::Terminate too much.
-        // It would be useful to reduce duplication and also establish clear responsibilities
-        // for LoaderAllocator::Destroy, Assembly::Terminate, LoaderAllocator::Terminate
-        // and LoaderAllocator::~LoaderAllocator. We need to establish how these
-        // cleanup paths interact with app-domain unload and process tear-down, too.
+    // The following code was previously happening on delete ~DomainAssembly->Terminate
+    // We are moving this part here in order to make sure that we can unload a LoaderAllocator
+    // that didn't have a DomainAssembly
+    // (we have now a LoaderAllocator with 0-n DomainAssembly)
+
+    // This cleanup code starts resembling parts of AppDomain::Terminate too much.
+    // It would be useful to reduce duplication and also establish clear responsibilities
+    // for LoaderAllocator::Destroy, Assembly::Terminate, LoaderAllocator::Terminate
+    // and LoaderAllocator::~LoaderAllocator. We need to establish how these
+    // cleanup paths interact with app-domain unload and process tear-down, too.
+
+    // The runtime is suspended once for the whole batch rather than once per LoaderAllocator, and the
+    // global caches are flushed once after all of the batch's code has been unloaded.
+    if (pFirstDestroyedLoaderAllocator != NULL)
+    {
+        LoaderAllocatorUnloadPhaseHolder phase(LoaderAllocatorUnloadPhase::SuspendedCleanup);
 
         if (!IsAtProcessExit())
         {
@@ -608,10 +628,16 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
             CastCache::FlushCurrentCache();
         }
 
-        ExecutionManager::Unload(pDomainLoaderAllocatorDestroyIterator);
-        pDomainLoaderAllocatorDestroyIterator->UninitVirtualCallStubManager();
+        LoaderAllocator * pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
+        while (pDomainLoaderAllocatorDestroyIterator != NULL)
+        {
+            ExecutionManager::Unload(pDomainLoaderAllocatorDestroyIterator);
+            pDomainLoaderAllocatorDestroyIterator->UninitVirtualCallStubManager();
+
+            phase.AddLoaderAllocator();
+            pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
+        }
 
-        // TODO: Do we really want to perform this on each LoaderAllocator?
         MethodTable::ClearMethodDataCache();
         ClearJitGenericHandleCache();
 
@@ -620,7 +646,11 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
             // Resume the EE.
             ThreadSuspend::RestartEE(FALSE, TRUE);
         }
+    }
 
+    LoaderAllocator * pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
+    while (pDomainLoaderAllocatorDestroyIterator != NULL)
+    {
         // Because RegisterLoaderAllocatorForDeletion is modifying m_pLoaderAllocatorDestroyNext, we are saving it here
         LoaderAllocator* pLoaderAllocatorDestroyNext = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
 
@@ -1157,6 +1187,7 @@ void LoaderAllocator::Init(BYTE *pExecutableHeapMemory)
                                                                       LOW_FREQUENCY_HEAP_COMMIT_SIZE,
                                                                       initReservedMem,
                                                                       dwLowFrequencyHeapReserveSize);
+        m_pLowFrequencyHeap->EnableThreadRegions();
         initReservedMem += dwLowFrequencyHeapReserveSize;
     }
 
@@ -1178,6 +1209,7 @@ void LoaderAllocator::Init(BYTE *pExecutableHeapMemory)
                                                                     HIGH_FREQUENCY_HEAP_COMMIT_SIZE,
                                                                     initReservedMem,
                                                                     dwHighFrequencyHeapReserveSize);
+    m_pHighFrequencyHeap->EnableThreadRegions();
     initReservedMem += dwHighFrequencyHeapReserveSize;
 
     if (IsCollectible())
@@ -1724,6 +1756,39 @@ void DomainAssemblyIterator::operator++()
 
 #ifndef DACCESS_COMPILE
 
+LoaderAllocatorUnloadPhaseHolder::LoaderAllocatorUnloadPhaseHolder(LoaderAllocatorUnloadPhase phase)
+    : m_phase(phase)
+    , m_count(0)
+    , m_startTicks(0)
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, LoaderAllocatorUnloadPhase))
+    {
+        LARGE_INTEGER li;
+        QueryPerformanceCounter(&li);
+        m_startTicks = li.QuadPart;
+    }
+}
+
+LoaderAllocatorUnloadPhaseHolder::~LoaderAllocatorUnloadPhaseHolder()
+{
+    WRAPPER_NO_CONTRACT;
+
+    // Nothing to report if the event was enabled in the middle of the phase, or if the phase had nothing to do
+    if (m_startTicks == 0 || m_count == 0)
+        return;
+
+    LARGE_INTEGER li;
+    QueryPerformanceCounter(&li);
+    LONGLONG elapsedTicks = li.QuadPart - m_startTicks;
+
+    QueryPerformanceFrequency(&li);
+    UINT64 durationMicroseconds = (UINT64)(elapsedTicks * 1000000 / li.QuadPart);
+
+    FireEtwLoaderAllocatorUnloadPhase((UINT8)m_phase, m_count, durationMicroseconds, GetClrInstanceId());
+}
+
 void AssemblyLoaderAllocator::Init()
 {
     m_Id.Init();
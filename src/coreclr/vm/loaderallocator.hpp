@@ -215,6 +215,36 @@ public:
     }
 };
 
+// Phases of collectible LoaderAllocator unloading, matching LoaderAllocatorUnloadPhaseMap in ClrEtwAll.man
+enum class LoaderAllocatorUnloadPhase : UINT8
+{
+    NotifyUnload        = 0,    // ETW and debugger unload notifications
+    DeleteAssemblies    = 1,    // DomainAssembly deletion and dependent handle cleanup
+    SuspendedCleanup    = 2,    // Code and stub manager cleanup with the runtime suspended
+    FreeHandles         = 3,    // Failed type init and LoaderAllocator handle cleanup
+    Delete              = 4,    // LoaderAllocator deletion after the next gen2 GC
+};
+
+#ifndef DACCESS_COMPILE
+// Fires the LoaderAllocatorUnloadPhase event with the time spent between construction and destruction
+class LoaderAllocatorUnloadPhaseHolder
+{
+    LoaderAllocatorUnloadPhase m_phase;
+    DWORD m_count;
+    LONGLONG m_startTicks;  // 0 when the event is not enabled
+
+public:
+    LoaderAllocatorUnloadPhaseHolder(LoaderAllocatorUnloadPhase phase);
+    ~LoaderAllocatorUnloadPhaseHolder();
+
+    void AddLoaderAllocator()
+    {
+        LIMITED_METHOD_CONTRACT;
+        m_count++;
+    }
+};
+#endif // !DACCESS_COMPILE
+
 class LoaderAllocatorID
 {
 
@@ -365,6 +395,7 @@ public:
     // ExecutionManager caches
     void * m_pLastUsedCodeHeap;
     void * m_pLastUsedDynamicCodeHeap;
+    void * m_pLastUsedOptimizedCodeHeap;
     void * m_pJumpStubCache;
 
     // LoaderAllocator GC Structures
@@ -14,7 +14,7 @@ class LockedRangeList : public RangeList
   public:
     VPTR_VTABLE_CLASS(LockedRangeList, RangeList)
 
-    LockedRangeList() : RangeList(), m_RangeListRWLock(COOPERATIVE_OR_PREEMPTIVE, LOCK_TYPE_DEFAULT)
+    LockedRangeList() : RangeList(), m_RangeListRWLock(COOPERATIVE_OR_PREEMPTIVE, LOCK_TYPE_DEFAULT, TRUE)
     {
         LIMITED_METHOD_CONTRACT;
     }
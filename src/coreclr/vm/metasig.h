@@ -579,6 +579,8 @@ DEFINE_METASIG_T(IM(IAsyncResult_RetVoid, C(IASYNCRESULT), v))
 
 DEFINE_METASIG(IM(Int_RetRefT, i, r(G(0))))
 DEFINE_METASIG_T(IM(Int_RetReadOnlyRefT, i, Q(INATTRIBUTE) r(G(0))))
+DEFINE_METASIG(IM(RetRefT, _, r(G(0))))
+DEFINE_METASIG_T(IM(RetReadOnlyRefT, _, Q(INATTRIBUTE) r(G(0))))
 
 DEFINE_METASIG(GM(RetT, IMAGE_CEE_CS_CALLCONV_DEFAULT, 1, _, M(0)))
 
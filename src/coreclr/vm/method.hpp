@@ -2177,9 +2177,10 @@ class MulticoreJitPrepareCodeConfig : public PrepareCodeConfig
 {
 private:
     bool m_wasTier0;
+    bool m_optimize;
 
 public:
-    MulticoreJitPrepareCodeConfig(MethodDesc* pMethod);
+    MulticoreJitPrepareCodeConfig(MethodDesc* pMethod, bool optimize = false);
 
     bool WasTier0() const
     {
@@ -2194,6 +2195,7 @@ public:
     }
 
     virtual BOOL SetNativeCode(PCODE pCode, PCODE * ppAlternateCodeToUse) override;
+    virtual CORJIT_FLAGS GetJitCompilationFlags() override;
 };
 #endif // DACCESS_COMPILE
 
@@ -147,7 +147,7 @@ UINT32 MethodDataCache::GetObjectSize(UINT32 cEntries)
 
 //==========================================================================================
 MethodDataCache::MethodDataCache(UINT32 cEntries)
-    : m_lock(COOPERATIVE_OR_PREEMPTIVE, LOCK_TYPE_DEFAULT),
+    : m_lock(COOPERATIVE_OR_PREEMPTIVE, LOCK_TYPE_DEFAULT, TRUE),
       m_iCurTimestamp(0),
       m_cEntries(cEntries),
       m_iLastTouched(0)
@@ -580,6 +580,37 @@ MethodDesc *MethodTable::GetMethodDescForComInterfaceMethod(MethodDesc *pItfMD,
 }
 #endif // FEATURE_COMINTEROP
 
+/* static */
+BYTE* MethodTable::AllocateMethodTableMemory(LoaderAllocator *pAllocator, AllocMemTracker *pamTracker, size_t cbBeforeMethodTable, S_SIZE_T cbTotal)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (cbTotal.IsOverflow())
+        ThrowHR(COR_E_OVERFLOW);
+
+    LoaderHeap *pHeap = pAllocator->GetHighFrequencyHeap();
+
+    if (!g_pConfig->CacheLineAlignMethodTables())
+    {
+        return (BYTE *)pamTracker->Track(pHeap->AllocMem(cbTotal));
+    }
+
+    // The hot fields of the MethodTable (flags, base size, parent, vtable indirections) are at fixed offsets
+    // from its start. Loader heap allocations are only pointer aligned, so without padding those fields
+    // routinely straddle two cache lines. Pad the front of the block so the MethodTable itself, rather than
+    // the data prepended to it, lands on the cache line boundary.
+    size_t cbPadding = ALIGN_UP(cbBeforeMethodTable, CACHE_LINE_SIZE) - cbBeforeMethodTable;
+
+    S_SIZE_T cbAllocation = cbTotal + S_SIZE_T(cbPadding);
+    if (cbAllocation.IsOverflow())
+        ThrowHR(COR_E_OVERFLOW);
+
+    BYTE *pMemory = (BYTE *)pamTracker->Track(pHeap->AllocAlignedMem(cbAllocation.Value(), CACHE_LINE_SIZE));
+
+    _ASSERTE(IS_ALIGNED(pMemory + cbPadding + cbBeforeMethodTable, CACHE_LINE_SIZE));
+    return pMemory + cbPadding;
+}
+
 void MethodTable::AllocateAuxiliaryData(LoaderAllocator *pAllocator, Module *pLoaderModule, AllocMemTracker *pamTracker, MethodTableStaticsFlags staticsFlags, WORD nonVirtualSlots, S_SIZE_T extraAllocation)
 {
     S_SIZE_T cbAuxiliaryData = S_SIZE_T(sizeof(MethodTableAuxiliaryData));
@@ -2998,6 +2998,10 @@ public:
 
 #ifndef DACCESS_COMPILE
     void AllocateAuxiliaryData(LoaderAllocator *pAllocator, Module *pLoaderModule, AllocMemTracker *pamTracker, MethodTableStaticsFlags staticsFlags = MethodTableStaticsFlags::None, WORD nonVirtualSlots = 0, S_SIZE_T extraAllocation = S_SIZE_T(0));
+
+    // Allocates the block holding a MethodTable from the high frequency heap. cbBeforeMethodTable is the
+    // size of the data placed in front of the MethodTable in the block (GCDesc, ArrayClass).
+    static BYTE* AllocateMethodTableMemory(LoaderAllocator *pAllocator, AllocMemTracker *pamTracker, size_t cbBeforeMethodTable, S_SIZE_T cbTotal);
 #endif
 
     inline PTR_Const_MethodTableAuxiliaryData GetAuxiliaryData() const
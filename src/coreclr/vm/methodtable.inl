@@ -1348,23 +1348,40 @@ FORCEINLINE BOOL MethodTable::ImplementsInterfaceInline(MethodTable *pInterface)
 
     InterfaceInfo_t *pInfo = GetInterfaceMap();
 
-    do
+    PTR_InterfaceMapHash pHash = (numInterfaces >= INTERFACE_MAP_HASH_MIN_INTERFACES) ? GetClass()->GetInterfaceMapHash() : NULL;
+    if ((pHash != NULL) && (pHash->m_numInterfaces == numInterfaces))
     {
-        if (pInfo->GetMethodTable() == pInterface)
+        // There is always an empty bucket, so the probe sequence terminates
+        DWORD bucket = pInterface->GetTypeDefRid() & pHash->m_bucketMask;
+        for (WORD entry; (entry = pHash->m_buckets[bucket]) != 0; bucket = (bucket + 1) & pHash->m_bucketMask)
         {
-            // Extensible RCW's need to be handled specially because they can have interfaces
-            // in their map that are added at runtime. These interfaces will have a start offset
-            // of -1 to indicate this. We cannot take for granted that every instance of this
-            // COM object has this interface so FindInterface on these interfaces is made to fail.
-            //
-            // However, we are only considering the statically available slots here
-            // (m_wNumInterface doesn't contain the dynamic slots), so we can safely
-            // ignore this detail.
-            return TRUE;
+            if (pInfo[entry - 1].GetMethodTable() == pInterface)
+            {
+                // See the note on extensible RCW's below
+                return TRUE;
+            }
+        }
+    }
+    else
+    {
+        do
+        {
+            if (pInfo->GetMethodTable() == pInterface)
+            {
+                // Extensible RCW's need to be handled specially because they can have interfaces
+                // in their map that are added at runtime. These interfaces will have a start offset
+                // of -1 to indicate this. We cannot take for granted that every instance of this
+                // COM object has this interface so FindInterface on these interfaces is made to fail.
+                //
+                // However, we are only considering the statically available slots here
+                // (m_wNumInterface doesn't contain the dynamic slots), so we can safely
+                // ignore this detail.
+                return TRUE;
+            }
+            pInfo++;
         }
-        pInfo++;
+        while (--numInterfaces);
     }
-    while (--numInterfaces);
 
     // Second scan, looking for the curiously recurring generic scenario
     if (pInterface->HasInstantiation() && !GetAuxiliaryData()->MayHaveOpenInterfacesInInterfaceMap() && pInterface->GetInstantiation().ContainsAllOneType(this))
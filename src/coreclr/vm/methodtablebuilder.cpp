@@ -7230,6 +7230,8 @@ MethodTableBuilder::AllocAndInitDictionary()
 
         if (numTypeSlots > 0)
         {
+            numTypeSlots = DictionaryLayout::GetInitialSlotCount(numTypeSlots);
+
             // Dictionary layout is an optional field on EEClass, so ensure the optional field descriptor has
             // been allocated.
             EnsureOptionalFieldsAreAllocated(GetHalfBakedClass(), m_pAllocMemTracker, GetLoaderAllocator()->GetLowFrequencyHeap());
@@ -10324,7 +10326,7 @@ MethodTable * MethodTableBuilder::AllocateNewMT(
         }
     }
 
-    BYTE *pData = (BYTE *)pamTracker->Track(pAllocator->GetHighFrequencyHeap()->AllocMem(cbTotalSize));
+    BYTE *pData = MethodTable::AllocateMethodTableMemory(pAllocator, pamTracker, dwGCSize, cbTotalSize);
 
     _ASSERTE(IS_ALIGNED(pData, TARGET_POINTER_SIZE));
 
@@ -10803,6 +10805,16 @@ MethodTableBuilder::SetupMethodTable2(
 
             pInterfaces[i].SetMethodTable(pEntry->GetInterfaceType()->GetMethodTable());
         }
+
+        // Index large interface maps for casting. The EEClass is shared with all the instantiations
+        // of a generic type, which get interface maps of the same shape.
+        DWORD dwInterfaceMapHashThreshold = g_pConfig->InterfaceMapHashThreshold();
+        if ((dwInterfaceMapHashThreshold != 0) && (bmtInterface->dwInterfaceMapSize >= dwInterfaceMapHashThreshold))
+        {
+            EnsureOptionalFieldsAreAllocated(GetHalfBakedClass(), m_pAllocMemTracker, GetLoaderAllocator()->GetLowFrequencyHeap());
+            GetHalfBakedClass()->SetInterfaceMapHash(
+                InterfaceMapHash::Allocate(pInterfaces, bmtInterface->dwInterfaceMapSize, GetLoaderAllocator()->GetLowFrequencyHeap(), GetMemTracker()));
+        }
     }
 
     pMT->SetCl(GetCl());
@@ -618,6 +618,27 @@ bool IsValidForGenericMarshalling(MethodTable* pMT, bool isFieldScenario, bool b
 
 namespace
 {
+    // Span<T> or ReadOnlySpan<T> whose elements can be handed to native code in place
+    bool IsBlittableSpan(MethodTable* pMT)
+    {
+        STANDARD_VM_CONTRACT;
+
+        if (pMT == NULL || !pMT->HasInstantiation())
+            return false;
+
+        if (!pMT->HasSameTypeDefAs(CoreLibBinder::GetClass(CLASS__SPAN))
+            && !pMT->HasSameTypeDefAs(CoreLibBinder::GetClass(CLASS__READONLY_SPAN)))
+            return false;
+
+        // char and bool are blittable in managed layout but have charset/size dependent native representations
+        TypeHandle thElement = pMT->GetInstantiation()[0];
+        CorElementType elemType = thElement.GetSignatureCorElementType();
+        if (elemType == ELEMENT_TYPE_CHAR || elemType == ELEMENT_TYPE_BOOLEAN)
+            return false;
+
+        return thElement.IsValueType() && thElement.IsBlittable();
+    }
+
     MarshalInfo::MarshalType GetDisabledMarshallerType(
         Module* pModule,
         SigPointer sig,
@@ -1845,6 +1866,17 @@ MarshalInfo::MarshalInfo(Module* pModule,
 
                 m_type = MARSHAL_TYPE_RUNTIMEMETHODHANDLE;
             }
+            else if (!IsFieldScenario() && IsBlittableSpan(sig.GetTypeHandleThrowing(pModule, pTypeContext).GetMethodTable()))
+            {
+                if (nativeType != NATIVE_TYPE_DEFAULT)
+                {
+                    m_resID = IDS_EE_BADMARSHAL_SPANRESTRICTION;
+                    IfFailGoto(E_FAIL, lFail);
+                }
+
+                m_args.m_pMT = sig.GetTypeHandleThrowing(pModule, pTypeContext).GetMethodTable();
+                m_type = MARSHAL_TYPE_BLITTABLESPAN;
+            }
             else
             {
                 m_pMT =  sig.GetTypeHandleThrowing(pModule, pTypeContext).GetMethodTable();
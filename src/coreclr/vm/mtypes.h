@@ -107,5 +107,6 @@ DEFINE_MARSHALER_TYPE(MARSHAL_TYPE_BLITTABLE_LAYOUTCLASS,           BlittableLay
 DEFINE_MARSHALER_TYPE(MARSHAL_TYPE_LAYOUTCLASS,                     LayoutClassMarshaler)
 
 DEFINE_MARSHALER_TYPE(MARSHAL_TYPE_POINTER,                         PointerMarshaler)
+DEFINE_MARSHALER_TYPE(MARSHAL_TYPE_BLITTABLESPAN,                   BlittableSpanMarshaler)
 
 #undef DEFINE_MARSHALER_TYPE
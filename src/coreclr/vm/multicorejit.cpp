@@ -370,6 +370,33 @@ HRESULT MulticoreJitRecorder::WriteModuleRecord(IStream * pStream, const Recorde
 }
 
 
+// Returns true if the method is no longer running tier 0 code, so that playback can compile it at an optimized tier directly
+static bool HasReachedOptimizedTier(MethodDesc * pMethod)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+#ifdef FEATURE_TIERED_COMPILATION
+    if (!pMethod->IsEligibleForTieredCompilation())
+    {
+        return false;
+    }
+
+    CodeVersionManager::LockHolder codeVersioningLockHolder;
+    NativeCodeVersion activeVersion =
+        pMethod->GetCodeVersionManager()->GetActiveILCodeVersion(pMethod).GetActiveNativeCodeVersion(pMethod);
+    return !activeVersion.IsNull() && activeVersion.IsFinalTier();
+#else
+    return false;
+#endif
+}
+
 HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
 {
     CONTRACTL
@@ -399,6 +426,11 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
 
         MethodDesc * pMethod = m_JitInfoArray[i].GetMethodDescAndClean();
 
+        if (HasReachedOptimizedTier(pMethod))
+        {
+            m_JitInfoArray[i].MarkOptimizedTier();
+        }
+
         if (m_JitInfoArray[i].IsGenericMethodInfo())
         {
             SigBuilder sigBuilder;
@@ -20,10 +20,13 @@
 
 #endif
 
-// Bits 0xff0000 are reserved method flags. Currently only first bit is used.
+// Bits 0xff0000 are reserved method flags. Currently only first two bits are used.
 const unsigned METHOD_FLAGS_MASK       = 0xff0000;
 const unsigned JIT_BY_APP_THREAD_TAG   = 0x10000;   // tag, that indicates whether method is jitted by application thread(1) or background thread(0)
-// Tags 0xfe0000 are currently free
+const unsigned OPTIMIZED_TIER_TAG      = 0x20000;   // tag, that indicates whether method had reached an optimized tier(1) or not(0) when the profile was written
+// Tags 0xfc0000 are currently free
+
+const unsigned MAX_PLAYER_THREADS      = 8;         // maximum allowed number of threads playing back a profile
 
 const unsigned RECORD_TYPE_OFFSET      = 24;        // offset of type of record
 
@@ -72,6 +75,7 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 //  5. Maximum number of methods supported is MAX_METHODS
 //  6. Simple module name stored
 //  7. Method flag JIT_BY_APP_THREAD is for diagnosis only
+//  8. Method flag OPTIMIZED_TIER lets playback skip tier 0 for methods that were hot in the recorded run
 //
 // <HeaderRecord>::=     <recordType=MULTICOREJIT_HEADER_RECORD_ID> <3byte_recordSize> <version> <timeStamp> <moduleCount> <methodCount> <DependencyCount> <unsigned short counter>*14 <unsigned counter>*3
 // <ModuleRecord>::=     <recordType=MULTICOREJIT_MODULE_RECORD_ID> <3byte_recordSize> <ModuleVersion> <JitMethodCount> <loadLevel> <lenModuleName> char*lenModuleName <padding>
@@ -285,13 +289,25 @@ private:
     unsigned                           m_moduleCount;
     PlayerModuleInfo                 * m_pModules;
 
+    bool                               m_playOptimizedTier;
+    unsigned                           m_nPlayerThreads;
+
+    // Queue of optimized methods for the helper threads, protected by m_optimizedMethodsLock
+    CrstExplicitInit                   m_optimizedMethodsLock;
+    SArray<MethodDesc *>               m_optimizedMethods;
+    COUNT_T                            m_nextOptimizedMethod;
+    bool                               m_playbackDone;
+    CLREvent                           m_optimizedMethodsAvailable;
+    CLREvent                           m_helperThreadsDone;
+    LONG                               m_nHelperThreadsRunning;
+
     HRESULT HandleModuleRecord(const ModuleRecord * pMod);
     HRESULT HandleModuleInfoRecord(unsigned moduleTo, unsigned level);
-    HRESULT HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token);
-    HRESULT HandleGenericMethodInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length);
-    void CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric);
+    HRESULT HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token, bool optimizedTier);
+    HRESULT HandleGenericMethodInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length, bool optimizedTier);
+    void CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric, bool optimizedTier);
 
-    bool CompileMethodDesc(Module * pModule, MethodDesc * pMD);
+    bool CompileMethodDesc(Module * pModule, MethodDesc * pMD, bool optimize = false);
     HRESULT PlayProfile();
 
     bool ShouldAbort(bool fast) const;
@@ -300,6 +316,16 @@ private:
 
     static DWORD WINAPI StaticJITThreadProc(void *args);
 
+    // Methods that had reached an optimized tier in the recorded run are compiled at that tier, which is
+    // more expensive, so they are queued to helper threads when more than one player thread is allowed
+    void StartHelperThreads(unsigned count);
+    void QueueOptimizedMethod(MethodDesc * pMethod);
+    MethodDesc * DequeueOptimizedMethod();
+    void FinishHelperThreads();
+    void HelperThreadProc();
+
+    static DWORD WINAPI StaticHelperThreadProc(void *args);
+
     void TraceSummary();
 
     HRESULT UpdateModuleInfo();
@@ -583,6 +609,15 @@ struct RecorderInfo
         _ASSERTE(IsMethodInfo());
     }
 
+    void MarkOptimizedTier()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsMethodInfo());
+
+        data1 |= OPTIMIZED_TIER_TAG;
+    }
+
     void PackModule(FileLoadLevel needLevel, unsigned moduleIndex)
     {
         LIMITED_METHOD_CONTRACT;
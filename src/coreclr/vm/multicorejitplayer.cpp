@@ -382,6 +382,12 @@ MulticoreJitProfilePlayer::MulticoreJitProfilePlayer(AssemblyBinder * pBinder, L
     m_pFileBuffer        = NULL;
     m_nFileSize          = 0;
 
+    m_playOptimizedTier     = false;
+    m_nPlayerThreads        = 1;
+    m_nextOptimizedMethod   = 0;
+    m_playbackDone          = false;
+    m_nHelperThreadsRunning = 0;
+
     m_nStartTime         = GetTickCount();
 }
 
@@ -508,10 +514,10 @@ HRESULT MulticoreJitProfilePlayer::HandleModuleRecord(const ModuleRecord * pMod)
 }
 
 #ifndef DACCESS_COMPILE
-MulticoreJitPrepareCodeConfig::MulticoreJitPrepareCodeConfig(MethodDesc* pMethod) :
+MulticoreJitPrepareCodeConfig::MulticoreJitPrepareCodeConfig(MethodDesc* pMethod, bool optimize) :
     // Method code that was pregenerated and loaded is recorded in the multi-core JIT profile, so enable multi-core JIT to also
     // look up pregenerated code to help parallelize the work
-    PrepareCodeConfig(NativeCodeVersion(pMethod), FALSE, TRUE), m_wasTier0(false)
+    PrepareCodeConfig(NativeCodeVersion(pMethod), FALSE, TRUE), m_wasTier0(false), m_optimize(optimize)
 {
     WRAPPER_NO_CONTRACT;
 
@@ -529,6 +535,27 @@ BOOL MulticoreJitPrepareCodeConfig::SetNativeCode(PCODE pCode, PCODE * ppAlterna
     return TRUE;
 }
 
+CORJIT_FLAGS MulticoreJitPrepareCodeConfig::GetJitCompilationFlags()
+{
+    STANDARD_VM_CONTRACT;
+
+    CORJIT_FLAGS flags = PrepareCodeConfig::GetJitCompilationFlags();
+
+#ifdef FEATURE_TIERED_COMPILATION
+    if (m_optimize && flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0))
+    {
+        // The method had reached an optimized tier in the recorded run, so skip tier 0 and its instrumentation. This is treated
+        // the same as the JIT switching to optimized code, so the code will not be call-counted once it is used.
+        flags.Clear(CORJIT_FLAGS::CORJIT_FLAG_TIER0);
+        flags.Clear(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
+        flags.Clear(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR_IF_LOOPS);
+        SetJitSwitchedToOptimized();
+    }
+#endif
+
+    return flags;
+}
+
 MulticoreJitCodeInfo::MulticoreJitCodeInfo(PCODE entryPoint, const MulticoreJitPrepareCodeConfig *pConfig)
 {
     WRAPPER_NO_CONTRACT;
@@ -559,7 +586,7 @@ void MulticoreJitCodeInfo::VerifyIsNotNull() const
 
 // Call JIT to compile a method
 
-bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc * pMD)
+bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc * pMD, bool optimize)
 {
     STANDARD_VM_CONTRACT;
 
@@ -580,7 +607,7 @@ bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc *
         ThreadStateNCStackHolder holder(-1, Thread::TSNC_CallingManagedCodeDisabled);
 
         // PrepareCode calls back to MulticoreJitCodeStorage::StoreMethodCode under MethodDesc lock
-        MulticoreJitPrepareCodeConfig config(pMD);
+        MulticoreJitPrepareCodeConfig config(pMD, optimize);
         pMD->PrepareCode(&config);
 
         return true;
@@ -844,7 +871,7 @@ Assembly * MulticoreJitProfilePlayer::LoadAssembly(SString & assemblyName)
         FALSE); // Don't throw on FileNotFound.
 }
 
-HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token)
+HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token, bool optimizedTier)
 {
     STANDARD_VM_CONTRACT;
 
@@ -869,7 +896,7 @@ HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned mod
             // Similar to Module::FindMethod + Module::FindMethodThrowing,
             // except it calls GetMethodDescFromMemberDefOrRefOrSpec with strictMetadataChecks=FALSE to allow generic instantiation
             MethodDesc * pMethod = MemberLoader::GetMethodDescFromMemberDefOrRefOrSpec(pModule, token, NULL, FALSE, FALSE);
-            CompileMethodInfoRecord(pModule, pMethod, false);
+            CompileMethodInfoRecord(pModule, pMethod, false, optimizedTier);
         }
         else
         {
@@ -889,7 +916,7 @@ HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned mod
     return hr;
 }
 
-HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length)
+HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length, bool optimizedTier)
 {
     STANDARD_VM_CONTRACT;
 
@@ -923,7 +950,7 @@ HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned module
             }
             EX_END_CATCH(SwallowAllExceptions);
 
-            CompileMethodInfoRecord(pModule, pMethod, true);
+            CompileMethodInfoRecord(pModule, pMethod, true, optimizedTier);
         }
         else
         {
@@ -943,7 +970,7 @@ HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned module
     return hr;
 }
 
-void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric)
+void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric, bool optimizedTier)
 {
     STANDARD_VM_CONTRACT;
 
@@ -968,7 +995,20 @@ void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodD
 
         if (pMethod->GetNativeCode() == (PCODE)NULL && !GetAppDomain()->GetMulticoreJitManager().GetMulticoreJitCodeStorage().LookupMethodCode(pMethod))
         {
-            if (CompileMethodDesc(pModule, pMethod))
+            if (optimizedTier && m_playOptimizedTier && pMethod->IsEligibleForTieredCompilation())
+            {
+                if (m_nPlayerThreads > 1)
+                {
+                    QueueOptimizedMethod(pMethod);
+                    return;
+                }
+
+                if (CompileMethodDesc(pModule, pMethod, true))
+                {
+                    return;
+                }
+            }
+            else if (CompileMethodDesc(pModule, pMethod))
             {
                 return;
             }
@@ -1126,6 +1166,14 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
         FireEtwThreadCreated((ULONGLONG) pThread, (ULONGLONG) GetAppDomain(), 1, pThread->GetThreadId(), pThread->GetOSThreadId(), GetClrInstanceId());
     }
 
+    // The profile compiles a lot of methods back to back, keep the RW mappings of the code heaps around
+    ExecutableWriteSessionHolder writeSession;
+
+    if (m_nPlayerThreads > 1)
+    {
+        StartHelperThreads(m_nPlayerThreads - 1);
+    }
+
     const BYTE * pBuffer = m_pFileBuffer;
 
     unsigned nSize = m_nFileSize;
@@ -1270,12 +1318,13 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
                 unsigned curdata1 = * (const unsigned *) pCurBuf;
                 unsigned currcdTyp = curdata1 >> RECORD_TYPE_OFFSET;
                 unsigned curmoduleIndex = curdata1 & MODULE_MASK;
+                bool curOptimizedTier = (curdata1 & OPTIMIZED_TIER_TAG) != 0;
 
                 if (currcdTyp == MULTICOREJIT_METHOD_RECORD_ID)
                 {
                     unsigned token = * (((const unsigned *) pCurBuf) + 1);
 
-                    hr = HandleNonGenericMethodInfoRecord(curmoduleIndex, token);
+                    hr = HandleNonGenericMethodInfoRecord(curmoduleIndex, token, curOptimizedTier);
                 }
                 else
                 {
@@ -1283,7 +1332,7 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
 
                     unsigned cursignatureLength = * (const unsigned short *) (((const unsigned *) pCurBuf) + 1);
 
-                    hr = HandleGenericMethodInfoRecord(curmoduleIndex, (BYTE *) (pCurBuf + sizeof(unsigned) + sizeof(unsigned short)), cursignatureLength);
+                    hr = HandleGenericMethodInfoRecord(curmoduleIndex, (BYTE *) (pCurBuf + sizeof(unsigned) + sizeof(unsigned short)), cursignatureLength, curOptimizedTier);
                 }
 
                 if (SUCCEEDED(hr) && ShouldAbort(false))
@@ -1356,9 +1405,216 @@ HRESULT MulticoreJitProfilePlayer::JITThreadProc(Thread * pThread)
     }
     EX_END_CATCH(SwallowAllExceptions);
 
+    {
+        // The helper threads use the player, so wait for them before it can be deleted
+        GCX_PREEMP();
+
+        FinishHelperThreads();
+    }
+
     return (DWORD) m_stats.m_hr;
 }
 
+struct MulticoreJitHelperThreadArgs
+{
+    MulticoreJitProfilePlayer * m_pPlayer;
+    Thread                    * m_pThread;
+};
+
+void MulticoreJitProfilePlayer::StartHelperThreads(unsigned count)
+{
+    STANDARD_VM_CONTRACT;
+
+    _ASSERTE(m_nHelperThreadsRunning == 0);
+
+    unsigned started = 0;
+
+    EX_TRY
+    {
+        m_optimizedMethodsAvailable.CreateManualEvent(FALSE);
+        m_helperThreadsDone.CreateManualEvent(FALSE);
+
+        for (; started < count; started++)
+        {
+            NewHolder<MulticoreJitHelperThreadArgs> pArgs = new MulticoreJitHelperThreadArgs();
+            pArgs->m_pPlayer = this;
+            pArgs->m_pThread = SetupUnstartedThread();
+
+            InterlockedIncrement(&m_nHelperThreadsRunning);
+
+            if (!pArgs->m_pThread->CreateNewThread(0, StaticHelperThreadProc, pArgs))
+            {
+                InterlockedDecrement(&m_nHelperThreadsRunning);
+                pArgs->m_pThread->DecExternalCount(FALSE);
+                break;
+            }
+
+            // The helper thread is responsible for deleting its arguments once it's created
+            Thread * pThread = pArgs->m_pThread;
+            pArgs.SuppressRelease();
+            pThread->StartThread();
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    MulticoreJitTrace(("Started %d player helper threads", started));
+
+    if (started == 0)
+    {
+        // Compile optimized methods on the player thread instead
+        m_nPlayerThreads = 1;
+    }
+}
+
+void MulticoreJitProfilePlayer::QueueOptimizedMethod(MethodDesc * pMethod)
+{
+    STANDARD_VM_CONTRACT;
+
+    CrstHolder holder(&m_optimizedMethodsLock);
+
+    m_optimizedMethods.Append(pMethod);
+    m_optimizedMethodsAvailable.Set();
+}
+
+// Returns NULL once playback is done and the queue is empty
+MethodDesc * MulticoreJitProfilePlayer::DequeueOptimizedMethod()
+{
+    STANDARD_VM_CONTRACT;
+
+    while (true)
+    {
+        {
+            CrstHolder holder(&m_optimizedMethodsLock);
+
+            if (m_nextOptimizedMethod < m_optimizedMethods.GetCount())
+            {
+                return m_optimizedMethods[m_nextOptimizedMethod++];
+            }
+
+            if (m_playbackDone)
+            {
+                return NULL;
+            }
+
+            m_optimizedMethodsAvailable.Reset();
+        }
+
+        m_optimizedMethodsAvailable.Wait(INFINITE, FALSE);
+    }
+}
+
+void MulticoreJitProfilePlayer::FinishHelperThreads()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    if (m_nPlayerThreads <= 1)
+    {
+        return;
+    }
+
+    {
+        CrstHolder holder(&m_optimizedMethodsLock);
+
+        m_playbackDone = true;
+        m_optimizedMethodsAvailable.Set();
+    }
+
+    m_helperThreadsDone.Wait(INFINITE, FALSE);
+}
+
+void MulticoreJitProfilePlayer::HelperThreadProc()
+{
+    STANDARD_VM_CONTRACT;
+
+    MethodDesc * pMethod;
+
+    while ((pMethod = DequeueOptimizedMethod()) != NULL)
+    {
+        if (ShouldAbort(false))
+        {
+            return;
+        }
+
+        // The method may have been compiled by the application since it was queued
+        if (pMethod->GetNativeCode() != (PCODE)NULL || GetAppDomain()->GetMulticoreJitManager().GetMulticoreJitCodeStorage().LookupMethodCode(pMethod))
+        {
+            m_stats.m_nHasNativeCode++;
+            continue;
+        }
+
+        EX_TRY
+        {
+            CompileMethodDesc(pMethod->GetModule(), pMethod, true);
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+    }
+}
+
+DWORD WINAPI MulticoreJitProfilePlayer::StaticHelperThreadProc(void *args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+        ENTRY_POINT;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    MulticoreJitHelperThreadArgs * pArgs = (MulticoreJitHelperThreadArgs *) args;
+    MulticoreJitProfilePlayer * pPlayer = pArgs->m_pPlayer;
+    Thread * pThread = pArgs->m_pThread;
+    delete pArgs;
+
+    MulticoreJitTrace(("StaticHelperThreadProc starting"));
+
+    if (pThread->HasStarted())
+    {
+        // Disable calling managed code in background thread
+        ThreadStateNCStackHolder holder(TRUE, Thread::TSNC_CallingManagedCodeDisabled);
+
+        // Run as background thread, so ThreadStore::WaitForOtherThreads will not wait for it
+        pThread->SetBackground(TRUE);
+
+        EX_TRY
+        {
+            GCX_PREEMP();
+
+            pPlayer->HelperThreadProc();
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+    }
+
+    // It needs to be deleted after GCX_PREEMP ends
+    DestroyThread(pThread);
+
+    // The player thread deletes the player once all helper threads are done, so this must be the last use of it
+    if (InterlockedDecrement(&pPlayer->m_nHelperThreadsRunning) == 0)
+    {
+        pPlayer->m_helperThreadsDone.Set();
+    }
+
+    MulticoreJitTrace(("StaticHelperThreadProc ending"));
+
+    return 0;
+}
+
 
 DWORD WINAPI MulticoreJitProfilePlayer::StaticJITThreadProc(void *args)
 {
@@ -1421,6 +1677,23 @@ HRESULT MulticoreJitProfilePlayer::ProcessProfile(const WCHAR * pFileName)
 
     if (SUCCEEDED(hr))
     {
+#ifdef FEATURE_TIERED_COMPILATION
+        m_playOptimizedTier =
+            g_pConfig->TieredCompilation() &&
+            g_pConfig->TieredCompilation_QuickJit() &&
+            CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitPlayOptimizedTier) != 0;
+#endif
+
+        // Extra player threads only compile methods at an optimized tier
+        if (m_playOptimizedTier)
+        {
+            unsigned nThreads = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitPlayerThreads);
+            nThreads = min(nThreads, min(MAX_PLAYER_THREADS, (unsigned)g_SystemInfo.dwNumberOfProcessors));
+            m_nPlayerThreads = max(nThreads, 1u);
+        }
+
+        m_optimizedMethodsLock.Init(CrstLeafLock);
+
         _ASSERTE(m_pThread == NULL);
 
         m_pThread = SetupUnstartedThread();
@@ -116,6 +116,8 @@ extern "C" void QCALLTYPE NativeRuntimeEventSource_LogThreadPoolWorkerThreadAdju
     BEGIN_QCALL;
 
     FireEtwThreadPoolWorkerThreadAdjustmentAdjustment(averageThroughput, newWorkerThreadCount, reason, clrInstanceID);
+    STRESS_LOG2(LF_THREADPOOL, LL_INFO10, "ThreadPool: worker thread count adjusted to %u, reason %u\n",
+        newWorkerThreadCount, reason);
 
     END_QCALL;
 }
@@ -23,6 +23,7 @@ struct PerPatchpointInfo
     PerPatchpointInfo() : 
         m_osrMethodCode(0),
         m_patchpointCount(0),
+        m_transitionCount(0),
         m_flags(0)
 #if _DEBUG
         , m_patchpointId(0)
@@ -34,7 +35,8 @@ struct PerPatchpointInfo
     enum 
     {
         patchpoint_triggered = 0x1,
-        patchpoint_invalid = 0x2
+        patchpoint_invalid = 0x2,
+        patchpoint_reoptimized = 0x4
     };
 
     // The OSR method entry point for this patchpoint.
@@ -42,6 +44,8 @@ struct PerPatchpointInfo
     PCODE m_osrMethodCode;
     // Number of times jitted code has called the helper at this patchpoint.
     LONG m_patchpointCount;
+    // Number of times jitted code has transitioned to the OSR method at this patchpoint.
+    LONG m_transitionCount;
     // Status of this patchpoint
     LONG m_flags;
 
@@ -122,6 +122,16 @@ PEImageLayout* PEImageLayout::Load(PEImage* pOwner, HRESULT* loadFailure)
                 if (pAlloc->GetBase() != NULL)
                     return pAlloc.Extract();
 
+#ifdef LOGGING
+                if (pOwner->IsInBundle())
+                {
+                    // Typically the image is not page aligned within the bundle. It will be copied instead.
+                    SString ownerPath{ pOwner->GetPath() };
+                    LOG((LF_LOADER, LL_INFO100, "PEImage: bundled image %s could not be mapped in place, offset %llx\n",
+                        ownerPath.GetUTF8(), (unsigned long long)pOwner->GetOffset()));
+                }
+#endif // LOGGING
+
 #if TARGET_WINDOWS
                 // For regular PE files always use OS loader on Windows.
                 // If a file cannot be loaded, do not try any further.
@@ -180,6 +190,29 @@ DWORD SectionCharacteristicsToPageProtection(UINT characteristics)
 }
 #endif // TARGET_UNIX
 
+// Hint to the OS that the given range of the image is about to be accessed, so that it can read the
+// pages ahead in large requests instead of faulting them in one by one.
+void PEImageLayout::Prefetch(RVA rva, COUNT_T size)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    // flat layouts do not have RVAs laid out contiguously
+    if (!IsMapped() || size == 0)
+        return;
+
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = (PVOID)GetRvaData(rva);
+    range.NumberOfBytes = size;
+
+    // this is only a hint, nothing to do if it fails.
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
 // IMAGE_REL_BASED_PTR is architecture specific reloc of virtual address
 #ifdef TARGET_64BIT
 #define IMAGE_REL_BASED_PTR IMAGE_REL_BASED_DIR64
@@ -63,6 +63,10 @@ public:
 
     void ApplyBaseRelocations(bool relocationMustWriteCopy);
 
+#ifndef DACCESS_COMPILE
+    void Prefetch(RVA rva, COUNT_T size);
+#endif
+
 public:
 #ifdef DACCESS_COMPILE
     void EnumMemoryRegions(CLRDataEnumMemoryFlags flags);
@@ -26,6 +26,13 @@
 #define TEMP_DIRECTORY_PATH "/data/local/tmp"
 #endif
 
+// Upper bound for DOTNET_PerfMapBufferSize, in KB.
+#define MAX_PERFMAP_BUFFER_SIZE_KB (16 * 1024)
+
+// Staged lines are written out once the oldest one is this old, so that tools
+// reading the map while the process runs don't fall too far behind.
+#define MAX_PERFMAP_BUFFERED_MS 1000
+
 Volatile<bool> PerfMap::s_enabled = false;
 PerfMap * PerfMap::s_Current = nullptr;
 bool PerfMap::s_ShowOptimizationTiers = false;
@@ -202,6 +209,11 @@ PerfMap::PerfMap()
 
     // Initialize with no failures.
     m_ErrorEncountered = false;
+
+    m_Buffer = nullptr;
+    m_BufferSize = 0;
+    m_BufferUsed = 0;
+    m_BufferStartTime = 0;
 }
 
 // Clean-up resources.
@@ -209,6 +221,11 @@ PerfMap::~PerfMap()
 {
     LIMITED_METHOD_CONTRACT;
 
+    FlushBuffer();
+
+    delete[] m_Buffer;
+    m_Buffer = nullptr;
+
     delete m_FileStream;
     m_FileStream = nullptr;
 }
@@ -236,6 +253,20 @@ void PerfMap::OpenFile(SString& path)
         {
             delete m_FileStream;
             m_FileStream = nullptr;
+            return;
+        }
+    }
+
+    // Stage lines in memory instead of writing each one as it is logged. Without a
+    // buffer lines are still written, one at a time.
+    DWORD bufferSizeKB = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapBufferSize);
+    if (m_FileStream != nullptr && bufferSizeKB != 0)
+    {
+        m_BufferSize = min(bufferSizeKB, (DWORD)MAX_PERFMAP_BUFFER_SIZE_KB) * 1024;
+        m_Buffer = new (nothrow) BYTE[m_BufferSize];
+        if (m_Buffer == nullptr)
+        {
+            m_BufferSize = 0;
         }
     }
 }
@@ -255,24 +286,74 @@ void PerfMap::WriteLine(SString& line)
 
     EX_TRY
     {
-        // Write the line.
-        // The PAL already takes a lock when writing, so we don't need to do so here.
         const char * strLine = line.GetUTF8();
         ULONG inCount = line.GetCount();
-        ULONG outCount;
-        m_FileStream->Write(strLine, inCount, &outCount);
 
-        if (inCount != outCount)
+        if (inCount <= m_BufferSize)
         {
-            // This will cause us to stop writing to the file.
-            // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
-            m_ErrorEncountered = true;
-        }
+            if (m_BufferUsed + inCount > m_BufferSize)
+            {
+                FlushBuffer();
+            }
+
+            ULONGLONG now = CLRGetTickCount64();
+            if (m_BufferUsed == 0)
+            {
+                m_BufferStartTime = now;
+            }
 
+            memcpy(m_Buffer + m_BufferUsed, strLine, inCount);
+            m_BufferUsed += inCount;
+
+            if (now - m_BufferStartTime >= MAX_PERFMAP_BUFFERED_MS)
+            {
+                FlushBuffer();
+            }
+        }
+        else
+        {
+            // Keep the lines in order when one doesn't fit in the buffer.
+            FlushBuffer();
+            WriteToFile(strLine, inCount);
+        }
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
 
+// Write data to the map file.
+void PerfMap::WriteToFile(const void * pData, ULONG count)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_FileStream == nullptr || m_ErrorEncountered)
+    {
+        return;
+    }
+
+    // The PAL already takes a lock when writing, so we don't need to do so here.
+    ULONG outCount;
+    m_FileStream->Write(pData, count, &outCount);
+
+    if (count != outCount)
+    {
+        // This will cause us to stop writing to the file.
+        // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
+        m_ErrorEncountered = true;
+    }
+}
+
+// Write the staged lines to the map file.
+void PerfMap::FlushBuffer()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_BufferUsed != 0)
+    {
+        WriteToFile(m_Buffer, m_BufferUsed);
+        m_BufferUsed = 0;
+    }
+}
+
 void PerfMap::LogJITCompiledMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, PrepareCodeConfig *pConfig)
 {
     LIMITED_METHOD_CONTRACT;
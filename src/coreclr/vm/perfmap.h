@@ -33,6 +33,14 @@ private:
     // Set to true if an error is encountered when writing to the file.
     bool m_ErrorEncountered;
 
+    // Lines staged for the file when DOTNET_PerfMapBufferSize is set, or nullptr.
+    BYTE * m_Buffer;
+    ULONG m_BufferSize;
+    ULONG m_BufferUsed;
+
+    // Tick count at which the oldest staged line was added to the buffer.
+    ULONGLONG m_BufferStartTime;
+
     // Construct a new map
     PerfMap();
 
@@ -42,6 +50,12 @@ private:
     // Write a line to the map file.
     void WriteLine(SString & line);
 
+    // Write data to the map file, bypassing the buffer.
+    void WriteToFile(const void * pData, ULONG count);
+
+    // Write the staged lines to the map file.
+    void FlushBuffer();
+
     // Default to /tmp or use DOTNET_PerfMapJitDumpPath if set
     static const char* InternalConstructPath();
 
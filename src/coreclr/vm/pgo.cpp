@@ -50,6 +50,19 @@ const char* const         PgoManager::s_FourByte = "%u\n";
 const char* const         PgoManager::s_EightByte = "%u %u\n";
 const char* const         PgoManager::s_TypeHandle = "TypeHandle: %s\n";
 
+// Values of the PGODataFormat config
+#define PGO_DATA_FORMAT_TEXT 0
+#define PGO_DATA_FORMAT_BINARY 1
+
+// Binary format: a BinaryFileHeader, followed by the methods. Each method is a BinaryMethodHeader followed
+// by its schema records, each record being a BinaryRecord followed by the data for its entries. Entries are
+// stored at their native size, except for type and method handles which are stored as a uint32_t length followed
+// by that many bytes of UTF8 name (a length of zero indicating a null or unknown handle).
+const uint32_t            PgoManager::s_BinaryFileSignature = 0x4F47505F; // "_PGO"
+const uint32_t            PgoManager::s_BinaryFileVersion = 1;
+
+static const COUNT_T s_MaxPersistedHandleNameLength = 8192;
+
 
 PtrSHash<PgoManager::Header, PgoManager::CodeAndMethodHash> PgoManager::s_textFormatPgoData;
 CrstStatic PgoManager::s_pgoMgrLock;
@@ -160,6 +173,38 @@ void CallFClose(FILE* file)
 
 typedef Holder<FILE*, DoNothing, CallFClose> FILEHolder;
 
+// Handles in persisted PGO data are written by name, as they are only meaningful in the process that
+// collected them. Returns false if the handle is unknown or its name is too long to be worth persisting.
+//
+// Method handles are formatted as MethodName|@|fully_qualified_type_name
+static bool GetPersistedHandleName(ICorJitInfo::PgoInstrumentationKind kind, intptr_t handle, SString& name)
+{
+    if (handle == 0 || ICorJitInfo::IsUnknownHandle(handle))
+    {
+        return false;
+    }
+
+    if (kind == ICorJitInfo::PgoInstrumentationKind::TypeHandle)
+    {
+        TypeHandle th = TypeHandle::FromPtr((void*)handle);
+        TypeString::AppendType(name, th, TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
+    }
+    else
+    {
+        _ASSERTE(kind == ICorJitInfo::PgoInstrumentationKind::MethodHandle);
+        MethodDesc* md = reinterpret_cast<MethodDesc*>(handle);
+        SString garbage1, tMethodName, garbage2;
+        md->GetMethodInfo(garbage1, tMethodName, garbage2);
+        StackSString tTypeName;
+        TypeString::AppendType(tTypeName, TypeHandle(md->GetMethodTable()), TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
+        name.Set(tMethodName);
+        name.AppendUTF8("|@|");
+        name.Append(tTypeName);
+    }
+
+    return name.GetCount() <= s_MaxPersistedHandleNameLength;
+}
+
 void PgoManager::WritePgoData()
 {
     if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, JitInstrumentationDataVerbose))
@@ -214,6 +259,12 @@ void PgoManager::WritePgoData()
 
     FILEHolder fileHolder(pgoDataFile);
 
+    if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_PGODataFormat) == PGO_DATA_FORMAT_BINARY)
+    {
+        WriteBinaryPgoData(pgoDataFile, pgoDataCount);
+        return;
+    }
+
     fprintf(pgoDataFile, s_FileHeaderString, pgoDataCount);
 
     EnumeratePGOHeaders([pgoDataFile](HeaderList *pgoData)
@@ -258,58 +309,36 @@ void PgoManager::WritePgoData()
                     case ICorJitInfo::PgoInstrumentationKind::TypeHandle:
                         {
                             intptr_t thData = *(intptr_t*)(data + entryOffset);
+                            StackSString ss;
                             if (thData == 0)
                             {
                                 fprintf(pgoDataFile, s_TypeHandle, "NULL");
                             }
-                            else if (ICorJitInfo::IsUnknownHandle(thData))
+                            else if (!GetPersistedHandleName(ICorJitInfo::PgoInstrumentationKind::TypeHandle, thData, ss))
                             {
                                 fprintf(pgoDataFile, s_TypeHandle, "UNKNOWN");
                             }
                             else
                             {
-                                TypeHandle th = TypeHandle::FromPtr((void*)thData);
-                                StackSString ss;
-                                TypeString::AppendType(ss, th, TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
-                                if (ss.GetCount() > 8192)
-                                {
-                                    fprintf(pgoDataFile, s_TypeHandle, "UNKNOWN");
-                                }
-                                else
-                                {
-                                    fprintf(pgoDataFile, s_TypeHandle, ss.GetUTF8());
-                                }
+                                fprintf(pgoDataFile, s_TypeHandle, ss.GetUTF8());
                             }
                             break;
                         }
                     case ICorJitInfo::PgoInstrumentationKind::MethodHandle:
                         {
                             intptr_t mdData = *(intptr_t*)(data + entryOffset);
+                            StackSString ss;
                             if (mdData == 0)
                             {
                                 fprintf(pgoDataFile, "MethodHandle: NULL\n");
                             }
-                            else if (ICorJitInfo::IsUnknownHandle(mdData))
+                            else if (!GetPersistedHandleName(ICorJitInfo::PgoInstrumentationKind::MethodHandle, mdData, ss))
                             {
                                 fprintf(pgoDataFile, "MethodHandle: UNKNOWN\n");
                             }
                             else
                             {
-                                MethodDesc* md = reinterpret_cast<MethodDesc*>(mdData);
-                                SString garbage1, tMethodName, garbage2;
-                                md->GetMethodInfo(garbage1, tMethodName, garbage2);
-                                StackSString tTypeName;
-                                TypeString::AppendType(tTypeName, TypeHandle(md->GetMethodTable()), TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
-                                // Format is:
-                                // MethodName|@|fully_qualified_type_name
-                                if (tTypeName.GetCount() + 1 + tMethodName.GetCount() > 8192)
-                                {
-                                    fprintf(pgoDataFile, "MethodHandle: UNKNOWN\n");
-                                }
-                                else
-                                {
-                                    fprintf(pgoDataFile, "MethodHandle: %s|@|%s\n", tMethodName.GetUTF8(), tTypeName.GetUTF8());
-                                }
+                                fprintf(pgoDataFile, "MethodHandle: %s\n", ss.GetUTF8());
                             }
                             break;
                         }
@@ -330,6 +359,109 @@ void PgoManager::WritePgoData()
 
     fprintf(pgoDataFile, s_FileTrailerString);
 }
+
+static bool WriteToFile(FILE* file, const void* data, size_t size)
+{
+    return fwrite(data, size, 1, file) == 1;
+}
+
+void PgoManager::WriteBinaryPgoData(FILE* pgoDataFile, int pgoDataCount)
+{
+    BinaryFileHeader fileHeader;
+    fileHeader.signature = s_BinaryFileSignature;
+    fileHeader.version = s_BinaryFileVersion;
+    fileHeader.methodCount = (uint32_t)pgoDataCount;
+
+    if (!WriteToFile(pgoDataFile, &fileHeader, sizeof(fileHeader)))
+    {
+        return;
+    }
+
+    // Methods whose schema can't be parsed are still written with no records, so that the method count in the
+    // file header stays accurate.
+    EnumeratePGOHeaders([pgoDataFile](HeaderList *pgoData)
+    {
+        int32_t schemaItems;
+        if (!CountInstrumentationDataSize(pgoData->header.GetData(), pgoData->header.SchemaSizeMax(), &schemaItems))
+        {
+            _ASSERTE(!"Invalid instrumentation schema");
+            schemaItems = 0;
+        }
+
+        BinaryMethodHeader methodHeader;
+        methodHeader.codehash = pgoData->header.codehash;
+        methodHeader.methodhash = pgoData->header.methodhash;
+        methodHeader.ilSize = pgoData->header.ilSize;
+        methodHeader.recordCount = (uint32_t)schemaItems;
+
+        if (!WriteToFile(pgoDataFile, &methodHeader, sizeof(methodHeader)))
+        {
+            return false;
+        }
+
+        if (schemaItems == 0)
+        {
+            return true;
+        }
+
+        uint8_t* data = pgoData->header.GetData();
+
+        auto lambda = [data, pgoDataFile] (const ICorJitInfo::PgoInstrumentationSchema &schema)
+        {
+            BinaryRecord record;
+            record.instrumentationKind = (uint32_t)schema.InstrumentationKind;
+            record.ilOffset = schema.ILOffset;
+            record.count = schema.Count;
+            record.other = schema.Other;
+
+            if (!WriteToFile(pgoDataFile, &record, sizeof(record)))
+            {
+                return false;
+            }
+
+            for (int32_t iEntry = 0; iEntry < schema.Count; iEntry++)
+            {
+                size_t entryOffset = schema.Offset + iEntry * InstrumentationKindToSize(schema.InstrumentationKind);
+
+                switch(schema.InstrumentationKind & ICorJitInfo::PgoInstrumentationKind::MarshalMask)
+                {
+                    case ICorJitInfo::PgoInstrumentationKind::FourByte:
+                        if (!WriteToFile(pgoDataFile, data + entryOffset, sizeof(uint32_t)))
+                            return false;
+                        break;
+                    case ICorJitInfo::PgoInstrumentationKind::EightByte:
+                        if (!WriteToFile(pgoDataFile, data + entryOffset, sizeof(uint64_t)))
+                            return false;
+                        break;
+                    case ICorJitInfo::PgoInstrumentationKind::TypeHandle:
+                    case ICorJitInfo::PgoInstrumentationKind::MethodHandle:
+                        {
+                            StackSString ss;
+                            const char* name = NULL;
+                            uint32_t nameLength = 0;
+                            if (GetPersistedHandleName(schema.InstrumentationKind & ICorJitInfo::PgoInstrumentationKind::MarshalMask, *(intptr_t*)(data + entryOffset), ss))
+                            {
+                                name = ss.GetUTF8();
+                                nameLength = (uint32_t)strlen(name);
+                            }
+
+                            if (!WriteToFile(pgoDataFile, &nameLength, sizeof(nameLength)))
+                                return false;
+                            if ((nameLength != 0) && !WriteToFile(pgoDataFile, name, nameLength))
+                                return false;
+                            break;
+                        }
+                    default:
+                        break;
+                }
+            }
+            return true;
+        };
+
+        // A partially written method can't be skipped by the reader, so stop writing altogether.
+        return ReadInstrumentationSchemaWithLayout(data, pgoData->header.SchemaSizeMax(), pgoData->header.countsOffset, lambda);
+    });
+}
 #endif // DACCESS_COMPILE
 
 void ReadLineAndDiscard(FILE* file)
@@ -351,10 +483,10 @@ void ReadLineAndDiscard(FILE* file)
 #ifndef DACCESS_COMPILE
 void PgoManager::ReadPgoData()
 {
-    // Skip, if we're not reading, or we're writing profile data, or doing tiered pgo
+    // Skip, if we're not reading, or we're writing profile data. When tiered pgo is enabled, methods with
+    // data in the file skip the instrumented tiers and use the loaded data instead (see HasLoadedPgoData).
     //
-    if (g_pConfig->TieredPGO() ||
-        (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_WritePGOData) > 0) ||
+    if ((CLRConfig::GetConfigValue(CLRConfig::INTERNAL_WritePGOData) > 0) ||
         (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ReadPGOData) == 0))
     {
         return;
@@ -376,6 +508,12 @@ void PgoManager::ReadPgoData()
 
     FILEHolder fileHolder(pgoDataFile);
 
+    if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_PGODataFormat) == PGO_DATA_FORMAT_BINARY)
+    {
+        ReadBinaryPgoData(pgoDataFile);
+        return;
+    }
+
     char     buffer[16384];
     unsigned maxIndex = 0;
 
@@ -584,43 +722,222 @@ void PgoManager::ReadPgoData()
         if (failed)
             continue;
 
-        methods++;
-
-        UINT offsetOfActualInstrumentationData;
-        HRESULT hr = ComputeOffsetOfActualInstrumentationData(schemaElements.GetElements(), schemaCount, sizeof(Header), &offsetOfActualInstrumentationData);
-        if (FAILED(hr))
+        if (!AddLoadedPgoData(methodhash, codehash, ilSize, schemaElements.GetElements(), schemaCount, methodInstrumentationData))
         {
             continue;
         }
-        UINT offsetOfInstrumentationDataFromStartOfDataRegion = offsetOfActualInstrumentationData - sizeof(Header);
 
-        // Adjust schema offsets to account for embedding the instrumentation schema in front of the data
-        for (unsigned iSchema = 0; iSchema < schemaCount; iSchema++)
+        methods++;
+        probes += schemaCount;
+    }
+}
+
+static bool ReadFromFile(FILE* file, void* data, size_t size)
+{
+    return fread(data, size, 1, file) == 1;
+}
+
+void PgoManager::ReadBinaryPgoData(FILE* pgoDataFile)
+{
+    BinaryFileHeader fileHeader;
+    if (!ReadFromFile(pgoDataFile, &fileHeader, sizeof(fileHeader)) ||
+        (fileHeader.signature != s_BinaryFileSignature) ||
+        (fileHeader.version != s_BinaryFileVersion))
+    {
+        return;
+    }
+
+    unsigned methods = 0;
+    unsigned probes = 0;
+
+    // Unlike the text format there is no way to resynchronize after a malformed method, so any
+    // failure stops reading and keeps only the methods read so far.
+    for (uint32_t iMethod = 0; iMethod < fileHeader.methodCount; iMethod++)
+    {
+        BinaryMethodHeader methodHeader;
+        if (!ReadFromFile(pgoDataFile, &methodHeader, sizeof(methodHeader)))
         {
-            schemaElements[iSchema].Offset += offsetOfInstrumentationDataFromStartOfDataRegion;
+            break;
         }
 
-        S_SIZE_T allocationSize = S_SIZE_T(offsetOfActualInstrumentationData) + S_SIZE_T(methodInstrumentationData.GetCount());
-        if (allocationSize.IsOverflow())
+        bool failed = false;
+        StackSArray<ICorJitInfo::PgoInstrumentationSchema> schemaElements;
+        StackSArray<uint8_t> methodInstrumentationData;
+        ICorJitInfo::PgoInstrumentationSchema lastSchema = {};
+
+        for (uint32_t i = 0; !failed && i < methodHeader.recordCount; i++)
         {
-            _ASSERTE(!"Unexpected overflow");
-            return;
+            BinaryRecord record;
+            if (!ReadFromFile(pgoDataFile, &record, sizeof(record)) || (record.count < 0))
+            {
+                failed = true;
+                break;
+            }
+
+            ICorJitInfo::PgoInstrumentationSchema schema;
+            schema.InstrumentationKind = (ICorJitInfo::PgoInstrumentationKind)record.instrumentationKind;
+            schema.ILOffset = record.ilOffset;
+            schema.Count = record.count;
+            schema.Other = record.other;
+
+            LayoutPgoInstrumentationSchema(lastSchema, &schema);
+            schemaElements.Append(schema);
+
+            COUNT_T entrySize = InstrumentationKindToSize(schema.InstrumentationKind);
+            S_UINT32 maxSize = S_UINT32(entrySize) * S_UINT32((uint32_t)schema.Count) + S_UINT32((uint32_t)schema.Offset);
+            if (maxSize.IsOverflow())
+            {
+                failed = true;
+                break;
+            }
+            methodInstrumentationData.SetCount(maxSize.Value());
+
+            for (int32_t iEntry = 0; iEntry < schema.Count; iEntry++)
+            {
+                size_t entryOffset = schema.Offset + iEntry * entrySize;
+                uint8_t *rawBuffer = methodInstrumentationData.OpenRawBuffer(maxSize.Value());
+
+                switch(schema.InstrumentationKind & ICorJitInfo::PgoInstrumentationKind::MarshalMask)
+                {
+                    case ICorJitInfo::PgoInstrumentationKind::FourByte:
+                        failed = !ReadFromFile(pgoDataFile, rawBuffer + entryOffset, sizeof(uint32_t));
+                        break;
+                    case ICorJitInfo::PgoInstrumentationKind::EightByte:
+                        failed = !ReadFromFile(pgoDataFile, rawBuffer + entryOffset, sizeof(uint64_t));
+                        break;
+                    case ICorJitInfo::PgoInstrumentationKind::TypeHandle:
+                    case ICorJitInfo::PgoInstrumentationKind::MethodHandle:
+                        {
+                            uint32_t nameLength;
+                            if (!ReadFromFile(pgoDataFile, &nameLength, sizeof(nameLength)) || (nameLength > s_MaxPersistedHandleNameLength))
+                            {
+                                failed = true;
+                                break;
+                            }
+
+                            INT_PTR ptrVal = 0;
+                            if (nameLength != 0)
+                            {
+                                // As with the text format, early type loading is likely problematic, so keep the
+                                // name in the data and fix it up when the data is requested
+                                char* tempString = (char*)malloc(nameLength + 1);
+                                if ((tempString == NULL) || !ReadFromFile(pgoDataFile, tempString, nameLength))
+                                {
+                                    free(tempString);
+                                    failed = true;
+                                    break;
+                                }
+                                tempString[nameLength] = '\0';
+
+                                ptrVal = (INT_PTR)tempString;
+                                ptrVal += 1; // Set low bit to indicate that this isn't actually a TypeHandle, but is instead a pointer
+                            }
+
+                            *(INT_PTR *)(rawBuffer + entryOffset) = ptrVal;
+                            break;
+                        }
+                    default:
+                        break;
+                }
+
+                methodInstrumentationData.CloseRawBuffer();
+
+                if (failed)
+                    break;
+            }
+
+            lastSchema = schema;
         }
 
-        Header* methodData = (Header*)malloc(allocationSize.Value());
-        methodData->HashInit(methodhash, codehash, ilSize, offsetOfInstrumentationDataFromStartOfDataRegion);
+        if (failed)
+        {
+            break;
+        }
 
-        if (!WriteInstrumentationSchema(schemaElements.GetElements(), schemaCount, methodData->GetData(), offsetOfInstrumentationDataFromStartOfDataRegion))
+        if (AddLoadedPgoData(methodHeader.methodhash, methodHeader.codehash, methodHeader.ilSize, schemaElements.GetElements(), schemaElements.GetCount(), methodInstrumentationData))
         {
-            _ASSERTE(!"Unable to write schema");
-            return;
+            methods++;
+            probes += schemaElements.GetCount();
         }
+    }
 
-        methodInstrumentationData.Copy(((uint8_t*)methodData) + offsetOfActualInstrumentationData, methodInstrumentationData.Begin(), methodInstrumentationData.GetCount());
+    LOG((LF_JIT, LL_INFO10, "PGO: read binary data for %u methods, %u schema records\n", methods, probes));
+}
 
-        s_textFormatPgoData.Add(methodData);
-        probes += schemaCount;
+bool PgoManager::AddLoadedPgoData(unsigned methodhash, unsigned codehash, unsigned ilSize, ICorJitInfo::PgoInstrumentationSchema* schemaElements, UINT32 schemaCount, SArray<uint8_t>& methodInstrumentationData)
+{
+    UINT offsetOfActualInstrumentationData;
+    HRESULT hr = ComputeOffsetOfActualInstrumentationData(schemaElements, schemaCount, sizeof(Header), &offsetOfActualInstrumentationData);
+    if (FAILED(hr))
+    {
+        return false;
+    }
+    UINT offsetOfInstrumentationDataFromStartOfDataRegion = offsetOfActualInstrumentationData - sizeof(Header);
+
+    // Adjust schema offsets to account for embedding the instrumentation schema in front of the data
+    for (unsigned iSchema = 0; iSchema < schemaCount; iSchema++)
+    {
+        schemaElements[iSchema].Offset += offsetOfInstrumentationDataFromStartOfDataRegion;
+    }
+
+    S_SIZE_T allocationSize = S_SIZE_T(offsetOfActualInstrumentationData) + S_SIZE_T(methodInstrumentationData.GetCount());
+    if (allocationSize.IsOverflow())
+    {
+        _ASSERTE(!"Unexpected overflow");
+        return false;
+    }
+
+    Header* methodData = (Header*)malloc(allocationSize.Value());
+    if (methodData == NULL)
+    {
+        return false;
+    }
+    methodData->HashInit(methodhash, codehash, ilSize, offsetOfInstrumentationDataFromStartOfDataRegion);
+
+    if (!WriteInstrumentationSchema(schemaElements, schemaCount, methodData->GetData(), offsetOfInstrumentationDataFromStartOfDataRegion))
+    {
+        _ASSERTE(!"Unable to write schema");
+        free(methodData);
+        return false;
+    }
+
+    methodInstrumentationData.Copy(((uint8_t*)methodData) + offsetOfActualInstrumentationData, methodInstrumentationData.Begin(), methodInstrumentationData.GetCount());
+
+    s_textFormatPgoData.Add(methodData);
+    return true;
+}
+
+bool PgoManager::HasLoadedPgoData(MethodDesc* pMD)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (s_textFormatPgoData.GetCount() == 0)
+    {
+        return false;
+    }
+
+    bool found = false;
+    EX_TRY
+    {
+        int codehash;
+        unsigned ilSize;
+        if (GetVersionResilientILCodeHashCode(pMD, &codehash, &ilSize))
+        {
+            found = s_textFormatPgoData.Lookup(CodeAndMethodHash(codehash, pMD->GetStableHash())) != NULL;
+        }
     }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    return found;
 }
 #endif // DACCESS_COMPILE
 
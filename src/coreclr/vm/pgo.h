@@ -18,6 +18,10 @@ public:
     static void Initialize();
     static void Shutdown();
 
+    // Returns true if data for the method was loaded from the file at PGODataPath, in which case there is
+    // no need for the method to go through an instrumented tier.
+    static bool HasLoadedPgoData(MethodDesc* pMD);
+
 #endif // FEATURE_PGO
 
 public:
@@ -161,6 +165,9 @@ private:
 
     static void ReadPgoData();
     static void WritePgoData();
+    static void ReadBinaryPgoData(FILE* pgoDataFile);
+    static void WriteBinaryPgoData(FILE* pgoDataFile, int pgoDataCount);
+    static bool AddLoadedPgoData(unsigned methodhash, unsigned codehash, unsigned ilSize, ICorJitInfo::PgoInstrumentationSchema* schemaElements, UINT32 schemaCount, SArray<uint8_t>& methodInstrumentationData);
 
 private:
 
@@ -174,6 +181,33 @@ private:
     static const char* const s_EightByte;
     static const char* const s_TypeHandle;
 
+    // Records for the binary file format
+    struct BinaryFileHeader
+    {
+        uint32_t signature;
+        uint32_t version;
+        uint32_t methodCount;
+    };
+
+    struct BinaryMethodHeader
+    {
+        uint32_t codehash;
+        uint32_t methodhash;
+        uint32_t ilSize;
+        uint32_t recordCount;
+    };
+
+    struct BinaryRecord
+    {
+        uint32_t instrumentationKind;
+        int32_t ilOffset;
+        int32_t count;
+        int32_t other;
+    };
+
+    static const uint32_t s_BinaryFileSignature;
+    static const uint32_t s_BinaryFileVersion;
+
     static CrstStatic s_pgoMgrLock;
     static PgoManager s_InitialPgoManager;
 
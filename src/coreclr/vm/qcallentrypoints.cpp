@@ -279,12 +279,14 @@ static const Entry s_QCall[] =
     DllImportEntry(GCInterface_Collect)
     DllImportEntry(GCInterface_ReRegisterForFinalize)
     DllImportEntry(GCInterface_GetNextFinalizableObject)
+    DllImportEntry(GCInterface_GetFinalizationBacklog)
     DllImportEntry(GCInterface_WaitForPendingFinalizers)
     DllImportEntry(GCInterface_AddMemoryPressure)
     DllImportEntry(GCInterface_RemoveMemoryPressure)
 #ifdef FEATURE_BASICFREEZE
     DllImportEntry(GCInterface_RegisterFrozenSegment)
     DllImportEntry(GCInterface_UnregisterFrozenSegment)
+    DllImportEntry(GCInterface_FreezeObjectGraph)
 #endif
     DllImportEntry(GCInterface_EnumerateConfigurationValues)
     DllImportEntry(GCInterface_RefreshMemoryLimit)
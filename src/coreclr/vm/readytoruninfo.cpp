@@ -359,6 +359,57 @@ void ReadyToRunInfo::SetMethodDescForEntryPointInNativeImage(PCODE entryPoint, M
     }
 }
 
+// Values of m_instMethodEntryPointOffsets. PtrHashMap needs even values and the offset can be -1 for
+// methods that are not in the image, so the offset is biased and shifted.
+static LPVOID EncodeInstMethodEntryPointOffset(uint offset)
+{
+    LIMITED_METHOD_CONTRACT;
+    return (LPVOID)(((UPTR)(offset + 1) + 1) << 1);
+}
+
+static uint DecodeInstMethodEntryPointOffset(LPVOID value)
+{
+    LIMITED_METHOD_CONTRACT;
+    return (uint)(((UPTR)value >> 1) - 1) - 1;
+}
+
+BOOL ReadyToRunInfo::TryGetCachedInstMethodEntryPointOffset(MethodDesc * pMD, uint * pOffset)
+{
+    CONTRACTL
+    {
+        GC_NOTRIGGER;
+        NOTHROW;
+    }
+    CONTRACTL_END;
+
+    LPVOID value = m_instMethodEntryPointOffsets.LookupValue((UPTR)pMD, NULL);
+    if (value == (LPVOID)INVALIDENTRY)
+        return FALSE;
+
+    *pOffset = DecodeInstMethodEntryPointOffset(value);
+    return TRUE;
+}
+
+void ReadyToRunInfo::CacheInstMethodEntryPointOffset(MethodDesc * pMD, uint offset)
+{
+    STANDARD_VM_CONTRACT;
+
+    // The cache is never trimmed, so it must not outlive the MethodDescs it is keyed by
+    // or the image it belongs to.
+    if (pMD->GetLoaderAllocator()->IsCollectible() ||
+        (m_pModule != NULL && m_pModule->GetLoaderAllocator()->IsCollectible()))
+    {
+        return;
+    }
+
+    CrstHolder ch(&m_Crst);
+
+    if (m_instMethodEntryPointOffsets.LookupValue((UPTR)pMD, NULL) == (LPVOID)INVALIDENTRY)
+    {
+        m_instMethodEntryPointOffsets.InsertValue((UPTR)pMD, EncodeInstMethodEntryPointOffset(offset));
+    }
+}
+
 // A log file to record success/failure of R2R loads. s_r2rLogFile can have the following values:
 // -1: Logging not yet initialized.
 // NULL: Logging disabled.
@@ -692,6 +743,49 @@ PTR_ReadyToRunInfo ReadyToRunInfo::ComputeAlternateGenericLocationForR2RCode(Met
     }
 }
 
+//
+// Startup of a large image touches its method lookup tables for nearly every method, and images compiled
+// with methods in first-access order (e.g. from a startup trace recorded through the perf map) keep
+// their startup code at the start of the code. Ask the OS to read those ranges ahead so that cold start
+// does not page them in one fault at a time.
+//
+void ReadyToRunInfo::PrefetchStartupRanges()
+{
+    STANDARD_VM_CONTRACT;
+
+    DWORD prefetchCodeSize = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_ReadyToRun_PrefetchCodeSize) * 1024;
+    if (prefetchCodeSize == 0)
+        return;
+
+    PEImageLayout * pLayout = m_pComposite->GetLayout();
+
+    static const ReadyToRunSectionType s_tableSections[] =
+    {
+        ReadyToRunSectionType::RuntimeFunctions,
+        ReadyToRunSectionType::ImportSections,
+        ReadyToRunSectionType::MethodDefEntryPoints,
+        ReadyToRunSectionType::InstanceMethodEntryPoints,
+        ReadyToRunSectionType::AvailableTypes,
+    };
+
+    for (ReadyToRunSectionType sectionType : s_tableSections)
+    {
+        IMAGE_DATA_DIRECTORY * pDir = m_pComposite->FindSection(sectionType);
+        if (pDir != NULL)
+        {
+            pLayout->Prefetch(pDir->VirtualAddress, pDir->Size);
+        }
+    }
+
+    if (m_nRuntimeFunctions != 0)
+    {
+        // runtime functions are sorted by address, so the first one starts the code
+        DWORD codeStart = RUNTIME_FUNCTION__BeginAddress(&m_pRuntimeFunctions[0]);
+        DWORD codeEnd = RUNTIME_FUNCTION__BeginAddress(&m_pRuntimeFunctions[m_nRuntimeFunctions - 1]);
+        pLayout->Prefetch(codeStart, min(prefetchCodeSize, codeEnd - codeStart + 1));
+    }
+}
+
 ReadyToRunInfo::ReadyToRunInfo(Module * pModule, LoaderAllocator* pLoaderAllocator, PEImageLayout * pLayout, READYTORUN_HEADER * pHeader, NativeImage *pNativeImage, AllocMemTracker *pamTracker)
     : m_pModule(pModule),
     m_pHeader(pHeader),
@@ -804,6 +898,11 @@ ReadyToRunInfo::ReadyToRunInfo(Module * pModule, LoaderAllocator* pLoaderAllocat
         m_nImportSections = 0;
     }
 
+    if (!m_isComponentAssembly)
+    {
+        PrefetchStartupRanges();
+    }
+
     m_nativeReader = NativeReader((BYTE *)m_pComposite->GetLayout()->GetBase(), m_pComposite->GetLayout()->GetVirtualSize());
 
     IMAGE_DATA_DIRECTORY * pEntryPointsDir = m_component.FindSection(ReadyToRunSectionType::MethodDefEntryPoints);
@@ -853,6 +952,12 @@ ReadyToRunInfo::ReadyToRunInfo(Module * pModule, LoaderAllocator* pLoaderAllocat
         m_entryPointToMethodDescMap.Init(TRUE, &lock);
     }
 
+    if (!m_instMethodEntryPoints.IsNull())
+    {
+        LockOwner lock = {&m_Crst, IsOwnerOfCrst};
+        m_instMethodEntryPointOffsets.Init(TRUE, &lock);
+    }
+
     if (IsImageVersionAtLeast(6, 3))
     {
         IMAGE_DATA_DIRECTORY* pCrossModuleInlineTrackingInfoDir = m_pComposite->FindSection(ReadyToRunSectionType::CrossModuleInlineInfo);
@@ -1112,20 +1217,25 @@ PCODE ReadyToRunInfo::GetEntryPoint(MethodDesc * pMD, PrepareCodeConfig* pConfig
         if (m_instMethodEntryPoints.IsNull())
             goto done;
 
-        NativeHashtable::Enumerator lookup = m_instMethodEntryPoints.Lookup(GetVersionResilientMethodHashCode(pMD));
-        NativeParser entryParser;
-        offset = (uint)-1;
-        while (lookup.GetNext(entryParser))
+        if (!TryGetCachedInstMethodEntryPointOffset(pMD, &offset))
         {
-            PCCOR_SIGNATURE pBlob = (PCCOR_SIGNATURE)entryParser.GetBlob();
-            SigPointer sig(pBlob);
-            if (SigMatchesMethodDesc(pMD, sig, m_pModule))
+            NativeHashtable::Enumerator lookup = m_instMethodEntryPoints.Lookup(GetVersionResilientMethodHashCode(pMD));
+            NativeParser entryParser;
+            offset = (uint)-1;
+            while (lookup.GetNext(entryParser))
             {
-                // Get the updated SigPointer location, so we can calculate the size of the blob,
-                // in order to skip the blob and find the entry point data.
-                offset = entryParser.GetOffset() + (uint)(sig.GetPtr() - pBlob);
-                break;
+                PCCOR_SIGNATURE pBlob = (PCCOR_SIGNATURE)entryParser.GetBlob();
+                SigPointer sig(pBlob);
+                if (SigMatchesMethodDesc(pMD, sig, m_pModule))
+                {
+                    // Get the updated SigPointer location, so we can calculate the size of the blob,
+                    // in order to skip the blob and find the entry point data.
+                    offset = entryParser.GetOffset() + (uint)(sig.GetPtr() - pBlob);
+                    break;
+                }
             }
+
+            CacheInstMethodEntryPointOffset(pMD, offset);
         }
 
         if (offset == (uint)-1)
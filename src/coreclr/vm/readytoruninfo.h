@@ -137,6 +137,10 @@ class ReadyToRunInfo
     Crst                            m_Crst;
     PtrHashMap                      m_entryPointToMethodDescMap;
 
+    // Results of m_instMethodEntryPoints lookups, keyed by MethodDesc. Generic instantiations are
+    // looked up in several images each, and every lookup decodes and compares signatures.
+    PtrHashMap                      m_instMethodEntryPointOffsets;
+
     PTR_PersistentInlineTrackingMapR2R m_pPersistentInlineTrackingMap;
     PTR_PersistentInlineTrackingMapR2R m_pCrossModulePersistentInlineTrackingMap;
 
@@ -333,6 +337,11 @@ private:
     BOOL GetEnclosingToken(IMDInternalImport * pImport, ModuleBase *pModule1, mdToken mdType, mdToken * pEnclosingToken);
     BOOL CompareTypeNameOfTokens(mdToken mdToken1, IMDInternalImport * pImport1, ModuleBase *pModule1, mdToken mdToken2, IMDInternalImport * pImport2, ModuleBase *pModule2);
 
+    void PrefetchStartupRanges();
+
+    BOOL TryGetCachedInstMethodEntryPointOffset(MethodDesc * pMD, uint * pOffset);
+    void CacheInstMethodEntryPointOffset(MethodDesc * pMD, uint offset);
+
     PTR_MethodDesc GetMethodDescForEntryPointInNativeImage(PCODE entryPoint);
     void SetMethodDescForEntryPointInNativeImage(PCODE entryPoint, PTR_MethodDesc methodDesc);
     
@@ -406,6 +406,120 @@ public:
     }
 };
 
+// Methods without arguments that return nothing, an integral primitive or an object reference need
+// neither argument copying nor a return buffer, so they can be called without the arg iterator.
+static BOOL IsFastPathSupportedForMethodInvoke(SIGNATURENATIVEREF pSig, MethodDesc * pMD)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    if (pSig->NumFixedArgs() != 0)
+        return FALSE;
+
+    // Value type instance methods need the unboxing and Nullable<T> handling of the general path
+    if (!pMD->IsStatic() && pMD->GetMethodTable()->IsValueType())
+        return FALSE;
+
+    switch (pSig->GetReturnTypeHandle().GetSignatureCorElementType())
+    {
+    case ELEMENT_TYPE_VOID:
+    case ELEMENT_TYPE_BOOLEAN:
+    case ELEMENT_TYPE_CHAR:
+    case ELEMENT_TYPE_I1:
+    case ELEMENT_TYPE_U1:
+    case ELEMENT_TYPE_I2:
+    case ELEMENT_TYPE_U2:
+    case ELEMENT_TYPE_I4:
+    case ELEMENT_TYPE_U4:
+    case ELEMENT_TYPE_I8:
+    case ELEMENT_TYPE_U8:
+    case ELEMENT_TYPE_I:
+    case ELEMENT_TYPE_U:
+    case ELEMENT_TYPE_CLASS:
+    case ELEMENT_TYPE_STRING:
+    case ELEMENT_TYPE_OBJECT:
+    case ELEMENT_TYPE_SZARRAY:
+    case ELEMENT_TYPE_ARRAY:
+        return TRUE;
+
+    default:
+        return FALSE;
+    }
+}
+
+static OBJECTREF InvokeMethodFastPath(MethodDesc * pMeth, TypeHandle ownerType, OBJECTREF * pTarget, TypeHandle retTH)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        PRECONDITION(IsProtectedByGCFrame(pTarget));
+    }
+    CONTRACTL_END;
+
+    // Same as IsActivationNeededForMethodInvoke
+    if (pMeth->IsStatic() || pMeth->HasMethodInstantiation() || pMeth->IsInterface())
+        pMeth->EnsureActive();
+    CONSISTENCY_CHECK(pMeth->CheckActivated());
+
+    LPBYTE pAlloc = (LPBYTE)_alloca(TransitionBlock::GetNegSpaceSize() + sizeof(TransitionBlock));
+    LPBYTE pTransitionBlock = pAlloc + TransitionBlock::GetNegSpaceSize();
+
+    CallDescrData callDescrData;
+
+    callDescrData.pSrc = pTransitionBlock + sizeof(TransitionBlock);
+    callDescrData.numStackSlots = 0;
+#ifdef CALLDESCR_ARGREGS
+    callDescrData.pArgumentRegisters = (ArgumentRegisters*)(pTransitionBlock + TransitionBlock::GetOffsetOfArgumentRegisters());
+#endif
+#ifdef CALLDESCR_RETBUFFARGREG
+    callDescrData.pRetBuffArg = (UINT64*)(pTransitionBlock + TransitionBlock::GetOffsetOfRetBuffArgReg());
+#endif
+#ifdef CALLDESCR_FPARGREGS
+    callDescrData.pFloatArgumentRegisters = NULL;
+#endif
+#ifdef CALLDESCR_REGTYPEMAP
+    callDescrData.dwRegTypeMap = 0;
+#endif
+    // Floating point returns are not supported by the fast path
+    callDescrData.fpReturnSize = 0;
+
+    if (pMeth->IsVtableMethod())
+    {
+        callDescrData.pTarget = pMeth->GetSingleCallableAddrOfVirtualizedCode(pTarget, ownerType);
+    }
+    else
+    {
+        callDescrData.pTarget = pMeth->GetSingleCallableAddrOfCode();
+    }
+
+    GCStress<cfg_any>::MaybeTrigger();
+
+    // NO GC AFTER THIS POINT. "this" in the transition block is not protected.
+    if (!pMeth->IsStatic())
+    {
+        *((LPVOID*)(pTransitionBlock + ArgIteratorForMethodInvoke::GetThisOffset())) = OBJECTREFToObject(*pTarget);
+    }
+
+    CallDescrWorkerWithHandler(&callDescrData);
+
+    if (retTH.IsValueType())
+    {
+        if (retTH.GetSignatureCorElementType() == ELEMENT_TYPE_VOID)
+            return NULL;
+
+        return retTH.GetMethodTable()->Box(&callDescrData.returnValue);
+    }
+
+    return InvokeUtil::CreateObjectAfterInvoke(retTH, &callDescrData.returnValue);
+}
+
 FCIMPL4(Object*, RuntimeMethodHandle::InvokeMethod,
     Object *target,
     PVOID* args, // An array of byrefs
@@ -461,6 +575,11 @@ FCIMPL4(Object*, RuntimeMethodHandle::InvokeMethod,
         if (!fCtorOfVariableSizedObject)
             gc.retVal = pMT->Allocate();
     }
+    else if (IsFastPathSupportedForMethodInvoke(gc.pSig, pMeth))
+    {
+        gc.retVal = InvokeMethodFastPath(pMeth, ownerType, &gc.target, gc.pSig->GetReturnTypeHandle());
+        goto Done;
+    }
 
     {
     ArgIteratorForMethodInvoke argit(&gc.pSig, fCtorOfVariableSizedObject);
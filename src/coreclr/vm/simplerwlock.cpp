@@ -6,6 +6,174 @@
 
 #include "common.h"
 #include "simplerwlock.hpp"
+#include <minipal/time.h>
+
+namespace
+{
+    // The readers of read-biased locks, each in the slot that the hash of the lock and of the reading
+    // thread selects. A reader that finds its slot taken (by another lock or by a collision) uses m_RWLock.
+    const UINT32 ReadBiasSlotCount = 4096;
+    const UINT32 ReadBiasSlotShift = 12;
+    SimpleRWLock* s_readBiasSlots[ReadBiasSlotCount];
+
+    // The locks that the current thread holds through its slot. The thread identity that goes into the
+    // hash is the address of this array.
+    const UINT32 MaxReadBiasHolds = 4;
+    thread_local SimpleRWLock* t_readBiasHolds[MaxReadBiasHolds];
+
+    // After a revocation, the bias stays off for this many times as long as the revocation took, which
+    // bounds the time writers spend revoking to about a tenth of the total.
+    const INT64 ReadBiasInhibitMultiplier = 9;
+
+    // -1 until the configuration has been read
+    LONG s_readBiasConfig = -1;
+
+    BOOL IsReadBiasEnabled()
+    {
+        WRAPPER_NO_CONTRACT;
+
+        LONG config = s_readBiasConfig;
+        if (config < 0)
+        {
+            config = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_SimpleRWLockReadBias) != 0) ? 1 : 0;
+            s_readBiasConfig = config;
+        }
+        return config != 0;
+    }
+
+    SimpleRWLock** GetReadBiasSlot(SimpleRWLock* pLock)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        UINT64 hash = ((UINT64)(SIZE_T)pLock ^ ((UINT64)(SIZE_T)&t_readBiasHolds[0] >> 4)) * 0x9E3779B97F4A7C15ULL;
+        return &s_readBiasSlots[hash >> (64 - ReadBiasSlotShift)];
+    }
+
+    int FindReadBiasHold(SimpleRWLock* pLock)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        for (UINT32 i = 0; i < MaxReadBiasHolds; i++)
+        {
+            if (t_readBiasHolds[i] == pLock)
+                return (int)i;
+        }
+        return -1;
+    }
+}
+
+//=====================================================================
+// Acquires the lock for reading through the slot of the current thread,
+// without writing to the lock itself.
+//=====================================================================
+BOOL SimpleRWLock::TryEnterReadBiased()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(m_fReadBias);
+
+    // A nested acquisition, or one more than the thread can track, uses m_RWLock
+    if (FindReadBiasHold(this) >= 0)
+        return FALSE;
+    int hold = FindReadBiasHold(NULL);
+    if (hold < 0)
+        return FALSE;
+
+    SimpleRWLock** pSlot = GetReadBiasSlot(this);
+    if (VolatileLoad(pSlot) != NULL || InterlockedCompareExchangeT(pSlot, this, (SimpleRWLock*)NULL) != NULL)
+        return FALSE;
+
+    // The interlocked operation orders the publication of the slot before this read, which pairs
+    // with the barrier between clearing the bias and scanning the slots in RevokeReadBias.
+    if (!m_fReadBias)
+    {
+        VolatileStore(pSlot, (SimpleRWLock*)NULL);
+        return FALSE;
+    }
+
+    t_readBiasHolds[hold] = this;
+    return TRUE;
+}
+
+//=====================================================================
+BOOL SimpleRWLock::TryLeaveReadBiased()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    int hold = FindReadBiasHold(this);
+    if (hold < 0)
+        return FALSE;
+
+    t_readBiasHolds[hold] = NULL;
+
+    SimpleRWLock** pSlot = GetReadBiasSlot(this);
+    _ASSERTE(*pSlot == this);
+    VolatileStore(pSlot, (SimpleRWLock*)NULL);
+    return TRUE;
+}
+
+//=====================================================================
+// Called by a writer that owns m_RWLock, waits for the readers that
+// entered through their slots to leave.
+//=====================================================================
+void SimpleRWLock::RevokeReadBias()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(m_RWLock == -1);
+
+    m_fReadBias = FALSE;
+    MemoryBarrier();
+
+    INT64 start = minipal_hires_ticks();
+
+    DWORD dwSwitchCount = 0;
+    for (UINT32 i = 0; i < ReadBiasSlotCount; i++)
+    {
+        while (VolatileLoad(&s_readBiasSlots[i]) == this)
+        {
+            YieldProcessorNormalized();
+            if (g_SystemInfo.dwNumberOfProcessors <= 1)
+                __SwitchToThread(0, ++dwSwitchCount);
+        }
+    }
+
+    INT64 now = minipal_hires_ticks();
+    m_inhibitReadBiasUntil = now + (now - start) * ReadBiasInhibitMultiplier;
+}
+
+//=====================================================================
+// Called by a reader that holds m_RWLock, so that no writer can be
+// revoking the bias concurrently.
+//=====================================================================
+void SimpleRWLock::MaybeEnableReadBias()
+{
+    WRAPPER_NO_CONTRACT;
+
+    _ASSERTE(m_RWLock > 0);
+
+    if (m_fReadBias || minipal_hires_ticks() < m_inhibitReadBiasUntil)
+        return;
+
+    if (IsReadBiasEnabled())
+    {
+        m_fReadBias = TRUE;
+    }
+    else
+    {
+        // Readers will not look at the bias again
+        m_fReadBiasAllowed = FALSE;
+    }
+}
+
+#ifdef _DEBUG
+BOOL SimpleRWLock::IsReadBiasHeldByCurrentThread()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return m_fReadBiasAllowed && FindReadBiasHold(this) >= 0;
+}
+#endif //_DEBUG
 
 BOOL SimpleRWLock::TryEnterRead()
 {
@@ -24,6 +192,11 @@ BOOL SimpleRWLock::TryEnterRead()
         _ASSERTE (RWLock >= 0);
     } while( RWLock != InterlockedCompareExchange( &m_RWLock, RWLock+1, RWLock ));
 
+    if (m_fReadBiasAllowed)
+    {
+        MaybeEnableReadBias();
+    }
+
     EE_LOCK_TAKEN(this);
 
 #ifdef _DEBUG
@@ -50,6 +223,15 @@ void SimpleRWLock::EnterRead()
     PreEnter();
 #endif //_DEBUG
 
+    if (m_fReadBias && TryEnterReadBiased())
+    {
+        EE_LOCK_TAKEN(this);
+#ifdef _DEBUG
+        PostEnter();
+#endif //_DEBUG
+        return;
+    }
+
     DWORD dwSwitchCount = 0;
 
     while (TRUE)
@@ -113,6 +295,11 @@ BOOL SimpleRWLock::TryEnterWrite()
         return FALSE;
     }
 
+    if (m_fReadBias)
+    {
+        RevokeReadBias();
+    }
+
     EE_LOCK_TAKEN(this);
 
 #ifdef _DEBUG
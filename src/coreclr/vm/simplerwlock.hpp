@@ -79,6 +79,11 @@ private:
 
     BOOL TryEnterWrite();
 
+    BOOL TryEnterReadBiased();
+    BOOL TryLeaveReadBiased();
+    void RevokeReadBias();
+    void MaybeEnableReadBias();
+
 #ifdef ENABLE_CONTRACTS_IMPL
     void CheckGCNoTrigger();
 #endif  //ENABLE_CONTRACTS_IMPL
@@ -97,6 +102,14 @@ private:
     // are supposed to be rare.
     BOOL                m_WriterWaiting;
 
+    // Read-biased locks let readers announce themselves in a global table instead of incrementing
+    // m_RWLock, so that readers on different cores do not contend on its cache line. A writer clears
+    // m_fReadBias and waits for the announced readers to leave; the bias is then suspended for a while
+    // proportional to how long that took, so that locks that see regular writes fall back to m_RWLock.
+    BOOL                m_fReadBiasAllowed;
+    Volatile<BOOL>      m_fReadBias;
+    INT64               m_inhibitReadBiasUntil;
+
 #ifdef _DEBUG
     // Check for dead lock situation.
     Volatile<LONG>      m_countNoTriggerGC;
@@ -138,7 +151,9 @@ private:
 #endif // DACCESS_COMPILE
 
 public:
-    SimpleRWLock (GC_MODE gcMode, LOCK_TYPE locktype)
+    // fReadBiased should only be set for locks that are mostly taken for reading, and that are
+    // always released on the thread that acquired them.
+    SimpleRWLock (GC_MODE gcMode, LOCK_TYPE locktype, BOOL fReadBiased = FALSE)
         : m_gcMode (gcMode)
     {
         CONTRACTL {
@@ -149,6 +164,9 @@ public:
         m_RWLock = 0;
         m_spinCount = (GetCurrentProcessCpuCount() == 1) ? 0 : 4000;
         m_WriterWaiting = FALSE;
+        m_fReadBiasAllowed = fReadBiased;
+        m_fReadBias = FALSE;
+        m_inhibitReadBiasUntil = 0;
 
 #ifdef _DEBUG
         m_countNoTriggerGC = 0;
@@ -161,6 +179,8 @@ public:
     {
         LIMITED_METHOD_CONTRACT;
 
+        m_fReadBiasAllowed = FALSE;
+
 #ifdef _DEBUG
         m_countNoTriggerGC = 0;
 #endif //_DEBUG
@@ -180,6 +200,11 @@ public:
 #ifdef _DEBUG
         PreLeave ();
 #endif //_DEBUG
+        if (m_fReadBiasAllowed && TryLeaveReadBiased())
+        {
+            EE_LOCK_RELEASED(this);
+            return;
+        }
         LONG RWLock;
         RWLock = InterlockedDecrement(&m_RWLock);
         _ASSERTE (RWLock >= 0);
@@ -204,17 +229,20 @@ public:
     typedef DacHolder<SimpleRWLock *, SimpleRWLock::AcquireReadLock, SimpleRWLock::ReleaseReadLock> SimpleReadLockHolder;
     typedef DacHolder<SimpleRWLock *, SimpleRWLock::AcquireWriteLock, SimpleRWLock::ReleaseWriteLock> SimpleWriteLockHolder;
 
-#ifdef _DEBUG
+#if defined(_DEBUG) && !defined(DACCESS_COMPILE)
+    // Readers that took the read-biased path are only visible to the thread that holds the lock.
+    BOOL IsReadBiasHeldByCurrentThread();
+
     BOOL LockTaken ()
     {
         LIMITED_METHOD_CONTRACT;
-        return m_RWLock != 0;
+        return m_RWLock != 0 || IsReadBiasHeldByCurrentThread();
     }
 
     BOOL IsReaderLock ()
     {
         LIMITED_METHOD_CONTRACT;
-        return m_RWLock > 0;
+        return m_RWLock > 0 || IsReadBiasHeldByCurrentThread();
     }
 
 #endif
@@ -2855,7 +2855,12 @@ void StackFrameIterator::ProcessIp(PCODE Ip)
     } CONTRACTL_END;
 
     // Re-initialize codeInfo with new IP
-    m_crawl.codeInfo.Init(Ip, m_scanFlag);
+#if defined(FEATURE_EH_FUNCLETS) && !defined(DACCESS_COMPILE)
+    if (m_flags & CACHE_CODE_LOOKUPS)
+        m_crawl.codeInfo.InitCached(Ip, m_scanFlag);
+    else
+#endif // FEATURE_EH_FUNCLETS && !DACCESS_COMPILE
+        m_crawl.codeInfo.Init(Ip, m_scanFlag);
 
     m_crawl.isFrameless = !!m_crawl.codeInfo.IsValid();
 } // StackFrameIterator::ProcessIp()
@@ -0,0 +1,110 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+#include "startupcheckpoints.h"
+#include "eventpipeadapter.h"
+
+namespace
+{
+    struct Checkpoint
+    {
+        char Name[64];
+        int64_t Timestamp;
+    };
+
+    // The host records about ten checkpoints and EE startup a few more. Any beyond this are dropped.
+    const LONG MaxBufferedCheckpoints = 32;
+
+    Checkpoint s_checkpoints[MaxBufferedCheckpoints];
+    LONG s_checkpointCount = 0;
+    bool s_published = false;
+
+    void FireCheckpointEvent(const char* name, int64_t timestamp)
+    {
+        STATIC_CONTRACT_NOTHROW;
+
+        if (!ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, ExecutionCheckpoint))
+            return;
+
+        MAKE_WIDEPTR_FROMUTF8_NOTHROW(nameW, name);
+        if (nameW != NULL)
+            FireEtwExecutionCheckpoint(GetClrInstanceId(), nameW, timestamp);
+    }
+}
+
+void StartupCheckpoints::Record(_In_z_ const char* name)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    LARGE_INTEGER timestamp;
+    QueryPerformanceCounter(&timestamp);
+    Record(name, timestamp.QuadPart);
+}
+
+void StartupCheckpoints::Record(_In_z_ const char* name, int64_t timestamp)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    if (VolatileLoad(&s_published))
+    {
+#ifdef FEATURE_PERFTRACING
+        EventPipeAdapter::AddRundownExecutionCheckpoint(name, timestamp);
+#endif // FEATURE_PERFTRACING
+        FireCheckpointEvent(name, timestamp);
+        return;
+    }
+
+    LONG index = InterlockedIncrement(&s_checkpointCount) - 1;
+    if (index < MaxBufferedCheckpoints)
+    {
+        strncpy_s(s_checkpoints[index].Name, ARRAY_SIZE(s_checkpoints[index].Name), name, _TRUNCATE);
+        s_checkpoints[index].Timestamp = timestamp;
+    }
+}
+
+void StartupCheckpoints::RecordHostCheckpoints(_In_z_ const char* serialized)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    char name[ARRAY_SIZE(s_checkpoints[0].Name)];
+    const char* entry = serialized;
+    while (*entry != '\0')
+    {
+        const char* separator = strchr(entry, '=');
+        if (separator == NULL)
+            break;
+
+        int64_t timestamp = 0;
+        const char* digit = separator + 1;
+        for (; *digit >= '0' && *digit <= '9'; digit++)
+            timestamp = timestamp * 10 + (*digit - '0');
+
+        size_t nameLength = min((size_t)(separator - entry), ARRAY_SIZE(name) - 1);
+        memcpy(name, entry, nameLength);
+        name[nameLength] = '\0';
+        Record(name, timestamp);
+
+        entry = digit;
+        if (*entry != ';')
+            break;
+        entry++;
+    }
+}
+
+void StartupCheckpoints::Publish()
+{
+    STATIC_CONTRACT_NOTHROW;
+    _ASSERTE(!s_published);
+
+    LONG count = min(VolatileLoad(&s_checkpointCount), MaxBufferedCheckpoints);
+    for (LONG i = 0; i < count; i++)
+    {
+#ifdef FEATURE_PERFTRACING
+        EventPipeAdapter::AddRundownExecutionCheckpoint(s_checkpoints[i].Name, s_checkpoints[i].Timestamp);
+#endif // FEATURE_PERFTRACING
+        FireCheckpointEvent(s_checkpoints[i].Name, s_checkpoints[i].Timestamp);
+    }
+
+    VolatileStore(&s_published, true);
+}
@@ -0,0 +1,30 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef _STARTUPCHECKPOINTS_H_
+#define _STARTUPCHECKPOINTS_H_
+
+// Startup checkpoints build the timeline of startup from the host to Main. Each is a name and a
+// QueryPerformanceCounter timestamp, which is the clock EventPipe timestamps events with.
+//
+// EventPipe is only initialized part way through EE startup, so the checkpoints reached before that
+// (including the ones the host passes in the HOST_STARTUP_CHECKPOINTS property) are buffered and handed
+// to EventPipe by Publish. EventPipe reports all of them as ExecutionCheckpointDCEnd events in the rundown
+// of every session, so the timeline is available to a session started well after startup. Each checkpoint
+// is also fired as a live ExecutionCheckpoint event for sessions that are already listening.
+class StartupCheckpoints
+{
+public:
+    // The name is copied
+    static void Record(_In_z_ const char* name);
+    static void Record(_In_z_ const char* name, int64_t timestamp);
+
+    // Records the checkpoints serialized by the host as "<name>=<timestamp>;..."
+    static void RecordHostCheckpoints(_In_z_ const char* serialized);
+
+    // Hands the buffered checkpoints to EventPipe, checkpoints recorded afterwards are added directly.
+    // Called during EE startup, while no other thread records checkpoints.
+    static void Publish();
+};
+
+#endif // _STARTUPCHECKPOINTS_H_
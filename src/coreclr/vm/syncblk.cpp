@@ -1596,15 +1596,19 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // Spin only as long as spinning has recently been paying off for this lock
+            const DWORD lockSpinCount = min(spinCount, awareLock->GetSpinCount());
+            bool stoppedSpinningEarly = false;
+
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < lockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= lockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1613,10 +1617,12 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->UpdateSpinCount(true /* spinSucceeded */);
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
                     {
+                        stoppedSpinningEarly = true;
                         break;
                     }
                 }
@@ -1624,8 +1630,15 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
 
             if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
             {
+                awareLock->UpdateSpinCount(true /* spinSucceeded */);
                 return AwareLock::EnterHelperResult_Entered;
             }
+
+            // When spinning was stopped to let waiters make progress, the spin did not fail on its own merits
+            if (!stoppedSpinningEarly)
+            {
+                awareLock->UpdateSpinCount(false /* spinSucceeded */);
+            }
             break;
         }
 
@@ -2540,6 +2553,15 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
 
     LogContention();
     Thread::IncrementMonitorLockContentionCount(pCurThread);
+    DWORD contentionCount = (DWORD)InterlockedIncrement((LONG *)&m_contentionCount);
+
+    // Only record contention on a given lock at power-of-two counts to keep the stress log
+    // volume bounded on hot locks.
+    if ((contentionCount & (contentionCount - 1)) == 0)
+    {
+        STRESS_LOG3(LF_SYNC, LL_INFO10, "Contention: lock %p held by OS thread %x, contention count %u\n",
+            this, m_HoldingOSThreadId, contentionCount);
+    }
 
     OBJECTREF obj = GetOwningObject();
 
@@ -2639,7 +2661,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
             {
                 bool acquiredLock = false;
                 YieldProcessorNormalizationInfo normalizationInfo;
-                const DWORD spinCount = g_SpinConstants.dwMonitorSpinCount;
+                const DWORD spinCount = GetSpinCount();
                 for (DWORD spinIteration = 0; spinIteration < spinCount; ++spinIteration)
                 {
                     if (m_lockState.InterlockedTry_LockAndUnregisterWaiterAndObserveWakeSignal(this))
@@ -2698,8 +2720,14 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
 
         double elapsedTimeInNanosecond = ComputeElapsedTimeInNanosecond(startTicks, endTicks);
 
-        // Fire a contention end event for a managed contention
-        FireEtwContentionStop_V1(ETW::ContentionLog::ContentionStructs::ManagedContention, GetClrInstanceId(), elapsedTimeInNanosecond);
+        // Fire a contention end event for a managed contention, along with the contention statistics of this lock
+        FireEtwContentionStop_V2(
+            ETW::ContentionLog::ContentionStructs::ManagedContention,
+            GetClrInstanceId(),
+            elapsedTimeInNanosecond,
+            this,
+            contentionCount,
+            GetSpinCount());
     }
 
 
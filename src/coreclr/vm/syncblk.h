@@ -450,8 +450,19 @@ private:
     DWORD m_waiterStarvationStartTimeMs;
     int m_emittedLockCreatedEvent;
 
+    // Maximum number of spin iterations for this lock, adapted to how often spinning has recently been successful. See
+    // UpdateSpinCount().
+    DWORD m_spinCount;
+
+    // Number of times a thread had to wait for this lock, reported with the ContentionStop event
+    DWORD m_contentionCount;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
 
+    // Adaptive spin count adjustments
+    static const DWORD MinimumSpinCount = 2;
+    static const DWORD SpinCountIncrementOnSuccess = 2;
+
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
         : m_Recursion(0),
@@ -463,7 +474,9 @@ private:
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
           m_waiterStarvationStartTimeMs(0),
-          m_emittedLockCreatedEvent(0)
+          m_emittedLockCreatedEvent(0),
+          m_spinCount(g_SpinConstants.dwMonitorSpinCount),
+          m_contentionCount(0)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -528,6 +541,10 @@ private:
     void RecordWaiterStarvationStartTime();
     bool ShouldStopPreemptingWaiters() const;
 
+public:
+    DWORD GetSpinCount() const;
+    void UpdateSpinCount(bool spinSucceeded);
+
 private: // friend access is required for this unsafe function
     void InitializeToLockedWithNoWaiters(ULONG recursionLevel, PTR_Thread holdingThread, SIZE_T holdingOSThreadId)
     {
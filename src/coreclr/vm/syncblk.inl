@@ -453,11 +453,55 @@ FORCEINLINE bool AwareLock::ShouldStopPreemptingWaiters() const
 
     // If the recorded time is zero, a time has not been recorded yet
     DWORD waiterStarvationStartTimeMs = m_waiterStarvationStartTimeMs;
+    if (waiterStarvationStartTimeMs == 0)
+    {
+        return false;
+    }
+
+    // In the fair handoff mode, waiters are never preempted. The lock is handed off to the waiters in FIFO order (the order
+    // in which the event releases them) at the cost of a context switch on each contended release.
     return
-        waiterStarvationStartTimeMs != 0 &&
+        g_pConfig->MonitorFairHandoff() ||
         GetTickCount() - waiterStarvationStartTimeMs >= WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters;
 }
 
+FORCEINLINE DWORD AwareLock::GetSpinCount() const
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DWORD spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    _ASSERTE(spinCount <= g_SpinConstants.dwMonitorSpinCount);
+    return spinCount;
+}
+
+FORCEINLINE void AwareLock::UpdateSpinCount(bool spinSucceeded)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // Locks that are held only briefly are usually acquired while spinning, so the spin duration is allowed to grow back to
+    // the configured maximum for them. Locks that are held for longer than a spin duration (or whose owner is not running)
+    // make spinners fall through to waiting, wasting the whole spin. For those, the spin duration is quickly reduced, but
+    // not to zero, so that a change back to brief hold times can still be detected. The updates are racy, which is fine for
+    // a heuristic.
+    DWORD spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    DWORD maxSpinCount = g_SpinConstants.dwMonitorSpinCount;
+    if (spinSucceeded)
+    {
+        if (spinCount < maxSpinCount)
+        {
+            VolatileStoreWithoutBarrier(&m_spinCount, min(spinCount + SpinCountIncrementOnSuccess, maxSpinCount));
+        }
+    }
+    else
+    {
+        DWORD minSpinCount = min(MinimumSpinCount, maxSpinCount);
+        if (spinCount > minSpinCount)
+        {
+            VolatileStoreWithoutBarrier(&m_spinCount, max(spinCount / 2, minSpinCount));
+        }
+    }
+}
+
 FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration)
 {
     WRAPPER_NO_CONTRACT;
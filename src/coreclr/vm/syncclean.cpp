@@ -7,6 +7,7 @@
 #include "syncclean.hpp"
 #include "virtualcallstub.h"
 #include "threadsuspend.h"
+#include "interoplibinterface.h"
 
 VolatilePtr<Bucket> SyncClean::m_HashMap = NULL;
 VolatilePtr<EEHashEntry*> SyncClean::m_EEHashTable;
@@ -95,4 +96,7 @@ void SyncClean::CleanUp ()
 
     // Give others we want to reclaim during the GC sync point a chance to do it
     VirtualCallStubManager::ReclaimAll();
+#ifdef FEATURE_COMWRAPPERS
+    ComWrappersNative::ReclaimAll();
+#endif // FEATURE_COMWRAPPERS
 }
@@ -1527,12 +1527,16 @@ Thread::Thread()
 
 #ifdef FEATURE_PERFTRACING
     memset(&m_activityId, 0, sizeof(m_activityId));
+    m_sampleProfilerLastCpuTime = 0;
+    m_sampleProfilerHwCounters = NULL;
+    m_sampleProfilerHwCountersUnavailable = false;
 #endif // FEATURE_PERFTRACING
     m_HijackReturnKind = RT_Illegal;
 
     m_currentPrepareCodeConfig = nullptr;
     m_isInForbidSuspendForDebuggerRegion = false;
     m_hasPendingActivation = false;
+    m_lastSuspensionSampleIP = 0;
 
     m_ThreadLocalDataPtr = NULL;
 
@@ -2503,6 +2507,10 @@ Thread::~Thread()
 
     m_tailCallTls.FreeArgBuffer();
 
+#ifdef FEATURE_PERFTRACING
+    CloseSampleProfilerHardwareCounters();
+#endif // FEATURE_PERFTRACING
+
 #ifdef FEATURE_EVENT_TRACE
     // Destruct the thread local type cache for allocation sampling
     if(m_pAllLoggedTypes) {
@@ -2514,6 +2522,54 @@ Thread::~Thread()
     CrstHolder lock(&g_DeadlockAwareCrst);
 }
 
+#ifdef FEATURE_PERFTRACING
+bool Thread::GetHardwareCountersSinceLastSample(uint64_t* counts)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_sampleProfilerHwCountersUnavailable || IsUnstarted() || IsDead())
+        return false;
+
+    if (m_sampleProfilerHwCounters == NULL)
+    {
+        m_sampleProfilerHwCounters = minipal_thread_hw_counters_open(GetOSThreadId64());
+        if (m_sampleProfilerHwCounters == NULL)
+        {
+            m_sampleProfilerHwCountersUnavailable = true;
+            return false;
+        }
+
+        // Counting starts now, the next sample gets the counts since this one.
+        if (!minipal_thread_hw_counters_read(m_sampleProfilerHwCounters, m_sampleProfilerLastHwCounterValues))
+            memset(m_sampleProfilerLastHwCounterValues, 0, sizeof(m_sampleProfilerLastHwCounterValues));
+
+        return false;
+    }
+
+    uint64_t values[minipal_hw_counter_count];
+    if (!minipal_thread_hw_counters_read(m_sampleProfilerHwCounters, values))
+        return false;
+
+    for (int i = 0; i < minipal_hw_counter_count; i++)
+    {
+        // Scaling for multiplexing can make a count a little lower than the previous one.
+        counts[i] = values[i] > m_sampleProfilerLastHwCounterValues[i] ? values[i] - m_sampleProfilerLastHwCounterValues[i] : 0;
+        m_sampleProfilerLastHwCounterValues[i] = values[i];
+    }
+
+    return true;
+}
+
+void Thread::CloseSampleProfilerHardwareCounters()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    minipal_thread_hw_counters_close(m_sampleProfilerHwCounters);
+    m_sampleProfilerHwCounters = NULL;
+    m_sampleProfilerHwCountersUnavailable = false;
+}
+#endif // FEATURE_PERFTRACING
+
 #ifdef FEATURE_COMINTEROP_APARTMENT_SUPPORT
 
 void Thread::BaseCoUninitialize()
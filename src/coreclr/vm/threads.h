@@ -155,6 +155,7 @@ typedef void(*ADCallBackFcnType)(LPVOID);
 
 #ifdef FEATURE_PERFTRACING
 #include "eventpipeadaptertypes.h"
+#include <minipal/hwcounters.h>
 #endif // FEATURE_PERFTRACING
 
 #include "threadstatics.h"
@@ -445,6 +446,15 @@ struct RuntimeThreadLocals
     // on MP systems, each thread has its own allocation chunk so we can avoid
     // lock prefixes and expensive MP cache snooping stuff
     gc_alloc_context alloc_context;
+
+#ifdef FEATURE_EVENT_TRACE
+    // See code:AllocationSampling. The number of bytes allocated by alloc_context at which the next
+    // sample is taken (0 until the thread takes part in sampling), the state of the random number
+    // generator that spaces the samples, and the sampled object until it is initialized.
+    int64_t alloc_sampling_next;
+    uint64_t alloc_sampling_random;
+    Object* alloc_sampling_pending;
+#endif // FEATURE_EVENT_TRACE
 };
 
 #ifdef _MSC_VER
@@ -2266,6 +2276,10 @@ public:
 
     #define UNWIND_FLOATS 0x20000
 
+    // Resolve code addresses through the per-thread cache of code lookups (see EECodeInfo::InitCached).
+    // Used by managed exception dispatch, which walks the same frames for every exception.
+    #define CACHE_CODE_LOOKUPS 0x40000
+
     StackWalkAction StackWalkFramesEx(
                         PREGDISPLAY pRD,        // virtual register set at crawl start
                         PSTACKWALKFRAMESCALLBACK pCallback,
@@ -3789,6 +3803,16 @@ private:
     // True if the thread was in cooperative mode.  False if it was in preemptive when the suspension started.
     Volatile<ULONG> m_gcModeOnSuspension;
 
+    // SampleProfiler CPU time of the thread when it was last sampled, only tracked with DOTNET_EventPipeSampleCpuTimeOnly.
+    // The unit is platform specific (cycles on Windows, nanoseconds elsewhere), it is only compared for changes.
+    ULONG64 m_sampleProfilerLastCpuTime;
+
+    // SampleProfiler hardware counters of the thread and their values when it was last sampled. Only opened while
+    // the hardware counters keyword of the SampleProfiler provider is enabled, and only accessed by the sampling thread.
+    minipal_thread_hw_counters* m_sampleProfilerHwCounters;
+    uint64_t m_sampleProfilerLastHwCounterValues[minipal_hw_counter_count];
+    bool m_sampleProfilerHwCountersUnavailable;
+
     // The activity ID for the current thread.
     // An activity ID of zero means the thread is not executing in the context of an activity.
     GUID m_activityId;
@@ -3811,6 +3835,37 @@ public:
         m_gcModeOnSuspension = 0;
     }
 
+    // Only called by the SampleProfiler while the runtime is suspended.
+    // Returns true if the thread consumed CPU time since the previous call, or if that can't be determined.
+    bool ConsumedCpuTimeSinceLastSample()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // Unstarted and dead threads have no stack to sample.
+        if (IsUnstarted() || IsDead())
+            return false;
+
+        HANDLE threadHandle = GetThreadHandle();
+        if (threadHandle == INVALID_HANDLE_VALUE || threadHandle == NULL)
+            return true;
+
+        ULONG64 cpuTime;
+        if (!QueryThreadCycleTime(threadHandle, &cpuTime))
+            return true;
+
+        bool consumed = cpuTime != m_sampleProfilerLastCpuTime;
+        m_sampleProfilerLastCpuTime = cpuTime;
+        return consumed;
+    }
+
+    // Only called by the SampleProfiler while the runtime is suspended.
+    // Gets the hardware counts of the thread since the previous call. Returns false if there are none: the first
+    // call only opens the counters, and if they are not available for the thread they are not tried again.
+    bool GetHardwareCountersSinceLastSample(uint64_t* counts);
+
+    // Stops counting, called when the hardware counters keyword is disabled and when the thread is destroyed.
+    void CloseSampleProfilerHardwareCounters();
+
     LPCGUID GetActivityId() const
     {
         LIMITED_METHOD_CONTRACT;
@@ -3965,6 +4020,10 @@ private:
 private:
     bool m_hasPendingActivation;
 
+    // IP the thread was last seen at in cooperative mode while the runtime was trying to bring it
+    // to a safe point for suspension. Used to report the thread that delayed a suspension the most.
+    PCODE m_lastSuspensionSampleIP;
+
     template<typename T> friend struct ::cdac_data;
 };
 
@@ -21,6 +21,9 @@
 bool ThreadSuspend::s_fSuspendRuntimeInProgress = false;
 
 bool ThreadSuspend::s_fSuspended = false;
+uint32_t ThreadSuspend::s_suspendHijackPassCount = 0;
+uint64_t ThreadSuspend::s_suspendSlowestThreadId = 0;
+PCODE ThreadSuspend::s_suspendSlowestThreadIP = 0;
 
 ThreadSuspend::SUSPEND_REASON ThreadSuspend::m_suspendReason;
 
@@ -3346,9 +3349,17 @@ void ThreadSuspend::SuspendAllThreads()
     uint32_t rehijackDelay = 8;
     uint32_t usecsSinceYield = 0;
 
+    // The last thread to reach a safe point is the one that delayed the suspension the most.
+    // It cannot go away while the thread store lock is held.
+    Thread* pSlowestThread = NULL;
+    s_suspendHijackPassCount = 0;
+    s_suspendSlowestThreadId = 0;
+    s_suspendSlowestThreadIP = 0;
+
     while(true)
     {
         int remaining = 0;
+        Thread* pLastRemainingThread = NULL;
         Thread* pTargetThread = NULL;
         while ((pTargetThread = ThreadStore::GetThreadList(pTargetThread)) != NULL)
         {
@@ -3358,6 +3369,12 @@ void ThreadSuspend::SuspendAllThreads()
             if (pTargetThread->m_fPreemptiveGCDisabled.LoadWithoutBarrier())
             {
                 remaining++;
+                pLastRemainingThread = pTargetThread;
+                if (prevRemaining == INT32_MAX)
+                {
+                    // Forget the IP sampled during a previous suspension
+                    pTargetThread->m_lastSuspensionSampleIP = 0;
+                }
                 if (!observeOnly)
                 {
                     pTargetThread->Hijack();
@@ -3365,9 +3382,14 @@ void ThreadSuspend::SuspendAllThreads()
             }
         }
 
+        if (!observeOnly)
+            s_suspendHijackPassCount++;
+
         if (remaining == 0)
             break;
 
+        pSlowestThread = pLastRemainingThread;
+
         // if we see progress or have just done a hijacking pass
         // do not hijack in the next iteration
         if (remaining < prevRemaining || !observeOnly)
@@ -3413,6 +3435,21 @@ void ThreadSuspend::SuspendAllThreads()
     ::FlushProcessWriteBuffers();
 #endif //TARGET_ARM || TARGET_ARM64
 
+    if (pSlowestThread != NULL)
+    {
+        // The IP is only sampled when the thread had to be hijacked or redirected, threads that
+        // reached a safe point on their own (for example, by polling) are reported without one.
+        s_suspendSlowestThreadId = pSlowestThread->GetOSThreadId64();
+        s_suspendSlowestThreadIP = s_suspendHijackPassCount != 0 ? pSlowestThread->m_lastSuspensionSampleIP : 0;
+        pSlowestThread->m_lastSuspensionSampleIP = 0;
+
+        if (s_suspendHijackPassCount != 0)
+        {
+            STRESS_LOG3(LF_SYNC, LL_INFO100, "Thread::SuspendAllThreads() - slowest thread %p at IP %p after %u hijack passes\n",
+                pSlowestThread, s_suspendSlowestThreadIP, s_suspendHijackPassCount);
+        }
+    }
+
     STRESS_LOG0(LF_SYNC, LL_INFO1000, "Thread::SuspendAllThreads() - Success\n");
 }
 
@@ -5258,6 +5295,7 @@ BOOL Thread::HandledJITCase()
     }
 
     PCODE ip = GetIP(&ctx);
+    m_lastSuspensionSampleIP = ip;
     if (!ExecutionManager::IsManagedCode(ip))
     {
         return FALSE;
@@ -5498,6 +5536,7 @@ void ThreadSuspend::RestartEE(BOOL bFinishedGC, BOOL SuspendSucceeded)
     }
 
     FireEtwGCRestartEEEnd_V1(GetClrInstanceId());
+    STRESS_LOG0(LF_SYNC, LL_INFO10, "RestartEE: runtime resumed\n");
 
 #ifdef TIME_SUSPEND
     g_SuspendStatistics.EndRestart();
@@ -5718,7 +5757,9 @@ retry_for_debugger:
 
     GC_ON_TRANSITIONS(gcOnTransitions);
 
-    FireEtwGCSuspendEEEnd_V1(GetClrInstanceId());
+    FireEtwGCSuspendEEEnd_V2(GetClrInstanceId(), s_suspendHijackPassCount, s_suspendSlowestThreadId, (void*)s_suspendSlowestThreadIP);
+    STRESS_LOG3(LF_SYNC, LL_INFO10, "SuspendEE: runtime suspended for reason %d after %u hijack passes, slowest thread %x\n",
+        reason, s_suspendHijackPassCount, s_suspendSlowestThreadId);
 
 #ifdef TIME_SUSPEND
     g_SuspendStatistics.EndSuspend(reason == SUSPEND_FOR_GC || reason == SUSPEND_FOR_GC_PREP);
@@ -5782,6 +5823,7 @@ void HandleSuspensionForInterruptedThread(CONTEXT *interruptedContext)
         return;
 
     PCODE ip = GetIP(interruptedContext);
+    pThread->m_lastSuspensionSampleIP = ip;
 
     // This function can only be called when the interrupted thread is in
     // an activation safe point.
@@ -223,6 +223,12 @@ private:
 
     static bool     s_fSuspended;
 
+    // Diagnostics of the last completed suspension, reported through the GCSuspendEEEnd event.
+    // Only accessed by the suspending thread while it holds the thread store lock.
+    static uint32_t s_suspendHijackPassCount;   // number of passes that had to hijack or redirect threads
+    static uint64_t s_suspendSlowestThreadId;   // OS thread id of the last thread to reach a safe point
+    static PCODE    s_suspendSlowestThreadIP;   // last IP sampled for that thread, 0 if unknown
+
     static void SetSuspendRuntimeInProgress();
     static void ResetSuspendRuntimeInProgress();
 
@@ -29,7 +29,9 @@
 //
 // Methods initially call into HandleCallCountingForFirstCall() and once the call count exceeds
 // a fixed limit we queue work on to our internal list of methods needing to
-// be recompiled (m_methodsToOptimize). If there is currently no thread
+// be recompiled (m_methodsToOptimize). The list is a priority queue that hands out
+// the methods that reached the call count limit in the shortest time first, so that
+// the hottest methods don't wait behind many lukewarm ones. If there is currently no thread
 // servicing our queue asynchronously then we use the runtime threadpool
 // QueueUserWorkItem to recruit one. During the callback for each threadpool work
 // item we handle as many methods as possible in a fixed period of time, then
@@ -40,6 +42,19 @@
 // queue. For each method we jit it, then update the precode so that future
 // entrypoint callers will run the new code.
 //
+// When TC_LargeMethodILSize is set, methods with at least that much IL are handed
+// off to a second worker (m_largeMethodsToOptimize) instead, so that rejitting one
+// very large method doesn't hold up all of the smaller methods queued behind it.
+// That worker only jits and activates code; call counting completion and the
+// tiering delay stay with the main background worker.
+//
+// When TC_BackgroundWorkerCount is greater than one, the main background worker also
+// starts additional workers while the queue holds more methods than there are workers
+// to pick them up. Like the large method worker, these only jit and activate code from
+// m_methodsToOptimize, in the same priority order. Altogether they are
+// limited to half of the processors available to the process, so that the rest remain
+// available to foreground work during startup.
+//
 // # Error handling
 //
 // The overall principle is don't swallow terminal failures that may have corrupted the
@@ -58,10 +73,17 @@ Thread *TieredCompilationManager::s_backgroundWorkerThread = nullptr;
 CLREventStatic TieredCompilationManager::s_backgroundWorkAvailableEvent;
 bool TieredCompilationManager::s_isBackgroundWorkerRunning = false;
 bool TieredCompilationManager::s_isBackgroundWorkerProcessingWork = false;
+CLREventStatic TieredCompilationManager::s_largeMethodWorkAvailableEvent;
+bool TieredCompilationManager::s_isLargeMethodWorkerRunning = false;
+CLREventStatic TieredCompilationManager::s_additionalWorkAvailableEvent;
+UINT32 TieredCompilationManager::s_countOfAdditionalWorkersRunning = 0;
+UINT32 TieredCompilationManager::s_countOfAdditionalWorkersWaiting = 0;
 
 // Called at AppDomain construction
 TieredCompilationManager::TieredCompilationManager() :
     m_countOfMethodsToOptimize(0),
+    m_nextMethodToOptimizeSequenceNumber(0),
+    m_countOfLargeMethodsToOptimize(0),
     m_countOfNewMethodsCalledDuringDelay(0),
     m_methodsPendingCountingForTier1(nullptr),
     m_tier1CallCountingCandidateMethodRecentlyRecorded(false),
@@ -119,6 +141,13 @@ NativeCodeVersion::OptimizationTier TieredCompilationManager::GetInitialOptimiza
         {
             return NativeCodeVersion::OptimizationTier0;
         }
+#ifndef DACCESS_COMPILE
+        // No need to instrument methods that already have data loaded from a previous run
+        if (PgoManager::HasLoadedPgoData(pMethodDesc))
+        {
+            return NativeCodeVersion::OptimizationTier0;
+        }
+#endif
         return NativeCodeVersion::OptimizationTier0Instrumented;
     }
 #endif
@@ -250,7 +279,8 @@ bool TieredCompilationManager::TrySetCodeEntryPointAndRecordMethodForCallCountin
 
 void TieredCompilationManager::AsyncPromoteToTier1(
     NativeCodeVersion currentNativeCodeVersion,
-    bool *createTieringBackgroundWorkerRef)
+    bool *createTieringBackgroundWorkerRef,
+    UINT64 callCountingDurationTicks)
 {
     CONTRACTL
     {
@@ -279,7 +309,8 @@ void TieredCompilationManager::AsyncPromoteToTier1(
     NativeCodeVersion::OptimizationTier nextTier = NativeCodeVersion::OptimizationTier1;
 
 #ifdef FEATURE_PGO
-    if (g_pConfig->TieredPGO())
+    // Methods with data loaded from a previous run go straight to tier1, which will use that data
+    if (g_pConfig->TieredPGO() && !PgoManager::HasLoadedPgoData(pMethodDesc))
     {
         if (currentNativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0 &&
             g_pConfig->TieredPGO_InstrumentOnlyHotCode())
@@ -324,12 +355,10 @@ void TieredCompilationManager::AsyncPromoteToTier1(
 
     // Insert the method into the optimization queue and trigger a thread to service
     // the queue if needed.
-    SListElem<NativeCodeVersion>* pMethodListItem = new SListElem<NativeCodeVersion>(t1NativeCodeVersion);
     {
         LockHolder tieredCompilationLockHolder;
 
-        m_methodsToOptimize.InsertTail(pMethodListItem);
-        ++m_countOfMethodsToOptimize;
+        InsertMethodToOptimize_Locked(t1NativeCodeVersion, callCountingDurationTicks);
 
         LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::AsyncPromoteToTier1 Method=0x%pM (%s::%s), code version id=0x%x queued\n",
             pMethodDesc, pMethodDesc->m_pszDebugClassName, pMethodDesc->m_pszDebugMethodName,
@@ -575,6 +604,498 @@ void TieredCompilationManager::BackgroundWorkerStart()
     }
 }
 
+// Moves a method with a large IL body over to the large method worker. Returns false if the method should just be optimized
+// on the current thread.
+bool TieredCompilationManager::TryQueueLargeMethodToOptimize(NativeCodeVersion nativeCodeVersion)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(GetThread() == s_backgroundWorkerThread);
+    _ASSERTE(!nativeCodeVersion.IsNull());
+
+    DWORD largeMethodILSize = g_pConfig->TieredCompilation_LargeMethodILSize();
+    if (largeMethodILSize == 0)
+    {
+        return false;
+    }
+
+    bool queued = false;
+    bool createLargeMethodWorker = false;
+    EX_TRY
+    {
+        PTR_COR_ILMETHOD pIL = nativeCodeVersion.GetILCodeVersion().GetIL();
+        if (pIL != NULL)
+        {
+            COR_ILMETHOD_DECODER header(pIL);
+            if (header.GetCodeSize() >= largeMethodILSize)
+            {
+                SListElem<NativeCodeVersion>* pMethodListItem = new SListElem<NativeCodeVersion>(nativeCodeVersion);
+
+                LockHolder tieredCompilationLockHolder;
+
+                m_largeMethodsToOptimize.InsertTail(pMethodListItem);
+                ++m_countOfLargeMethodsToOptimize;
+                queued = true;
+
+                if (s_isLargeMethodWorkerRunning)
+                {
+                    s_largeMethodWorkAvailableEvent.Set();
+                }
+                else
+                {
+                    s_isLargeMethodWorkerRunning = true;
+                    createLargeMethodWorker = true;
+                }
+
+                LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::TryQueueLargeMethodToOptimize Method=0x%pM, IL size=%u, code version id=0x%x queued\n",
+                    nativeCodeVersion.GetMethodDesc(), header.GetCodeSize(), nativeCodeVersion.GetVersionId()));
+            }
+        }
+    }
+    EX_CATCH
+    {
+        STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::TryQueueLargeMethodToOptimize: "
+            "Exception queuing large method, hr=0x%x\n",
+            GET_EXCEPTION()->GetHR());
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+
+    if (!createLargeMethodWorker)
+    {
+        return queued;
+    }
+
+    EX_TRY
+    {
+        CreateLargeMethodWorker();
+    }
+    EX_CATCH
+    {
+        STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::TryQueueLargeMethodToOptimize: "
+            "Exception in CreateLargeMethodWorker, hr=0x%x\n",
+            GET_EXCEPTION()->GetHR());
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+
+    LockHolder tieredCompilationLockHolder;
+
+    if (s_isLargeMethodWorkerRunning)
+    {
+        return true;
+    }
+
+    // The worker could not be created. Optimize the method that was just queued on this thread instead, and move anything
+    // else that was left in the queue (if a previous worker failed to start) back to the regular queue. Each retry consumes a
+    // method, so this can't keep failing without making progress.
+    SListElem<NativeCodeVersion>* pElem;
+    while ((pElem = m_largeMethodsToOptimize.RemoveHead()) != NULL)
+    {
+        _ASSERTE(m_countOfLargeMethodsToOptimize != 0);
+        --m_countOfLargeMethodsToOptimize;
+
+        NativeCodeVersion largeNativeCodeVersion = pElem->GetValue();
+        delete pElem;
+        if (largeNativeCodeVersion == nativeCodeVersion)
+        {
+            continue;
+        }
+
+        // The priority of the method is not tracked in the large method queue, so queue it after anything that is known to
+        // be hotter
+        EX_TRY
+        {
+            InsertMethodToOptimize_Locked(largeNativeCodeVersion, UINT64_MAX);
+        }
+        EX_CATCH
+        {
+            STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::TryQueueLargeMethodToOptimize: "
+                "Exception requeuing large method, hr=0x%x\n",
+                GET_EXCEPTION()->GetHR());
+        }
+        EX_END_CATCH(RethrowTerminalExceptions);
+    }
+    return false;
+}
+
+void TieredCompilationManager::CreateLargeMethodWorker()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(!IsLockOwnedByCurrentThread());
+    _ASSERTE(s_isLargeMethodWorkerRunning);
+
+    EX_TRY
+    {
+        if (!s_largeMethodWorkAvailableEvent.IsValid())
+        {
+            // Only the background worker creates the large method worker, so there is no race in creating the event
+            s_largeMethodWorkAvailableEvent.CreateAutoEvent(false);
+        }
+
+        Thread *newThread = SetupUnstartedThread();
+        _ASSERTE(newThread != nullptr);
+    #ifdef FEATURE_COMINTEROP
+        newThread->SetApartment(Thread::AS_InMTA);
+    #endif
+        newThread->SetBackground(true);
+
+        if (!newThread->CreateNewThread(0, LargeMethodWorkerBootstrapper0, newThread, W(".NET Tiered Compilation Large Method Worker")))
+        {
+            newThread->DecExternalCount(false);
+            ThrowOutOfMemory();
+        }
+
+        newThread->StartThread();
+    }
+    EX_CATCH
+    {
+        {
+            LockHolder tieredCompilationLockHolder;
+            s_isLargeMethodWorkerRunning = false;
+        }
+
+        EX_RETHROW;
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+}
+
+DWORD WINAPI TieredCompilationManager::LargeMethodWorkerBootstrapper0(LPVOID args)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != nullptr);
+    Thread *thread = (Thread *)args;
+
+    if (!thread->HasStarted())
+    {
+        // Methods left in the queue are picked up by the next worker, which is created the next time a large method is queued
+        LockHolder tieredCompilationLockHolder;
+        s_isLargeMethodWorkerRunning = false;
+        return 0;
+    }
+
+    _ASSERTE(GetThread() == thread);
+    ManagedThreadBase::KickOff(LargeMethodWorkerBootstrapper1, nullptr);
+
+    GCX_PREEMP_NO_DTOR();
+
+    DestroyThread(thread);
+    return 0;
+}
+
+void TieredCompilationManager::LargeMethodWorkerBootstrapper1(LPVOID)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    GCX_PREEMP();
+    GetAppDomain()->GetTieredCompilationManager()->LargeMethodWorkerStart();
+}
+
+void TieredCompilationManager::LargeMethodWorkerStart()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(s_largeMethodWorkAvailableEvent.IsValid());
+
+    DWORD timeoutMs = g_pConfig->TieredCompilation_BackgroundWorkerTimeoutMs();
+    DWORD delayMs = g_pConfig->TieredCompilation_CallCountingDelayMs();
+
+    while (true)
+    {
+        _ASSERTE(s_isLargeMethodWorkerRunning);
+
+        // Same as the background worker, don't jit at higher tiers while there is startup-like activity
+        if (IsTieringDelayActive())
+        {
+            ClrSleepEx(delayMs, false);
+            continue;
+        }
+
+        NativeCodeVersion nativeCodeVersionToOptimize;
+        {
+            LockHolder tieredCompilationLockHolder;
+            nativeCodeVersionToOptimize = GetNextLargeMethodToOptimize();
+        }
+
+        if (!nativeCodeVersionToOptimize.IsNull())
+        {
+            // Give preference to possibly more important work before each method, as these are expected to take a while
+            ClrSleepEx(0, false);
+            OptimizeMethod(nativeCodeVersionToOptimize);
+            continue;
+        }
+
+        DWORD waitResult = s_largeMethodWorkAvailableEvent.Wait(timeoutMs, false);
+        if (waitResult == WAIT_OBJECT_0)
+        {
+            continue;
+        }
+
+        LockHolder tieredCompilationLockHolder;
+
+        if (m_countOfLargeMethodsToOptimize != 0)
+        {
+            // A method was queued just as the wait timed out
+            s_largeMethodWorkAvailableEvent.Reset();
+            continue;
+        }
+
+        s_isLargeMethodWorkerRunning = false;
+        return;
+    }
+}
+
+// Wakes up or starts an additional worker if there is more work in the queue than the workers that are currently processing
+// it can keep up with. Only called from the main background worker.
+void TieredCompilationManager::TryScheduleAdditionalWorker()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(GetThread() == s_backgroundWorkerThread);
+
+    DWORD workerCount = g_pConfig->TieredCompilation_BackgroundWorkerCount();
+    if (workerCount <= 1)
+    {
+        return;
+    }
+
+    // Leave at least half of the processors to foreground work, the main background worker counts against that share too
+    int processorCount = GetCurrentProcessCpuCount();
+    _ASSERTE(processorCount > 0);
+    DWORD maxWorkerCount = min(workerCount, (DWORD)max(processorCount / 2, 1));
+    if (maxWorkerCount <= 1)
+    {
+        return;
+    }
+
+    {
+        LockHolder tieredCompilationLockHolder;
+
+        _ASSERTE(s_countOfAdditionalWorkersWaiting <= s_countOfAdditionalWorkersRunning);
+        UINT32 countOfBusyAdditionalWorkers = s_countOfAdditionalWorkersRunning - s_countOfAdditionalWorkersWaiting;
+        if (m_countOfMethodsToOptimize <= countOfBusyAdditionalWorkers)
+        {
+            return;
+        }
+
+        if (s_countOfAdditionalWorkersWaiting != 0)
+        {
+            s_additionalWorkAvailableEvent.Set();
+            return;
+        }
+
+        if (s_countOfAdditionalWorkersRunning >= maxWorkerCount - 1)
+        {
+            return;
+        }
+
+        ++s_countOfAdditionalWorkersRunning;
+    }
+
+    EX_TRY
+    {
+        CreateAdditionalWorker();
+    }
+    EX_CATCH
+    {
+        STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::TryScheduleAdditionalWorker: "
+            "Exception in CreateAdditionalWorker, hr=0x%x\n",
+            GET_EXCEPTION()->GetHR());
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+}
+
+void TieredCompilationManager::CreateAdditionalWorker()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(!IsLockOwnedByCurrentThread());
+    _ASSERTE(s_countOfAdditionalWorkersRunning != 0);
+
+    EX_TRY
+    {
+        if (!s_additionalWorkAvailableEvent.IsValid())
+        {
+            // Only the background worker creates additional workers, so there is no race in creating the event
+            s_additionalWorkAvailableEvent.CreateAutoEvent(false);
+        }
+
+        Thread *newThread = SetupUnstartedThread();
+        _ASSERTE(newThread != nullptr);
+    #ifdef FEATURE_COMINTEROP
+        newThread->SetApartment(Thread::AS_InMTA);
+    #endif
+        newThread->SetBackground(true);
+
+        if (!newThread->CreateNewThread(0, AdditionalWorkerBootstrapper0, newThread, W(".NET Tiered Compilation Additional Worker")))
+        {
+            newThread->DecExternalCount(false);
+            ThrowOutOfMemory();
+        }
+
+        newThread->StartThread();
+    }
+    EX_CATCH
+    {
+        {
+            LockHolder tieredCompilationLockHolder;
+            _ASSERTE(s_countOfAdditionalWorkersRunning != 0);
+            --s_countOfAdditionalWorkersRunning;
+        }
+
+        EX_RETHROW;
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+}
+
+DWORD WINAPI TieredCompilationManager::AdditionalWorkerBootstrapper0(LPVOID args)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != nullptr);
+    Thread *thread = (Thread *)args;
+
+    if (!thread->HasStarted())
+    {
+        LockHolder tieredCompilationLockHolder;
+        _ASSERTE(s_countOfAdditionalWorkersRunning != 0);
+        --s_countOfAdditionalWorkersRunning;
+        return 0;
+    }
+
+    _ASSERTE(GetThread() == thread);
+    ManagedThreadBase::KickOff(AdditionalWorkerBootstrapper1, nullptr);
+
+    GCX_PREEMP_NO_DTOR();
+
+    DestroyThread(thread);
+    return 0;
+}
+
+void TieredCompilationManager::AdditionalWorkerBootstrapper1(LPVOID)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    GCX_PREEMP();
+    GetAppDomain()->GetTieredCompilationManager()->AdditionalWorkerStart();
+}
+
+void TieredCompilationManager::AdditionalWorkerStart()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(s_additionalWorkAvailableEvent.IsValid());
+
+    DWORD timeoutMs = g_pConfig->TieredCompilation_BackgroundWorkerTimeoutMs();
+    DWORD delayMs = g_pConfig->TieredCompilation_CallCountingDelayMs();
+
+    while (true)
+    {
+        _ASSERTE(s_countOfAdditionalWorkersRunning != 0);
+
+        // Same as the background worker, don't jit at higher tiers while there is startup-like activity
+        if (IsTieringDelayActive())
+        {
+            ClrSleepEx(delayMs, false);
+            continue;
+        }
+
+        NativeCodeVersion nativeCodeVersionToOptimize;
+        {
+            LockHolder tieredCompilationLockHolder;
+            nativeCodeVersionToOptimize = GetNextMethodToOptimize();
+            if (nativeCodeVersionToOptimize.IsNull())
+            {
+                ++s_countOfAdditionalWorkersWaiting;
+            }
+        }
+
+        if (!nativeCodeVersionToOptimize.IsNull())
+        {
+            // Give preference to possibly more important work before each method
+            ClrSleepEx(0, false);
+            OptimizeMethod(nativeCodeVersionToOptimize);
+            continue;
+        }
+
+        DWORD waitResult = s_additionalWorkAvailableEvent.Wait(timeoutMs, false);
+
+        LockHolder tieredCompilationLockHolder;
+
+        _ASSERTE(s_countOfAdditionalWorkersWaiting != 0);
+        --s_countOfAdditionalWorkersWaiting;
+
+        if ((waitResult == WAIT_OBJECT_0) || (m_countOfMethodsToOptimize != 0))
+        {
+            continue;
+        }
+
+        _ASSERTE(s_countOfAdditionalWorkersRunning != 0);
+        --s_countOfAdditionalWorkersRunning;
+        return;
+    }
+}
+
 bool TieredCompilationManager::IsTieringDelayActive()
 {
     LIMITED_METHOD_CONTRACT;
@@ -745,6 +1266,9 @@ bool TieredCompilationManager::DoBackgroundWork(
     UINT64 startTicks = li.QuadPart;
     UINT64 previousTicks = startTicks;
 
+    // Code and precodes of the methods optimized in a batch are mostly written close to each other
+    ExecutableWriteSessionHolder writeSession;
+
     do
     {
         bool completeCallCounting = false;
@@ -817,6 +1341,13 @@ bool TieredCompilationManager::DoBackgroundWork(
             continue;
         }
 
+        if (TryQueueLargeMethodToOptimize(nativeCodeVersionToOptimize))
+        {
+            continue;
+        }
+
+        TryScheduleAdditionalWorker();
+
         OptimizeMethod(nativeCodeVersionToOptimize);
         ++jittedMethodCount;
 
@@ -849,6 +1380,9 @@ bool TieredCompilationManager::DoBackgroundWork(
             ETW::CompilationLog::TieredCompilation::Runtime::SendBackgroundJitStop(countOfMethodsToOptimize, jittedMethodCount);
         }
 
+        STRESS_LOG1(LF_TIEREDCOMPILATION, LL_INFO10, "TieredCompilationManager::DoBackgroundWork: "
+            "optimized %u methods, yielding\n", jittedMethodCount);
+
         UINT64 beforeSleepTicks = currentTicks;
         ClrSleepEx(0, false);
 
@@ -906,6 +1440,9 @@ bool TieredCompilationManager::DoBackgroundWork(
         ETW::CompilationLog::TieredCompilation::Runtime::SendBackgroundJitStop(countOfMethodsToOptimize, jittedMethodCount);
     }
 
+    STRESS_LOG2(LF_TIEREDCOMPILATION, LL_INFO10, "TieredCompilationManager::DoBackgroundWork: "
+        "optimized %u methods, all methods optimized=%d\n", jittedMethodCount, (int)allMethodsJitted);
+
     if (allMethodsJitted)
     {
         EX_TRY
@@ -1032,13 +1569,114 @@ NativeCodeVersion TieredCompilationManager::GetNextMethodToOptimize()
 
     _ASSERTE(IsLockOwnedByCurrentThread());
 
-    SListElem<NativeCodeVersion>* pElem = m_methodsToOptimize.RemoveHead();
+    COUNT_T count = m_countOfMethodsToOptimize;
+    if (count == 0)
+    {
+        return NativeCodeVersion();
+    }
+
+    _ASSERTE(count <= m_methodsToOptimize.GetCount());
+    NativeCodeVersion nativeCodeVersion = m_methodsToOptimize[(COUNT_T)0].nativeCodeVersion;
+
+    // Move the last method to the root and sift it down
+    --count;
+    m_countOfMethodsToOptimize = count;
+    if (count != 0)
+    {
+        MethodToOptimize method = m_methodsToOptimize[count];
+        COUNT_T index = 0;
+        while (true)
+        {
+            COUNT_T childIndex = index * 2 + 1;
+            if (childIndex >= count)
+            {
+                break;
+            }
+            if (childIndex + 1 < count &&
+                m_methodsToOptimize[childIndex + 1].IsHigherPriorityThan(m_methodsToOptimize[childIndex]))
+            {
+                ++childIndex;
+            }
+            if (!m_methodsToOptimize[childIndex].IsHigherPriorityThan(method))
+            {
+                break;
+            }
+            m_methodsToOptimize[index] = m_methodsToOptimize[childIndex];
+            index = childIndex;
+        }
+        m_methodsToOptimize[index] = method;
+    }
+
+    LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::GetNextMethodToOptimize Method=0x%pM, code version id=0x%x dequeued, %u remaining\n",
+        nativeCodeVersion.GetMethodDesc(), nativeCodeVersion.GetVersionId(), count));
+    return nativeCodeVersion;
+}
+
+// Adds a method to the priority queue of methods to optimize.
+void TieredCompilationManager::InsertMethodToOptimize_Locked(
+    NativeCodeVersion nativeCodeVersion,
+    UINT64 callCountingDurationTicks)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(IsLockOwnedByCurrentThread());
+    _ASSERTE(!nativeCodeVersion.IsNull());
+
+    MethodToOptimize method;
+    method.nativeCodeVersion = nativeCodeVersion;
+    method.callCountingDurationTicks = callCountingDurationTicks;
+    method.sequenceNumber = m_nextMethodToOptimizeSequenceNumber;
+
+    COUNT_T index = m_countOfMethodsToOptimize;
+    _ASSERTE(index <= m_methodsToOptimize.GetCount());
+    if (index == m_methodsToOptimize.GetCount())
+    {
+        m_methodsToOptimize.Append(method);
+    }
+
+    ++m_nextMethodToOptimizeSequenceNumber;
+    ++m_countOfMethodsToOptimize;
+
+    // Sift the new method up
+    while (index != 0)
+    {
+        COUNT_T parentIndex = (index - 1) / 2;
+        if (!method.IsHigherPriorityThan(m_methodsToOptimize[parentIndex]))
+        {
+            break;
+        }
+        m_methodsToOptimize[index] = m_methodsToOptimize[parentIndex];
+        index = parentIndex;
+    }
+    m_methodsToOptimize[index] = method;
+}
+
+// Dequeues the next method in the large method queue.
+NativeCodeVersion TieredCompilationManager::GetNextLargeMethodToOptimize()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(IsLockOwnedByCurrentThread());
+
+    SListElem<NativeCodeVersion>* pElem = m_largeMethodsToOptimize.RemoveHead();
     if (pElem != NULL)
     {
         NativeCodeVersion nativeCodeVersion = pElem->GetValue();
         delete pElem;
-        _ASSERTE(m_countOfMethodsToOptimize != 0);
-        --m_countOfMethodsToOptimize;
+        _ASSERTE(m_countOfLargeMethodsToOptimize != 0);
+        --m_countOfLargeMethodsToOptimize;
         return nativeCodeVersion;
     }
     return NativeCodeVersion();
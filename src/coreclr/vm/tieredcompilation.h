@@ -42,7 +42,10 @@ public:
 public:
     void HandleCallCountingForFirstCall(MethodDesc* pMethodDesc);
     bool TrySetCodeEntryPointAndRecordMethodForCallCounting(MethodDesc* pMethodDesc, PCODE codeEntryPoint);
-    void AsyncPromoteToTier1(NativeCodeVersion currentNativeCodeVersion, bool *createTieringBackgroundWorkerRef);
+    void AsyncPromoteToTier1(
+        NativeCodeVersion currentNativeCodeVersion,
+        bool *createTieringBackgroundWorkerRef,
+        UINT64 callCountingDurationTicks = UINT64_MAX);
     static CORJIT_FLAGS GetJitFlags(PrepareCodeConfig *config);
 
 #if !defined(DACCESS_COMPILE) && defined(_DEBUG)
@@ -62,6 +65,20 @@ private:
     static void BackgroundWorkerBootstrapper1(LPVOID args);
     void BackgroundWorkerStart();
 
+private:
+    bool TryQueueLargeMethodToOptimize(NativeCodeVersion nativeCodeVersion);
+    static void CreateLargeMethodWorker();
+    static DWORD WINAPI LargeMethodWorkerBootstrapper0(LPVOID args);
+    static void LargeMethodWorkerBootstrapper1(LPVOID args);
+    void LargeMethodWorkerStart();
+
+private:
+    void TryScheduleAdditionalWorker();
+    static void CreateAdditionalWorker();
+    static DWORD WINAPI AdditionalWorkerBootstrapper0(LPVOID args);
+    static void AdditionalWorkerBootstrapper1(LPVOID args);
+    void AdditionalWorkerStart();
+
 private:
     bool TryDeactivateTieringDelay();
 
@@ -77,7 +94,9 @@ private:
     void OptimizeMethod(NativeCodeVersion nativeCodeVersion);
     HRESULT DeoptimizeMethodHelper(Module* pModule, mdMethodDef methodDef);
     
+    void InsertMethodToOptimize_Locked(NativeCodeVersion nativeCodeVersion, UINT64 callCountingDurationTicks);
     NativeCodeVersion GetNextMethodToOptimize();
+    NativeCodeVersion GetNextLargeMethodToOptimize();
     BOOL CompileCodeVersion(NativeCodeVersion nativeCodeVersion);
     void ActivateCodeVersion(NativeCodeVersion nativeCodeVersion);
 public:
@@ -124,11 +143,42 @@ private:
     static CLREventStatic s_backgroundWorkAvailableEvent;
     static bool s_isBackgroundWorkerRunning;
     static bool s_isBackgroundWorkerProcessingWork;
+    static CLREventStatic s_largeMethodWorkAvailableEvent;
+    static bool s_isLargeMethodWorkerRunning;
+    static CLREventStatic s_additionalWorkAvailableEvent;
+    static UINT32 s_countOfAdditionalWorkersRunning;
+    static UINT32 s_countOfAdditionalWorkersWaiting;
 #endif // !DACCESS_COMPILE
 
 private:
-    SList<SListElem<NativeCodeVersion>> m_methodsToOptimize;
+    struct MethodToOptimize
+    {
+        NativeCodeVersion nativeCodeVersion;
+        UINT64 callCountingDurationTicks;
+        UINT64 sequenceNumber;
+
+        bool IsHigherPriorityThan(const MethodToOptimize &other) const
+        {
+            LIMITED_METHOD_CONTRACT;
+
+            // Methods that reached the call count threshold more quickly are called more frequently, ties are broken in the
+            // order in which the methods were queued
+            if (callCountingDurationTicks != other.callCountingDurationTicks)
+            {
+                return callCountingDurationTicks < other.callCountingDurationTicks;
+            }
+            return sequenceNumber < other.sequenceNumber;
+        }
+    };
+
+private:
+    // Binary heap ordered by MethodToOptimize::IsHigherPriorityThan(), the first m_countOfMethodsToOptimize elements are in
+    // use. The array is not shrunk when methods are removed so that removing a method does not need to allocate or throw.
+    SArray<MethodToOptimize> m_methodsToOptimize;
     UINT32 m_countOfMethodsToOptimize;
+    UINT64 m_nextMethodToOptimizeSequenceNumber;
+    SList<SListElem<NativeCodeVersion>> m_largeMethodsToOptimize;
+    UINT32 m_countOfLargeMethodsToOptimize;
     UINT32 m_countOfNewMethodsCalledDuringDelay;
     SArray<MethodDesc*>* m_methodsPendingCountingForTier1;
     bool m_tier1CallCountingCandidateMethodRecentlyRecorded;
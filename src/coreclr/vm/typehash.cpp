@@ -513,7 +513,41 @@ VOID EETypeHashTable::InsertValue(TypeHandle data)
     }
     CONTRACTL_END
 
-    EETypeHashEntry_t * pNewEntry = (EETypeHashEntry_t*)BaseAllocateEntry(NULL);
+    InsertValueUsingPreallocatedEntry(AllocNewEntry(NULL), data);
+}
+
+EETypeHashEntry_t *EETypeHashTable::AllocNewEntry(AllocMemTracker *pamTracker)
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END
+
+    return (EETypeHashEntry_t*)BaseAllocateEntry(pamTracker);
+}
+
+// Insert a value not already in the hash table, in an entry returned by AllocNewEntry
+VOID EETypeHashTable::InsertValueUsingPreallocatedEntry(EETypeHashEntry_t *pNewEntry, TypeHandle data)
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        PRECONDITION(IsUnsealed());          // If we are sealed then we should not be adding to this hashtable
+        PRECONDITION(CheckPointer(pNewEntry));
+        PRECONDITION(CheckPointer(data));
+        PRECONDITION(!data.IsGenericTypeDefinition()); // Generic type defs live in typedef table (availableClasses)
+        PRECONDITION(data.HasInstantiation() || data.HasTypeParam() || data.IsFnPtrType()); // It's an instantiated type or an array/ptr/byref type
+        PRECONDITION(m_pModule == NULL || GetModule()->IsTenured()); // Destruct won't destruct m_pAvailableParamTypes for non-tenured modules - so make sure no one tries to insert one before the Module has been tenured
+    }
+    CONTRACTL_END
 
     pNewEntry->SetTypeHandle(data);
 
@@ -98,6 +98,11 @@ public:
     // Value must not be present in the table already
     VOID InsertValue(TypeHandle data);
 
+    // Entries can be allocated before taking the lock that serializes insertions, so that the loader
+    // heap allocation is not made while holding it. Backing out the tracker frees an unused entry.
+    EETypeHashEntry_t *AllocNewEntry(AllocMemTracker *pamTracker);
+    VOID InsertValueUsingPreallocatedEntry(EETypeHashEntry_t *pNewEntry, TypeHandle data);
+
     // Look up a value in the hash table, key explicit in pKey
     // Return a null type handle if not found
     TypeHandle GetValue(const TypeKey* pKey);
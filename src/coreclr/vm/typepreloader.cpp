@@ -0,0 +1,360 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+//
+// File: typepreloader.cpp
+//
+
+//
+// Speculative loading of a recorded list of types on background threads during startup
+//
+// ======================================================================================
+
+#include "common.h"
+#include "typepreloader.h"
+#include "assemblyspec.hpp"
+#include "clsload.hpp"
+
+#define MAX_TYPE_PRELOAD_THREADS 8
+#define MAX_TYPE_PRELOAD_LIST_SIZE (64 * 1024 * 1024)
+
+static LONG s_typePreloaderStarted = 0;
+
+struct TypePreloaderThreadArgs
+{
+    TypePreloader * m_pPreloader;
+    Thread        * m_pThread;
+};
+
+TypePreloader::TypePreloader()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    m_nextLine = 0;
+    m_nRefs    = 1;
+    m_nLoaded  = 0;
+    m_nFailed  = 0;
+}
+
+void TypePreloader::StartFromConfig()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    EX_TRY
+    {
+        CLRConfigStringHolder wszList(CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TypePreloadList));
+
+        if ((wszList != NULL) && (wszList[0] != 0) &&
+            (InterlockedCompareExchange(&s_typePreloaderStarted, 1, 0) == 0))
+        {
+            NewHolder<TypePreloader> pPreloader = new TypePreloader();
+
+            HRESULT hr = pPreloader->ReadList(wszList);
+
+            LOG((LF_CLASSLOADER, LL_INFO10, "TypePreloader: read %d types, hr = 0x%08x\n", pPreloader->m_lines.GetCount(), hr));
+
+            if (SUCCEEDED(hr) && (pPreloader->m_lines.GetCount() > 0))
+            {
+                unsigned nThreads = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TypePreloadThreads);
+                nThreads = min(nThreads, min((unsigned)MAX_TYPE_PRELOAD_THREADS, (unsigned)g_SystemInfo.dwNumberOfProcessors));
+
+                if (nThreads > 0)
+                {
+                    // The workers own the preloader from here on
+                    pPreloader.SuppressRelease();
+                    pPreloader->StartThreads(nThreads);
+                }
+            }
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+}
+
+HRESULT TypePreloader::ReadList(LPCWSTR pFileName)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    HandleHolder hFile = WszCreateFile(pFileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return COR_E_FILENOTFOUND;
+    }
+
+    DWORD cbFileSizeHigh = 0;
+    DWORD cbFile = GetFileSize(hFile, &cbFileSizeHigh);
+
+    if ((cbFile == INVALID_FILE_SIZE) || (cbFileSizeHigh != 0) || (cbFile > MAX_TYPE_PRELOAD_LIST_SIZE))
+    {
+        return COR_E_BADIMAGEFORMAT;
+    }
+
+    m_pBuffer = new CHAR[cbFile + 1];
+
+    DWORD cbRead = 0;
+
+    if (!::ReadFile(hFile, m_pBuffer, cbFile, &cbRead, NULL) || (cbRead != cbFile))
+    {
+        return COR_E_BADIMAGEFORMAT;
+    }
+
+    m_pBuffer[cbFile] = 0;
+
+    LPSTR pCur = m_pBuffer;
+
+    // Skip the UTF-8 byte order mark
+    if ((cbFile >= 3) && ((BYTE)pCur[0] == 0xEF) && ((BYTE)pCur[1] == 0xBB) && ((BYTE)pCur[2] == 0xBF))
+    {
+        pCur += 3;
+    }
+
+    while (*pCur != 0)
+    {
+        LPSTR pLine = pCur;
+
+        while ((*pCur != 0) && (*pCur != '\n') && (*pCur != '\r'))
+        {
+            pCur++;
+        }
+
+        while ((*pCur == '\n') || (*pCur == '\r'))
+        {
+            *pCur++ = 0;
+        }
+
+        while ((*pLine == ' ') || (*pLine == '\t'))
+        {
+            pLine++;
+        }
+
+        if ((*pLine != 0) && (*pLine != '#'))
+        {
+            m_lines.Append(pLine);
+        }
+    }
+
+    return S_OK;
+}
+
+void TypePreloader::StartThreads(unsigned count)
+{
+    STANDARD_VM_CONTRACT;
+
+    unsigned started = 0;
+
+    EX_TRY
+    {
+        for (; started < count; started++)
+        {
+            NewHolder<TypePreloaderThreadArgs> pArgs = new TypePreloaderThreadArgs();
+            pArgs->m_pPreloader = this;
+            pArgs->m_pThread = SetupUnstartedThread();
+
+            InterlockedIncrement(&m_nRefs);
+
+            if (!pArgs->m_pThread->CreateNewThread(0, StaticWorkerThreadProc, pArgs))
+            {
+                InterlockedDecrement(&m_nRefs);
+                pArgs->m_pThread->DecExternalCount(FALSE);
+                break;
+            }
+
+            // The worker is responsible for deleting its arguments once it's created
+            Thread * pThread = pArgs->m_pThread;
+            pArgs.SuppressRelease();
+            pThread->StartThread();
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    LOG((LF_CLASSLOADER, LL_INFO10, "TypePreloader: started %d worker threads\n", started));
+
+    // Drop the reference held while starting the workers. If none started, this deletes the preloader.
+    Release();
+}
+
+void TypePreloader::Release()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (InterlockedDecrement(&m_nRefs) == 0)
+    {
+        LOG((LF_CLASSLOADER, LL_INFO10, "TypePreloader: done, %d types loaded, %d failed\n", m_nLoaded, m_nFailed));
+
+        delete this;
+    }
+}
+
+bool TypePreloader::PreloadType(LPSTR pLine, AssemblyCache * pCache)
+{
+    STANDARD_VM_CONTRACT;
+
+    // "Namespace.TypeName, AssemblySimpleName[, ...]". Each line is claimed by a single worker, so it
+    // can be split in place.
+    LPSTR pComma = strchr(pLine, ',');
+    if (pComma == NULL)
+    {
+        return false;
+    }
+
+    LPSTR pAssemblyName = pComma + 1;
+    while ((*pAssemblyName == ' ') || (*pAssemblyName == '\t'))
+    {
+        pAssemblyName++;
+    }
+
+    LPSTR pAssemblyNameEnd = strchr(pAssemblyName, ',');
+    if (pAssemblyNameEnd == NULL)
+    {
+        pAssemblyNameEnd = pAssemblyName + strlen(pAssemblyName);
+    }
+    while ((pAssemblyNameEnd > pAssemblyName) && ((pAssemblyNameEnd[-1] == ' ') || (pAssemblyNameEnd[-1] == '\t')))
+    {
+        pAssemblyNameEnd--;
+    }
+    *pAssemblyNameEnd = 0;
+
+    LPSTR pTypeNameEnd = pComma;
+    while ((pTypeNameEnd > pLine) && ((pTypeNameEnd[-1] == ' ') || (pTypeNameEnd[-1] == '\t')))
+    {
+        pTypeNameEnd--;
+    }
+    *pTypeNameEnd = 0;
+
+    // Nested types and constructed types need a full type name parser, which runs managed code.
+    // Those are left to be loaded on demand.
+    if ((*pLine == 0) || (*pAssemblyName == 0) || (strpbrk(pLine, "+[]*&") != NULL))
+    {
+        return false;
+    }
+
+    Assembly * pAssembly = NULL;
+
+    if ((pCache->m_pName != NULL) && (strcmp(pCache->m_pName, pAssemblyName) == 0))
+    {
+        pAssembly = pCache->m_pAssembly;
+    }
+    else
+    {
+        AssemblyMetaDataInternal context;
+        ZeroMemory(&context, sizeof(context));
+
+        AssemblySpec spec;
+        spec.Init(pAssemblyName, &context, NULL, 0, 0);
+
+        pAssembly = spec.LoadAssembly(FILE_LOADED, FALSE /* fThrowOnFileNotFound */);
+
+        pCache->m_pName = pAssemblyName;
+        pCache->m_pAssembly = pAssembly;
+    }
+
+    if (pAssembly == NULL)
+    {
+        return false;
+    }
+
+    LPCSTR pNamespace = "";
+    LPSTR pName = pLine;
+    LPSTR pLastDot = strrchr(pLine, '.');
+    if (pLastDot != NULL)
+    {
+        *pLastDot = 0;
+        pNamespace = pLine;
+        pName = pLastDot + 1;
+    }
+
+    TypeHandle th = ClassLoader::LoadTypeByNameThrowing(pAssembly, pNamespace, pName,
+                                                        ClassLoader::ReturnNullIfNotFound,
+                                                        ClassLoader::LoadTypes,
+                                                        CLASS_LOADED);
+
+    return !th.IsNull();
+}
+
+void TypePreloader::WorkerThreadProc()
+{
+    STANDARD_VM_CONTRACT;
+
+    AssemblyCache cache = { NULL, NULL };
+
+    while (!g_fEEShutDown)
+    {
+        COUNT_T index = (COUNT_T)(InterlockedIncrement(&m_nextLine) - 1);
+        if (index >= m_lines.GetCount())
+        {
+            break;
+        }
+
+        bool loaded = false;
+
+        EX_TRY
+        {
+            loaded = PreloadType(m_lines[index], &cache);
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+
+        InterlockedIncrement(loaded ? &m_nLoaded : &m_nFailed);
+    }
+}
+
+DWORD WINAPI TypePreloader::StaticWorkerThreadProc(void *args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+        ENTRY_POINT;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    TypePreloaderThreadArgs * pArgs = (TypePreloaderThreadArgs *) args;
+    TypePreloader * pPreloader = pArgs->m_pPreloader;
+    Thread * pThread = pArgs->m_pThread;
+    delete pArgs;
+
+    if (pThread->HasStarted())
+    {
+        // Run as background thread, so ThreadStore::WaitForOtherThreads will not wait for it
+        pThread->SetBackground(TRUE);
+
+        EX_TRY
+        {
+            GCX_PREEMP();
+
+            pPreloader->WorkerThreadProc();
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+    }
+
+    // It needs to be deleted after GCX_PREEMP ends
+    DestroyThread(pThread);
+
+    pPreloader->Release();
+
+    return 0;
+}
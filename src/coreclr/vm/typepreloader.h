@@ -0,0 +1,59 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+//
+// File: typepreloader.h
+//
+
+//
+// Speculative loading of a recorded list of types on background threads during startup
+//
+// ======================================================================================
+
+#ifndef __TYPE_PRELOADER_H__
+#define __TYPE_PRELOADER_H__
+
+// The list named by DOTNET_TypePreloadList is a UTF-8 text file with one type per line, in the
+// form "Namespace.TypeName, AssemblySimpleName" (for instance post-processed from the TypeLoad
+// events of a startup trace). Empty lines and lines starting with '#' are ignored.
+//
+// Each worker claims the next line and loads the type to CLASS_LOADED through the regular
+// ClassLoader entry points. A type whose load depends on one that another thread is loading
+// waits on that type's PendingTypeLoadTable entry, the same way an application thread would,
+// so only independent types are actually loaded in parallel. Loading is best effort: names
+// that don't bind or don't load are counted and skipped.
+class TypePreloader
+{
+public:
+    // Starts the preloading threads if a list is configured. Failures are swallowed.
+    static void StartFromConfig();
+
+private:
+    // Most recently bound assembly per worker; lists recorded from a trace are mostly grouped by assembly
+    struct AssemblyCache
+    {
+        LPCSTR     m_pName;
+        Assembly * m_pAssembly;
+    };
+
+    TypePreloader();
+
+    HRESULT ReadList(LPCWSTR pFileName);
+    void StartThreads(unsigned count);
+    void Release();
+
+    bool PreloadType(LPSTR pLine, AssemblyCache * pCache);
+    void WorkerThreadProc();
+    static DWORD WINAPI StaticWorkerThreadProc(void *args);
+
+    // File contents, with each line NUL terminated in place
+    NewArrayHolder<CHAR> m_pBuffer;
+    SArray<LPSTR>        m_lines;
+
+    LONG                 m_nextLine;
+    // One reference per running worker plus one held by StartThreads
+    LONG                 m_nRefs;
+    LONG                 m_nLoaded;
+    LONG                 m_nFailed;
+};
+
+#endif // __TYPE_PRELOADER_H__
@@ -28,11 +28,13 @@ UINT32 g_site_counter = 0;              //# of call sites
 UINT32 g_site_write = 0;                //# of call site backpatch writes
 UINT32 g_site_write_poly = 0;           //# of call site backpatch writes to point to resolve stubs
 UINT32 g_site_write_mono = 0;           //# of call site backpatch writes to point to dispatch stubs
+UINT32 g_site_write_chain = 0;          //# of call site backpatch writes to point to chained dispatch stubs
 
 UINT32 g_stub_lookup_counter = 0;       //# of lookup stubs
 UINT32 g_stub_mono_counter = 0;         //# of dispatch stubs
 UINT32 g_stub_poly_counter = 0;         //# of resolve stubs
 UINT32 g_stub_vtable_counter = 0;       //# of vtable call stubs
+UINT32 g_stub_chain_counter = 0;        //# of dispatch stubs chained in front of another dispatch stub
 UINT32 g_stub_space = 0;                //# of bytes of stubs
 
 UINT32 g_reclaim_counter = 0;           //# of times a ReclaimAll was performed
@@ -103,6 +105,10 @@ UINT32 STUB_COLLIDE_WRITE_PCT = 100;
 UINT32 STUB_COLLIDE_MONO_PCT  =   0;
 #endif // STUB_LOGGING
 
+//maximum number of dispatch stubs, and thus types, a call site checks before it falls back to its resolve stub
+#define CALL_STUB_MAX_DISPATCH_CHAIN_LENGTH 4
+DWORD g_dispatchChainMaxLength = 3;
+
 FastTable::NumCallStubs_t FastTable::NumCallStubs;
 
 FastTable* BucketTable::dead = NULL;    //linked list of the abandoned buckets
@@ -227,6 +233,8 @@ void VirtualCallStubManager::LoggingDump()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly", g_site_write_poly);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_chain", g_site_write_chain);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), "\r\n%-30s %d\r\n", "reclaim_counter", g_reclaim_counter);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
@@ -242,6 +250,8 @@ void VirtualCallStubManager::LoggingDump()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "stub_vtable_counter", g_stub_vtable_counter);
         WriteFile(g_hStubLogFile, szPrintStr, (DWORD)strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "stub_chain_counter", g_stub_chain_counter);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "stub_space", g_stub_space);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
@@ -752,6 +762,9 @@ void VirtualCallStubManager::InitStatic()
     g_resetCacheIncr       = (INT32) CLRConfig::GetConfigValue(CLRConfig::INTERNAL_VirtualCallStubResetCacheIncr);
 #endif // STUB_LOGGING
 
+    g_dispatchChainMaxLength = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_VirtualCallStubDispatchChainLength);
+    g_dispatchChainMaxLength = min(max(g_dispatchChainMaxLength, (DWORD)1), (DWORD)CALL_STUB_MAX_DISPATCH_CHAIN_LENGTH);
+
 #ifndef STUB_DISPATCH_PORTABLE
     DispatchHolder::InitializeStatic();
     ResolveHolder::InitializeStatic();
@@ -1172,6 +1185,45 @@ ResolveCacheElem *VirtualCallStubManager::GetResolveCacheElem(void *pMT,
     return elem;
 }
 
+ResolveHolder *VirtualCallStubManager::GetResolveHolderFromDispatchStub(DispatchStub *pDispatchStub)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    }
+    CONTRACTL_END
+
+    PCODE failTarget = pDispatchStub->failTarget();
+    while (isDispatchingStubStatic(failTarget))
+    {
+        failTarget = DispatchHolder::FromDispatchEntry(failTarget)->stub()->failTarget();
+    }
+
+    return ResolveHolder::FromFailEntry(failTarget);
+}
+
+DWORD VirtualCallStubManager::GetDispatchChainLength(PCODE stub)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    }
+    CONTRACTL_END
+
+    DWORD length = 0;
+    while (isDispatchingStubStatic(stub))
+    {
+        length++;
+        stub = DispatchHolder::FromDispatchEntry(stub)->stub()->failTarget();
+    }
+
+    return length;
+}
+
 #endif // !DACCESS_COMPILE
 
 size_t VirtualCallStubManager::GetTokenFromStub(PCODE stub)
@@ -1211,7 +1263,7 @@ size_t VirtualCallStubManager::GetTokenFromStubQuick(VirtualCallStubManager * pM
     {
         _ASSERTE(RangeSectionStubManager::GetStubKind(stub) == STUB_CODE_BLOCK_VSD_DISPATCH_STUB);
         DispatchStub  * dispatchStub  = (DispatchStub *) PCODEToPINSTR(stub);
-        ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(dispatchStub->failTarget());
+        ResolveHolder * resolveHolder = GetResolveHolderFromDispatchStub(dispatchStub);
         _ASSERTE(isResolvingStubStatic(resolveHolder->stub()->resolveEntryPoint()));
         return resolveHolder->stub()->token();
     }
@@ -1719,6 +1771,27 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
                         }
                     }
                 }
+
+                // The dispatch stub of the call site missed. Instead of sending this type through the
+                // resolve stub and its cache lookup, build a dispatch stub for it whose failure target
+                // is the one the call site currently uses, and patch the call site to the new stub.
+                // Such a chain is private to the call site, so it is not added to the dispatchers table.
+                // Misses of the whole chain still count down the resolve stub's counter, which
+                // eventually patches the call site to the resolve stub.
+                if (stubKind == STUB_CODE_BLOCK_VSD_DISPATCH_STUB && bCreateDispatchStub)
+                {
+                    PCODE siteTarget = pCallSite->GetSiteTarget();
+                    if (isDispatchingStubStatic(siteTarget) &&
+                        GetDispatchChainLength(siteTarget) < g_dispatchChainMaxLength)
+                    {
+                        bool reenteredCooperativeGCMode = false;
+                        DispatchHolder *pDispatchHolder = GenerateDispatchStub(
+                            target, siteTarget, objectType, token.To_SIZE_T(), &reenteredCooperativeGCMode);
+                        stats.stub_chain_counter++;
+
+                        BackPatchSite(pCallSite, pDispatchHolder->stub()->entryPoint());
+                    }
+                }
             }
             else
             {
@@ -1848,6 +1921,11 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
     }
     EX_END_CATCH (SwallowAllExceptions);
 
+    if (g_hStubLogFile != NULL)
+    {
+        RecordCallSiteStats(pCallSite, token, stubKind);
+    }
+
     // Target can be NULL only if we can't resolve to an address
     _ASSERTE(target != (PCODE)NULL);
 
@@ -2301,9 +2379,9 @@ void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite)
         //yes, patch it to point to the resolve stub
         //We can ignore the races now since we now know that the call site does go thru our
         //stub mechanisms, hence no matter who wins the race, we are correct.
-        //We find the correct resolve stub by following the failure path in the dispatcher stub itself
-        PCODE failEntry    = dispatchStub->failTarget();
-        ResolveStub* resolveStub  = ResolveHolder::FromFailEntry(failEntry)->stub();
+        //We find the correct resolve stub by following the failure path in the dispatcher stub itself,
+        //through any other dispatch stubs chained behind it.
+        ResolveStub* resolveStub  = GetResolveHolderFromDispatchStub(dispatchStub)->stub();
         PCODE resolveEntry = resolveStub->resolveEntryPoint();
         BackPatchSite(pCallSite, resolveEntry);
 
@@ -2345,6 +2423,7 @@ void VirtualCallStubManager::BackPatchSite(StubCallSite* pCallSite, PCODE stub)
     //we only want to do the following transitions for right now:
     //  prior           new
     //  lookup          dispatching or resolving
+    //  dispatching     dispatching chained in front of prior
     //  dispatching     resolving
     if (isResolvingStubStatic(prior))
         return;
@@ -2353,7 +2432,11 @@ void VirtualCallStubManager::BackPatchSite(StubCallSite* pCallSite, PCODE stub)
     {
         if(isDispatchingStubStatic(prior))
         {
-            return;
+            if (DispatchHolder::FromDispatchEntry(stub)->stub()->failTarget() != prior)
+            {
+                return;
+            }
+            stats.site_write_chain++;
         }
         else
         {
@@ -2792,6 +2875,8 @@ void VirtualCallStubManager::LogStats()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly", stats.site_write_poly);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_chain", stats.site_write_chain);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), "\r\nstub data\r\n");
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
@@ -2802,6 +2887,8 @@ void VirtualCallStubManager::LogStats()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "stub_poly_counter", stats.stub_poly_counter);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "stub_chain_counter", stats.stub_chain_counter);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "stub_space", stats.stub_space);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
@@ -2818,6 +2905,8 @@ void VirtualCallStubManager::LogStats()
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), "\r\ncache_load:\t%zu used, %zu total, utilization %#5.2f%%\r\n",
                 used, total, 100.0 * double(used) / double(total));
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+
+        LogCallSiteStats();
     }
 
     resolvers->LogStats();
@@ -2831,9 +2920,11 @@ void VirtualCallStubManager::LogStats()
     g_stub_poly_counter += stats.stub_poly_counter;
     g_stub_mono_counter += stats.stub_mono_counter;
     g_stub_vtable_counter += stats.stub_vtable_counter;
+    g_stub_chain_counter += stats.stub_chain_counter;
     g_site_write += stats.site_write;
     g_site_write_poly += stats.site_write_poly;
     g_site_write_mono += stats.site_write_mono;
+    g_site_write_chain += stats.site_write_chain;
     g_worker_call += stats.worker_call;
     g_worker_call_no_patch += stats.worker_call_no_patch;
     g_worker_collide_to_mono += stats.worker_collide_to_mono;
@@ -2846,9 +2937,11 @@ void VirtualCallStubManager::LogStats()
     stats.stub_poly_counter = 0;
     stats.stub_mono_counter = 0;
     stats.stub_vtable_counter = 0;
+    stats.stub_chain_counter = 0;
     stats.site_write = 0;
     stats.site_write_poly = 0;
     stats.site_write_mono = 0;
+    stats.site_write_chain = 0;
     stats.worker_call = 0;
     stats.worker_call_no_patch = 0;
     stats.worker_collide_to_mono = 0;
@@ -2857,6 +2950,89 @@ void VirtualCallStubManager::LogStats()
     stats.cache_entry_space = 0;
 }
 
+//------------------------------------------------------------------
+// Counts a call into ResolveWorker against its call site
+//------------------------------------------------------------------
+void VirtualCallStubManager::RecordCallSiteStats(StubCallSite* pCallSite, DispatchToken token, StubCodeBlockKind stubKind)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END
+
+    TADDR indCell = (TADDR)pCallSite->GetIndirectCell();
+    DWORD dispatchEntries = GetDispatchChainLength(pCallSite->GetSiteTarget());
+
+    EX_TRY
+    {
+        CrstHolder lh(&m_indCellLock);
+
+        CallSiteStats* pStats = const_cast<CallSiteStats*>(m_callSiteStats.LookupPtr(indCell));
+        if (pStats == NULL)
+        {
+            CallSiteStats newStats = {};
+            newStats.indCell = indCell;
+            newStats.token = token.To_SIZE_T();
+            m_callSiteStats.Add(newStats);
+            pStats = const_cast<CallSiteStats*>(m_callSiteStats.LookupPtr(indCell));
+        }
+
+        pStats->resolve_counter++;
+        pStats->dispatch_entries = max(pStats->dispatch_entries, (UINT32)dispatchEntries);
+        if (stubKind == STUB_CODE_BLOCK_VSD_RESOLVE_STUB)
+        {
+            pStats->megamorphic = TRUE;
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions)
+}
+
+//------------------------------------------------------------------
+// Logs the call sites that have seen more than one type
+//------------------------------------------------------------------
+void VirtualCallStubManager::LogCallSiteStats()
+{
+    STATIC_CONTRACT_NOTHROW;
+    STATIC_CONTRACT_GC_NOTRIGGER;
+    STATIC_CONTRACT_FORBID_FAULT;
+
+    // Temp space to use for formatting the output.
+    static const int FMT_STR_SIZE = 160;
+    char szPrintStr[FMT_STR_SIZE];
+    DWORD dwWriteByte;
+
+    CrstHolder lh(&m_indCellLock);
+
+    if (m_callSiteStats.GetCount() == 0)
+    {
+        return;
+    }
+
+    sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), "\r\npolymorphic call sites\r\n");
+    WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+
+    for (SHash<CallSiteStatsTraits>::Iterator it = m_callSiteStats.Begin(); it != m_callSiteStats.End(); ++it)
+    {
+        const CallSiteStats& site = *it;
+
+        // a call site resolved once is monomorphic
+        if (site.resolve_counter < 2)
+        {
+            continue;
+        }
+
+        sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), "\tcell %p token %p resolves %u dispatch_entries %u%s\r\n",
+                (void*)site.indCell, (void*)site.token, site.resolve_counter, site.dispatch_entries,
+                site.megamorphic ? " megamorphic" : "");
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+    }
+}
+
 void Prober::InitProber(size_t key1, size_t key2, size_t* table)
 {
     CONTRACTL {
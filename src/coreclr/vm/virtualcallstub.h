@@ -20,6 +20,7 @@
 #endif
 
 #include "stubmgr.h"
+#include "shash.h"
 
 /////////////////////////////////////////////////////////////////////////////////////
 // Forward class declarations
@@ -31,6 +32,7 @@ class VirtualCallStubManager;
 class VirtualCallStubManagerManager;
 struct LookupHolder;
 struct DispatchHolder;
+struct DispatchStub;
 struct ResolveHolder;
 struct VTableCallHolder;
 
@@ -411,6 +413,11 @@ public:
     //This is used to get the token out of a stub and we know the stub manager and stub kind
     static size_t GetTokenFromStubQuick(VirtualCallStubManager * pMgr, PCODE stub, StubCodeBlockKind kind);
 
+    //Polymorphic call sites chain dispatch stubs through their failure targets. These find the
+    //resolve stub at the end of the chain and the number of dispatch stubs in front of it.
+    static ResolveHolder *GetResolveHolderFromDispatchStub(DispatchStub *pDispatchStub);
+    static DWORD GetDispatchChainLength(PCODE stub);
+
     // General utility functions
     // Quick lookup in the cache. NOTHROW, GC_NOTRIGGER
     static PCODE CacheLookup(size_t token, UINT16 tokenHash, MethodTable *pMT);
@@ -459,6 +466,34 @@ public:
     //Change the callsite to point to stub
     void BackPatchSite(StubCallSite* pCallSite, PCODE stub);
 
+private:
+    //Per call site counters, kept only while stub logging is enabled. They are used to find the
+    //polymorphic and megamorphic call sites in the stub log.
+    struct CallSiteStats
+    {
+        TADDR  indCell;                 //indirection cell of the call site
+        size_t token;                   //dispatch token of the call site
+        UINT32 resolve_counter;         //# of calls into ResolveWorker from the call site
+        UINT32 dispatch_entries;        //# of types the call site checks in its dispatch stubs
+        BOOL   megamorphic;             //the call site has been patched to its resolve stub
+    };
+
+    class CallSiteStatsTraits : public NoRemoveSHashTraits< DefaultSHashTraits<CallSiteStats> >
+    {
+    public:
+        typedef TADDR key_t;
+        static key_t GetKey(const element_t &e) { LIMITED_METHOD_CONTRACT; return e.indCell; }
+        static BOOL Equals(key_t k1, key_t k2) { LIMITED_METHOD_CONTRACT; return k1 == k2; }
+        static count_t Hash(key_t k) { LIMITED_METHOD_CONTRACT; return (count_t)(k >> LOG2_PTRSIZE); }
+        static element_t Null() { LIMITED_METHOD_CONTRACT; CallSiteStats e = {}; return e; }
+        static bool IsNull(const element_t &e) { LIMITED_METHOD_CONTRACT; return e.indCell == 0; }
+    };
+
+    SHash<CallSiteStatsTraits> m_callSiteStats;
+
+    void RecordCallSiteStats(StubCallSite* pCallSite, DispatchToken token, StubCodeBlockKind stubKind);
+    void LogCallSiteStats();
+
 public:
     /* the following two public functions are to support tracing or stepping thru
     stubs via the debugger. */
@@ -648,6 +683,8 @@ public:
         UINT32 site_write;              //# of call site backpatch writes
         UINT32 site_write_poly;         //# of call site backpatch writes to point to resolve stubs
         UINT32 site_write_mono;         //# of call site backpatch writes to point to dispatch stubs
+        UINT32 site_write_chain;        //# of call site backpatch writes to point to chained dispatch stubs
+        UINT32 stub_chain_counter;      //# of dispatch stubs chained in front of another dispatch stub
         UINT32 worker_call;             //# of calls into ResolveWorker
         UINT32 worker_call_no_patch;    //# of times call_worker resulted in no patch
         UINT32 worker_collide_to_mono;  //# of times we converted a poly stub to a mono stub instead of writing the cache entry
@@ -21,6 +21,13 @@ static double s_nsPerYieldMeasurements[NsPerYieldMeasurementCount];
 static int s_nextMeasurementIndex;
 static double s_establishedNsPerYield = YieldProcessorNormalization::TargetNsPerNormalizedYield;
 
+// Limit the minimum to a reasonable value considering that on some systems a yield may be implemented as a no-op
+static const double MinNsPerYield = 0.1;
+
+// Measured values higher than this don't affect values calculated for normalization, and it's very unlikely for a yield to
+// really take this long. Limit the maximum to keep the recorded values reasonable.
+static const double MaxNsPerYield = YieldProcessorNormalization::TargetMaxNsPerSpinIteration / 1.5 + 1;
+
 void RhEnableFinalization();
 
 inline unsigned int GetTickCountPortable()
@@ -43,6 +50,25 @@ static uint64_t GetPerformanceCounter()
 #endif
 }
 
+// Returns the duration of a yield that is configured for the machine, or 0 if it has to be measured. Hosts that start many
+// short-lived processes on the same hardware can take the value from the YieldProcessorMeasurement events of a previous run
+// so that the processes start with it instead of spending the initial measurements.
+static double GetConfiguredNsPerYield()
+{
+    WRAPPER_NO_CONTRACT;
+
+#ifdef FEATURE_NATIVEAOT
+    return 0;
+#else
+    DWORD psPerYield = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_YieldProcessorPsPerYield);
+    if (psPerYield == 0)
+    {
+        return 0;
+    }
+    return max(MinNsPerYield, min(psPerYield / 1000.0, MaxNsPerYield));
+#endif
+}
+
 static unsigned int DetermineMeasureDurationUs()
 {
     CONTRACTL
@@ -111,13 +137,6 @@ static double MeasureNsPerYield(unsigned int measureDurationUs)
         yieldCount += nextYieldCount;
     }
 
-    // Limit the minimum to a reasonable value considering that on some systems a yield may be implemented as a no-op
-    const double MinNsPerYield = 0.1;
-
-    // Measured values higher than this don't affect values calculated for normalization, and it's very unlikely for a yield to
-    // really take this long. Limit the maximum to keep the recorded values reasonable.
-    const double MaxNsPerYield = YieldProcessorNormalization::TargetMaxNsPerSpinIteration / 1.5 + 1;
-
     return max(MinNsPerYield, min((double)elapsedTicks * NsPerS / ((double)yieldCount * ticksPerS), MaxNsPerYield));
 }
 
@@ -170,18 +189,32 @@ void YieldProcessorNormalization::PerformMeasurement()
         s_performanceCounterTicksPerS = li.QuadPart;
 #endif
 
-        unsigned int measureDurationUs = DetermineMeasureDurationUs();
-        for (int i = 0; i < NsPerYieldMeasurementCount; ++i)
+        double configuredNsPerYield = GetConfiguredNsPerYield();
+        if (configuredNsPerYield != 0)
         {
-            latestNsPerYield = MeasureNsPerYield(measureDurationUs);
-            AtomicStore(&s_nsPerYieldMeasurements[i], latestNsPerYield);
-            if (i == 0 || latestNsPerYield < s_establishedNsPerYield)
+            // Later measurements replace the configured value one at a time, as for measured values
+            latestNsPerYield = configuredNsPerYield;
+            for (int i = 0; i < NsPerYieldMeasurementCount; ++i)
             {
-                AtomicStore(&s_establishedNsPerYield, latestNsPerYield);
+                AtomicStore(&s_nsPerYieldMeasurements[i], latestNsPerYield);
             }
-            if (i < NsPerYieldMeasurementCount - 1)
+            AtomicStore(&s_establishedNsPerYield, latestNsPerYield);
+        }
+        else
+        {
+            unsigned int measureDurationUs = DetermineMeasureDurationUs();
+            for (int i = 0; i < NsPerYieldMeasurementCount; ++i)
             {
-                FireEtwYieldProcessorMeasurement(GetClrInstanceId(), latestNsPerYield, s_establishedNsPerYield);
+                latestNsPerYield = MeasureNsPerYield(measureDurationUs);
+                AtomicStore(&s_nsPerYieldMeasurements[i], latestNsPerYield);
+                if (i == 0 || latestNsPerYield < s_establishedNsPerYield)
+                {
+                    AtomicStore(&s_establishedNsPerYield, latestNsPerYield);
+                }
+                if (i < NsPerYieldMeasurementCount - 1)
+                {
+                    FireEtwYieldProcessorMeasurement(GetClrInstanceId(), latestNsPerYield, s_establishedNsPerYield);
+                }
             }
         }
     }
@@ -130,6 +130,8 @@ export const instrumentedTraces: { [key: number]: InstrumentedTraceState } = {};
 export let nextInstrumentedTraceId = 1;
 export let countLimitedPrintCounter = 10;
 export const abortCounts: { [key: string]: number } = {};
+// Bailouts by the opcode at the ip the trace exited to, when countBailouts is enabled
+export const bailoutOpcodeCounts: { [key: string]: number } = {};
 export const traceInfo: { [key: string]: TraceInfo } = {};
 
 export const
@@ -249,6 +251,11 @@ function recordBailout (ip: number, traceIndex: number, reason: BailoutReason) {
         info.bailoutCount = 1;
     else
         info.bailoutCount++;
+
+    // ip is relative to the start of the trace. For branch bailouts it is the branch target,
+    //  otherwise the opcode that could not complete inside the trace.
+    const opname = getOpcodeName(getU16(<any>info.ip + ip));
+    bailoutOpcodeCounts[opname] = (bailoutOpcodeCounts[opname] || 0) + 1;
     return ip;
 }
 
@@ -1116,10 +1123,17 @@ export function jiterpreter_dump_stats (concise?: boolean): void {
             if (!trace.bailoutCount)
                 continue;
             c++;
-            mono_log_info(`${trace.name}: ${trace.bailoutCount} bailout(s)`);
+            const hitCount = trace.hitCount;
+            const bailoutRate = hitCount ? (trace.bailoutCount / hitCount * 100).toFixed(1) : "?";
+            mono_log_info(`${trace.name}: ${trace.bailoutCount} bailout(s) in ${hitCount} hit(s) (${bailoutRate}%)`);
             for (const k in trace.bailoutCounts)
                 mono_log_info(`  ${BailoutReasonNames[<any>k]} x${trace.bailoutCounts[<any>k]}`);
         }
+
+        const opnames = Object.keys(bailoutOpcodeCounts);
+        opnames.sort((l, r) => bailoutOpcodeCounts[r] - bailoutOpcodeCounts[l]);
+        for (let i = 0; i < opnames.length && i < summaryStatCount; i++)
+            mono_log_info(`// bailouts at ${opnames[i]}: ${bailoutOpcodeCounts[opnames[i]]}`);
     }
 
     if (mostRecentOptions.estimateHeat) {
@@ -299,6 +299,7 @@ static IpcStreamVtable wasm_ipc_stream_vtable = {
 	&wasm_ipc_stream_write,
 	&wasm_ipc_stream_flush,
 	&wasm_ipc_stream_close,
+	NULL,
 };
 
 EMSCRIPTEN_KEEPALIVE IpcStream *
@@ -259,6 +259,41 @@ test_utf8_to_utf16 (void)
 	return OK;
 }
 
+/* Strings longer than a vector, with the non ASCII character at every position */
+static RESULT
+test_utf8_utf16_long (void)
+{
+	gchar utf8 [48];
+	gunichar2 utf16 [48];
+	RESULT result;
+	int pos, i;
+
+	for (pos = 0; pos < 40; pos++) {
+		for (i = 0; i < 40; i++) {
+			utf8 [i] = 'a' + (i % 26);
+			utf16 [i] = 'a' + (i % 26);
+		}
+		utf8 [40] = 0;
+		utf16 [40] = 0;
+
+		/* U+00E9 */
+		memmove (utf8 + pos + 1, utf8 + pos, 40 - pos);
+		utf8 [pos] = '\xC3';
+		utf8 [pos + 1] = '\xA9';
+		utf8 [41] = 0;
+		utf16 [pos] = 0xE9;
+
+		result = compare_utf8_to_utf16 (utf16, utf8, 41, 40);
+		if (result != OK)
+			return result;
+		result = compare_utf16_to_utf8 (utf8, utf16, 40, 41);
+		if (result != OK)
+			return result;
+	}
+
+	return OK;
+}
+
 static RESULT
 test_utf8_to_utf16_with_nuls (void)
 {
@@ -641,6 +676,7 @@ static Test utf8_tests [] = {
 	{"g_utf16_to_utf8", test_utf16_to_utf8},
 	{"g_utf8_to_utf16", test_utf8_to_utf16},
 	{"g_utf8_to_utf16_nuls", test_utf8_to_utf16_with_nuls},
+	{"g_utf8_utf16_long", test_utf8_utf16_long},
 	{"g_utf8_seq", test_utf8_seq},
 	{"g_ucs4_to_utf16", test_ucs4_to_utf16 },
 	{"g_utf16_to_ucs4", test_utf16_to_ucs4 },
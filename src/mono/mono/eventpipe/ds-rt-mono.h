@@ -166,6 +166,17 @@ ds_rt_generate_core_dump (
 	return DS_IPC_E_NOTSUPPORTED;
 }
 
+static
+inline
+ds_ipc_result_t
+ds_rt_generate_heap_snapshot (
+	DiagnosticsGenerateHeapSnapshotCommandPayload *payload,
+	DiagnosticsHeapSnapshotWriter *writer)
+{
+	// TODO: Implement.
+	return DS_IPC_E_NOTSUPPORTED;
+}
+
 /*
  * DiagnosticsIpc.
  */
@@ -628,6 +628,30 @@ ep_rt_config_value_get_enable_stackwalk (void)
 	return value_uint32_t != 0;
 }
 
+static
+inline
+uint32_t
+ep_rt_config_value_get_sample_interval_us (void)
+{
+	uint32_t interval_us = 0;
+	gchar *value = g_getenv ("DOTNET_EventPipeSampleIntervalMicroseconds");
+	if (!value)
+		value = g_getenv ("COMPlus_EventPipeSampleIntervalMicroseconds");
+	if (value)
+		interval_us = strtoul (value, NULL, 10);
+	g_free (value);
+	return interval_us;
+}
+
+static
+inline
+bool
+ep_rt_config_value_get_sample_cpu_time_only (void)
+{
+	// Not supported, the Mono sampler has no per thread CPU time source.
+	return false;
+}
+
 /*
  * EventPipeSampleProfiler.
  */
@@ -639,6 +663,14 @@ ep_rt_sample_profiler_write_sampling_event_for_threads (ep_rt_thread_handle_t sa
 	ep_rt_mono_sample_profiler_write_sampling_event_for_threads (sampling_thread, sampling_event);
 }
 
+static
+void
+ep_rt_sample_profiler_stopped (void)
+{
+	// Hardware counters are not supported, nothing is kept per sampled thread.
+	;
+}
+
 static
 void
 ep_rt_notify_profiler_provider_created (EventPipeProvider *provider)
@@ -820,8 +852,12 @@ ep_rt_is_running (void)
 static
 inline
 void
-ep_rt_execute_rundown (dn_vector_ptr_t *execution_checkpoints)
+ep_rt_execute_rundown (
+	dn_vector_ptr_t *execution_checkpoints,
+	const uintptr_t *method_ips,
+	uint32_t method_ips_len)
 {
+	// Mono always does a full rundown, method_ips is ignored.
 	if (ep_rt_config_value_get_rundown () > 0) {
 		// Ask the runtime to emit rundown events.
 		if (/*is_running &&*/ !ep_rt_process_shutdown ()) {
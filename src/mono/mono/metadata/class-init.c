@@ -44,6 +44,9 @@ gboolean mono_align_small_structs = FALSE;
 static gint32 classes_size;
 static gint32 inflated_classes_size;
 gint32 mono_inflated_methods_size;
+/* Lookups of these caches are lock-free, these count the inserts that lost a race */
+gint32 mono_inflated_method_cache_races;
+gint32 mono_generic_inst_cache_races;
 static gint32 class_def_count, class_gtd_count, class_ginst_count, class_gparam_count, class_array_count, class_pointer_count;
 
 typedef struct {
@@ -4357,6 +4360,10 @@ mono_classes_init (void)
 							MONO_COUNTER_GENERICS | MONO_COUNTER_INT, &mono_inflated_methods_size);
 	mono_counters_register ("Inflated classes size",
 							MONO_COUNTER_GENERICS | MONO_COUNTER_INT, &inflated_classes_size);
+	mono_counters_register ("Inflated method cache races",
+							MONO_COUNTER_GENERICS | MONO_COUNTER_INT, &mono_inflated_method_cache_races);
+	mono_counters_register ("Generic inst cache races",
+							MONO_COUNTER_GENERICS | MONO_COUNTER_INT, &mono_generic_inst_cache_races);
 	mono_counters_register ("MonoClass size",
 							MONO_COUNTER_METADATA | MONO_COUNTER_INT, &classes_size);
 }
@@ -57,6 +57,7 @@ MonoStats mono_stats;
 
 /* Statistics */
 extern gint32 mono_inflated_methods_size;
+extern gint32 mono_inflated_method_cache_races;
 
 static gboolean can_access_type (MonoClass *access_klass, MonoClass *member_klass);
 
@@ -1248,12 +1249,18 @@ mono_class_inflate_generic_method_full_checked (MonoMethod *method, MonoClass *k
 
 	MonoMemoryManager *mm = mono_metadata_get_mem_manager_for_method (iresult);
 
-	// check cache
-	mono_mem_manager_lock (mm);
-	if (!mm->gmethod_cache)
-		mm->gmethod_cache = dn_simdhash_ght_new_full (inflated_method_hash, inflated_method_equal, NULL, (GDestroyNotify)free_inflated_method, 0, NULL);
-	dn_simdhash_ght_try_get_value (mm->gmethod_cache, iresult, (void **)&cached);
-	mono_mem_manager_unlock (mm);
+	if (!mm->gmethod_cache) {
+		mono_mem_manager_lock (mm);
+		if (!mm->gmethod_cache) {
+			MonoConcurrentHashTable *cache = mono_conc_hashtable_new_full (inflated_method_hash, inflated_method_equal, NULL, (GDestroyNotify)free_inflated_method);
+			mono_memory_barrier ();
+			mm->gmethod_cache = cache;
+		}
+		mono_mem_manager_unlock (mm);
+	}
+
+	// check cache, lookups don't take the lock
+	cached = (MonoMethodInflated*)mono_conc_hashtable_lookup (mm->gmethod_cache, iresult);
 
 	if (cached) {
 		g_free (iresult);
@@ -1356,14 +1363,16 @@ mono_class_inflate_generic_method_full_checked (MonoMethod *method, MonoClass *k
 	 * is_generic_method_definition().
 	 */
 
-	// check cache
+	// check cache, inserts are serialized by the mem manager lock
 	mono_mem_manager_lock (mm);
-	cached = NULL;
-	dn_simdhash_ght_try_get_value (mm->gmethod_cache, iresult, (void **)&cached);
+	cached = (MonoMethodInflated*)mono_conc_hashtable_lookup (mm->gmethod_cache, iresult);
 	if (!cached) {
-		dn_simdhash_ght_insert (mm->gmethod_cache, iresult, iresult);
 		iresult->owner = mm;
+		mono_conc_hashtable_insert (mm->gmethod_cache, iresult, iresult);
 		cached = iresult;
+	} else {
+		/* Another thread inflated the same method while we did */
+		UnlockedIncrement (&mono_inflated_method_cache_races);
 	}
 	mono_mem_manager_unlock (mm);
 
@@ -238,8 +238,10 @@ memory_manager_delete (MonoMemoryManager *memory_manager, gboolean debug_unload)
 	MonoMemoryManager *mm = memory_manager;
 	if (mm->gclass_cache)
 		mono_conc_hashtable_destroy (mm->gclass_cache);
-	free_simdhash (&mm->ginst_cache);
-	free_simdhash (&mm->gmethod_cache);
+	if (mm->ginst_cache)
+		mono_conc_hashtable_destroy (mm->ginst_cache);
+	if (mm->gmethod_cache)
+		mono_conc_hashtable_destroy (mm->gmethod_cache);
 	free_simdhash (&mm->gsignature_cache);
 	free_hash (&mm->szarray_cache);
 	free_hash (&mm->array_cache);
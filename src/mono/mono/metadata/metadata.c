@@ -1848,6 +1848,7 @@ builtin_types[] = {
 
 static GHashTable *type_cache = NULL;
 static gint32 next_generic_inst_id = 0;
+extern gint32 mono_generic_inst_cache_races;
 
 static guint mono_generic_class_hash (gconstpointer data);
 
@@ -3495,15 +3496,28 @@ mono_metadata_get_canonical_generic_inst (MonoGenericInst *candidate)
 	MonoMemoryManager *mm = mono_mem_manager_get_generic (data.images, data.nimages);
 	collect_data_free (&data);
 
+	if (!mm->ginst_cache) {
+		mono_mem_manager_lock (mm);
+		if (!mm->ginst_cache) {
+			MonoConcurrentHashTable *cache = mono_conc_hashtable_new_full (mono_metadata_generic_inst_hash, mono_metadata_generic_inst_equal, NULL, (GDestroyNotify)free_generic_inst);
+			mono_memory_barrier ();
+			mm->ginst_cache = cache;
+		}
+		mono_mem_manager_unlock (mm);
+	}
+
+	MonoGenericInst *ginst = (MonoGenericInst *)mono_conc_hashtable_lookup (mm->ginst_cache, candidate);
+	if (ginst)
+		return ginst;
+
 	// Hashtable key equal func can take loader lock
 	mono_loader_lock ();
 
-	if (!mm->ginst_cache)
-		mm->ginst_cache = dn_simdhash_ght_new_full (mono_metadata_generic_inst_hash, mono_metadata_generic_inst_equal, NULL, (GDestroyNotify)free_generic_inst, 0, NULL);
-
-	MonoGenericInst *ginst = NULL;
-	dn_simdhash_ght_try_get_value (mm->ginst_cache, candidate, (void **)&ginst);
-	if (!ginst) {
+	ginst = (MonoGenericInst *)mono_conc_hashtable_lookup (mm->ginst_cache, candidate);
+	if (ginst) {
+		/* Another thread added the same instance since the lookup above */
+		UnlockedIncrement (&mono_generic_inst_cache_races);
+	} else {
 		int size = MONO_SIZEOF_GENERIC_INST + type_argc * sizeof (MonoType *);
 		ginst = (MonoGenericInst *)mono_mem_manager_alloc0 (mm, size);
 #ifndef MONO_SMALL_CONFIG
@@ -3516,7 +3530,7 @@ mono_metadata_get_canonical_generic_inst (MonoGenericInst *candidate)
 		for (int i = 0; i < type_argc; ++i)
 			ginst->type_argv [i] = mono_metadata_type_dup (NULL, candidate->type_argv [i]);
 
-		dn_simdhash_ght_insert (mm->ginst_cache, ginst, ginst);
+		mono_conc_hashtable_insert (mm->ginst_cache, ginst, ginst);
 	}
 
 	mono_loader_unlock ();
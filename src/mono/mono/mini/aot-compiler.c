@@ -4355,6 +4355,9 @@ add_method_with_index (MonoAotCompile *acfg, MonoMethod *method, int index, gboo
 static gboolean
 prefer_gsharedvt_method (MonoAotCompile *acfg, MonoMethod *method)
 {
+	/* Instances from a profile are compiled specialized, since they are known to be used */
+	if (g_hash_table_lookup (acfg->profile_methods, method))
+		return FALSE;
 	/* One instantiation with valuetypes is generated for each async method */
 	if (!acfg->aot_opts.profile_only && m_class_get_image (method->klass) == mono_defaults.corlib && (!strcmp (m_class_get_name (method->klass), "AsyncMethodBuilderCore") || !strcmp (m_class_get_name (method->klass), "AsyncVoidMethodBuilder")))
 		return TRUE;
@@ -1964,6 +1964,47 @@ register_methods_in_jinfo (MonoAotModule *amodule)
 }
 #endif
 
+/*
+ * get_method_address:
+ *
+ *   Return the address of the code of method METHOD_INDEX of AMODULE, or -1 if it has no code.
+ * The address is decoded on first use and cached in amodule->methods. Threads racing to
+ * decode an entry compute the same value, so no locking is needed.
+ */
+static gpointer
+get_method_address (MonoAotModule *amodule, guint32 method_index)
+{
+	void *addr = amodule->methods [method_index];
+
+	if (G_LIKELY (addr))
+		return addr;
+
+	if (amodule->info.llvm_get_method) {
+		gpointer (*get_method) (int) = (gpointer (*)(int))amodule->info.llvm_get_method;
+
+		addr = get_method (method_index);
+	}
+
+	if (amodule->info.flags & MONO_AOT_FILE_FLAG_CODE_EXEC_ONLY) {
+		addr = ((gpointer*)amodule->info.method_addresses) [method_index];
+	} else {
+		/* method_addresses () contains a table of branches, since the ios linker can update those correctly */
+		if (!addr && amodule->info.method_addresses) {
+			addr = get_call_table_entry (amodule->info.method_addresses, method_index, amodule->info.call_table_entry_size);
+			g_assert (addr);
+			if (addr == amodule->info.method_addresses)
+				addr = NULL;
+			else
+				addr = method_address_resolve ((guint8 *) addr);
+		}
+	}
+	if (addr == NULL)
+		addr = GINT_TO_POINTER (-1);
+
+	amodule->methods [method_index] = addr;
+	return addr;
+}
+
 static void
 load_aot_module (MonoAssemblyLoadContext *alc, MonoAssembly *assembly, gpointer user_data, MonoError *error)
 {
@@ -2281,34 +2322,15 @@ load_aot_module (MonoAssemblyLoadContext *alc, MonoAssembly *assembly, gpointer
 		mscorlib_aot_module = amodule;
 	}
 
-	/* Compute method addresses */
+	/*
+	 * Method addresses are computed on first use by get_method_address (), since decoding them
+	 * all is a noticeable part of loading big images. Making the code unreadable requires
+	 * decoding the call table while it can still be read.
+	 */
 	amodule->methods = (void **)g_malloc0 (amodule->info.nmethods * sizeof (gpointer));
-	for (guint32 i = 0; i < amodule->info.nmethods; ++i) {
-		void *addr = NULL;
-
-		if (amodule->info.llvm_get_method) {
-			gpointer (*get_method) (int) = (gpointer (*)(int))amodule->info.llvm_get_method;
-
-			addr = get_method (i);
-		}
-
-		if (amodule->info.flags & MONO_AOT_FILE_FLAG_CODE_EXEC_ONLY) {
-			addr = ((gpointer*)amodule->info.method_addresses) [i];
-		} else {
-			/* method_addresses () contains a table of branches, since the ios linker can update those correctly */
-			if (!addr && amodule->info.method_addresses) {
-				addr = get_call_table_entry (amodule->info.method_addresses, i, amodule->info.call_table_entry_size);
-				g_assert (addr);
-				if (addr == amodule->info.method_addresses)
-					addr = NULL;
-				else
-					addr = method_address_resolve ((guint8 *) addr);
-			}
-		}
-		if (addr == NULL)
-			amodule->methods [i] = GINT_TO_POINTER (-1);
-		else
-			amodule->methods [i] = addr;
+	if (make_unreadable) {
+		for (guint32 i = 0; i < amodule->info.nmethods; ++i)
+			get_method_address (amodule, i);
 	}
 
 	if (make_unreadable) {
@@ -2868,8 +2890,8 @@ compute_llvm_code_range (MonoAotModule *amodule, guint8 **code_start, guint8 **c
 	table = (gint32*)p;
 
 	if (fde_count > 0) {
-		*code_start = (guint8 *)amodule->methods [table [0]];
-		*code_end = (guint8*)amodule->methods [table [(fde_count - 1) * 2]] + table [fde_count * 2];
+		*code_start = (guint8 *)get_method_address (amodule, table [0]);
+		*code_end = (guint8*)get_method_address (amodule, table [(fde_count - 1) * 2]) + table [fde_count * 2];
 	} else {
 		*code_start = NULL;
 		*code_end = NULL;
@@ -2968,12 +2990,12 @@ decode_llvm_mono_eh_frame (MonoAotModule *amodule, MonoJitInfo *jinfo,
 
 		/* The table contains method index/fde offset pairs */
 		g_assert (table [(pos * 2)] != -1);
-		code1 = (guint8 *)amodule->methods [table [(pos * 2)]];
+		code1 = (guint8 *)get_method_address (amodule, table [(pos * 2)]);
 		if (pos + 1 == fde_count) {
 			code2 = amodule->llvm_code_end;
 		} else {
 			g_assert (table [(pos + 1) * 2] != -1);
-			code2 = (guint8 *)amodule->methods [table [(pos + 1) * 2]];
+			code2 = (guint8 *)get_method_address (amodule, table [(pos + 1) * 2]);
 		}
 
 		if (code < code1)
@@ -2984,13 +3006,13 @@ decode_llvm_mono_eh_frame (MonoAotModule *amodule, MonoJitInfo *jinfo,
 			break;
 	}
 
-	code_start = (guint8 *)amodule->methods [table [(pos * 2)]];
+	code_start = (guint8 *)get_method_address (amodule, table [(pos * 2)]);
 	if (pos + 1 == fde_count) {
 		/* The +1 entry in the table contains the length of the last method */
 		int len = table [(pos + 1) * 2];
 		code_end = code_start + len;
 	} else {
-		code_end = (guint8 *)amodule->methods [table [(pos + 1) * 2]];
+		code_end = (guint8 *)get_method_address (amodule, table [(pos + 1) * 2]);
 	}
 	if (!code_len)
 		code_len = GPTRDIFF_TO_UINT32 (code_end - code_start);
@@ -3573,9 +3595,10 @@ sort_methods (MonoAotModule *amodule)
 
 	for (int i = 0; i < nmethods; ++i) {
 		/* Skip the -1 entries to speed up sorting */
-		if (amodule->methods [i] == GINT_TO_POINTER (-1))
+		gpointer addr = get_method_address (amodule, i);
+		if (addr == GINT_TO_POINTER (-1))
 			continue;
-		methods [methods_len] = amodule->methods [i];
+		methods [methods_len] = addr;
 		method_indexes [methods_len] = i;
 		methods_len ++;
 	}
@@ -3689,7 +3712,7 @@ mono_aot_find_jit_info (MonoImage *image, gpointer addr)
 		}
 	}
 
-	code = (guint8 *)amodule->methods [method_index];
+	code = (guint8 *)get_method_address (amodule, method_index);
 	if (mono_llvm_only)
 		ex_info = NULL;
 	else
@@ -4330,12 +4353,12 @@ load_method (MonoAotModule *amodule, MonoImage *image, MonoMethod *method, guint
 
 	if (!code) {
 		if (GINT_TO_UINT32(method_index) < amodule->info.nmethods)
-			code = (guint8*)MINI_ADDR_TO_FTNPTR ((guint8 *)amodule->methods [method_index]);
+			code = (guint8*)MINI_ADDR_TO_FTNPTR ((guint8 *)get_method_address (amodule, method_index));
 		else
 			return NULL;
 
 		/* JITted method */
-		if (amodule->methods [method_index] == GINT_TO_POINTER (-1)) {
+		if (get_method_address (amodule, method_index) == GINT_TO_POINTER (-1)) {
 			if (mono_trace_is_traced (G_LOG_LEVEL_DEBUG, MONO_TRACE_AOT)) {
 				char *full_name;
 
@@ -4763,7 +4786,7 @@ init_method (MonoAotModule *amodule, gpointer info, guint32 method_index, MonoMe
 	method_index = encoded_method_index;
 	p += 4;
 
-	code = (guint8 *)amodule->methods [method_index];
+	code = (guint8 *)get_method_address (amodule, method_index);
 	guint8 flags = amodule->method_flags_table [method_index];
 
 	if (flags & MONO_AOT_METHOD_FLAG_HAS_CCTOR)
@@ -4927,6 +4950,7 @@ mono_aot_get_method (MonoMethod *method, MonoError *error)
 	MonoImage *image = m_class_get_image (klass);
 	guint8 *code = NULL;
 	gboolean cache_result = FALSE;
+	gboolean using_gsharedvt = FALSE;
 	ERROR_DECL (inner_error);
 
 	error_init (error);
@@ -5139,6 +5163,7 @@ mono_aot_get_method (MonoMethod *method, MonoError *error)
 				method = mini_get_shared_method_full (method, SHARE_MODE_GSHAREDVT, error);
 				if (!method)
 					return NULL;
+				using_gsharedvt = TRUE;
 			}
 		}
 
@@ -5186,6 +5211,16 @@ mono_aot_get_method (MonoMethod *method, MonoError *error)
 	code = (guint8 *)load_method (amodule, m_class_get_image (klass), method, method->token, method_index, error);
 	if (!is_ok (error))
 		return NULL;
+	if (code && using_gsharedvt && MONO_PROFILER_ENABLED (jit_done)) {
+		/*
+		 * load_method () only reports the gsharedvt method, once. Report the instance too, so
+		 * profiles collected on full-AOT runs (e.g. by the AOT profiler) include the value type
+		 * instantiations, which can then be AOT compiled specialized.
+		 */
+		MonoJitInfo *jinfo = mono_jit_info_table_find_internal (code, TRUE, FALSE);
+		if (jinfo)
+			MONO_PROFILER_RAISE (jit_done, (orig_method, jinfo));
+	}
 	if (code && cache_result) {
 		amodule_lock (amodule);
 		dn_simdhash_ptr_ptr_try_add (amodule->method_to_code, orig_method, code);
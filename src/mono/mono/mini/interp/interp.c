@@ -785,6 +785,56 @@ get_virtual_method_fast (InterpMethod *imethod, MonoVTable *vtable, int offset)
 	}
 }
 
+/*
+ * Monomorphic inline cache of a MINT_CALLVIRT_FAST call site. Entries are immutable, a miss
+ * publishes a new one, so readers never see a vtable paired with another vtable's target.
+ */
+typedef struct {
+	MonoVTable *vtable;
+	InterpMethod *target;
+	guint32 misses;
+} InterpVirtualCallCache;
+
+/* Sites that keep missing are polymorphic, stop replacing their entry */
+#define INTERP_VIRTUAL_CALL_CACHE_MAX_MISSES 8
+
+static InterpMethod* // Inlining causes additional stack use in caller.
+get_virtual_method_cached (InterpFrame *frame, InterpMethod *imethod, MonoVTable *vtable, int offset, gpointer *cache_slot)
+{
+	InterpVirtualCallCache *cache = (InterpVirtualCallCache*)*cache_slot;
+	InterpMethod *target_imethod;
+
+	if (G_LIKELY (cache && cache->vtable == vtable)) {
+		target_imethod = cache->target;
+		/* The cache is not a tiering patch site, pick up the optimized code here instead */
+		if (target_imethod->optimized_imethod)
+			target_imethod = target_imethod->optimized_imethod;
+		return target_imethod;
+	}
+
+	target_imethod = get_virtual_method_fast (imethod, vtable, offset);
+
+	/*
+	 * Lookups are what the cache can't remove, so they count towards tiering up the caller,
+	 * where the optimizing transform gets a chance to devirtualize the call.
+	 */
+	if (cache && !frame->imethod->optimized)
+		frame->imethod->entry_count += INTERP_TIER_CALLVIRT_MISS_WEIGHT;
+
+	guint32 misses = cache ? cache->misses + 1 : 0;
+	/* Entries are never freed, so don't cache vtables that can be unloaded before the caller */
+	if (misses <= INTERP_VIRTUAL_CALL_CACHE_MAX_MISSES && !m_class_get_mem_manager (vtable->klass)->collectible) {
+		InterpVirtualCallCache *new_cache = (InterpVirtualCallCache*)m_method_alloc0 (frame->imethod->method, sizeof (InterpVirtualCallCache));
+		new_cache->vtable = vtable;
+		new_cache->target = target_imethod;
+		new_cache->misses = misses;
+		mono_memory_barrier ();
+		*cache_slot = new_cache;
+	}
+
+	return target_imethod;
+}
+
 static void
 stackval_from_data (MonoType *type, stackval *result, const void *data, gboolean pinvoke)
 {
@@ -3582,7 +3632,53 @@ interp_free_method (MonoMethod *method)
 #if COUNT_OPS
 static long opcode_counts[MINT_LASTOP];
 
-#define COUNT_OP(op) opcode_counts[op]++
+/*
+ * Counts of opcodes executed back to back, which is the data for picking new superinstructions
+ * in transform-opt.c. They are counted per dispatch, so pairs spanning a branch, call or return
+ * are included; only sequences within a basic block can be fused. Like opcode_counts, this is
+ * a single-threaded diagnostic.
+ */
+static long *opcode_pair_counts;
+
+#define OPCODE_TRIPLE_TABLE_SIZE (1 << 18)
+typedef struct {
+	guint64 key;
+	long count;
+} OpcodeTripleCount;
+static OpcodeTripleCount opcode_triple_counts [OPCODE_TRIPLE_TABLE_SIZE];
+static int last_opcodes [2] = { -1, -1 };
+
+static void
+count_op (int op)
+{
+	opcode_counts [op]++;
+
+	if (last_opcodes [0] != -1) {
+		if (!opcode_pair_counts)
+			opcode_pair_counts = g_new0 (long, MINT_LASTOP * MINT_LASTOP);
+		opcode_pair_counts [last_opcodes [0] * MINT_LASTOP + op]++;
+	}
+
+	if (last_opcodes [1] != -1) {
+		guint64 key = ((guint64)last_opcodes [1] << 32) | ((guint64)last_opcodes [0] << 16) | (guint64)op;
+		guint32 index = (guint32)((key * 0x9E3779B97F4A7C15ULL) >> 46);
+		// Linear probing; once the table is full, new triples are dropped.
+		for (int i = 0; i < OPCODE_TRIPLE_TABLE_SIZE; i++) {
+			OpcodeTripleCount *entry = &opcode_triple_counts [(index + i) & (OPCODE_TRIPLE_TABLE_SIZE - 1)];
+			if (entry->count == 0)
+				entry->key = key;
+			if (entry->key == key) {
+				entry->count++;
+				break;
+			}
+		}
+	}
+
+	last_opcodes [1] = last_opcodes [0];
+	last_opcodes [0] = op;
+}
+
+#define COUNT_OP(op) count_op (op)
 #else
 #define COUNT_OP(op)
 #endif
@@ -4276,9 +4372,10 @@ main_loop:
 			NULL_CHECK (this_arg);
 
 			slot = (gint16)ip [4];
-			ip += 5;
+			gpointer *cache_slot = &frame->imethod->data_items [ip [5]];
+			ip += 6;
 			// FIXME push/pop LMF
-			cmethod = get_virtual_method_fast (cmethod, this_arg->vtable, slot);
+			cmethod = get_virtual_method_cached (frame, cmethod, this_arg->vtable, slot, cache_slot);
 			if (m_class_is_valuetype (cmethod->method->klass)) {
 				/* unbox */
 				gpointer unboxed = mono_object_unbox_internal (this_arg);
@@ -8700,6 +8797,63 @@ opcode_count_comparer (const void * pa, const void * pb)
 		return 0;
 }
 
+#define OP_SEQUENCES_TO_PRINT 50
+
+static int
+op_sequence_count_comparer (const void * pa, const void * pb)
+{
+	long counta = ((const OpcodeTripleCount*)pa)->count;
+	long countb = ((const OpcodeTripleCount*)pb)->count;
+
+	if (counta < countb)
+		return 1;
+	else if (counta > countb)
+		return -1;
+	else
+		return 0;
+}
+
+// Prints the most frequent opcode pairs and triples, the candidates for new superinstructions.
+static void
+interp_print_op_sequence_counts (long total_ops)
+{
+	GArray *sequences = g_array_new (FALSE, FALSE, sizeof (OpcodeTripleCount));
+	guint i;
+
+	if (opcode_pair_counts) {
+		for (i = 0; i < MINT_LASTOP * MINT_LASTOP; i++) {
+			if (opcode_pair_counts [i]) {
+				OpcodeTripleCount pair = { i, opcode_pair_counts [i] };
+				g_array_append_val (sequences, pair);
+			}
+		}
+	}
+	qsort (sequences->data, sequences->len, sizeof (OpcodeTripleCount), op_sequence_count_comparer);
+
+	g_print ("hot opcode pairs\n");
+	for (i = 0; i < sequences->len && i < OP_SEQUENCES_TO_PRINT; i++) {
+		OpcodeTripleCount *pair = &g_array_index (sequences, OpcodeTripleCount, i);
+		g_print ("%s, %s : %ld (%.2lf%%)\n", mono_interp_opname ((int)(pair->key / MINT_LASTOP)), mono_interp_opname ((int)(pair->key % MINT_LASTOP)),
+			pair->count, (double)pair->count / total_ops * 100);
+	}
+
+	g_array_set_size (sequences, 0);
+	for (i = 0; i < OPCODE_TRIPLE_TABLE_SIZE; i++) {
+		if (opcode_triple_counts [i].count)
+			g_array_append_val (sequences, opcode_triple_counts [i]);
+	}
+	qsort (sequences->data, sequences->len, sizeof (OpcodeTripleCount), op_sequence_count_comparer);
+
+	g_print ("hot opcode triples\n");
+	for (i = 0; i < sequences->len && i < OP_SEQUENCES_TO_PRINT; i++) {
+		OpcodeTripleCount *triple = &g_array_index (sequences, OpcodeTripleCount, i);
+		g_print ("%s, %s, %s : %ld (%.2lf%%)\n", mono_interp_opname ((int)(triple->key >> 32)), mono_interp_opname ((int)((triple->key >> 16) & 0xffff)),
+			mono_interp_opname ((int)(triple->key & 0xffff)), triple->count, (double)triple->count / total_ops * 100);
+	}
+
+	g_array_free (sequences, TRUE);
+}
+
 static void
 interp_print_op_count (void)
 {
@@ -8718,6 +8872,8 @@ interp_print_op_count (void)
 		long count = opcode_counts [ordered_ops [i]];
 		g_print ("%s : %ld (%.2lf%%)\n", mono_interp_opname (ordered_ops [i]), count, (double)count / total_ops * 100);
 	}
+
+	interp_print_op_sequence_counts (total_ops);
 }
 #endif
 
@@ -4,6 +4,8 @@
 #include "interp-internals.h"
 
 #define INTERP_TIER_ENTRY_LIMIT 1000
+// Added to the caller's entry count when a virtual call site misses its inline cache
+#define INTERP_TIER_CALLVIRT_MISS_WEIGHT 8
 
 void
 mono_interp_tiering_init (void);
@@ -4017,6 +4017,8 @@ interp_transform_call (TransformData *td, MonoMethod *method, MonoMethod *target
 			} else if (is_virtual) {
 				interp_add_ins (td, MINT_CALLVIRT_FAST);
 				td->last_ins->data [1] = get_virt_method_slot (target_method);
+				/* Inline cache slot */
+				td->last_ins->data [2] = get_data_item_index_nonshared (td, NULL);
 				null_check->opcode = MINT_MOV_P;
 			} else {
 				interp_add_ins (td, MINT_CALL);
@@ -9709,9 +9711,8 @@ tiered_patcher (MiniTieredPatchPointContext *ctx, gpointer patchsite)
 	if (!jit_call2_supported (m, mono_method_signature_internal (m)))
 		return FALSE;
 
-	/* TODO: Force compilation here. Currently the JIT will be invoked upon
-	 *       first execution of `MINT_JIT_CALL2`. */
-	InterpMethod *rmethod = mono_interp_get_imethod (cm);
+	/* The method has already been compiled by the tiered compilation thread. */
+	InterpMethod *rmethod = mono_interp_get_imethod (m);
 
 	guint16 *ip = ((guint16 *) patchsite);
 	*ip++ = MINT_JIT_CALL2;
@@ -417,47 +417,75 @@ mono_linear_scan2 (MonoCompile *cfg, GList *vars, GList *regs, regmask_t *used_m
 			/*
 			 * free_pos [reg] > 0 means there is a register available for parts
 			 * of the interval, so splitting it is possible. This is not yet
-			 * supported, so we spill in this case too.
+			 * supported, since a regvar lives in one hreg for the whole method.
+			 *
+			 * Instead, pick the register whose conflicting intervals (the active
+			 * ones and the inactive ones intersecting the current interval) are
+			 * cheapest to spill, and spill them if that is cheaper than spilling
+			 * the current interval.
 			 */
+			gint32 spill_cost [sizeof (regmask_t) * 8];
+			gint32 min_spill_cost;
 
-			/* Spill an interval */
+			memset (spill_cost, 0, n_regs * sizeof (gint32));
+			for (l = active; l != NULL; l = l->next) {
+				MonoMethodVar *v = (MonoMethodVar*)l->data;
+
+				if (v->reg >= 0)
+					spill_cost [v->reg] += v->spill_costs;
+			}
+			for (l = inactive; l != NULL; l = l->next) {
+				MonoMethodVar *v = (MonoMethodVar*)l->data;
 
-			/* FIXME: Optimize the selection of the interval */
+				if (v->reg >= 0 && mono_linterval_get_intersect_pos (current->interval, v->interval) != -1)
+					spill_cost [v->reg] += v->spill_costs;
+			}
 
-			if (active) {
-				GList *min_spill_pos;
-#if 0
-				/*
-				 * This favors registers with big spill costs, thus larger liveness ranges,
-				 * thus actually leading to worse code size.
-				 */
-				guint32 min_spill_value = G_MAXINT32;
+			reg = -1;
+			min_spill_cost = G_MAXINT32;
+			for (i = 0; i < n_regs; ++i) {
+				if (spill_cost [i] < min_spill_cost) {
+					reg = i;
+					min_spill_cost = spill_cost [i];
+				}
+			}
 
-				for (l = active; l != NULL; l = l->next) {
+			g_assert (reg != -1);
+
+			if (min_spill_cost < current->spill_costs) {
+				GList *next;
+
+				for (l = active; l != NULL; l = next) {
 					vmv = (MonoMethodVar*)l->data;
+					next = l->next;
 
-					if (vmv->spill_costs < min_spill_value) {
-						min_spill_pos = l;
-						min_spill_value = vmv->spill_costs;
+					if (vmv->reg == reg) {
+						gains [vmv->reg] -= vmv->spill_costs;
+						vmv->reg = -1;
+						LSCAN_DEBUG (printf ("\tSpilled R%d\n", cfg->varinfo [vmv->idx]->dreg));
+						active = g_list_delete_link (active, l);
 					}
 				}
-#else
-				/* Spill either the first active or the current interval */
-				min_spill_pos = active;
-#endif
-				vmv = (MonoMethodVar*)min_spill_pos->data;
-				if (vmv->spill_costs < current->spill_costs) {
-				//				if (vmv->interval->last_range->to < current->interval->last_range->to) {
-					gains [vmv->reg] -= vmv->spill_costs;
-					vmv->reg = -1;
-					LSCAN_DEBUG (printf ("\tSpilled R%d\n", cfg->varinfo [vmv->idx]->dreg));
-					active = g_list_delete_link (active, min_spill_pos);
+				for (l = inactive; l != NULL; l = next) {
+					vmv = (MonoMethodVar*)l->data;
+					next = l->next;
+
+					if (vmv->reg == reg && mono_linterval_get_intersect_pos (current->interval, vmv->interval) != -1) {
+						gains [vmv->reg] -= vmv->spill_costs;
+						vmv->reg = -1;
+						LSCAN_DEBUG (printf ("\tSpilled inactive R%d\n", cfg->varinfo [vmv->idx]->dreg));
+						inactive = g_list_delete_link (inactive, l);
+					}
 				}
-				else
-					LSCAN_DEBUG (printf ("\tSpilled current (cost %d)\n", current->spill_costs));
+
+				current->reg = reg;
+				LSCAN_DEBUG (printf ("\tAssigned hreg %d to R%d\n", reg, cfg->varinfo [current->idx]->dreg));
+
+				active = g_list_append (active, current);
+				gains [current->reg] += current->spill_costs;
 			}
 			else
-				LSCAN_DEBUG (printf ("\tSpilled current\n"));
+				LSCAN_DEBUG (printf ("\tSpilled current (cost %d)\n", current->spill_costs));
 		}
 	}
 
@@ -4150,8 +4150,14 @@ mono_jit_compile_method_inner (MonoMethod *method, int opt, MonoError *error)
 
 	error_init (error);
 
+	JitFlags flags = JIT_FLAG_RUN_CCTORS;
+#if defined(ENABLE_EXPERIMENT_TIERED) && defined(ENABLE_LLVM)
+	if (mono_opt_tiered_llvm && mini_tiered_is_compiler_thread ())
+		flags = (JitFlags)(flags | JIT_FLAG_LLVM);
+#endif
+
 	start = mono_time_track_start ();
-	cfg = mini_method_compile (method, opt, JIT_FLAG_RUN_CCTORS, 0, -1);
+	cfg = mini_method_compile (method, opt, flags, 0, -1);
 	gint64 jit_time = 0;
 	mono_time_track_end (&jit_time, start);
 	UnlockedAdd64 (&mono_jit_stats.jit_time, jit_time);
@@ -25,6 +25,8 @@ static const char* const patch_kind_str[] = {
 
 static GHashTable *callsites_hash [TIERED_PATCH_KIND_NUM] = { NULL };
 
+static MonoInternalThread *compiler_thread_internal;
+
 /* TODO: use scientific methods (TM) to determine values */
 static const int threshold [NUM_TIERS] = {
 	1000, /* tier 0 */
@@ -39,6 +41,7 @@ compiler_thread (void)
 	internal->flags |= MONO_THREAD_FLAG_DONT_MANAGE;
 
 	mono_native_thread_set_name (mono_native_thread_id_get (), "Tiered Compilation Thread");
+	compiler_thread_internal = internal;
 
 	while (TRUE) {
 		mono_coop_cond_wait (&compilation_wait, &compilation_mutex);
@@ -50,6 +53,17 @@ compiler_thread (void)
 			for (GSList *ppc_= ppcs; ppc_ != NULL; ppc_ = ppc_->next) {
 				MiniTieredPatchPointContext *ppc = (MiniTieredPatchPointContext *) ppc_->data;
 
+				/*
+				 * Compile the method here, so the threads running it don't stall in the JIT
+				 * when they reach a patched callsite. With --tiered-llvm this uses the LLVM JIT,
+				 * see mini_tiered_is_compiler_thread ().
+				 */
+				ERROR_DECL (error);
+				if (!mono_jit_compile_method_jit_only (ppc->target_method, error)) {
+					mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "tiered: couldn't compile %s: %s", mono_method_full_name (ppc->target_method, TRUE), mono_error_get_message (error));
+					mono_error_cleanup (error);
+				}
+
 				for (int patch_kind = 0; patch_kind < TIERED_PATCH_KIND_NUM; patch_kind++) {
 					if (!callsites_hash [patch_kind])
 						continue;
@@ -102,6 +116,16 @@ mini_tiered_register_callsite_patcher (CallsitePatcher func, int level)
 	patchers [level] = func;
 }
 
+/*
+ * Methods compiled on the compilation thread are the ones that have been promoted, so these
+ * are the ones worth the LLVM compile time.
+ */
+gboolean
+mini_tiered_is_compiler_thread (void)
+{
+	return compiler_thread_internal && mono_thread_internal_current () == compiler_thread_internal;
+}
+
 void
 mini_tiered_record_callsite (gpointer ip, MonoMethod *target_method, int patch_kind)
 {
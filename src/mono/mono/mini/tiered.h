@@ -35,5 +35,8 @@ mini_tiered_record_callsite (gpointer callsite, MonoMethod *target_method, int l
 void
 mini_tiered_register_callsite_patcher (CallsitePatcher func, int level);
 
+gboolean
+mini_tiered_is_compiler_thread (void);
+
 #endif /* __MONO_MINI_TIERED_H__ */
 #endif /* ENABLE_EXPERIMENT_TIERED */
@@ -55,6 +55,10 @@ static guint64 bytes_allocated_attached = 0;
 /* Total bytes allocated so far in program execution by detached threads */
 static guint64 bytes_allocated_detached = 0;
 
+static guint64 stat_tlab_refills = 0;
+static guint64 stat_tlab_grows = 0;
+static guint64 stat_tlab_shrinks = 0;
+
 /*
  * Allocation is done from a Thread Local Allocation Buffer (TLAB). TLABs are allocated
  * from nursery fragments.
@@ -63,12 +67,16 @@ static guint64 bytes_allocated_detached = 0;
  * tlab_temp_end is the pointer to the end of the temporary space reserved for
  * the allocation: it allows us to set the scan starts at reasonable intervals.
  * tlab_real_end points to the end of the TLAB.
+ * tlab_size is the size the thread asks for when it needs a new TLAB. It is adjusted at
+ * each collection from the number of refills the thread did since the previous one.
  */
 
 #define TLAB_START	(__thread_info__->tlab_start)
 #define TLAB_NEXT	(__thread_info__->tlab_next)
 #define TLAB_TEMP_END	(__thread_info__->tlab_temp_end)
 #define TLAB_REAL_END	(__thread_info__->tlab_real_end)
+#define TLAB_SIZE	(__thread_info__->tlab_size)
+#define TLAB_REFILLS	(__thread_info__->tlab_refills)
 
 static void
 increment_thread_allocation_counter (size_t byte_size)
@@ -234,7 +242,7 @@ sgen_alloc_obj_nolock (GCVTable vtable, size_t size)
 				return alloc_degraded (vtable, size, FALSE);
 
 			available_in_tlab = (int)(TLAB_REAL_END - TLAB_NEXT);//We'll never have tlabs > 2Gb
-			if (size > sgen_tlab_size || available_in_tlab > SGEN_MAX_NURSERY_WASTE) {
+			if (size > TLAB_SIZE || available_in_tlab > SGEN_MAX_NURSERY_WASTE) {
 				/* Allocate directly from the nursery */
 				p = (void **)sgen_nursery_alloc (size);
 				if (!p) {
@@ -273,17 +281,18 @@ sgen_alloc_obj_nolock (GCVTable vtable, size_t size)
 					SGEN_LOG (3, "Retire TLAB: %p-%p [%ld]", TLAB_START, TLAB_REAL_END, (long)(TLAB_REAL_END - TLAB_NEXT - size));
 				sgen_nursery_retire_region (p, available_in_tlab);
 
-				p = (void **)sgen_nursery_alloc_range (sgen_tlab_size, size, &alloc_size);
+				p = (void **)sgen_nursery_alloc_range (TLAB_SIZE, size, &alloc_size);
 				if (!p) {
 					/* See comment above in similar case. */
-					sgen_ensure_free_space (sgen_tlab_size, GENERATION_NURSERY);
+					sgen_ensure_free_space (TLAB_SIZE, GENERATION_NURSERY);
 					if (!sgen_degraded_mode)
-						p = (void **)sgen_nursery_alloc_range (sgen_tlab_size, size, &alloc_size);
+						p = (void **)sgen_nursery_alloc_range (TLAB_SIZE, size, &alloc_size);
 				}
 				if (!p)
 					return alloc_degraded (vtable, size, TRUE);
 
 				increment_thread_allocation_counter (TLAB_NEXT - TLAB_START);
+				++TLAB_REFILLS;
 
 				/* Allocate a new TLAB from the current nursery fragment */
 				TLAB_START = (char*)p;
@@ -337,7 +346,7 @@ sgen_try_alloc_obj_nolock (GCVTable vtable, size_t size)
 	if (real_size > SGEN_MAX_SMALL_OBJ_SIZE)
 		return NULL;
 
-	if (G_UNLIKELY (size > sgen_tlab_size)) {
+	if (G_UNLIKELY (size > TLAB_SIZE)) {
 		/* Allocate directly from the nursery */
 
 		p = (void **)sgen_nursery_alloc (size);
@@ -383,12 +392,13 @@ sgen_try_alloc_obj_nolock (GCVTable vtable, size_t size)
 			size_t alloc_size = 0;
 
 			sgen_nursery_retire_region (p, available_in_tlab);
-			new_next = (char *)sgen_nursery_alloc_range (sgen_tlab_size, size, &alloc_size);
+			new_next = (char *)sgen_nursery_alloc_range (TLAB_SIZE, size, &alloc_size);
 			p = (void**)new_next;
 			if (!p)
 				return NULL;
 
 			increment_thread_allocation_counter (TLAB_NEXT - TLAB_START);
+			++TLAB_REFILLS;
 
 			TLAB_START = (char*)new_next;
 			TLAB_NEXT = new_next + size;
@@ -513,6 +523,33 @@ sgen_alloc_obj_mature (GCVTable vtable, size_t size)
 	return res;
 }
 
+/*
+ * Resize the thread's next TLAB from the number of TLABs it went through since the last
+ * collection.  Threads that refill often get bigger TLABs so they take the slow path less,
+ * threads that didn't get through half of their single TLAB go back towards sgen_tlab_size
+ * so they don't hold on to nursery space they won't use.
+ */
+static void
+resize_tlab (SgenThreadInfo *info)
+{
+	guint32 max_size = (guint32)MIN (SGEN_MAX_TLAB_SIZE, sgen_nursery_size / 32);
+
+	if (info->tlab_size < sgen_tlab_size)
+		info->tlab_size = sgen_tlab_size;
+
+	if (info->tlab_refills >= SGEN_TLAB_GROW_REFILLS && info->tlab_size < max_size) {
+		info->tlab_size = MAX (MIN (info->tlab_size * 2, max_size), sgen_tlab_size);
+		++stat_tlab_grows;
+	} else if (info->tlab_refills <= 1 && info->tlab_size > sgen_tlab_size &&
+			(mword)(info->tlab_next - info->tlab_start) < info->tlab_size / 2) {
+		info->tlab_size = MAX (info->tlab_size / 2, sgen_tlab_size);
+		++stat_tlab_shrinks;
+	}
+
+	stat_tlab_refills += info->tlab_refills;
+	info->tlab_refills = 0;
+}
+
 /*
  * Clear the thread local TLAB variables for all threads.
  */
@@ -525,6 +562,7 @@ sgen_clear_tlabs (void)
 		/* A new TLAB will be allocated when the thread does its first allocation */
 		info->total_bytes_allocated += info->tlab_next - info->tlab_start;
 		total_bytes_allocated_globally += info->total_bytes_allocated;
+		resize_tlab (info);
 		info->tlab_start = NULL;
 		info->tlab_next = NULL;
 		info->tlab_temp_end = NULL;
@@ -583,6 +621,9 @@ sgen_init_allocator (void)
 	mono_counters_register ("bytes allocated", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_bytes_alloced);
 	mono_counters_register ("bytes allocated in LOS", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_bytes_alloced_los);
 #endif
+	mono_counters_register ("# TLAB refills", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_tlab_refills);
+	mono_counters_register ("# TLAB size increases", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_tlab_grows);
+	mono_counters_register ("# TLAB size decreases", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_tlab_shrinks);
 }
 
 #endif /*HAVE_SGEN_GC*/
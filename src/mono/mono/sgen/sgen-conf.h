@@ -171,6 +171,15 @@ typedef target_mword SgenDescriptor;
 */
 #define SGEN_MAX_NURSERY_WASTE 512
 
+/*
+ * TLABs start out at sgen_tlab_size and are resized per thread at each collection: a
+ * thread that had to refill its TLAB at least SGEN_TLAB_GROW_REFILLS times since the
+ * previous collection gets a TLAB twice as big, up to SGEN_MAX_TLAB_SIZE, and a thread
+ * that used less than half of a single TLAB gets its size halved again.
+ */
+#define SGEN_MAX_TLAB_SIZE (1024 * 64)
+#define SGEN_TLAB_GROW_REFILLS 8
+
 
 /*
  * Max nursery size that we support.
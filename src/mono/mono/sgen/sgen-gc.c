@@ -221,6 +221,8 @@ static gboolean whole_heap_check_before_collection = FALSE;
 static gboolean remset_consistency_checks = FALSE;
 /* If set, do parallel copy/clear of remset */
 static gboolean remset_copy_clear_par = FALSE;
+/* Nurseries smaller than this are collected serially even with minor=simple-par */
+static size_t parallel_minor_min_nursery_size = SGEN_PARALLEL_MINOR_MIN_NURSERY_SIZE;
 /* If set, do a mod union consistency check before each finishing collection pause */
 static gboolean mod_union_consistency_check = FALSE;
 /* If set, check whether mark bits are consistent after major collections */
@@ -407,11 +409,10 @@ SgenHashTable sgen_roots_hash [ROOT_TYPE_NUM] = {
 };
 static mword roots_size = 0; /* amount of memory in the root set */
 
-/* The size of a TLAB */
+/* The initial and minimum size of a TLAB */
 /* The bigger the value, the less often we have to go to the slow path to allocate a new
- * one, but the more space is wasted by threads not allocating much memory.
- * FIXME: Tune this.
- * FIXME: Make this self-tuning for each thread.
+ * one, but the more space is wasted by threads not allocating much memory.  Each thread's
+ * TLAB grows from this size as it allocates, see sgen_clear_tlabs ().
  */
 guint32 sgen_tlab_size = (1024 * 4);
 
@@ -1810,7 +1811,7 @@ collect_nursery (const char *reason, gboolean is_overflow)
 	object_ops_nopar = sgen_get_concurrent_collection_in_progress ()
 				? &sgen_minor_collector.serial_ops_with_concurrent_major
 				: &sgen_minor_collector.serial_ops;
-	if (sgen_minor_collector.is_parallel && sgen_nursery_size >= SGEN_PARALLEL_MINOR_MIN_NURSERY_SIZE) {
+	if (sgen_minor_collector.is_parallel && sgen_nursery_size >= parallel_minor_min_nursery_size) {
 		object_ops_par = sgen_get_concurrent_collection_in_progress ()
 					? &sgen_minor_collector.parallel_ops_with_concurrent_major
 					: &sgen_minor_collector.parallel_ops;
@@ -3091,6 +3092,8 @@ void*
 sgen_thread_attach (SgenThreadInfo* info)
 {
 	info->tlab_start = info->tlab_next = info->tlab_temp_end = info->tlab_real_end = NULL;
+	info->tlab_size = sgen_tlab_size;
+	info->tlab_refills = 0;
 
 	sgen_client_thread_attach (info);
 
@@ -3535,6 +3538,7 @@ sgen_gc_init (void)
 	sgen_init_gray_queues ();
 	sgen_init_allocator ();
 	sgen_init_gchandles ();
+	sgen_init_los ();
 
 	sgen_register_fixed_internal_mem_type (INTERNAL_MEM_SECTION, SGEN_SIZEOF_GC_MEM_SECTION);
 	sgen_register_fixed_internal_mem_type (INTERNAL_MEM_GRAY_QUEUE, sizeof (GrayQueueSection));
@@ -3685,6 +3689,37 @@ sgen_gc_init (void)
 				continue;
 			}
 
+			if (g_str_has_prefix (opt, "minor-par-min-nursery-size=")) {
+				size_t val;
+				opt = strchr (opt, '=') + 1;
+				if (!sgen_minor_collector.is_parallel) {
+					sgen_env_var_error (MONO_GC_PARAMS_NAME, "Ignoring.",
+							"`minor-par-min-nursery-size` only supported with minor=simple-par.");
+				} else if (*opt && mono_gc_parse_environment_string_extract_number (opt, &val)) {
+					parallel_minor_min_nursery_size = val;
+				} else {
+					sgen_env_var_error (MONO_GC_PARAMS_NAME, "Using default value.", "`minor-par-min-nursery-size` must be an integer.");
+				}
+				continue;
+			}
+			if (g_str_has_prefix (opt, "minor-workers=")) {
+				size_t val;
+				int max_workers = MIN (mono_cpu_count (), SGEN_THREADPOOL_MAX_NUM_THREADS);
+				opt = strchr (opt, '=') + 1;
+				if (!sgen_minor_collector.is_parallel) {
+					sgen_env_var_error (MONO_GC_PARAMS_NAME, "Ignoring.",
+							"`minor-workers` only supported with minor=simple-par.");
+				} else if (*opt && mono_gc_parse_environment_string_extract_number (opt, &val) && val >= 1 && val <= (size_t)max_workers) {
+					sgen_workers_set_num_active_workers (GENERATION_NURSERY, (int)val);
+				} else {
+					sgen_env_var_error (MONO_GC_PARAMS_NAME, "Using default value.", "`minor-workers` must be an integer between 1 and %d.", max_workers);
+				}
+				continue;
+			}
+
+			if (sgen_los_handle_gc_param (opt))
+				continue;
+
 			if (sgen_major_collector.handle_gc_param && sgen_major_collector.handle_gc_param (opt))
 				continue;
 
@@ -3710,6 +3745,9 @@ sgen_gc_init (void)
 			fprintf (stderr, "  [no-]cementing\n");
 			fprintf (stderr, "  [no-]dynamic-nursery\n");
 			fprintf (stderr, "  remset-copy-clear-par\n");
+			fprintf (stderr, "  minor-par-min-nursery-size=N (where N is an integer, possibly with a k, m or a g suffix)\n");
+			fprintf (stderr, "  minor-workers=N (where N is the number of threads used by minor=simple-par)\n");
+			sgen_los_print_gc_param_usage ();
 			if (sgen_major_collector.print_gc_param_usage)
 				sgen_major_collector.print_gc_param_usage ();
 			if (sgen_minor_collector.print_gc_param_usage)
@@ -425,6 +425,10 @@ struct _SgenThreadInfo {
 	char *tlab_temp_end;
 	char *tlab_real_end;
 
+	/* Size of the next TLAB and the number of TLABs taken since the last collection. */
+	guint32 tlab_size;
+	guint32 tlab_refills;
+
 	/* Total bytes allocated by this thread in its lifetime so far. */
 	gint64 total_bytes_allocated;
 };
@@ -962,6 +966,9 @@ void sgen_los_free_object (LOSObject *obj);
 void* sgen_los_alloc_large_inner (GCVTable vtable, size_t size)
 	MONO_PERMIT (need (sgen_gc_locked, sgen_stop_world));
 void sgen_los_sweep (void);
+void sgen_init_los (void);
+gboolean sgen_los_handle_gc_param (const char *opt);
+void sgen_los_print_gc_param_usage (void);
 gboolean sgen_ptr_is_in_los (char *ptr, char **start);
 void sgen_los_iterate_objects (IterateObjectCallbackFunc cb, void *user_data);
 void sgen_los_iterate_objects_free (IterateObjectResultCallbackFunc cb, void *user_data);
@@ -32,6 +32,7 @@
 #include "mono/sgen/sgen-client.h"
 #include "mono/sgen/sgen-array-list.h"
 #include "mono/sgen/sgen-pinning.h"
+#include "mono/utils/mono-mmap-internals.h"
 
 #define LOS_SECTION_SIZE	(1024 * 1024)
 
@@ -130,6 +131,38 @@ static LOSFreeChunks *los_fast_free_lists [LOS_NUM_FAST_SIZES]; /* 0 is for larg
 static mword los_num_objects = 0;
 static int los_num_sections = 0;
 
+/*
+ * Objects too large for a section get a mapping of their own.  To avoid an mmap/munmap
+ * pair for every one of them when an application keeps allocating and dropping large
+ * arrays, those mappings are rounded up to a size class (eight per power of two, so at
+ * most 12.5% is wasted), and free mappings are kept on a list per class.  A mapping that
+ * is still unused at the second LOS sweep after it was freed goes back to the OS.
+ */
+#define LOS_HUGE_MIN_SIZE_BITS		19
+#define LOS_HUGE_CLASSES_PER_POWER_BITS	3
+#define LOS_HUGE_NUM_SIZE_CLASSES	(((SIZEOF_VOID_P * 8) - LOS_HUGE_MIN_SIZE_BITS) << LOS_HUGE_CLASSES_PER_POWER_BITS)
+#define LOS_HUGE_DEFAULT_CACHE_SIZE	(16 * 1024 * 1024)
+/* Transparent huge pages are only worth asking for if at least one fits */
+#define LOS_HUGE_PAGE_SIZE		(2 * 1024 * 1024)
+
+typedef struct _LOSHugeFreeMapping LOSHugeFreeMapping;
+struct _LOSHugeFreeMapping {
+	LOSHugeFreeMapping *next;
+	size_t size;
+	gboolean survived_sweep;
+};
+
+static LOSHugeFreeMapping *los_huge_free_lists [LOS_HUGE_NUM_SIZE_CLASSES];
+static mword los_huge_cache_size = 0;
+static mword los_huge_cache_max_size = LOS_HUGE_DEFAULT_CACHE_SIZE;
+static gboolean los_huge_pages = FALSE;
+
+/* Counters */
+static guint64 stat_los_huge_cache_hits = 0;
+static guint64 stat_los_huge_cache_misses = 0;
+static mword stat_los_section_free_bytes = 0;
+static mword stat_los_section_largest_free_chunk = 0;
+
 //#define USE_MALLOC
 //#define LOS_CONSISTENCY_CHECK
 //#define LOS_DUMMY
@@ -371,6 +404,150 @@ free_los_section_memory (LOSObject *obj, size_t size)
 	add_free_chunk ((LOSFreeChunks*)SGEN_ALIGN_DOWN_TO ((mword)obj, LOS_CHUNK_SIZE), size);
 }
 
+static int
+los_huge_size_class (size_t size, size_t *class_size)
+{
+	int bits = 0;
+	size_t granule;
+
+	while ((size >> bits) > 1)
+		++bits;
+	SGEN_ASSERT (0, bits >= LOS_HUGE_MIN_SIZE_BITS, "Why is a huge LOS mapping this small?");
+
+	granule = (size_t)1 << (bits - LOS_HUGE_CLASSES_PER_POWER_BITS);
+	if (granule < (size_t)mono_pagesize ())
+		granule = mono_pagesize ();
+	size = SGEN_ALIGN_UP_TO (size, granule);
+
+	/* Rounding up might have taken us to the next power of two */
+	while ((size >> bits) > 1)
+		++bits;
+
+	if (class_size)
+		*class_size = size;
+	return ((bits - LOS_HUGE_MIN_SIZE_BITS) << LOS_HUGE_CLASSES_PER_POWER_BITS) +
+		(int)((size >> (bits - LOS_HUGE_CLASSES_PER_POWER_BITS)) & ((1 << LOS_HUGE_CLASSES_PER_POWER_BITS) - 1));
+}
+
+/*
+ * The size of the mapping we use for a huge object whose page aligned size is `size`.
+ * Without the cache there's no point in rounding up, since nothing would reuse the slack.
+ */
+static size_t
+los_huge_mapping_size (size_t size)
+{
+	size_t class_size;
+
+	if (!los_huge_cache_max_size)
+		return size;
+
+	los_huge_size_class (size, &class_size);
+	return class_size;
+}
+
+static void los_huge_release_mapping (gpointer ptr, size_t size);
+static void los_huge_trim_cache (gboolean release_all);
+
+static gpointer
+los_huge_alloc_mapping (size_t size)
+{
+	gpointer ptr;
+
+	if (los_huge_cache_max_size) {
+		int size_class = los_huge_size_class (size, NULL);
+		LOSHugeFreeMapping *mapping = los_huge_free_lists [size_class];
+
+		if (mapping) {
+			SGEN_ASSERT (0, mapping->size == size, "Why is there a mapping of the wrong size on the free list?");
+			los_huge_free_lists [size_class] = mapping->next;
+			los_huge_cache_size -= size;
+			++stat_los_huge_cache_hits;
+			/* Space was never released to the memory governor */
+			memset (mapping, 0, size);
+			return mapping;
+		}
+		++stat_los_huge_cache_misses;
+	}
+
+	if (!sgen_memgov_try_alloc_space (size, SPACE_LOS)) {
+		/* The cached mappings count against the heap limit, so give them back first */
+		if (!los_huge_cache_size)
+			return NULL;
+		los_huge_trim_cache (TRUE);
+		if (!sgen_memgov_try_alloc_space (size, SPACE_LOS))
+			return NULL;
+	}
+
+	if (los_huge_pages && size >= LOS_HUGE_PAGE_SIZE) {
+		/* Huge pages can only back the huge page aligned parts of the mapping */
+		ptr = sgen_alloc_os_memory_aligned (size, LOS_HUGE_PAGE_SIZE, (SgenAllocFlags)(SGEN_ALLOC_HEAP | SGEN_ALLOC_ACTIVATE), NULL, MONO_MEM_ACCOUNT_SGEN_LOS);
+		if (ptr)
+			mono_vadvise_huge_pages (ptr, size);
+	} else {
+		ptr = sgen_alloc_os_memory (size, (SgenAllocFlags)(SGEN_ALLOC_HEAP | SGEN_ALLOC_ACTIVATE), NULL, MONO_MEM_ACCOUNT_SGEN_LOS);
+	}
+
+	if (!ptr) {
+		sgen_memgov_release_space (size, SPACE_LOS);
+		return NULL;
+	}
+
+	sgen_los_memory_usage_total += size;
+	return ptr;
+}
+
+static void
+los_huge_release_mapping (gpointer ptr, size_t size)
+{
+	sgen_free_os_memory (ptr, size, SGEN_ALLOC_HEAP, MONO_MEM_ACCOUNT_SGEN_LOS);
+	sgen_los_memory_usage_total -= size;
+	sgen_memgov_release_space (size, SPACE_LOS);
+}
+
+static void
+los_huge_free_mapping (gpointer ptr, size_t size)
+{
+	if (los_huge_cache_max_size && los_huge_cache_size + size <= los_huge_cache_max_size) {
+		int size_class = los_huge_size_class (size, NULL);
+		LOSHugeFreeMapping *mapping = (LOSHugeFreeMapping *)ptr;
+
+		mapping->size = size;
+		mapping->survived_sweep = FALSE;
+		mapping->next = los_huge_free_lists [size_class];
+		los_huge_free_lists [size_class] = mapping;
+		los_huge_cache_size += size;
+		return;
+	}
+
+	los_huge_release_mapping (ptr, size);
+}
+
+/*
+ * Release the cached mappings that haven't been reused since the last sweep, and mark
+ * the rest so that they're released at the next one if they're still unused then.
+ * If `release_all` is set, release all of them.
+ */
+static void
+los_huge_trim_cache (gboolean release_all)
+{
+	int i;
+
+	for (i = 0; i < LOS_HUGE_NUM_SIZE_CLASSES; ++i) {
+		LOSHugeFreeMapping **prev = &los_huge_free_lists [i];
+		while (*prev) {
+			LOSHugeFreeMapping *mapping = *prev;
+			if (mapping->survived_sweep || release_all) {
+				*prev = mapping->next;
+				los_huge_cache_size -= mapping->size;
+				los_huge_release_mapping (mapping, mapping->size);
+				continue;
+			}
+			mapping->survived_sweep = TRUE;
+			prev = &mapping->next;
+		}
+	}
+}
+
 void
 sgen_los_free_object (LOSObject *obj)
 {
@@ -391,10 +568,8 @@ sgen_los_free_object (LOSObject *obj)
 	if (size > LOS_SECTION_OBJECT_LIMIT) {
 		int pagesize = mono_pagesize ();
 		size += sizeof (LOSObject);
-		size = SGEN_ALIGN_UP_TO (size, pagesize);
-		sgen_free_os_memory ((gpointer)SGEN_ALIGN_DOWN_TO ((mword)obj, pagesize), size, SGEN_ALLOC_HEAP, MONO_MEM_ACCOUNT_SGEN_LOS);
-		sgen_los_memory_usage_total -= size;
-		sgen_memgov_release_space (size, SPACE_LOS);
+		size = los_huge_mapping_size (SGEN_ALIGN_UP_TO (size, pagesize));
+		los_huge_free_mapping ((gpointer)SGEN_ALIGN_DOWN_TO ((mword)obj, pagesize), size);
 	} else {
 		free_los_section_memory (obj, size + sizeof (LOSObject));
 #ifdef LOS_CONSISTENCY_CHECKS
@@ -449,12 +624,13 @@ sgen_los_alloc_large_inner (GCVTable vtable, size_t size)
 		size_t obj_size = size + sizeof (LOSObject);
 		int pagesize = mono_pagesize ();
 		size_t alloc_size = SGEN_ALIGN_UP_TO (obj_size, pagesize);
-		if (sgen_memgov_try_alloc_space (alloc_size, SPACE_LOS)) {
-			obj = (LOSObject *)sgen_alloc_os_memory (alloc_size, (SgenAllocFlags)(SGEN_ALLOC_HEAP | SGEN_ALLOC_ACTIVATE), NULL, MONO_MEM_ACCOUNT_SGEN_LOS);
-			if (obj) {
-				sgen_los_memory_usage_total += alloc_size;
-				obj = randomize_los_object_start (obj, obj_size, alloc_size, pagesize);
-			}
+		obj = (LOSObject *)los_huge_alloc_mapping (los_huge_mapping_size (alloc_size));
+		if (obj) {
+			/*
+			 * The random offset must stay within the first page so that freeing can
+			 * find the start of the mapping again.
+			 */
+			obj = randomize_los_object_start (obj, obj_size, alloc_size, pagesize);
 		}
 	} else {
 		obj = get_los_section_memory (size + sizeof (LOSObject));
@@ -498,6 +674,11 @@ sgen_los_sweep (void)
 	LOSSection *section, *prev;
 	int i;
 	int num_sections = 0;
+	mword section_free_bytes = 0;
+	mword largest_free_chunk = 0;
+
+	/* Mappings freed below start out as young, so trim before we free dead objects */
+	los_huge_trim_cache (FALSE);
 
 	/* sweep the big objects list */
 	FOREACH_LOS_OBJECT_NO_LOCK (obj) {
@@ -552,6 +733,8 @@ sgen_los_sweep (void)
 				for (j = i + 1; j <= LOS_SECTION_NUM_CHUNKS && section->free_chunk_map [j]; ++j)
 					;
 				add_free_chunk ((LOSFreeChunks*)((char*)section + (i << LOS_CHUNK_BITS)), (j - i) << LOS_CHUNK_BITS);
+				section_free_bytes += (mword)(j - i) << LOS_CHUNK_BITS;
+				largest_free_chunk = MAX (largest_free_chunk, (mword)(j - i) << LOS_CHUNK_BITS);
 				i = j - 1;
 			}
 		}
@@ -578,6 +761,50 @@ sgen_los_sweep (void)
 	*/
 
 	g_assert (los_num_sections == num_sections);
+
+	stat_los_section_free_bytes = section_free_bytes;
+	stat_los_section_largest_free_chunk = largest_free_chunk;
+}
+
+void
+sgen_init_los (void)
+{
+	mono_counters_register ("LOS sections", MONO_COUNTER_GC | MONO_COUNTER_INT, &los_num_sections);
+	mono_counters_register ("LOS section free bytes", MONO_COUNTER_GC | MONO_COUNTER_WORD | MONO_COUNTER_BYTES, &stat_los_section_free_bytes);
+	mono_counters_register ("LOS section largest free chunk", MONO_COUNTER_GC | MONO_COUNTER_WORD | MONO_COUNTER_BYTES, &stat_los_section_largest_free_chunk);
+	mono_counters_register ("LOS huge mapping cache size", MONO_COUNTER_GC | MONO_COUNTER_WORD | MONO_COUNTER_BYTES, &los_huge_cache_size);
+	mono_counters_register ("# LOS huge mapping cache hits", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_los_huge_cache_hits);
+	mono_counters_register ("# LOS huge mapping cache misses", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_los_huge_cache_misses);
+}
+
+gboolean
+sgen_los_handle_gc_param (const char *opt)
+{
+	if (g_str_has_prefix (opt, "los-cache-size=")) {
+		size_t val;
+		opt = strchr (opt, '=') + 1;
+		if (*opt && mono_gc_parse_environment_string_extract_number (opt, &val))
+			los_huge_cache_max_size = val;
+		else
+			sgen_env_var_error (MONO_GC_PARAMS_NAME, "Using default value.", "`los-cache-size` must be an integer.");
+		return TRUE;
+	}
+	if (!strcmp (opt, "los-huge-pages")) {
+		los_huge_pages = TRUE;
+		return TRUE;
+	}
+	if (!strcmp (opt, "no-los-huge-pages")) {
+		los_huge_pages = FALSE;
+		return TRUE;
+	}
+	return FALSE;
+}
+
+void
+sgen_los_print_gc_param_usage (void)
+{
+	fprintf (stderr, "  los-cache-size=N (where N is an integer, possibly with a k, m or a g suffix)\n");
+	fprintf (stderr, "  [no-]los-huge-pages\n");
 }
 
 gboolean
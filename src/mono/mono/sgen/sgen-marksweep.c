@@ -205,6 +205,8 @@ static const gboolean concurrent_sweep = SGEN_SWEEP_SERIAL;
 #endif
 
 static int sweep_pool_context = -1;
+/* Number of threads in the sweep context, which is also how many jobs the block sweep is split into */
+static int sweep_pool_threads_num = 1;
 
 #define BLOCK_IS_TAGGED_HAS_REFERENCES(bl)	SGEN_POINTER_IS_TAGGED_1 ((bl))
 #define BLOCK_TAG_HAS_REFERENCES(bl)		SGEN_POINTER_TAG_1 ((bl))
@@ -253,6 +255,12 @@ static gboolean compact_blocks = FALSE;
 			continue;					\
 		(hr) = BLOCK_IS_TAGGED_HAS_REFERENCES ((bl));		\
 		(bl) = BLOCK_UNTAG ((bl));
+#define FOREACH_BLOCK_RANGE_NO_LOCK(bl,begin,end,index) {	\
+	volatile gpointer *slot;					\
+	SGEN_ARRAY_LIST_FOREACH_SLOT_RANGE (&allocated_blocks, begin, end, slot, index) { \
+		(bl) = BLOCK_UNTAG (*slot);				\
+		if (!(bl))						\
+			continue;
 #define END_FOREACH_BLOCK_RANGE_NO_LOCK	} SGEN_ARRAY_LIST_END_FOREACH_SLOT_RANGE; }
 
 static volatile size_t num_major_sections = 0;
@@ -859,8 +867,18 @@ set_sweep_state (int new_, int expected)
 
 static gboolean ensure_block_is_checked_for_sweeping (guint32 block_index, gboolean wait, gboolean *have_checked);
 
+static void get_block_range_for_job (int job_index, int job_split_count, int block_count, int *start, int *end);
+
+typedef struct {
+	SgenThreadPoolJob job;
+	int job_index;
+	int job_split_count;
+	int block_count;
+} SweepBlocksJob;
+
 static SgenThreadPoolJob * volatile sweep_job;
-static SgenThreadPoolJob * volatile sweep_blocks_job;
+/* Number of sweep_blocks jobs that haven't finished yet */
+static volatile gint32 sweep_blocks_jobs_pending;
 
 static void
 major_finish_sweep_checking (void)
@@ -1738,21 +1756,27 @@ ensure_block_is_checked_for_sweeping (guint32 block_index, gboolean wait, gboole
 	return !!tagged_block;
 }
 
+/*
+ * Sweeps one range of the block array.  The ranges are disjoint, but sweep_block ()
+ * claims each block with a CAS, so it's fine if the mutator or a nursery collection
+ * sweeps some of them before we get to them.
+ */
 static void
 sweep_blocks_job_func (void *thread_data_untyped, SgenThreadPoolJob *job)
 {
-	volatile gpointer *slot;
+	SweepBlocksJob *sbj = (SweepBlocksJob*)job;
 	MSBlockInfo *bl;
+	int first_block, last_block, index;
+
+	get_block_range_for_job (sbj->job_index, sbj->job_split_count, sbj->block_count, &first_block, &last_block);
 
-	SGEN_ARRAY_LIST_FOREACH_SLOT (&allocated_blocks, slot) {
-		bl = BLOCK_UNTAG (*slot);
-		if (bl)
-			sweep_block (bl);
-	} SGEN_ARRAY_LIST_END_FOREACH_SLOT;
+	FOREACH_BLOCK_RANGE_NO_LOCK (bl, first_block, last_block, index) {
+		sweep_block (bl);
+	} END_FOREACH_BLOCK_RANGE_NO_LOCK;
 
 	mono_memory_write_barrier ();
 
-	sweep_blocks_job = NULL;
+	mono_atomic_dec_i32 (&sweep_blocks_jobs_pending);
 }
 
 static void
@@ -1799,8 +1823,19 @@ MONO_RESTORE_WARNING
 	 * the next major we need all blocks to be swept anyway.
 	 */
 	if (concurrent_sweep && lazy_sweep) {
-		sweep_blocks_job = sgen_thread_pool_job_alloc ("sweep_blocks", sweep_blocks_job_func, sizeof (SgenThreadPoolJob));
-		sgen_thread_pool_job_enqueue (sweep_pool_context, sweep_blocks_job);
+		int i;
+		int split_count = sweep_pool_threads_num;
+		int block_count = (int)allocated_blocks.next_slot / split_count;
+
+		/* Set before enqueuing, so nobody sees the sweep as finished with jobs still pending */
+		mono_atomic_store_i32 (&sweep_blocks_jobs_pending, split_count);
+		for (i = 0; i < split_count; i++) {
+			SweepBlocksJob *sbj = (SweepBlocksJob*)sgen_thread_pool_job_alloc ("sweep_blocks", sweep_blocks_job_func, sizeof (SweepBlocksJob));
+			sbj->job_index = i;
+			sbj->job_split_count = split_count;
+			sbj->block_count = block_count;
+			sgen_thread_pool_job_enqueue (sweep_pool_context, &sbj->job);
+		}
 	}
 
 	sweep_finish ();
@@ -1961,7 +1996,7 @@ major_start_nursery_collection (void)
 	old_num_major_sections = num_major_sections;
 
 	/* Compact the block list if it hasn't been compacted in a while and nobody is using it */
-	if (compact_blocks && !sweep_in_progress () && !sweep_blocks_job && !sgen_get_concurrent_collection_in_progress ()) {
+	if (compact_blocks && !sweep_in_progress () && !mono_atomic_load_i32 (&sweep_blocks_jobs_pending) && !sgen_get_concurrent_collection_in_progress ()) {
 		/*
 		 * We support null elements in the array but do regular compaction to avoid
 		 * excessive traversal of the array and to facilitate splitting into well
@@ -2070,13 +2105,14 @@ major_start_major_collection (void)
 
 	if (lazy_sweep && concurrent_sweep) {
 		/*
-		 * sweep_blocks_job is created before sweep_finish, which we wait for above
-		 * (major_finish_sweep_checking). After the end of sweep, if we don't have
-		 * sweep_blocks_job set, it means that it has already been run.
+		 * The sweep_blocks jobs are enqueued before sweep_finish, which we wait for above
+		 * (major_finish_sweep_checking). After the end of sweep, if none of them are
+		 * pending, they have all already been run.  The sweep job itself is done, so the
+		 * only jobs left in the sweep context are sweep_blocks jobs.
 		 */
-		SgenThreadPoolJob *job = sweep_blocks_job;
-		if (job)
-			sgen_thread_pool_job_wait (sweep_pool_context, job);
+		if (mono_atomic_load_i32 (&sweep_blocks_jobs_pending))
+			sgen_thread_pool_wait_for_all_jobs (sweep_pool_context);
+		SGEN_ASSERT (0, !sweep_blocks_jobs_pending, "Why are sweep_blocks jobs still pending?");
 	}
 
 	if (lazy_sweep && !concurrent_sweep)
@@ -2996,8 +3032,16 @@ sgen_marksweep_init_internal (SgenMajorCollector *collector, gboolean is_concurr
 	else if (is_concurrent)
 		sgen_workers_create_context (GENERATION_OLD, 1);
 
-	if (concurrent_sweep)
-		sweep_pool_context = sgen_thread_pool_create_context (1, NULL, NULL, NULL, NULL, NULL);
+	if (concurrent_sweep) {
+		/*
+		 * With the parallel collector the block sweep after a major is split across
+		 * as many threads as we use for marking.  The jobs are independent ranges of
+		 * the block array, so there's no stealing or balancing to do.
+		 */
+		if (is_parallel)
+			sweep_pool_threads_num = MIN (mono_cpu_limit (), SGEN_THREADPOOL_MAX_NUM_THREADS);
+		sweep_pool_context = sgen_thread_pool_create_context (sweep_pool_threads_num, NULL, NULL, NULL, NULL, NULL);
+	}
 #endif
 }
 
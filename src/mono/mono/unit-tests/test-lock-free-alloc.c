@@ -0,0 +1,148 @@
+/*
+ * test-lock-free-alloc.c: Unit test and throughput benchmark for the lock free allocator.
+ *
+ * Licensed under the MIT license. See LICENSE file in the project root for full license information.
+ */
+
+#include "config.h"
+
+#include "utils/mono-threads.h"
+#include "utils/lock-free-alloc.h"
+#include "utils/mono-time.h"
+#include "utils/checked-build.h"
+#include "metadata/w32handle.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include <pthread.h>
+
+#define SLOT_SIZE		64
+#define MAX_THREADS		16
+#define ITERATIONS		(1000 * 1000)
+#define LIVE_SLOTS		16
+
+static MonoLockFreeAllocSizeClass size_class;
+static MonoLockFreeAllocator allocator;
+static gboolean use_magazine;
+
+/*
+ * Each thread keeps LIVE_SLOTS allocations alive and replaces one per iteration, which is
+ * roughly the pattern of the internal allocations in sgen and the profiler.  Slots are
+ * stamped with the owning thread so corruption across threads is detected.
+ */
+static void*
+alloc_thread (void *arg)
+{
+	gsize id = GPOINTER_TO_SIZE (arg);
+	gpointer live [LIVE_SLOTS];
+	MonoLockFreeMagazine mag;
+	int i, res = 0;
+
+	mono_thread_info_attach ();
+	mono_lock_free_magazine_init (&mag, &allocator);
+
+	memset (live, 0, sizeof (live));
+
+	for (i = 0; i < ITERATIONS; ++i) {
+		int index = i % LIVE_SLOTS;
+		gsize *p;
+
+		if (live [index]) {
+			if (*(gsize*)live [index] != id)
+				res = 1;
+			if (use_magazine)
+				mono_lock_free_magazine_free (&mag, live [index]);
+			else
+				mono_lock_free_free (live [index], size_class.block_size);
+		}
+
+		p = (gsize*)(use_magazine ? mono_lock_free_magazine_alloc (&mag) : mono_lock_free_alloc (&allocator));
+		*p = id;
+		live [index] = p;
+	}
+
+	for (i = 0; i < LIVE_SLOTS; ++i) {
+		if (use_magazine)
+			mono_lock_free_magazine_free (&mag, live [i]);
+		else
+			mono_lock_free_free (live [i], size_class.block_size);
+	}
+	mono_lock_free_magazine_flush (&mag);
+
+	return GINT_TO_POINTER (res);
+}
+
+static int
+run_threads (int nthreads, gboolean magazine)
+{
+	pthread_t threads [MAX_THREADS];
+	gint64 start, elapsed;
+	int i, res = 0;
+
+	use_magazine = magazine;
+
+	start = mono_100ns_ticks ();
+	for (i = 0; i < nthreads; ++i)
+		pthread_create (&threads [i], NULL, alloc_thread, GSIZE_TO_POINTER (i + 1));
+	for (i = 0; i < nthreads; ++i) {
+		gpointer thread_res;
+
+		pthread_join (threads [i], &thread_res);
+		res += GPOINTER_TO_INT (thread_res);
+	}
+	elapsed = mono_100ns_ticks () - start;
+
+	if (!mono_lock_free_allocator_check_consistency (&allocator))
+		res++;
+
+	printf ("%-9s %2d threads: %8.2f Mops/s\n", magazine ? "magazine" : "direct", nthreads,
+		(double)nthreads * ITERATIONS * 2 / (elapsed / 10.0));
+
+	if (res)
+		printf ("LOCK_FREE_ALLOC %s TEST FAILED WITH %d THREADS\n", magazine ? "MAGAZINE" : "DIRECT", nthreads);
+	return res;
+}
+
+static void
+monotest_thread_state_init (MonoThreadUnwindState *ctx)
+{
+}
+
+#ifdef __cplusplus
+extern "C"
+#endif
+int
+test_lock_free_alloc_main (void);
+
+#define monotest_setup_async_callback          NULL
+#define monotest_thread_state_init_from_sigctx NULL
+#define monotest_thread_state_init_from_handle NULL
+
+int
+test_lock_free_alloc_main (void)
+{
+	static const MonoThreadInfoRuntimeCallbacks ticallbacks = {
+		MONO_THREAD_INFO_RUNTIME_CALLBACKS (MONO_INIT_CALLBACK, monotest)
+	};
+	int nthreads, res = 0;
+
+	CHECKED_MONO_INIT ();
+	mono_thread_info_init (sizeof (MonoThreadInfo));
+	mono_thread_info_runtime_init (&ticallbacks);
+#ifndef HOST_WIN32
+	mono_w32handle_init ();
+#endif
+	mono_thread_info_attach ();
+
+	mono_lock_free_allocator_init_size_class (&size_class, SLOT_SIZE, LOCK_FREE_ALLOC_SB_MAX_SIZE);
+	mono_lock_free_allocator_init_allocator (&allocator, &size_class, MONO_MEM_ACCOUNT_OTHER);
+
+	for (nthreads = 1; nthreads <= MAX_THREADS; nthreads *= 2) {
+		res += run_threads (nthreads, FALSE);
+		res += run_threads (nthreads, TRUE);
+	}
+
+	return res;
+}
@@ -0,0 +1,131 @@
+/*
+ * test-minipal-utf8.c: Unit test and throughput benchmark for the minipal UTF-8 <-> UTF-16 converters.
+ *
+ * Licensed under the MIT license. See LICENSE file in the project root for full license information.
+ */
+
+#include "config.h"
+
+#include "utils/mono-time.h"
+
+#include <minipal/utf8.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LENGTH		256
+#define BENCH_LENGTH		4096
+#define BENCH_ITERATIONS	(50 * 1000)
+
+/* U+00E9 and U+20AC, which take two and three bytes in UTF-8 */
+static const char two_byte [] = "\xC3\xA9";
+static const char three_byte [] = "\xE2\x82\xAC";
+
+/*
+ * Converts an ASCII string with one multi-byte character at each position and back, which
+ * puts the end of the vectorized ASCII prefix at every offset within and across vectors.
+ */
+static int
+test_round_trip (const char *seq, size_t seq_length)
+{
+	char utf8 [MAX_LENGTH + 4], back [MAX_LENGTH + 4];
+	CHAR16_T utf16 [MAX_LENGTH + 4];
+	size_t length, pos, i, utf16_length, utf8_length;
+
+	for (length = 0; length <= MAX_LENGTH; ++length) {
+		for (pos = 0; pos <= length; ++pos) {
+			size_t total = length + (pos < length ? seq_length : 0);
+
+			for (i = 0; i < length; ++i)
+				utf8 [i] = 'a' + (i % 26);
+			if (pos < length) {
+				memmove (utf8 + pos + seq_length, utf8 + pos, length - pos);
+				memcpy (utf8 + pos, seq, seq_length);
+			}
+
+			utf16_length = minipal_get_length_utf8_to_utf16 (utf8, total, 0);
+			if (total && minipal_convert_utf8_to_utf16 (utf8, total, utf16, utf16_length, 0) != utf16_length)
+				return 1;
+			if (utf16_length != (pos < length ? length + 1 : length))
+				return 1;
+
+			utf8_length = minipal_get_length_utf16_to_utf8 (utf16, utf16_length, 0);
+			if (utf8_length != total)
+				return 1;
+			if (utf16_length && minipal_convert_utf16_to_utf8 (utf16, utf16_length, back, utf8_length, 0) != utf8_length)
+				return 1;
+			if (memcmp (utf8, back, total) != 0)
+				return 1;
+
+			/* A destination one unit short fails the whole conversion */
+			if (utf16_length && minipal_convert_utf8_to_utf16 (utf8, total, utf16, utf16_length - 1, 0) != 0)
+				return 1;
+		}
+	}
+
+	return 0;
+}
+
+static void
+bench (const char *name, const char *utf8, size_t utf8_length)
+{
+	CHAR16_T *utf16 = (CHAR16_T *)malloc (utf8_length * sizeof (CHAR16_T));
+	char *back = (char *)malloc (utf8_length);
+	size_t utf16_length = 0;
+	gint64 start, to_utf16, to_utf8;
+	int i;
+
+	start = mono_100ns_ticks ();
+	for (i = 0; i < BENCH_ITERATIONS; ++i)
+		utf16_length = minipal_convert_utf8_to_utf16 (utf8, utf8_length, utf16, utf8_length, 0);
+	to_utf16 = mono_100ns_ticks () - start;
+
+	start = mono_100ns_ticks ();
+	for (i = 0; i < BENCH_ITERATIONS; ++i)
+		minipal_convert_utf16_to_utf8 (utf16, utf16_length, back, utf8_length, 0);
+	to_utf8 = mono_100ns_ticks () - start;
+
+	/* bytes per 100ns to MB/s */
+	printf ("%-6s utf8->utf16: %8.1f MB/s  utf16->utf8: %8.1f MB/s\n", name,
+		(double)utf8_length * BENCH_ITERATIONS * 10 / (double)MAX (to_utf16, 1),
+		(double)utf8_length * BENCH_ITERATIONS * 10 / (double)MAX (to_utf8, 1));
+
+	free (utf16);
+	free (back);
+}
+
+#ifdef __cplusplus
+extern "C"
+#endif
+int
+test_minipal_utf8_main (void);
+
+int
+test_minipal_utf8_main (void)
+{
+	char *text = (char *)malloc (BENCH_LENGTH);
+	size_t i;
+	int res = 0;
+
+	if (test_round_trip (two_byte, 2)) {
+		printf ("MINIPAL UTF8 TWO BYTE ROUND TRIP FAILED\n");
+		res++;
+	}
+	if (test_round_trip (three_byte, 3)) {
+		printf ("MINIPAL UTF8 THREE BYTE ROUND TRIP FAILED\n");
+		res++;
+	}
+
+	for (i = 0; i < BENCH_LENGTH; ++i)
+		text [i] = 'a' + (i % 26);
+	bench ("ascii", text, BENCH_LENGTH);
+
+	/* Mostly ASCII text with an accented character every 64 bytes */
+	for (i = 0; i + 2 <= BENCH_LENGTH; i += 64)
+		memcpy (text + i, two_byte, 2);
+	bench ("mixed", text, BENCH_LENGTH);
+
+	free (text);
+	return res;
+}
@@ -65,6 +65,7 @@
 
 #include <glib.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <mono/utils/atomic.h>
 #ifdef SGEN_WITHOUT_MONO
@@ -337,12 +338,17 @@ set_anchor (Descriptor *desc, Anchor old_anchor, Anchor new_anchor)
 	return mono_atomic_cas_i32 (&desc->anchor.value, new_anchor.value, old_anchor.value) == old_anchor.value;
 }
 
-static gpointer
-alloc_from_active_or_partial (MonoLockFreeAllocator *heap)
+/*
+ * Pops up to MAX slots into SLOTS with a single CAS on the anchor.  This
+ * works because only the owner of a descriptor pops from its free list,
+ * so the list below the head can't change under us - frees only push.
+ */
+static unsigned int
+alloc_from_active_or_partial (MonoLockFreeAllocator *heap, gpointer *slots, unsigned int max)
 {
 	Descriptor *desc;
 	Anchor old_anchor, new_anchor;
-	gpointer addr;
+	unsigned int n;
 
  retry:
 	desc = heap->active;
@@ -352,13 +358,13 @@ alloc_from_active_or_partial (MonoLockFreeAllocator *heap)
 	} else {
 		desc = heap_get_partial (heap);
 		if (!desc)
-			return NULL;
+			return 0;
 	}
 
 	/* Now we own the desc. */
 
 	do {
-		unsigned int next;
+		unsigned int next, i;
 		new_anchor.value = old_anchor.value = ((volatile Anchor*)&desc->anchor)->value;
 		if (old_anchor.data.state == STATE_EMPTY) {
 			/* We must free it because we own it. */
@@ -368,15 +374,19 @@ alloc_from_active_or_partial (MonoLockFreeAllocator *heap)
 		g_assert (old_anchor.data.state == STATE_PARTIAL);
 		g_assert (old_anchor.data.count > 0);
 
-		addr = (char*)desc->sb + old_anchor.data.avail * desc->slot_size;
+		n = MIN (max, old_anchor.data.count);
+		next = old_anchor.data.avail;
 
 		mono_memory_read_barrier ();
 
-		next = *(unsigned int*)addr;
-		g_assert (next < LOCK_FREE_ALLOC_SB_USABLE_SIZE (desc->block_size) / desc->slot_size);
+		for (i = 0; i < n; ++i) {
+			slots [i] = (char*)desc->sb + next * desc->slot_size;
+			next = *(unsigned int*)slots [i];
+			g_assert (next < LOCK_FREE_ALLOC_SB_USABLE_SIZE (desc->block_size) / desc->slot_size);
+		}
 
 		new_anchor.data.avail = next;
-		--new_anchor.data.count;
+		new_anchor.data.count -= n;
 
 		if (new_anchor.data.count == 0)
 			new_anchor.data.state = STATE_FULL;
@@ -388,7 +398,7 @@ alloc_from_active_or_partial (MonoLockFreeAllocator *heap)
 			heap_put_partial (desc);
 	}
 
-	return addr;
+	return n;
 }
 
 static gpointer
@@ -440,8 +450,7 @@ mono_lock_free_alloc (MonoLockFreeAllocator *heap)
 
 	for (;;) {
 
-		addr = alloc_from_active_or_partial (heap);
-		if (addr)
+		if (alloc_from_active_or_partial (heap, &addr, 1))
 			break;
 
 		addr = alloc_from_new_sb (heap);
@@ -516,6 +525,61 @@ mono_lock_free_free (gpointer ptr, size_t block_size)
 	}
 }
 
+void
+mono_lock_free_magazine_init (MonoLockFreeMagazine *mag, MonoLockFreeAllocator *heap)
+{
+	mag->heap = heap;
+	mag->count = 0;
+}
+
+gpointer
+mono_lock_free_magazine_alloc (MonoLockFreeMagazine *mag)
+{
+	unsigned int n;
+
+	if (G_LIKELY (mag->count))
+		return mag->slots [--mag->count];
+
+	/* Refill half of the magazine, so a following free doesn't have to flush. */
+	for (;;) {
+		gpointer addr;
+
+		n = alloc_from_active_or_partial (mag->heap, mag->slots, LOCK_FREE_ALLOC_MAGAZINE_SIZE / 2);
+		if (n)
+			break;
+
+		addr = alloc_from_new_sb (mag->heap);
+		if (addr)
+			return addr;
+	}
+
+	mag->count = n - 1;
+	return mag->slots [n - 1];
+}
+
+void
+mono_lock_free_magazine_free (MonoLockFreeMagazine *mag, gpointer ptr)
+{
+	if (G_UNLIKELY (mag->count == LOCK_FREE_ALLOC_MAGAZINE_SIZE)) {
+		unsigned int i;
+
+		/* Give the older half back, the recently freed slots are more likely to be hot. */
+		for (i = 0; i < LOCK_FREE_ALLOC_MAGAZINE_SIZE / 2; ++i)
+			mono_lock_free_free (mag->slots [i], mag->heap->sc->block_size);
+		memmove (mag->slots, mag->slots + LOCK_FREE_ALLOC_MAGAZINE_SIZE / 2, LOCK_FREE_ALLOC_MAGAZINE_SIZE / 2 * sizeof (gpointer));
+		mag->count = LOCK_FREE_ALLOC_MAGAZINE_SIZE / 2;
+	}
+
+	mag->slots [mag->count++] = ptr;
+}
+
+void
+mono_lock_free_magazine_flush (MonoLockFreeMagazine *mag)
+{
+	while (mag->count)
+		mono_lock_free_free (mag->slots [--mag->count], mag->heap->sc->block_size);
+}
+
 #define g_assert_OR_PRINT(c, format, ...)	do {				\
 		if (!(c)) {						\
 			if (print)					\
@@ -62,4 +62,24 @@ MONO_API void mono_lock_free_free (gpointer ptr, size_t block_size);
 
 MONO_API gboolean mono_lock_free_allocator_check_consistency (MonoLockFreeAllocator *heap);
 
+/*
+ * A magazine caches slots of one allocator for a single thread, so most
+ * allocations and frees don't touch the shared descriptors at all, and the
+ * rest move half a magazine at a time.  The owner must flush it before it
+ * goes away, otherwise the cached slots are leaked.
+ */
+#define LOCK_FREE_ALLOC_MAGAZINE_SIZE	32
+
+typedef struct {
+	MonoLockFreeAllocator *heap;
+	unsigned int count;
+	gpointer slots [LOCK_FREE_ALLOC_MAGAZINE_SIZE];
+} MonoLockFreeMagazine;
+
+MONO_API void mono_lock_free_magazine_init (MonoLockFreeMagazine *mag, MonoLockFreeAllocator *heap);
+MONO_API gpointer mono_lock_free_magazine_alloc (MonoLockFreeMagazine *mag);
+/* PTR must have been allocated from the magazine's allocator. */
+MONO_API void mono_lock_free_magazine_free (MonoLockFreeMagazine *mag, gpointer ptr);
+MONO_API void mono_lock_free_magazine_flush (MonoLockFreeMagazine *mag);
+
 #endif
@@ -24,4 +24,7 @@ mono_valloc_can_alloc (size_t size);
 void
 mono_valloc_set_limit (size_t size);
 
+int
+mono_vadvise_huge_pages (void *addr, size_t length);
+
 #endif /* __MONO_UTILS_MMAP_INTERNAL_H__ */
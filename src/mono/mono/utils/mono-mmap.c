@@ -531,3 +531,21 @@ mono_valloc_aligned (size_t size, size_t alignment, int flags, MonoMemAccountTyp
 	return aligned;
 }
 #endif
+
+/**
+ * mono_vadvise_huge_pages:
+ * \param addr memory address returned by mono_valloc ()
+ * \param length size of memory area
+ * Ask the OS to back the memory area at \p addr with transparent huge pages.
+ * This is only a hint; it has no effect if the kernel doesn't support it.
+ * \returns \c 0 if the hint was accepted.
+ */
+int
+mono_vadvise_huge_pages (void *addr, size_t length)
+{
+#if !defined(HOST_WIN32) && !defined(HOST_WASM) && defined(HAVE_MADVISE) && defined(MADV_HUGEPAGE)
+	return madvise (addr, length, MADV_HUGEPAGE);
+#else
+	return -1;
+#endif
+}
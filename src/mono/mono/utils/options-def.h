@@ -192,6 +192,10 @@ DEFINE_BOOL_READONLY(llvm_emulate_unwind, "emulate-unwind", TRUE, "")
 DEFINE_BOOL_READONLY(llvm_emulate_unwind, "emulate-unwind", FALSE, "")
 #endif
 
+#if defined(ENABLE_EXPERIMENT_TIERED) && defined(ENABLE_LLVM)
+DEFINE_BOOL(tiered_llvm, "tiered-llvm", FALSE, "Compile methods promoted by tiered compilation with the LLVM JIT")
+#endif
+
 /* Cleanup */
 #undef DEFINE_OPTION_FULL
 #undef DEFINE_OPTION_READONLY
@@ -117,6 +117,12 @@ FILE* extractor_t::create_extraction_file(const pal::string_t& relative_path)
 void extractor_t::extract(const file_entry_t &entry, reader_t &reader)
 {
     FILE* file = create_extraction_file(entry.relative_path());
+    write(entry, reader, file);
+    fclose(file);
+}
+
+void extractor_t::write(const file_entry_t& entry, reader_t& reader, FILE* file)
+{
     reader.set_offset(entry.offset());
     int64_t size = entry.size();
     size_t cast_size = to_size_t_dbgchecked(size);
@@ -183,8 +189,6 @@ void extractor_t::extract(const file_entry_t &entry, reader_t &reader)
         trace::error(_X("I/O failure when writing extracted files."));
         throw StatusCode::BundleExtractionIOError;
     }
-
-    fclose(file);
 }
 
 void extractor_t::begin()
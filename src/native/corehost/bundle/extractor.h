@@ -25,6 +25,9 @@ namespace bundle
 
         pal::string_t& extract(reader_t& reader);
 
+        // Writes the (decompressed) contents of a bundled file.
+        static void write(const file_entry_t& entry, reader_t& reader, FILE* file);
+
     private:
         pal::string_t& extraction_dir();
         pal::string_t& working_extraction_dir();
@@ -14,7 +14,7 @@ bool file_entry_t::is_valid() const
         static_cast<file_type_t>(m_type) < file_type_t::__last;
 }
 
-file_entry_t file_entry_t::read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction)
+file_entry_t file_entry_t::read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction, bool load_native_from_memory)
 {
     // First read the fixed-sized portion of file-entry
     file_entry_fixed_t fixed_data;
@@ -44,6 +44,8 @@ file_entry_t file_entry_t::read(reader_t &reader, uint32_t bundle_major_version,
     reader.read_path_string(entry.m_relative_path);
     dir_utils_t::fixup_path_separator(entry.m_relative_path);
 
+    entry.m_load_from_memory = load_native_from_memory && !force_extraction && entry.m_type == file_type_t::native_binary;
+
     return entry;
 }
 
@@ -52,6 +54,9 @@ bool file_entry_t::needs_extraction() const
     if (m_force_extraction)
         return true;
 
+    if (m_load_from_memory)
+        return false;
+
     switch (m_type)
     {
     case file_type_t::deps_json:
@@ -42,6 +42,7 @@ namespace bundle
             , m_relative_path()
             , m_disabled(false)
             , m_force_extraction(false)
+            , m_load_from_memory(false)
         {
         }
 
@@ -51,6 +52,7 @@ namespace bundle
             : m_relative_path()
             , m_disabled(false)
             , m_force_extraction(force_extraction)
+            , m_load_from_memory(false)
         {
             // File_entries in the bundle-manifest are expected to be used 
             // beyond startup (for loading files directly from bundle, lazy extraction, etc.).
@@ -71,9 +73,10 @@ namespace bundle
         void disable() { m_disabled = true; }
         bool is_disabled() const { return m_disabled; }
         bool needs_extraction() const;
+        bool is_loaded_from_memory() const { return m_load_from_memory; }
         bool matches(const pal::string_t& path) const { return (pal::pathcmp(relative_path(), path) == 0) && !is_disabled(); }
 
-        static file_entry_t read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction);
+        static file_entry_t read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction, bool load_native_from_memory);
 
     private:
         int64_t m_offset;
@@ -87,6 +90,9 @@ namespace bundle
         // in such case, and the lookup logic will behave as if the file is not present in the bundle.
         bool m_disabled;
         bool m_force_extraction;
+        // Native libraries can be loaded directly from the bundle (through an in-memory copy)
+        // instead of being extracted, where the platform supports it.
+        bool m_load_from_memory;
         bool is_valid() const;
     };
 }
@@ -23,7 +23,7 @@ namespace bundle
 
         std::vector<file_entry_t> files;
 
-        static manifest_t read(reader_t &reader, const header_t &header);
+        static manifest_t read(reader_t &reader, const header_t &header, bool load_native_from_memory);
 
         bool files_need_extraction() const
         {
@@ -2,6 +2,7 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include <memory>
+#include <cinttypes>
 #include "extractor.h"
 #include "runner.h"
 #include "trace.h"
@@ -29,7 +30,10 @@ StatusCode runner_t::extract()
         m_runtimeconfig_json.set_location(&m_header.runtimeconfig_json_location());
 
         // Read the bundle manifest
-        m_manifest = manifest_t::read(reader, m_header);
+        m_manifest = manifest_t::read(reader, m_header, can_load_native_from_memory());
+
+        if (trace::is_enabled())
+            trace_assembly_alignment();
 
         // Extract the files if necessary
         if (m_manifest.files_need_extraction())
@@ -48,6 +52,35 @@ StatusCode runner_t::extract()
     }
 }
 
+// The runtime maps uncompressed assemblies in place, section by section, only if their
+// sections are page aligned within the bundle file. Otherwise the image is copied into
+// anonymous memory on load. Report such assemblies to help diagnose slow startup.
+void runner_t::trace_assembly_alignment() const
+{
+    // Smallest OS page size, which the bundler aligns assemblies to.
+    const int64_t page_size = 4096;
+
+    int assembly_count = 0;
+    int unaligned_count = 0;
+    for (const file_entry_t& entry : m_manifest.files)
+    {
+        if (entry.type() != file_type_t::assembly || entry.compressedSize() != 0)
+            continue;
+
+        assembly_count++;
+        if ((entry.offset() + m_offset_in_file) % page_size != 0)
+        {
+            unaligned_count++;
+            trace::verbose(_X("Bundled assembly [%s] is not page aligned, offset [%" PRIx64 "]"), entry.relative_path().c_str(), entry.offset() + m_offset_in_file);
+        }
+    }
+
+    if (unaligned_count > 0)
+    {
+        trace::info(_X("%d of %d uncompressed assemblies in the bundle are not page aligned and will be copied when loaded."), unaligned_count, assembly_count);
+    }
+}
+
 const file_entry_t*  runner_t::probe(const pal::string_t &relative_path) const
 {
     for (const file_entry_t& entry : m_manifest.files)
@@ -66,8 +99,9 @@ bool runner_t::probe(const pal::string_t& relative_path, int64_t* offset, int64_
 {
     const bundle::file_entry_t* entry = probe(relative_path);
 
-    // Do not report extracted entries - those should be reported through either TPA or resource paths
-    if (entry == nullptr || entry->needs_extraction())
+    // Do not report extracted entries - those should be reported through either TPA or resource paths.
+    // Native libraries loaded from memory are only resolved through the p/invoke override.
+    if (entry == nullptr || entry->needs_extraction() || entry->is_loaded_from_memory())
     {
         return false;
     }
@@ -116,3 +150,116 @@ bool runner_t::disable(const pal::string_t& relative_path)
     return false;
 }
 
+
+bool runner_t::can_load_native_from_memory()
+{
+    // Opt-in: libraries loaded from memory are only visible to p/invokes, not to other
+    // native code or NativeLibrary APIs that expect them next to the app on disk.
+    pal::string_t value;
+    if (!pal::getenv(_X("DOTNET_BUNDLE_LOAD_NATIVE_FROM_MEMORY"), &value) ||
+        (value != _X("1") && pal::strcasecmp(value.c_str(), _X("true")) != 0))
+    {
+        return false;
+    }
+
+    FILE* file;
+    pal::string_t path;
+    if (!pal::create_memory_file(_X("probe"), &file, &path))
+    {
+        trace::info(_X("Loading native libraries from memory is not supported, they will be extracted."));
+        return false;
+    }
+
+    fclose(file);
+    trace::info(_X("Native libraries in the bundle will be loaded from memory."));
+    return true;
+}
+
+const file_entry_t* runner_t::probe_native_library(const pal::string_t& library_name) const
+{
+    // Match the variations of the name that the runtime probes for on disk.
+    const pal::string_t prefix = _STRINGIFY(LIB_PREFIX);
+    const pal::string_t suffix = _STRINGIFY(LIB_FILE_EXT);
+    pal::string_t file_name = get_filename(library_name);
+    std::vector<pal::string_t> candidates;
+    if (utils::ends_with(library_name, _STRINGIFY(LIB_FILE_EXT), true))
+    {
+        candidates.push_back(library_name);
+    }
+    else
+    {
+        pal::string_t dir = library_name.substr(0, library_name.length() - file_name.length());
+        candidates.push_back(dir + prefix + file_name + suffix);
+        candidates.push_back(library_name + suffix);
+        candidates.push_back(dir + prefix + file_name);
+        candidates.push_back(library_name);
+    }
+
+    for (const pal::string_t& candidate : candidates)
+    {
+        const file_entry_t* entry = probe(candidate);
+        if (entry != nullptr && entry->is_loaded_from_memory())
+            return entry;
+    }
+
+    return nullptr;
+}
+
+bool runner_t::load_native_library(const file_entry_t& entry, pal::dll_t* dll)
+{
+    FILE* file;
+    pal::string_t path;
+    if (!pal::create_memory_file(get_filename(entry.relative_path()).c_str(), &file, &path))
+        return false;
+
+    const char* addr = nullptr;
+    bool success = false;
+    try
+    {
+        addr = map_bundle();
+        reader_t reader(addr, m_bundle_size, m_header_offset);
+        extractor_t::write(entry, reader, file);
+        success = fflush(file) == 0 && pal::load_library(&path, dll);
+    }
+    catch (StatusCode)
+    {
+    }
+
+    if (addr != nullptr)
+        unmap_bundle(addr);
+
+    // The loaded image keeps its own mapping of the in-memory file.
+    fclose(file);
+
+    trace::info(_X("%s bundled native library [%s] from memory"), success ? _X("Loaded") : _X("Failed to load"), entry.relative_path().c_str());
+    return success;
+}
+
+const void* runner_t::resolve_native_export(const char* library_name, const char* entry_point_name)
+{
+    pal::string_t library_name_str;
+    if (!pal::clr_palstring(library_name, &library_name_str))
+        return nullptr;
+
+    const file_entry_t* entry = probe_native_library(library_name_str);
+    if (entry == nullptr)
+        return nullptr;
+
+    pal::dll_t dll;
+    {
+        std::lock_guard<std::mutex> lock(m_native_libraries_lock);
+        auto iter = m_native_libraries.find(entry->relative_path());
+        if (iter == m_native_libraries.end())
+        {
+            // Failures are cached as well, so that a library is only read from the bundle once.
+            if (!load_native_library(*entry, &dll))
+                dll = nullptr;
+
+            iter = m_native_libraries.emplace(entry->relative_path(), dll).first;
+        }
+
+        dll = iter->second;
+    }
+
+    return dll != nullptr ? (const void*)pal::get_symbol(dll, entry_point_name) : nullptr;
+}
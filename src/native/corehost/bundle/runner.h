@@ -4,6 +4,8 @@
 #ifndef __RUNNER_H__
 #define __RUNNER_H__
 
+#include <mutex>
+#include <unordered_map>
 #include "error_codes.h"
 #include "header.h"
 #include "manifest.h"
@@ -12,6 +14,7 @@
 // bundle::runner extends bundle::info to supports:
 // * Reading the bundle manifest and identifying file locations for the runtime
 // * Extracting bundled files to disk when necessary
+// * Loading bundled native libraries from memory, where supported
 // bundle::runner is used by HostPolicy.
 
 namespace bundle
@@ -37,6 +40,11 @@ namespace bundle
         }
         bool disable(const pal::string_t& relative_path);
 
+        // Gets an export from a bundled native library that is loaded from memory rather than
+        // extracted. library_name is the name as specified for a p/invoke. Returns nullptr if the
+        // library is not such a bundled library or doesn't have the export.
+        const void* resolve_native_export(const char* library_name, const char* entry_point_name);
+
         static StatusCode process_manifest_and_extract()
         {
             return mutable_app()->extract();
@@ -49,8 +57,18 @@ namespace bundle
 
         StatusCode extract();
 
+        void trace_assembly_alignment() const;
+        static bool can_load_native_from_memory();
+        const file_entry_t* probe_native_library(const pal::string_t& library_name) const;
+        bool load_native_library(const file_entry_t& entry, pal::dll_t* dll);
+
         manifest_t m_manifest;
         pal::string_t m_extraction_path;
+
+        // Native libraries loaded from memory, by relative path. Exports are resolved from
+        // arbitrary threads, so access is synchronized.
+        std::unordered_map<pal::string_t, pal::dll_t> m_native_libraries;
+        std::mutex m_native_libraries_lock;
     };
 }
 
@@ -3,6 +3,7 @@
 
 #include "corehost_init.h"
 #include "bundle/info.h"
+#include "trace.h"
 
 void make_cstr_arr(const std::vector<pal::string_t>& arr, std::vector<const pal::char_t*>* out)
 {
@@ -146,6 +147,9 @@ const host_interface_t& corehost_init_t::get_host_init_data()
         hi.single_file_bundle_header_offset = to_size_t_dbgchecked(offset);
     }
 
+    m_startup_checkpoints = trace::get_checkpoints();
+    hi.startup_checkpoints = m_startup_checkpoints.c_str();
+
     return hi;
 }
 
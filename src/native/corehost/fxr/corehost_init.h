@@ -36,6 +36,7 @@ private:
     const pal::string_t m_host_info_host_path;
     const pal::string_t m_host_info_dotnet_root;
     const pal::string_t m_host_info_app_path;
+    pal::string_t m_startup_checkpoints;
 
 public:
     corehost_init_t(
@@ -19,6 +19,7 @@
 #include "fx_reference.h"
 #include "fx_resolver.h"
 #include "fx_ver.h"
+#include "host_server.h"
 #include "host_startup_info.h"
 #include "hostpolicy_resolver.h"
 #include "runtime_config.h"
@@ -76,6 +77,7 @@ int load_hostpolicy(
         return rc;
     }
 
+    trace::checkpoint(_X("hostfxr_hostpolicy_loaded"));
     return StatusCode::Success;
 }
 
@@ -102,7 +104,11 @@ static int execute_app(
     hostpolicy_contract_t hostpolicy_contract{};
     corehost_main_fn host_main = nullptr;
 
-    int code = load_hostpolicy(impl_dll_dir, &hostpolicy_dll, hostpolicy_contract);
+    int code;
+    {
+        trace::phase_timer_t timer{ _X("load_hostpolicy") };
+        code = load_hostpolicy(impl_dll_dir, &hostpolicy_dll, hostpolicy_contract);
+    }
 
     // Obtain entrypoint symbol
     if (code == StatusCode::Success)
@@ -142,7 +148,16 @@ static int execute_app(
         const host_interface_t& intf = init->get_host_init_data();
         if ((code = hostpolicy_contract.load(&intf)) == StatusCode::Success)
         {
-            code = host_main(argc, argv);
+            if (host_server::is_listening())
+            {
+                // Hostpolicy and the runtime run in a process per request, after the fork.
+                code = host_server::run([&](int child_argc, const pal::char_t* child_argv[]) { return host_main(child_argc, child_argv); });
+            }
+            else
+            {
+                code = host_main(argc, argv);
+            }
+
             (void)hostpolicy_contract.unload();
         }
     }
@@ -495,6 +510,7 @@ namespace
             return StatusCode::CoreHostLibMissingFailure;
         }
 
+        trace::checkpoint(_X("hostfxr_frameworks_resolved"));
         init.reset(new corehost_init_t(host_command, host_info, deps_file, additional_deps_serialized, probe_fullpaths, mode, fx_definitions, additional_properties));
 
         return StatusCode::Success;
@@ -515,15 +531,20 @@ namespace
     {
         pal::string_t hostpolicy_dir;
         std::unique_ptr<corehost_init_t> init;
-        int rc = get_init_info_for_app(
-            host_command,
-            host_info,
-            app_candidate,
-            opts,
-            mode,
-            is_sdk_command,
-            hostpolicy_dir,
-            init);
+        int rc;
+        {
+            trace::phase_timer_t timer{ _X("resolve_frameworks") };
+            rc = get_init_info_for_app(
+                host_command,
+                host_info,
+                app_candidate,
+                opts,
+                mode,
+                is_sdk_command,
+                hostpolicy_dir,
+                init);
+        }
+
         if (rc != StatusCode::Success)
             return rc;
 
@@ -1003,6 +1024,17 @@ int fx_muxer_t::handle_exec_host_command(
 
     trace::info(_X("Using dotnet root path [%s]"), host_info.dotnet_root.c_str());
 
+    if (host_command.empty())
+    {
+        pal::string_t server_key = host_server::get_key(host_info, app_candidate, argc, argv, argoff, is_sdk_command);
+        int server_exit_code;
+        if (!host_server::begin_listen(server_key)
+            && host_server::try_execute_on_server(server_key, new_argc, new_argv, &server_exit_code))
+        {
+            return server_exit_code;
+        }
+    }
+
     // Transform dotnet [exec] [--additionalprobingpath path] [--depsfile file] [dll] [args] -> dotnet [dll] [args]
     return read_config_and_execute(
         host_command,
@@ -54,7 +54,7 @@ namespace
                 }
             }
 
-            if (trace::is_enabled())
+            if (trace::is_verbose_enabled())
             {
                 if (best_match_version == fx_ver_t())
                 {
@@ -92,7 +92,7 @@ namespace
                 apply_patch_from_version = fx_ref.get_fx_version_number();
             }
 
-            if (trace::is_enabled())
+            if (trace::is_verbose_enabled())
             {
                 trace::verbose(
                     _X("Applying patch roll forward from [%s] on %s"),
@@ -102,7 +102,7 @@ namespace
 
             for (const auto& ver : version_list)
             {
-                if (trace::is_enabled())
+                if (trace::is_verbose_enabled())
                 {
                     trace::verbose(_X("Inspecting version... [%s]"), ver.as_str().c_str());
                 }
@@ -176,7 +176,7 @@ namespace
         {
             trace::verbose(_X("Framework reference didn't resolve to any available version."));
         }
-        else if (trace::is_enabled())
+        else if (trace::is_verbose_enabled())
         {
             trace::verbose(_X("Framework reference resolved to version '%s'."), best_match.as_str().c_str());
         }
@@ -0,0 +1,594 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "host_server.h"
+#include <error_codes.h>
+#include <trace.h>
+#include <utils.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+#endif
+
+#define HOST_SERVER_ENV _X("DOTNET_HOST_SERVER")
+#define HOST_SERVER_LISTEN_ENV _X("DOTNET_HOST_SERVER_LISTEN")
+
+namespace
+{
+    // Bump when the request or response format changes.
+    const uint32_t protocol_version = 1;
+
+    // Response to a request
+    const int32_t response_rejected = 0;
+    const int32_t response_accepted = 1;
+
+    // Completion of an accepted request
+    const int32_t completion_exited = 0;
+    const int32_t completion_signaled = 1;
+
+    pal::string_t g_listen_path;
+    pal::string_t g_listen_key;
+
+    void append_key_value(pal::string_t* key, const pal::char_t* name, const pal::string_t& value)
+    {
+        key->append(name);
+        key->push_back(_X('='));
+        key->append(value);
+        key->push_back(_X('\n'));
+    }
+
+    void append_key_stamp(pal::string_t* key, const pal::string_t& path)
+    {
+        int64_t last_write_time;
+        int64_t size;
+        pal::stringstream_t stamp;
+        if (pal::get_file_stamp(path, &last_write_time, &size))
+        {
+            stamp << last_write_time << _X(':') << size;
+        }
+        else
+        {
+            stamp << _X("missing");
+        }
+
+        append_key_value(key, path.c_str(), stamp.str());
+    }
+
+#if !defined(_WIN32)
+    bool starts_with(const char* value, const char* prefix)
+    {
+        return ::strncmp(value, prefix, ::strlen(prefix)) == 0;
+    }
+
+    // Whether an environment variable can affect how the host resolves frameworks and hostpolicy.
+    // Those must match between the client and the server; anything else is applied in the child.
+    bool affects_host_resolution(const char* name_value)
+    {
+        if (starts_with(name_value, "DOTNET_HOST_SERVER=") || starts_with(name_value, "DOTNET_HOST_SERVER_LISTEN="))
+            return false;
+
+        return starts_with(name_value, "DOTNET_") || starts_with(name_value, "COREHOST_");
+    }
+
+    bool create_socket_address(const pal::string_t& path, sockaddr_un* address)
+    {
+        if (path.length() >= sizeof(address->sun_path))
+        {
+            trace::warning(_X("Host server socket path [%s] is too long"), path.c_str());
+            return false;
+        }
+
+        memset(address, 0, sizeof(*address));
+        address->sun_family = AF_UNIX;
+        memcpy(address->sun_path, path.c_str(), path.length());
+        return true;
+    }
+
+    bool write_all(int fd, const void* data, size_t size)
+    {
+        const char* ptr = static_cast<const char*>(data);
+        while (size > 0)
+        {
+            ssize_t written = ::send(fd, ptr, size, MSG_NOSIGNAL);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+
+                return false;
+            }
+
+            ptr += written;
+            size -= static_cast<size_t>(written);
+        }
+
+        return true;
+    }
+
+    bool read_all(int fd, void* data, size_t size)
+    {
+        char* ptr = static_cast<char*>(data);
+        while (size > 0)
+        {
+            ssize_t received = ::recv(fd, ptr, size, 0);
+            if (received < 0 && errno == EINTR)
+                continue;
+
+            if (received <= 0)
+                return false;
+
+            ptr += received;
+            size -= static_cast<size_t>(received);
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    bool write_value(int fd, T value)
+    {
+        return write_all(fd, &value, sizeof(value));
+    }
+
+    template<typename T>
+    bool read_value(int fd, T* value)
+    {
+        return read_all(fd, value, sizeof(*value));
+    }
+
+    bool write_string(int fd, const pal::string_t& value)
+    {
+        return write_value(fd, static_cast<uint32_t>(value.length())) && write_all(fd, value.data(), value.length());
+    }
+
+    bool read_string(int fd, pal::string_t* value)
+    {
+        uint32_t length;
+        if (!read_value(fd, &length))
+            return false;
+
+        value->resize(length);
+        return length == 0 || read_all(fd, &(*value)[0], length);
+    }
+
+    bool write_strings(int fd, const std::vector<pal::string_t>& values)
+    {
+        if (!write_value(fd, static_cast<uint32_t>(values.size())))
+            return false;
+
+        for (const pal::string_t& value : values)
+        {
+            if (!write_string(fd, value))
+                return false;
+        }
+
+        return true;
+    }
+
+    bool read_strings(int fd, std::vector<pal::string_t>* values)
+    {
+        uint32_t count;
+        if (!read_value(fd, &count))
+            return false;
+
+        values->resize(count);
+        for (pal::string_t& value : *values)
+        {
+            if (!read_string(fd, &value))
+                return false;
+        }
+
+        return true;
+    }
+
+    // The standard handles are passed along with the protocol version, so that the child
+    // writes straight to the client's terminal, pipes or files.
+    const int std_handle_count = 3;
+
+    bool send_std_handles(int fd)
+    {
+        int fds[std_handle_count] = { STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO };
+        char control[CMSG_SPACE(sizeof(fds))] = {};
+        uint32_t version = protocol_version;
+        iovec iov = { &version, sizeof(version) };
+
+        msghdr msg = {};
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+        memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+        ssize_t sent;
+        while ((sent = ::sendmsg(fd, &msg, MSG_NOSIGNAL)) < 0 && errno == EINTR);
+        return sent == sizeof(version);
+    }
+
+    bool receive_std_handles(int fd, int (&fds)[std_handle_count])
+    {
+        char control[CMSG_SPACE(sizeof(fds))] = {};
+        uint32_t version = 0;
+        iovec iov = { &version, sizeof(version) };
+
+        msghdr msg = {};
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        ssize_t received;
+        while ((received = ::recvmsg(fd, &msg, MSG_CMSG_CLOEXEC)) < 0 && errno == EINTR);
+
+        cmsghdr* cmsg = received == sizeof(version) ? CMSG_FIRSTHDR(&msg) : nullptr;
+        if (cmsg == nullptr || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS || cmsg->cmsg_len != CMSG_LEN(sizeof(fds)))
+            return false;
+
+        memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+        if (version != protocol_version)
+        {
+            for (int std_fd : fds)
+                ::close(std_fd);
+
+            return false;
+        }
+
+        return true;
+    }
+
+    struct request_t
+    {
+        pal::string_t key;
+        pal::string_t cwd;
+        std::vector<pal::string_t> argv;
+        std::vector<pal::string_t> environment;
+        int std_handles[std_handle_count];
+    };
+
+    bool read_request(int fd, request_t* request)
+    {
+        if (!receive_std_handles(fd, request->std_handles))
+            return false;
+
+        if (read_string(fd, &request->key)
+            && read_string(fd, &request->cwd)
+            && read_strings(fd, &request->argv)
+            && read_strings(fd, &request->environment))
+        {
+            return true;
+        }
+
+        for (int std_fd : request->std_handles)
+            ::close(std_fd);
+
+        return false;
+    }
+
+    // Runs in the forked child: takes on the client's state and runs the app.
+    [[noreturn]] void run_request(int listen_fd, const request_t& request, const std::function<int(int argc, const pal::char_t* argv[])>& run_app)
+    {
+        ::close(listen_fd);
+
+        for (int i = 0; i < std_handle_count; ++i)
+        {
+            ::dup2(request.std_handles[i], i);
+            ::close(request.std_handles[i]);
+        }
+
+        signal(SIGINT, SIG_DFL);
+        signal(SIGTERM, SIG_DFL);
+        signal(SIGCHLD, SIG_DFL);
+        signal(SIGPIPE, SIG_DFL);
+
+        if (::chdir(request.cwd.c_str()) != 0)
+        {
+            trace::error(_X("Failed to change the working directory to [%s], errno: %d"), request.cwd.c_str(), errno);
+            _exit(1);
+        }
+
+        // Variables that affect host resolution are the same by construction of the key, the rest are
+        // replaced wholesale.
+        clearenv();
+        for (const pal::string_t& name_value : request.environment)
+            ::putenv(const_cast<char*>(name_value.c_str()));
+
+        std::vector<const pal::char_t*> argv;
+        for (const pal::string_t& arg : request.argv)
+            argv.push_back(arg.c_str());
+
+        int exit_code = run_app(static_cast<int>(argv.size()), argv.data());
+
+        // Run static destructors and atexit handlers as a normal exit would.
+        exit(exit_code);
+    }
+#endif // !_WIN32
+}
+
+pal::string_t host_server::get_key(
+    const host_startup_info_t& host_info,
+    const pal::string_t& app_candidate,
+    int argc,
+    const pal::char_t* argv[],
+    int argoff,
+    bool is_sdk_command)
+{
+    pal::string_t key;
+    append_key_value(&key, _X("host_path"), host_info.host_path);
+    append_key_value(&key, _X("dotnet_root"), host_info.dotnet_root);
+    append_key_value(&key, _X("app_path"), host_info.app_path);
+    append_key_value(&key, _X("app"), app_candidate);
+    append_key_value(&key, _X("sdk_command"), is_sdk_command ? _X("1") : _X("0"));
+
+    // Host options, e.g. --runtimeconfig or --fx-version
+    for (int i = 1; i < argoff; ++i)
+        append_key_value(&key, _X("option"), argv[i]);
+
+    // The SDK is resolved based on global.json relative to the working directory.
+    if (is_sdk_command || !pal::is_path_rooted(app_candidate))
+    {
+        pal::string_t cwd;
+        pal::getcwd(&cwd);
+        append_key_value(&key, _X("cwd"), cwd);
+    }
+
+    // Rebuilding the app updates the app and its configuration.
+    pal::string_t config_path = get_directory(app_candidate);
+    append_path(&config_path, get_filename_without_ext(app_candidate).c_str());
+    append_key_stamp(&key, app_candidate);
+    append_key_stamp(&key, config_path + _X(".runtimeconfig.json"));
+    append_key_stamp(&key, config_path + _X(".runtimeconfig.dev.json"));
+
+#if !defined(_WIN32)
+    std::vector<pal::string_t> variables;
+    for (char** env = environ; *env != nullptr; ++env)
+    {
+        if (affects_host_resolution(*env))
+            variables.push_back(*env);
+    }
+
+    std::sort(variables.begin(), variables.end());
+    for (const pal::string_t& variable : variables)
+        append_key_value(&key, _X("env"), variable);
+#endif
+
+    return key;
+}
+
+bool host_server::try_execute_on_server(const pal::string_t& key, int argc, const pal::char_t* argv[], int* exit_code)
+{
+#if defined(_WIN32)
+    return false;
+#else
+    pal::string_t path;
+    if (!pal::getenv(HOST_SERVER_ENV, &path) || path.empty() || is_listening())
+        return false;
+
+    sockaddr_un address;
+    if (!create_socket_address(path, &address))
+        return false;
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd == -1)
+        return false;
+
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        trace::verbose(_X("Host server at [%s] is not available, errno: %d"), path.c_str(), errno);
+        ::close(fd);
+        return false;
+    }
+
+    pal::string_t cwd;
+    std::vector<pal::string_t> args(argv, argv + argc);
+    std::vector<pal::string_t> environment;
+    for (char** env = environ; *env != nullptr; ++env)
+        environment.push_back(*env);
+
+    int32_t response = response_rejected;
+    int32_t child_pid = 0;
+    bool success = pal::getcwd(&cwd)
+        && send_std_handles(fd)
+        && write_string(fd, key)
+        && write_string(fd, cwd)
+        && write_strings(fd, args)
+        && write_strings(fd, environment)
+        && read_value(fd, &response);
+
+    if (!success || response != response_accepted || !read_value(fd, &child_pid))
+    {
+        trace::verbose(_X("Host server at [%s] did not accept the request, running the app in this process"), path.c_str());
+        ::close(fd);
+        return false;
+    }
+
+    trace::info(_X("Running the app on host server [%s], process id: %d"), path.c_str(), child_pid);
+
+    // Nothing that fails from here on can be retried locally, as the app has started. Forward the
+    // usual termination requests to the child and report its exit status as ours.
+    static pid_t s_child_pid;
+    s_child_pid = static_cast<pid_t>(child_pid);
+    struct sigaction forward = {};
+    forward.sa_handler = [](int signal) { ::kill(s_child_pid, signal); };
+    sigaction(SIGINT, &forward, nullptr);
+    sigaction(SIGTERM, &forward, nullptr);
+    sigaction(SIGQUIT, &forward, nullptr);
+    sigaction(SIGHUP, &forward, nullptr);
+
+    int32_t completion;
+    int32_t value;
+    if (!read_value(fd, &completion) || !read_value(fd, &value))
+    {
+        trace::error(_X("Lost the connection to the host server [%s]"), path.c_str());
+        ::close(fd);
+        *exit_code = StatusCode::HostApiFailed;
+        return true;
+    }
+
+    ::close(fd);
+    if (completion == completion_signaled)
+    {
+        // Terminate the same way the child did.
+        signal(value, SIG_DFL);
+        ::raise(value);
+    }
+
+    *exit_code = value;
+    return true;
+#endif
+}
+
+bool host_server::begin_listen(const pal::string_t& key)
+{
+#if defined(_WIN32)
+    return false;
+#else
+    if (!pal::getenv(HOST_SERVER_LISTEN_ENV, &g_listen_path) || g_listen_path.empty())
+        return false;
+
+    g_listen_key = key;
+    return true;
+#endif
+}
+
+bool host_server::is_listening()
+{
+    return !g_listen_path.empty();
+}
+
+int host_server::run(const std::function<int(int argc, const pal::char_t* argv[])>& run_app)
+{
+#if defined(_WIN32)
+    return StatusCode::HostApiUnsupportedScenario;
+#else
+    assert(is_listening());
+
+    sockaddr_un address;
+    if (!create_socket_address(g_listen_path, &address))
+        return StatusCode::InvalidArgFailure;
+
+    int listen_fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd == -1)
+    {
+        trace::error(_X("Failed to create the host server socket, errno: %d"), errno);
+        return StatusCode::HostApiFailed;
+    }
+
+    // Only the current user can connect. A stale socket from a previous server is replaced.
+    ::unlink(g_listen_path.c_str());
+    mode_t previous_mask = ::umask(0077);
+    bool bound = ::bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    ::umask(previous_mask);
+    if (!bound || ::listen(listen_fd, SOMAXCONN) != 0)
+    {
+        trace::error(_X("Failed to listen on host server socket [%s], errno: %d"), g_listen_path.c_str(), errno);
+        ::close(listen_fd);
+        return StatusCode::HostApiFailed;
+    }
+
+    trace::info(_X("Host server listening on [%s]"), g_listen_path.c_str());
+    trace::flush();
+
+    signal(SIGPIPE, SIG_IGN);
+
+    // Children that are running, with the connection to their client.
+    std::unordered_map<pid_t, int> children;
+    for (;;)
+    {
+        // Report children that completed. Polling with a timeout keeps the server single threaded,
+        // which fork relies on.
+        int status;
+        pid_t pid;
+        while ((pid = ::waitpid(-1, &status, WNOHANG)) > 0)
+        {
+            auto iter = children.find(pid);
+            if (iter == children.end())
+                continue;
+
+            bool signaled = WIFSIGNALED(status);
+            write_value(iter->second, signaled ? completion_signaled : completion_exited);
+            write_value(iter->second, static_cast<int32_t>(signaled ? WTERMSIG(status) : WEXITSTATUS(status)));
+            ::close(iter->second);
+            children.erase(iter);
+        }
+
+        pollfd poll_fd = { listen_fd, POLLIN, 0 };
+        int ready = ::poll(&poll_fd, 1, children.empty() ? -1 : 50 /*ms*/);
+        if (ready <= 0)
+            continue;
+
+        int client_fd = ::accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client_fd == -1)
+            continue;
+
+        request_t request;
+        if (!read_request(client_fd, &request))
+        {
+            ::close(client_fd);
+            continue;
+        }
+
+        if (request.key != g_listen_key)
+        {
+            trace::info(_X("Host server rejected a request for a different app or host configuration"));
+            write_value(client_fd, response_rejected);
+            ::close(client_fd);
+            for (int std_fd : request.std_handles)
+                ::close(std_fd);
+
+            continue;
+        }
+
+        // Output buffered in the server would otherwise be written again by the child.
+        fflush(stdout);
+        fflush(stderr);
+
+        pid = ::fork();
+        if (pid == 0)
+        {
+            ::close(client_fd);
+            for (const auto& child : children)
+                ::close(child.second);
+
+            run_request(listen_fd, request, run_app);
+        }
+
+        for (int std_fd : request.std_handles)
+            ::close(std_fd);
+
+        if (pid == -1)
+        {
+            trace::warning(_X("Host server failed to create a process for a request, errno: %d"), errno);
+            write_value(client_fd, response_rejected);
+            ::close(client_fd);
+            continue;
+        }
+
+        if (!write_value(client_fd, response_accepted) || !write_value(client_fd, static_cast<int32_t>(pid)))
+        {
+            // The client is gone, the child still runs to completion.
+            ::close(client_fd);
+            continue;
+        }
+
+        children.emplace(pid, client_fd);
+    }
+#endif
+}
@@ -0,0 +1,49 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef __HOST_SERVER_H__
+#define __HOST_SERVER_H__
+
+#include <functional>
+#include <pal.h>
+#include "host_startup_info.h"
+
+// Opt-in resident host for repeated short-lived launches of the same app (Unix only).
+//
+// A server is started with DOTNET_HOST_SERVER_LISTEN=<socket path> and the usual command line for the
+// app. It resolves the frameworks and hostpolicy once and then waits for requests on the socket.
+// Launches with DOTNET_HOST_SERVER=<socket path> hand their command line, working directory,
+// environment and standard handles to the server if everything that affects host resolution matches
+// (see get_key). The server forks a child per request, which runs the app with the client's state in a
+// process of its own, and the client exits with the child's exit status.
+//
+// The fork happens before hostpolicy and the runtime run, so each launch still resolves its
+// dependencies and initializes the runtime - only the host resolution and process startup is shared.
+// If connecting fails or the server rejects the request, the launch proceeds normally.
+namespace host_server
+{
+    // Builds the key that identifies launches which can be served by the same server.
+    pal::string_t get_key(
+        const host_startup_info_t& host_info,
+        const pal::string_t& app_candidate,
+        int argc,
+        const pal::char_t* argv[],
+        int argoff,
+        bool is_sdk_command);
+
+    // If DOTNET_HOST_SERVER is set, tries to run the app on the server. Returns true and the exit code if
+    // a server ran it.
+    bool try_execute_on_server(const pal::string_t& key, int argc, const pal::char_t* argv[], int* exit_code);
+
+    // If DOTNET_HOST_SERVER_LISTEN is set, records the key for the server and returns true. The server is
+    // then run with run() once the host is ready to execute the app.
+    bool begin_listen(const pal::string_t& key);
+    bool is_listening();
+
+    // Serves requests until the process is terminated. run_app is called in a child process for each
+    // request and the child exits with its result. Only returns (with an error) in the server process if
+    // the socket cannot be created.
+    int run(const std::function<int(int argc, const pal::char_t* argv[])>& run_app);
+}
+
+#endif // __HOST_SERVER_H__
@@ -30,6 +30,7 @@ namespace
 SHARED_API int HOSTFXR_CALLTYPE hostfxr_main_bundle_startupinfo(const int argc, const pal::char_t* argv[], const pal::char_t* host_path, const pal::char_t* dotnet_root, const pal::char_t* app_path, int64_t bundle_header_offset)
 {
     trace_hostfxr_entry_point(_X("hostfxr_main_bundle_startupinfo"));
+    trace::checkpoint(_X("hostfxr_main_bundle_startupinfo"));
 
     StatusCode bundleStatus = bundle::info_t::process_bundle(host_path, app_path, bundle_header_offset);
     if (bundleStatus != StatusCode::Success)
@@ -52,6 +53,7 @@ SHARED_API int HOSTFXR_CALLTYPE hostfxr_main_bundle_startupinfo(const int argc,
 SHARED_API int HOSTFXR_CALLTYPE hostfxr_main_startupinfo(const int argc, const pal::char_t* argv[], const pal::char_t* host_path, const pal::char_t* dotnet_root, const pal::char_t* app_path)
 {
     trace_hostfxr_entry_point(_X("hostfxr_main_startupinfo"));
+    trace::checkpoint(_X("hostfxr_main_startupinfo"));
 
     if (host_path == nullptr || dotnet_root == nullptr || app_path == nullptr)
     {
@@ -66,6 +68,7 @@ SHARED_API int HOSTFXR_CALLTYPE hostfxr_main_startupinfo(const int argc, const p
 SHARED_API int HOSTFXR_CALLTYPE hostfxr_main(const int argc, const pal::char_t* argv[])
 {
     trace_hostfxr_entry_point(_X("hostfxr_main"));
+    trace::checkpoint(_X("hostfxr_main"));
 
     host_startup_info_t startup_info;
     startup_info.parse(argc, argv);
@@ -699,6 +702,7 @@ SHARED_API int32_t HOSTFXR_CALLTYPE hostfxr_initialize_for_dotnet_command_line(
     /*out*/ hostfxr_handle * host_context_handle)
 {
     trace_hostfxr_entry_point(_X("hostfxr_initialize_for_dotnet_command_line"));
+    trace::checkpoint(_X("hostfxr_initialize_for_dotnet_command_line"));
 
     if (host_context_handle == nullptr || argv == nullptr || argc == 0)
         return StatusCode::InvalidArgFailure;
@@ -741,6 +745,7 @@ SHARED_API int32_t HOSTFXR_CALLTYPE hostfxr_initialize_for_runtime_config(
     /*out*/ hostfxr_handle *host_context_handle)
 {
     trace_hostfxr_entry_point(_X("hostfxr_initialize_for_runtime_config"));
+    trace::checkpoint(_X("hostfxr_initialize_for_runtime_config"));
 
     if (runtime_config_path == nullptr || host_context_handle == nullptr)
         return StatusCode::InvalidArgFailure;
@@ -475,7 +475,7 @@ bool sdk_resolver::resolve_sdk_path_and_version(const pal::string_t& dir, pal::s
             // The SDK path has been resolved
             return true;
         }
-        else if (trace::is_enabled() && pal::directory_exists(probe_path))
+        else if (trace::is_verbose_enabled() && pal::directory_exists(probe_path))
         {
             trace::verbose(_X("Ignoring version [%s] without ") SDK_DOTNET_DLL, requested_version.as_str().c_str());
         }
@@ -21,7 +21,9 @@
 #define HOST_PROPERTY_NATIVE_DLL_SEARCH_DIRECTORIES "NATIVE_DLL_SEARCH_DIRECTORIES"
 #define HOST_PROPERTY_PINVOKE_OVERRIDE "PINVOKE_OVERRIDE"
 #define HOST_PROPERTY_PLATFORM_RESOURCE_ROOTS "PLATFORM_RESOURCE_ROOTS"
+#define HOST_PROPERTY_STARTUP_CHECKPOINTS "HOST_STARTUP_CHECKPOINTS"
 #define HOST_PROPERTY_TRUSTED_PLATFORM_ASSEMBLIES "TRUSTED_PLATFORM_ASSEMBLIES"
+#define HOST_PROPERTY_TRUSTED_PLATFORM_ASSEMBLIES_INDEX "TRUSTED_PLATFORM_ASSEMBLIES_INDEX"
 
 struct host_runtime_contract
 {
@@ -269,6 +269,10 @@ namespace pal
 
     string_t get_timestamp();
 
+    // High resolution timestamp on the same clock as the runtime's QueryPerformanceCounter, so that
+    // timestamps taken by the host can be put on the runtime's event timeline.
+    int64_t get_performance_counter();
+
     bool getcwd(string_t* recv);
 
     string_t get_current_os_rid_platform();
@@ -287,6 +291,8 @@ namespace pal
     bool fullpath(string_t* path, bool skip_error_logging = false);
     bool file_exists(const string_t& path);
     inline bool directory_exists(const string_t& path) { return file_exists(path); }
+    // Gets the last write time (in platform specific units) and size of a file or directory.
+    bool get_file_stamp(const string_t& path, int64_t* last_write_time, int64_t* size);
     void readdir(const string_t& path, const string_t& pattern, std::vector<string_t>* list);
     void readdir(const string_t& path, std::vector<string_t>* list);
     void readdir_onlydirectories(const string_t& path, const string_t& pattern, std::vector<string_t>* list);
@@ -347,6 +353,10 @@ namespace pal
     proc_t get_symbol(dll_t library, const char* name);
     void unload_library(dll_t library);
 
+    // Creates an anonymous in-memory file that load_library can load from the returned path
+    // once its contents are written and flushed. Returns false if not supported on the platform.
+    bool create_memory_file(const char_t* name, FILE** file, string_t* path);
+
     bool is_running_in_wow64();
     bool is_emulating_x64();
 
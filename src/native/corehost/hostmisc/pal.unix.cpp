@@ -24,6 +24,8 @@
 #include <mach-o/dyld.h>
 #include <sys/param.h>
 #include <sys/sysctl.h>
+#elif defined(TARGET_LINUX)
+#include <sys/syscall.h>
 #elif defined(__sun)
 #include <sys/utsname.h>
 #elif defined(TARGET_FREEBSD)
@@ -59,6 +61,20 @@ pal::string_t pal::get_timestamp()
     return pal::string_t(buf);
 }
 
+int64_t pal::get_performance_counter()
+{
+    // Matches QueryPerformanceCounter in the CoreCLR PAL
+#if defined(__APPLE__)
+    return (int64_t)clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+#else
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        return 0;
+
+    return ((int64_t)ts.tv_sec * 1000000000) + (int64_t)ts.tv_nsec;
+#endif
+}
+
 bool pal::touch_file(const pal::string_t& path)
 {
     int fd = open(path.c_str(), (O_CREAT | O_EXCL), (S_IRUSR | S_IRGRP | S_IROTH));
@@ -255,6 +271,33 @@ void pal::unload_library(dll_t library)
     }
 }
 
+bool pal::create_memory_file(const char_t* name, FILE** file, string_t* path)
+{
+#if defined(TARGET_LINUX) && defined(__NR_memfd_create)
+    // Call memfd_create through syscall since the wrapper is only in glibc 2.27+.
+    const unsigned int MemfdCloexec = 0x1; // MFD_CLOEXEC
+    int fd = static_cast<int>(syscall(__NR_memfd_create, name, MemfdCloexec));
+    if (fd == -1)
+    {
+        trace::verbose(_X("Failed to create in-memory file %s, errno: %d"), name, errno);
+        return false;
+    }
+
+    *file = fdopen(fd, "wb");
+    if (*file == nullptr)
+    {
+        close(fd);
+        return false;
+    }
+
+    path->assign(_X("/proc/self/fd/"));
+    path->append(pal::to_string(fd));
+    return true;
+#else
+    return false;
+#endif
+}
+
 int pal::xtoi(const char_t* input)
 {
     return atoi(input);
@@ -993,6 +1036,19 @@ bool pal::file_exists(const pal::string_t& path)
     return (::access(path.c_str(), F_OK) == 0);
 }
 
+bool pal::get_file_stamp(const pal::string_t& path, int64_t* last_write_time, int64_t* size)
+{
+    struct stat buf;
+    if (::stat(path.c_str(), &buf) != 0)
+    {
+        return false;
+    }
+
+    *last_write_time = static_cast<int64_t>(buf.st_mtime);
+    *size = static_cast<int64_t>(buf.st_size);
+    return true;
+}
+
 static void readdir(const pal::string_t& path, const pal::string_t& pattern, bool onlydirectories, std::vector<pal::string_t>* list)
 {
     assert(list != nullptr);
@@ -142,6 +142,15 @@ pal::string_t pal::get_timestamp()
     return pal::string_t(buf);
 }
 
+int64_t pal::get_performance_counter()
+{
+    LARGE_INTEGER counter;
+    if (!::QueryPerformanceCounter(&counter))
+        return 0;
+
+    return counter.QuadPart;
+}
+
 bool pal::touch_file(const pal::string_t& path)
 {
     HANDLE hnd = ::CreateFileW(path.c_str(), 0, 0, NULL, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, NULL);
@@ -320,6 +329,12 @@ void pal::unload_library(dll_t library)
     // No-op. On windows, we pin the library, so it can't be unloaded.
 }
 
+bool pal::create_memory_file(const char_t* name, FILE** file, string_t* path)
+{
+    // LoadLibrary only loads images from files on disk.
+    return false;
+}
+
 static
 bool get_wow_mode_program_files(pal::string_t* recv)
 {
@@ -984,6 +999,25 @@ bool pal::file_exists(const string_t& path)
     return pal::fullpath(&tmp, true);
 }
 
+bool pal::get_file_stamp(const string_t& path, int64_t* last_write_time, int64_t* size)
+{
+    string_t tmp(path);
+    if (!pal::fullpath(&tmp, true))
+    {
+        return false;
+    }
+
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (GetFileAttributesExW(tmp.c_str(), GetFileExInfoStandard, &data) == 0)
+    {
+        return false;
+    }
+
+    *last_write_time = (static_cast<int64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+    *size = (static_cast<int64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    return true;
+}
+
 static void readdir(const pal::string_t& path, const pal::string_t& pattern, bool onlydirectories, std::vector<pal::string_t>* list)
 {
     assert(list != nullptr);
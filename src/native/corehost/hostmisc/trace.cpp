@@ -5,6 +5,7 @@
 #include <mutex>
 #include <thread>
 #include <atomic>
+#include <vector>
 
 #define TRACE_VERBOSITY_WARN 2
 #define TRACE_VERBOSITY_INFO 3
@@ -18,7 +19,9 @@
 //  COREHOST_TRACE=1 COREHOST_TRACE_VERBOSITY=2          implies g_trace_verbosity = 2.  // Trace "enabled".  warn() and error() messages will be produced
 //  COREHOST_TRACE=1 COREHOST_TRACE_VERBOSITY=1          implies g_trace_verbosity = 1.  // Trace "enabled".  error() messages will be produced
 static int g_trace_verbosity = 0;
+static bool g_trace_timing = false;
 static FILE * g_trace_file = nullptr;
+static std::vector<std::pair<pal::string_t, int64_t>> g_checkpoints;
 thread_local static trace::error_writer_fn g_error_writer = nullptr;
 
 namespace
@@ -50,13 +53,64 @@ namespace
     };
 
     spin_lock g_trace_lock;
+
+    void file_printf(FILE* file, const pal::char_t* format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        pal::file_vprintf(file, format, args);
+        va_end(args);
+    }
+
+    // Opens the trace file if it wasn't yet. Must be called with g_trace_lock held.
+    // Returns false if COREHOST_TRACEFILE is set and cannot be opened.
+    bool open_trace_file(pal::string_t* tracefile_str)
+    {
+        if (g_trace_file != nullptr)
+            return true;
+
+        g_trace_file = stderr;  // Trace to stderr by default
+        if (pal::getenv(_X("COREHOST_TRACEFILE"), tracefile_str))
+        {
+            FILE *tracefile = pal::file_open(*tracefile_str, _X("a"));
+
+            if (tracefile)
+            {
+                setvbuf(tracefile, nullptr, _IONBF, 0);
+                g_trace_file = tracefile;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
 }
 
 //
-// Turn on tracing for the corehost based on "COREHOST_TRACE" & "COREHOST_TRACEFILE" env.
+// Turn on tracing for the corehost based on "COREHOST_TRACE", "COREHOST_TRACE_TIMING" & "COREHOST_TRACEFILE" env.
 //
 void trace::setup()
 {
+    pal::string_t timing_str;
+    if (!g_trace_timing && pal::getenv(_X("COREHOST_TRACE_TIMING"), &timing_str) && pal::xtoi(timing_str.c_str()) > 0)
+    {
+        bool file_open_error;
+        pal::string_t tracefile_str;
+        {
+            std::lock_guard<spin_lock> lock(g_trace_lock);
+            file_open_error = !open_trace_file(&tracefile_str);
+            g_trace_timing = true;
+        }
+
+        if (file_open_error)
+        {
+            trace::error(_X("Unable to open COREHOST_TRACEFILE=%s for writing"), tracefile_str.c_str());
+        }
+    }
+
     // Read trace environment variable
     pal::string_t trace_str;
     if (!pal::getenv(_X("COREHOST_TRACE"), &trace_str))
@@ -88,21 +142,7 @@ bool trace::enable()
     {
         std::lock_guard<spin_lock> lock(g_trace_lock);
 
-        g_trace_file = stderr;  // Trace to stderr by default
-        if (pal::getenv(_X("COREHOST_TRACEFILE"), &tracefile_str))
-        {
-            FILE *tracefile = pal::file_open(tracefile_str, _X("a"));
-
-            if (tracefile)
-            {
-                setvbuf(tracefile, nullptr, _IONBF, 0);
-                g_trace_file = tracefile;
-            }
-            else
-            {
-                file_open_error = true;
-            }
-        }
+        file_open_error = !open_trace_file(&tracefile_str);
 
         pal::string_t trace_str;
         if (!pal::getenv(_X("COREHOST_TRACE_VERBOSITY"), &trace_str))
@@ -127,6 +167,30 @@ bool trace::is_enabled()
     return g_trace_verbosity;
 }
 
+bool trace::is_info_enabled()
+{
+    return g_trace_verbosity >= TRACE_VERBOSITY_INFO;
+}
+
+bool trace::is_verbose_enabled()
+{
+    return g_trace_verbosity >= TRACE_VERBOSITY_VERBOSE;
+}
+
+bool trace::is_timing_enabled()
+{
+    return g_trace_timing;
+}
+
+void trace::write_timing(const pal::char_t* phase, double elapsed_ms)
+{
+    if (!g_trace_timing)
+        return;
+
+    std::lock_guard<spin_lock> lock(g_trace_lock);
+    file_printf(g_trace_file, _X("Timing: phase=%s elapsed_ms=%.3f"), phase, elapsed_ms);
+}
+
 void trace::verbose(const pal::char_t* format, ...)
 {
     if (g_trace_verbosity < TRACE_VERBOSITY_VERBOSE)
@@ -249,3 +313,63 @@ trace::error_writer_fn trace::get_error_writer()
     // No need for locking since g_error_writer is thread local.
     return g_error_writer;
 }
+
+void trace::checkpoint(const pal::char_t* name)
+{
+    int64_t timestamp = pal::get_performance_counter();
+
+    std::lock_guard<spin_lock> lock(g_trace_lock);
+    g_checkpoints.emplace_back(name, timestamp);
+}
+
+pal::string_t trace::get_checkpoints()
+{
+    pal::string_t serialized;
+    pal::char_t buffer[32];
+
+    std::lock_guard<spin_lock> lock(g_trace_lock);
+    for (const auto& checkpoint : g_checkpoints)
+    {
+        pal::snwprintf(buffer, sizeof(buffer) / sizeof(*buffer), _X("%lld"), (long long)checkpoint.second);
+        serialized.append(checkpoint.first);
+        serialized.push_back(_X('='));
+        serialized.append(buffer);
+        serialized.push_back(_X(';'));
+    }
+
+    return serialized;
+}
+
+void trace::add_checkpoints(const pal::char_t* serialized)
+{
+    if (serialized == nullptr)
+        return;
+
+    std::lock_guard<spin_lock> lock(g_trace_lock);
+    if (!g_checkpoints.empty())
+        return;
+
+    const pal::char_t* entry = serialized;
+    while (*entry != _X('\0'))
+    {
+        const pal::char_t* separator = entry;
+        while (*separator != _X('\0') && *separator != _X('='))
+            separator++;
+
+        if (*separator == _X('\0'))
+            break;
+
+        int64_t timestamp = 0;
+        const pal::char_t* digit = separator + 1;
+        for (; *digit >= _X('0') && *digit <= _X('9'); digit++)
+            timestamp = timestamp * 10 + (*digit - _X('0'));
+
+        g_checkpoints.emplace_back(pal::string_t(entry, separator - entry), timestamp);
+
+        entry = digit;
+        if (*entry == _X(';'))
+            entry++;
+        else
+            break;
+    }
+}
@@ -5,12 +5,19 @@
 #define TRACE_H
 
 #include "pal.h"
+#include <chrono>
 
 namespace trace
 {
     void setup();
     bool enable();
     bool is_enabled();
+
+    // Whether messages of the given level are written. Call sites which need to do work (allocate,
+    // format versions, etc.) to build the arguments of a message should check the level first.
+    bool is_info_enabled();
+    bool is_verbose_enabled();
+
     void verbose(const pal::char_t* format, ...);
     void info(const pal::char_t* format, ...);
     void warning(const pal::char_t* format, ...);
@@ -30,6 +37,52 @@ namespace trace
 
     // Returns the currently set callback for error writing
     error_writer_fn get_error_writer();
+
+    // Startup phase timing is enabled by COREHOST_TRACE_TIMING=1 independently of COREHOST_TRACE, so that
+    // the timings are not skewed by writing the full trace. One line per phase is written to the trace
+    // file (COREHOST_TRACEFILE) or stderr:
+    //   Timing: phase=<name> elapsed_ms=<milliseconds>
+    bool is_timing_enabled();
+    void write_timing(const pal::char_t* phase, double elapsed_ms);
+
+    // Writes the timing of a phase that lasts to the end of the scope
+    class phase_timer_t
+    {
+    public:
+        explicit phase_timer_t(const pal::char_t* phase)
+            : m_phase(phase)
+            , m_enabled(is_timing_enabled())
+        {
+            if (m_enabled)
+                m_start = std::chrono::steady_clock::now();
+        }
+
+        ~phase_timer_t()
+        {
+            if (m_enabled)
+                write_timing(m_phase, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count());
+        }
+
+        phase_timer_t(const phase_timer_t&) = delete;
+        phase_timer_t& operator=(const phase_timer_t&) = delete;
+
+    private:
+        const pal::char_t* m_phase;
+        bool m_enabled;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    // Startup checkpoints mark points in the host's part of startup with a pal::get_performance_counter
+    // timestamp. There are only a handful, so they are always recorded. hostpolicy passes them to the runtime
+    // (HOST_STARTUP_CHECKPOINTS property), which reports them with its own checkpoints in EventPipe rundown.
+    void checkpoint(const pal::char_t* name);
+
+    // Returns the recorded checkpoints serialized as "<name>=<timestamp>;..."
+    pal::string_t get_checkpoints();
+
+    // Adds checkpoints serialized by get_checkpoints in another host component. Ignored if checkpoints were
+    // already recorded, which is the case when the components are linked together and share them.
+    void add_checkpoints(const pal::char_t* serialized);
 };
 
 #endif // TRACE_H
@@ -20,6 +20,37 @@ static pal::string_t normalize_dir_separator(const pal::string_t& path)
     return normalized_path;
 }
 
+static pal::string_t get_listing_name(const pal::string_t& name)
+{
+#if defined(_WIN32)
+    return to_lower(name.c_str());
+#else
+    return name;
+#endif
+}
+
+bool dir_listing_cache_t::file_exists(const pal::string_t& path)
+{
+    pal::string_t dir = get_directory(path);
+    auto iter = m_listings.find(dir);
+    if (iter == m_listings.end())
+    {
+        // A directory that doesn't exist gets an empty listing.
+        std::vector<pal::string_t> files;
+        pal::readdir(dir, &files);
+        m_listing_count++;
+
+        std::unordered_set<pal::string_t> names;
+        for (const pal::string_t& file : files)
+            names.insert(get_listing_name(file));
+
+        trace::verbose(_X("    Listed %zu entries in directory %s"), names.size(), dir.c_str());
+        iter = m_listings.emplace(std::move(dir), std::move(names)).first;
+    }
+
+    return iter->second.count(get_listing_name(get_filename(path))) != 0;
+}
+
 // -----------------------------------------------------------------------------
 // Given a "base" directory, determine the resolved path for this file.
 //
@@ -33,12 +64,13 @@ static pal::string_t normalize_dir_separator(const pal::string_t& path)
 //    str  - (out parameter) If the method returns true, contains the file path for this deps entry
 //    search_options - Flags to instruct where to look for this deps entry
 //    found_in_bundle - (out parameter) True if the candidate is located within the single-file bundle.
+//    dir_cache - If not null, answers the file existence check for files directly in a base directory.
 //
 // Returns:
 //    If the file exists in the path relative to the "base" directory within the
 //    single-file or on disk.
 
-bool deps_entry_t::to_path(const pal::string_t& base, const pal::string_t& ietf_dir, pal::string_t* str, uint32_t search_options, bool &found_in_bundle) const
+bool deps_entry_t::to_path(const pal::string_t& base, const pal::string_t& ietf_dir, pal::string_t* str, uint32_t search_options, bool &found_in_bundle, dir_listing_cache_t* dir_cache) const
 {
     pal::string_t& candidate = *str;
 
@@ -98,7 +130,10 @@ bool deps_entry_t::to_path(const pal::string_t& base, const pal::string_t& ietf_
     const pal::char_t* query_type = look_in_base ? _X("Local") : _X("Relative");
     if (search_options & deps_entry_t::search_options::file_existence)
     {
-        if (!pal::file_exists(candidate))
+        bool exists = look_in_base && dir_cache != nullptr
+            ? dir_cache->file_exists(candidate)
+            : pal::file_exists(candidate);
+        if (!exists)
         {
             trace::verbose(_X("    %s path query did not exist %s"), query_type, candidate.c_str());
             candidate.clear();
@@ -140,11 +175,12 @@ bool deps_entry_t::to_path(const pal::string_t& base, const pal::string_t& ietf_
 //    str  - If the method returns true, contains the file path for this deps entry
 //    search_options - Flags to instruct where to look for this deps entry
 //    look_in_bundle - Whether to look within the single-file bundle
+//    dir_cache - If not null, used to check for file existence
 //
 // Returns:
 //    If the file exists in the path relative to the "base" directory.
 //
-bool deps_entry_t::to_dir_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, bool& found_in_bundle) const
+bool deps_entry_t::to_dir_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, bool& found_in_bundle, dir_listing_cache_t* dir_cache) const
 {
     pal::string_t ietf_dir;
 
@@ -169,7 +205,7 @@ bool deps_entry_t::to_dir_path(const pal::string_t& base, pal::string_t* str, ui
 
     search_options |= deps_entry_t::search_options::look_in_base;
     search_options &= ~deps_entry_t::search_options::is_servicing;
-    return to_path(base, ietf_dir, str, search_options, found_in_bundle);
+    return to_path(base, ietf_dir, str, search_options, found_in_bundle, dir_cache);
 }
 
 // -----------------------------------------------------------------------------
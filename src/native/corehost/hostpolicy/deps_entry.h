@@ -7,6 +7,8 @@
 #include <iostream>
 #include <array>
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
 #include "pal.h"
 #include "version.h"
 
@@ -26,6 +28,27 @@ struct deps_asset_t
     version_t file_version;
 };
 
+// Answers file existence queries from a listing of the containing directory, so that probing
+// a directory with many assets (the app or a framework directory) takes one enumeration of the
+// directory rather than a query per file. On network file systems every query is a round-trip.
+class dir_listing_cache_t
+{
+public:
+    dir_listing_cache_t()
+        : m_listing_count(0)
+    { }
+
+    bool file_exists(const pal::string_t& path);
+
+    size_t listing_count() const { return m_listing_count; }
+
+private:
+    // Directory (with trailing separator) -> names of its files and subdirectories.
+    // Names are lower case on Windows, where the file system is case insensitive.
+    std::unordered_map<pal::string_t, std::unordered_set<pal::string_t>> m_listings;
+    size_t m_listing_count;
+};
+
 struct deps_entry_t
 {
     enum asset_types
@@ -61,7 +84,8 @@ struct deps_entry_t
     bool is_rid_specific;
 
     // Given a "base" dir, yield the file path within this directory or single-file bundle.
-    bool to_dir_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, bool& found_in_bundle) const;
+    // If dir_cache is specified, it is used for the file existence check.
+    bool to_dir_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, bool& found_in_bundle, dir_listing_cache_t* dir_cache = nullptr) const;
 
     // Given a "base" dir, yield the relative path in the package layout or servicing directory.
     bool to_rel_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options) const;
@@ -73,7 +97,7 @@ private:
     // Given a "base" dir, yield the filepath within this directory or relative to this directory based on "look_in_base"
     // flag in "search_options".
     // Returns a path within the single-file bundle, or a file on disk,
-    bool to_path(const pal::string_t& base, const pal::string_t& ietf_code, pal::string_t* str, uint32_t search_options, bool & found_in_bundle) const;
+    bool to_path(const pal::string_t& base, const pal::string_t& ietf_code, pal::string_t* str, uint32_t search_options, bool & found_in_bundle, dir_listing_cache_t* dir_cache = nullptr) const;
 
 };
 
@@ -19,70 +19,346 @@ const std::array<const pal::char_t*, deps_entry_t::asset_types::count> deps_entr
 
 namespace
 {
-    pal::string_t get_optional_property(
-        const json_parser_t::value_t& properties,
-        const pal::string_t& key)
+    void trace_rid_fallback_graph(const deps_json_t::rid_fallback_graph_t& rid_fallback_graph)
     {
-        const auto& prop = properties.FindMember(key.c_str());
-        return (prop != properties.MemberEnd() && prop->value.IsString()) ? prop->value.GetString() : _X("");
+        if (trace::is_enabled())
+        {
+            trace::verbose(_X("RID fallback graph = {"));
+            for (const auto& rid : rid_fallback_graph)
+            {
+                trace::verbose(_X("%s => ["), rid.first.c_str());
+                for (const auto& fallback : rid.second)
+                {
+                    trace::verbose(_X("%s, "), fallback.c_str());
+                }
+                trace::verbose(_X("]"));
+            }
+            trace::verbose(_X("}"));
+        }
     }
 
-    pal::string_t get_optional_path(
-        const json_parser_t::value_t& properties,
-        const pal::string_t& key)
+    bool deps_file_exists(pal::string_t& deps_path)
     {
-        pal::string_t path = get_optional_property(properties, key);
+        if (bundle::info_t::config_t::probe(deps_path) || pal::fullpath(&deps_path, /*skip_error_logging*/ true))
+            return true;
 
-        if (path.length() > 0 && _X('/') != DIR_SEPARATOR)
+        trace::verbose(_X("Dependencies manifest does not exist at [%s]"), deps_path.c_str());
+        return false;
+    }
+
+    void normalize_path(pal::string_t* path)
+    {
+        if (path->length() > 0 && _X('/') != DIR_SEPARATOR)
         {
-            replace_char(&path, _X('/'), DIR_SEPARATOR);
+            replace_char(path, _X('/'), DIR_SEPARATOR);
         }
+    }
+}
 
-        return path;
+// -----------------------------------------------------------------------------
+// SAX handler for deps files. The assets of the runtime target, the libraries and
+// (optionally) the RID fallback graph are filled in directly while parsing rather than
+// building a DOM and walking it afterwards. Members that are not needed are skipped
+// without being materialized.
+//
+class deps_json_t::reader_t : public rapidjson::BaseReaderHandler<json_parser_t::internal_encoding_type_t, deps_json_t::reader_t>
+{
+public:
+    reader_t(bool read_assets, bool read_runtime_targets, rid_fallback_graph_t* rid_fallback_graph)
+        : m_read_assets(read_assets)
+        , m_read_runtime_targets(read_runtime_targets)
+        , m_rid_fallback_graph(rid_fallback_graph)
+        , m_target(nullptr)
+        , m_asset_type_index(0)
+        , m_asset_files(nullptr)
+        , m_rid_fallbacks(nullptr)
+    { }
+
+    std::vector<library_t>& get_libraries() { return m_libraries; }
+
+    // Moves the assets of the runtime target into the given containers.
+    void take_target_assets(deps_assets_t* assets, rid_specific_assets_t* rid_assets)
+    {
+        auto iter = m_targets.find(m_target_name);
+        if (iter == m_targets.end())
+            return;
+
+        *assets = std::move(iter->second.assets);
+        *rid_assets = std::move(iter->second.rid_assets);
+    }
+
+    bool StartObject() { return start_container(/*is_array*/ false); }
+    bool EndObject(rapidjson::SizeType) { return end_container(); }
+    bool StartArray() { return start_container(/*is_array*/ true); }
+    bool EndArray(rapidjson::SizeType) { return end_container(); }
+
+    bool Key(const pal::char_t* str, rapidjson::SizeType length, bool)
+    {
+        m_key.assign(str, length);
+        return true;
     }
 
-    void populate_rid_fallback_graph(const json_parser_t::value_t& json, deps_json_t::rid_fallback_graph_t& rid_fallback_graph)
+    bool String(const pal::char_t* str, rapidjson::SizeType length, bool)
     {
-        const auto& json_object = json.GetObject();
-        if (json_object.HasMember(_X("runtimes")))
+        if (m_states.empty())
+            return true;
+
+        switch (m_states.back())
+        {
+        case state_t::root:
+            // "runtimeTarget" can be either the name or an object with the name
+            if (key_is(_X("runtimeTarget")))
+                m_target_name.assign(str, length);
+            break;
+        case state_t::runtime_target:
+            if (key_is(_X("name")))
+                m_target_name.assign(str, length);
+            break;
+        case state_t::package_asset:
+        case state_t::package_runtime_target:
+            if (key_is(_X("assemblyVersion")))
+                m_assembly_version.assign(str, length);
+            else if (key_is(_X("fileVersion")))
+                m_file_version.assign(str, length);
+            else if (key_is(_X("rid")))
+                m_rid.assign(str, length);
+            else if (key_is(_X("assetType")))
+                m_asset_type.assign(str, length);
+            break;
+        case state_t::library:
         {
-            for (const auto& rid : json[_X("runtimes")].GetObject())
+            library_t& library = m_libraries.back();
+            if (key_is(_X("type")))
+                library.type.assign(str, length);
+            else if (key_is(_X("sha512")))
+                library.hash.assign(str, length);
+            else if (key_is(_X("path")))
+                library.path.assign(str, length);
+            else if (key_is(_X("hashPath")))
+                library.hash_path.assign(str, length);
+            else if (key_is(_X("runtimeStoreManifestName")))
+                library.runtime_store_manifest_list.assign(str, length);
+            break;
+        }
+        case state_t::rid_fallbacks:
+            m_rid_fallbacks->emplace_back(str, length);
+            break;
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        if (!m_states.empty() && m_states.back() == state_t::library && key_is(_X("serviceable")))
+            m_libraries.back().serviceable = b;
+
+        return true;
+    }
+
+private:
+    enum class state_t
+    {
+        root,
+        runtime_target,
+        targets,
+        target,
+        package,
+        package_assets,
+        package_asset,
+        package_runtime_targets,
+        package_runtime_target,
+        libraries,
+        library,
+        runtimes,
+        rid_fallbacks,
+        skip,
+    };
+
+    struct target_t
+    {
+        deps_assets_t assets;
+        rid_specific_assets_t rid_assets;
+    };
+
+    bool key_is(const pal::char_t* name) const
+    {
+        return pal::strcmp(m_key.c_str(), name) == 0;
+    }
+
+    bool start_container(bool is_array)
+    {
+        state_t state = get_child_state(is_array);
+        switch (state)
+        {
+        case state_t::target:
+            m_target = &m_targets[m_key];
+            break;
+        case state_t::package:
+            trace::info(_X("Processing package %s"), m_key.c_str());
+            m_package = m_key;
+            break;
+        case state_t::package_assets:
+            trace::info(_X("  Adding %s assets"), deps_entry_t::s_known_asset_types[m_asset_type_index]);
+            m_asset_files = &m_target->assets.libs[m_package][m_asset_type_index];
+            break;
+        case state_t::package_asset:
+        case state_t::package_runtime_target:
+            m_file_name = m_key;
+            m_rid.clear();
+            m_asset_type.clear();
+            m_assembly_version.clear();
+            m_file_version.clear();
+            break;
+        case state_t::library:
+            m_libraries.emplace_back();
+            m_libraries.back().name = m_key;
+            m_libraries.back().serviceable = false;
+            break;
+        case state_t::rid_fallbacks:
+            m_rid_fallbacks = &(*m_rid_fallback_graph)[m_key];
+            break;
+        default:
+            break;
+        }
+
+        m_states.push_back(state);
+        return true;
+    }
+
+    bool end_container()
+    {
+        assert(!m_states.empty());
+        state_t state = m_states.back();
+        m_states.pop_back();
+
+        if (state == state_t::package_asset)
+        {
+            deps_asset_t asset = make_asset();
+            if (trace::is_info_enabled())
             {
-                auto& vec = rid_fallback_graph[rid.name.GetString()];
-                const auto& fallback_array = rid.value.GetArray();
-                vec.reserve(fallback_array.Size());
-                for (const auto& fallback : fallback_array)
+                trace::info(_X("    %s assemblyVersion=%s fileVersion=%s"),
+                    asset.relative_path.c_str(),
+                    asset.assembly_version.as_str().c_str(),
+                    asset.file_version.as_str().c_str());
+            }
+
+            m_asset_files->push_back(std::move(asset));
+        }
+        else if (state == state_t::package_runtime_target)
+        {
+            for (size_t asset_type_index = 0; asset_type_index < deps_entry_t::s_known_asset_types.size(); ++asset_type_index)
+            {
+                if (pal::strcasecmp(m_asset_type.c_str(), deps_entry_t::s_known_asset_types[asset_type_index]) != 0)
+                    continue;
+
+                deps_asset_t asset = make_asset();
+                if (trace::is_info_enabled())
                 {
-                    vec.push_back(fallback.GetString());
+                    trace::info(_X("  %s asset: %s rid=%s assemblyVersion=%s fileVersion=%s"),
+                        deps_entry_t::s_known_asset_types[asset_type_index],
+                        asset.relative_path.c_str(),
+                        m_rid.c_str(),
+                        asset.assembly_version.as_str().c_str(),
+                        asset.file_version.as_str().c_str());
                 }
+
+                m_target->rid_assets.libs[m_package][asset_type_index].rid_assets[m_rid].push_back(std::move(asset));
             }
         }
 
-        if (trace::is_enabled())
+        return true;
+    }
+
+    state_t get_child_state(bool is_array) const
+    {
+        if (m_states.empty())
+            return is_array ? state_t::skip : state_t::root;
+
+        state_t parent = m_states.back();
+        if (is_array)
+            return (parent == state_t::runtimes) ? state_t::rid_fallbacks : state_t::skip;
+
+        switch (parent)
         {
-            trace::verbose(_X("RID fallback graph = {"));
-            for (const auto& rid : rid_fallback_graph)
+        case state_t::root:
+            if (key_is(_X("runtimeTarget")))
+                return state_t::runtime_target;
+            if (key_is(_X("targets")))
+                return m_read_assets ? state_t::targets : state_t::skip;
+            if (key_is(_X("libraries")))
+                return m_read_assets ? state_t::libraries : state_t::skip;
+            if (key_is(_X("runtimes")))
+                return m_rid_fallback_graph != nullptr ? state_t::runtimes : state_t::skip;
+            return state_t::skip;
+        case state_t::targets:
+            // "runtimeTarget" is normally written first, which lets other targets be skipped.
+            // Otherwise all the targets are read until the name is known.
+            return (m_target_name.empty() || m_target_name == m_key) ? state_t::target : state_t::skip;
+        case state_t::target:
+            return state_t::package;
+        case state_t::package:
+            if (key_is(_X("runtimeTargets")))
+                return m_read_runtime_targets ? state_t::package_runtime_targets : state_t::skip;
+            for (size_t i = 0; i < deps_entry_t::s_known_asset_types.size(); ++i)
             {
-                trace::verbose(_X("%s => ["), rid.first.c_str());
-                for (const auto& fallback : rid.second)
+                if (key_is(deps_entry_t::s_known_asset_types[i]))
                 {
-                    trace::verbose(_X("%s, "), fallback.c_str());
+                    // Only read by start_container for this state, so the const_cast is benign.
+                    const_cast<reader_t*>(this)->m_asset_type_index = i;
+                    return state_t::package_assets;
                 }
-                trace::verbose(_X("]"));
             }
-            trace::verbose(_X("}"));
+            return state_t::skip;
+        case state_t::package_assets:
+            return state_t::package_asset;
+        case state_t::package_runtime_targets:
+            return state_t::package_runtime_target;
+        case state_t::libraries:
+            return state_t::library;
+        default:
+            return state_t::skip;
         }
     }
 
-    bool deps_file_exists(pal::string_t& deps_path)
+    deps_asset_t make_asset() const
     {
-        if (bundle::info_t::config_t::probe(deps_path) || pal::fullpath(&deps_path, /*skip_error_logging*/ true))
-            return true;
+        version_t assembly_version, file_version;
+        if (!m_assembly_version.empty())
+            version_t::parse(m_assembly_version, &assembly_version);
 
-        trace::verbose(_X("Dependencies manifest does not exist at [%s]"), deps_path.c_str());
-        return false;
+        if (!m_file_version.empty())
+            version_t::parse(m_file_version, &file_version);
+
+        return deps_asset_t(get_filename_without_ext(m_file_name), m_file_name, assembly_version, file_version);
     }
-}
+
+    const bool m_read_assets;
+    const bool m_read_runtime_targets;
+    rid_fallback_graph_t* m_rid_fallback_graph;
+
+    pal::string_t m_target_name;
+    std::unordered_map<pal::string_t, target_t> m_targets;
+    std::vector<library_t> m_libraries;
+
+    std::vector<state_t> m_states;
+    pal::string_t m_key;
+
+    // Current target, package and asset
+    target_t* m_target;
+    pal::string_t m_package;
+    size_t m_asset_type_index;
+    vec_asset_t* m_asset_files;
+    pal::string_t m_file_name;
+    pal::string_t m_rid;
+    pal::string_t m_asset_type;
+    pal::string_t m_assembly_version;
+    pal::string_t m_file_version;
+
+    std::vector<pal::string_t>* m_rid_fallbacks;
+};
 
 deps_json_t::rid_fallback_graph_t deps_json_t::get_rid_fallback_graph(const pal::string_t& deps_path)
 {
@@ -94,38 +370,45 @@ deps_json_t::rid_fallback_graph_t deps_json_t::get_rid_fallback_graph(const pal:
         return rid_fallback_graph;
 
     json_parser_t json;
-    if (!json.parse_file(deps_path_local))
+    reader_t reader(/*read_assets*/ false, /*read_runtime_targets*/ false, &rid_fallback_graph);
+    if (!json.parse_file(deps_path_local, reader))
+    {
+        rid_fallback_graph.clear();
         return rid_fallback_graph;
+    }
 
-    populate_rid_fallback_graph(json.document(), rid_fallback_graph);
+    trace_rid_fallback_graph(rid_fallback_graph);
     return rid_fallback_graph;
 }
 
 void deps_json_t::reconcile_libraries_with_targets(
-    const json_parser_t::value_t& json,
+    const std::vector<library_t>& libraries,
     const std::function<bool(const pal::string_t&)>& library_has_assets_fn,
     const std::function<const vec_asset_t&(const pal::string_t&, size_t, bool*)>& get_assets_fn)
 {
     pal::string_t deps_file = get_filename(m_deps_file);
 
-    for (const auto& library : json[_X("libraries")].GetObject())
+    for (const library_t& library : libraries)
     {
-        trace::info(_X("Reconciling library %s"), library.name.GetString());
+        trace::info(_X("Reconciling library %s"), library.name.c_str());
 
-        pal::string_t lib_name{library.name.GetString()};
+        const pal::string_t& lib_name = library.name;
         if (!library_has_assets_fn(lib_name))
         {
-            trace::info(_X("  No assets for library %s"), library.name.GetString());
+            trace::info(_X("  No assets for library %s"), library.name.c_str());
             continue;
         }
 
-        const pal::string_t& hash = library.value[_X("sha512")].GetString();
-        bool serviceable = library.value[_X("serviceable")].GetBool();
+        const pal::string_t& hash = library.hash;
+        bool serviceable = library.serviceable;
 
-        pal::string_t library_path = get_optional_path(library.value, _X("path"));
-        pal::string_t library_hash_path = get_optional_path(library.value, _X("hashPath"));
-        pal::string_t runtime_store_manifest_list = get_optional_path(library.value, _X("runtimeStoreManifestName"));
-        pal::string_t library_type = to_lower(library.value[_X("type")].GetString());
+        pal::string_t library_path = library.path;
+        normalize_path(&library_path);
+        pal::string_t library_hash_path = library.hash_path;
+        normalize_path(&library_hash_path);
+        pal::string_t runtime_store_manifest_list = library.runtime_store_manifest_list;
+        normalize_path(&runtime_store_manifest_list);
+        pal::string_t library_type = to_lower(library.type.c_str());
 
         size_t pos = lib_name.find(_X("/"));
         pal::string_t library_name = lib_name.substr(0, pos);
@@ -164,7 +447,7 @@ void deps_json_t::reconcile_libraries_with_targets(
                 entry.asset = asset;
                 entry.asset.name = asset_name;
 
-                if (trace::is_enabled())
+                if (trace::is_info_enabled())
                 {
                     trace::info(_X("    Entry %zu for asset name: %s, relpath: %s, assemblyVersion %s, fileVersion %s"),
                         m_deps_entries[i].size(),
@@ -379,124 +662,9 @@ void deps_json_t::perform_rid_fallback(rid_specific_assets_t* portable_assets)
     }
 }
 
-void deps_json_t::process_runtime_targets(const json_parser_t::value_t& json, const pal::string_t& target_name, rid_specific_assets_t* p_assets)
+void deps_json_t::load_framework_dependent(const std::vector<library_t>& libraries)
 {
-    rid_specific_assets_t& assets = *p_assets;
-    for (const auto& package : json[_X("targets")][target_name.c_str()].GetObject())
-    {
-        const auto& runtimeTargets = package.value.FindMember(_X("runtimeTargets"));
-        if (runtimeTargets == package.value.MemberEnd())
-        {
-            continue;
-        }
-
-        trace::info(_X("Processing runtimeTargets for package %s"), package.name.GetString());
-
-        for (const auto& file : runtimeTargets->value.GetObject())
-        {
-            const auto& type = file.value[_X("assetType")].GetString();
-
-            for (size_t asset_type_index = 0; asset_type_index < deps_entry_t::s_known_asset_types.size(); ++asset_type_index)
-            {
-                if (pal::strcasecmp(type, deps_entry_t::s_known_asset_types[asset_type_index]) != 0)
-                {
-                    continue;
-                }
-
-                version_t assembly_version, file_version;
-
-                const pal::string_t& assembly_version_str = get_optional_property(file.value, _X("assemblyVersion"));
-                if (!assembly_version_str.empty())
-                {
-                    version_t::parse(assembly_version_str, &assembly_version);
-                }
-
-                const pal::string_t& file_version_str = get_optional_property(file.value, _X("fileVersion"));
-                if (!file_version_str.empty())
-                {
-                    version_t::parse(file_version_str, &file_version);
-                }
-
-                pal::string_t file_name{file.name.GetString()};
-                deps_asset_t asset(get_filename_without_ext(file_name), file_name, assembly_version, file_version);
-
-                const auto& rid = file.value[_X("rid")].GetString();
-
-                if (trace::is_enabled())
-                {
-                    trace::info(_X("  %s asset: %s rid=%s assemblyVersion=%s fileVersion=%s"),
-                        deps_entry_t::s_known_asset_types[asset_type_index],
-                        asset.relative_path.c_str(),
-                        rid,
-                        asset.assembly_version.as_str().c_str(),
-                        asset.file_version.as_str().c_str());
-                }
-
-                assets.libs[package.name.GetString()][asset_type_index].rid_assets[rid].push_back(asset);
-            }
-        }
-    }
-
-    perform_rid_fallback(&assets);
-}
-
-void deps_json_t::process_targets(const json_parser_t::value_t& json, const pal::string_t& target_name, deps_assets_t* p_assets)
-{
-    deps_assets_t& assets = *p_assets;
-    for (const auto& package : json[_X("targets")][target_name.c_str()].GetObject())
-    {
-        trace::info(_X("Processing package %s"), package.name.GetString());
-
-        const auto& asset_types = package.value.GetObject();
-        for (size_t i = 0; i < deps_entry_t::s_known_asset_types.size(); ++i)
-        {
-            const auto& iter = asset_types.FindMember(deps_entry_t::s_known_asset_types[i]);
-            if (iter == asset_types.MemberEnd())
-            {
-                continue;
-            }
-
-            trace::info(_X("  Adding %s assets"), deps_entry_t::s_known_asset_types[i]);
-            const auto& files = iter->value.GetObject();
-            vec_asset_t& asset_files = assets.libs[package.name.GetString()][i];
-            asset_files.reserve(files.MemberCount());
-            for (const auto& file : files)
-            {
-                version_t assembly_version, file_version;
-
-                const pal::string_t& assembly_version_str = get_optional_property(file.value, _X("assemblyVersion"));
-                if (assembly_version_str.length() > 0)
-                {
-                    version_t::parse(assembly_version_str, &assembly_version);
-                }
-
-                const pal::string_t& file_version_str = get_optional_property(file.value, _X("fileVersion"));
-                if (file_version_str.length() > 0)
-                {
-                    version_t::parse(file_version_str, &file_version);
-                }
-
-                pal::string_t file_name{file.name.GetString()};
-                deps_asset_t asset(get_filename_without_ext(file_name), file_name, assembly_version, file_version);
-
-                if (trace::is_enabled())
-                {
-                    trace::info(_X("    %s assemblyVersion=%s fileVersion=%s"),
-                        asset.relative_path.c_str(),
-                        asset.assembly_version.as_str().c_str(),
-                        asset.file_version.as_str().c_str());
-                }
-
-                asset_files.push_back(std::move(asset));
-            }
-        }
-    }
-}
-
-void deps_json_t::load_framework_dependent(const json_parser_t::value_t& json, const pal::string_t& target_name)
-{
-    process_runtime_targets(json, target_name, &m_rid_assets);
-    process_targets(json, target_name, &m_assets);
+    perform_rid_fallback(&m_rid_assets);
 
     auto package_exists = [&](const pal::string_t& package) -> bool {
         return m_rid_assets.libs.count(package) || m_assets.libs.count(package);
@@ -528,12 +696,11 @@ void deps_json_t::load_framework_dependent(const json_parser_t::value_t& json, c
         return empty;
     };
 
-    reconcile_libraries_with_targets(json, package_exists, get_relpaths);
+    reconcile_libraries_with_targets(libraries, package_exists, get_relpaths);
 }
 
-void deps_json_t::load_self_contained(const json_parser_t::value_t& json, const pal::string_t& target_name)
+void deps_json_t::load_self_contained(const std::vector<library_t>& libraries)
 {
-    process_targets(json, target_name, &m_assets);
 
     auto package_exists = [&](const pal::string_t& package) -> bool {
         return m_assets.libs.count(package);
@@ -544,7 +711,7 @@ void deps_json_t::load_self_contained(const json_parser_t::value_t& json, const
         return m_assets.libs[package][type_index];
     };
 
-    reconcile_libraries_with_targets(json, package_exists, get_relpaths);
+    reconcile_libraries_with_targets(libraries, package_exists, get_relpaths);
 }
 
 bool deps_json_t::has_package(const pal::string_t& name, const pal::string_t& ver) const
@@ -574,7 +741,7 @@ bool deps_json_t::has_package(const pal::string_t& name, const pal::string_t& ve
 // Load the deps file and parse its "entry" lines which contain the "fields" of
 // the entry. Populate an array of these entries.
 //
-void deps_json_t::load(bool is_framework_dependent, std::function<void(const json_parser_t::value_t&)> post_process)
+void deps_json_t::load(bool is_framework_dependent, rid_fallback_graph_t* rid_fallback_graph)
 {
     m_file_exists = deps_file_exists(m_deps_file);
 
@@ -586,28 +753,26 @@ void deps_json_t::load(bool is_framework_dependent, std::function<void(const jso
     }
 
     json_parser_t json;
-    if (!json.parse_file(m_deps_file))
+    reader_t reader(/*read_assets*/ true, /*read_runtime_targets*/ is_framework_dependent, rid_fallback_graph);
+    if (!json.parse_file(m_deps_file, reader))
         return;
 
     m_valid = true;
-    const auto& runtime_target = json.document()[_X("runtimeTarget")];
-    const pal::string_t& name = runtime_target.IsString() ?
-        runtime_target.GetString() :
-        runtime_target[_X("name")].GetString();
+    reader.take_target_assets(&m_assets, &m_rid_assets);
 
     trace::verbose(_X("Loading deps file... [%s]: is_framework_dependent=%d, use_fallback_graph=%d"), m_deps_file.c_str(), is_framework_dependent, m_rid_resolution_options.use_fallback_graph);
 
     if (is_framework_dependent)
     {
-        load_framework_dependent(json.document(), name);
+        load_framework_dependent(reader.get_libraries());
     }
     else
     {
-        load_self_contained(json.document(), name);
+        load_self_contained(reader.get_libraries());
     }
 
-    if (post_process)
-        post_process(json.document());
+    if (rid_fallback_graph != nullptr)
+        trace_rid_fallback_graph(*rid_fallback_graph);
 }
 
 std::unique_ptr<deps_json_t> deps_json_t::create_for_self_contained(const pal::string_t& deps_path, rid_resolution_options_t& rid_resolution_options)
@@ -616,11 +781,7 @@ std::unique_ptr<deps_json_t> deps_json_t::create_for_self_contained(const pal::s
     if (rid_resolution_options.use_fallback_graph)
     {
         assert(rid_resolution_options.rid_fallback_graph != nullptr && rid_resolution_options.rid_fallback_graph->empty());
-        deps->load(false,
-            [&](const json_parser_t::value_t& json)
-            {
-                populate_rid_fallback_graph(json, *rid_resolution_options.rid_fallback_graph);
-            });
+        deps->load(false, rid_resolution_options.rid_fallback_graph);
     }
     else
     {
@@ -23,6 +23,20 @@ class deps_json_t
 
     typedef std::unordered_map<pal::string_t, std::vector<pal::string_t>> str_to_vector_map_t;
 
+    // Library properties from the "libraries" section.
+    struct library_t
+    {
+        pal::string_t name; // name/version
+        pal::string_t type;
+        pal::string_t hash;
+        pal::string_t path;
+        pal::string_t hash_path;
+        pal::string_t runtime_store_manifest_list;
+        bool serviceable;
+    };
+
+    class reader_t;
+
 public:
     typedef str_to_vector_map_t rid_fallback_graph_t;
 
@@ -81,14 +95,13 @@ private:
         , m_rid_resolution_options(rid_resolution_options)
     { }
 
-    void load(bool is_framework_dependent, std::function<void(const json_parser_t::value_t&)> post_process = {});
-    void load_self_contained(const json_parser_t::value_t& json, const pal::string_t& target_name);
-    void load_framework_dependent(const json_parser_t::value_t& json, const pal::string_t& target_name);
-    void process_runtime_targets(const json_parser_t::value_t& json, const pal::string_t& target_name, rid_specific_assets_t* p_assets);
-    void process_targets(const json_parser_t::value_t& json, const pal::string_t& target_name, deps_assets_t* p_assets);
+    // If rid_fallback_graph is not null, it is populated from the "runtimes" section.
+    void load(bool is_framework_dependent, rid_fallback_graph_t* rid_fallback_graph = nullptr);
+    void load_self_contained(const std::vector<library_t>& libraries);
+    void load_framework_dependent(const std::vector<library_t>& libraries);
 
     void reconcile_libraries_with_targets(
-        const json_parser_t::value_t& json,
+        const std::vector<library_t>& libraries,
         const std::function<bool(const pal::string_t&)>& library_exists_fn,
         const std::function<const vec_asset_t&(const pal::string_t&, size_t, bool*)>& get_assets_fn);
 
@@ -4,6 +4,7 @@
 #include <set>
 #include <functional>
 #include <cassert>
+#include <chrono>
 
 #include <trace.h>
 #include "deps_entry.h"
@@ -97,7 +98,7 @@ namespace
         name_to_resolved_asset_map_t::iterator existing = items->find(asset.name);
         if (existing == items->end())
         {
-            if (trace::is_enabled())
+            if (trace::is_verbose_enabled())
             {
                 trace::verbose(_X("Adding tpa entry: %s, AssemblyVersion: %s, FileVersion: %s"),
                     resolved_path.c_str(),
@@ -254,7 +255,7 @@ void deps_resolver_t::setup_probe_config(
         m_needs_file_existence_checks = true;
     }
 
-    if (trace::is_enabled())
+    if (trace::is_verbose_enabled())
     {
         trace::verbose(_X("-- Probe configurations:"));
         for (const auto& pc : m_probes)
@@ -277,10 +278,11 @@ bool deps_resolver_t::probe_deps_entry(const deps_entry_t& entry, const pal::str
 {
     candidate->clear();
     found_in_bundle = false;
+    m_probe_count++;
 
     for (const auto& config : m_probes)
     {
-        if (trace::is_enabled())
+        if (trace::is_verbose_enabled())
             trace::verbose(_X("  Using probe config: %s"), config.as_str().c_str());
 
         if (config.is_servicing() && !entry.is_serviceable)
@@ -317,7 +319,7 @@ bool deps_resolver_t::probe_deps_entry(const deps_entry_t& entry, const pal::str
             // If the deps json has the package name and version, then someone has already done rid selection and
             // put the right asset in the dir. So checking just package name and version would suffice.
             // No need to check further for the exact asset relative sub path.
-            if (config.probe_deps_json->has_package(entry.library_name, entry.library_version) && entry.to_dir_path(config.probe_dir, candidate, search_options, found_in_bundle))
+            if (config.probe_deps_json->has_package(entry.library_name, entry.library_version) && entry.to_dir_path(config.probe_dir, candidate, search_options, found_in_bundle, &m_dir_cache))
             {
                 assert(!found_in_bundle);
                 trace::verbose(_X("    Probed deps json and matched '%s'"), candidate->c_str());
@@ -341,7 +343,7 @@ bool deps_resolver_t::probe_deps_entry(const deps_entry_t& entry, const pal::str
             else
             {
                 // Non-rid assets, lookup in the published dir.
-                if (entry.to_dir_path(deps_dir, candidate, search_options | deps_entry_t::search_options::look_in_bundle, found_in_bundle))
+                if (entry.to_dir_path(deps_dir, candidate, search_options | deps_entry_t::search_options::look_in_bundle, found_in_bundle, &m_dir_cache))
                 {
                     trace::verbose(_X("    Probed deps dir and matched '%s'"), candidate->c_str());
                     return true;
@@ -482,9 +484,12 @@ bool deps_resolver_t::resolve_tpa_list(
                     // If the path is the same, then no need to replace
                     if (resolved_path != existing_entry->resolved_path)
                     {
-                        trace::verbose(_X("Replacing deps entry [%s, AssemblyVersion:%s, FileVersion:%s] with [%s, AssemblyVersion:%s, FileVersion:%s]"),
-                            existing_entry->resolved_path.c_str(), existing_entry->asset.assembly_version.as_str().c_str(), existing_entry->asset.file_version.as_str().c_str(),
-                            resolved_path.c_str(), entry.asset.assembly_version.as_str().c_str(), entry.asset.file_version.as_str().c_str());
+                        if (trace::is_verbose_enabled())
+                        {
+                            trace::verbose(_X("Replacing deps entry [%s, AssemblyVersion:%s, FileVersion:%s] with [%s, AssemblyVersion:%s, FileVersion:%s]"),
+                                existing_entry->resolved_path.c_str(), existing_entry->asset.assembly_version.as_str().c_str(), existing_entry->asset.file_version.as_str().c_str(),
+                                resolved_path.c_str(), entry.asset.assembly_version.as_str().c_str(), entry.asset.file_version.as_str().c_str());
+                        }
 
                         existing_entry = nullptr;
                         items.erase(existing);
@@ -886,6 +891,7 @@ bool deps_resolver_t::resolve_probe_dirs(
 //
 bool deps_resolver_t::resolve_probe_paths(probe_paths_t* probe_paths, std::unordered_set<pal::string_t>* breadcrumb, bool ignore_missing_assemblies)
 {
+    auto start = std::chrono::steady_clock::now();
     if (!resolve_tpa_list(&probe_paths->tpa, breadcrumb, ignore_missing_assemblies))
     {
         return false;
@@ -904,5 +910,15 @@ bool deps_resolver_t::resolve_probe_paths(probe_paths_t* probe_paths, std::unord
     // If we found coreclr and the jit during native path probe, set the paths now.
     probe_paths->coreclr = m_coreclr_path;
 
+    if (trace::is_enabled())
+    {
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        trace::info(_X("Probed %zu deps entries in %.3f ms (file existence checks: %s, directory listings: %zu)"),
+            m_probe_count,
+            elapsed.count() / 1000.0,
+            m_needs_file_existence_checks ? _X("yes") : _X("no"),
+            m_dir_cache.listing_count());
+    }
+
     return true;
 }
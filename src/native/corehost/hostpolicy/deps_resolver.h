@@ -53,6 +53,7 @@ public:
         , m_managed_app(args.managed_application)
         , m_is_framework_dependent(is_framework_dependent)
         , m_needs_file_existence_checks(false)
+        , m_probe_count(0)
     {
         m_fx_deps.resize(m_fx_definitions.size());
         pal::get_default_servicing_directory(&m_core_servicing);
@@ -256,6 +257,12 @@ private:
 
     // File existence checks must be performed for probed paths.This will cause symlinks to be resolved.
     bool m_needs_file_existence_checks;
+
+    // Listings of the app and framework directories used for the file existence checks.
+    dir_listing_cache_t m_dir_cache;
+
+    // Number of deps entries probed, for the summary trace.
+    size_t m_probe_count;
 };
 
 #endif // DEPS_RESOLVER_H
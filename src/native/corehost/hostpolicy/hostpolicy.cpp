@@ -62,6 +62,10 @@ namespace
                 return StatusCode::HostInvalidState;
             }
 
+            // Hand the host's part of the startup timeline to the runtime
+            trace::checkpoint(_X("hostpolicy_create_coreclr"));
+            g_context->coreclr_properties.add(_STRINGIFY(HOST_PROPERTY_STARTUP_CHECKPOINTS), trace::get_checkpoints().c_str());
+
             // Verbose logging
             if (trace::is_enabled())
                 g_context->coreclr_properties.log_properties();
@@ -72,6 +76,7 @@ namespace
 
             // Create a CoreCLR instance
             trace::verbose(_X("CoreCLR path = '%s', CoreCLR dir = '%s'"), g_context->clr_path.c_str(), g_context->clr_dir.c_str());
+            trace::phase_timer_t timer{ _X("create_coreclr") };
             auto hr = coreclr_t::create(
                 g_context->clr_dir,
                 host_path.data(),
@@ -128,7 +133,14 @@ namespace
             *out_args = args;
 
         std::unique_ptr<hostpolicy_context_t> context_local(new hostpolicy_context_t());
-        int rc = context_local->initialize(hostpolicy_init, args, breadcrumbs_enabled);
+        int rc;
+        {
+            trace::phase_timer_t timer{ _X("resolve_dependencies") };
+            rc = context_local->initialize(hostpolicy_init, args, breadcrumbs_enabled);
+        }
+
+        trace::checkpoint(_X("hostpolicy_dependencies_resolved"));
+
         if (rc != StatusCode::Success)
         {
             {
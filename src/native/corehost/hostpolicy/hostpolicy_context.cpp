@@ -11,6 +11,7 @@
 #include "bundle/runner.h"
 #include "bundle/file_entry.h"
 #include "shared_store.h"
+#include "startup_cache.h"
 
 namespace
 {
@@ -52,13 +53,16 @@ namespace
     extern "C" const void* SystemResolveDllImport(const char* name);
     extern "C" const void* CryptoResolveDllImport(const char* name);
     extern "C" const void* CryptoAppleResolveDllImport(const char* name);
+#endif // NATIVE_LIBS_EMBEDDED
 
     // pinvoke_override:
-    // Check if given function belongs to one of statically linked libraries and return a pointer if found.
+    // Check if given function belongs to one of statically linked libraries or to a native library
+    // loaded from the single-file bundle and return a pointer if found.
     const void* STDMETHODCALLTYPE pinvoke_override(const char* library_name, const char* entry_point_name)
     {
         // This function is only called with the library name specified for a p/invoke, not any variations.
         // It must handle exact matches to the names specified. See Interop.Libraries.cs for each platform.
+#if defined(NATIVE_LIBS_EMBEDDED)
 #if !defined(_WIN32)
         if (strcmp(library_name, LIB_NAME("System.Net.Security.Native")) == 0)
         {
@@ -101,10 +105,10 @@ namespace
             return CryptoAppleResolveDllImport(entry_point_name);
         }
 #endif
+#endif // NATIVE_LIBS_EMBEDDED
 
-        return nullptr;
+        return bundle::runner_t::mutable_app()->resolve_native_export(library_name, entry_point_name);
     }
-#endif
 
     size_t HOST_CONTRACT_CALLTYPE get_runtime_property(
         const char* key,
@@ -148,16 +152,16 @@ bool hostpolicy_context_t::should_read_rid_fallback_graph(const hostpolicy_init_
     return false;
 }
 
-int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, const arguments_t &args, bool enable_breadcrumbs)
+int hostpolicy_context_t::resolve_dependencies(
+    const hostpolicy_init_t &hostpolicy_init,
+    const arguments_t &args,
+    const std::vector<pal::string_t> &shared_store_paths,
+    bool read_rid_fallback_graph,
+    startup_cache::entry_t *resolved)
 {
-    application = args.managed_application;
-    host_mode = hostpolicy_init.host_mode;
-    host_path = hostpolicy_init.host_info.host_path;
-    breadcrumbs_enabled = enable_breadcrumbs;
-
     deps_json_t::rid_resolution_options_t rid_resolution_options
     {
-        should_read_rid_fallback_graph(hostpolicy_init),
+        read_rid_fallback_graph,
         nullptr, /*rid_fallback_graph*/
     };
     deps_resolver_t resolver
@@ -165,7 +169,7 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         args,
         hostpolicy_init.fx_definitions,
         hostpolicy_init.additional_deps_serialized.c_str(),
-        shared_store::get_paths(hostpolicy_init.tfm, host_mode, host_path),
+        shared_store_paths,
         hostpolicy_init.probe_paths,
         rid_resolution_options,
         hostpolicy_init.is_framework_dependent
@@ -178,8 +182,6 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         return StatusCode::ResolverInitFailure;
     }
 
-    probe_paths_t probe_paths;
-
     // Setup breadcrumbs.
     if (breadcrumbs_enabled)
     {
@@ -190,19 +192,86 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         breadcrumbs.insert(policy_name);
         breadcrumbs.insert(policy_name + _X(",") + policy_version);
 
-        if (!resolver.resolve_probe_paths(&probe_paths, &breadcrumbs))
+        if (!resolver.resolve_probe_paths(&resolved->probe_paths, &breadcrumbs))
         {
             return StatusCode::ResolverResolveFailure;
         }
+
+        resolved->breadcrumbs.assign(breadcrumbs.begin(), breadcrumbs.end());
     }
     else
     {
-        if (!resolver.resolve_probe_paths(&probe_paths, nullptr))
+        if (!resolver.resolve_probe_paths(&resolved->probe_paths, nullptr))
         {
             return StatusCode::ResolverResolveFailure;
         }
     }
 
+    if (resolver.is_framework_dependent())
+    {
+        // Use the root fx to define FX_DEPS_FILE
+        resolved->fx_deps_file = resolver.get_root_deps().get_deps_file();
+    }
+
+    pal::string_t& app_context_deps_str = resolved->app_context_deps_files;
+    resolver.enum_app_context_deps_files([&](const pal::string_t& deps_file)
+    {
+        if (!app_context_deps_str.empty())
+            app_context_deps_str += _X(';');
+
+        // For the application's .deps.json if this is single file, 3.1 backward compat
+        // then the path used internally is the bundle path, but externally we need to report
+        // the path to the extraction folder.
+        if (app_context_deps_str.empty() && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
+        {
+            pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
+            append_path(&deps_path, get_filename(deps_file).c_str());
+            app_context_deps_str += deps_path;
+        }
+        else
+        {
+            app_context_deps_str += deps_file;
+        }
+    });
+
+    resolver.get_app_dir(&resolved->app_base);
+    resolved->probing_directories = resolver.get_lookup_probe_directories();
+
+    return StatusCode::Success;
+}
+
+int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, const arguments_t &args, bool enable_breadcrumbs)
+{
+    application = args.managed_application;
+    host_mode = hostpolicy_init.host_mode;
+    host_path = hostpolicy_init.host_info.host_path;
+    breadcrumbs_enabled = enable_breadcrumbs;
+
+    bool read_rid_fallback_graph = should_read_rid_fallback_graph(hostpolicy_init);
+    std::vector<pal::string_t> shared_store_paths = shared_store::get_paths(hostpolicy_init.tfm, host_mode, host_path);
+
+    pal::string_t cache_path;
+    pal::string_t cache_key;
+    bool use_startup_cache = startup_cache::get_path_and_key(hostpolicy_init, args, shared_store_paths, read_rid_fallback_graph, breadcrumbs_enabled, &cache_path, &cache_key);
+
+    startup_cache::entry_t resolved;
+    if (use_startup_cache && startup_cache::try_read(cache_path, cache_key, &resolved))
+    {
+        if (breadcrumbs_enabled)
+            breadcrumbs.insert(resolved.breadcrumbs.begin(), resolved.breadcrumbs.end());
+    }
+    else
+    {
+        int rc = resolve_dependencies(hostpolicy_init, args, shared_store_paths, read_rid_fallback_graph, &resolved);
+        if (rc != StatusCode::Success)
+            return rc;
+
+        if (use_startup_cache)
+            startup_cache::write(cache_path, cache_key, resolved);
+    }
+
+    probe_paths_t& probe_paths = resolved.probe_paths;
+
     clr_path = probe_paths.coreclr;
     if (clr_path.empty() || !pal::fullpath(&clr_path))
     {
@@ -242,44 +311,15 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         probe_paths.tpa.append(corelib_path);
     }
 
-    pal::string_t fx_deps_str;
-    if (resolver.is_framework_dependent())
-    {
-        // Use the root fx to define FX_DEPS_FILE
-        fx_deps_str = resolver.get_root_deps().get_deps_file();
-    }
-
-    pal::string_t app_context_deps_str;
-    resolver.enum_app_context_deps_files([&](const pal::string_t& deps_file)
-    {
-        if (!app_context_deps_str.empty())
-            app_context_deps_str += _X(';');
-
-        // For the application's .deps.json if this is single file, 3.1 backward compat
-        // then the path used internally is the bundle path, but externally we need to report
-        // the path to the extraction folder.
-        if (app_context_deps_str.empty() && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
-        {
-            pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
-            append_path(&deps_path, get_filename(deps_file).c_str());
-            app_context_deps_str += deps_path;
-        }
-        else
-        {
-            app_context_deps_str += deps_file;
-        }
-    });
-
     // Build properties for CoreCLR instantiation
-    pal::string_t app_base;
-    resolver.get_app_dir(&app_base);
+    const pal::string_t& app_base = resolved.app_base;
     coreclr_properties.add(common_property::TrustedPlatformAssemblies, probe_paths.tpa.c_str());
     coreclr_properties.add(common_property::NativeDllSearchDirectories, probe_paths.native.c_str());
     coreclr_properties.add(common_property::PlatformResourceRoots, probe_paths.resources.c_str());
     coreclr_properties.add(common_property::AppContextBaseDirectory, app_base.c_str());
-    coreclr_properties.add(common_property::AppContextDepsFiles, app_context_deps_str.c_str());
-    coreclr_properties.add(common_property::FxDepsFile, fx_deps_str.c_str());
-    coreclr_properties.add(common_property::ProbingDirectories, resolver.get_lookup_probe_directories().c_str());
+    coreclr_properties.add(common_property::AppContextDepsFiles, resolved.app_context_deps_files.c_str());
+    coreclr_properties.add(common_property::FxDepsFile, resolved.fx_deps_file.c_str());
+    coreclr_properties.add(common_property::ProbingDirectories, resolved.probing_directories.c_str());
     coreclr_properties.add(common_property::RuntimeIdentifier, get_runtime_id().c_str());
 
     bool set_app_paths = false;
@@ -334,9 +374,7 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         if (bundle::info_t::is_single_file_bundle())
         {
             host_contract.bundle_probe = &bundle_probe;
-#if defined(NATIVE_LIBS_EMBEDDED)
             host_contract.pinvoke_override = &pinvoke_override;
-#endif
         }
 
         host_contract.get_runtime_property = &get_runtime_property;
@@ -135,6 +135,11 @@ bool hostpolicy_init_t::init(const host_interface_t* input, hostpolicy_init_t* i
         }
     }
 
+    if (input->version_lo >= offsetof(host_interface_t, startup_checkpoints) + sizeof(input->startup_checkpoints))
+    {
+        trace::add_checkpoints(input->startup_checkpoints);
+    }
+
     return true;
 }
 
@@ -0,0 +1,257 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "startup_cache.h"
+#include "bundle/info.h"
+#include <trace.h>
+#include <utils.h>
+
+#include <functional>
+
+#define STARTUP_CACHE_ENV _X("DOTNET_HOST_STARTUP_CACHE")
+#define STARTUP_CACHE_FILE_EXTENSION _X(".hostcache")
+
+namespace
+{
+    // Bump when the format of the cache file or the set of cached values changes.
+    const uint32_t cache_format_version = 1;
+
+    void append_key_value(pal::string_t* key, const pal::char_t* name, const pal::string_t& value)
+    {
+        key->append(name);
+        key->push_back(_X('='));
+        key->append(value);
+        key->push_back(_X('\n'));
+    }
+
+    // Adds the timestamp and size of a file or directory to the key. Changing the contents of a
+    // directory updates its timestamp, which covers apps without a .deps.json, where the resolver
+    // enumerates the directory, and files being added to or removed from a framework.
+    void append_key_stamp(pal::string_t* key, const pal::string_t& path)
+    {
+        int64_t last_write_time;
+        int64_t size;
+        pal::stringstream_t stamp;
+        if (pal::get_file_stamp(path, &last_write_time, &size))
+        {
+            stamp << last_write_time << _X(':') << size;
+        }
+        else
+        {
+            stamp << _X("missing");
+        }
+
+        append_key_value(key, path.c_str(), stamp.str());
+    }
+
+    bool write_uint32(FILE* file, uint32_t value)
+    {
+        return fwrite(&value, sizeof(value), 1, file) == 1;
+    }
+
+    bool read_uint32(FILE* file, uint32_t* value)
+    {
+        return fread(value, sizeof(*value), 1, file) == 1;
+    }
+
+    bool write_string(FILE* file, const pal::string_t& value)
+    {
+        if (!write_uint32(file, static_cast<uint32_t>(value.size())))
+            return false;
+
+        return value.empty() || fwrite(value.data(), sizeof(pal::char_t), value.size(), file) == value.size();
+    }
+
+    bool read_string(FILE* file, pal::string_t* value)
+    {
+        uint32_t len;
+        if (!read_uint32(file, &len))
+            return false;
+
+        value->resize(len);
+        return len == 0 || fread(&(*value)[0], sizeof(pal::char_t), len, file) == len;
+    }
+}
+
+bool startup_cache::get_path_and_key(
+    const hostpolicy_init_t& init,
+    const arguments_t& args,
+    const std::vector<pal::string_t>& shared_store_paths,
+    bool read_rid_fallback_graph,
+    bool breadcrumbs_enabled,
+    pal::string_t* path,
+    pal::string_t* key)
+{
+    pal::string_t cache_dir;
+    if (!pal::getenv(STARTUP_CACHE_ENV, &cache_dir) || cache_dir.empty())
+        return false;
+
+    // Single-file bundles resolve assets from the bundle and don't benefit from the cache.
+    if (bundle::info_t::is_single_file_bundle())
+    {
+        trace::verbose(_X("Startup cache is not used for single-file apps"));
+        return false;
+    }
+
+    if (!pal::fullpath(&cache_dir) || !pal::directory_exists(cache_dir))
+    {
+        trace::verbose(_X("Startup cache directory [%s] does not exist"), cache_dir.c_str());
+        return false;
+    }
+
+    path->assign(cache_dir);
+    pal::stringstream_t file_name;
+    file_name << get_filename_without_ext(args.managed_application) << _X('.')
+        << std::hex << std::hash<pal::string_t>()(args.managed_application) << STARTUP_CACHE_FILE_EXTENSION;
+    append_path(path, file_name.str().c_str());
+
+    key->clear();
+    append_key_value(key, _X("hostpolicy"), _STRINGIFY(HOST_VERSION));
+    append_key_value(key, _X("host_path"), init.host_info.host_path);
+    append_key_value(key, _X("host_mode"), pal::to_string(static_cast<int>(init.host_mode)));
+    append_key_value(key, _X("framework_dependent"), init.is_framework_dependent ? _X("1") : _X("0"));
+    append_key_value(key, _X("rid_fallback_graph"), read_rid_fallback_graph ? _X("1") : _X("0"));
+    append_key_value(key, _X("breadcrumbs"), breadcrumbs_enabled ? _X("1") : _X("0"));
+    append_key_value(key, _X("rid"), get_runtime_id());
+    append_key_value(key, _X("app"), args.managed_application);
+    append_key_value(key, _X("app_root"), args.app_root);
+    append_key_value(key, _X("deps"), args.deps_path);
+    append_key_value(key, _X("additional_deps"), init.additional_deps_serialized);
+    for (const pal::string_t& probe_path : init.probe_paths)
+        append_key_value(key, _X("probe"), probe_path);
+
+    for (const pal::string_t& store_path : shared_store_paths)
+        append_key_value(key, _X("store"), store_path);
+
+    append_key_stamp(key, args.app_root);
+    append_key_stamp(key, args.deps_path);
+    for (const std::unique_ptr<fx_definition_t>& fx : init.fx_definitions)
+    {
+        // The first definition is the app itself, which is covered above.
+        if (fx->get_dir().empty() || fx.get() == &get_app(init.fx_definitions))
+            continue;
+
+        append_key_value(key, _X("fx"), fx->get_name() + _X(",") + fx->get_found_version());
+        append_key_stamp(key, fx->get_dir());
+
+        pal::string_t fx_deps_file = fx->get_dir();
+        append_path(&fx_deps_file, (fx->get_name() + _X(".deps.json")).c_str());
+        append_key_stamp(key, fx_deps_file);
+    }
+
+    pal::string_t additional_deps;
+    pal::stringstream_t ss(init.additional_deps_serialized);
+    while (std::getline(ss, additional_deps, PATH_SEPARATOR))
+    {
+        if (!additional_deps.empty())
+            append_key_stamp(key, additional_deps);
+    }
+
+    return true;
+}
+
+bool startup_cache::try_read(const pal::string_t& path, const pal::string_t& key, entry_t* entry)
+{
+    FILE* file = pal::file_open(path, _X("rb"));
+    if (file == nullptr)
+    {
+        trace::verbose(_X("Startup cache [%s] not found"), path.c_str());
+        return false;
+    }
+
+    uint32_t version;
+    pal::string_t cached_key;
+    bool success = read_uint32(file, &version)
+        && version == cache_format_version
+        && read_string(file, &cached_key)
+        && cached_key == key;
+
+    if (!success)
+    {
+        fclose(file);
+        trace::verbose(_X("Startup cache [%s] is out of date"), path.c_str());
+        return false;
+    }
+
+    uint32_t breadcrumb_count = 0;
+    success = read_string(file, &entry->probe_paths.tpa)
+        && read_string(file, &entry->probe_paths.native)
+        && read_string(file, &entry->probe_paths.resources)
+        && read_string(file, &entry->probe_paths.coreclr)
+        && read_string(file, &entry->fx_deps_file)
+        && read_string(file, &entry->app_context_deps_files)
+        && read_string(file, &entry->probing_directories)
+        && read_string(file, &entry->app_base)
+        && read_uint32(file, &breadcrumb_count);
+
+    entry->breadcrumbs.clear();
+    for (uint32_t i = 0; success && i < breadcrumb_count; ++i)
+    {
+        pal::string_t breadcrumb;
+        success = read_string(file, &breadcrumb);
+        entry->breadcrumbs.push_back(std::move(breadcrumb));
+    }
+
+    fclose(file);
+
+    // The key doesn't cover everything under probe directories, make sure
+    // the runtime itself is still where it was resolved to.
+    if (success && !pal::file_exists(entry->probe_paths.coreclr))
+        success = false;
+
+    if (!success)
+    {
+        trace::verbose(_X("Startup cache [%s] is invalid"), path.c_str());
+        return false;
+    }
+
+    trace::info(_X("Using startup cache [%s]"), path.c_str());
+    return true;
+}
+
+void startup_cache::write(const pal::string_t& path, const pal::string_t& key, const entry_t& entry)
+{
+    // Write next to the final location and rename so concurrent launches never see a partial file.
+    pal::string_t temp_path = path;
+    temp_path.append(_X("."));
+    temp_path.append(pal::to_string(pal::get_pid()));
+
+    FILE* file = pal::file_open(temp_path, _X("wb"));
+    if (file == nullptr)
+    {
+        trace::verbose(_X("Failed to create startup cache [%s]"), temp_path.c_str());
+        return;
+    }
+
+    bool success = write_uint32(file, cache_format_version)
+        && write_string(file, key)
+        && write_string(file, entry.probe_paths.tpa)
+        && write_string(file, entry.probe_paths.native)
+        && write_string(file, entry.probe_paths.resources)
+        && write_string(file, entry.probe_paths.coreclr)
+        && write_string(file, entry.fx_deps_file)
+        && write_string(file, entry.app_context_deps_files)
+        && write_string(file, entry.probing_directories)
+        && write_string(file, entry.app_base)
+        && write_uint32(file, static_cast<uint32_t>(entry.breadcrumbs.size()));
+
+    for (size_t i = 0; success && i < entry.breadcrumbs.size(); ++i)
+        success = write_string(file, entry.breadcrumbs[i]);
+
+    success = (fclose(file) == 0) && success;
+
+#if defined(_WIN32)
+    // Rename doesn't replace an existing file on Windows.
+    if (success)
+        pal::remove(path.c_str());
+#endif
+
+    if (!success || pal::rename(temp_path.c_str(), path.c_str()) != 0)
+    {
+        trace::verbose(_X("Failed to write startup cache [%s]"), path.c_str());
+        pal::remove(temp_path.c_str());
+        return;
+    }
+
+    trace::verbose(_X("Wrote startup cache [%s]"), path.c_str());
+}
@@ -0,0 +1,45 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef STARTUP_CACHE_H
+#define STARTUP_CACHE_H
+
+#include <pal.h>
+#include "args.h"
+#include "deps_resolver.h"
+#include "hostpolicy_init.h"
+
+// Opt-in cache (DOTNET_HOST_STARTUP_CACHE=<directory>) of the dependency resolution results
+// for an app, so that later launches can skip parsing the .deps.json files and probing for
+// every asset. An entry is only used if the key built from the app, framework and probe
+// inputs - including the timestamps of the .deps.json files and the app/framework
+// directories - matches exactly.
+namespace startup_cache
+{
+    struct entry_t
+    {
+        probe_paths_t probe_paths;
+        pal::string_t fx_deps_file;
+        pal::string_t app_context_deps_files;
+        pal::string_t probing_directories;
+        pal::string_t app_base;
+        std::vector<pal::string_t> breadcrumbs;
+    };
+
+    // Gets the cache file path and key for the app. Returns false if the cache is not enabled
+    // or cannot be used for the app.
+    bool get_path_and_key(
+        const hostpolicy_init_t& init,
+        const arguments_t& args,
+        const std::vector<pal::string_t>& shared_store_paths,
+        bool read_rid_fallback_graph,
+        bool breadcrumbs_enabled,
+        pal::string_t* path,
+        pal::string_t* key);
+
+    bool try_read(const pal::string_t& path, const pal::string_t& key, entry_t* entry);
+
+    void write(const pal::string_t& path, const pal::string_t& key, const entry_t& entry);
+}
+
+#endif // STARTUP_CACHE_H
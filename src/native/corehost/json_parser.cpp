@@ -68,6 +68,16 @@ void get_line_column_from_offset(const char* data, uint64_t size, size_t offset,
 
 } // empty namespace
 
+void json_parser_t::report_parse_error(const char* data, size_t size, size_t offset, rapidjson::ParseErrorCode code, const pal::string_t& context)
+{
+    int line, column;
+    get_line_column_from_offset(data, size, offset, &line, &column);
+
+    trace::error(_X("A JSON parsing exception occurred in [%s], offset %zu (line %d, column %d): %s"),
+        context.c_str(), offset, line, column,
+        rapidjson::GetParseError_En(code));
+}
+
 void json_parser_t::realloc_buffer(size_t size)
 {
     m_json.resize(size + 1);
@@ -91,14 +101,7 @@ bool json_parser_t::parse_raw_data(char* data, int64_t size, const pal::string_t
 
     if (m_document.HasParseError())
     {
-        int line, column;
-        size_t offset = m_document.GetErrorOffset();
-
-        get_line_column_from_offset(data, size, offset, &line, &column);
-
-        trace::error(_X("A JSON parsing exception occurred in [%s], offset %zu (line %d, column %d): %s"),
-            context.c_str(), offset, line, column,
-            rapidjson::GetParseError_En(m_document.GetParseError()));
+        report_parse_error(data, size, m_document.GetErrorOffset(), m_document.GetParseError(), context);
         return false;
     }
 
@@ -112,6 +115,16 @@ bool json_parser_t::parse_raw_data(char* data, int64_t size, const pal::string_t
 }
 
 bool json_parser_t::parse_file(const pal::string_t& path)
+{
+    char* data;
+    size_t size;
+    if (!read_file(path, &data, &size))
+        return false;
+
+    return parse_raw_data(data, size, path);
+}
+
+bool json_parser_t::read_file(const pal::string_t& path, char** data, size_t* size)
 {
     // This code assumes that the caller has checked that the file `path` exists
     // either within the bundle, or as a real file on disk.
@@ -127,8 +140,9 @@ bool json_parser_t::parse_file(const pal::string_t& path)
 
         if (m_bundle_data != nullptr)
         {
-            bool result = parse_raw_data(m_bundle_data, m_bundle_location->size, path);
-            return result;
+            *data = m_bundle_data;
+            *size = static_cast<size_t>(m_bundle_location->size);
+            return true;
         }
     }
 
@@ -153,7 +167,9 @@ bool json_parser_t::parse_file(const pal::string_t& path)
     realloc_buffer(static_cast<size_t>(stream_size - current_pos));
     file.read(m_json.data(), stream_size - current_pos);
 
-    return parse_raw_data(m_json.data(), m_json.size(), path);
+    *data = m_json.data();
+    *size = m_json.size();
+    return true;
 }
 
 json_parser_t::~json_parser_t()
@@ -18,6 +18,7 @@
 
 #include "pal.h"
 #include <rapidjson/document.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/fwd.h>
 #include <vector>
 #include "bundle/info.h"
@@ -39,6 +40,37 @@ class json_parser_t {
         bool parse_raw_data(char* data, int64_t size, const pal::string_t& context);
         bool parse_file(const pal::string_t& path);
 
+        // Parses the file with a rapidjson SAX handler instead of building the DOM. Where the
+        // encodings allow it, strings passed to the handler point into the file buffer, which
+        // is only valid until the handler returns - document() is not populated.
+        template<typename handler_t>
+        bool parse_file(const pal::string_t& path, handler_t& handler)
+        {
+            char* data;
+            size_t size;
+            if (!read_file(path, &data, &size))
+                return false;
+
+            constexpr unsigned flags = rapidjson::ParseFlag::kParseStopWhenDoneFlag | rapidjson::ParseFlag::kParseCommentsFlag;
+            rapidjson::GenericReader<rapidjson::UTF8<>, internal_encoding_type_t> reader;
+#ifdef _WIN32
+            // See parse_raw_data for why in-situ parsing can't be used on Windows.
+            rapidjson::StringStream stream(data);
+            rapidjson::ParseResult result = reader.Parse<flags>(stream, handler);
+#else // _WIN32
+            rapidjson::InsituStringStream stream(data);
+            rapidjson::ParseResult result = reader.Parse<flags | rapidjson::ParseFlag::kParseInsituFlag>(stream, handler);
+#endif // _WIN32
+
+            if (result.IsError())
+            {
+                report_parse_error(data, size, result.Offset(), result.Code(), path);
+                return false;
+            }
+
+            return true;
+        }
+
         json_parser_t()
             : m_bundle_data(nullptr)
             , m_bundle_location(nullptr) {}
@@ -58,6 +90,11 @@ class json_parser_t {
         const bundle::location_t* m_bundle_location; // Location of this json file within the bundle.
 
         void realloc_buffer(size_t size);
+
+        // Reads or maps the file into memory, data is null terminated and writable.
+        bool read_file(const pal::string_t& path, char** data, size_t* size);
+
+        static void report_parse_error(const char* data, size_t size, size_t offset, rapidjson::ParseErrorCode code, const pal::string_t& context);
 };
 
 #endif // __JSON_PARSER_H__
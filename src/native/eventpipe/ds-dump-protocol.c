@@ -10,6 +10,10 @@
 
 const ep_char16_t empty_string [1] = { 0 };
 
+#define DS_HEAP_SNAPSHOT_DEFAULT_CHUNK_SIZE (64 * 1024)
+#define DS_HEAP_SNAPSHOT_MIN_CHUNK_SIZE (4 * 1024)
+#define DS_HEAP_SNAPSHOT_MAX_CHUNK_SIZE (1024 * 1024)
+
 /*
  * Forward declares of all static functions.
  */
@@ -25,6 +29,46 @@ dump_protocol_helper_generate_core_dump (
 	DiagnosticsIpcMessage *message,
 	DiagnosticsIpcStream *stream);
 
+static
+uint8_t *
+generate_heap_snapshot_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len);
+
+static
+bool
+heap_snapshot_writer_init (
+	DiagnosticsHeapSnapshotWriter *writer,
+	DiagnosticsIpcStream *stream,
+	uint32_t chunk_size);
+
+static
+void
+heap_snapshot_writer_fini (DiagnosticsHeapSnapshotWriter *writer);
+
+static
+bool
+heap_snapshot_writer_flush (DiagnosticsHeapSnapshotWriter *writer);
+
+static
+bool
+heap_snapshot_writer_write (
+	DiagnosticsHeapSnapshotWriter *writer,
+	const void *data,
+	uint32_t data_len);
+
+static
+void
+heap_snapshot_writer_complete (
+	DiagnosticsHeapSnapshotWriter *writer,
+	ds_ipc_result_t result);
+
+static
+bool
+dump_protocol_helper_generate_heap_snapshot (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream);
+
 static
 bool
 dump_protocol_helper_unknown_command (
@@ -79,6 +123,254 @@ ds_generate_core_dump_command_payload_free (DiagnosticsGenerateCoreDumpCommandPa
 	ep_rt_object_free (payload);
 }
 
+/*
+* DiagnosticsGenerateHeapSnapshotCommandPayload
+*/
+
+static
+uint8_t *
+generate_heap_snapshot_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len)
+{
+	EP_ASSERT (buffer != NULL);
+
+	uint8_t * buffer_cursor = buffer;
+	uint32_t buffer_cursor_len = buffer_len;
+
+	DiagnosticsGenerateHeapSnapshotCommandPayload *instance = ds_generate_heap_snapshot_command_payload_alloc ();
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->incoming_buffer = buffer;
+
+	if (!ds_ipc_message_try_parse_uint32_t (&buffer_cursor, &buffer_cursor_len, &instance->flags) ||
+		!ds_ipc_message_try_parse_uint32_t (&buffer_cursor, &buffer_cursor_len, &instance->chunk_size))
+		ep_raise_error ();
+
+ep_on_exit:
+	return (uint8_t *)instance;
+
+ep_on_error:
+	ds_generate_heap_snapshot_command_payload_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+DiagnosticsGenerateHeapSnapshotCommandPayload *
+ds_generate_heap_snapshot_command_payload_alloc (void)
+{
+	return ep_rt_object_alloc (DiagnosticsGenerateHeapSnapshotCommandPayload);
+}
+
+void
+ds_generate_heap_snapshot_command_payload_free (DiagnosticsGenerateHeapSnapshotCommandPayload *payload)
+{
+	ep_return_void_if_nok (payload != NULL);
+	ep_rt_byte_array_free (payload->incoming_buffer);
+	ep_rt_object_free (payload);
+}
+
+/*
+* DiagnosticsHeapSnapshotWriter
+*/
+
+static
+bool
+heap_snapshot_writer_init (
+	DiagnosticsHeapSnapshotWriter *writer,
+	DiagnosticsIpcStream *stream,
+	uint32_t chunk_size)
+{
+	EP_ASSERT (writer != NULL);
+	EP_ASSERT (stream != NULL);
+
+	if (chunk_size == 0)
+		chunk_size = DS_HEAP_SNAPSHOT_DEFAULT_CHUNK_SIZE;
+	else if (chunk_size < DS_HEAP_SNAPSHOT_MIN_CHUNK_SIZE)
+		chunk_size = DS_HEAP_SNAPSHOT_MIN_CHUNK_SIZE;
+	else if (chunk_size > DS_HEAP_SNAPSHOT_MAX_CHUNK_SIZE)
+		chunk_size = DS_HEAP_SNAPSHOT_MAX_CHUNK_SIZE;
+
+	memset (writer, 0, sizeof (*writer));
+	writer->stream = stream;
+	writer->buffer_size = chunk_size;
+
+	writer->buffer = ep_rt_byte_array_alloc (chunk_size);
+	ep_raise_error_if_nok (writer->buffer != NULL);
+
+	writer->type_ids = dn_umap_alloc ();
+	ep_raise_error_if_nok (writer->type_ids != NULL);
+
+	return true;
+
+ep_on_error:
+	heap_snapshot_writer_fini (writer);
+	return false;
+}
+
+static
+void
+heap_snapshot_writer_fini (DiagnosticsHeapSnapshotWriter *writer)
+{
+	EP_ASSERT (writer != NULL);
+
+	dn_umap_free (writer->type_ids);
+	writer->type_ids = NULL;
+	ep_rt_byte_array_free (writer->buffer);
+	writer->buffer = NULL;
+}
+
+static
+bool
+heap_snapshot_writer_flush (DiagnosticsHeapSnapshotWriter *writer)
+{
+	EP_ASSERT (writer != NULL);
+
+	if (writer->failed)
+		return false;
+
+	if (writer->buffer_len == 0)
+		return true;
+
+	// The success response is only sent once there is data, so failures before the
+	// heap walk starts can still be reported as a regular error response.
+	if (!writer->response_sent) {
+		writer->response_sent = true;
+		if (!ds_ipc_message_send_success (writer->stream, DS_IPC_S_OK)) {
+			writer->failed = true;
+			return false;
+		}
+	}
+
+	uint32_t bytes_written = 0;
+	uint32_t chunk_len = writer->buffer_len;
+	if (!ds_ipc_stream_write (writer->stream, (const uint8_t *)&chunk_len, sizeof (chunk_len), &bytes_written, EP_INFINITE_WAIT) ||
+		!ds_ipc_stream_write (writer->stream, writer->buffer, chunk_len, &bytes_written, EP_INFINITE_WAIT)) {
+		DS_LOG_WARNING_0 ("Heap snapshot client stopped reading, aborting the heap walk.");
+		writer->failed = true;
+		return false;
+	}
+
+	writer->buffer_len = 0;
+	return true;
+}
+
+static
+bool
+heap_snapshot_writer_write (
+	DiagnosticsHeapSnapshotWriter *writer,
+	const void *data,
+	uint32_t data_len)
+{
+	EP_ASSERT (writer != NULL);
+	EP_ASSERT (data != NULL);
+
+	const uint8_t *data_cursor = (const uint8_t *)data;
+	while (data_len > 0) {
+		if (writer->buffer_len == writer->buffer_size && !heap_snapshot_writer_flush (writer))
+			return false;
+
+		uint32_t available = writer->buffer_size - writer->buffer_len;
+		uint32_t to_copy = data_len < available ? data_len : available;
+		memcpy (writer->buffer + writer->buffer_len, data_cursor, to_copy);
+		writer->buffer_len += to_copy;
+		data_cursor += to_copy;
+		data_len -= to_copy;
+	}
+
+	return !writer->failed;
+}
+
+static
+void
+heap_snapshot_writer_complete (
+	DiagnosticsHeapSnapshotWriter *writer,
+	ds_ipc_result_t result)
+{
+	EP_ASSERT (writer != NULL);
+
+	if (writer->failed)
+		return;
+
+	if (result == DS_IPC_S_OK)
+		heap_snapshot_writer_flush (writer);
+
+	if (!writer->response_sent) {
+		writer->response_sent = true;
+		if (result != DS_IPC_S_OK) {
+			ds_ipc_message_send_error (writer->stream, result);
+			return;
+		}
+		ep_return_void_if_nok (ds_ipc_message_send_success (writer->stream, DS_IPC_S_OK));
+	}
+
+	// Terminating chunk, followed by the final status since the heap walk
+	// could have failed after the success response went out.
+	uint32_t trailer [2] = { 0, (uint32_t)result };
+	uint32_t bytes_written = 0;
+	ds_ipc_stream_write (writer->stream, (const uint8_t *)trailer, sizeof (trailer), &bytes_written, EP_INFINITE_WAIT);
+	ds_ipc_stream_flush (writer->stream);
+}
+
+bool
+ds_heap_snapshot_writer_add_type_id (
+	DiagnosticsHeapSnapshotWriter *writer,
+	uint64_t type_id)
+{
+	EP_ASSERT (writer != NULL);
+	return dn_umap_insert (writer->type_ids, (void *)(uintptr_t)type_id, NULL).result;
+}
+
+bool
+ds_heap_snapshot_writer_write_type (
+	DiagnosticsHeapSnapshotWriter *writer,
+	uint64_t type_id,
+	const ep_char16_t *type_name,
+	uint32_t type_name_len)
+{
+	EP_ASSERT (writer != NULL);
+
+	uint8_t kind = DS_HEAP_SNAPSHOT_RECORD_TYPE;
+	if (type_name == NULL)
+		type_name_len = 0;
+
+	bool success = heap_snapshot_writer_write (writer, &kind, sizeof (kind)) &&
+		heap_snapshot_writer_write (writer, &type_id, sizeof (type_id)) &&
+		heap_snapshot_writer_write (writer, &type_name_len, sizeof (type_name_len));
+
+	if (success && type_name_len > 0)
+		success = heap_snapshot_writer_write (writer, type_name, type_name_len * sizeof (ep_char16_t));
+
+	return success;
+}
+
+bool
+ds_heap_snapshot_writer_write_object (
+	DiagnosticsHeapSnapshotWriter *writer,
+	uint64_t address,
+	uint64_t type_id,
+	uint64_t size,
+	uint32_t reference_count)
+{
+	EP_ASSERT (writer != NULL);
+
+	uint8_t kind = DS_HEAP_SNAPSHOT_RECORD_OBJECT;
+	return heap_snapshot_writer_write (writer, &kind, sizeof (kind)) &&
+		heap_snapshot_writer_write (writer, &address, sizeof (address)) &&
+		heap_snapshot_writer_write (writer, &type_id, sizeof (type_id)) &&
+		heap_snapshot_writer_write (writer, &size, sizeof (size)) &&
+		heap_snapshot_writer_write (writer, &reference_count, sizeof (reference_count));
+}
+
+bool
+ds_heap_snapshot_writer_write_reference (
+	DiagnosticsHeapSnapshotWriter *writer,
+	uint64_t address)
+{
+	EP_ASSERT (writer != NULL);
+	return heap_snapshot_writer_write (writer, &address, sizeof (address));
+}
+
 /*
  * DiagnosticsDumpProtocolHelper.
  */
@@ -239,6 +531,56 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static
+bool
+dump_protocol_helper_generate_heap_snapshot (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	EP_ASSERT (message != NULL);
+	EP_ASSERT (stream != NULL);
+
+	if (!stream)
+		return false;
+
+	ds_ipc_result_t ipc_result = DS_IPC_E_FAIL;
+	DiagnosticsHeapSnapshotWriter writer;
+	DiagnosticsGenerateHeapSnapshotCommandPayload *payload;
+	payload = (DiagnosticsGenerateHeapSnapshotCommandPayload *)ds_ipc_message_try_parse_payload (message, generate_heap_snapshot_command_try_parse_payload);
+
+	if (!payload) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_BAD_ENCODING);
+		ep_raise_error ();
+	}
+
+	if (ds_generate_heap_snapshot_command_payload_get_flags (payload) != 0) {
+		ipc_result = DS_IPC_E_INVALIDARG;
+		ds_ipc_message_send_error (stream, ipc_result);
+		ep_raise_error ();
+	}
+
+	if (!heap_snapshot_writer_init (&writer, stream, ds_generate_heap_snapshot_command_payload_get_chunk_size (payload))) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_FAIL);
+		ep_raise_error ();
+	}
+
+	ipc_result = ds_rt_generate_heap_snapshot (payload, &writer);
+	if (ipc_result == DS_IPC_S_OK && writer.failed)
+		ipc_result = DS_IPC_E_FAIL;
+
+	heap_snapshot_writer_complete (&writer, ipc_result);
+	heap_snapshot_writer_fini (&writer);
+
+ep_on_exit:
+	ds_generate_heap_snapshot_command_payload_free (payload);
+	ds_ipc_stream_free (stream);
+	return ipc_result == DS_IPC_S_OK;
+
+ep_on_error:
+	EP_ASSERT (ipc_result != DS_IPC_S_OK);
+	ep_exit_error_handler ();
+}
+
 bool
 ds_dump_protocol_helper_handle_ipc_message (
 	DiagnosticsIpcMessage *message,
@@ -255,6 +597,9 @@ ds_dump_protocol_helper_handle_ipc_message (
 	case DS_DUMP_COMMANDID_GENERATE_CORE_DUMP3:
 		result = dump_protocol_helper_generate_core_dump (message, stream);
 		break;
+	case DS_DUMP_COMMANDID_GENERATE_HEAP_SNAPSHOT:
+		result = dump_protocol_helper_generate_heap_snapshot (message, stream);
+		break;
 	default:
 		result = dump_protocol_helper_unknown_command (message, stream);
 		break;
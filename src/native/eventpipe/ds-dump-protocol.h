@@ -7,6 +7,8 @@
 #include "ds-types.h"
 #include "ds-ipc.h"
 
+#include <containers/dn-umap.h>
+
 #undef DS_IMPL_GETTER_SETTER
 #ifdef DS_IMPL_DUMP_PROTOCOL_GETTER_SETTER
 #define DS_IMPL_GETTER_SETTER
@@ -83,5 +85,112 @@ struct _DiagnosticsGenerateCoreDumpResponsePayload {
 };
 #endif
 
+/*
+* DiagnosticsGenerateHeapSnapshotCommandPayload
+*/
+
+#if defined(DS_INLINE_GETTER_SETTER) || defined(DS_IMPL_DUMP_PROTOCOL_GETTER_SETTER)
+struct _DiagnosticsGenerateHeapSnapshotCommandPayload {
+#else
+struct _DiagnosticsGenerateHeapSnapshotCommandPayload_Internal {
+#endif
+	uint8_t * incoming_buffer;
+
+	// The protocol buffer is defined as:
+	//   uint32 - flags (reserved, must be 0)
+	//   uint32 - chunkSize (0 for default)
+	// returns
+	//   ulong - status, followed on success by the snapshot chunks:
+	//     uint32 - chunk length, 0 terminates the snapshot
+	//     byte[] - chunk data (records can span chunks)
+	//   uint32 - final status, after the terminating chunk
+	//
+	// Records are prefixed by a byte kind:
+	//   DS_HEAP_SNAPSHOT_RECORD_TYPE: uint64 typeId, uint32 nameLen, char16[nameLen] name (no terminator)
+	//   DS_HEAP_SNAPSHOT_RECORD_OBJECT: uint64 address, uint64 typeId, uint64 size, uint32 refCount, uint64[refCount] refs
+	// A type record always precedes the first object record using its typeId.
+
+	uint32_t flags;
+	uint32_t chunk_size;
+};
+
+#if !defined(DS_INLINE_GETTER_SETTER) && !defined(DS_IMPL_DUMP_PROTOCOL_GETTER_SETTER)
+struct _DiagnosticsGenerateHeapSnapshotCommandPayload {
+	uint8_t _internal [sizeof (struct _DiagnosticsGenerateHeapSnapshotCommandPayload_Internal)];
+};
+#endif
+
+DS_DEFINE_GETTER(DiagnosticsGenerateHeapSnapshotCommandPayload *, generate_heap_snapshot_command_payload, uint32_t, flags)
+DS_DEFINE_GETTER(DiagnosticsGenerateHeapSnapshotCommandPayload *, generate_heap_snapshot_command_payload, uint32_t, chunk_size)
+
+DiagnosticsGenerateHeapSnapshotCommandPayload *
+ds_generate_heap_snapshot_command_payload_alloc (void);
+
+void
+ds_generate_heap_snapshot_command_payload_free (DiagnosticsGenerateHeapSnapshotCommandPayload *payload);
+
+/*
+* DiagnosticsHeapSnapshotWriter
+*/
+
+#define DS_HEAP_SNAPSHOT_RECORD_TYPE ((uint8_t)1)
+#define DS_HEAP_SNAPSHOT_RECORD_OBJECT ((uint8_t)2)
+
+#if defined(DS_INLINE_GETTER_SETTER) || defined(DS_IMPL_DUMP_PROTOCOL_GETTER_SETTER)
+struct _DiagnosticsHeapSnapshotWriter {
+#else
+struct _DiagnosticsHeapSnapshotWriter_Internal {
+#endif
+	DiagnosticsIpcStream *stream;
+	// Type ids already described to the client.
+	dn_umap_t *type_ids;
+	uint8_t *buffer;
+	uint32_t buffer_size;
+	uint32_t buffer_len;
+	bool response_sent;
+	bool failed;
+};
+
+#if !defined(DS_INLINE_GETTER_SETTER) && !defined(DS_IMPL_DUMP_PROTOCOL_GETTER_SETTER)
+struct _DiagnosticsHeapSnapshotWriter {
+	uint8_t _internal [sizeof (struct _DiagnosticsHeapSnapshotWriter_Internal)];
+};
+#endif
+
+DS_DEFINE_GETTER(DiagnosticsHeapSnapshotWriter *, heap_snapshot_writer, bool, failed)
+
+// The runtime calls these from inside the heap walk. Chunks go out on the stream as soon as
+// they fill up, so a slow reader holds the walk (and the suspended runtime) back instead of
+// the snapshot being buffered in process. All return false once the stream has failed,
+// the heap walk should stop at that point.
+
+// Returns true the first time a type id is seen, the caller should then describe the type
+// with ds_heap_snapshot_writer_write_type before writing objects of that type.
+bool
+ds_heap_snapshot_writer_add_type_id (
+	DiagnosticsHeapSnapshotWriter *writer,
+	uint64_t type_id);
+
+bool
+ds_heap_snapshot_writer_write_type (
+	DiagnosticsHeapSnapshotWriter *writer,
+	uint64_t type_id,
+	const ep_char16_t *type_name,
+	uint32_t type_name_len);
+
+// Must be followed by exactly reference_count calls to ds_heap_snapshot_writer_write_reference.
+bool
+ds_heap_snapshot_writer_write_object (
+	DiagnosticsHeapSnapshotWriter *writer,
+	uint64_t address,
+	uint64_t type_id,
+	uint64_t size,
+	uint32_t reference_count);
+
+bool
+ds_heap_snapshot_writer_write_reference (
+	DiagnosticsHeapSnapshotWriter *writer,
+	uint64_t address);
+
 #endif /* ENABLE_PERFTRACING */
 #endif /* __DIAGNOSTICS_DUMP_PROTOCOL_H__ */
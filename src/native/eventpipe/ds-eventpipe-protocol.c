@@ -30,7 +30,8 @@ bool
 eventpipe_collect_tracing_command_try_parse_serialization_format (
 	uint8_t **buffer,
 	uint32_t *buffer_len,
-	EventPipeSerializationFormat *format);
+	EventPipeSerializationFormat *format,
+	uint32_t *format_flags);
 
 static
 bool
@@ -119,15 +120,22 @@ bool
 eventpipe_collect_tracing_command_try_parse_serialization_format (
 	uint8_t **buffer,
 	uint32_t *buffer_len,
-	EventPipeSerializationFormat *format)
+	EventPipeSerializationFormat *format,
+	uint32_t *format_flags)
 {
 	EP_ASSERT (buffer != NULL);
 	EP_ASSERT (buffer_len != NULL);
 	EP_ASSERT (format != NULL);
+	EP_ASSERT (format_flags != NULL);
 
 	uint32_t serialization_format;
 	bool can_parse = ds_ipc_message_try_parse_uint32_t (buffer, buffer_len, &serialization_format);
 
+	// Clients opt into session features through flags in the format field. Runtimes that don't
+	// support them fail the command since the value is out of range, letting the client fall back.
+	*format_flags = serialization_format & DS_EVENTPIPE_SERIALIZATION_FORMAT_FLAGS_MASK;
+	serialization_format &= ~DS_EVENTPIPE_SERIALIZATION_FORMAT_FLAGS_MASK;
+
 	*format = (EventPipeSerializationFormat)serialization_format;
 	return can_parse && (0 <= (int32_t)serialization_format) && ((int32_t)serialization_format < (int32_t)EP_SERIALIZATION_FORMAT_COUNT);
 }
@@ -322,7 +330,7 @@ eventpipe_collect_tracing_command_try_parse_payload (
 	instance->incoming_buffer = buffer;
 
 	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
-		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
+		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format, &instance->format_flags) ||
 		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, &instance->provider_configs))
 		ep_raise_error ();
 	instance->rundown_requested = true;
@@ -355,7 +363,7 @@ eventpipe_collect_tracing2_command_try_parse_payload (
 	instance->incoming_buffer = buffer;
 
 	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
-		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
+		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format, &instance->format_flags) ||
 		!eventpipe_collect_tracing_command_try_parse_rundown_requested (&buffer_cursor, &buffer_cursor_len, &instance->rundown_requested) ||
 		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, &instance->provider_configs))
 		ep_raise_error ();
@@ -390,7 +398,7 @@ eventpipe_collect_tracing3_command_try_parse_payload (
 	instance->incoming_buffer = buffer;
 
 	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
-		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
+		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format, &instance->format_flags) ||
 		!eventpipe_collect_tracing_command_try_parse_rundown_requested (&buffer_cursor, &buffer_cursor_len, &instance->rundown_requested) ||
 		!eventpipe_collect_tracing_command_try_parse_stackwalk_requested (&buffer_cursor, &buffer_cursor_len, &instance->stackwalk_requested) ||
 		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, &instance->provider_configs))
@@ -424,7 +432,7 @@ eventpipe_collect_tracing4_command_try_parse_payload (
 	instance->incoming_buffer = buffer;
 
 	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
-		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
+		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format, &instance->format_flags) ||
 		!eventpipe_collect_tracing_command_try_parse_rundown_keyword (&buffer_cursor, &buffer_cursor_len, &instance->rundown_keyword) ||
 		!eventpipe_collect_tracing_command_try_parse_stackwalk_requested (&buffer_cursor, &buffer_cursor_len, &instance->stackwalk_requested) ||
 		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, &instance->provider_configs))
@@ -530,6 +538,9 @@ eventpipe_protocol_helper_collect_tracing (
 		return false;
 	}
 
+	// user_events sessions write to the kernel, the stream only carries the response.
+	bool user_events = (payload->format_flags & DS_EVENTPIPE_SERIALIZATION_FORMAT_FLAG_USER_EVENTS) != 0;
+
 	EventPipeSessionOptions options;
 	ep_session_options_init(
 		&options,
@@ -537,13 +548,15 @@ eventpipe_protocol_helper_collect_tracing (
 		payload->circular_buffer_size_in_mb,
 		dn_vector_data_t (payload->provider_configs, EventPipeProviderConfiguration),
 		dn_vector_size (payload->provider_configs),
-		EP_SESSION_TYPE_IPCSTREAM,
+		user_events ? EP_SESSION_TYPE_USEREVENTS : EP_SESSION_TYPE_IPCSTREAM,
 		payload->serialization_format,
 		payload->rundown_keyword,
 		payload->stackwalk_requested,
-		ds_ipc_stream_get_stream_ref (stream),
+		user_events ? NULL : ds_ipc_stream_get_stream_ref (stream),
 		NULL,
 		NULL);
+	options.compress_blocks = (payload->format_flags & DS_EVENTPIPE_SERIALIZATION_FORMAT_FLAG_COMPRESSED_BLOCKS) != 0;
+	options.rundown_stack_methods_only = (payload->format_flags & DS_EVENTPIPE_SERIALIZATION_FORMAT_FLAG_RUNDOWN_STACK_METHODS) != 0;
 
 	EventPipeSessionID session_id = 0;
 	bool result = false;
@@ -555,6 +568,10 @@ eventpipe_protocol_helper_collect_tracing (
 	} else {
 		eventpipe_protocol_helper_send_start_tracing_success (stream, session_id);
 		ep_start_streaming (session_id);
+		if (user_events) {
+			ds_ipc_stream_flush (stream);
+			ds_ipc_stream_free (stream);
+		}
 	}
 
 	result = true;
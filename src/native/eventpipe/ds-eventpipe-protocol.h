@@ -17,6 +17,12 @@
 * EventPipeCollectTracingCommandPayload
 */
 
+// High bits of the serialization format, the remaining bits hold the EventPipeSerializationFormat.
+#define DS_EVENTPIPE_SERIALIZATION_FORMAT_FLAG_COMPRESSED_BLOCKS 0x80000000U
+#define DS_EVENTPIPE_SERIALIZATION_FORMAT_FLAG_USER_EVENTS 0x40000000U
+#define DS_EVENTPIPE_SERIALIZATION_FORMAT_FLAG_RUNDOWN_STACK_METHODS 0x20000000U
+#define DS_EVENTPIPE_SERIALIZATION_FORMAT_FLAGS_MASK 0xE0000000U
+
 // Command = 0x0202
 // Command = 0x0203
 // Command = 0x0204
@@ -34,11 +40,15 @@ struct _EventPipeCollectTracingCommandPayload_Internal {
 	// array<T> = uint length, length # of Ts
 	// string = (array<char> where the last char must = 0) or (length = 0)
 	// provider_config = ulong keywords, uint logLevel, string provider_name, string filter_data
+	// format may have DS_EVENTPIPE_SERIALIZATION_FORMAT_FLAG_COMPRESSED_BLOCKS set to request LZ4 compressed blocks (nettrace only)
+	// format may have DS_EVENTPIPE_SERIALIZATION_FORMAT_FLAG_USER_EVENTS set to write events to a user_events tracepoint (Linux only)
+	// format may have DS_EVENTPIPE_SERIALIZATION_FORMAT_FLAG_RUNDOWN_STACK_METHODS set to limit rundown to methods in collected stacks (nettrace only)
 
 	uint8_t *incoming_buffer;
 	dn_vector_t *provider_configs;
 	uint32_t circular_buffer_size_in_mb;
 	EventPipeSerializationFormat serialization_format;
+	uint32_t format_flags;
 	bool rundown_requested;
 	bool stackwalk_requested;
 	uint64_t rundown_keyword;
@@ -839,7 +839,8 @@ static IpcStreamVtable ipc_stream_vtable = {
 	ipc_stream_read_func,
 	ipc_stream_write_func,
 	ipc_stream_flush_func,
-	ipc_stream_close_func };
+	ipc_stream_close_func,
+	NULL };
 
 static
 DiagnosticsIpcStream *
@@ -30,6 +30,7 @@
 #include <errno.h>
 #include <sys/un.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 
 #if __GNUC__
 #include <poll.h>
@@ -52,6 +53,7 @@
 #define DS_IPC_ERROR_INTERRUPT WSAEINTR
 typedef ADDRINFOA ds_ipc_addrinfo_t;
 typedef WSAPOLLFD ds_ipc_pollfd_t;
+typedef WSABUF ds_ipc_iovec_t;
 typedef int ds_ipc_mode_t;
 #else
 #define DS_IPC_INVALID_SOCKET -1
@@ -61,6 +63,7 @@ typedef int ds_ipc_mode_t;
 #define DS_IPC_ERROR_INTERRUPT EINTR
 typedef struct addrinfo ds_ipc_addrinfo_t;
 typedef struct pollfd ds_ipc_pollfd_t;
+typedef struct iovec ds_ipc_iovec_t;
 typedef mode_t ds_ipc_mode_t;
 #endif
 
@@ -155,6 +158,14 @@ ipc_socket_send (
 	ssize_t bytes_to_write,
 	ssize_t *bytes_written);
 
+static
+bool
+ipc_socket_send_vector (
+	ds_ipc_socket_t s,
+	const IpcStreamBuffer *buffers,
+	uint32_t buffer_count,
+	ssize_t *bytes_written);
+
 static
 bool
 ipc_transport_get_default_name (
@@ -203,6 +214,15 @@ ipc_stream_write_func (
 	uint32_t *bytes_written,
 	uint32_t timeout_ms);
 
+static
+bool
+ipc_stream_write_vector_func (
+	void *object,
+	const IpcStreamBuffer *buffers,
+	uint32_t buffer_count,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms);
+
 static
 bool
 ipc_stream_flush_func (void *object);
@@ -685,6 +705,78 @@ ipc_socket_send (
 	return continue_send;
 }
 
+// Max number of segments handed to a single writev/WSASend call.
+#define DS_IPC_MAX_IOVEC 16
+
+static
+bool
+ipc_socket_send_vector (
+	ds_ipc_socket_t s,
+	const IpcStreamBuffer *buffers,
+	uint32_t buffer_count,
+	ssize_t *bytes_written)
+{
+	ds_ipc_iovec_t iov [DS_IPC_MAX_IOVEC];
+	ssize_t current_bytes_written = 0;
+	ssize_t total_bytes_written = 0;
+	bool continue_send = true;
+
+	// Index of the first segment not fully sent and how much of it has already been sent.
+	uint32_t buffer_index = 0;
+	uint32_t buffer_offset = 0;
+
+	DS_ENTER_BLOCKING_PAL_SECTION;
+	while (continue_send && buffer_index < buffer_count) {
+		uint32_t iov_count = 0;
+		for (uint32_t i = buffer_index; i < buffer_count && iov_count < DS_IPC_MAX_IOVEC; ++i) {
+			uint32_t offset = (i == buffer_index) ? buffer_offset : 0;
+			if (buffers [i].buffer_len == offset)
+				continue;
+#ifdef HOST_WIN32
+			iov [iov_count].buf = (CHAR *)(buffers [i].buffer + offset);
+			iov [iov_count].len = (ULONG)(buffers [i].buffer_len - offset);
+#else
+			iov [iov_count].iov_base = (void *)(buffers [i].buffer + offset);
+			iov [iov_count].iov_len = (size_t)(buffers [i].buffer_len - offset);
+#endif
+			iov_count++;
+		}
+
+		if (iov_count == 0)
+			break;
+
+#ifdef HOST_WIN32
+		DWORD bytes_sent = 0;
+		current_bytes_written = WSASend (s, iov, (DWORD)iov_count, &bytes_sent, 0, NULL, NULL) == 0 ? (ssize_t)bytes_sent : DS_IPC_SOCKET_ERROR;
+#else
+		current_bytes_written = writev (s, iov, (int)iov_count);
+#endif
+		if (ipc_retry_syscall (current_bytes_written))
+			continue;
+		continue_send = current_bytes_written != DS_IPC_SOCKET_ERROR;
+		if (!continue_send)
+			break;
+		total_bytes_written += current_bytes_written;
+
+		// Skip the segments (or the part of a segment) that have been sent.
+		while (current_bytes_written > 0 && buffer_index < buffer_count) {
+			uint32_t remaining = buffers [buffer_index].buffer_len - buffer_offset;
+			if ((ssize_t)remaining <= current_bytes_written) {
+				current_bytes_written -= remaining;
+				buffer_index++;
+				buffer_offset = 0;
+			} else {
+				buffer_offset += (uint32_t)current_bytes_written;
+				current_bytes_written = 0;
+			}
+		}
+	}
+	DS_EXIT_BLOCKING_PAL_SECTION;
+
+	*bytes_written = total_bytes_written;
+	return continue_send;
+}
+
 /*
  * DiagnosticsIpc.
  */
@@ -1451,6 +1543,50 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static
+bool
+ipc_stream_write_vector_func (
+	void *object,
+	const IpcStreamBuffer *buffers,
+	uint32_t buffer_count,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms)
+{
+	EP_ASSERT (object != NULL);
+	EP_ASSERT (buffers != NULL);
+	EP_ASSERT (bytes_written != NULL);
+
+	bool success = false;
+	DiagnosticsIpcStream *ipc_stream = (DiagnosticsIpcStream *)object;
+	ssize_t total_bytes_written = 0;
+
+	if (timeout_ms != DS_IPC_TIMEOUT_INFINITE) {
+		ds_ipc_pollfd_t pfd;
+		pfd.fd = ipc_stream->client_socket;
+		pfd.events = POLLOUT;
+
+		int result_poll;
+		result_poll = ipc_poll_fds (&pfd, 1, timeout_ms);
+		if (result_poll <= 0 || !(pfd.revents & POLLOUT)) {
+			// timeout or error
+			ep_raise_error ();
+		}
+		// else fallthrough
+	}
+
+	success = ipc_socket_send_vector (ipc_stream->client_socket, buffers, buffer_count, &total_bytes_written);
+	ep_raise_error_if_nok (success == true);
+
+ep_on_exit:
+	*bytes_written = (uint32_t)total_bytes_written;
+	return success;
+
+ep_on_error:
+	total_bytes_written = 0;
+	success = false;
+	ep_exit_error_handler ();
+}
+
 static
 bool
 ipc_stream_flush_func (void *object)
@@ -1473,7 +1609,8 @@ static IpcStreamVtable ipc_stream_vtable = {
 	ipc_stream_read_func,
 	ipc_stream_write_func,
 	ipc_stream_flush_func,
-	ipc_stream_close_func };
+	ipc_stream_close_func,
+	ipc_stream_write_vector_func };
 
 static
 DiagnosticsIpcStream *
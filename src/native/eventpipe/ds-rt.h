@@ -71,6 +71,10 @@ static
 ds_ipc_result_t
 ds_rt_generate_core_dump (DiagnosticsDumpCommandId commandId, DiagnosticsGenerateCoreDumpCommandPayload *payload, ep_char8_t *errorMessageBuffer, int32_t cbErrorMessageBuffer);
 
+static
+ds_ipc_result_t
+ds_rt_generate_heap_snapshot (DiagnosticsGenerateHeapSnapshotCommandPayload *payload, DiagnosticsHeapSnapshotWriter *writer);
+
 /*
  * DiagnosticsIpc.
  */
@@ -22,6 +22,18 @@ static ep_rt_wait_event_handle_t _server_resume_runtime_startup_event = { 0 };
 static bool _server_disabled = false;
 static volatile bool _is_paused_for_startup = false;
 
+// Accepted streams are handed to a small pool of worker threads so one slow
+// command (dump, profiler attach, session setup) doesn't block other tools.
+#define DS_SERVER_WORKER_COUNT 4
+#define DS_SERVER_WORK_QUEUE_SIZE 32
+
+static ep_rt_spin_lock_handle_t _server_work_queue_lock = { 0 };
+static ep_rt_wait_event_handle_t _server_work_available_event = { 0 };
+static DiagnosticsIpcStream *_server_work_queue [DS_SERVER_WORK_QUEUE_SIZE];
+static uint32_t _server_work_queue_head = 0;
+static uint32_t _server_work_queue_count = 0;
+static uint32_t _server_worker_count = 0;
+
 static
 inline
 bool
@@ -66,6 +78,26 @@ server_protocol_helper_unknown_command (
 	DiagnosticsIpcMessage *message,
 	DiagnosticsIpcStream *stream);
 
+static
+void
+server_handle_stream (DiagnosticsIpcStream *stream);
+
+static
+bool
+server_work_queue_init (void);
+
+static
+bool
+server_work_queue_try_push (DiagnosticsIpcStream *stream);
+
+static
+DiagnosticsIpcStream *
+server_work_queue_try_pop (void);
+
+static
+void
+server_workers_start (void);
+
 /*
  * DiagnosticServer.
  */
@@ -112,6 +144,169 @@ server_warning_callback (
 	DS_LOG_WARNING_2 ("warning (%d): %s.", code, message);
 }
 
+static
+void
+server_handle_stream (DiagnosticsIpcStream *stream)
+{
+	EP_ASSERT (stream != NULL);
+
+	DiagnosticsIpcMessage message;
+	if (!ds_ipc_message_init (&message)) {
+		ds_ipc_stream_free (stream);
+		return;
+	}
+
+	if (!ds_ipc_message_initialize_stream (&message, stream)) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_BAD_ENCODING);
+		ds_ipc_stream_free (stream);
+		ep_raise_error ();
+	}
+
+	if (ep_rt_utf8_string_compare (
+		(const ep_char8_t *)ds_ipc_header_get_magic_ref (ds_ipc_message_get_header_ref (&message)),
+		(const ep_char8_t *)DOTNET_IPC_V1_MAGIC) != 0) {
+
+		ds_ipc_message_send_error (stream, DS_IPC_E_UNKNOWN_MAGIC);
+		ds_ipc_stream_free (stream);
+		ep_raise_error ();
+	}
+
+	DS_LOG_INFO_2 ("DiagnosticServer - received IPC message with command set (%d) and command id (%d)", ds_ipc_header_get_commandset (ds_ipc_message_get_header_ref (&message)), ds_ipc_header_get_commandid (ds_ipc_message_get_header_ref (&message)));
+
+	switch ((DiagnosticsServerCommandSet)ds_ipc_header_get_commandset (ds_ipc_message_get_header_ref (&message))) {
+	case DS_SERVER_COMMANDSET_EVENTPIPE:
+		ds_eventpipe_protocol_helper_handle_ipc_message (&message, stream);
+		break;
+	case DS_SERVER_COMMANDSET_DUMP:
+		ds_dump_protocol_helper_handle_ipc_message (&message, stream);
+		break;
+	case DS_SERVER_COMMANDSET_PROCESS:
+		ds_process_protocol_helper_handle_ipc_message (&message, stream);
+		break;
+	case DS_SERVER_COMMANDSET_PROFILER:
+		ds_profiler_protocol_helper_handle_ipc_message (&message, stream);
+		break;
+	default:
+		server_protocol_helper_unknown_command (&message, stream);
+		break;
+	}
+
+ep_on_exit:
+	ds_ipc_message_fini (&message);
+	return;
+
+ep_on_error:
+	ep_exit_error_handler ();
+}
+
+static
+bool
+server_work_queue_init (void)
+{
+	ep_rt_spin_lock_alloc (&_server_work_queue_lock);
+	ep_return_false_if_nok (ep_rt_spin_lock_is_valid (&_server_work_queue_lock));
+
+	// Auto reset, a set event wakes exactly one worker.
+	ep_rt_wait_event_alloc (&_server_work_available_event, false, false);
+	if (!ep_rt_wait_event_is_valid (&_server_work_available_event)) {
+		ep_rt_spin_lock_free (&_server_work_queue_lock);
+		return false;
+	}
+
+	return true;
+}
+
+static
+bool
+server_work_queue_try_push (DiagnosticsIpcStream *stream)
+{
+	EP_ASSERT (stream != NULL);
+
+	bool result = false;
+
+	EP_SPIN_LOCK_ENTER (&_server_work_queue_lock, section1)
+		if (_server_work_queue_count < DS_SERVER_WORK_QUEUE_SIZE) {
+			_server_work_queue [(_server_work_queue_head + _server_work_queue_count) % DS_SERVER_WORK_QUEUE_SIZE] = stream;
+			_server_work_queue_count++;
+			result = true;
+		}
+	EP_SPIN_LOCK_EXIT (&_server_work_queue_lock, section1)
+
+	if (result)
+		ep_rt_wait_event_set (&_server_work_available_event);
+
+ep_on_exit:
+	return result;
+
+ep_on_error:
+	result = false;
+	ep_exit_error_handler ();
+}
+
+static
+DiagnosticsIpcStream *
+server_work_queue_try_pop (void)
+{
+	DiagnosticsIpcStream *stream = NULL;
+	bool more_work = false;
+
+	EP_SPIN_LOCK_ENTER (&_server_work_queue_lock, section1)
+		if (_server_work_queue_count > 0) {
+			stream = _server_work_queue [_server_work_queue_head];
+			_server_work_queue_head = (_server_work_queue_head + 1) % DS_SERVER_WORK_QUEUE_SIZE;
+			_server_work_queue_count--;
+			more_work = _server_work_queue_count > 0;
+		}
+	EP_SPIN_LOCK_EXIT (&_server_work_queue_lock, section1)
+
+	// The event only wakes one worker, pass the wake up along if work remains.
+	if (more_work)
+		ep_rt_wait_event_set (&_server_work_available_event);
+
+ep_on_exit:
+	return stream;
+
+ep_on_error:
+	stream = NULL;
+	ep_exit_error_handler ();
+}
+
+EP_RT_DEFINE_THREAD_FUNC (server_worker_thread)
+{
+	ep_rt_set_server_name();
+
+	while (!server_volatile_load_shutting_down_state ()) {
+		DiagnosticsIpcStream *stream = server_work_queue_try_pop ();
+		if (!stream) {
+			ep_rt_wait_event_wait (&_server_work_available_event, EP_INFINITE_WAIT, false);
+			continue;
+		}
+
+		server_handle_stream (stream);
+	}
+
+	return (ep_rt_thread_start_func_return_t)0;
+}
+
+static
+void
+server_workers_start (void)
+{
+	if (!server_work_queue_init ()) {
+		DS_LOG_WARNING_0 ("Failed to initialize diagnostic server work queue, commands will be handled serially.");
+		return;
+	}
+
+	for (uint32_t i = 0; i < DS_SERVER_WORKER_COUNT; ++i) {
+		ep_rt_thread_id_t thread_id = ep_rt_uint64_t_to_thread_id_t (0);
+		if (!ep_rt_thread_create ((void *)server_worker_thread, NULL, EP_THREAD_TYPE_SERVER, (void *)&thread_id)) {
+			DS_LOG_WARNING_1 ("Failed to create diagnostic server worker thread (%d).", ep_rt_get_last_error ());
+			break;
+		}
+		_server_worker_count++;
+	}
+}
+
 EP_RT_DEFINE_THREAD_FUNC (server_thread)
 {
 	EP_ASSERT (server_volatile_load_shutting_down_state () || ds_ipc_stream_factory_has_active_ports ());
@@ -125,6 +320,8 @@ EP_RT_DEFINE_THREAD_FUNC (server_thread)
 		return 1;
 	}
 
+	server_workers_start ();
+
 	while (!server_volatile_load_shutting_down_state ()) {
 		DiagnosticsIpcStream *stream = ds_ipc_stream_factory_get_next_available_stream (server_warning_callback);
 		if (!stream)
@@ -132,48 +329,11 @@ EP_RT_DEFINE_THREAD_FUNC (server_thread)
 
 		ds_rt_auto_trace_signal ();
 
-		DiagnosticsIpcMessage message;
-		if (!ds_ipc_message_init (&message))
-			continue;
-
-		if (!ds_ipc_message_initialize_stream (&message, stream)) {
-			ds_ipc_message_send_error (stream, DS_IPC_E_BAD_ENCODING);
-			ds_ipc_stream_free (stream);
-			ds_ipc_message_fini (&message);
-			continue;
-		}
-
-		if (ep_rt_utf8_string_compare (
-			(const ep_char8_t *)ds_ipc_header_get_magic_ref (ds_ipc_message_get_header_ref (&message)),
-			(const ep_char8_t *)DOTNET_IPC_V1_MAGIC) != 0) {
-
-			ds_ipc_message_send_error (stream, DS_IPC_E_UNKNOWN_MAGIC);
-			ds_ipc_stream_free (stream);
-			ds_ipc_message_fini (&message);
-			continue;
-		}
-
-		DS_LOG_INFO_2 ("DiagnosticServer - received IPC message with command set (%d) and command id (%d)", ds_ipc_header_get_commandset (ds_ipc_message_get_header_ref (&message)), ds_ipc_header_get_commandid (ds_ipc_message_get_header_ref (&message)));
-
-		switch ((DiagnosticsServerCommandSet)ds_ipc_header_get_commandset (ds_ipc_message_get_header_ref (&message))) {
-		case DS_SERVER_COMMANDSET_EVENTPIPE:
-			ds_eventpipe_protocol_helper_handle_ipc_message (&message, stream);
-			break;
-		case DS_SERVER_COMMANDSET_DUMP:
-			ds_dump_protocol_helper_handle_ipc_message (&message, stream);
-			break;
-		case DS_SERVER_COMMANDSET_PROCESS:
-			ds_process_protocol_helper_handle_ipc_message (&message, stream);
-			break;
-		case DS_SERVER_COMMANDSET_PROFILER:
-			ds_profiler_protocol_helper_handle_ipc_message (&message, stream);
-			break;
-		default:
-			server_protocol_helper_unknown_command (&message, stream);
-			break;
-		}
-
-		ds_ipc_message_fini (&message);
+		// ResumeRuntime applies to the port the last stream came from, so while any port
+		// still holds startup, commands are handled in order on this thread. A full queue
+		// also falls back to inline handling, back pressuring the listener.
+		if (_server_worker_count == 0 || ds_ipc_stream_factory_any_suspended_ports () || !server_work_queue_try_push (stream))
+			server_handle_stream (stream);
 	}
 
 	return (ep_rt_thread_start_func_return_t)0;
@@ -245,6 +405,10 @@ ds_server_shutdown (void)
 {
 	server_volatile_store_shutting_down_state (true);
 
+	// Wake idle workers so they observe the shutdown state.
+	if (ep_rt_wait_event_is_valid (&_server_work_available_event))
+		ep_rt_wait_event_set (&_server_work_available_event);
+
 	if (ds_ipc_stream_factory_has_active_ports ())
 		ds_ipc_stream_factory_shutdown (server_error_callback_close);
 
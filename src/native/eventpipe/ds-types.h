@@ -21,6 +21,8 @@ typedef struct _DiagnosticsConnectPort DiagnosticsConnectPort;
 typedef struct _DiagnosticsEnvironmentInfoPayload DiagnosticsEnvironmentInfoPayload;
 typedef struct _DiagnosticsGenerateCoreDumpCommandPayload DiagnosticsGenerateCoreDumpCommandPayload;
 typedef struct _DiagnosticsGenerateCoreDumpResponsePayload DiagnosticsGenerateCoreDumpResponsePayload;
+typedef struct _DiagnosticsGenerateHeapSnapshotCommandPayload DiagnosticsGenerateHeapSnapshotCommandPayload;
+typedef struct _DiagnosticsHeapSnapshotWriter DiagnosticsHeapSnapshotWriter;
 typedef struct _DiagnosticsSetEnvironmentVariablePayload DiagnosticsSetEnvironmentVariablePayload;
 typedef struct _DiagnosticsGetEnvironmentVariablePayload DiagnosticsGetEnvironmentVariablePayload;
 typedef struct _DiagnosticsEnablePerfmapPayload DiagnosticsEnablePerfmapPayload;
@@ -49,6 +51,7 @@ typedef enum {
 	DS_DUMP_COMMANDID_GENERATE_CORE_DUMP = 0x01,
 	DS_DUMP_COMMANDID_GENERATE_CORE_DUMP2 = 0x02,
 	DS_DUMP_COMMANDID_GENERATE_CORE_DUMP3 = 0x03,
+	DS_DUMP_COMMANDID_GENERATE_HEAP_SNAPSHOT = 0x04,
 	// future
 } DiagnosticsDumpCommandId;
 
@@ -10,6 +10,8 @@
 #include "ep-file.h"
 #include "ep-rt.h"
 
+#define EP_MIN(a,b) (((a) < (b)) ? (a) : (b))
+
 /*
  * Forward declares of all static functions.
  */
@@ -62,6 +64,23 @@ static
 uint32_t
 block_base_get_header_size_func (void *object);
 
+static
+uint32_t
+block_lz4_compress (
+	const uint8_t *src,
+	uint32_t src_len,
+	uint8_t *dst,
+	uint32_t dst_capacity,
+	uint32_t *hash_table);
+
+static
+void
+block_fast_serialize_payload (
+	EventPipeBlock *block,
+	FastSerializer *fast_serializer,
+	const uint8_t *payload,
+	uint32_t payload_size);
+
 static
 const ep_char8_t *
 event_block_get_type_name_func (void *object);
@@ -323,7 +342,22 @@ ep_block_fast_serialize (
 
 	ep_return_void_if_nok (block->block != NULL);
 
-	uint32_t data_size = ep_block_get_bytes_written (block);
+	block_fast_serialize_payload (block, fast_serializer, block->block, ep_block_get_bytes_written (block));
+}
+
+static
+void
+block_fast_serialize_payload (
+	EventPipeBlock *block,
+	FastSerializer *fast_serializer,
+	const uint8_t *payload,
+	uint32_t payload_size)
+{
+	EP_ASSERT (block != NULL);
+	EP_ASSERT (fast_serializer != NULL);
+	EP_ASSERT (payload != NULL);
+
+	uint32_t data_size = payload_size;
 	EP_ASSERT (data_size != 0);
 
 	uint32_t header_size =  ep_block_get_header_size_vcall (block);
@@ -341,7 +375,126 @@ ep_block_fast_serialize (
 	}
 
 	ep_block_serialize_header_vcall (block, fast_serializer);
-	ep_fast_serializer_write_buffer (fast_serializer, block->block, data_size);
+	ep_fast_serializer_write_buffer (fast_serializer, payload, data_size);
+}
+
+/*
+ * LZ4 block compression.
+ */
+
+#define BLOCK_LZ4_MIN_MATCH 4
+#define BLOCK_LZ4_LAST_LITERALS 5
+#define BLOCK_LZ4_MATCH_FIND_LIMIT 12
+#define BLOCK_LZ4_MAX_OFFSET 65535
+#define BLOCK_LZ4_HASH_LOG 12
+
+static
+inline
+uint32_t
+block_lz4_read_uint32 (const uint8_t *src)
+{
+	uint32_t value;
+	memcpy (&value, src, sizeof (value));
+	return value;
+}
+
+static
+inline
+uint8_t *
+block_lz4_write_length (
+	uint8_t *write_pointer,
+	uint32_t length)
+{
+	while (length >= 255) {
+		*write_pointer++ = 255;
+		length -= 255;
+	}
+	*write_pointer++ = (uint8_t)length;
+	return write_pointer;
+}
+
+// Compresses src into dst using the LZ4 block format (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md),
+// a greedy single probe match finder, trading ratio for speed. Returns the compressed size, or 0 if the result
+// doesn't fit in dst_capacity bytes.
+static
+uint32_t
+block_lz4_compress (
+	const uint8_t *src,
+	uint32_t src_len,
+	uint8_t *dst,
+	uint32_t dst_capacity,
+	uint32_t *hash_table)
+{
+	EP_ASSERT (src != NULL);
+	EP_ASSERT (dst != NULL);
+	EP_ASSERT (hash_table != NULL);
+
+	uint8_t *write_pointer = dst;
+	const uint8_t *dst_end = dst + dst_capacity;
+	uint32_t anchor = 0;
+	uint32_t current = 0;
+
+	memset (hash_table, 0, sizeof (uint32_t) << BLOCK_LZ4_HASH_LOG);
+
+	if (src_len > BLOCK_LZ4_MATCH_FIND_LIMIT) {
+		// The last match must start at least 12 bytes before the end of the block
+		// and the last 5 bytes are always literals.
+		const uint32_t match_find_limit = src_len - BLOCK_LZ4_MATCH_FIND_LIMIT;
+		const uint32_t match_limit = src_len - BLOCK_LZ4_LAST_LITERALS;
+
+		while (current <= match_find_limit) {
+			uint32_t sequence = block_lz4_read_uint32 (src + current);
+			uint32_t hash = (sequence * 2654435761U) >> (32 - BLOCK_LZ4_HASH_LOG);
+			uint32_t candidate = hash_table [hash];
+			hash_table [hash] = current;
+
+			if (candidate >= current || current - candidate > BLOCK_LZ4_MAX_OFFSET || block_lz4_read_uint32 (src + candidate) != sequence) {
+				current++;
+				continue;
+			}
+
+			uint32_t match_len = BLOCK_LZ4_MIN_MATCH;
+			while (current + match_len < match_limit && src [candidate + match_len] == src [current + match_len])
+				match_len++;
+
+			// token + literal length + literals + offset + match length.
+			uint32_t literal_len = current - anchor;
+			if ((size_t)(dst_end - write_pointer) < 1 + (literal_len / 255 + 1) + literal_len + 2 + ((match_len - BLOCK_LZ4_MIN_MATCH) / 255 + 1))
+				return 0;
+
+			uint8_t *token = write_pointer++;
+			*token = (uint8_t)(EP_MIN (literal_len, 15) << 4);
+			if (literal_len >= 15)
+				write_pointer = block_lz4_write_length (write_pointer, literal_len - 15);
+			memcpy (write_pointer, src + anchor, literal_len);
+			write_pointer += literal_len;
+
+			uint16_t offset = (uint16_t)(current - candidate);
+			*write_pointer++ = (uint8_t)offset;
+			*write_pointer++ = (uint8_t)(offset >> 8);
+
+			uint32_t encoded_match_len = match_len - BLOCK_LZ4_MIN_MATCH;
+			*token |= (uint8_t)EP_MIN (encoded_match_len, 15);
+			if (encoded_match_len >= 15)
+				write_pointer = block_lz4_write_length (write_pointer, encoded_match_len - 15);
+
+			current += match_len;
+			anchor = current;
+		}
+	}
+
+	// Last sequence, literals only.
+	uint32_t literal_len = src_len - anchor;
+	if ((size_t)(dst_end - write_pointer) < 1 + (literal_len / 255 + 1) + literal_len)
+		return 0;
+
+	*write_pointer++ = (uint8_t)(EP_MIN (literal_len, 15) << 4);
+	if (literal_len >= 15)
+		write_pointer = block_lz4_write_length (write_pointer, literal_len - 15);
+	memcpy (write_pointer, src + anchor, literal_len);
+	write_pointer += literal_len;
+
+	return (uint32_t)(write_pointer - dst);
 }
 
 /*
@@ -357,7 +510,23 @@ block_base_fast_serialize_func (
 	EP_ASSERT (object != NULL);
 	EP_ASSERT (fast_serializer != NULL);
 
-	ep_block_fast_serialize (&((EventPipeEventBlockBase *)object)->block, fast_serializer);
+	EventPipeEventBlockBase *event_block_base = (EventPipeEventBlockBase *)object;
+	EventPipeBlock *block = &event_block_base->block;
+	ep_return_void_if_nok (block->block != NULL);
+
+	uint32_t data_size = ep_block_get_bytes_written (block);
+	event_block_base->compressed_block_size = 0;
+
+	// Only keep the compressed payload if it's smaller, including the extra header field.
+	if (event_block_base->compressed_block != NULL && data_size > sizeof (uint32_t))
+		event_block_base->compressed_block_size = block_lz4_compress (block->block, data_size, event_block_base->compressed_block, data_size - sizeof (uint32_t), event_block_base->compression_hash_table);
+
+	if (event_block_base->compressed_block_size != 0)
+		block_fast_serialize_payload (block, fast_serializer, event_block_base->compressed_block, event_block_base->compressed_block_size);
+	else
+		block_fast_serialize_payload (block, fast_serializer, block->block, data_size);
+
+	event_block_base->compressed_block_size = 0;
 }
 
 static
@@ -441,6 +610,9 @@ ep_event_block_base_init (
 		format) != NULL);
 
 	event_block_base->use_header_compression = use_header_compression;
+	event_block_base->compressed_block = NULL;
+	event_block_base->compression_hash_table = NULL;
+	event_block_base->compressed_block_size = 0;
 
 	memset (event_block_base->compressed_header, 0, ARRAY_SIZE (event_block_base->compressed_header));
 	ep_event_block_base_clear (event_block_base);
@@ -458,9 +630,37 @@ void
 ep_event_block_base_fini (EventPipeEventBlockBase *event_block_base)
 {
 	ep_return_void_if_nok (event_block_base != NULL);
+	ep_rt_byte_array_free (event_block_base->compressed_block);
+	ep_rt_object_array_free (event_block_base->compression_hash_table);
 	ep_block_fini (&event_block_base->block);
 }
 
+bool
+ep_event_block_base_enable_block_compression (EventPipeEventBlockBase *event_block_base)
+{
+	EP_ASSERT (event_block_base != NULL);
+
+	EventPipeBlock *block = &event_block_base->block;
+	ep_return_false_if_nok (block->format >= EP_SERIALIZATION_FORMAT_NETTRACE_V4);
+	if (event_block_base->compressed_block != NULL)
+		return true;
+
+	uint32_t max_block_size = (uint32_t)(block->end_of_the_buffer - block->block);
+
+	event_block_base->compression_hash_table = ep_rt_object_array_alloc (uint32_t, (size_t)1 << BLOCK_LZ4_HASH_LOG);
+	ep_raise_error_if_nok (event_block_base->compression_hash_table != NULL);
+
+	event_block_base->compressed_block = ep_rt_byte_array_alloc (max_block_size);
+	ep_raise_error_if_nok (event_block_base->compressed_block != NULL);
+
+	return true;
+
+ep_on_error:
+	ep_rt_object_array_free (event_block_base->compression_hash_table);
+	event_block_base->compression_hash_table = NULL;
+	return false;
+}
+
 void
 ep_event_block_base_clear (EventPipeEventBlockBase *event_block_base)
 {
@@ -482,7 +682,8 @@ ep_event_block_base_get_header_size (const EventPipeEventBlockBase *event_block_
 	return	sizeof(uint16_t) + // header size
 			sizeof(uint16_t) + // flags
 			sizeof(ep_timestamp_t)  + // min timestamp
-			sizeof(ep_timestamp_t);   // max timestamp
+			sizeof(ep_timestamp_t) + // max timestamp
+			(event_block_base->compressed_block_size != 0 ? sizeof(uint32_t) : 0); // uncompressed size
 }
 
 void
@@ -498,7 +699,9 @@ ep_event_block_base_serialize_header (
 	const uint16_t header_size = (uint16_t)ep_block_get_header_size_vcall ((EventPipeBlock *)event_block_base);
 	ep_fast_serializer_write_uint16_t (fast_serializer, header_size);
 
-	const uint16_t flags = event_block_base->use_header_compression ? 1 : 0;
+	uint16_t flags = event_block_base->use_header_compression ? EP_EVENT_BLOCK_FLAG_HEADER_COMPRESSION : 0;
+	if (event_block_base->compressed_block_size != 0)
+		flags |= EP_EVENT_BLOCK_FLAG_LZ4_COMPRESSION;
 	ep_fast_serializer_write_uint16_t (fast_serializer, flags);
 
 	ep_timestamp_t min_timestamp = event_block_base->min_timestamp;
@@ -506,6 +709,9 @@ ep_event_block_base_serialize_header (
 
 	ep_timestamp_t max_timestamp = event_block_base->max_timestamp;
 	ep_fast_serializer_write_int64_t (fast_serializer, max_timestamp);
+
+	if (event_block_base->compressed_block_size != 0)
+		ep_fast_serializer_write_uint32_t (fast_serializer, ep_block_get_bytes_written ((EventPipeBlock *)event_block_base));
 }
 
 bool
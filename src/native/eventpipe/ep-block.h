@@ -129,6 +129,12 @@ struct _EventPipeEventHeader {
  * EventPipeEventBlockBase
  */
 
+// Flags written in the header of blocks that contain events.
+#define EP_EVENT_BLOCK_FLAG_HEADER_COMPRESSION 0x1
+// The block payload is LZ4 block compressed and the header ends with the uncompressed payload size.
+// Only used when the session negotiated it, see ep_event_block_base_enable_block_compression.
+#define EP_EVENT_BLOCK_FLAG_LZ4_COMPRESSION 0x2
+
 // The base type for blocks that contain events (EventBlock and EventMetadataBlock).
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_BLOCK_GETTER_SETTER)
 struct _EventPipeEventBlockBase {
@@ -140,6 +146,11 @@ struct _EventPipeEventBlockBase_Internal {
 	uint8_t compressed_header [100];
 	ep_timestamp_t min_timestamp;
 	ep_timestamp_t max_timestamp;
+	// Scratch buffers for block compression, NULL unless enabled.
+	uint8_t *compressed_block;
+	uint32_t *compression_hash_table;
+	// Size of the compressed payload of the block being serialized, 0 if it is sent uncompressed.
+	uint32_t compressed_block_size;
 	bool use_header_compression;
 };
 
@@ -172,6 +183,10 @@ ep_event_block_base_fini (EventPipeEventBlockBase *event_block_base);
 void
 ep_event_block_base_clear (EventPipeEventBlockBase *event_block_base);
 
+// Serialize the block payload LZ4 compressed whenever that makes it smaller.
+bool
+ep_event_block_base_enable_block_compression (EventPipeEventBlockBase *event_block_base);
+
 uint32_t
 ep_event_block_base_get_header_size (const EventPipeEventBlockBase *event_block_base);
 
@@ -26,6 +26,13 @@ static
 void
 buffer_list_fini (EventPipeBufferList *buffer_list);
 
+static
+EventPipeBuffer *
+buffer_list_compare_exchange_tail (
+	EventPipeBufferList *buffer_list,
+	EventPipeBuffer *expected,
+	EventPipeBuffer *value);
+
 // _Requires_lock_held (buffer_manager)
 static
 bool
@@ -131,6 +138,18 @@ buffer_manager_try_convert_buffer_to_read_only (
  * EventPipeBufferList.
  */
 
+static
+inline
+EventPipeBuffer *
+buffer_list_compare_exchange_tail (
+	EventPipeBufferList *buffer_list,
+	EventPipeBuffer *expected,
+	EventPipeBuffer *value)
+{
+	// The runtime abstraction only exposes a size_t sized CAS, pointers have the same size on all supported targets.
+	return (EventPipeBuffer *)ep_rt_atomic_compare_exchange_size_t ((volatile size_t *)&buffer_list->tail_buffer, (size_t)expected, (size_t)value);
+}
+
 static
 void
 buffer_list_fini (EventPipeBufferList *buffer_list)
@@ -201,26 +220,32 @@ ep_buffer_list_insert_tail (
 	ep_return_void_if_nok (buffer_list != NULL);
 
 	EP_ASSERT (buffer != NULL);
-	EP_ASSERT (ep_buffer_list_ensure_consistency (buffer_list));
+
+	// NOTE: ep_buffer_list_ensure_consistency is not checked here, the reader
+	// could be removing and freeing buffers while the owning thread walks the list.
 
 	// Ensure that the input buffer didn't come from another list that was improperly cleaned up.
 	EP_ASSERT ((ep_buffer_get_next_buffer (buffer) == NULL) && (ep_buffer_get_prev_buffer (buffer) == NULL));
 
-	// First node in the list.
-	if (buffer_list->tail_buffer == NULL) {
-		buffer_list->head_buffer = buffer_list->tail_buffer = buffer;
-	} else {
-		// Set links between the old and new tail nodes.
-		ep_buffer_set_next_buffer (buffer_list->tail_buffer, buffer);
-		ep_buffer_set_prev_buffer (buffer, buffer_list->tail_buffer);
-
-		// Set the new tail node.
-		buffer_list->tail_buffer = buffer;
-	}
-
-	buffer_list->buffer_count++;
+	// The list is a single producer/single consumer queue. Only the thread owning the list appends
+	// buffers and only the reader thread removes them, so no lock is needed. The count is raised
+	// before the buffer is published so the reader never observes more nodes than buffer_count.
+	ep_rt_atomic_inc_uint32_t (&buffer_list->buffer_count);
 
-	EP_ASSERT (ep_buffer_list_ensure_consistency (buffer_list));
+	// Claim the tail slot. The only other party updating tail_buffer is the reader, when it
+	// removes the last buffer in the list and resets tail_buffer to NULL.
+	EventPipeBuffer *prev_tail;
+	do {
+		prev_tail = (EventPipeBuffer *)ep_rt_volatile_load_ptr ((volatile void **)&buffer_list->tail_buffer);
+		ep_buffer_set_prev_buffer (buffer, prev_tail);
+	} while (buffer_list_compare_exchange_tail (buffer_list, prev_tail, buffer) != prev_tail);
+
+	// Publish the buffer to the reader. Once the tail slot is claimed, the reader won't
+	// free prev_tail until it observes the link to the new buffer.
+	if (prev_tail == NULL)
+		ep_rt_volatile_store_ptr ((volatile void **)&buffer_list->head_buffer, buffer);
+	else
+		ep_buffer_set_volatile_next_buffer (prev_tail, buffer);
 }
 
 EventPipeBuffer *
@@ -230,31 +255,35 @@ ep_buffer_list_get_and_remove_head (EventPipeBufferList *buffer_list)
 
 	EP_ASSERT (ep_buffer_list_ensure_consistency (buffer_list));
 
-	EventPipeBuffer *ret_buffer = NULL;
-	if (buffer_list->head_buffer != NULL)
+	EventPipeBuffer *ret_buffer = (EventPipeBuffer *)ep_rt_volatile_load_ptr ((volatile void **)&buffer_list->head_buffer);
+	if (ret_buffer != NULL)
 	{
-		// Save the head node.
-		ret_buffer = buffer_list->head_buffer;
-
-		// Set the new head node.
-		buffer_list->head_buffer = ep_buffer_get_next_buffer (buffer_list->head_buffer);
+		EventPipeBuffer *next_buffer = ep_buffer_get_volatile_next_buffer (ret_buffer);
+		if (next_buffer == NULL) {
+			// This looks like the last buffer in the list. Clear the head before releasing the
+			// tail slot, the writer sets the head again if it appends to the emptied list.
+			ep_rt_volatile_store_ptr ((volatile void **)&buffer_list->head_buffer, NULL);
+			if (buffer_list_compare_exchange_tail (buffer_list, ret_buffer, NULL) != ret_buffer) {
+				// The writer claimed the tail slot after ret_buffer but hasn't linked it yet.
+				// This window is a handful of instructions so just wait for the link.
+				do {
+					next_buffer = ep_buffer_get_volatile_next_buffer (ret_buffer);
+				} while (next_buffer == NULL);
+			}
+		}
 
-		// Update the head node's previous pointer.
-		if (buffer_list->head_buffer != NULL)
-			ep_buffer_set_prev_buffer (buffer_list->head_buffer, NULL);
-		else
-			// We just removed the last buffer from the list.
-			// Make sure both head and tail pointers are NULL.
-			buffer_list->tail_buffer = NULL;
+		if (next_buffer != NULL) {
+			// Set the new head node and update its previous pointer.
+			ep_buffer_set_prev_buffer (next_buffer, NULL);
+			ep_rt_volatile_store_ptr ((volatile void **)&buffer_list->head_buffer, next_buffer);
+		}
 
-		// Clear the next pointer of the old head node.
+		// Clear the links of the old head node so it has no dangling references.
 		ep_buffer_set_next_buffer (ret_buffer, NULL);
-
-		// Ensure that the old head node has no dangling references.
-		EP_ASSERT ((ep_buffer_get_next_buffer (ret_buffer) == NULL) && (ep_buffer_get_prev_buffer (ret_buffer) == NULL));
+		ep_buffer_set_prev_buffer (ret_buffer, NULL);
 
 		// Decrement the count of buffers in the list.
-		buffer_list->buffer_count--;
+		ep_rt_atomic_dec_uint32_t (&buffer_list->buffer_count);
 	}
 
 	EP_ASSERT (ep_buffer_list_ensure_consistency (buffer_list));
@@ -304,55 +333,33 @@ buffer_manager_release_buffer(
 bool
 ep_buffer_list_ensure_consistency (EventPipeBufferList *buffer_list)
 {
-	// Either the head and tail nodes are both NULL or both are non-NULL.
-	EP_ASSERT ((buffer_list->head_buffer == NULL && buffer_list->tail_buffer == NULL) ||
-		(buffer_list->head_buffer != NULL && buffer_list->tail_buffer != NULL));
-
-	// If the list is NULL, check the count and return.
-	if (buffer_list->head_buffer == NULL) {
-		EP_ASSERT (buffer_list->buffer_count == 0);
+	// The owning thread can append buffers concurrently, so only the reader side of the
+	// list is checked. tail_buffer may be ahead of what a forward walk observes.
+	EventPipeBuffer *iterator = (EventPipeBuffer *)ep_rt_volatile_load_ptr ((volatile void **)&buffer_list->head_buffer);
+	if (iterator == NULL)
 		return true;
-	}
 
-	// If the list is non-NULL, walk the list forward until we get to the end.
-	uint32_t node_count = (buffer_list->head_buffer != NULL) ? 1 : 0;
-	EventPipeBuffer *iterator = buffer_list->head_buffer;
-	while (ep_buffer_get_next_buffer (iterator) != NULL) {
-		iterator = ep_buffer_get_next_buffer (iterator);
+	// The head node never has a previous node.
+	EP_ASSERT (ep_buffer_get_prev_buffer (iterator) == NULL);
+
+	// Walk the list forward until we get to the end.
+	uint32_t node_count = 1;
+	EventPipeBuffer *next_buffer = ep_buffer_get_volatile_next_buffer (iterator);
+	while (next_buffer != NULL) {
+		EP_ASSERT (ep_buffer_get_prev_buffer (next_buffer) == iterator);
+		iterator = next_buffer;
 		node_count++;
 
 		// Check for consistency of the buffer itself.
 		// NOTE: We can't check the last buffer because the owning thread could
 		// be writing to it, which could result in false asserts.
-		if (ep_buffer_get_next_buffer (iterator) != NULL)
+		next_buffer = ep_buffer_get_volatile_next_buffer (iterator);
+		if (next_buffer != NULL)
 			EP_ASSERT (ep_buffer_ensure_consistency (iterator));
-
-		// Check for cycles.
-		EP_ASSERT (node_count <= buffer_list->buffer_count);
-	}
-
-	// When we're done with the walk, pIter must point to the tail node.
-	EP_ASSERT (iterator == buffer_list->tail_buffer);
-
-	// Node count must equal the buffer count.
-	EP_ASSERT (node_count == buffer_list->buffer_count);
-
-	// Now, walk the list in reverse.
-	iterator = buffer_list->tail_buffer;
-	node_count = (buffer_list->tail_buffer != NULL) ? 1 : 0;
-	while (ep_buffer_get_prev_buffer (iterator) != NULL) {
-		iterator = ep_buffer_get_prev_buffer (iterator);
-		node_count++;
-
-		// Check for cycles.
-		EP_ASSERT (node_count <= buffer_list->buffer_count);
 	}
 
-	// When we're done with the reverse walk, pIter must point to the head node.
-	EP_ASSERT (iterator == buffer_list->head_buffer);
-
-	// Node count must equal the buffer count.
-	EP_ASSERT (node_count == buffer_list->buffer_count);
+	// buffer_count is raised before a buffer is published, so it bounds the walk (no cycles).
+	EP_ASSERT (node_count <= ep_rt_volatile_load_uint32_t (&buffer_list->buffer_count));
 
 	// We're done.
 	return true;
@@ -496,41 +503,47 @@ buffer_manager_allocate_buffer_for_thread (
 	new_buffer = ep_buffer_alloc (buffer_size, ep_thread_session_state_get_thread (thread_session_state), sequence_number);
 	ep_raise_error_if_nok (new_buffer != NULL);
 
-	// Adding a buffer to the buffer list requires us to take the lock.
-	EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section1)
-		thread_buffer_list = ep_thread_session_state_get_buffer_list (thread_session_state);
-		if (thread_buffer_list == NULL) {
+	// Registering the thread session state with the buffer manager on first use requires the lock.
+	// The buffer list is only created and read here by the owning thread, so checking it is lock free.
+	if (ep_thread_session_state_get_buffer_list (thread_session_state) == NULL) {
+		EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section1)
 			thread_buffer_list = ep_buffer_list_alloc (buffer_manager, ep_thread_session_state_get_thread (thread_session_state));
 			ep_raise_error_if_nok_holding_spin_lock (thread_buffer_list != NULL, section1);
 
 			ep_raise_error_if_nok_holding_spin_lock (dn_list_push_back (buffer_manager->thread_session_state_list, thread_session_state), section1);
 			ep_thread_session_state_set_buffer_list (thread_session_state, thread_buffer_list);
 			thread_buffer_list = NULL;
-		}
+		EP_SPIN_LOCK_EXIT (&buffer_manager->rt_lock, section1)
+	}
 
-		if (buffer_manager->sequence_point_alloc_budget != 0) {
-			// sequence point bookkeeping
-			if (buffer_size >= buffer_manager->remaining_sequence_point_alloc_budget) {
-				sequence_point = ep_sequence_point_alloc ();
-				if (sequence_point) {
+	if (buffer_manager->sequence_point_alloc_budget != 0) {
+		// sequence point bookkeeping, only the allocation exhausting the budget creates a sequence point.
+		bool create_sequence_point;
+		size_t old_budget;
+		size_t new_budget;
+		do {
+			old_budget = buffer_manager->remaining_sequence_point_alloc_budget;
+			create_sequence_point = buffer_size >= old_budget;
+			new_budget = create_sequence_point ? buffer_manager->sequence_point_alloc_budget : old_budget - buffer_size;
+		} while (ep_rt_atomic_compare_exchange_size_t (&buffer_manager->remaining_sequence_point_alloc_budget, old_budget, new_budget) != old_budget);
+
+		if (create_sequence_point) {
+			sequence_point = ep_sequence_point_alloc ();
+			if (sequence_point) {
+				EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section2)
 					buffer_manager_init_sequence_point_thread_list (buffer_manager, sequence_point);
-					ep_raise_error_if_nok_holding_spin_lock (buffer_manager_enqueue_sequence_point (buffer_manager, sequence_point), section1);
+					ep_raise_error_if_nok_holding_spin_lock (buffer_manager_enqueue_sequence_point (buffer_manager, sequence_point), section2);
 					sequence_point = NULL;
-				}
-				buffer_manager->remaining_sequence_point_alloc_budget = buffer_manager->sequence_point_alloc_budget;
-			} else {
-				buffer_manager->remaining_sequence_point_alloc_budget -= buffer_size;
+				EP_SPIN_LOCK_EXIT (&buffer_manager->rt_lock, section2)
 			}
 		}
+	}
 #ifdef EP_CHECKED_BUILD
-		buffer_manager->num_buffers_allocated++;
+	ep_rt_atomic_inc_uint32_t (&buffer_manager->num_buffers_allocated);
 #endif // EP_CHECKED_BUILD
 
-		// Set the buffer on the thread.
-		if (new_buffer != NULL)
-			ep_buffer_list_insert_tail (ep_thread_session_state_get_buffer_list (thread_session_state), new_buffer);
-
-	EP_SPIN_LOCK_EXIT (&buffer_manager->rt_lock, section1)
+	// Set the buffer on the thread, this hands it off to the reader without taking the lock.
+	ep_buffer_list_insert_tail (ep_thread_session_state_get_buffer_list (thread_session_state), new_buffer);
 
 ep_on_exit:
 
@@ -563,7 +576,7 @@ buffer_manager_deallocate_buffer (
 		buffer_manager_release_buffer(buffer_manager, ep_buffer_get_size (buffer));
 		ep_buffer_free (buffer);
 #ifdef EP_CHECKED_BUILD
-		buffer_manager->num_buffers_allocated--;
+		ep_rt_atomic_dec_uint32_t (&buffer_manager->num_buffers_allocated);
 #endif
 	}
 }
@@ -606,7 +619,7 @@ buffer_manager_move_next_event_any_thread (
 		EventPipeBuffer *buffer;
 		DN_LIST_FOREACH_BEGIN (EventPipeThreadSessionState *, thread_session_state, buffer_manager->thread_session_state_list) {
 			buffer_list = ep_thread_session_state_get_buffer_list (thread_session_state);
-			buffer = buffer_list->head_buffer;
+			buffer = (EventPipeBuffer *)ep_rt_volatile_load_ptr ((volatile void **)&buffer_list->head_buffer);
 			if (buffer && ep_buffer_get_creation_timestamp (buffer) < stop_timestamp) {
 				dn_vector_ptr_push_back (&buffer_list_array, buffer_list);
 				dn_vector_ptr_push_back (&buffer_array, buffer);
@@ -728,20 +741,18 @@ buffer_manager_advance_to_non_empty_buffer (
 			// found a non-empty buffer
 			done = true;
 		} else {
-			EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section1)
-				// delete the empty buffer
-				EventPipeBuffer *removed_buffer = ep_buffer_list_get_and_remove_head (buffer_list);
-				EP_ASSERT (current_buffer == removed_buffer);
-				buffer_manager_deallocate_buffer (buffer_manager, removed_buffer);
-
-				// get the next buffer
-				current_buffer = buffer_list->head_buffer;
-				if (!current_buffer || ep_buffer_get_creation_timestamp (current_buffer) >= before_timestamp) {
-					// no more buffers in the list before this timestamp, we're done
-					current_buffer = NULL;
-					done = true;
-				}
-			EP_SPIN_LOCK_EXIT (&buffer_manager->rt_lock, section1)
+			// delete the empty buffer, the reader is the only consumer of the list so this doesn't need the lock
+			EventPipeBuffer *removed_buffer = ep_buffer_list_get_and_remove_head (buffer_list);
+			EP_ASSERT (current_buffer == removed_buffer);
+			buffer_manager_deallocate_buffer (buffer_manager, removed_buffer);
+
+			// get the next buffer
+			current_buffer = (EventPipeBuffer *)ep_rt_volatile_load_ptr ((volatile void **)&buffer_list->head_buffer);
+			if (!current_buffer || ep_buffer_get_creation_timestamp (current_buffer) >= before_timestamp) {
+				// no more buffers in the list before this timestamp, we're done
+				current_buffer = NULL;
+				done = true;
+			}
 		}
 	}
 
@@ -1284,7 +1295,7 @@ ep_buffer_manager_write_all_buffers_to_file_v4 (
 					it = dn_list_it_next (it);
 
 					// if a session_state was exhausted during this sequence point, mark it for deletion
-					if (ep_thread_session_state_get_buffer_list (session_state)->head_buffer == NULL) {
+					if (ep_rt_volatile_load_ptr ((volatile void **)&ep_thread_session_state_get_buffer_list (session_state)->head_buffer) == NULL) {
 
 						// We don't hold the thread lock here, so it technically races with a thread getting unregistered. This is okay,
 						// because we will either not have passed the above if statement (there were events still in the buffers) or we
@@ -27,10 +27,12 @@ struct _EventPipeBufferList_Internal {
 	EventPipeBufferManager *manager;
 	// Buffers are stored in an intrusive linked-list from oldest to newest.
 	// Head is the oldest buffer. Tail is the newest (and currently used) buffer.
-	EventPipeBuffer *head_buffer;
-	EventPipeBuffer *tail_buffer;
+	// The list is a single producer/single consumer queue, buffers are appended
+	// by the owning thread and removed by the reader thread without taking a lock.
+	EventPipeBuffer * volatile head_buffer;
+	EventPipeBuffer * volatile tail_buffer;
 	// The number of buffers in the list.
-	uint32_t buffer_count;
+	volatile uint32_t buffer_count;
 	// The sequence number of the last event that was read, only
 	// updated/read by the reader thread.
 	uint32_t last_read_sequence_number;
@@ -104,7 +106,8 @@ struct _EventPipeBufferManager_Internal {
 	dn_list_t *sequence_points;
 	// Event for synchronizing real time reading.
 	ep_rt_wait_event_handle_t rt_wait_event;
-	// Lock to protect access to the per-thread buffer list and total allocation size.
+	// Lock to protect access to the thread session state list and the sequence point queue.
+	// The per-thread buffer lists are updated without it, see ep_buffer_list_insert_tail.
 	ep_rt_spin_lock_handle_t rt_lock;
 	// The session this buffer manager belongs to.
 	EventPipeSession *session;
@@ -121,7 +124,7 @@ struct _EventPipeBufferManager_Internal {
 	size_t max_size_of_all_buffers;
 	// The amount of allocations we can do at this moment before
 	// triggering a sequence point
-	size_t remaining_sequence_point_alloc_budget;
+	volatile size_t remaining_sequence_point_alloc_budget;
 	// The total amount of allocations we can do after one sequence
 	// point before triggering the next one
 	size_t sequence_point_alloc_budget;
@@ -133,7 +136,7 @@ struct _EventPipeBufferManager_Internal {
 	volatile int64_t num_events_stored;
 	volatile int64_t num_events_dropped;
 	int64_t num_events_written;
-	uint32_t num_buffers_allocated;
+	volatile uint32_t num_buffers_allocated;
 	uint32_t num_buffers_stolen;
 	uint32_t num_buffers_leaked;
 #endif
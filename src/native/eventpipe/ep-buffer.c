@@ -185,6 +185,22 @@ ep_buffer_get_volatile_state (const EventPipeBuffer *buffer)
 	return (EventPipeBufferState)ep_rt_volatile_load_uint32_t (&buffer->state);
 }
 
+EventPipeBuffer *
+ep_buffer_get_volatile_next_buffer (const EventPipeBuffer *buffer)
+{
+	EP_ASSERT (buffer != NULL);
+	return (EventPipeBuffer *)ep_rt_volatile_load_ptr ((volatile void **)&buffer->next_buffer);
+}
+
+void
+ep_buffer_set_volatile_next_buffer (
+	EventPipeBuffer *buffer,
+	EventPipeBuffer *next_buffer)
+{
+	EP_ASSERT (buffer != NULL);
+	ep_rt_volatile_store_ptr ((volatile void **)&buffer->next_buffer, next_buffer);
+}
+
 void
 ep_buffer_convert_to_read_only (EventPipeBuffer *buffer)
 {
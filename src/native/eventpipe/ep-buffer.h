@@ -55,6 +55,8 @@ struct _EventPipeBuffer_Internal {
 	EventPipeEventInstance *current_read_event;
 	// Each buffer will become part of a per-thread linked list of buffers.
 	// The linked list is invasive, thus we declare the pointers here.
+	// next_buffer is published by the writer thread and consumed by the
+	// reader thread without a lock, see ep_buffer_list_insert_tail.
 	EventPipeBuffer *prev_buffer;
 	EventPipeBuffer *next_buffer;
 	// State transition WRITABLE -> READ_ONLY only occurs while holding the writer_thread->rt_lock;
@@ -145,6 +147,16 @@ ep_buffer_get_current_sequence_number (const EventPipeBuffer *buffer);
 EventPipeBufferState
 ep_buffer_get_volatile_state (const EventPipeBuffer *buffer);
 
+// Get/set the next buffer link with acquire/release semantics. Used to hand off
+// buffers from the writer thread to the reader thread without a lock.
+EventPipeBuffer *
+ep_buffer_get_volatile_next_buffer (const EventPipeBuffer *buffer);
+
+void
+ep_buffer_set_volatile_next_buffer (
+	EventPipeBuffer *buffer,
+	EventPipeBuffer *next_buffer);
+
 // Convert the buffer writable to readable.
 // _Requires_lock_held (thread)
 void
@@ -79,6 +79,8 @@ struct _EventPipeEventPayload {
 
 EP_DEFINE_GETTER(EventPipeEventPayload *, event_payload, uint8_t *, data)
 EP_DEFINE_GETTER(EventPipeEventPayload *, event_payload, uint32_t, size)
+EP_DEFINE_GETTER(EventPipeEventPayload *, event_payload, EventData *, event_data)
+EP_DEFINE_GETTER(EventPipeEventPayload *, event_payload, uint32_t, event_data_len)
 
 static
 inline
@@ -113,6 +115,15 @@ ep_event_payload_copy_data (
 	EventPipeEventPayload *event_payload,
 	uint8_t *dst);
 
+// Copy len bytes starting at offset into dst without flattening the payload.
+// Returns false if the range is outside of the payload.
+bool
+ep_event_payload_try_read_data (
+	EventPipeEventPayload *event_payload,
+	uint32_t offset,
+	uint8_t *dst,
+	uint32_t len);
+
 // If the data is stored only as an array of EventData objects,
 // create a flat buffer and copy into it
 void
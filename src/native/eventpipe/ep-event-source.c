@@ -64,6 +64,10 @@ static
 void
 event_source_fini (EventPipeEventSource *event_source);
 
+static
+bool
+event_source_add_event_aggregate_event (EventPipeEventSource *event_source);
+
 /*
  * EventPipeEventSource.
  */
@@ -75,6 +79,97 @@ event_source_fini (EventPipeEventSource *event_source)
 	ep_delete_provider (event_source->provider);
 }
 
+static
+bool
+event_source_add_event_aggregate_event (EventPipeEventSource *event_source)
+{
+	EP_ASSERT (event_source != NULL);
+
+	// Payload layout is documented in ep-session.c, session_aggregator_write_summary.
+	const ep_char8_t *param_names [] = {
+		"ProviderName",
+		"EventID",
+		"Key",
+		"IntervalStart",
+		"IntervalEnd",
+		"Count",
+		"Sum",
+		"Min",
+		"Max",
+		"Histogram" };
+
+	const EventPipeParameterType param_types [] = {
+		EP_PARAMETER_TYPE_STRING,
+		EP_PARAMETER_TYPE_UINT32,
+		EP_PARAMETER_TYPE_UINT32,
+		EP_PARAMETER_TYPE_INT64,
+		EP_PARAMETER_TYPE_INT64,
+		EP_PARAMETER_TYPE_UINT64,
+		EP_PARAMETER_TYPE_UINT64,
+		EP_PARAMETER_TYPE_UINT64,
+		EP_PARAMETER_TYPE_UINT64,
+		EP_PARAMETER_TYPE_ARRAY };
+
+	EP_ASSERT (ARRAY_SIZE (param_names) == ARRAY_SIZE (param_types));
+
+	bool result = false;
+	ep_char16_t *param_names_utf16 [ARRAY_SIZE (param_names)] = { 0 };
+	ep_char16_t *event_name_utf16 = NULL;
+	uint8_t *metadata = NULL;
+
+	EventPipeParameterDesc params [ARRAY_SIZE (param_names)];
+	for (uint32_t i = 0; i < ARRAY_SIZE (param_names); ++i) {
+		param_names_utf16 [i] = ep_rt_utf8_to_utf16le_string (param_names [i]);
+		ep_raise_error_if_nok (param_names_utf16 [i] != NULL);
+		if (param_types [i] == EP_PARAMETER_TYPE_ARRAY)
+			ep_parameter_desc_init_array (&params [i], EP_PARAMETER_TYPE_UINT64, param_names_utf16 [i]);
+		else
+			ep_parameter_desc_init (&params [i], param_types [i], param_names_utf16 [i]);
+	}
+
+	event_name_utf16 = ep_rt_utf8_to_utf16le_string ("EventAggregate");
+	ep_raise_error_if_nok (event_name_utf16 != NULL);
+
+	size_t metadata_len;
+	metadata_len = 0;
+	metadata = ep_metadata_generator_generate_event_metadata (
+		2,		/* eventID */
+		event_name_utf16,
+		0,		/* keywords */
+		1,		/* version */
+		EP_EVENT_LEVEL_LOGALWAYS,
+		0,		/* opcode */
+		params,
+		(uint32_t)ARRAY_SIZE (params),
+		&metadata_len);
+
+	ep_raise_error_if_nok (metadata != NULL);
+
+	event_source->event_aggregate_event = ep_provider_add_event (
+		event_source->provider,
+		2,		/* eventID */
+		0,		/* keywords */
+		0,		/* eventVersion */
+		EP_EVENT_LEVEL_LOGALWAYS,
+		false,  /* needStack */
+		metadata,
+		(uint32_t)metadata_len);
+
+	ep_raise_error_if_nok (event_source->event_aggregate_event != NULL);
+
+	result = true;
+
+ep_on_exit:
+	ep_rt_byte_array_free (metadata);
+	ep_rt_utf16_string_free (event_name_utf16);
+	for (uint32_t i = 0; i < ARRAY_SIZE (param_names); ++i)
+		ep_rt_utf16_string_free (param_names_utf16 [i]);
+	return result;
+
+ep_on_error:
+	ep_exit_error_handler ();
+}
+
 EventPipeEventSource *
 ep_event_source_alloc (void)
 {
@@ -155,6 +250,8 @@ ep_event_source_init (EventPipeEventSource *event_source)
 
 	ep_raise_error_if_nok (event_source->process_info_event);
 
+	ep_raise_error_if_nok (event_source_add_event_aggregate_event (event_source));
+
 ep_on_exit:
 	// Delete the metadata after the event is created.
 	// The metadata blob will be copied into EventPipe-owned memory.
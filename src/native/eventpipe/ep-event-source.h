@@ -29,6 +29,8 @@ struct _EventPipeEventSource_Internal {
 	EventPipeProvider *provider;
 	const ep_char8_t *process_info_event_name;
 	EventPipeEvent *process_info_event;
+	// Summary written by sessions aggregating events instead of writing them.
+	EventPipeEvent *event_aggregate_event;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_EVENT_SOURCE_GETTER_SETTER)
@@ -37,6 +39,9 @@ struct _EventPipeEventSource {
 };
 #endif
 
+EP_DEFINE_GETTER(EventPipeEventSource *, event_source, EventPipeProvider *, provider)
+EP_DEFINE_GETTER(EventPipeEventSource *, event_source, EventPipeEvent *, event_aggregate_event)
+
 static
 inline
 const ep_char8_t *
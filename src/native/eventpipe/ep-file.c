@@ -28,11 +28,6 @@ static
 void
 file_free_func (void *object);
 
-static
-void
-DN_CALLBACK_CALLTYPE
-stack_hash_value_free_func (void *entry);
-
 static
 uint32_t
 file_get_stack_id (
@@ -49,6 +44,12 @@ file_get_metadata_id (
 	EventPipeFile *file,
 	EventPipeEvent *ep_event);
 
+static
+void
+file_track_stack_ips (
+	EventPipeFile *file,
+	EventPipeStackContentsInstance *stack_contents);
+
 static
 void
 file_write_event_to_block (
@@ -77,13 +78,21 @@ file_get_file_minimum_version (EventPipeSerializationFormat format);
 
 static
 uint32_t
-DN_CALLBACK_CALLTYPE
-stack_hash_key_hash_func (const void *key);
+stack_intern_table_find_child (
+	const StackInternTable *table,
+	uint32_t parent,
+	uintptr_t ip);
+
+static
+uint32_t
+stack_intern_table_add_child (
+	StackInternTable *table,
+	uint32_t parent,
+	uintptr_t ip);
 
 static
 bool
-DN_CALLBACK_CALLTYPE
-stack_hash_key_equal_func (const void *key1, const void *key2);
+stack_intern_table_reserve (StackInternTable *table);
 
 /*
  * EventPipeFile.
@@ -130,14 +139,6 @@ file_vtable = {
 	file_fast_serialize_func,
 	file_get_type_name_func };
 
-static
-void
-DN_CALLBACK_CALLTYPE
-stack_hash_value_free_func (void *entry)
-{
-	ep_stack_hash_entry_free ((StackHashEntry *)entry);
-}
-
 static
 void
 file_write_end (EventPipeFile *file)
@@ -163,22 +164,16 @@ file_get_stack_id (
 	EP_ASSERT (file->format >= EP_SERIALIZATION_FORMAT_NETTRACE_V4);
 	EP_ASSERT (file->stack_block != NULL);
 
-	uint32_t stack_id = 0;
 	EventPipeStackContentsInstance *stack_contents = ep_event_instance_get_stack_contents_instance_ref (event_instance);
 	EventPipeStackBlock *stack_block = file->stack_block;
-	dn_umap_t *stack_hash = file->stack_hash;
-	StackHashKey key;
-	ep_stack_hash_key_init (&key, stack_contents);
-	dn_umap_it_t found = dn_umap_find (stack_hash, &key);
-	if (dn_umap_it_end (found)) {
-		stack_id = file->stack_id_counter + 1;
+
+	bool added = false;
+	uint32_t stack_id = ep_stack_intern_table_get_or_add (&file->stack_intern_table, stack_contents, file->stack_id_counter + 1, &added);
+	if (added) {
 		file->stack_id_counter = stack_id;
-		StackHashEntry *entry = ep_stack_hash_entry_alloc (stack_contents, stack_id, ep_stack_hash_key_get_hash (&key));
-		if (entry) {
-			if (!dn_umap_insert (stack_hash, ep_stack_hash_entry_get_key_ref (entry), entry).result)
-				ep_stack_hash_entry_free (entry);
-			entry = NULL;
-		}
+
+		if (file->stack_ips != NULL)
+			file_track_stack_ips (file, stack_contents);
 
 		if (!ep_stack_block_write_stack (stack_block, stack_id, stack_contents)) {
 			// we can't write this stack to the current block (it's full)
@@ -188,14 +183,28 @@ file_get_stack_id (
 			if (!result)
 				EP_UNREACHABLE ("Should never fail to add event to a clear block. If we do the max size is too small.");
 		}
-	} else {
-		stack_id = ep_stack_hash_entry_get_id (dn_umap_it_value_t (found, StackHashEntry *));
 	}
 
-	ep_stack_hash_key_fini (&key);
 	return stack_id;
 }
 
+static
+void
+file_track_stack_ips (
+	EventPipeFile *file,
+	EventPipeStackContentsInstance *stack_contents)
+{
+	EP_ASSERT (file != NULL);
+	EP_ASSERT (file->stack_ips != NULL);
+	EP_ASSERT (stack_contents != NULL);
+
+	// Only called for stacks new since the last sequence point, so most frames are already known.
+	uint32_t frame_count = ep_stack_contents_instance_get_next_available_frame (stack_contents);
+	const uintptr_t *frames = ep_stack_contents_instance_get_stack_frames_cref (stack_contents);
+	for (uint32_t i = 0; i < frame_count; ++i)
+		dn_umap_insert (file->stack_ips, (void *)frames [i], NULL);
+}
+
 static
 uint32_t
 file_get_metadata_id (
@@ -313,11 +322,6 @@ ep_file_alloc (
 	StreamWriter *stream_writer,
 	EventPipeSerializationFormat format)
 {
-	dn_umap_custom_alloc_params_t params = {0, };
-	params.hash_func = stack_hash_key_hash_func;
-	params.equal_func = stack_hash_key_equal_func;
-	params.value_dispose_func = stack_hash_value_free_func;
-
 	EventPipeFile *instance = ep_rt_object_alloc (EventPipeFile);
 	ep_raise_error_if_nok (instance != NULL);
 
@@ -354,8 +358,7 @@ ep_file_alloc (
 	instance->metadata_ids = dn_umap_alloc ();
 	ep_raise_error_if_nok (instance->metadata_ids != NULL);
 
-	instance->stack_hash = dn_umap_custom_alloc (&params);
-	ep_raise_error_if_nok (instance->stack_hash != NULL);
+	ep_stack_intern_table_init (&instance->stack_intern_table);
 
 	// Start at 0 - The value is always incremented prior to use, so the first ID will be 1.
 	ep_rt_volatile_store_uint32_t (&instance->metadata_id_counter, 0);
@@ -391,7 +394,8 @@ ep_file_free (EventPipeFile *file)
 	ep_stack_block_free (file->stack_block);
 	ep_fast_serializer_free (file->fast_serializer);
 	dn_umap_free (file->metadata_ids);
-	dn_umap_free (file->stack_hash);
+	dn_umap_free (file->stack_ips);
+	ep_stack_intern_table_fini (&file->stack_intern_table);
 
 	// If file has not been initialized, stream_writer ownership
 	// have not been passed along and needs to be freed by file.
@@ -430,6 +434,30 @@ ep_file_initialize_file (EventPipeFile *file)
 	return success;
 }
 
+bool
+ep_file_enable_block_compression (EventPipeFile *file)
+{
+	EP_ASSERT (file != NULL);
+
+	ep_return_false_if_nok (file->format >= EP_SERIALIZATION_FORMAT_NETTRACE_V4);
+
+	return ep_event_block_base_enable_block_compression ((EventPipeEventBlockBase *)file->event_block) &&
+		ep_event_block_base_enable_block_compression ((EventPipeEventBlockBase *)file->metadata_block);
+}
+
+bool
+ep_file_enable_stack_ip_tracking (EventPipeFile *file)
+{
+	EP_ASSERT (file != NULL);
+
+	ep_return_false_if_nok (file->format >= EP_SERIALIZATION_FORMAT_NETTRACE_V4);
+
+	if (file->stack_ips == NULL)
+		file->stack_ips = dn_umap_alloc ();
+
+	return file->stack_ips != NULL;
+}
+
 void
 ep_file_write_event (
 	EventPipeFile *file,
@@ -501,7 +529,7 @@ ep_file_write_sequence_point (
 
 	// stack cache resets on sequence points
 	file->stack_id_counter = 0;
-	dn_umap_clear (file->stack_hash);
+	ep_stack_intern_table_clear (&file->stack_intern_table);
 
 ep_on_exit:
 	return;
@@ -543,110 +571,207 @@ ep_file_flush (
 }
 
 /*
- * StackHashEntry.
+ * StackInternTable.
  */
 
-StackHashKey *
-ep_stack_hash_entry_get_key (StackHashEntry *stack_hash_entry)
+#define STACK_INTERN_TABLE_INITIAL_NODE_CAPACITY 1024
+
+static
+inline
+uint32_t
+stack_intern_table_hash (
+	uint32_t parent,
+	uintptr_t ip)
 {
-	return ep_stack_hash_entry_get_key_ref (stack_hash_entry);
+	uint64_t value = (uint64_t)ip ^ ((uint64_t)parent * 0x9E3779B97F4A7C15ULL);
+	value ^= value >> 29;
+	value *= 0xBF58476D1CE4E5B9ULL;
+	value ^= value >> 32;
+	return (uint32_t)value;
 }
 
-StackHashEntry *
-ep_stack_hash_entry_alloc (
-	const EventPipeStackContentsInstance *stack_contents,
-	uint32_t id,
-	uint32_t hash)
+static
+uint32_t
+stack_intern_table_find_child (
+	const StackInternTable *table,
+	uint32_t parent,
+	uintptr_t ip)
 {
-	EP_ASSERT (stack_contents != NULL);
+	EP_ASSERT (table != NULL);
 
-	uint32_t stack_size = ep_stack_contents_instance_get_size (stack_contents);
-	StackHashEntry *entry = (StackHashEntry *)ep_rt_byte_array_alloc (offsetof (StackHashEntry, stack_bytes) + stack_size);
-	ep_raise_error_if_nok (entry != NULL);
+	ep_return_zero_if_nok (table->index != NULL);
 
-	entry->id = id;
-	entry->key.hash = hash;
-	entry->key.stack_size_in_bytes = stack_size;
-	entry->key.stack_bytes = entry->stack_bytes;
-	memcpy (entry->stack_bytes, ep_stack_contents_instance_get_pointer (stack_contents), stack_size);
+	uint32_t mask = table->index_capacity - 1;
+	uint32_t slot = stack_intern_table_hash (parent, ip) & mask;
+	for (;;) {
+		uint32_t node_id = table->index [slot];
+		if (node_id == 0)
+			return 0;
 
-ep_on_exit:
-	return entry;
+		const StackInternNode *node = &table->nodes [node_id - 1];
+		if (node->parent == parent && node->ip == ip)
+			return node_id;
 
-ep_on_error:
-	ep_stack_hash_entry_free (entry);
-	entry = NULL;
-	ep_exit_error_handler ();
+		slot = (slot + 1) & mask;
+	}
 }
 
-void
-ep_stack_hash_entry_free (StackHashEntry *stack_hash_entry)
+static
+bool
+stack_intern_table_reserve (StackInternTable *table)
 {
-	ep_return_void_if_nok (stack_hash_entry != NULL);
-	ep_rt_byte_array_free ((uint8_t *)stack_hash_entry);
-}
+	EP_ASSERT (table != NULL);
 
-/*
- * StackHashKey.
- */
+	StackInternNode *nodes = NULL;
+	uint32_t *index = NULL;
 
-static
-inline
-uint32_t
-hash_bytes (const uint8_t *data, size_t data_len)
-{
-	EP_ASSERT (data != NULL);
+	if (table->node_count == table->node_capacity) {
+		uint32_t node_capacity = table->node_capacity == 0 ? STACK_INTERN_TABLE_INITIAL_NODE_CAPACITY : table->node_capacity * 2;
+		ep_raise_error_if_nok (node_capacity > table->node_capacity);
+
+		nodes = ep_rt_object_array_alloc (StackInternNode, node_capacity);
+		ep_raise_error_if_nok (nodes != NULL);
+
+		if (table->node_count != 0)
+			memcpy (nodes, table->nodes, table->node_count * sizeof (StackInternNode));
+		ep_rt_object_array_free (table->nodes);
+		table->nodes = nodes;
+		table->node_capacity = node_capacity;
+		nodes = NULL;
+	}
+
+	// Rebuild the index from the nodes when it gets over half full, node ids don't change.
+	if ((table->node_count + 1) * 2 > table->index_capacity) {
+		uint32_t index_capacity = table->index_capacity == 0 ? STACK_INTERN_TABLE_INITIAL_NODE_CAPACITY * 2 : table->index_capacity * 2;
+		ep_raise_error_if_nok (index_capacity > table->index_capacity);
+
+		index = ep_rt_object_array_alloc (uint32_t, index_capacity);
+		ep_raise_error_if_nok (index != NULL);
 
-	uint32_t hash = 5381;
-	const uint8_t *data_end = data + data_len;
-	for (/**/ ; data < data_end; data++)
-		hash = ((hash << 5) + hash) ^ *data;
-	return hash;
+		uint32_t mask = index_capacity - 1;
+		for (uint32_t i = 0; i < table->node_count; ++i) {
+			uint32_t slot = stack_intern_table_hash (table->nodes [i].parent, table->nodes [i].ip) & mask;
+			while (index [slot] != 0)
+				slot = (slot + 1) & mask;
+			index [slot] = i + 1;
+		}
+
+		ep_rt_object_array_free (table->index);
+		table->index = index;
+		table->index_capacity = index_capacity;
+	}
+
+	return true;
+
+ep_on_error:
+	return false;
 }
 
 static
 uint32_t
-DN_CALLBACK_CALLTYPE
-stack_hash_key_hash_func (const void *key)
+stack_intern_table_add_child (
+	StackInternTable *table,
+	uint32_t parent,
+	uintptr_t ip)
 {
-	EP_ASSERT (key != NULL);
-	return ((const StackHashKey *)key)->hash;
+	EP_ASSERT (table != NULL);
+	EP_ASSERT (stack_intern_table_find_child (table, parent, ip) == 0);
+
+	ep_return_zero_if_nok (stack_intern_table_reserve (table));
+
+	uint32_t node_id = table->node_count + 1;
+	StackInternNode *node = &table->nodes [node_id - 1];
+	node->ip = ip;
+	node->parent = parent;
+	node->stack_id = 0;
+	table->node_count = node_id;
+
+	uint32_t mask = table->index_capacity - 1;
+	uint32_t slot = stack_intern_table_hash (parent, ip) & mask;
+	while (table->index [slot] != 0)
+		slot = (slot + 1) & mask;
+	table->index [slot] = node_id;
+
+	return node_id;
 }
 
-static
-bool
-DN_CALLBACK_CALLTYPE
-stack_hash_key_equal_func (const void *key1, const void *key2)
+StackInternTable *
+ep_stack_intern_table_init (StackInternTable *table)
 {
-	EP_ASSERT (key1 != NULL);
-	EP_ASSERT (key2 != NULL);
+	EP_ASSERT (table != NULL);
 
-	const StackHashKey * stack_hash_key1 = (const StackHashKey *)key1;
-	const StackHashKey * stack_hash_key2 = (const StackHashKey *)key2;
+	// Storage is allocated on first use, NetPerf files never intern stacks.
+	table->nodes = NULL;
+	table->index = NULL;
+	table->node_count = 0;
+	table->node_capacity = 0;
+	table->index_capacity = 0;
+	table->empty_stack_id = 0;
 
-	return stack_hash_key1->stack_size_in_bytes == stack_hash_key2->stack_size_in_bytes &&
-		!memcmp (stack_hash_key1->stack_bytes, stack_hash_key2->stack_bytes, stack_hash_key1->stack_size_in_bytes);
+	return table;
 }
 
-StackHashKey *
-ep_stack_hash_key_init (
-	StackHashKey *key,
-	const EventPipeStackContentsInstance *stack_contents)
+void
+ep_stack_intern_table_fini (StackInternTable *table)
 {
-	EP_ASSERT (key != NULL);
-	EP_ASSERT (stack_contents != NULL);
-
-	key->stack_bytes = ep_stack_contents_instance_get_pointer (stack_contents);
-	key->stack_size_in_bytes = ep_stack_contents_instance_get_size (stack_contents);
-	key->hash = hash_bytes (key->stack_bytes, key->stack_size_in_bytes);
+	ep_return_void_if_nok (table != NULL);
 
-	return key;
+	ep_rt_object_array_free (table->nodes);
+	ep_rt_object_array_free (table->index);
+	ep_stack_intern_table_init (table);
 }
 
 void
-ep_stack_hash_key_fini (StackHashKey *key)
+ep_stack_intern_table_clear (StackInternTable *table)
 {
-	;
+	EP_ASSERT (table != NULL);
+
+	// Keep the storage, the next epoch likely interns as many stacks.
+	if (table->index != NULL)
+		memset (table->index, 0, table->index_capacity * sizeof (uint32_t));
+	table->node_count = 0;
+	table->empty_stack_id = 0;
+}
+
+uint32_t
+ep_stack_intern_table_get_or_add (
+	StackInternTable *table,
+	const EventPipeStackContentsInstance *stack_contents,
+	uint32_t new_stack_id,
+	bool *added)
+{
+	EP_ASSERT (table != NULL);
+	EP_ASSERT (stack_contents != NULL);
+	EP_ASSERT (new_stack_id != 0);
+	EP_ASSERT (added != NULL);
+
+	const uintptr_t *frames = (const uintptr_t *)ep_stack_contents_instance_get_pointer (stack_contents);
+	uint32_t frame_count = ep_stack_contents_instance_get_next_available_frame (stack_contents);
+
+	// Top of stack is at index 0, walk from the outermost frame so callers are shared.
+	uint32_t node_id = 0;
+	for (uint32_t i = frame_count; i > 0; --i) {
+		uint32_t child_id = stack_intern_table_find_child (table, node_id, frames [i - 1]);
+		if (child_id == 0) {
+			child_id = stack_intern_table_add_child (table, node_id, frames [i - 1]);
+			if (child_id == 0) {
+				// Out of memory, write the stack without interning it.
+				*added = true;
+				return new_stack_id;
+			}
+		}
+		node_id = child_id;
+	}
+
+	uint32_t *stack_id = node_id == 0 ? &table->empty_stack_id : &table->nodes [node_id - 1].stack_id;
+	if (*stack_id != 0) {
+		*added = false;
+		return *stack_id;
+	}
+
+	*stack_id = new_stack_id;
+	*added = true;
+	return new_stack_id;
 }
 
 #endif /* !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES) */
@@ -13,6 +13,53 @@
 #endif
 #include "ep-getter-setter.h"
 
+/*
+ * StackInternTable.
+ */
+
+#if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_FILE_GETTER_SETTER)
+struct _StackInternNode {
+#else
+struct _StackInternNode_Internal {
+#endif
+	uintptr_t ip;
+	// Node id of the calling frame, 0 for the outermost frame.
+	uint32_t parent;
+	// Id of the stack ending at this node, 0 if none was interned.
+	uint32_t stack_id;
+};
+
+#if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_FILE_GETTER_SETTER)
+struct _StackInternNode {
+	uint8_t _internal [sizeof (struct _StackInternNode_Internal)];
+};
+#endif
+
+// Trie of the stacks written since the last sequence point. Stacks are inserted starting
+// at the outermost frame, so stacks sharing callers share nodes and interning a stack only
+// costs one index probe per frame instead of hashing and copying the whole stack.
+#if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_FILE_GETTER_SETTER)
+struct _StackInternTable {
+#else
+struct _StackInternTable_Internal {
+#endif
+	// Nodes in insertion order, node id n is nodes [n - 1].
+	StackInternNode *nodes;
+	// Open addressed index from (parent, ip) to node id, 0 marks a free slot.
+	uint32_t *index;
+	uint32_t node_count;
+	uint32_t node_capacity;
+	// Always a power of 2, kept at most half full.
+	uint32_t index_capacity;
+	uint32_t empty_stack_id;
+};
+
+#if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_FILE_GETTER_SETTER)
+struct _StackInternTable {
+	uint8_t _internal [sizeof (struct _StackInternTable_Internal)];
+};
+#endif
+
 /*
  * EventPipeFile.
  */
@@ -35,7 +82,10 @@ struct _EventPipeFile_Internal {
 	EventPipeStackBlock *stack_block;
 	// Hashtable of metadata labels.
 	dn_umap_t *metadata_ids;
-	dn_umap_t *stack_hash;
+	StackInternTable stack_intern_table;
+	// Set of frame ips seen in written stacks, NULL unless stack ip tracking is enabled.
+	// Unlike stack_intern_table it isn't reset on sequence points.
+	dn_umap_t *stack_ips;
 	// The timestamp when the file was opened.  Used for calculating file-relative timestamps.
 	ep_timestamp_t file_open_timestamp;
 #ifdef EP_CHECKED_BUILD
@@ -60,6 +110,7 @@ struct _EventPipeFile {
 
 EP_DEFINE_GETTER(EventPipeFile *, file, FastSerializer *, fast_serializer)
 EP_DEFINE_GETTER(EventPipeFile *, file, EventPipeSerializationFormat, format)
+EP_DEFINE_GETTER(EventPipeFile *, file, dn_umap_t *, stack_ips)
 
 static
 inline
@@ -80,6 +131,14 @@ ep_file_free (EventPipeFile *file);
 bool
 ep_file_initialize_file (EventPipeFile *file);
 
+// Compress event and metadata blocks, requires a reader that understands EP_EVENT_BLOCK_FLAG_LZ4_COMPRESSION.
+bool
+ep_file_enable_block_compression (EventPipeFile *file);
+
+// Record the frames of every stack written to the file in ep_file_get_stack_ips.
+bool
+ep_file_enable_stack_ip_tracking (EventPipeFile *file);
+
 void
 ep_file_write_event (
 	EventPipeFile *file,
@@ -99,70 +158,26 @@ ep_file_flush (
 	EventPipeFileFlushFlags flags);
 
 /*
- * StackHashKey.
+ * StackInternTable.
  */
 
-#if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_FILE_GETTER_SETTER)
-struct _StackHashKey {
-#else
-struct _StackHashKey_Internal {
-#endif
-	uint8_t *stack_bytes;
-	uint32_t hash;
-	uint32_t stack_size_in_bytes;
-};
-
-#if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_FILE_GETTER_SETTER)
-struct _StackHashKey {
-	uint8_t _internal [sizeof (struct _StackHashKey_Internal)];
-};
-#endif
-
-EP_DEFINE_GETTER(StackHashKey *, stack_hash_key, uint32_t, hash)
-
-StackHashKey *
-ep_stack_hash_key_init (
-	StackHashKey *key,
-	const EventPipeStackContentsInstance *stack_contents);
+StackInternTable *
+ep_stack_intern_table_init (StackInternTable *table);
 
 void
-ep_stack_hash_key_fini (StackHashKey *key);
-
-/*
- * StackHashEntry.
- */
+ep_stack_intern_table_fini (StackInternTable *table);
 
-#if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_FILE_GETTER_SETTER)
-struct _StackHashEntry {
-#else
-struct _StackHashEntry_Internal {
-#endif
-	StackHashKey key;
-	uint32_t id;
-	// This is the first byte of StackSizeInBytes bytes of stack data
-	uint8_t stack_bytes[1];
-};
-
-#if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_FILE_GETTER_SETTER)
-struct _StackHashEntry {
-	uint8_t _internal [sizeof (struct _StackHashEntry_Internal)];
-};
-#endif
-
-EP_DEFINE_GETTER_REF(StackHashEntry *, stack_hash_entry, StackHashKey *, key)
-EP_DEFINE_GETTER(StackHashEntry *, stack_hash_entry, uint32_t, id)
-
-StackHashKey *
-ep_stack_hash_entry_get_key (StackHashEntry *stack_hash_entry);
+void
+ep_stack_intern_table_clear (StackInternTable *table);
 
-StackHashEntry *
-ep_stack_hash_entry_alloc (
+// Returns the id previously interned for the stack. Otherwise interns the stack
+// as new_stack_id, sets added and returns new_stack_id.
+uint32_t
+ep_stack_intern_table_get_or_add (
+	StackInternTable *table,
 	const EventPipeStackContentsInstance *stack_contents,
-	uint32_t id,
-	uint32_t hash);
-
-void
-ep_stack_hash_entry_free (StackHashEntry *stack_hash_entry);
+	uint32_t new_stack_id,
+	bool *added);
 
 #endif /* ENABLE_PERFTRACING */
 #endif /* __EVENTPIPE_FILE_H__ */
@@ -16,6 +16,7 @@ typedef char ep_char8_t;
  */
 
 typedef struct _IpcStream IpcStream;
+typedef struct _IpcStreamBuffer IpcStreamBuffer;
 typedef struct _IpcStreamVtable IpcStreamVtable;
 
 #endif /* ENABLE_PERFTRACING */
@@ -11,5 +11,15 @@
 
 #include "ep-ipc-pal-types-forward.h"
 
+/*
+ * IpcStreamBuffer.
+ */
+
+// One segment of a scatter/gather write, the memory is owned by the caller.
+struct _IpcStreamBuffer {
+	const uint8_t *buffer;
+	uint32_t buffer_len;
+};
+
 #endif /* ENABLE_PERFTRACING */
 #endif /* __EVENTPIPE_IPC_PAL_TYPES_H__ */
@@ -21,6 +21,7 @@ typedef bool (*IpcStreamReadFunc)(void *object, uint8_t *buffer, uint32_t bytes_
 typedef bool (*IpcStreamWriteFunc)(void *object, const uint8_t *buffer, uint32_t bytes_to_write, uint32_t *bytes_written, uint32_t timeout_ms);
 typedef bool (*IpcStreamFlushFunc)(void *object);
 typedef bool (*IpcStreamCloseFunc)(void *object);
+typedef bool (*IpcStreamWriteVectorFunc)(void *object, const IpcStreamBuffer *buffers, uint32_t buffer_count, uint32_t *bytes_written, uint32_t timeout_ms);
 
 struct _IpcStreamVtable {
 	IpcStreamFreeFunc free_func;
@@ -28,6 +29,8 @@ struct _IpcStreamVtable {
 	IpcStreamWriteFunc write_func;
 	IpcStreamFlushFunc flush_func;
 	IpcStreamCloseFunc close_func;
+	// Optional, streams without scatter/gather support fall back to write_func.
+	IpcStreamWriteVectorFunc write_vector_func;
 };
 
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_IPC_STREAM_GETTER_SETTER) || defined(DS_IMPL_IPC_PAL_NAMEDPIPE_GETTER_SETTER) || defined(DS_IMPL_IPC_PAL_SOCKET_GETTER_SETTER)
@@ -71,6 +74,14 @@ ep_ipc_stream_write_vcall (
 	uint32_t *bytes_written,
 	uint32_t timeout_ms);
 
+bool
+ep_ipc_stream_write_vector_vcall (
+	IpcStream *ipc_stream,
+	const IpcStreamBuffer *buffers,
+	uint32_t buffer_count,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms);
+
 bool
 ep_ipc_stream_flush_vcall (IpcStream *ipc_stream);
 
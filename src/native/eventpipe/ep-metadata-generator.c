@@ -358,6 +358,22 @@ ep_parameter_desc_init (
 	return parameter_desc;
 }
 
+EventPipeParameterDesc *
+ep_parameter_desc_init_array (
+	EventPipeParameterDesc *parameter_desc,
+	EventPipeParameterType element_type,
+	const ep_char16_t *name)
+{
+	EP_ASSERT (parameter_desc != NULL);
+	EP_ASSERT (element_type != EP_PARAMETER_TYPE_ARRAY);
+
+	parameter_desc->type = EP_PARAMETER_TYPE_ARRAY;
+	parameter_desc->element_type = element_type;
+	parameter_desc->name = name;
+
+	return parameter_desc;
+}
+
 void
 ep_parameter_desc_fini (EventPipeParameterDesc *parameter_desc)
 {
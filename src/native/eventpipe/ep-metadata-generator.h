@@ -58,6 +58,12 @@ ep_parameter_desc_init (
 	EventPipeParameterType type,
 	const ep_char16_t *name);
 
+EventPipeParameterDesc *
+ep_parameter_desc_init_array (
+	EventPipeParameterDesc *parameter_desc,
+	EventPipeParameterType element_type,
+	const ep_char16_t *name);
+
 void
 ep_parameter_desc_fini (EventPipeParameterDesc *parameter_desc);
 
@@ -196,6 +196,16 @@ inline
 bool
 ep_rt_config_value_get_enable_stackwalk (void);
 
+static
+inline
+uint32_t
+ep_rt_config_value_get_sample_interval_us (void);
+
+static
+inline
+bool
+ep_rt_config_value_get_sample_cpu_time_only (void);
+
 /*
  * EventPipeSampleProfiler.
  */
@@ -204,6 +214,10 @@ static
 void
 ep_rt_sample_profiler_write_sampling_event_for_threads (ep_rt_thread_handle_t sampling_thread, EventPipeEvent *sampling_event);
 
+static
+void
+ep_rt_sample_profiler_stopped (void);
+
 static
 void
 ep_rt_notify_profiler_provider_created (EventPipeProvider *provider);
@@ -280,9 +294,13 @@ static
 bool
 ep_rt_is_running (void);
 
+// method_ips, when not NULL, limits method rundown to the methods containing those ips.
 static
 void
-ep_rt_execute_rundown (dn_vector_ptr_t *execution_checkpoints);
+ep_rt_execute_rundown (
+	dn_vector_ptr_t *execution_checkpoints,
+	const uintptr_t *method_ips,
+	uint32_t method_ips_len);
 
 /*
  * Objects.
@@ -8,6 +8,7 @@
 #include "ep-sample-profiler.h"
 #include "ep-event.h"
 #include "ep-provider-internals.h"
+#include "ep-metadata-generator.h"
 #include "ep-rt.h"
 
 #define NUM_NANOSECONDS_IN_1_MS 1000000
@@ -15,8 +16,10 @@
 static volatile uint32_t _profiling_enabled = (uint32_t)false;
 static EventPipeProvider *_sampling_provider = NULL;
 static EventPipeEvent *_thread_time_event = NULL;
+static EventPipeEvent *_hardware_counters_event = NULL;
 static ep_rt_wait_event_handle_t _thread_shutdown_event;
 static uint64_t _sampling_rate_in_ns = NUM_NANOSECONDS_IN_1_MS; // 1ms
+static bool _cpu_time_sampling = false;
 static bool _time_period_is_set = false;
 static volatile uint32_t _can_start_sampling = (uint32_t)false;
 static int32_t _ref_count = 0;
@@ -28,6 +31,16 @@ static PVOID _time_end_period_func = NULL;
 static HINSTANCE _multimedia_library_handle = NULL;
 
 typedef MMRESULT(WINAPI *time_period_func)(UINT uPeriod);
+
+static
+inline
+UINT
+sample_profiler_get_time_period_ms (void)
+{
+	// The timer period can't go below 1ms, sub millisecond sampling rates use the finest one.
+	uint64_t period_ms = _sampling_rate_in_ns / NUM_NANOSECONDS_IN_1_MS;
+	return period_ms == 0 ? 1 : (UINT)period_ms;
+}
 #endif
 
 /*
@@ -36,6 +49,10 @@ typedef MMRESULT(WINAPI *time_period_func)(UINT uPeriod);
 
 EP_RT_DEFINE_THREAD_FUNC (sampling_thread);
 
+static
+EventPipeEvent *
+sample_profiler_add_hardware_counters_event (void);
+
 static
 void
 sample_profiler_set_time_granularity (void);
@@ -100,6 +117,9 @@ EP_RT_DEFINE_THREAD_FUNC (sampling_thread)
 				// Wait until it's time to sample again.
 				ep_rt_thread_sleep (_sampling_rate_in_ns);
 			}
+
+			// Release what the runtime keeps per sampled thread, e.g. hardware counters.
+			ep_rt_sample_profiler_stopped ();
 		EP_GCX_PREEMP_EXIT
 	}
 
@@ -109,6 +129,71 @@ EP_RT_DEFINE_THREAD_FUNC (sampling_thread)
 	return (ep_rt_thread_start_func_return_t)0;
 }
 
+static
+EventPipeEvent *
+sample_profiler_add_hardware_counters_event (void)
+{
+	ep_requires_lock_held ();
+
+	const ep_char8_t *param_names [] = {
+		"Cycles",
+		"Instructions",
+		"CacheMisses",
+		"BranchMisses" };
+
+	EP_ASSERT (ARRAY_SIZE (param_names) * sizeof (uint64_t) == sizeof (EventPipeHardwareCounterSample));
+
+	EventPipeEvent *result = NULL;
+	ep_char16_t *param_names_utf16 [ARRAY_SIZE (param_names)] = { 0 };
+	ep_char16_t *event_name_utf16 = NULL;
+	uint8_t *metadata = NULL;
+
+	EventPipeParameterDesc params [ARRAY_SIZE (param_names)];
+	for (uint32_t i = 0; i < ARRAY_SIZE (param_names); ++i) {
+		param_names_utf16 [i] = ep_rt_utf8_to_utf16le_string (param_names [i]);
+		ep_raise_error_if_nok (param_names_utf16 [i] != NULL);
+		ep_parameter_desc_init (&params [i], EP_PARAMETER_TYPE_UINT64, param_names_utf16 [i]);
+	}
+
+	event_name_utf16 = ep_rt_utf8_to_utf16le_string ("HardwareCounterSample");
+	ep_raise_error_if_nok (event_name_utf16 != NULL);
+
+	size_t metadata_len;
+	metadata_len = 0;
+	metadata = ep_metadata_generator_generate_event_metadata (
+		1, /* eventID */
+		event_name_utf16,
+		EP_SAMPLE_PROFILER_KEYWORD_HARDWARE_COUNTERS,
+		0, /* version */
+		EP_EVENT_LEVEL_INFORMATIONAL,
+		0, /* opcode */
+		params,
+		(uint32_t)ARRAY_SIZE (params),
+		&metadata_len);
+	ep_raise_error_if_nok (metadata != NULL);
+
+	result = provider_add_event (
+		_sampling_provider,
+		1, /* eventID */
+		EP_SAMPLE_PROFILER_KEYWORD_HARDWARE_COUNTERS,
+		0, /* eventVersion */
+		EP_EVENT_LEVEL_INFORMATIONAL,
+		false /* NeedStack */,
+		metadata,
+		(uint32_t)metadata_len);
+
+ep_on_exit:
+	ep_rt_byte_array_free (metadata);
+	ep_rt_utf16_string_free (event_name_utf16);
+	for (uint32_t i = 0; i < ARRAY_SIZE (param_names); ++i)
+		ep_rt_utf16_string_free (param_names_utf16 [i]);
+	return result;
+
+ep_on_error:
+	EP_ASSERT (result == NULL);
+	ep_exit_error_handler ();
+}
+
 static
 void
 sample_profiler_set_time_granularity (void)
@@ -120,7 +205,7 @@ sample_profiler_set_time_granularity (void)
 	// Note that is effects a system-wide setting and when set low will increase the amount of time
 	// the OS is on-CPU, decreasing overall system performance and increasing power consumption
 	if (_time_begin_period_func != NULL) {
-		if (((time_period_func)_time_begin_period_func)((uint32_t)(_sampling_rate_in_ns / NUM_NANOSECONDS_IN_1_MS)) == TIMERR_NOERROR) {
+		if (((time_period_func)_time_begin_period_func)(sample_profiler_get_time_period_ms ()) == TIMERR_NOERROR) {
 			_time_period_is_set = true;
 		}
 	}
@@ -134,7 +219,7 @@ sample_profiler_reset_time_granularity (void)
 #ifdef HOST_WIN32
 	// End the modifications we had to the timer period in enable.
 	if (_time_end_period_func != NULL) {
-		if (((time_period_func)_time_end_period_func)((uint32_t)(_sampling_rate_in_ns / NUM_NANOSECONDS_IN_1_MS)) == TIMERR_NOERROR) {
+		if (((time_period_func)_time_end_period_func)(sample_profiler_get_time_period_ms ()) == TIMERR_NOERROR) {
 			_time_period_is_set = false;
 		}
 	}
@@ -223,6 +308,8 @@ ep_sample_profiler_init (EventPipeProviderCallbackDataQueue *provider_callback_d
 			NULL,
 			0);
 		ep_raise_error_if_nok (_thread_time_event != NULL);
+		_hardware_counters_event = sample_profiler_add_hardware_counters_event ();
+		ep_raise_error_if_nok (_hardware_counters_event != NULL);
 	}
 
 ep_on_exit:
@@ -245,6 +332,7 @@ ep_sample_profiler_shutdown (void)
 
 	_sampling_provider = NULL;
 	_thread_time_event = NULL;
+	_hardware_counters_event = NULL;
 
 	_can_start_sampling = false;
 }
@@ -327,12 +415,30 @@ ep_sample_profiler_set_sampling_rate (uint64_t nanoseconds)
 		sample_profiler_set_time_granularity ();
 }
 
+void
+ep_sample_profiler_set_cpu_time_sampling (bool enabled)
+{
+	_cpu_time_sampling = enabled;
+}
+
+bool
+ep_sample_profiler_get_cpu_time_sampling (void)
+{
+	return _cpu_time_sampling;
+}
+
 uint64_t
 ep_sample_profiler_get_sampling_rate (void)
 {
 	return _sampling_rate_in_ns;
 }
 
+EventPipeEvent *
+ep_sample_profiler_get_hardware_counters_event (void)
+{
+	return _hardware_counters_event;
+}
+
 #endif /* !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES) */
 #endif /* ENABLE_PERFTRACING */
 
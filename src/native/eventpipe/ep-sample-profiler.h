@@ -37,5 +37,30 @@ ep_sample_profiler_set_sampling_rate (uint64_t nanoseconds);
 uint64_t
 ep_sample_profiler_get_sampling_rate (void);
 
+// When enabled, the runtime only samples threads that consumed CPU time since the
+// previous tick, instead of every managed thread, sleeping ones included.
+void
+ep_sample_profiler_set_cpu_time_sampling (bool enabled);
+
+bool
+ep_sample_profiler_get_cpu_time_sampling (void);
+
+// Enabling this keyword of the SampleProfiler provider makes the runtime write a HardwareCounterSample
+// event (ID 1) next to the sample of each thread whose hardware performance counters it can read.
+// The payload is the counts of the thread since its previous sample, attributed to the sampled stack:
+//   UInt64 Cycles, UInt64 Instructions, UInt64 CacheMisses (last level), UInt64 BranchMisses
+#define EP_SAMPLE_PROFILER_KEYWORD_HARDWARE_COUNTERS 0x1
+
+typedef struct _EventPipeHardwareCounterSample {
+	uint64_t cycles;
+	uint64_t instructions;
+	uint64_t cache_misses;
+	uint64_t branch_misses;
+} EventPipeHardwareCounterSample;
+
+// NULL before ep_sample_profiler_init, the caller checks whether the event is enabled.
+EventPipeEvent *
+ep_sample_profiler_get_hardware_counters_event (void);
+
 #endif /* ENABLE_PERFTRACING */
 #endif /* __EVENTPIPE_SAMPLE_PROFILER_H__ */
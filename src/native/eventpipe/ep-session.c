@@ -11,8 +11,55 @@
 #include "ep-file.h"
 #include "ep-session.h"
 #include "ep-event-payload.h"
+#include "ep-event-source.h"
+#include "ep-provider.h"
 #include "ep-rt.h"
 
+#ifdef ENABLE_PERFTRACING_USER_EVENTS
+#include <tracepoint/tracepoint.h>
+#endif
+
+#define EP_SESSION_AGGREGATION_TABLE_SIZE 256
+#define EP_SESSION_AGGREGATION_MAX_PROBES 16
+#define EP_SESSION_AGGREGATION_HISTOGRAM_BUCKETS 16
+
+// Per interval totals for one (event, key) pair.
+typedef struct _EventPipeSessionAggregate {
+	EventPipeEvent *ep_event;
+	uint64_t count;
+	uint64_t sum;
+	uint64_t min;
+	uint64_t max;
+	uint64_t histogram [EP_SESSION_AGGREGATION_HISTOGRAM_BUCKETS];
+	uint32_t key;
+} EventPipeSessionAggregate;
+
+struct _EventPipeSessionAggregator {
+	// Protects active_table, interval_start and the contents of the active table.
+	ep_rt_spin_lock_handle_t rt_lock;
+	// Open addressed tables, writers fill the active one while the other one is flushed.
+	EventPipeSessionAggregate *tables [2];
+	uint32_t active_table;
+	ep_timestamp_t interval_start;
+	ep_timestamp_t interval_ticks;
+	uint32_t interval_ms;
+	uint32_t key_offset;
+	uint32_t value_offset;
+};
+
+#ifdef ENABLE_PERFTRACING_USER_EVENTS
+// All events of a session go through a single user_events tracepoint, consumers filter on provider_name.
+// Each __rel_loc field is a uint32_t holding (size << 16) | offset, the offset is relative to the end of the field.
+#define EP_SESSION_TRACEPOINT_NAME_ARGS "DotNETEventPipe u32 event_id; u32 event_version; u8 activity_id[16]; u8 related_activity_id[16]; __rel_loc char[] provider_name; __rel_loc u8[] payload"
+#define EP_SESSION_TRACEPOINT_MAX_DATA_VECS 16
+#define EP_SESSION_TRACEPOINT_MAX_REL_LOC_SIZE 0xFFFF
+
+struct _EventPipeSessionTracepoint {
+	tracepoint_provider_state provider_state;
+	tracepoint_state tracepoint;
+};
+#endif
+
 /*
  * Forward declares of all static functions.
  */
@@ -30,6 +77,402 @@ static
 void
 ep_session_remove_dangling_session_states (EventPipeSession *session);
 
+static
+void
+session_aggregator_free (EventPipeSessionAggregator *aggregator);
+
+static
+bool
+session_aggregator_add_event (
+	EventPipeSession *session,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload);
+
+static
+void
+session_aggregator_write_summary (
+	EventPipeSession *session,
+	const EventPipeSessionAggregate *entry,
+	ep_timestamp_t interval_start,
+	ep_timestamp_t interval_end);
+
+static
+void
+session_aggregator_flush (EventPipeSession *session);
+
+// _Requires_lock_held (ep)
+static
+bool
+session_tracepoint_connect (EventPipeSession *session);
+
+static
+void
+session_tracepoint_free (EventPipeSessionTracepoint *tracepoint);
+
+static
+bool
+session_tracepoint_write_event (
+	EventPipeSession *session,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload,
+	const uint8_t *activity_id,
+	const uint8_t *related_activity_id);
+
+/*
+ * EventPipeSessionAggregator.
+ */
+
+static
+inline
+uint32_t
+session_aggregator_get_bucket (uint32_t value)
+{
+	// Bucket i counts values in [2^i, 2^(i+1)), bucket 0 also counts 0 and the last bucket is open ended.
+	uint32_t bucket = 0;
+	while (value > 1 && bucket < EP_SESSION_AGGREGATION_HISTOGRAM_BUCKETS - 1) {
+		value >>= 1;
+		bucket++;
+	}
+	return bucket;
+}
+
+static
+inline
+uint32_t
+session_aggregator_read_field (
+	EventPipeEventPayload *payload,
+	uint32_t offset)
+{
+	uint32_t value = 0;
+	if (offset == EP_SESSION_AGGREGATION_NO_FIELD || !ep_event_payload_try_read_data (payload, offset, (uint8_t *)&value, sizeof (value)))
+		value = 0;
+	return value;
+}
+
+static
+void
+session_aggregator_free (EventPipeSessionAggregator *aggregator)
+{
+	ep_return_void_if_nok (aggregator != NULL);
+
+	ep_rt_spin_lock_free (&aggregator->rt_lock);
+	ep_rt_object_array_free (aggregator->tables [0]);
+	ep_rt_object_array_free (aggregator->tables [1]);
+	ep_rt_object_free (aggregator);
+}
+
+static
+bool
+session_aggregator_add_event (
+	EventPipeSession *session,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (session->aggregator != NULL);
+	EP_ASSERT (ep_event != NULL);
+
+	EventPipeSessionAggregator *aggregator = session->aggregator;
+
+	// Keep the EventPipe provider's own events and rundown as raw events.
+	if (ep_event_get_provider (ep_event) == ep_event_source_get_provider (ep_event_source_get ()) || ep_session_get_rundown_enabled (session))
+		return false;
+
+	uint32_t key = session_aggregator_read_field (payload, aggregator->key_offset);
+	uint32_t value = aggregator->value_offset == EP_SESSION_AGGREGATION_NO_FIELD ?
+		ep_event_payload_get_size (payload) :
+		session_aggregator_read_field (payload, aggregator->value_offset);
+
+	uint32_t bucket = session_aggregator_get_bucket (value);
+	uint32_t hash = (uint32_t)((uintptr_t)ep_event >> 4) ^ (key * 2654435761U);
+
+	bool result = false;
+	EventPipeSessionAggregate *table = NULL;
+	EventPipeSessionAggregate *entry = NULL;
+
+	EP_SPIN_LOCK_ENTER (&aggregator->rt_lock, section1)
+		table = aggregator->tables [aggregator->active_table];
+		for (uint32_t probe = 0; probe < EP_SESSION_AGGREGATION_MAX_PROBES; ++probe) {
+			entry = &table [(hash + probe) & (EP_SESSION_AGGREGATION_TABLE_SIZE - 1)];
+			if (entry->ep_event == NULL) {
+				entry->ep_event = ep_event;
+				entry->key = key;
+				entry->min = value;
+				entry->max = value;
+			} else if (entry->ep_event != ep_event || entry->key != key) {
+				continue;
+			}
+
+			entry->count++;
+			entry->sum += value;
+			entry->min = value < entry->min ? value : entry->min;
+			entry->max = value > entry->max ? value : entry->max;
+			entry->histogram [bucket]++;
+			result = true;
+			break;
+		}
+	EP_SPIN_LOCK_EXIT (&aggregator->rt_lock, section1)
+
+	// When no slot was found the caller writes the event as is, nothing is lost.
+ep_on_exit:
+	return result;
+
+ep_on_error:
+	ep_exit_error_handler ();
+}
+
+static
+void
+session_aggregator_write_summary (
+	EventPipeSession *session,
+	const EventPipeSessionAggregate *entry,
+	ep_timestamp_t interval_start,
+	ep_timestamp_t interval_end)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (entry != NULL && entry->ep_event != NULL);
+
+	EventPipeEvent *aggregate_event = ep_event_source_get_event_aggregate_event (ep_event_source_get ());
+	ep_return_void_if_nok (aggregate_event != NULL && session->buffer_manager != NULL);
+
+	// ProviderName, EventID, Key, IntervalStart, IntervalEnd, Count, Sum, Min, Max, Histogram (uint16 length + uint64 buckets).
+	const ep_char16_t *provider_name = ep_provider_get_provider_name_utf16 (ep_event_get_provider (entry->ep_event));
+	uint32_t event_id = ep_event_get_event_id (entry->ep_event);
+	uint16_t histogram_len = EP_SESSION_AGGREGATION_HISTOGRAM_BUCKETS;
+
+	EventData data [11] = { { 0 } };
+	if (provider_name)
+		ep_event_data_init (&data[0], (uint64_t)(uintptr_t)provider_name, (uint32_t)((ep_rt_utf16_string_len (provider_name) + 1) * sizeof (ep_char16_t)), 0);
+	ep_event_data_init (&data[1], (uint64_t)(uintptr_t)&event_id, sizeof (event_id), 0);
+	ep_event_data_init (&data[2], (uint64_t)(uintptr_t)&entry->key, sizeof (entry->key), 0);
+	ep_event_data_init (&data[3], (uint64_t)(uintptr_t)&interval_start, sizeof (interval_start), 0);
+	ep_event_data_init (&data[4], (uint64_t)(uintptr_t)&interval_end, sizeof (interval_end), 0);
+	ep_event_data_init (&data[5], (uint64_t)(uintptr_t)&entry->count, sizeof (entry->count), 0);
+	ep_event_data_init (&data[6], (uint64_t)(uintptr_t)&entry->sum, sizeof (entry->sum), 0);
+	ep_event_data_init (&data[7], (uint64_t)(uintptr_t)&entry->min, sizeof (entry->min), 0);
+	ep_event_data_init (&data[8], (uint64_t)(uintptr_t)&entry->max, sizeof (entry->max), 0);
+	ep_event_data_init (&data[9], (uint64_t)(uintptr_t)&histogram_len, sizeof (histogram_len), 0);
+	ep_event_data_init (&data[10], (uint64_t)(uintptr_t)entry->histogram, sizeof (entry->histogram), 0);
+
+	EventPipeEventPayload payload;
+	ep_event_payload_init_2 (&payload, data, (uint32_t)ARRAY_SIZE (data));
+
+	// Written straight to this session, other sessions have the EventPipe provider enabled as well.
+	ep_buffer_manager_write_event (session->buffer_manager, ep_rt_thread_get_handle (), session, aggregate_event, &payload, NULL, NULL, NULL, NULL);
+
+	ep_event_payload_fini (&payload);
+}
+
+static
+void
+session_aggregator_flush (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (session->aggregator != NULL);
+
+	EventPipeSessionAggregator *aggregator = session->aggregator;
+	EventPipeSessionAggregate *table = NULL;
+	ep_timestamp_t interval_start = 0;
+	ep_timestamp_t interval_end = 0;
+
+	// Writers only touch the active table while holding the lock, so once swapped
+	// the retired table is owned by the flushing thread.
+	EP_SPIN_LOCK_ENTER (&aggregator->rt_lock, section1)
+		table = aggregator->tables [aggregator->active_table];
+		aggregator->active_table ^= 1;
+		interval_start = aggregator->interval_start;
+		interval_end = ep_perf_timestamp_get ();
+		aggregator->interval_start = interval_end;
+	EP_SPIN_LOCK_EXIT (&aggregator->rt_lock, section1)
+
+	for (uint32_t i = 0; i < EP_SESSION_AGGREGATION_TABLE_SIZE; ++i) {
+		if (table [i].ep_event != NULL) {
+			session_aggregator_write_summary (session, &table [i], interval_start, interval_end);
+			memset (&table [i], 0, sizeof (table [i]));
+		}
+	}
+
+ep_on_exit:
+	return;
+
+ep_on_error:
+	ep_exit_error_handler ();
+}
+
+bool
+ep_session_enable_aggregation (
+	EventPipeSession *session,
+	uint32_t interval_ms,
+	uint32_t key_offset,
+	uint32_t value_offset)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (interval_ms != 0);
+	EP_ASSERT (session->session_type == EP_SESSION_TYPE_IPCSTREAM || session->session_type == EP_SESSION_TYPE_FILESTREAM);
+
+	ep_requires_lock_held ();
+
+	ep_return_false_if_nok (session->aggregator == NULL && session->buffer_manager != NULL);
+
+	EventPipeSessionAggregator *instance = ep_rt_object_alloc (EventPipeSessionAggregator);
+	ep_raise_error_if_nok (instance != NULL);
+
+	ep_rt_spin_lock_alloc (&instance->rt_lock);
+	ep_raise_error_if_nok (ep_rt_spin_lock_is_valid (&instance->rt_lock));
+
+	instance->tables [0] = ep_rt_object_array_alloc (EventPipeSessionAggregate, EP_SESSION_AGGREGATION_TABLE_SIZE);
+	ep_raise_error_if_nok (instance->tables [0] != NULL);
+
+	instance->tables [1] = ep_rt_object_array_alloc (EventPipeSessionAggregate, EP_SESSION_AGGREGATION_TABLE_SIZE);
+	ep_raise_error_if_nok (instance->tables [1] != NULL);
+
+	instance->active_table = 0;
+	instance->interval_ms = interval_ms;
+	instance->interval_ticks = (ep_timestamp_t)((int64_t)interval_ms * ep_perf_frequency_query () / 1000);
+	instance->interval_start = ep_perf_timestamp_get ();
+	instance->key_offset = key_offset;
+	instance->value_offset = value_offset;
+
+	session->aggregator = instance;
+	return true;
+
+ep_on_error:
+	session_aggregator_free (instance);
+	return false;
+}
+
+/*
+ * EventPipeSessionTracepoint.
+ */
+
+static
+bool
+session_tracepoint_connect (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (session->session_type == EP_SESSION_TYPE_USEREVENTS);
+
+	ep_requires_lock_held ();
+
+#ifdef ENABLE_PERFTRACING_USER_EVENTS
+	EventPipeSessionTracepoint *instance = ep_rt_object_alloc (EventPipeSessionTracepoint);
+	ep_raise_error_if_nok (instance != NULL);
+
+	{
+		tracepoint_provider_state provider_state = TRACEPOINT_PROVIDER_STATE_INIT;
+		tracepoint_state tracepoint = TRACEPOINT_STATE_INIT;
+		instance->provider_state = provider_state;
+		instance->tracepoint = tracepoint;
+	}
+
+	// Opens user_events_data, fails if the kernel doesn't support user_events or tracefs isn't accessible.
+	if (tracepoint_open_provider (&instance->provider_state) != 0) {
+		ep_rt_object_free (instance);
+		ep_raise_error ();
+	}
+
+	if (tracepoint_connect (&instance->tracepoint, &instance->provider_state, EP_SESSION_TRACEPOINT_NAME_ARGS) != 0) {
+		session_tracepoint_free (instance);
+		ep_raise_error ();
+	}
+
+	session->tracepoint = instance;
+	return true;
+
+ep_on_error:
+	return false;
+#else
+	return false;
+#endif
+}
+
+static
+void
+session_tracepoint_free (EventPipeSessionTracepoint *tracepoint)
+{
+	ep_return_void_if_nok (tracepoint != NULL);
+
+#ifdef ENABLE_PERFTRACING_USER_EVENTS
+	// Disconnects the tracepoint and unregisters it from the kernel.
+	tracepoint_close_provider (&tracepoint->provider_state);
+	ep_rt_object_free (tracepoint);
+#endif
+}
+
+static
+bool
+session_tracepoint_write_event (
+	EventPipeSession *session,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload,
+	const uint8_t *activity_id,
+	const uint8_t *related_activity_id)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (session->tracepoint != NULL);
+	EP_ASSERT (ep_event != NULL);
+
+#ifdef ENABLE_PERFTRACING_USER_EVENTS
+	static const uint8_t empty_activity_id [EP_ACTIVITY_ID_SIZE] = { 0 };
+
+	EventPipeSessionTracepoint *tracepoint = session->tracepoint;
+
+	// No perf or ftrace session has the tracepoint enabled.
+	if (!TRACEPOINT_ENABLED (&tracepoint->tracepoint))
+		return false;
+
+	const ep_char8_t *provider_name = ep_provider_get_provider_name (ep_event_get_provider (ep_event));
+	uint32_t provider_name_len = (uint32_t)strlen ((const char *)provider_name) + 1;
+	uint32_t payload_size = payload != NULL ? ep_event_payload_get_size (payload) : 0;
+	if (provider_name_len > EP_SESSION_TRACEPOINT_MAX_REL_LOC_SIZE || payload_size > EP_SESSION_TRACEPOINT_MAX_REL_LOC_SIZE)
+		return false;
+
+	uint32_t header [2];
+	header [0] = ep_event_get_event_id (ep_event);
+	header [1] = ep_event_get_event_version (ep_event);
+
+	// provider_name starts right after the payload __rel_loc, the payload right after provider_name.
+	uint32_t rel_locs [2];
+	rel_locs [0] = (provider_name_len << 16) | (uint32_t)sizeof (uint32_t);
+	rel_locs [1] = (payload_size << 16) | provider_name_len;
+
+	// data_vecs [0] is reserved for tracepoint_write.
+	struct iovec data_vecs [EP_SESSION_TRACEPOINT_MAX_DATA_VECS];
+	unsigned data_count = 0;
+	data_vecs [data_count].iov_base = NULL;
+	data_vecs [data_count++].iov_len = 0;
+	data_vecs [data_count].iov_base = header;
+	data_vecs [data_count++].iov_len = sizeof (header);
+	data_vecs [data_count].iov_base = (void *)(activity_id != NULL ? activity_id : empty_activity_id);
+	data_vecs [data_count++].iov_len = EP_ACTIVITY_ID_SIZE;
+	data_vecs [data_count].iov_base = (void *)(related_activity_id != NULL ? related_activity_id : empty_activity_id);
+	data_vecs [data_count++].iov_len = EP_ACTIVITY_ID_SIZE;
+	data_vecs [data_count].iov_base = rel_locs;
+	data_vecs [data_count++].iov_len = sizeof (rel_locs);
+	data_vecs [data_count].iov_base = (void *)provider_name;
+	data_vecs [data_count++].iov_len = provider_name_len;
+
+	if (payload_size != 0) {
+		// Reference the caller's EventData directly when it fits, the kernel does the only copy.
+		uint32_t event_data_len = ep_event_payload_get_event_data_len (payload);
+		if (!ep_event_payload_is_flattened (payload) && event_data_len <= EP_SESSION_TRACEPOINT_MAX_DATA_VECS - data_count) {
+			EventData *event_data = ep_event_payload_get_event_data (payload);
+			for (uint32_t i = 0; i < event_data_len; ++i) {
+				data_vecs [data_count].iov_base = (void *)(uintptr_t)ep_event_data_get_ptr (&event_data [i]);
+				data_vecs [data_count++].iov_len = ep_event_data_get_size (&event_data [i]);
+			}
+		} else {
+			data_vecs [data_count].iov_base = ep_event_payload_get_flat_data (payload);
+			data_vecs [data_count++].iov_len = payload_size;
+		}
+	}
+
+	return tracepoint_write (&tracepoint->tracepoint, data_count, data_vecs) == 0;
+#else
+	return false;
+#endif
+}
+
 /*
  * EventPipeSession.
  */
@@ -58,6 +501,9 @@ EP_RT_DEFINE_THREAD_FUNC (streaming_thread)
 
 	EP_GCX_PREEMP_ENTER
 		while (ep_session_get_streaming_enabled (session)) {
+			if (session->aggregator != NULL && ep_perf_timestamp_get () - session->aggregator->interval_start >= session->aggregator->interval_ticks)
+				session_aggregator_flush (session);
+
 			bool events_written = false;
 			if (!ep_session_write_all_buffers_to_file (session, &events_written)) {
 				success = false;
@@ -65,8 +511,9 @@ EP_RT_DEFINE_THREAD_FUNC (streaming_thread)
 			}
 
 			if (!events_written) {
-				// No events were available, sleep until more are available
-				ep_rt_wait_event_wait (wait_event, EP_INFINITE_WAIT, false);
+				// No events were available, sleep until more are available, or until
+				// the next aggregation interval is due since aggregated events don't signal.
+				ep_rt_wait_event_wait (wait_event, session->aggregator != NULL ? session->aggregator->interval_ms : EP_INFINITE_WAIT, false);
 			}
 
 			// Wait until it's time to sample again.
@@ -143,7 +590,7 @@ ep_session_alloc (
 {
 	EP_ASSERT (index < EP_MAX_NUMBER_OF_SESSIONS);
 	EP_ASSERT (format < EP_SERIALIZATION_FORMAT_COUNT);
-	EP_ASSERT (session_type == EP_SESSION_TYPE_SYNCHRONOUS || circular_buffer_size_in_mb > 0);
+	EP_ASSERT (session_type == EP_SESSION_TYPE_SYNCHRONOUS || session_type == EP_SESSION_TYPE_USEREVENTS || circular_buffer_size_in_mb > 0);
 	EP_ASSERT (providers_len > 0);
 	EP_ASSERT (providers != NULL);
 	EP_ASSERT ((sync_callback != NULL) == (session_type == EP_SESSION_TYPE_SYNCHRONOUS));
@@ -174,7 +621,8 @@ ep_session_alloc (
 		sequence_point_alloc_budget = 10 * 1024 * 1024;
 	}
 
-	if (session_type != EP_SESSION_TYPE_SYNCHRONOUS) {
+	// user_events sessions hand events straight to the kernel and don't buffer.
+	if (session_type != EP_SESSION_TYPE_SYNCHRONOUS && session_type != EP_SESSION_TYPE_USEREVENTS) {
 		instance->buffer_manager = ep_buffer_manager_alloc (instance, ((size_t)circular_buffer_size_in_mb) << 20, sequence_point_alloc_budget);
 		ep_raise_error_if_nok (instance->buffer_manager != NULL);
 	}
@@ -202,6 +650,10 @@ ep_session_alloc (
 		ipc_stream_writer = NULL;
 		break;
 
+	case EP_SESSION_TYPE_USEREVENTS:
+		ep_raise_error_if_nok (session_tracepoint_connect (instance));
+		break;
+
 	default:
 		break;
 	}
@@ -209,8 +661,10 @@ ep_session_alloc (
 	instance->session_start_time = ep_system_timestamp_get ();
 	instance->session_start_timestamp = ep_perf_timestamp_get ();
 	instance->paused = false;
-	instance->enable_stackwalk = ep_rt_config_value_get_enable_stackwalk () && stackwalk_requested;
+	// Stacks aren't part of the tracepoint format, perf collects user stacks itself.
+	instance->enable_stackwalk = ep_rt_config_value_get_enable_stackwalk () && stackwalk_requested && session_type != EP_SESSION_TYPE_USEREVENTS;
 	instance->started = 0;
+	instance->aggregator = NULL;
 
 ep_on_exit:
 	ep_requires_lock_held ();
@@ -278,6 +732,8 @@ ep_session_free (EventPipeSession *session)
 
 	ep_session_provider_list_free (session->providers);
 
+	session_aggregator_free (session->aggregator);
+	session_tracepoint_free (session->tracepoint);
 	ep_buffer_manager_free (session->buffer_manager);
 	ep_file_free (session->file);
 
@@ -355,7 +811,30 @@ ep_session_execute_rundown (
 
 	ep_return_void_if_nok (session->file != NULL);
 
-	ep_rt_execute_rundown (execution_checkpoints);
+	// All buffers were written to the file by ep_session_disable, so stack_ips holds every
+	// frame of the session. The runtime resolves them to the methods to rundown.
+	dn_umap_t *stack_ips = ep_file_get_stack_ips (session->file);
+	if (stack_ips == NULL) {
+		ep_rt_execute_rundown (execution_checkpoints, NULL, 0);
+		return;
+	}
+
+	dn_vector_custom_alloc_params_t params = {0, };
+	params.capacity = dn_umap_size (stack_ips);
+
+	dn_vector_t method_ips;
+	if (!dn_vector_custom_init_t (&method_ips, &params, uintptr_t)) {
+		// Fall back to a full rundown, missing methods would make the stacks unresolvable.
+		ep_rt_execute_rundown (execution_checkpoints, NULL, 0);
+		return;
+	}
+
+	DN_UMAP_FOREACH_KEY_BEGIN (uintptr_t, ip, stack_ips) {
+		dn_vector_push_back (&method_ips, ip);
+	} DN_UMAP_FOREACH_END;
+
+	ep_rt_execute_rundown (execution_checkpoints, dn_vector_data_t (&method_ips, uintptr_t), dn_vector_size (&method_ips));
+	dn_vector_dispose (&method_ips);
 }
 
 void
@@ -462,6 +941,11 @@ ep_session_disable (EventPipeSession *session)
 	if ((session->session_type == EP_SESSION_TYPE_IPCSTREAM || session->session_type == EP_SESSION_TYPE_FILESTREAM) && ep_session_get_streaming_enabled (session))
 		session_disable_streaming_thread (session);
 
+	// Emit the last partial interval. Events aggregated after this point, before the
+	// session stops accepting writes, are not reported.
+	if (session->aggregator != NULL)
+		session_aggregator_flush (session);
+
 	bool ignored;
 	ep_session_write_all_buffers_to_file (session, &ignored);
 	ep_session_provider_list_clear (session->providers);
@@ -520,6 +1004,10 @@ ep_session_write_event (
 				stack == NULL ? NULL : (uintptr_t *)ep_stack_contents_get_pointer (stack),
 				session->callback_additional_data);
 			result = true;
+		} else if (session->aggregator != NULL && session_aggregator_add_event (session, ep_event, payload)) {
+			result = true;
+		} else if (session->tracepoint != NULL) {
+			result = session_tracepoint_write_event (session, ep_event, payload, activity_id, related_activity_id);
 		} else {
 			EP_ASSERT (session->buffer_manager != NULL);
 			result = ep_buffer_manager_write_event (
@@ -67,6 +67,10 @@ struct _EventPipeSession_Internal {
 	bool enable_stackwalk;
 	// Indicate that session is fully running (streaming thread started).
 	volatile uint32_t started;
+	// When set, provider events are folded into per interval summaries instead of being written.
+	EventPipeSessionAggregator *aggregator;
+	// For user_events sessions, the tracepoint events are written to.
+	EventPipeSessionTracepoint *tracepoint;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_SESSION_GETTER_SETTER)
@@ -103,6 +107,17 @@ ep_session_alloc (
 void
 ep_session_free (EventPipeSession *session);
 
+// Aggregate events per (event, key field) and write EventAggregate summaries every interval_ms.
+// Offsets select uint32_t payload fields, EP_SESSION_AGGREGATION_NO_FIELD keys by event only
+// and uses the payload size as the histogram value.
+// _Requires_lock_held (ep)
+bool
+ep_session_enable_aggregation (
+	EventPipeSession *session,
+	uint32_t interval_ms,
+	uint32_t key_offset,
+	uint32_t value_offset);
+
 // _Requires_lock_held (ep)
 EventPipeSessionProvider *
 ep_session_get_session_provider (
@@ -41,12 +41,31 @@ ipc_stream_writer_write_func (
 	uint32_t bytes_to_write,
 	uint32_t *bytes_written);
 
+static
+bool
+ipc_stream_writer_write_vector_func (
+	void *stream,
+	const IpcStreamBuffer *buffers,
+	uint32_t buffer_count,
+	uint32_t *bytes_written);
+
 static
 void
 fast_serializer_write_serialization_type (
 	FastSerializer *fast_serializer,
 	FastSerializableObject *fast_serializable_object);
 
+static
+void
+fast_serializer_gather_flush (FastSerializer *fast_serializer);
+
+static
+void
+fast_serializer_gather_buffer (
+	FastSerializer *fast_serializer,
+	const uint8_t *buffer,
+	uint32_t buffer_len);
+
 /*
  * FastSerializableObject.
  */
@@ -159,6 +178,70 @@ fast_serializer_write_serialization_type (
 	ep_fast_serializer_write_tag (fast_serializer, FAST_SERIALIZER_TAGS_END_OBJECT, NULL, 0);
 }
 
+static
+void
+fast_serializer_gather_flush (FastSerializer *fast_serializer)
+{
+	EP_ASSERT (fast_serializer != NULL);
+
+	ep_return_void_if_nok (fast_serializer->gather_buffer_count != 0);
+
+	uint32_t bytes_to_write = 0;
+	for (uint32_t i = 0; i < fast_serializer->gather_buffer_count; ++i)
+		bytes_to_write += fast_serializer->gather_buffers [i].buffer_len;
+
+	if (!fast_serializer->write_error_encountered) {
+		uint32_t bytes_written = 0;
+		bool result = ep_stream_writer_write_vector_vcall (fast_serializer->stream_writer, fast_serializer->gather_buffers, fast_serializer->gather_buffer_count, &bytes_written);
+		fast_serializer->write_error_encountered = ((bytes_to_write != bytes_written) || !result);
+	}
+
+	fast_serializer->gather_buffer_count = 0;
+	fast_serializer->gather_staging_len = 0;
+}
+
+static
+void
+fast_serializer_gather_buffer (
+	FastSerializer *fast_serializer,
+	const uint8_t *buffer,
+	uint32_t buffer_len)
+{
+	EP_ASSERT (fast_serializer != NULL);
+	EP_ASSERT (fast_serializer->gather_depth > 0);
+
+	IpcStreamBuffer *last_buffer = fast_serializer->gather_buffer_count > 0 ? &fast_serializer->gather_buffers [fast_serializer->gather_buffer_count - 1] : NULL;
+
+	if (buffer_len <= FAST_SERIALIZER_GATHER_COPY_THRESHOLD) {
+		// Small writes are copied into the staging area, consecutive ones share a single segment.
+		uint8_t *staging = fast_serializer->gather_staging + fast_serializer->gather_staging_len;
+		bool extends_last_buffer = last_buffer != NULL && last_buffer->buffer + last_buffer->buffer_len == staging;
+		if (fast_serializer->gather_staging_len + buffer_len > FAST_SERIALIZER_GATHER_STAGING_SIZE ||
+			(!extends_last_buffer && fast_serializer->gather_buffer_count == FAST_SERIALIZER_GATHER_MAX_BUFFERS)) {
+			fast_serializer_gather_flush (fast_serializer);
+			staging = fast_serializer->gather_staging;
+			extends_last_buffer = false;
+		}
+
+		memcpy (staging, buffer, buffer_len);
+		fast_serializer->gather_staging_len += buffer_len;
+
+		if (extends_last_buffer) {
+			fast_serializer->gather_buffers [fast_serializer->gather_buffer_count - 1].buffer_len += buffer_len;
+			return;
+		}
+
+		buffer = staging;
+	} else if (fast_serializer->gather_buffer_count == FAST_SERIALIZER_GATHER_MAX_BUFFERS) {
+		fast_serializer_gather_flush (fast_serializer);
+	}
+
+	// Add a new segment, large writes are referenced in place and the caller keeps them alive until the object is serialized.
+	fast_serializer->gather_buffers [fast_serializer->gather_buffer_count].buffer = buffer;
+	fast_serializer->gather_buffers [fast_serializer->gather_buffer_count].buffer_len = buffer_len;
+	fast_serializer->gather_buffer_count++;
+}
+
 FastSerializer *
 ep_fast_serializer_alloc (StreamWriter *stream_writer)
 {
@@ -174,6 +257,9 @@ ep_fast_serializer_alloc (StreamWriter *stream_writer)
 	instance->stream_writer = stream_writer;
 	instance->required_padding = 0;
 	instance->write_error_encountered = false;
+	instance->gather_depth = 0;
+	instance->gather_buffer_count = 0;
+	instance->gather_staging_len = 0;
 
 	ep_fast_serializer_write_string (instance, signature, signature_len);
 
@@ -210,7 +296,14 @@ ep_fast_serializer_write_buffer (
 	ep_return_void_if_nok (!fast_serializer->write_error_encountered && fast_serializer->stream_writer != NULL);
 
 	uint32_t bytes_written = 0;
-	bool result = ep_stream_writer_write (fast_serializer->stream_writer, buffer, buffer_len, &bytes_written);
+	bool result = true;
+	if (fast_serializer->gather_depth > 0) {
+		// Sent with the vectored write issued once the outermost object is serialized.
+		fast_serializer_gather_buffer (fast_serializer, buffer, buffer_len);
+		bytes_written = buffer_len;
+	} else {
+		result = ep_stream_writer_write (fast_serializer->stream_writer, buffer, buffer_len, &bytes_written);
+	}
 
 	uint32_t required_padding = fast_serializer->required_padding;
 	required_padding = (FAST_SERIALIZER_ALIGNMENT_SIZE + required_padding - (bytes_written % FAST_SERIALIZER_ALIGNMENT_SIZE)) % FAST_SERIALIZER_ALIGNMENT_SIZE;
@@ -219,7 +312,7 @@ ep_fast_serializer_write_buffer (
 	// This will cause us to stop writing to the file.
 	// The file will still remain open until shutdown so that we don't
 	// have to take a lock at this level when we touch the file stream.
-	fast_serializer->write_error_encountered = ((buffer_len != bytes_written) || !result);
+	fast_serializer->write_error_encountered = fast_serializer->write_error_encountered || ((buffer_len != bytes_written) || !result);
 }
 
 void
@@ -252,6 +345,12 @@ ep_fast_serializer_write_object (
 	EP_ASSERT (fast_serializer != NULL);
 	EP_ASSERT (fast_serializable_object != NULL);
 
+	// When the stream supports it, the whole object (tags, block header and the block payload
+	// referenced in place) goes out in one scatter/gather write instead of one write per field.
+	bool gather = fast_serializer->stream_writer != NULL && ep_stream_writer_supports_write_vector (fast_serializer->stream_writer);
+	if (gather)
+		fast_serializer->gather_depth++;
+
 	ep_fast_serializer_write_tag (fast_serializer, fast_serializable_object->is_private ? FAST_SERIALIZER_TAGS_BEGIN_PRIVATE_OBJECT : FAST_SERIALIZER_TAGS_BEGIN_OBJECT, NULL, 0);
 
 	fast_serializer_write_serialization_type (fast_serializer, fast_serializable_object);
@@ -260,6 +359,9 @@ ep_fast_serializer_write_object (
 	ep_fast_serializable_object_fast_serialize_vcall (fast_serializable_object, fast_serializer);
 
 	ep_fast_serializer_write_tag (fast_serializer, FAST_SERIALIZER_TAGS_END_OBJECT, NULL, 0);
+
+	if (gather && --fast_serializer->gather_depth == 0)
+		fast_serializer_gather_flush (fast_serializer);
 }
 
 void
@@ -380,7 +482,8 @@ file_stream_writer_write_func (
 
 static StreamWriterVtable file_stream_writer_vtable = {
 	file_stream_writer_free_func,
-	file_stream_writer_write_func };
+	file_stream_writer_write_func,
+	NULL };
 
 FileStreamWriter *
 ep_file_stream_writer_alloc (const ep_char8_t *output_file_path)
@@ -514,6 +617,39 @@ ep_ipc_stream_write_vcall (
 	return vtable->write_func (ipc_stream, buffer, bytes_to_write, bytes_written, timeout_ms);
 }
 
+bool
+ep_ipc_stream_write_vector_vcall (
+	IpcStream *ipc_stream,
+	const IpcStreamBuffer *buffers,
+	uint32_t buffer_count,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms)
+{
+	EP_ASSERT (ipc_stream != NULL);
+	EP_ASSERT (buffers != NULL);
+	EP_ASSERT (bytes_written != NULL);
+
+	EP_ASSERT (ipc_stream->vtable != NULL);
+	IpcStreamVtable *vtable = ipc_stream->vtable;
+
+	if (vtable->write_vector_func != NULL)
+		return vtable->write_vector_func (ipc_stream, buffers, buffer_count, bytes_written, timeout_ms);
+
+	// Stream doesn't support scatter/gather, write the buffers one by one.
+	EP_ASSERT (vtable->write_func != NULL);
+
+	bool result = true;
+	uint32_t total_bytes_written = 0;
+	for (uint32_t i = 0; i < buffer_count && result; ++i) {
+		uint32_t current_bytes_written = 0;
+		result = vtable->write_func (ipc_stream, buffers [i].buffer, buffers [i].buffer_len, &current_bytes_written, timeout_ms);
+		total_bytes_written += current_bytes_written;
+	}
+
+	*bytes_written = total_bytes_written;
+	return result;
+}
+
 bool
 ep_ipc_stream_flush_vcall (IpcStream *ipc_stream)
 {
@@ -566,9 +702,27 @@ ipc_stream_writer_write_func (
 		bytes_written);
 }
 
+static
+bool
+ipc_stream_writer_write_vector_func (
+	void *stream,
+	const IpcStreamBuffer *buffers,
+	uint32_t buffer_count,
+	uint32_t *bytes_written)
+{
+	EP_ASSERT (stream != NULL);
+
+	return ep_ipc_stream_writer_write_vector (
+		(IpcStreamWriter *)stream,
+		buffers,
+		buffer_count,
+		bytes_written);
+}
+
 static StreamWriterVtable ipc_stream_writer_vtable = {
 	ipc_stream_writer_free_func,
-	ipc_stream_writer_write_func };
+	ipc_stream_writer_write_func,
+	ipc_stream_writer_write_vector_func };
 
 IpcStreamWriter *
 ep_ipc_stream_writer_alloc (
@@ -631,6 +785,33 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+bool
+ep_ipc_stream_writer_write_vector (
+	IpcStreamWriter *ipc_stream_writer,
+	const IpcStreamBuffer *buffers,
+	uint32_t buffer_count,
+	uint32_t *bytes_written)
+{
+	EP_ASSERT (ipc_stream_writer != NULL);
+	EP_ASSERT (buffers != NULL);
+	EP_ASSERT (buffer_count > 0);
+	EP_ASSERT (bytes_written != NULL);
+
+	ep_return_false_if_nok (buffers != NULL && buffer_count != 0);
+
+	bool result = false;
+
+	ep_raise_error_if_nok (ep_ipc_stream_writer_get_ipc_stream (ipc_stream_writer) != NULL);
+	result = ep_ipc_stream_write_vector_vcall (ep_ipc_stream_writer_get_ipc_stream (ipc_stream_writer), buffers, buffer_count, bytes_written, EP_INFINITE_WAIT);
+
+ep_on_exit:
+	return result;
+
+ep_on_error:
+	*bytes_written = 0;
+	ep_exit_error_handler ();
+}
+
 /*
  * StreamWriter.
  */
@@ -682,6 +863,31 @@ ep_stream_writer_write_vcall (
 	return vtable->write_func (stream_writer, buffer, bytes_to_write, bytes_written);
 }
 
+bool
+ep_stream_writer_supports_write_vector (const StreamWriter *stream_writer)
+{
+	EP_ASSERT (stream_writer != NULL);
+	EP_ASSERT (stream_writer->vtable != NULL);
+
+	return stream_writer->vtable->write_vector_func != NULL;
+}
+
+bool
+ep_stream_writer_write_vector_vcall (
+	StreamWriter *stream_writer,
+	const IpcStreamBuffer *buffers,
+	uint32_t buffer_count,
+	uint32_t *bytes_written)
+{
+	EP_ASSERT (stream_writer != NULL);
+	EP_ASSERT (stream_writer->vtable != NULL);
+
+	StreamWriterVtable *vtable = stream_writer->vtable;
+
+	EP_ASSERT (vtable->write_vector_func != NULL);
+	return vtable->write_vector_func (stream_writer, buffers, buffer_count, bytes_written);
+}
+
 bool
 ep_stream_writer_write (
 	StreamWriter *stream_writer,
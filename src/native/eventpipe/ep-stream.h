@@ -41,10 +41,13 @@ typedef enum
 
 typedef void (*StreamWriterFreeFunc)(void *stream);
 typedef bool (*StreamWriterWriteFunc)(void *stream, const uint8_t *buffer, const uint32_t bytes_to_write, uint32_t *bytes_written);
+typedef bool (*StreamWriterWriteVectorFunc)(void *stream, const IpcStreamBuffer *buffers, uint32_t buffer_count, uint32_t *bytes_written);
 
 struct _StreamWriterVtable {
 	StreamWriterFreeFunc free_func;
 	StreamWriterWriteFunc write_func;
+	// Optional, when set the FastSerializer hands whole objects to the writer in one scatter/gather write.
+	StreamWriterWriteVectorFunc write_vector_func;
 };
 
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_STREAM_GETTER_SETTER)
@@ -86,6 +89,16 @@ ep_stream_writer_write_vcall (
 	const uint32_t bytes_to_write,
 	uint32_t *bytes_written);
 
+bool
+ep_stream_writer_supports_write_vector (const StreamWriter *stream_writer);
+
+bool
+ep_stream_writer_write_vector_vcall (
+	StreamWriter *stream_writer,
+	const IpcStreamBuffer *buffers,
+	uint32_t buffer_count,
+	uint32_t *bytes_written);
+
 /*
  * FastSerializableObject.
  */
@@ -155,6 +168,13 @@ ep_fast_serializable_object_fast_serialize_vcall (
 
 #define FAST_SERIALIZER_ALIGNMENT_SIZE 4
 
+// Scatter/gather limits used when the stream writer supports vectored writes.
+// Writes up to FAST_SERIALIZER_GATHER_COPY_THRESHOLD bytes (tags, sizes, block headers)
+// are staged in place, larger ones (block payloads) are sent straight from their memory.
+#define FAST_SERIALIZER_GATHER_MAX_BUFFERS 16
+#define FAST_SERIALIZER_GATHER_STAGING_SIZE 256
+#define FAST_SERIALIZER_GATHER_COPY_THRESHOLD 64
+
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_STREAM_GETTER_SETTER)
 struct _FastSerializer {
 #else
@@ -163,6 +183,13 @@ struct _FastSerializer_Internal {
 	StreamWriter *stream_writer;
 	uint32_t required_padding;
 	bool write_error_encountered;
+	// Nesting level of ep_fast_serializer_write_object calls being gathered. Buffers written
+	// while gathering must stay valid until the outermost object has been serialized.
+	uint32_t gather_depth;
+	uint32_t gather_buffer_count;
+	uint32_t gather_staging_len;
+	IpcStreamBuffer gather_buffers [FAST_SERIALIZER_GATHER_MAX_BUFFERS];
+	uint8_t gather_staging [FAST_SERIALIZER_GATHER_STAGING_SIZE];
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_STREAM_GETTER_SETTER)
@@ -355,5 +382,12 @@ ep_ipc_stream_writer_write (
 	uint32_t bytes_to_write,
 	uint32_t *bytes_written);
 
+bool
+ep_ipc_stream_writer_write_vector (
+	IpcStreamWriter *ipc_stream_writer,
+	const IpcStreamBuffer *buffers,
+	uint32_t buffer_count,
+	uint32_t *bytes_written);
+
 #endif /* ENABLE_PERFTRACING */
 #endif /* __EVENTPIPE_STREAM_H__ */
@@ -33,6 +33,8 @@ typedef struct _EventPipeProviderCallbackDataQueue EventPipeProviderCallbackData
 typedef struct _EventPipeProviderConfiguration EventPipeProviderConfiguration;
 typedef struct _EventPipeExecutionCheckpoint EventPipeExecutionCheckpoint;
 typedef struct _EventPipeSession EventPipeSession;
+typedef struct _EventPipeSessionAggregator EventPipeSessionAggregator;
+typedef struct _EventPipeSessionTracepoint EventPipeSessionTracepoint;
 typedef struct _EventPipeSessionProvider EventPipeSessionProvider;
 typedef struct _EventPipeSessionProviderList EventPipeSessionProviderList;
 typedef struct _EventPipeSequencePoint EventPipeSequencePoint;
@@ -50,8 +52,8 @@ typedef struct _FastSerializer FastSerializer;
 typedef struct _FileStream FileStream;
 typedef struct _FileStreamWriter FileStreamWriter;
 typedef struct _IpcStreamWriter IpcStreamWriter;
-typedef struct _StackHashEntry StackHashEntry;
-typedef struct _StackHashKey StackHashKey;
+typedef struct _StackInternNode StackInternNode;
+typedef struct _StackInternTable StackInternTable;
 typedef struct _StreamWriter StreamWriter;
 typedef struct _StreamWriterVtable StreamWriterVtable;
 
@@ -147,7 +149,9 @@ typedef enum {
 	EP_SESSION_TYPE_LISTENER,
 	EP_SESSION_TYPE_IPCSTREAM,
 	EP_SESSION_TYPE_SYNCHRONOUS,
-	EP_SESSION_TYPE_FILESTREAM
+	EP_SESSION_TYPE_FILESTREAM,
+	// Events are written to a Linux user_events tracepoint instead of being buffered.
+	EP_SESSION_TYPE_USEREVENTS
 } EventPipeSessionType ;
 
 typedef enum {
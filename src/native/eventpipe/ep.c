@@ -10,6 +10,7 @@
 #include "ep-event.h"
 #include "ep-event-payload.h"
 #include "ep-event-source.h"
+#include "ep-file.h"
 #include "ep-provider.h"
 #include "ep-provider-internals.h"
 #include "ep-session.h"
@@ -469,7 +470,7 @@ static bool check_options_valid (const EventPipeSessionOptions *options)
 {
 	if (options->format >= EP_SERIALIZATION_FORMAT_COUNT)
 		return false;
-	if (options->circular_buffer_size_in_mb <= 0 && options->session_type != EP_SESSION_TYPE_SYNCHRONOUS)
+	if (options->circular_buffer_size_in_mb <= 0 && options->session_type != EP_SESSION_TYPE_SYNCHRONOUS && options->session_type != EP_SESSION_TYPE_USEREVENTS)
 		return false;
 	if (options->providers == NULL || options->providers_len <= 0)
 		return false;
@@ -477,6 +478,18 @@ static bool check_options_valid (const EventPipeSessionOptions *options)
 		return false;
 	if (options->session_type == EP_SESSION_TYPE_IPCSTREAM && options->stream == NULL)
 		return false;
+	if (options->compress_blocks && options->format < EP_SERIALIZATION_FORMAT_NETTRACE_V4)
+		return false;
+	if (options->aggregation_interval_ms != 0 && options->session_type != EP_SESSION_TYPE_IPCSTREAM && options->session_type != EP_SESSION_TYPE_FILESTREAM)
+		return false;
+#ifndef ENABLE_PERFTRACING_USER_EVENTS
+	if (options->session_type == EP_SESSION_TYPE_USEREVENTS)
+		return false;
+#endif
+	if (options->session_type == EP_SESSION_TYPE_USEREVENTS && options->compress_blocks)
+		return false;
+	if (options->rundown_stack_methods_only && (options->format < EP_SERIALIZATION_FORMAT_NETTRACE_V4 || (options->session_type != EP_SESSION_TYPE_FILE && options->session_type != EP_SESSION_TYPE_FILESTREAM && options->session_type != EP_SESSION_TYPE_IPCSTREAM)))
+		return false;
 
 	return true;
 }
@@ -491,7 +504,7 @@ enable (
 
 	EP_ASSERT (options != NULL);
 	EP_ASSERT (options->format < EP_SERIALIZATION_FORMAT_COUNT);
-	EP_ASSERT (options->session_type == EP_SESSION_TYPE_SYNCHRONOUS || options->circular_buffer_size_in_mb > 0);
+	EP_ASSERT (options->session_type == EP_SESSION_TYPE_SYNCHRONOUS || options->session_type == EP_SESSION_TYPE_USEREVENTS || options->circular_buffer_size_in_mb > 0);
 	EP_ASSERT (options->providers_len > 0 && options->providers != NULL);
 
 	EventPipeSession *session = NULL;
@@ -519,6 +532,17 @@ enable (
 
 	ep_raise_error_if_nok (session != NULL && ep_session_is_valid (session));
 
+	// Must happen before the first block is flushed, the file header is format agnostic.
+	if (options->compress_blocks && ep_session_get_file (session) != NULL)
+		ep_raise_error_if_nok (ep_file_enable_block_compression (ep_session_get_file (session)));
+
+	// Stacks are interned by the file, it records their frames for the rundown filter.
+	if (options->rundown_stack_methods_only && ep_session_get_file (session) != NULL)
+		ep_raise_error_if_nok (ep_file_enable_stack_ip_tracking (ep_session_get_file (session)));
+
+	if (options->aggregation_interval_ms != 0)
+		ep_raise_error_if_nok (ep_session_enable_aggregation (session, options->aggregation_interval_ms, options->aggregation_key_offset, options->aggregation_value_offset));
+
 	session_id = (EventPipeSessionID)session;
 
 	// Return if the index is invalid.
@@ -1138,6 +1162,11 @@ ep_session_options_init (
 	options->format = format;
 	options->rundown_keyword = rundown_keyword;
 	options->stackwalk_requested = stackwalk_requested;
+	options->compress_blocks = false;
+	options->rundown_stack_methods_only = false;
+	options->aggregation_interval_ms = 0;
+	options->aggregation_key_offset = EP_SESSION_AGGREGATION_NO_FIELD;
+	options->aggregation_value_offset = EP_SESSION_AGGREGATION_NO_FIELD;
 	options->stream = stream;
 	options->sync_callback = sync_callback;
 	options->callback_additional_data = callback_additional_data;
@@ -1431,7 +1460,9 @@ ep_init (void)
 
 	// Set the sampling rate for the sample profiler.
 	const uint32_t default_profiler_sample_rate_in_nanoseconds = 1000000; // 1 msec.
-	ep_sample_profiler_set_sampling_rate (default_profiler_sample_rate_in_nanoseconds);
+	const uint32_t profiler_sample_interval_in_microseconds = ep_rt_config_value_get_sample_interval_us ();
+	ep_sample_profiler_set_sampling_rate (profiler_sample_interval_in_microseconds != 0 ? (uint64_t)profiler_sample_interval_in_microseconds * 1000 : default_profiler_sample_rate_in_nanoseconds);
+	ep_sample_profiler_set_cpu_time_sampling (ep_rt_config_value_get_sample_cpu_time_only ());
 
 	_ep_deferred_enable_session_ids = dn_vector_alloc_t (EventPipeSessionID);
 	_ep_deferred_disable_session_ids = dn_vector_alloc_t (EventPipeSessionID);
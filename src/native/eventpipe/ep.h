@@ -115,6 +115,8 @@ ep_volatile_store_allow_write (uint64_t allow_write)
 * EventPipeSessionOptions.
 */
 
+#define EP_SESSION_AGGREGATION_NO_FIELD UINT32_MAX
+
 typedef struct EventPipeSessionOptions {
 	const EventPipeProviderConfiguration *providers;
 	IpcStream *stream;
@@ -127,6 +129,16 @@ typedef struct EventPipeSessionOptions {
 	EventPipeSerializationFormat format;
 	uint64_t rundown_keyword;
 	bool stackwalk_requested;
+	// Summarize events every aggregation_interval_ms instead of writing them, 0 disables aggregation.
+	// Only valid for streaming sessions, see ep_session_enable_aggregation.
+	uint32_t aggregation_interval_ms;
+	uint32_t aggregation_key_offset;
+	uint32_t aggregation_value_offset;
+	// LZ4 compress event and metadata blocks, only valid for EP_SERIALIZATION_FORMAT_NETTRACE_V4 or later.
+	bool compress_blocks;
+	// Limit rundown to methods seen in the session's stacks, only valid for sessions writing
+	// EP_SERIALIZATION_FORMAT_NETTRACE_V4 or later to a file or stream.
+	bool rundown_stack_methods_only;
 } EventPipeSessionOptions;
 
 void
@@ -40,6 +40,7 @@ static const Entry s_globalizationNative[] =
     DllImportEntry(GlobalizationNative_GetLocaleTimeFormat)
     DllImportEntry(GlobalizationNative_GetSortHandle)
     DllImportEntry(GlobalizationNative_GetSortKey)
+    DllImportEntry(GlobalizationNative_GetSortKeys)
     DllImportEntry(GlobalizationNative_GetSortVersion)
     DllImportEntry(GlobalizationNative_GetTimeZoneDisplayName)
     DllImportEntry(GlobalizationNative_IanaIdToWindowsId)
@@ -57,6 +57,8 @@ struct SortHandle
 {
     UCollator* collatorsPerOption[CompareOptionsMask + 1];
     SearchIteratorNode searchIteratorList[CompareOptionsMask + 1];
+    // true if ASCII letters and digits sort as in the root collation, see CompareAsciiAlphanumeric.
+    int32_t isAsciiAlphanumericRootOrder;
 };
 
 // Hiragana character range
@@ -453,6 +455,104 @@ static int CanIgnoreAllCollationElements(const UCollator* pColl, const UChar* lp
     return U_SUCCESS(err) ? result : false;
 }
 
+static int IsAsciiAlphanumeric(UChar character)
+{
+    return (character >= '0' && character <= '9') || (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z');
+}
+
+static int IsAsciiAlphanumericString(const UChar* lpStr, int32_t length)
+{
+    for (int32_t i = 0; i < length; i++)
+    {
+        if (!IsAsciiAlphanumeric(lpStr[i]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+Compares two strings of ASCII letters and digits the way the root collation does: by primary weight
+first, digits before letters and letters alphabetically regardless of case; then, if those are all
+equal and case matters, lowercase before uppercase at the first position where the case differs.
+*/
+static int32_t CompareAsciiAlphanumeric(const UChar* lpStr1, int32_t cwStr1Length, const UChar* lpStr2, int32_t cwStr2Length, int32_t isIgnoreCase)
+{
+    int32_t length = cwStr1Length < cwStr2Length ? cwStr1Length : cwStr2Length;
+    int32_t tertiaryResult = UCOL_EQUAL;
+
+    for (int32_t i = 0; i < length; i++)
+    {
+        UChar c1 = lpStr1[i];
+        UChar c2 = lpStr2[i];
+        if (c1 == c2)
+        {
+            continue;
+        }
+
+        // Digits are below letters in ASCII, and setting 0x20 folds uppercase letters to lowercase.
+        UChar primary1 = c1 <= '9' ? c1 : (UChar)(c1 | 0x20);
+        UChar primary2 = c2 <= '9' ? c2 : (UChar)(c2 | 0x20);
+        if (primary1 != primary2)
+        {
+            return primary1 < primary2 ? UCOL_LESS : UCOL_GREATER;
+        }
+
+        if (tertiaryResult == UCOL_EQUAL)
+        {
+            // The characters are the same letter in different case.
+            tertiaryResult = c1 > c2 ? UCOL_LESS : UCOL_GREATER;
+        }
+    }
+
+    if (cwStr1Length != cwStr2Length)
+    {
+        return cwStr1Length < cwStr2Length ? UCOL_LESS : UCOL_GREATER;
+    }
+
+    return isIgnoreCase ? UCOL_EQUAL : tertiaryResult;
+}
+
+/*
+Returns true if pCollator orders ASCII letters and digits exactly like CompareAsciiAlphanumeric. That
+is the case for collators without tailoring rules, unless locale keywords change numeric ordering,
+case ordering, strength or the script order, all of which the probes below would catch.
+*/
+static int HasAsciiAlphanumericRootOrder(const UCollator* pCollator)
+{
+    int32_t rulesLength = 0;
+    ucol_getRules(pCollator, &rulesLength);
+    if (rulesLength != 0)
+    {
+        return false;
+    }
+
+    static const UChar probeOrder[] = {
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
+        'a', 'A', 'b', 'B', 'c', 'C', 'd', 'D', 'e', 'E', 'f', 'F', 'g', 'G', 'h', 'H', 'i', 'I', 'j', 'J',
+        'k', 'K', 'l', 'L', 'm', 'M', 'n', 'N', 'o', 'O', 'p', 'P', 'q', 'Q', 'r', 'R', 's', 'S', 't', 'T',
+        'u', 'U', 'v', 'V', 'w', 'W', 'x', 'X', 'y', 'Y', 'z', 'Z'
+    };
+
+    for (size_t i = 1; i < sizeof(probeOrder) / sizeof(probeOrder[0]); i++)
+    {
+        if (ucol_strcoll(pCollator, &probeOrder[i - 1], 1, &probeOrder[i], 1) != UCOL_LESS)
+        {
+            return false;
+        }
+    }
+
+    static const UChar ten[] = { '1', '0' };
+    static const UChar nine[] = { '9' };
+    static const UChar lowerUpper[] = { 'a', 'B' };
+    static const UChar upperLower[] = { 'A', 'b' };
+
+    return ucol_strcoll(pCollator, ten, 2, nine, 1) == UCOL_LESS &&
+        ucol_strcoll(pCollator, lowerUpper, 2, upperLower, 2) == UCOL_LESS;
+}
+
 static void CreateSortHandle(SortHandle** ppSortHandle)
 {
     *ppSortHandle = (SortHandle*)calloc(1, sizeof(SortHandle));
@@ -483,6 +583,10 @@ ResultCode GlobalizationNative_GetSortHandle(const char* lpLocaleName, SortHandl
         free(*ppSortHandle);
         (*ppSortHandle) = NULL;
     }
+    else
+    {
+        (*ppSortHandle)->isAsciiAlphanumericRootOrder = HasAsciiAlphanumericRootOrder((*ppSortHandle)->collatorsPerOption[0]);
+    }
 
     return GetResultCode(err);
 }
@@ -904,6 +1008,17 @@ CompareString
 int32_t GlobalizationNative_CompareString(
     SortHandle* pSortHandle, const UChar* lpStr1, int32_t cwStr1Length, const UChar* lpStr2, int32_t cwStr2Length, int32_t options)
 {
+    // Strings of ASCII letters and digits, which are common identifiers and keys, don't need ICU
+    // when the locale sorts them like the root collation. Ignoring case only affects the tertiary
+    // level, and none of the other options changes how these characters compare.
+    if (pSortHandle->isAsciiAlphanumericRootOrder &&
+        (options == 0 || options == CompareOptionsIgnoreCase) &&
+        IsAsciiAlphanumericString(lpStr1, cwStr1Length) &&
+        IsAsciiAlphanumericString(lpStr2, cwStr2Length))
+    {
+        return CompareAsciiAlphanumeric(lpStr1, cwStr1Length, lpStr2, cwStr2Length, options == CompareOptionsIgnoreCase);
+    }
+
     UCollationResult result = UCOL_EQUAL;
     UErrorCode err = U_ZERO_ERROR;
     const UCollator* pColl = GetCollatorFromSortHandle(pSortHandle, options, &err);
@@ -1360,3 +1475,59 @@ int32_t GlobalizationNative_GetSortKey(
 
     return result;
 }
+
+/*
+Function:
+GetSortKeys
+*/
+int32_t GlobalizationNative_GetSortKeys(
+                        SortHandle* pSortHandle,
+                        const UChar* lpStrings,
+                        const int32_t* pStringLengths,
+                        int32_t count,
+                        uint8_t* sortKeys,
+                        int32_t cbSortKeysLength,
+                        int32_t* pSortKeyLengths,
+                        int32_t options)
+{
+    UErrorCode err = U_ZERO_ERROR;
+    const UCollator* pColl = GetCollatorFromSortHandle(pSortHandle, options, &err);
+
+    if (U_FAILURE(err))
+    {
+        return 0;
+    }
+
+    // The collator is looked up once for the whole batch. Keys are written back to back while they
+    // fit; the rest only get their lengths so that the caller can size the buffer and retry.
+    int32_t written = 0;
+    int32_t required = 0;
+    bool fits = true;
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        int32_t available = fits ? cbSortKeysLength - written : 0;
+        int32_t keyLength = ucol_getSortKey(pColl, lpStrings, pStringLengths[i], available > 0 ? sortKeys + written : NULL, available);
+
+        pSortKeyLengths[i] = keyLength;
+        lpStrings += pStringLengths[i];
+
+        if (keyLength > INT32_MAX - required)
+        {
+            return 0;
+        }
+
+        required += keyLength;
+
+        if (fits && keyLength <= available)
+        {
+            written += keyLength;
+        }
+        else
+        {
+            fits = false;
+        }
+    }
+
+    return required;
+}
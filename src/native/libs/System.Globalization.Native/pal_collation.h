@@ -65,6 +65,18 @@ PALEXPORT int32_t GlobalizationNative_GetSortKey(SortHandle* pSortHandle,
                                                  uint8_t* sortKey,
                                                  int32_t cbSortKeyLength,
                                                  int32_t options);
+
+// Computes the sort keys of count strings laid out back to back in lpStrings. The keys are written
+// back to back to sortKeys and their lengths to pSortKeyLengths. Returns the total length of the keys,
+// which is larger than cbSortKeysLength if they didn't all fit, or 0 on failure.
+PALEXPORT int32_t GlobalizationNative_GetSortKeys(SortHandle* pSortHandle,
+                                                  const UChar* lpStrings,
+                                                  const int32_t* pStringLengths,
+                                                  int32_t count,
+                                                  uint8_t* sortKeys,
+                                                  int32_t cbSortKeysLength,
+                                                  int32_t* pSortKeyLengths,
+                                                  int32_t options);
 #if defined(APPLE_HYBRID_GLOBALIZATION)
 PALEXPORT int32_t GlobalizationNative_CompareStringNative(const uint16_t* localeName,
                                                           int32_t lNameLength,
@@ -24,9 +24,12 @@ static const Entry s_compressionNative[] =
     DllImportEntry(BrotliEncoderHasMoreOutput)
     DllImportEntry(BrotliEncoderSetParameter)
     DllImportEntry(CompressionNative_Crc32)
+    DllImportEntry(CompressionNative_Crc32Combine)
     DllImportEntry(CompressionNative_Deflate)
     DllImportEntry(CompressionNative_DeflateEnd)
     DllImportEntry(CompressionNative_DeflateInit2_)
+    DllImportEntry(CompressionNative_DeflateParallel)
+    DllImportEntry(CompressionNative_DeflateParallelBound)
     DllImportEntry(CompressionNative_Inflate)
     DllImportEntry(CompressionNative_InflateEnd)
     DllImportEntry(CompressionNative_InflateInit2_)
@@ -26,4 +26,10 @@ macro(append_extra_compression_libs NativeLibsExtra)
 
     list(APPEND ${NativeLibsExtra} ${BROTLIDEC} ${BROTLIENC})
   endif ()
+
+  if (CLR_CMAKE_USE_SYSTEM_ISAL)
+    find_library(ISAL isal REQUIRED)
+
+    list(APPEND ${NativeLibsExtra} ${ISAL})
+  endif ()
 endmacro()
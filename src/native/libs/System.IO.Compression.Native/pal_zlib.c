@@ -13,6 +13,11 @@
 #endif
 #include <zlib.h>
 
+#ifdef FEATURE_USE_ISAL
+#include <isa-l/igzip_lib.h>
+#include <minipal/cpufeatures.h>
+#endif
+
 c_static_assert(PAL_Z_NOFLUSH == Z_NO_FLUSH);
 c_static_assert(PAL_Z_FINISH == Z_FINISH);
 
@@ -32,16 +37,31 @@ c_static_assert(PAL_Z_DEFAULTSTRATEGY == Z_DEFAULT_STRATEGY);
 
 c_static_assert(PAL_Z_DEFLATED == Z_DEFLATED);
 
+#ifdef FEATURE_USE_ISAL
+/*
+The state behind PAL_ZStream.internalState. The z_stream comes first, so that the state can be
+used as a z_stream for streams that don't use ISA-L.
+*/
+typedef struct ZStreamState
+{
+    z_stream zStream;
+    struct isal_zstream* isalStream; // non-NULL for deflate streams compressed with ISA-L igzip
+    uint8_t* isalLevelBuffer;
+} ZStreamState;
+#else
+typedef z_stream ZStreamState;
+#endif
+
 /*
 Initializes the PAL_ZStream by creating and setting its underlying z_stream.
 */
 static int32_t Init(PAL_ZStream* stream)
 {
-    z_stream* zStream = (z_stream*)calloc(1, sizeof(z_stream));
+    ZStreamState* state = (ZStreamState*)calloc(1, sizeof(ZStreamState));
 
-    stream->internalState = zStream;
+    stream->internalState = state;
 
-    if (zStream != NULL)
+    if (state != NULL)
     {
         return PAL_Z_OK;
     }
@@ -56,11 +76,15 @@ Frees any memory on the PAL_ZStream that was created by Init.
 */
 static void End(PAL_ZStream* stream)
 {
-    z_stream* zStream = (z_stream*)(stream->internalState);
-    assert(zStream != NULL);
-    if (zStream != NULL)
+    ZStreamState* state = (ZStreamState*)(stream->internalState);
+    assert(state != NULL);
+    if (state != NULL)
     {
-        free(zStream);
+#ifdef FEATURE_USE_ISAL
+        free(state->isalLevelBuffer);
+        free(state->isalStream);
+#endif
+        free(state);
         stream->internalState = NULL;
     }
 }
@@ -106,6 +130,140 @@ static z_stream* GetCurrentZStream(PAL_ZStream* stream)
     return zStream;
 }
 
+#ifdef FEATURE_USE_ISAL
+/*
+ISA-L igzip is used for level 1 (fastest) deflate streams, where it compresses several times faster
+than zlib-ng, on CPUs where its vectorized code paths pay off. The output differs from zlib's but is
+standard deflate, zlib or gzip data. zlib-ng, which dispatches to its own SIMD code at runtime, handles
+all other levels and all inflate streams.
+*/
+static int IsIsalSupportedByCpu(void)
+{
+    static volatile int s_supported = -1;
+
+    int supported = s_supported;
+    if (supported == -1)
+    {
+        int cpuFeatures = minipal_getcpufeatures();
+#if defined(HOST_AMD64) || defined(HOST_X86)
+        supported = (cpuFeatures & XArchIntrinsicConstants_Avx2) != 0;
+#elif defined(HOST_ARM64)
+        supported = (cpuFeatures & ARM64IntrinsicConstants_AdvSimd) != 0;
+#else
+        (void)cpuFeatures;
+        supported = 0;
+#endif
+        s_supported = supported;
+    }
+
+    return supported;
+}
+
+static int32_t TryIsalDeflateInit(ZStreamState* state, int32_t level, int32_t method, int32_t windowBits, int32_t strategy)
+{
+    if (level != PAL_Z_BESTSPEED || method != Z_DEFLATED || strategy != Z_DEFAULT_STRATEGY || !IsIsalSupportedByCpu())
+    {
+        return 0;
+    }
+
+    // Same encoding of the format in windowBits as deflateInit2.
+    uint16_t gzipFlag;
+    int32_t historyBits;
+    if (windowBits >= -15 && windowBits <= -8)
+    {
+        gzipFlag = IGZIP_DEFLATE;
+        historyBits = -windowBits;
+    }
+    else if (windowBits >= 8 && windowBits <= 15)
+    {
+        gzipFlag = IGZIP_ZLIB;
+        historyBits = windowBits;
+    }
+    else if (windowBits >= 24 && windowBits <= 31)
+    {
+        gzipFlag = IGZIP_GZIP;
+        historyBits = windowBits - 16;
+    }
+    else
+    {
+        return 0;
+    }
+
+    struct isal_zstream* isalStream = (struct isal_zstream*)malloc(sizeof(struct isal_zstream));
+    uint8_t* levelBuffer = (uint8_t*)malloc(ISAL_DEF_LVL1_DEFAULT);
+    if (isalStream == NULL || levelBuffer == NULL)
+    {
+        // Leave it to zlib-ng, which reports the out of memory condition if it persists.
+        free(isalStream);
+        free(levelBuffer);
+        return 0;
+    }
+
+    isal_deflate_init(isalStream);
+    isalStream->level = 1;
+    isalStream->level_buf = levelBuffer;
+    isalStream->level_buf_size = ISAL_DEF_LVL1_DEFAULT;
+    isalStream->gzip_flag = gzipFlag;
+    isalStream->hist_bits = (uint16_t)historyBits;
+
+    state->isalStream = isalStream;
+    state->isalLevelBuffer = levelBuffer;
+    return 1;
+}
+
+static int32_t IsalDeflate(ZStreamState* state, int32_t flush)
+{
+    struct isal_zstream* isalStream = state->isalStream;
+    z_stream* zStream = &state->zStream;
+
+    switch (flush)
+    {
+        case Z_NO_FLUSH:
+            isalStream->flush = NO_FLUSH;
+            break;
+        case Z_SYNC_FLUSH:
+            isalStream->flush = SYNC_FLUSH;
+            break;
+        case Z_FULL_FLUSH:
+            isalStream->flush = FULL_FLUSH;
+            break;
+        case Z_FINISH:
+            isalStream->flush = NO_FLUSH;
+            isalStream->end_of_stream = 1;
+            break;
+        default:
+            return PAL_Z_STREAMERROR;
+    }
+
+    isalStream->next_in = zStream->next_in;
+    isalStream->avail_in = zStream->avail_in;
+    isalStream->next_out = zStream->next_out;
+    isalStream->avail_out = zStream->avail_out;
+
+    int ret = isal_deflate(isalStream);
+
+    int madeProgress = isalStream->avail_in != zStream->avail_in || isalStream->avail_out != zStream->avail_out;
+    zStream->next_in = isalStream->next_in;
+    zStream->avail_in = isalStream->avail_in;
+    zStream->next_out = isalStream->next_out;
+    zStream->avail_out = isalStream->avail_out;
+    zStream->msg = NULL;
+
+    if (ret != COMP_OK)
+    {
+        return PAL_Z_STREAMERROR;
+    }
+
+    if (isalStream->internal_state.state == ZSTATE_END)
+    {
+        return PAL_Z_STREAMEND;
+    }
+
+    // Same as zlib, a call that couldn't do anything reports Z_BUF_ERROR.
+    return madeProgress ? PAL_Z_OK : PAL_Z_BUFERROR;
+}
+#endif // FEATURE_USE_ISAL
+
 int32_t CompressionNative_DeflateInit2_(
     PAL_ZStream* stream, int32_t level, int32_t method, int32_t windowBits, int32_t memLevel, int32_t strategy)
 {
@@ -115,6 +273,13 @@ int32_t CompressionNative_DeflateInit2_(
     if (result == PAL_Z_OK)
     {
         z_stream* zStream = GetCurrentZStream(stream);
+#ifdef FEATURE_USE_ISAL
+        if (TryIsalDeflateInit((ZStreamState*)zStream, level, method, windowBits, strategy))
+        {
+            TransferStateToPalZStream(zStream, stream);
+            return PAL_Z_OK;
+        }
+#endif
         result = deflateInit2(zStream, level, method, windowBits, memLevel, strategy);
         TransferStateToPalZStream(zStream, stream);
     }
@@ -127,7 +292,12 @@ int32_t CompressionNative_Deflate(PAL_ZStream* stream, int32_t flush)
     assert(stream != NULL);
 
     z_stream* zStream = GetCurrentZStream(stream);
+#ifdef FEATURE_USE_ISAL
+    ZStreamState* state = (ZStreamState*)zStream;
+    int32_t result = state->isalStream != NULL ? IsalDeflate(state, flush) : deflate(zStream, flush);
+#else
     int32_t result = deflate(zStream, flush);
+#endif
     TransferStateToPalZStream(zStream, stream);
 
     return result;
@@ -138,7 +308,11 @@ int32_t CompressionNative_DeflateEnd(PAL_ZStream* stream)
     assert(stream != NULL);
 
     z_stream* zStream = GetCurrentZStream(stream);
+#ifdef FEATURE_USE_ISAL
+    int32_t result = ((ZStreamState*)zStream)->isalStream != NULL ? PAL_Z_OK : deflateEnd(zStream);
+#else
     int32_t result = deflateEnd(zStream);
+#endif
     End(stream);
 
     return result;
@@ -131,3 +131,40 @@ updated CRC-32.
 Returns the updated CRC-32.
 */
 FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENTION CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len);
+
+/*
+Combines the CRC-32 crc1 of a first block of data with the CRC-32 crc2 of a second block of len2
+bytes into the CRC-32 of both blocks, so that the CRC-32 of data checked in parts, possibly in
+parallel, doesn't need another pass over the data.
+
+Returns the combined CRC-32.
+*/
+FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENTION CompressionNative_Crc32Combine(uint32_t crc1, uint32_t crc2, int64_t len2);
+
+/*
+Returns the size of an output buffer that is large enough for CompressionNative_DeflateParallel to
+compress inputLength bytes with the given windowBits and blockSize, or -1 if the arguments are not valid.
+*/
+FUNCTIONEXPORT int64_t FUNCTIONCALLINGCONVENTION CompressionNative_DeflateParallelBound(int64_t inputLength, int32_t windowBits, int32_t blockSize);
+
+/*
+Compresses input into output in a single call, splitting the input into blocks of blockSize bytes
+(128KB if blockSize is 0) that are compressed on up to threadCount threads. Each block is primed with
+the window of input before it, so the ratio stays close to that of CompressionNative_Deflate. The
+output is a single raw deflate, zlib or gzip stream as selected by windowBits, as for
+CompressionNative_DeflateInit2_.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure. On success, bytesWritten
+is set to the length of the compressed stream.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_DeflateParallel(
+    uint8_t* input,
+    int64_t inputLength,
+    uint8_t* output,
+    int64_t outputLength,
+    int64_t* bytesWritten,
+    int32_t level,
+    int32_t windowBits,
+    int32_t memLevel,
+    int32_t blockSize,
+    int32_t threadCount);
@@ -0,0 +1,464 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pal_zlib.h"
+
+#include <zlib.h>
+
+#if defined(_WIN32)
+#define PARALLEL_DEFLATE_WIN32_THREADS 1
+#elif defined(__EMSCRIPTEN__) || defined(__wasi__)
+// Single-threaded targets compress all the blocks on the calling thread.
+#else
+#define PARALLEL_DEFLATE_PTHREADS 1
+#include <pthread.h>
+#endif
+
+/*
+Parallel deflate, in the style of pigz.
+
+The input is split into blocks that are compressed independently as raw deflate streams, each one
+primed with the last window of the input that precedes it so that matches can still reach back into
+the previous block. Every block but the last ends with a sync flush, which ends it on a byte boundary
+without marking it final, so the compressed blocks can simply be concatenated. The gzip or zlib
+check value is computed per block and combined afterwards.
+*/
+
+#define DEFAULT_PARALLEL_BLOCK_SIZE (128 * 1024)
+#define MAX_PARALLEL_DEFLATE_THREADS 64
+
+// Room a block needs on top of deflateBound for the empty stored block of the sync flush.
+#define SYNC_FLUSH_OVERHEAD 16
+
+#define GZIP_HEADER_SIZE 10
+#define GZIP_TRAILER_SIZE 8
+#define ZLIB_HEADER_SIZE 2
+#define ZLIB_TRAILER_SIZE 4
+
+enum ParallelDeflateFormat
+{
+    ParallelDeflateFormat_Raw,
+    ParallelDeflateFormat_Zlib,
+    ParallelDeflateFormat_Gzip,
+};
+
+typedef struct ParallelDeflateBlock
+{
+    uint8_t* output;
+    int64_t outputLength;
+    uint32_t check; // crc32 (gzip) or adler32 (zlib) of the block's input
+    int32_t result;
+} ParallelDeflateBlock;
+
+typedef struct ParallelDeflateState
+{
+    const uint8_t* input;
+    int64_t inputLength;
+    int64_t blockSize;
+    int64_t blockCount;
+    ParallelDeflateBlock* blocks;
+    int32_t level;
+    int32_t windowBits; // log2 of the window size, 8..15
+    int32_t memLevel;
+    int32_t format;
+    int32_t threadCount;
+} ParallelDeflateState;
+
+typedef struct ParallelDeflateWorker
+{
+    ParallelDeflateState* state;
+    int32_t index;
+} ParallelDeflateWorker;
+
+/*
+Splits windowBits the way deflateInit2 interprets it into the format and the window size.
+
+Returns 0 if windowBits is not valid.
+*/
+static int32_t ParseWindowBits(int32_t windowBits, int32_t* format, int32_t* windowSizeBits)
+{
+    if (windowBits < 0)
+    {
+        *format = ParallelDeflateFormat_Raw;
+        windowBits = -windowBits;
+    }
+    else if (windowBits > 15)
+    {
+        *format = ParallelDeflateFormat_Gzip;
+        windowBits -= 16;
+    }
+    else
+    {
+        *format = ParallelDeflateFormat_Zlib;
+    }
+
+    *windowSizeBits = windowBits;
+    return windowBits >= 8 && windowBits <= 15;
+}
+
+static uint32_t InitialCheck(int32_t format)
+{
+    return format == ParallelDeflateFormat_Gzip ? (uint32_t)crc32(0, Z_NULL, 0) : (uint32_t)adler32(0, Z_NULL, 0);
+}
+
+static int64_t HeaderSize(int32_t format)
+{
+    return format == ParallelDeflateFormat_Gzip ? GZIP_HEADER_SIZE : (format == ParallelDeflateFormat_Zlib ? ZLIB_HEADER_SIZE : 0);
+}
+
+static int64_t TrailerSize(int32_t format)
+{
+    return format == ParallelDeflateFormat_Gzip ? GZIP_TRAILER_SIZE : (format == ParallelDeflateFormat_Zlib ? ZLIB_TRAILER_SIZE : 0);
+}
+
+static uint32_t UpdateCheck(int32_t format, uint32_t check, const uint8_t* buffer, uInt length)
+{
+    if (format == ParallelDeflateFormat_Gzip)
+    {
+        return (uint32_t)crc32(check, buffer, length);
+    }
+
+    return (uint32_t)adler32(check, buffer, length);
+}
+
+static void CompressBlock(ParallelDeflateState* state, int64_t index)
+{
+    ParallelDeflateBlock* block = &state->blocks[index];
+    int64_t start = index * state->blockSize;
+    int64_t remaining = state->inputLength - start;
+    uInt length = (uInt)(remaining < state->blockSize ? remaining : state->blockSize);
+    int32_t isLast = index == state->blockCount - 1;
+
+    if (state->format != ParallelDeflateFormat_Raw)
+    {
+        block->check = UpdateCheck(state->format, InitialCheck(state->format), state->input + start, length);
+    }
+
+    z_stream zStream;
+    memset(&zStream, 0, sizeof(zStream));
+    block->result = deflateInit2(&zStream, state->level, Z_DEFLATED, -state->windowBits, state->memLevel, Z_DEFAULT_STRATEGY);
+    if (block->result != Z_OK)
+    {
+        return;
+    }
+
+    if (start > 0)
+    {
+        int64_t windowSize = (int64_t)1 << state->windowBits;
+        uInt dictionaryLength = (uInt)(start < windowSize ? start : windowSize);
+        block->result = deflateSetDictionary(&zStream, state->input + start - dictionaryLength, dictionaryLength);
+    }
+
+    if (block->result == Z_OK)
+    {
+        uLong capacity = deflateBound(&zStream, length) + SYNC_FLUSH_OVERHEAD;
+        block->output = (uint8_t*)malloc(capacity);
+        if (block->output == NULL)
+        {
+            block->result = Z_MEM_ERROR;
+        }
+        else
+        {
+            zStream.next_in = (Bytef*)(state->input + start);
+            zStream.avail_in = length;
+            zStream.next_out = block->output;
+            zStream.avail_out = (uInt)capacity;
+
+            int32_t result = deflate(&zStream, isLast ? Z_FINISH : Z_SYNC_FLUSH);
+
+            // The output buffer is large enough for the whole block, so a single call either finishes
+            // the stream or consumes all the input and flushes it.
+            if (isLast ? result == Z_STREAM_END : (result == Z_OK && zStream.avail_in == 0 && zStream.avail_out != 0))
+            {
+                block->outputLength = (int64_t)(capacity - zStream.avail_out);
+                block->result = Z_OK;
+            }
+            else
+            {
+                block->result = result == Z_OK || result == Z_STREAM_END ? Z_BUF_ERROR : result;
+            }
+        }
+    }
+
+    deflateEnd(&zStream);
+}
+
+/*
+Worker i compresses blocks i, i + threadCount, i + 2 * threadCount, ... so that the workers don't
+need to coordinate.
+*/
+static void RunWorker(ParallelDeflateWorker* worker)
+{
+    ParallelDeflateState* state = worker->state;
+    for (int64_t index = worker->index; index < state->blockCount; index += state->threadCount)
+    {
+        CompressBlock(state, index);
+    }
+}
+
+#if defined(PARALLEL_DEFLATE_WIN32_THREADS)
+static DWORD WINAPI WorkerThreadProc(LPVOID context)
+{
+    RunWorker((ParallelDeflateWorker*)context);
+    return 0;
+}
+#elif defined(PARALLEL_DEFLATE_PTHREADS)
+static void* WorkerThreadProc(void* context)
+{
+    RunWorker((ParallelDeflateWorker*)context);
+    return NULL;
+}
+#endif
+
+static void RunWorkers(ParallelDeflateState* state, ParallelDeflateWorker* workers)
+{
+#if defined(PARALLEL_DEFLATE_WIN32_THREADS)
+    HANDLE threads[MAX_PARALLEL_DEFLATE_THREADS];
+#elif defined(PARALLEL_DEFLATE_PTHREADS)
+    pthread_t threads[MAX_PARALLEL_DEFLATE_THREADS];
+    int32_t started[MAX_PARALLEL_DEFLATE_THREADS];
+#endif
+
+    for (int32_t i = 0; i < state->threadCount; i++)
+    {
+        workers[i].state = state;
+        workers[i].index = i;
+    }
+
+    // The calling thread runs the first worker. A worker whose thread can't be started is run on the
+    // calling thread as well.
+    for (int32_t i = 1; i < state->threadCount; i++)
+    {
+#if defined(PARALLEL_DEFLATE_WIN32_THREADS)
+        threads[i] = CreateThread(NULL, 0, WorkerThreadProc, &workers[i], 0, NULL);
+        if (threads[i] == NULL)
+        {
+            RunWorker(&workers[i]);
+        }
+#elif defined(PARALLEL_DEFLATE_PTHREADS)
+        started[i] = pthread_create(&threads[i], NULL, WorkerThreadProc, &workers[i]) == 0;
+        if (!started[i])
+        {
+            RunWorker(&workers[i]);
+        }
+#else
+        RunWorker(&workers[i]);
+#endif
+    }
+
+    RunWorker(&workers[0]);
+
+    for (int32_t i = 1; i < state->threadCount; i++)
+    {
+#if defined(PARALLEL_DEFLATE_WIN32_THREADS)
+        if (threads[i] != NULL)
+        {
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+        }
+#elif defined(PARALLEL_DEFLATE_PTHREADS)
+        if (started[i])
+        {
+            pthread_join(threads[i], NULL);
+        }
+#endif
+    }
+}
+
+static void WriteHeader(uint8_t* output, int32_t format, int32_t level, int32_t windowBits)
+{
+    if (format == ParallelDeflateFormat_Gzip)
+    {
+        // No name, comment or modification time; the operating system is Unix, as pigz writes it.
+        uint8_t header[GZIP_HEADER_SIZE] = { 0x1f, 0x8b, Z_DEFLATED, 0, 0, 0, 0, 0, 0, 3 };
+        header[8] = level == Z_BEST_COMPRESSION ? 2 : (level == Z_BEST_SPEED ? 4 : 0);
+        memcpy(output, header, GZIP_HEADER_SIZE);
+    }
+    else if (format == ParallelDeflateFormat_Zlib)
+    {
+        uint32_t levelFlags;
+        if (level == Z_DEFAULT_COMPRESSION || level == 6)
+        {
+            levelFlags = 2;
+        }
+        else
+        {
+            levelFlags = level < 2 ? 0 : (level < 6 ? 1 : 3);
+        }
+
+        uint32_t header = ((Z_DEFLATED + ((uint32_t)(windowBits - 8) << 4)) << 8) | (levelFlags << 6);
+        header += 31 - (header % 31);
+        output[0] = (uint8_t)(header >> 8);
+        output[1] = (uint8_t)header;
+    }
+}
+
+static void WriteTrailer(uint8_t* output, int32_t format, uint32_t check, int64_t inputLength)
+{
+    if (format == ParallelDeflateFormat_Gzip)
+    {
+        // Little-endian CRC-32 and the input length modulo 2^32.
+        uint32_t size = (uint32_t)inputLength;
+        for (int32_t i = 0; i < 4; i++)
+        {
+            output[i] = (uint8_t)(check >> (8 * i));
+            output[4 + i] = (uint8_t)(size >> (8 * i));
+        }
+    }
+    else if (format == ParallelDeflateFormat_Zlib)
+    {
+        // Big-endian Adler-32.
+        for (int32_t i = 0; i < 4; i++)
+        {
+            output[i] = (uint8_t)(check >> (24 - 8 * i));
+        }
+    }
+}
+
+int64_t CompressionNative_DeflateParallelBound(int64_t inputLength, int32_t windowBits, int32_t blockSize)
+{
+    int32_t format, windowSizeBits;
+    if (inputLength < 0 || !ParseWindowBits(windowBits, &format, &windowSizeBits))
+    {
+        return -1;
+    }
+
+    int64_t effectiveBlockSize = blockSize > 0 ? blockSize : DEFAULT_PARALLEL_BLOCK_SIZE;
+    int64_t blockCount = inputLength == 0 ? 1 : (inputLength + effectiveBlockSize - 1) / effectiveBlockSize;
+
+    // A generous version of deflateBound for every block, which covers stored blocks for
+    // incompressible input, plus the sync flush that ends it.
+    int64_t bound = inputLength + (inputLength >> 10) + blockCount * (32 + SYNC_FLUSH_OVERHEAD);
+    return bound + GZIP_HEADER_SIZE + GZIP_TRAILER_SIZE;
+}
+
+int32_t CompressionNative_DeflateParallel(
+    uint8_t* input,
+    int64_t inputLength,
+    uint8_t* output,
+    int64_t outputLength,
+    int64_t* bytesWritten,
+    int32_t level,
+    int32_t windowBits,
+    int32_t memLevel,
+    int32_t blockSize,
+    int32_t threadCount)
+{
+    assert(input != NULL || inputLength == 0);
+    assert(output != NULL);
+    assert(bytesWritten != NULL);
+
+    *bytesWritten = 0;
+
+    ParallelDeflateState state;
+    memset(&state, 0, sizeof(state));
+    if (inputLength < 0 || threadCount < 1 || !ParseWindowBits(windowBits, &state.format, &state.windowBits))
+    {
+        return PAL_Z_STREAMERROR;
+    }
+
+    state.input = input;
+    state.inputLength = inputLength;
+    state.blockSize = blockSize > 0 ? blockSize : DEFAULT_PARALLEL_BLOCK_SIZE;
+    state.blockCount = inputLength == 0 ? 1 : (inputLength + state.blockSize - 1) / state.blockSize;
+    state.level = level;
+    state.memLevel = memLevel;
+
+    state.threadCount = threadCount < MAX_PARALLEL_DEFLATE_THREADS ? threadCount : MAX_PARALLEL_DEFLATE_THREADS;
+    if (state.threadCount > state.blockCount)
+    {
+        state.threadCount = (int32_t)state.blockCount;
+    }
+
+    state.blocks = (ParallelDeflateBlock*)calloc((size_t)state.blockCount, sizeof(ParallelDeflateBlock));
+    ParallelDeflateWorker* workers = (ParallelDeflateWorker*)calloc((size_t)state.threadCount, sizeof(ParallelDeflateWorker));
+    if (state.blocks == NULL || workers == NULL)
+    {
+        free(state.blocks);
+        free(workers);
+        return PAL_Z_MEMERROR;
+    }
+
+    RunWorkers(&state, workers);
+    free(workers);
+
+    int32_t result = PAL_Z_OK;
+    int64_t written = 0;
+    uint32_t check = InitialCheck(state.format);
+
+    if (outputLength < HeaderSize(state.format))
+    {
+        result = PAL_Z_BUFERROR;
+    }
+    else
+    {
+        WriteHeader(output, state.format, level, state.windowBits);
+        written = HeaderSize(state.format);
+    }
+
+    for (int64_t i = 0; i < state.blockCount; i++)
+    {
+        ParallelDeflateBlock* block = &state.blocks[i];
+        if (result == PAL_Z_OK)
+        {
+            if (block->result != Z_OK)
+            {
+                result = block->result;
+            }
+            else if (block->outputLength > outputLength - written)
+            {
+                result = PAL_Z_BUFERROR;
+            }
+            else
+            {
+                int64_t start = i * state.blockSize;
+                int64_t remaining = inputLength - start;
+                int64_t length = remaining < state.blockSize ? remaining : state.blockSize;
+
+                memcpy(output + written, block->output, (size_t)block->outputLength);
+                written += block->outputLength;
+
+                if (i == 0)
+                {
+                    check = block->check;
+                }
+                else if (state.format == ParallelDeflateFormat_Gzip)
+                {
+                    check = (uint32_t)crc32_combine(check, block->check, (z_off_t)length);
+                }
+                else if (state.format == ParallelDeflateFormat_Zlib)
+                {
+                    check = (uint32_t)adler32_combine(check, block->check, (z_off_t)length);
+                }
+            }
+        }
+
+        free(block->output);
+    }
+
+    free(state.blocks);
+
+    if (result == PAL_Z_OK)
+    {
+        if (outputLength - written < TrailerSize(state.format))
+        {
+            return PAL_Z_BUFERROR;
+        }
+
+        WriteTrailer(output + written, state.format, check, inputLength);
+        written += TrailerSize(state.format);
+        *bytesWritten = written;
+    }
+
+    return result;
+}
+
+uint32_t CompressionNative_Crc32Combine(uint32_t crc1, uint32_t crc2, int64_t len2)
+{
+    unsigned long result = crc32_combine(crc1, crc2, (z_off_t)len2);
+    assert(result <= UINT32_MAX);
+    return (uint32_t)result;
+}
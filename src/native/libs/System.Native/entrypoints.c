@@ -12,6 +12,7 @@
 #include "pal_errno.h"
 #include "pal_interfaceaddresses.h"
 #include "pal_io.h"
+#include "pal_io_uring.h"
 #include "pal_iossupportversion.h"
 #include "pal_log.h"
 #include "pal_memory.h"
@@ -109,6 +110,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_Sync)
     DllImportEntry(SystemNative_Write)
     DllImportEntry(SystemNative_CopyFile)
+    DllImportEntry(SystemNative_CopyFileWithProgress)
     DllImportEntry(SystemNative_INotifyInit)
     DllImportEntry(SystemNative_INotifyAddWatch)
     DllImportEntry(SystemNative_INotifyRemoveWatch)
@@ -164,6 +166,13 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_ReceiveSocketError)
     DllImportEntry(SystemNative_Send)
     DllImportEntry(SystemNative_SendMessage)
+    DllImportEntry(SystemNative_ReceiveMessages)
+    DllImportEntry(SystemNative_SendMessages)
+    DllImportEntry(SystemNative_GetUdpSegmentControlMessageBufferSize)
+    DllImportEntry(SystemNative_SetUdpSegmentControlMessage)
+    DllImportEntry(SystemNative_GetMessagesControlInformation)
+    DllImportEntry(SystemNative_SetUdpSegmentationOffload)
+    DllImportEntry(SystemNative_SetUdpReceiveOffload)
     DllImportEntry(SystemNative_Accept)
     DllImportEntry(SystemNative_Bind)
     DllImportEntry(SystemNative_Connect)
@@ -187,10 +196,27 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_FreeSocketEventBuffer)
     DllImportEntry(SystemNative_TryChangeSocketEventRegistration)
     DllImportEntry(SystemNative_WaitForSocketEvents)
+    DllImportEntry(SystemNative_IoUringCreate)
+    DllImportEntry(SystemNative_IoUringClose)
+    DllImportEntry(SystemNative_IoUringRegisterBuffers)
+    DllImportEntry(SystemNative_IoUringUnregisterBuffers)
+    DllImportEntry(SystemNative_IoUringPrepareProvideBuffers)
+    DllImportEntry(SystemNative_IoUringPrepareAccept)
+    DllImportEntry(SystemNative_IoUringPrepareReceive)
+    DllImportEntry(SystemNative_IoUringPrepareReceiveMultishot)
+    DllImportEntry(SystemNative_IoUringPrepareSend)
+    DllImportEntry(SystemNative_IoUringPrepareRead)
+    DllImportEntry(SystemNative_IoUringPrepareWrite)
+    DllImportEntry(SystemNative_IoUringPrepareCancel)
+    DllImportEntry(SystemNative_IoUringSubmitAndWait)
     DllImportEntry(SystemNative_PlatformSupportsDualModeIPv4PacketInfo)
     DllImportEntry(SystemNative_GetDomainSocketSizes)
     DllImportEntry(SystemNative_GetMaximumAddressSize)
     DllImportEntry(SystemNative_SendFile)
+    DllImportEntry(SystemNative_SpliceSockets)
+    DllImportEntry(SystemNative_SetZeroCopyEnabled)
+    DllImportEntry(SystemNative_SendZeroCopy)
+    DllImportEntry(SystemNative_ReadZeroCopyCompletions)
     DllImportEntry(SystemNative_Disconnect)
     DllImportEntry(SystemNative_InterfaceNameToIndex)
     DllImportEntry(SystemNative_GetTcpGlobalStatistics)
@@ -270,6 +296,8 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_PWrite)
     DllImportEntry(SystemNative_PReadV)
     DllImportEntry(SystemNative_PWriteV)
+    DllImportEntry(SystemNative_PReadV2)
+    DllImportEntry(SystemNative_PWriteV2)
     DllImportEntry(SystemNative_CreateThread)
     DllImportEntry(SystemNative_EnablePosixSignalHandling)
     DllImportEntry(SystemNative_DisablePosixSignalHandling)
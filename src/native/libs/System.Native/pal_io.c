@@ -70,6 +70,7 @@ extern int     getpeereid(int, uid_t *__restrict__, gid_t *__restrict__);
 #endif
 
 #ifdef __linux__
+#include <pthread.h>
 #include <sys/utsname.h>
 
 // Ensure FICLONE is defined for all Linux builds.
@@ -1393,13 +1394,184 @@ static bool SupportsCopyFileRange(void)
 }
 #endif
 
+#ifdef __linux__
+// Files of at least this size that can't be cloned are copied with several copy_file_range
+// calls in parallel, each on its own range of the file.
+#define ParallelCopyMinimumLength ((int64_t)256 * 1024 * 1024)
+#define ParallelCopyChunkLength ((int64_t)32 * 1024 * 1024)
+#define ParallelCopyMaxThreads 4
+
+typedef struct
+{
+    int inFd;
+    int outFd;
+    int64_t inOffset;
+    int64_t outOffset;
+    int64_t length;
+    int64_t nextChunk;   // offset of the next chunk to hand out, advanced atomically
+    int64_t bytesCopied; // advanced atomically
+    int error;           // first error, 0 if none
+    int stop;            // set when a thread fails, the source is shorter than expected or the copy is cancelled
+} ParallelCopyState;
+
+// Copies chunks until none are left. Returns false when the copy stops.
+static bool ParallelCopyNextChunk(ParallelCopyState* state)
+{
+    if (__atomic_load_n(&state->stop, __ATOMIC_RELAXED))
+    {
+        return false;
+    }
+
+    int64_t chunk = __atomic_fetch_add(&state->nextChunk, ParallelCopyChunkLength, __ATOMIC_RELAXED);
+    if (chunk >= state->length)
+    {
+        return false;
+    }
+
+    int64_t remaining = state->length - chunk < ParallelCopyChunkLength ? state->length - chunk : ParallelCopyChunkLength;
+    loff_t inOffset = (loff_t)(state->inOffset + chunk);
+    loff_t outOffset = (loff_t)(state->outOffset + chunk);
+    while (remaining > 0 && !__atomic_load_n(&state->stop, __ATOMIC_RELAXED))
+    {
+        ssize_t copied;
+        while ((copied = syscall(__NR_copy_file_range, state->inFd, &inOffset, state->outFd, &outOffset, (size_t)remaining, 0)) < 0 && errno == EINTR);
+        if (copied <= 0)
+        {
+            // 0 means the source is shorter than it was, which the callers treat as an error.
+            int expected = 0;
+            __atomic_compare_exchange_n(&state->error, &expected, copied == 0 ? EIO : errno, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+            __atomic_store_n(&state->stop, 1, __ATOMIC_RELAXED);
+            return false;
+        }
+
+        remaining -= copied;
+        __atomic_fetch_add(&state->bytesCopied, (int64_t)copied, __ATOMIC_RELAXED);
+    }
+
+    return true;
+}
+
+static void* ParallelCopyWorker(void* arg)
+{
+    ParallelCopyState* state = (ParallelCopyState*)arg;
+    while (ParallelCopyNextChunk(state));
+    return NULL;
+}
+
+static bool ReportCopyProgress(ParallelCopyState* state, CopyFileProgressCallback progress, void* context)
+{
+    if (progress != NULL && progress(context, __atomic_load_n(&state->bytesCopied, __ATOMIC_RELAXED)) != 0)
+    {
+        int expected = 0;
+        __atomic_compare_exchange_n(&state->error, &expected, ECANCELED, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        __atomic_store_n(&state->stop, 1, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    return true;
+}
+
+// Copies sourceLength bytes from the current positions of the descriptors, leaving both positioned
+// after the copied data. The calling thread copies chunks too and reports the progress after each.
+// Returns 0 on success, or -1 with errno set if nothing could be copied (*copiedAny is false) or
+// the copy failed part way.
+static int32_t CopyFileRangeParallel(int inFd, int outFd, int64_t sourceLength, CopyFileProgressCallback progress, void* context, bool* copiedAny)
+{
+    *copiedAny = false;
+
+    ParallelCopyState state;
+    memset(&state, 0, sizeof(state));
+    state.inFd = inFd;
+    state.outFd = outFd;
+    state.length = sourceLength;
+    state.inOffset = lseek(inFd, 0, SEEK_CUR);
+    state.outOffset = lseek(outFd, 0, SEEK_CUR);
+    if (state.inOffset < 0 || state.outOffset < 0)
+    {
+        return -1;
+    }
+
+#if HAVE_FALLOCATE
+    // Allocating the whole destination up front keeps the concurrent writers from fragmenting it.
+    // Failure is fine, the file system may not support it.
+    int ret;
+    while ((ret = fallocate(outFd, FALLOC_FL_KEEP_SIZE, (off_t)state.outOffset, (off_t)sourceLength)) == -1 && errno == EINTR);
+#endif
+
+    // Copy the first chunk on this thread, so that a source or destination that doesn't support
+    // copy_file_range is detected before any threads are started.
+    if (!ParallelCopyNextChunk(&state))
+    {
+        *copiedAny = state.bytesCopied > 0;
+        errno = state.error;
+        return -1;
+    }
+
+    *copiedAny = true;
+    ReportCopyProgress(&state, progress, context);
+
+    int64_t chunkCount = (sourceLength + ParallelCopyChunkLength - 1) / ParallelCopyChunkLength;
+    int threadCount = chunkCount - 1 < ParallelCopyMaxThreads - 1 ? (int)(chunkCount - 1) : ParallelCopyMaxThreads - 1;
+    pthread_t threads[ParallelCopyMaxThreads];
+    int started = 0;
+    for (; started < threadCount; started++)
+    {
+        if (pthread_create(&threads[started], NULL, ParallelCopyWorker, &state) != 0)
+        {
+            // Continue with the threads that did start.
+            break;
+        }
+    }
+
+    while (ParallelCopyNextChunk(&state) && ReportCopyProgress(&state, progress, context));
+
+    for (int i = 0; i < started; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    if (state.error != 0)
+    {
+        errno = state.error;
+        return -1;
+    }
+
+    ReportCopyProgress(&state, progress, context);
+    if (state.error != 0)
+    {
+        errno = state.error;
+        return -1;
+    }
+
+    // Leave the descriptors where SystemNative_CopyFile's sequential copy would.
+    if (lseek(inFd, state.inOffset + sourceLength, SEEK_SET) < 0 || lseek(outFd, state.outOffset + sourceLength, SEEK_SET) < 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+#endif
+
+static int32_t CopyFileCore(int inFd, int outFd, int64_t sourceLength, CopyFileProgressCallback progress, void* context);
+
 int32_t SystemNative_CopyFile(intptr_t sourceFd, intptr_t destinationFd, int64_t sourceLength)
+{
+    return CopyFileCore(ToFileDescriptor(sourceFd), ToFileDescriptor(destinationFd), sourceLength, NULL, NULL);
+}
+
+int32_t SystemNative_CopyFileWithProgress(
+    intptr_t sourceFd, intptr_t destinationFd, int64_t sourceLength, CopyFileProgressCallback progress, void* context)
+{
+    return CopyFileCore(ToFileDescriptor(sourceFd), ToFileDescriptor(destinationFd), sourceLength, progress, context);
+}
+
+static int32_t CopyFileCore(int inFd, int outFd, int64_t sourceLength, CopyFileProgressCallback progress, void* context)
 {
     // unused on some platforms.
     (void)sourceLength;
-
-    int inFd = ToFileDescriptor(sourceFd);
-    int outFd = ToFileDescriptor(destinationFd);
+    (void)progress;
+    (void)context;
 
 #if HAVE_FCOPYFILE
     // If fcopyfile is available (OS X), try to use it, as the whole copy
@@ -1427,11 +1599,38 @@ int32_t SystemNative_CopyFile(intptr_t sourceFd, intptr_t destinationFd, int64_t
     }
 #endif
 #ifdef __linux__
-    if (SupportsCopyFileRange() && !copied && sourceLength != 0)
+    if (SupportsCopyFileRange() && !copied && sourceLength >= ParallelCopyMinimumLength)
+    {
+        bool copiedAny;
+        if (CopyFileRangeParallel(inFd, outFd, sourceLength, progress, context, &copiedAny) == 0)
+        {
+            copied = true;
+            sourceLength = 0;
+        }
+        else if (copiedAny)
+        {
+            // Part of the file was copied at other offsets, which the fallbacks can't continue from.
+            return -1;
+        }
+        else
+        {
+            // sendfile will likely encounter the same error, don't try it.
+            trySendFile = false;
+        }
+    }
+
+    if (SupportsCopyFileRange() && !copied && trySendFile && sourceLength != 0)
     {
+        int64_t totalCopied = 0;
         do
         {
+            // Copy in chunks when reporting progress, so that it is reported while copying.
             size_t copyLength = (sourceLength >= SSIZE_MAX ? SSIZE_MAX : (size_t)sourceLength);
+            if (progress != NULL && copyLength > (size_t)ParallelCopyChunkLength)
+            {
+                copyLength = (size_t)ParallelCopyChunkLength;
+            }
+
             ssize_t sent = CopyFileRange(inFd, outFd, copyLength);
             if (sent <= 0)
             {
@@ -1443,6 +1642,12 @@ int32_t SystemNative_CopyFile(intptr_t sourceFd, intptr_t destinationFd, int64_t
             {
                 assert(sent <= sourceLength);
                 sourceLength -= sent;
+                totalCopied += sent;
+                if (progress != NULL && progress(context, totalCopied) != 0)
+                {
+                    errno = ECANCELED;
+                    return -1;
+                }
             }
         } while (sourceLength > 0);
 
@@ -2028,3 +2233,164 @@ int64_t SystemNative_PWriteV(intptr_t fd, IOVector* vectors, int32_t vectorCount
     assert(count >= -1);
     return count;
 }
+
+#if HAVE_PREADV2 || HAVE_PWRITEV2
+static int32_t ConvertReadWriteFlags(int32_t flags, int* platformFlags)
+{
+    *platformFlags = 0;
+    if (flags & PAL_RWF_HIPRI)
+    {
+#ifdef RWF_HIPRI
+        *platformFlags |= RWF_HIPRI;
+#else
+        return -1;
+#endif
+    }
+    if (flags & PAL_RWF_DSYNC)
+    {
+#ifdef RWF_DSYNC
+        *platformFlags |= RWF_DSYNC;
+#else
+        return -1;
+#endif
+    }
+    if (flags & PAL_RWF_SYNC)
+    {
+#ifdef RWF_SYNC
+        *platformFlags |= RWF_SYNC;
+#else
+        return -1;
+#endif
+    }
+    if (flags & PAL_RWF_NOWAIT)
+    {
+#ifdef RWF_NOWAIT
+        *platformFlags |= RWF_NOWAIT;
+#else
+        return -1;
+#endif
+    }
+
+    return 0;
+}
+#endif
+
+int64_t SystemNative_PReadV2(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset, int32_t flags)
+{
+    assert(vectors != NULL);
+    assert(vectorCount >= 0);
+
+    if (flags & ~(PAL_RWF_HIPRI | PAL_RWF_DSYNC | PAL_RWF_SYNC | PAL_RWF_NOWAIT))
+    {
+        assert_msg(false, "Unknown ReadWrite flag", (int)flags);
+        errno = EINVAL;
+        return -1;
+    }
+
+    // HIPRI is only a hint and the sync flags don't apply to reads.
+    if ((flags & PAL_RWF_NOWAIT) == 0)
+    {
+#if HAVE_PREADV2
+        int platformFlags;
+        if (ConvertReadWriteFlags(flags, &platformFlags) == 0 && platformFlags != 0)
+        {
+            int64_t count;
+            while ((count = preadv2(ToFileDescriptor(fd), (struct iovec*)vectors, (int)vectorCount, (off_t)fileOffset, platformFlags)) < 0 && errno == EINTR);
+            if (count >= 0 || (errno != ENOSYS && errno != EOPNOTSUPP))
+            {
+                return count;
+            }
+        }
+#endif
+        return SystemNative_PReadV(fd, vectors, vectorCount, fileOffset);
+    }
+
+#if HAVE_PREADV2
+    int platformFlags;
+    if (ConvertReadWriteFlags(flags, &platformFlags) != 0)
+    {
+        errno = ENOTSUP;
+        return -1;
+    }
+
+    int64_t count;
+    while ((count = preadv2(ToFileDescriptor(fd), (struct iovec*)vectors, (int)vectorCount, (off_t)fileOffset, platformFlags)) < 0 && errno == EINTR);
+
+    // Kernels before 4.14 don't know RWF_NOWAIT, and some file systems don't support it.
+    if (count < 0 && (errno == ENOSYS || errno == EOPNOTSUPP || errno == EINVAL))
+    {
+        errno = ENOTSUP;
+    }
+
+    assert(count >= -1);
+    return count;
+#else
+    // Without RWF_NOWAIT there is no way to tell whether the read would block.
+    (void)fd, (void)fileOffset;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
+int64_t SystemNative_PWriteV2(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset, int32_t flags)
+{
+    assert(vectors != NULL);
+    assert(vectorCount >= 0);
+
+    if (flags & ~(PAL_RWF_HIPRI | PAL_RWF_DSYNC | PAL_RWF_SYNC | PAL_RWF_NOWAIT))
+    {
+        assert_msg(false, "Unknown ReadWrite flag", (int)flags);
+        errno = EINVAL;
+        return -1;
+    }
+
+    if (flags == 0)
+    {
+        return SystemNative_PWriteV(fd, vectors, vectorCount, fileOffset);
+    }
+
+    int fileDescriptor = ToFileDescriptor(fd);
+
+#if HAVE_PWRITEV2
+    int platformFlags;
+    if (ConvertReadWriteFlags(flags, &platformFlags) == 0)
+    {
+        int64_t count;
+        while ((count = pwritev2(fileDescriptor, (struct iovec*)vectors, (int)vectorCount, (off_t)fileOffset, platformFlags)) < 0 && errno == EINTR);
+        if (count >= 0 || (errno != ENOSYS && errno != EOPNOTSUPP && !(errno == EINVAL && (flags & PAL_RWF_NOWAIT))))
+        {
+            return count;
+        }
+    }
+#endif
+
+    if (flags & PAL_RWF_NOWAIT)
+    {
+        errno = ENOTSUP;
+        return -1;
+    }
+
+    // Emulate the sync flags on top of a plain write; HIPRI is only a hint.
+    int64_t count = SystemNative_PWriteV(fd, vectors, vectorCount, fileOffset);
+    if (count > 0 && (flags & (PAL_RWF_DSYNC | PAL_RWF_SYNC)))
+    {
+        int result;
+#if defined(__linux__)
+        if ((flags & PAL_RWF_SYNC) == 0)
+        {
+            while ((result = fdatasync(fileDescriptor)) < 0 && errno == EINTR);
+        }
+        else
+#endif
+        {
+            while ((result = fsync(fileDescriptor)) < 0 && errno == EINTR);
+        }
+
+        if (result != 0)
+        {
+            return -1;
+        }
+    }
+
+    return count;
+}
@@ -290,6 +290,17 @@ typedef enum
     PAL_POSIX_FADV_NOREUSE = 5,    /* data will only be accessed once */
 } FileAdvice;
 
+/**
+ * Per-call flags of SystemNative_PReadV2/PWriteV2, mapped to the RWF_* flags of preadv2/pwritev2.
+ */
+typedef enum
+{
+    PAL_RWF_HIPRI = 0x1,  /* poll for completion, for files opened with O_DIRECT on polled block devices */
+    PAL_RWF_DSYNC = 0x2,  /* write: per-call O_DSYNC */
+    PAL_RWF_SYNC = 0x4,   /* write: per-call O_SYNC */
+    PAL_RWF_NOWAIT = 0x8, /* fail with EAGAIN instead of blocking, e.g. when the data isn't in the page cache */
+} ReadWriteFlags;
+
 /**
  * Our intermediate dirent struct that only gives back the data we need
  */
@@ -728,6 +739,21 @@ PALEXPORT int32_t SystemNative_Write(intptr_t fd, const void* buffer, int32_t bu
  */
 PALEXPORT int32_t SystemNative_CopyFile(intptr_t sourceFd, intptr_t destinationFd, int64_t sourceLength);
 
+/**
+ * Called with the number of bytes copied so far. Returning non-zero cancels the copy.
+ */
+typedef int32_t (*CopyFileProgressCallback)(void* context, int64_t bytesCopied);
+
+/**
+ * Same as SystemNative_CopyFile, reporting progress while the data is copied with copy_file_range.
+ * Large files that can't be cloned are copied on several threads; progress is still reported on the
+ * calling thread. Cancelling fails the copy with ECANCELED.
+ *
+ * Returns 0 on success; otherwise, returns -1 and sets errno.
+ */
+PALEXPORT int32_t SystemNative_CopyFileWithProgress(
+    intptr_t sourceFd, intptr_t destinationFd, int64_t sourceLength, CopyFileProgressCallback progress, void* context);
+
 /**
 * Initializes a new inotify instance and returns a file
 * descriptor associated with a new inotify event queue.
@@ -843,3 +869,21 @@ PALEXPORT int64_t SystemNative_PReadV(intptr_t fd, IOVector* vectors, int32_t ve
  * Returns the number of bytes written on success; otherwise, -1 is returned an errno is set.
  */
 PALEXPORT int64_t SystemNative_PWriteV(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset);
+
+/**
+ * Same as SystemNative_PReadV with ReadWriteFlags. With PAL_RWF_NOWAIT, the read is served from the
+ * page cache and fails with EAGAIN if it would have to wait for the device.
+ *
+ * Returns the number of bytes read on success; otherwise, -1 is returned and errno is set. errno is
+ * ENOTSUP if the platform doesn't support one of the flags.
+ */
+PALEXPORT int64_t SystemNative_PReadV2(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset, int32_t flags);
+
+/**
+ * Same as SystemNative_PWriteV with ReadWriteFlags. PAL_RWF_DSYNC and PAL_RWF_SYNC are emulated with
+ * fdatasync/fsync where pwritev2 isn't available.
+ *
+ * Returns the number of bytes written on success; otherwise, -1 is returned and errno is set. errno is
+ * ENOTSUP if the platform doesn't support one of the flags.
+ */
+PALEXPORT int64_t SystemNative_PWriteV2(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset, int32_t flags);
@@ -0,0 +1,628 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "pal_config.h"
+#include "pal_io_uring.h"
+#include "pal_networking.h"
+#include "pal_utilities.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if HAVE_LINUX_IO_URING_H
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#if HAVE_LINUX_IO_URING_H
+
+// We require that IOVector have the same layout as iovec, see pal_networking.c.
+c_static_assert(sizeof(IOVector) == sizeof(struct iovec));
+// SystemNative_IoUringPrepareAccept passes socketAddressLen as the socklen_t*.
+c_static_assert(sizeof(socklen_t) == sizeof(int32_t));
+
+struct IoUring
+{
+    int ringFd;
+
+    // Submission queue. sqLocalTail counts the entries that have been prepared, which are only
+    // published to the kernel through *sqTail when they are submitted.
+    void* sqRing;
+    size_t sqRingSize;
+    uint32_t* sqHead;
+    uint32_t* sqTail;
+    uint32_t* sqFlags;
+    uint32_t* sqArray;
+    uint32_t sqRingMask;
+    uint32_t sqRingEntries;
+    uint32_t sqLocalTail;
+    struct io_uring_sqe* sqes;
+    size_t sqesSize;
+
+    // Completion queue, in the same mapping as the submission queue if the kernel supports it.
+    void* cqRing;
+    size_t cqRingSize;
+    uint32_t* cqHead;
+    uint32_t* cqTail;
+    uint32_t cqRingMask;
+    struct io_uring_cqe* cqes;
+};
+
+static int IoUringSetup(uint32_t entries, struct io_uring_params* params)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int IoUringEnter(int ringFd, uint32_t toSubmit, uint32_t minComplete, uint32_t flags)
+{
+    return (int)syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+static int IoUringRegister(int ringFd, uint32_t opcode, void* arg, uint32_t argCount)
+{
+    return (int)syscall(__NR_io_uring_register, ringFd, opcode, arg, argCount);
+}
+
+static void UnmapRing(IoUring* ring)
+{
+    if (ring->sqes != NULL && ring->sqes != MAP_FAILED)
+    {
+        munmap(ring->sqes, ring->sqesSize);
+    }
+
+    if (ring->cqRing != NULL && ring->cqRing != MAP_FAILED && ring->cqRing != ring->sqRing)
+    {
+        munmap(ring->cqRing, ring->cqRingSize);
+    }
+
+    if (ring->sqRing != NULL && ring->sqRing != MAP_FAILED)
+    {
+        munmap(ring->sqRing, ring->sqRingSize);
+    }
+}
+
+static int32_t MapRing(IoUring* ring, const struct io_uring_params* params)
+{
+    ring->sqRingSize = params->sq_off.array + params->sq_entries * sizeof(uint32_t);
+    ring->cqRingSize = params->cq_off.cqes + params->cq_entries * sizeof(struct io_uring_cqe);
+
+    bool singleMmap = (params->features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMmap)
+    {
+        ring->sqRingSize = ring->sqRingSize > ring->cqRingSize ? ring->sqRingSize : ring->cqRingSize;
+        ring->cqRingSize = ring->sqRingSize;
+    }
+
+    ring->sqRing = mmap(NULL, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_SQ_RING);
+    if (ring->sqRing == MAP_FAILED)
+    {
+        return -1;
+    }
+
+    ring->cqRing = singleMmap
+        ? ring->sqRing
+        : mmap(NULL, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_CQ_RING);
+    if (ring->cqRing == MAP_FAILED)
+    {
+        return -1;
+    }
+
+    ring->sqesSize = params->sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = (struct io_uring_sqe*)mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED)
+    {
+        return -1;
+    }
+
+    uint8_t* sq = (uint8_t*)ring->sqRing;
+    ring->sqHead = (uint32_t*)(sq + params->sq_off.head);
+    ring->sqTail = (uint32_t*)(sq + params->sq_off.tail);
+    ring->sqFlags = (uint32_t*)(sq + params->sq_off.flags);
+    ring->sqArray = (uint32_t*)(sq + params->sq_off.array);
+    ring->sqRingMask = *(uint32_t*)(sq + params->sq_off.ring_mask);
+    ring->sqRingEntries = *(uint32_t*)(sq + params->sq_off.ring_entries);
+    ring->sqLocalTail = *ring->sqTail;
+
+    uint8_t* cq = (uint8_t*)ring->cqRing;
+    ring->cqHead = (uint32_t*)(cq + params->cq_off.head);
+    ring->cqTail = (uint32_t*)(cq + params->cq_off.tail);
+    ring->cqRingMask = *(uint32_t*)(cq + params->cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)(cq + params->cq_off.cqes);
+
+    return 0;
+}
+
+// Number of prepared entries that haven't been consumed by the kernel yet. Without SQPOLL the
+// kernel consumes entries only in io_uring_enter, so this is what the next submission hands over.
+static uint32_t GetUnsubmittedCount(IoUring* ring)
+{
+    return ring->sqLocalTail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+}
+
+static int32_t Submit(IoUring* ring, uint32_t minComplete, uint32_t flags)
+{
+    __atomic_store_n(ring->sqTail, ring->sqLocalTail, __ATOMIC_RELEASE);
+
+    int res;
+    while ((res = IoUringEnter(ring->ringFd, GetUnsubmittedCount(ring), minComplete, flags)) < 0 && errno == EINTR);
+    return res < 0 ? SystemNative_ConvertErrorPlatformToPal(errno) : Error_SUCCESS;
+}
+
+static struct io_uring_sqe* GetSqe(IoUring* ring)
+{
+    if (GetUnsubmittedCount(ring) >= ring->sqRingEntries)
+    {
+        // The submission queue is full, hand what has been prepared so far to the kernel.
+        if (Submit(ring, 0, 0) != Error_SUCCESS || GetUnsubmittedCount(ring) >= ring->sqRingEntries)
+        {
+            return NULL;
+        }
+    }
+
+    uint32_t index = ring->sqLocalTail & ring->sqRingMask;
+    struct io_uring_sqe* sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    ring->sqArray[index] = index;
+    ring->sqLocalTail++;
+    return sqe;
+}
+
+static int32_t PrepareSqe(IoUring* ring, uint8_t opcode, int fd, uint64_t userData, struct io_uring_sqe** sqe)
+{
+    *sqe = GetSqe(ring);
+    if (*sqe == NULL)
+    {
+        return Error_EAGAIN;
+    }
+
+    (*sqe)->opcode = opcode;
+    (*sqe)->fd = fd;
+    (*sqe)->user_data = userData;
+    return Error_SUCCESS;
+}
+
+static uint32_t ReapCompletions(IoUring* ring, IoUringCompletion* completions, uint32_t count)
+{
+    uint32_t head = *ring->cqHead;
+    uint32_t tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+    uint32_t reaped = 0;
+
+    for (; head != tail && reaped < count; head++, reaped++)
+    {
+        struct io_uring_cqe* cqe = &ring->cqes[head & ring->cqRingMask];
+        IoUringCompletion* completion = &completions[reaped];
+
+        completion->UserData = cqe->user_data;
+        completion->Result = cqe->res >= 0 ? cqe->res : 0;
+        completion->ErrorCode = cqe->res >= 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(-cqe->res);
+        completion->Flags = IoUringCompletionFlags_None;
+        completion->BufferId = 0;
+
+        if ((cqe->flags & IORING_CQE_F_MORE) != 0)
+        {
+            completion->Flags |= IoUringCompletionFlags_More;
+        }
+
+        if ((cqe->flags & IORING_CQE_F_BUFFER) != 0)
+        {
+            completion->Flags |= IoUringCompletionFlags_Buffer;
+            completion->BufferId = cqe->flags >> IORING_CQE_BUFFER_SHIFT;
+        }
+    }
+
+    __atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+    return reaped;
+}
+
+#endif // HAVE_LINUX_IO_URING_H
+
+int32_t SystemNative_IoUringCreate(int32_t entries, IoUring** ring)
+{
+    if (ring == NULL || entries <= 0)
+    {
+        return Error_EINVAL;
+    }
+
+    *ring = NULL;
+
+#if HAVE_LINUX_IO_URING_H
+    IoUring* result = (IoUring*)calloc(1, sizeof(IoUring));
+    if (result == NULL)
+    {
+        return Error_ENOMEM;
+    }
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = (uint32_t)entries * 4;
+#if defined(IORING_SETUP_SUBMIT_ALL) && defined(IORING_SETUP_COOP_TASKRUN)
+    // Keep submitting the rest of a batch when an entry fails, and run completion work when
+    // the ring is entered instead of interrupting the thread. Both need 5.19.
+    params.flags |= IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN;
+#endif
+
+    result->ringFd = IoUringSetup((uint32_t)entries, &params);
+    if (result->ringFd < 0 && errno == EINVAL && params.flags != IORING_SETUP_CQSIZE)
+    {
+        memset(&params, 0, sizeof(params));
+        params.flags = IORING_SETUP_CQSIZE;
+        params.cq_entries = (uint32_t)entries * 4;
+        result->ringFd = IoUringSetup((uint32_t)entries, &params);
+    }
+
+    if (result->ringFd < 0)
+    {
+        // ENOSYS if the kernel doesn't have io_uring, EPERM if it has been disabled.
+        int32_t error = SystemNative_ConvertErrorPlatformToPal(errno);
+        free(result);
+        return error;
+    }
+
+    if (MapRing(result, &params) != 0)
+    {
+        int32_t error = SystemNative_ConvertErrorPlatformToPal(errno);
+        SystemNative_IoUringClose(result);
+        return error;
+    }
+
+    *ring = result;
+    return Error_SUCCESS;
+#else
+    return Error_ENOTSUP;
+#endif
+}
+
+void SystemNative_IoUringClose(IoUring* ring)
+{
+#if HAVE_LINUX_IO_URING_H
+    if (ring == NULL)
+    {
+        return;
+    }
+
+    UnmapRing(ring);
+    close(ring->ringFd);
+    free(ring);
+#else
+    (void)ring;
+#endif
+}
+
+int32_t SystemNative_IoUringRegisterBuffers(IoUring* ring, IOVector* buffers, int32_t count)
+{
+    if (ring == NULL || buffers == NULL || count <= 0)
+    {
+        return Error_EINVAL;
+    }
+
+#if HAVE_LINUX_IO_URING_H
+    int res;
+    while ((res = IoUringRegister(ring->ringFd, IORING_REGISTER_BUFFERS, buffers, (uint32_t)count)) < 0 && errno == EINTR);
+    return res < 0 ? SystemNative_ConvertErrorPlatformToPal(errno) : Error_SUCCESS;
+#else
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_IoUringUnregisterBuffers(IoUring* ring)
+{
+    if (ring == NULL)
+    {
+        return Error_EINVAL;
+    }
+
+#if HAVE_LINUX_IO_URING_H
+    int res;
+    while ((res = IoUringRegister(ring->ringFd, IORING_UNREGISTER_BUFFERS, NULL, 0)) < 0 && errno == EINTR);
+    return res < 0 ? SystemNative_ConvertErrorPlatformToPal(errno) : Error_SUCCESS;
+#else
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_IoUringPrepareProvideBuffers(
+    IoUring* ring, uint8_t* buffer, int32_t bufferLength, int32_t count, uint16_t groupId, uint16_t startBufferId, uint64_t userData)
+{
+    if (ring == NULL || buffer == NULL || bufferLength <= 0 || count <= 0)
+    {
+        return Error_EINVAL;
+    }
+
+#if HAVE_LINUX_IO_URING_H
+    struct io_uring_sqe* sqe;
+    int32_t error = PrepareSqe(ring, IORING_OP_PROVIDE_BUFFERS, count, userData, &sqe);
+    if (error != Error_SUCCESS)
+    {
+        return error;
+    }
+
+    sqe->addr = (uint64_t)(uintptr_t)buffer;
+    sqe->len = (uint32_t)bufferLength;
+    sqe->off = startBufferId;
+    sqe->buf_group = groupId;
+    return Error_SUCCESS;
+#else
+    (void)groupId;
+    (void)startBufferId;
+    (void)userData;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_IoUringPrepareAccept(
+    IoUring* ring, intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, int32_t multishot, uint64_t userData)
+{
+    if (ring == NULL || (socketAddress == NULL) != (socketAddressLen == NULL) || (multishot && socketAddress != NULL))
+    {
+        return Error_EINVAL;
+    }
+
+#if HAVE_LINUX_IO_URING_H
+#ifndef IORING_ACCEPT_MULTISHOT
+    if (multishot)
+    {
+        return Error_ENOTSUP;
+    }
+#endif
+
+    struct io_uring_sqe* sqe;
+    int32_t error = PrepareSqe(ring, IORING_OP_ACCEPT, ToFileDescriptor(socket), userData, &sqe);
+    if (error != Error_SUCCESS)
+    {
+        return error;
+    }
+
+    sqe->addr = (uint64_t)(uintptr_t)socketAddress;
+    sqe->addr2 = (uint64_t)(uintptr_t)socketAddressLen;
+    sqe->accept_flags = SOCK_CLOEXEC;
+#ifdef IORING_ACCEPT_MULTISHOT
+    if (multishot)
+    {
+        sqe->ioprio |= IORING_ACCEPT_MULTISHOT;
+    }
+#endif
+    return Error_SUCCESS;
+#else
+    (void)socket;
+    (void)userData;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_IoUringPrepareReceive(
+    IoUring* ring, intptr_t socket, uint8_t* buffer, int32_t bufferLen, int32_t flags, uint64_t userData)
+{
+    if (ring == NULL || buffer == NULL || bufferLen < 0)
+    {
+        return Error_EINVAL;
+    }
+
+#if HAVE_LINUX_IO_URING_H
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct io_uring_sqe* sqe;
+    int32_t error = PrepareSqe(ring, IORING_OP_RECV, ToFileDescriptor(socket), userData, &sqe);
+    if (error != Error_SUCCESS)
+    {
+        return error;
+    }
+
+    sqe->addr = (uint64_t)(uintptr_t)buffer;
+    sqe->len = (uint32_t)bufferLen;
+    sqe->msg_flags = (uint32_t)socketFlags;
+    return Error_SUCCESS;
+#else
+    (void)socket;
+    (void)flags;
+    (void)userData;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_IoUringPrepareReceiveMultishot(
+    IoUring* ring, intptr_t socket, uint16_t groupId, int32_t flags, uint64_t userData)
+{
+    if (ring == NULL)
+    {
+        return Error_EINVAL;
+    }
+
+#if HAVE_LINUX_IO_URING_H && defined(IORING_RECV_MULTISHOT)
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct io_uring_sqe* sqe;
+    int32_t error = PrepareSqe(ring, IORING_OP_RECV, ToFileDescriptor(socket), userData, &sqe);
+    if (error != Error_SUCCESS)
+    {
+        return error;
+    }
+
+    // The kernel picks a buffer from the group for each completion.
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = groupId;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->msg_flags = (uint32_t)socketFlags;
+    return Error_SUCCESS;
+#else
+    (void)socket;
+    (void)groupId;
+    (void)flags;
+    (void)userData;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_IoUringPrepareSend(
+    IoUring* ring, intptr_t socket, uint8_t* buffer, int32_t bufferLen, int32_t flags, uint64_t userData)
+{
+    if (ring == NULL || buffer == NULL || bufferLen < 0)
+    {
+        return Error_EINVAL;
+    }
+
+#if HAVE_LINUX_IO_URING_H
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct io_uring_sqe* sqe;
+    int32_t error = PrepareSqe(ring, IORING_OP_SEND, ToFileDescriptor(socket), userData, &sqe);
+    if (error != Error_SUCCESS)
+    {
+        return error;
+    }
+
+    sqe->addr = (uint64_t)(uintptr_t)buffer;
+    sqe->len = (uint32_t)bufferLen;
+    // Same as SystemNative_Send, a closed peer is reported as EPIPE instead of raising SIGPIPE.
+    sqe->msg_flags = (uint32_t)(socketFlags | MSG_NOSIGNAL);
+    return Error_SUCCESS;
+#else
+    (void)socket;
+    (void)flags;
+    (void)userData;
+    return Error_ENOTSUP;
+#endif
+}
+
+#if HAVE_LINUX_IO_URING_H
+static int32_t PrepareReadWrite(
+    IoUring* ring, uint8_t opcode, uint8_t fixedOpcode, intptr_t fd, uint8_t* buffer, int32_t bufferLen, int64_t offset, int32_t fixedBufferIndex, uint64_t userData)
+{
+    struct io_uring_sqe* sqe;
+    int32_t error = PrepareSqe(ring, fixedBufferIndex >= 0 ? fixedOpcode : opcode, ToFileDescriptor(fd), userData, &sqe);
+    if (error != Error_SUCCESS)
+    {
+        return error;
+    }
+
+    sqe->addr = (uint64_t)(uintptr_t)buffer;
+    sqe->len = (uint32_t)bufferLen;
+    // An offset of -1 (all bits set) makes the kernel use and advance the file position.
+    sqe->off = (uint64_t)offset;
+    if (fixedBufferIndex >= 0)
+    {
+        sqe->buf_index = (uint16_t)fixedBufferIndex;
+    }
+
+    return Error_SUCCESS;
+}
+#endif
+
+int32_t SystemNative_IoUringPrepareRead(
+    IoUring* ring, intptr_t fd, uint8_t* buffer, int32_t bufferLen, int64_t offset, int32_t fixedBufferIndex, uint64_t userData)
+{
+    if (ring == NULL || buffer == NULL || bufferLen < 0 || offset < -1 || fixedBufferIndex < -1 || fixedBufferIndex > UINT16_MAX)
+    {
+        return Error_EINVAL;
+    }
+
+#if HAVE_LINUX_IO_URING_H
+    return PrepareReadWrite(ring, IORING_OP_READ, IORING_OP_READ_FIXED, fd, buffer, bufferLen, offset, fixedBufferIndex, userData);
+#else
+    (void)fd;
+    (void)userData;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_IoUringPrepareWrite(
+    IoUring* ring, intptr_t fd, uint8_t* buffer, int32_t bufferLen, int64_t offset, int32_t fixedBufferIndex, uint64_t userData)
+{
+    if (ring == NULL || buffer == NULL || bufferLen < 0 || offset < -1 || fixedBufferIndex < -1 || fixedBufferIndex > UINT16_MAX)
+    {
+        return Error_EINVAL;
+    }
+
+#if HAVE_LINUX_IO_URING_H
+    return PrepareReadWrite(ring, IORING_OP_WRITE, IORING_OP_WRITE_FIXED, fd, buffer, bufferLen, offset, fixedBufferIndex, userData);
+#else
+    (void)fd;
+    (void)userData;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_IoUringPrepareCancel(IoUring* ring, uint64_t targetUserData, uint64_t userData)
+{
+    if (ring == NULL)
+    {
+        return Error_EINVAL;
+    }
+
+#if HAVE_LINUX_IO_URING_H
+    struct io_uring_sqe* sqe;
+    int32_t error = PrepareSqe(ring, IORING_OP_ASYNC_CANCEL, -1, userData, &sqe);
+    if (error != Error_SUCCESS)
+    {
+        return error;
+    }
+
+    sqe->addr = targetUserData;
+    return Error_SUCCESS;
+#else
+    (void)targetUserData;
+    (void)userData;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_IoUringSubmitAndWait(
+    IoUring* ring, int32_t minCompletions, IoUringCompletion* completions, int32_t* count)
+{
+    if (ring == NULL || completions == NULL || count == NULL || *count <= 0 || minCompletions < 0)
+    {
+        return Error_EINVAL;
+    }
+
+#if HAVE_LINUX_IO_URING_H
+    uint32_t capacity = (uint32_t)*count;
+    *count = 0;
+
+    // Completions that are already there don't need to be waited for, and if nothing is left to
+    // submit and enough have completed, the batch doesn't need a syscall at all.
+    uint32_t reaped = ReapCompletions(ring, completions, capacity);
+    uint32_t wanted = (uint32_t)minCompletions < capacity ? (uint32_t)minCompletions : capacity;
+    bool overflowed = (__atomic_load_n(ring->sqFlags, __ATOMIC_ACQUIRE) & IORING_SQ_CQ_OVERFLOW) != 0;
+
+    if (GetUnsubmittedCount(ring) != 0 || reaped < wanted || overflowed)
+    {
+        uint32_t waitFor = reaped < wanted ? wanted - reaped : 0;
+        // Entering with GETEVENTS also moves completions that overflowed the ring back into it.
+        uint32_t flags = (waitFor > 0 || overflowed) ? IORING_ENTER_GETEVENTS : 0;
+
+        int32_t error = Submit(ring, waitFor, flags);
+        if (error != Error_SUCCESS)
+        {
+            *count = (int32_t)reaped;
+            // Completions that were reaped are reported; the caller retries the submission.
+            return reaped > 0 && (error == Error_EAGAIN || error == Error_EBUSY) ? Error_SUCCESS : error;
+        }
+
+        reaped += ReapCompletions(ring, completions + reaped, capacity - reaped);
+    }
+
+    *count = (int32_t)reaped;
+    return Error_SUCCESS;
+#else
+    *count = 0;
+    return Error_ENOTSUP;
+#endif
+}
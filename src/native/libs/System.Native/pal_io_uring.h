@@ -0,0 +1,112 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#pragma once
+
+#include "pal_compiler.h"
+#include "pal_io.h"
+#include "pal_types.h"
+#include "pal_errno.h"
+
+// io_uring submission and completion rings for socket and file I/O (Linux only; the functions
+// return Error_ENOTSUP elsewhere and on kernels without io_uring).
+//
+// Operations are queued with the SystemNative_IoUringPrepare* functions and handed to the kernel
+// together by SystemNative_IoUringSubmitAndWait, which also reaps the completions, so a batch of
+// operations costs a single syscall. A ring is not thread-safe: the caller serializes all calls
+// for a ring, normally by using it from a single event loop thread.
+typedef struct IoUring IoUring;
+
+/**
+ * Flags of an IoUringCompletion.
+ */
+typedef enum
+{
+    IoUringCompletionFlags_None = 0x0,
+    IoUringCompletionFlags_More = 0x1,   // A multishot operation remains armed and will complete again.
+    IoUringCompletionFlags_Buffer = 0x2, // BufferId identifies the provided buffer that holds the data.
+} IoUringCompletionFlags;
+
+typedef struct
+{
+    uint64_t UserData;  // The user data the operation was prepared with.
+    int32_t Result;     // Bytes transferred or accepted socket; 0 if the operation failed.
+    int32_t ErrorCode;  // Error_SUCCESS or the PAL error of the operation.
+    uint32_t Flags;     // IoUringCompletionFlags
+    uint32_t BufferId;  // Valid if Flags has IoUringCompletionFlags_Buffer.
+} IoUringCompletion;
+
+/**
+ * Creates a ring with room for at least entries submissions. Completions get four times as many
+ * entries since multishot operations complete repeatedly.
+ *
+ * Returns Error_SUCCESS on success; otherwise, the error.
+ */
+PALEXPORT int32_t SystemNative_IoUringCreate(int32_t entries, IoUring** ring);
+
+/**
+ * Closes the ring. Operations that are still in flight are cancelled by the kernel.
+ */
+PALEXPORT void SystemNative_IoUringClose(IoUring* ring);
+
+/**
+ * Registers buffers for SystemNative_IoUringPrepareRead/Write with a fixedBufferIndex, which
+ * saves the kernel from mapping the pages on each operation. Only one set of buffers can be
+ * registered at a time.
+ */
+PALEXPORT int32_t SystemNative_IoUringRegisterBuffers(IoUring* ring, IOVector* buffers, int32_t count);
+
+PALEXPORT int32_t SystemNative_IoUringUnregisterBuffers(IoUring* ring);
+
+/**
+ * Queues handing count buffers of bufferLength bytes starting at buffer to group groupId, with
+ * ids startBufferId and up. Multishot receives pick their buffers from the group; a buffer is given
+ * back to the kernel by providing it again once its data has been consumed.
+ */
+PALEXPORT int32_t SystemNative_IoUringPrepareProvideBuffers(
+    IoUring* ring, uint8_t* buffer, int32_t bufferLength, int32_t count, uint16_t groupId, uint16_t startBufferId, uint64_t userData);
+
+/**
+ * Queues an accept. A multishot accept completes for every incoming connection until it fails or is
+ * cancelled, and doesn't return the peer address (socketAddress must be null).
+ */
+PALEXPORT int32_t SystemNative_IoUringPrepareAccept(
+    IoUring* ring, intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, int32_t multishot, uint64_t userData);
+
+PALEXPORT int32_t SystemNative_IoUringPrepareReceive(
+    IoUring* ring, intptr_t socket, uint8_t* buffer, int32_t bufferLen, int32_t flags, uint64_t userData);
+
+/**
+ * Queues a multishot receive that completes whenever data arrives, with the data in a buffer of
+ * group groupId, until it fails, the peer closes the connection, the group runs out of buffers or it
+ * is cancelled.
+ */
+PALEXPORT int32_t SystemNative_IoUringPrepareReceiveMultishot(
+    IoUring* ring, intptr_t socket, uint16_t groupId, int32_t flags, uint64_t userData);
+
+PALEXPORT int32_t SystemNative_IoUringPrepareSend(
+    IoUring* ring, intptr_t socket, uint8_t* buffer, int32_t bufferLen, int32_t flags, uint64_t userData);
+
+/**
+ * Queues a file read or write at offset, or at the current position if offset is -1. A
+ * fixedBufferIndex other than -1 names the registered buffer that buffer lies in.
+ */
+PALEXPORT int32_t SystemNative_IoUringPrepareRead(
+    IoUring* ring, intptr_t fd, uint8_t* buffer, int32_t bufferLen, int64_t offset, int32_t fixedBufferIndex, uint64_t userData);
+
+PALEXPORT int32_t SystemNative_IoUringPrepareWrite(
+    IoUring* ring, intptr_t fd, uint8_t* buffer, int32_t bufferLen, int64_t offset, int32_t fixedBufferIndex, uint64_t userData);
+
+/**
+ * Queues cancelling the operation that was prepared with targetUserData.
+ */
+PALEXPORT int32_t SystemNative_IoUringPrepareCancel(IoUring* ring, uint64_t targetUserData, uint64_t userData);
+
+/**
+ * Submits the queued operations, waits until at least minCompletions operations have completed and
+ * copies up to *count completions to completions. *count is set to the number copied.
+ *
+ * Returns Error_SUCCESS on success; otherwise, the error.
+ */
+PALEXPORT int32_t SystemNative_IoUringSubmitAndWait(
+    IoUring* ring, int32_t minCompletions, IoUringCompletion* completions, int32_t* count);
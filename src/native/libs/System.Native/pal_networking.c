@@ -69,6 +69,9 @@
 #include <linux/errqueue.h>
 #include <linux/icmp.h>
 #endif
+#if defined(__linux__)
+#include <netinet/udp.h>
+#endif
 
 
 #if HAVE_KQUEUE
@@ -1331,7 +1334,7 @@ int32_t SystemNative_SetSendTimeout(intptr_t socket, int32_t millisecondsTimeout
     return SetTimeoutOption(ToFileDescriptor(socket), millisecondsTimeout, SO_SNDTIMEO);
 }
 
-static int8_t ConvertSocketFlagsPalToPlatform(int32_t palFlags, int* platformFlags)
+int8_t ConvertSocketFlagsPalToPlatform(int32_t palFlags, int* platformFlags)
 {
     const int32_t SupportedFlagsMask =
 #ifdef MSG_ERRQUEUE
@@ -1453,6 +1456,20 @@ int32_t SystemNative_ReceiveSocketError(intptr_t socket, MessageHeader* messageH
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+static void UpdateMessageHeaderFromMsghdr(MessageHeader* messageHeader, const struct msghdr* header)
+{
+    assert(header->msg_name == messageHeader->SocketAddress); // should still be the same location as set in ConvertMessageHeaderToMsghdr
+    assert(header->msg_control == messageHeader->ControlBuffer);
+
+    assert((int32_t)header->msg_namelen <= messageHeader->SocketAddressLen);
+    messageHeader->SocketAddressLen = Min((int32_t)header->msg_namelen, messageHeader->SocketAddressLen);
+
+    assert(header->msg_controllen <= (size_t)messageHeader->ControlBufferLen);
+    messageHeader->ControlBufferLen = Min((int32_t)header->msg_controllen, messageHeader->ControlBufferLen);
+
+    messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header->msg_flags);
+}
+
 int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* received)
 {
     if (messageHeader == NULL || received == NULL || messageHeader->SocketAddressLen < 0 ||
@@ -1475,16 +1492,7 @@ int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeade
     ssize_t res;
     while ((res = recvmsg(fd, &header, socketFlags)) < 0 && errno == EINTR);
 
-    assert(header.msg_name == messageHeader->SocketAddress); // should still be the same location as set in ConvertMessageHeaderToMsghdr
-    assert(header.msg_control == messageHeader->ControlBuffer);
-
-    assert((int32_t)header.msg_namelen <= messageHeader->SocketAddressLen);
-    messageHeader->SocketAddressLen = Min((int32_t)header.msg_namelen, messageHeader->SocketAddressLen);
-
-    assert(header.msg_controllen <= (size_t)messageHeader->ControlBufferLen);
-    messageHeader->ControlBufferLen = Min((int32_t)header.msg_controllen, messageHeader->ControlBufferLen);
-
-    messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header.msg_flags);
+    UpdateMessageHeaderFromMsghdr(messageHeader, &header);
 
     if (res != -1)
     {
@@ -1570,6 +1578,284 @@ int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader,
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+#if HAVE_SENDMMSG || HAVE_RECVMMSG
+// Upper bound of messages moved by one sendmmsg/recvmmsg call, the headers live on the stack.
+#define MaxMessagesPerBatch 64
+#endif
+
+static int8_t IsValidMessageHeaderArray(const MessageHeader* messageHeaders, int32_t messageCount)
+{
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        if (messageHeaders[i].SocketAddressLen < 0 || messageHeaders[i].ControlBufferLen < 0 || messageHeaders[i].IOVectorCount < 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* received, int32_t messageCount, int32_t flags, int32_t* receivedMessages)
+{
+    if (messageHeaders == NULL || received == NULL || receivedMessages == NULL || messageCount <= 0 ||
+        !IsValidMessageHeaderArray(messageHeaders, messageCount))
+    {
+        return Error_EFAULT;
+    }
+
+    *receivedMessages = 0;
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+#if HAVE_RECVMMSG
+    // Receive as many messages as are queued, but don't wait for the batch to fill once
+    // the first one has arrived.
+    struct mmsghdr headers[MaxMessagesPerBatch];
+    int count = Min(messageCount, MaxMessagesPerBatch);
+    for (int i = 0; i < count; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+        headers[i].msg_len = 0;
+    }
+
+    int res;
+    while ((res = recvmmsg(fd, headers, (unsigned int)count, socketFlags | MSG_WAITFORONE, NULL)) < 0 && errno == EINTR);
+
+    if (res == -1)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int i = 0; i < res; i++)
+    {
+        UpdateMessageHeaderFromMsghdr(&messageHeaders[i], &headers[i].msg_hdr);
+        received[i] = headers[i].msg_len;
+    }
+
+    *receivedMessages = res;
+    return Error_SUCCESS;
+#else
+    // Receive one message at a time; after the first one, only take what is already queued.
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        struct msghdr header;
+        ConvertMessageHeaderToMsghdr(&header, &messageHeaders[i], fd);
+
+        ssize_t res;
+        while ((res = recvmsg(fd, &header, i == 0 ? socketFlags : socketFlags | MSG_DONTWAIT)) < 0 && errno == EINTR);
+
+        if (res == -1)
+        {
+            return i == 0 ? SystemNative_ConvertErrorPlatformToPal(errno) : Error_SUCCESS;
+        }
+
+        UpdateMessageHeaderFromMsghdr(&messageHeaders[i], &header);
+        received[i] = res;
+        *receivedMessages = i + 1;
+    }
+
+    return Error_SUCCESS;
+#endif
+}
+
+int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* sent, int32_t messageCount, int32_t flags, int32_t* sentMessages)
+{
+    if (messageHeaders == NULL || sent == NULL || sentMessages == NULL || messageCount <= 0 ||
+        !IsValidMessageHeaderArray(messageHeaders, messageCount))
+    {
+        return Error_EFAULT;
+    }
+
+    *sentMessages = 0;
+
+#if HAVE_SENDMMSG
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct mmsghdr headers[MaxMessagesPerBatch];
+    int count = Min(messageCount, MaxMessagesPerBatch);
+    for (int i = 0; i < count; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+        headers[i].msg_len = 0;
+    }
+
+    // Like the kernel, an error after the first message only ends the batch; it is reported
+    // when the remaining messages are sent.
+    int res;
+    while ((res = sendmmsg(fd, headers, (unsigned int)count, socketFlags)) < 0 && errno == EINTR);
+
+    if (res == -1)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int i = 0; i < res; i++)
+    {
+        sent[i] = headers[i].msg_len;
+    }
+
+    *sentMessages = res;
+    return Error_SUCCESS;
+#else
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        int64_t messageSent;
+        int32_t error = SystemNative_SendMessage(socket, &messageHeaders[i], flags, &messageSent);
+        if (error != Error_SUCCESS)
+        {
+            return i == 0 ? error : Error_SUCCESS;
+        }
+
+        sent[i] = messageSent;
+        *sentMessages = i + 1;
+    }
+
+    return Error_SUCCESS;
+#endif
+}
+
+int32_t SystemNative_GetUdpSegmentControlMessageBufferSize(void)
+{
+#if defined(UDP_SEGMENT)
+    // UDP_SEGMENT carries a uint16_t, UDP_GRO an int.
+    return CMSG_SPACE(sizeof(int));
+#else
+    return 0;
+#endif
+}
+
+int32_t SystemNative_SetUdpSegmentControlMessage(MessageHeader* messageHeader, int32_t segmentSize)
+{
+    if (messageHeader == NULL || messageHeader->ControlBuffer == NULL || segmentSize <= 0 || segmentSize > UINT16_MAX)
+    {
+        return Error_EFAULT;
+    }
+
+#if defined(UDP_SEGMENT)
+    if (messageHeader->ControlBufferLen < (int32_t)CMSG_SPACE(sizeof(uint16_t)))
+    {
+        return Error_ENOBUFS;
+    }
+
+    struct cmsghdr* controlMessage = (struct cmsghdr*)messageHeader->ControlBuffer;
+    memset(controlMessage, 0, CMSG_SPACE(sizeof(uint16_t)));
+    controlMessage->cmsg_level = SOL_UDP;
+    controlMessage->cmsg_type = UDP_SEGMENT;
+    controlMessage->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+
+    uint16_t value = (uint16_t)segmentSize;
+    memcpy(CMSG_DATA(controlMessage), &value, sizeof(value));
+    messageHeader->ControlBufferLen = (int32_t)CMSG_SPACE(sizeof(uint16_t));
+    return Error_SUCCESS;
+#else
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_GetMessagesControlInformation(
+    MessageHeader* messageHeaders, int32_t messageCount, int32_t isIPv4, IPPacketInformation* packetInfos, int32_t* segmentSizes)
+{
+    if (messageHeaders == NULL || messageCount < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        if (packetInfos != NULL)
+        {
+            memset(&packetInfos[i], 0, sizeof(IPPacketInformation));
+        }
+
+        if (segmentSizes != NULL)
+        {
+            segmentSizes[i] = 0;
+        }
+
+        if (messageHeaders[i].ControlBuffer == NULL || messageHeaders[i].ControlBufferLen <= 0)
+        {
+            continue;
+        }
+
+        struct msghdr header;
+        ConvertMessageHeaderToMsghdr(&header, &messageHeaders[i], -1);
+
+        for (struct cmsghdr* controlMessage = CMSG_FIRSTHDR(&header); controlMessage != NULL && controlMessage->cmsg_len > 0;
+             controlMessage = GET_CMSG_NXTHDR(&header, controlMessage))
+        {
+            if (packetInfos != NULL && isIPv4 != 0 && controlMessage->cmsg_level == IPPROTO_IP && controlMessage->cmsg_type == IP_PKTINFO)
+            {
+                GetIPv4PacketInformation(controlMessage, &packetInfos[i]);
+            }
+            else if (packetInfos != NULL && isIPv4 == 0 && controlMessage->cmsg_level == IPPROTO_IPV6 && controlMessage->cmsg_type == IPV6_PKTINFO)
+            {
+                GetIPv6PacketInformation(controlMessage, &packetInfos[i]);
+            }
+#if defined(UDP_GRO)
+            else if (segmentSizes != NULL && controlMessage->cmsg_level == SOL_UDP && controlMessage->cmsg_type == UDP_GRO &&
+                     controlMessage->cmsg_len >= CMSG_LEN(sizeof(int)))
+            {
+                // The datagrams coalesced into this message are all segmentSize bytes, except the last one.
+                int value;
+                memcpy(&value, CMSG_DATA(controlMessage), sizeof(value));
+                segmentSizes[i] = value;
+            }
+#endif
+        }
+    }
+
+    return Error_SUCCESS;
+}
+
+int32_t SystemNative_SetUdpSegmentationOffload(intptr_t socket, int32_t segmentSize)
+{
+    if (segmentSize < 0 || segmentSize > UINT16_MAX)
+    {
+        return Error_EINVAL;
+    }
+
+#if defined(UDP_SEGMENT)
+    // Datagrams sent on the socket are split into segmentSize payloads by the stack or the NIC;
+    // 0 turns segmentation off.
+    int value = segmentSize;
+    int err = setsockopt(ToFileDescriptor(socket), SOL_UDP, UDP_SEGMENT, &value, sizeof(value));
+    return err == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_SetUdpReceiveOffload(intptr_t socket, int32_t enabled)
+{
+#if defined(UDP_GRO)
+    // With GRO, consecutive datagrams from the same flow are received as one message, with their
+    // segment size in a UDP_GRO control message.
+    int value = enabled != 0 ? 1 : 0;
+    int err = setsockopt(ToFileDescriptor(socket), SOL_UDP, UDP_GRO, &value, sizeof(value));
+    return err == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    (void)enabled;
+    return Error_ENOTSUP;
+#endif
+}
+
 int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket)
 {
     if (socketAddress == NULL || socketAddressLen == NULL || acceptedSocket == NULL || *socketAddressLen < 0)
@@ -3447,6 +3733,180 @@ error:
 #endif
 }
 
+int32_t SystemNative_SpliceSockets(
+    intptr_t source, intptr_t destination, intptr_t pipeRead, intptr_t pipeWrite, int64_t count, int64_t* pipeBytes, int64_t* transferred)
+{
+    if (pipeBytes == NULL || transferred == NULL || count < 0 || *pipeBytes < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *transferred = 0;
+
+#if defined(__linux__)
+    int sourceFd = ToFileDescriptor(source);
+    int destinationFd = ToFileDescriptor(destination);
+    int pipeReadFd = ToFileDescriptor(pipeRead);
+    int pipeWriteFd = ToFileDescriptor(pipeWrite);
+    const unsigned int spliceFlags = SPLICE_F_MOVE | SPLICE_F_NONBLOCK;
+
+    // The pages move from the source socket into the pipe and from there to the destination
+    // socket without being copied to user space. Data that the destination didn't take stays in
+    // the pipe and *pipeBytes, and goes out first on the next call.
+    while (true)
+    {
+        while (*pipeBytes > 0)
+        {
+            ssize_t res;
+            while ((res = splice(pipeReadFd, NULL, destinationFd, NULL, (size_t)*pipeBytes, spliceFlags)) < 0 && errno == EINTR);
+            if (res == -1)
+            {
+                return *transferred > 0 && errno == EAGAIN ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+            }
+
+            *pipeBytes -= res;
+            *transferred += res;
+        }
+
+        if (*transferred >= count)
+        {
+            return Error_SUCCESS;
+        }
+
+        ssize_t res;
+        while ((res = splice(sourceFd, NULL, pipeWriteFd, NULL, (size_t)(count - *transferred), spliceFlags)) < 0 && errno == EINTR);
+        if (res == -1)
+        {
+            return *transferred > 0 && errno == EAGAIN ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        if (res == 0)
+        {
+            // The source has been shut down.
+            return Error_SUCCESS;
+        }
+
+        *pipeBytes += res;
+    }
+#else
+    (void)source;
+    (void)destination;
+    (void)pipeRead;
+    (void)pipeWrite;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_SetZeroCopyEnabled(intptr_t socket, int32_t enabled)
+{
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+    int value = enabled != 0 ? 1 : 0;
+    int err = setsockopt(ToFileDescriptor(socket), SOL_SOCKET, SO_ZEROCOPY, &value, sizeof(value));
+    return err == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    (void)enabled;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_SendZeroCopy(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent)
+{
+    if (buffer == NULL || bufferLen < 0 || sent == NULL)
+    {
+        return Error_EFAULT;
+    }
+
+    *sent = 0;
+
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    // The pages of buffer are pinned and sent from directly, so the caller must keep the buffer
+    // alive and unmodified until SystemNative_ReadZeroCopyCompletions reports the send as done.
+    // Every send that succeeds gets the next sequence number of the socket, starting from 0.
+    ssize_t res;
+    while ((res = send(fd, buffer, (size_t)bufferLen, socketFlags | MSG_ZEROCOPY)) < 0 && errno == EINTR);
+    if (res != -1)
+    {
+        *sent = (int32_t)res;
+        return Error_SUCCESS;
+    }
+
+    return SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    (void)flags;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_ReadZeroCopyCompletions(intptr_t socket, ZeroCopyCompletion* completions, int32_t count, int32_t* completionCount)
+{
+    if (completions == NULL || completionCount == NULL || count <= 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *completionCount = 0;
+
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY) && HAVE_LINUX_ERRQUEUE_H && defined(SO_EE_ORIGIN_ZEROCOPY)
+    int fd = ToFileDescriptor(socket);
+
+    // The completions are queued on the socket error queue, which also signals EPOLLERR. Each one
+    // covers a range of sequence numbers, and the kernel merges consecutive ranges when it can.
+    while (*completionCount < count)
+    {
+        char control[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_storage))];
+        struct msghdr header;
+        memset(&header, 0, sizeof(header));
+        header.msg_control = control;
+        header.msg_controllen = sizeof(control);
+
+        ssize_t res;
+        while ((res = recvmsg(fd, &header, MSG_ERRQUEUE | MSG_DONTWAIT)) < 0 && errno == EINTR);
+        if (res == -1)
+        {
+            return errno == EAGAIN || *completionCount > 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&header); cmsg != NULL; cmsg = GET_CMSG_NXTHDR(&header, cmsg))
+        {
+            if (!((cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+                  (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR)))
+            {
+                continue;
+            }
+
+            struct sock_extended_err* e = (struct sock_extended_err*)CMSG_DATA(cmsg);
+            if (e->ee_errno != 0 || e->ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+            {
+                continue;
+            }
+
+            ZeroCopyCompletion* completion = &completions[(*completionCount)++];
+            completion->FirstSequence = e->ee_info;
+            completion->LastSequence = e->ee_data;
+            // The kernel fell back to copying, e.g. for loopback; zero copy isn't worth it for
+            // this destination.
+            completion->Copied = (e->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+            break;
+        }
+    }
+
+    return Error_SUCCESS;
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
 uint32_t SystemNative_InterfaceNameToIndex(char* interfaceName)
 {
     assert(interfaceName != NULL);
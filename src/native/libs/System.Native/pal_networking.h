@@ -258,6 +258,13 @@ typedef struct
     int32_t Padding;        // Pad out to 8-byte alignment
 } IPPacketInformation;
 
+typedef struct
+{
+    uint32_t FirstSequence; // First send covered by the completion
+    uint32_t LastSequence;  // Last send covered by the completion, inclusive
+    int32_t Copied;         // Non-zero if the kernel copied the data instead
+} ZeroCopyCompletion;
+
 typedef struct
 {
     uint32_t MulticastAddress; // Multicast address
@@ -365,6 +372,47 @@ PALEXPORT int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t buffe
 
 PALEXPORT int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent);
 
+/**
+ * Receives up to messageCount messages with one call where the platform supports it (recvmmsg).
+ * Waits for the first message only, then takes what is already queued. Each header is updated
+ * like SystemNative_ReceiveMessage does and its byte count stored in received.
+ *
+ * Returns Error_SUCCESS and the number of messages in *receivedMessages if at least one message was
+ * received; otherwise, the error of the first message.
+ */
+PALEXPORT int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* received, int32_t messageCount, int32_t flags, int32_t* receivedMessages);
+
+/**
+ * Sends up to messageCount messages with one call where the platform supports it (sendmmsg). An
+ * error after the first message ends the batch early and is reported by the next call.
+ */
+PALEXPORT int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* sent, int32_t messageCount, int32_t flags, int32_t* sentMessages);
+
+/**
+ * Size of the control buffer for a UDP_SEGMENT (send) or UDP_GRO (receive) control message, 0 if
+ * UDP segmentation offload isn't supported.
+ */
+PALEXPORT int32_t SystemNative_GetUdpSegmentControlMessageBufferSize(void);
+
+/**
+ * Writes a UDP_SEGMENT control message to the control buffer of the header, so that the message is
+ * sent as datagrams of segmentSize bytes.
+ */
+PALEXPORT int32_t SystemNative_SetUdpSegmentControlMessage(MessageHeader* messageHeader, int32_t segmentSize);
+
+/**
+ * Parses the control messages of received headers into the preallocated packetInfos and
+ * segmentSizes arrays, either of which may be null. Entries without the control message are zeroed.
+ */
+PALEXPORT int32_t SystemNative_GetMessagesControlInformation(
+    MessageHeader* messageHeaders, int32_t messageCount, int32_t isIPv4, IPPacketInformation* packetInfos, int32_t* segmentSizes);
+
+PALEXPORT int32_t SystemNative_SetUdpSegmentationOffload(intptr_t socket, int32_t segmentSize);
+
+PALEXPORT int32_t SystemNative_SetUdpReceiveOffload(intptr_t socket, int32_t enabled);
+
 PALEXPORT int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket);
 
 PALEXPORT int32_t SystemNative_Bind(intptr_t socket, int32_t protocolType, uint8_t* socketAddress, int32_t socketAddressLen);
@@ -424,8 +472,37 @@ PALEXPORT int32_t SystemNative_GetMaximumAddressSize(void);
 
 PALEXPORT int32_t SystemNative_SendFile(intptr_t out_fd, intptr_t in_fd, int64_t offset, int64_t count, int64_t* sent);
 
+/**
+ * Forwards up to count bytes from the source socket to the destination socket through a pipe
+ * (see SystemNative_Pipe) with splice, without copying the data to user space. *pipeBytes tracks the
+ * data left in the pipe between calls and must start at 0 for a new pipe.
+ *
+ * Returns Error_SUCCESS with the bytes delivered to the destination in *transferred, which is 0 only
+ * once the source has been shut down and the pipe is empty. Error_EAGAIN means waiting for the
+ * destination to become writable if *pipeBytes is non-zero, and for the source to become readable
+ * otherwise.
+ */
+PALEXPORT int32_t SystemNative_SpliceSockets(
+    intptr_t source, intptr_t destination, intptr_t pipeRead, intptr_t pipeWrite, int64_t count, int64_t* pipeBytes, int64_t* transferred);
+
+PALEXPORT int32_t SystemNative_SetZeroCopyEnabled(intptr_t socket, int32_t enabled);
+
+/**
+ * Sends with MSG_ZEROCOPY on a socket with zero copy enabled. The buffer must stay alive and
+ * unmodified until a completion from SystemNative_ReadZeroCopyCompletions covers the send.
+ */
+PALEXPORT int32_t SystemNative_SendZeroCopy(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent);
+
+/**
+ * Reads up to count zero copy completions from the socket error queue without blocking.
+ */
+PALEXPORT int32_t SystemNative_ReadZeroCopyCompletions(intptr_t socket, ZeroCopyCompletion* completions, int32_t count, int32_t* completionCount);
+
 PALEXPORT int32_t SystemNative_Disconnect(intptr_t socket);
 
 PALEXPORT uint32_t SystemNative_InterfaceNameToIndex(char* interfaceName);
 
 PALEXPORT int32_t SystemNative_Select(int* readFds, int readFdsCount, int* writeFds, int writeFdsCount,  int* errorFds, int errorFdsCount, int32_t microseconds, int32_t maxFd, int* triggered);
+
+// Converts SocketFlags to the platform's MSG_* flags. Returns false if palFlags has unsupported flags.
+int8_t ConvertSocketFlagsPalToPlatform(int32_t palFlags, int* platformFlags);
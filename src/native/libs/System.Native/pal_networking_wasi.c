@@ -220,6 +220,44 @@ int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader,
     return Error_EINVAL;
 }
 
+int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* received, int32_t messageCount, int32_t flags, int32_t* receivedMessages)
+{
+    return Error_EINVAL;
+}
+
+int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* sent, int32_t messageCount, int32_t flags, int32_t* sentMessages)
+{
+    return Error_EINVAL;
+}
+
+int32_t SystemNative_GetUdpSegmentControlMessageBufferSize(void)
+{
+    return 0;
+}
+
+int32_t SystemNative_SetUdpSegmentControlMessage(MessageHeader* messageHeader, int32_t segmentSize)
+{
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_GetMessagesControlInformation(
+    MessageHeader* messageHeaders, int32_t messageCount, int32_t isIPv4, IPPacketInformation* packetInfos, int32_t* segmentSizes)
+{
+    return Error_EINVAL;
+}
+
+int32_t SystemNative_SetUdpSegmentationOffload(intptr_t socket, int32_t segmentSize)
+{
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_SetUdpReceiveOffload(intptr_t socket, int32_t enabled)
+{
+    return Error_ENOTSUP;
+}
+
 int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket)
 {
     if (socketAddress == NULL || socketAddressLen == NULL || acceptedSocket == NULL || *socketAddressLen < 0)
@@ -435,6 +473,27 @@ int32_t SystemNative_SendFile(intptr_t out_fd, intptr_t in_fd, int64_t offset, i
     return Error_EINVAL;
 }
 
+int32_t SystemNative_SpliceSockets(
+    intptr_t source, intptr_t destination, intptr_t pipeRead, intptr_t pipeWrite, int64_t count, int64_t* pipeBytes, int64_t* transferred)
+{
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_SetZeroCopyEnabled(intptr_t socket, int32_t enabled)
+{
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_SendZeroCopy(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent)
+{
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_ReadZeroCopyCompletions(intptr_t socket, ZeroCopyCompletion* completions, int32_t count, int32_t* completionCount)
+{
+    return Error_ENOTSUP;
+}
+
 uint32_t SystemNative_InterfaceNameToIndex(char* interfaceName)
 {
     assert(interfaceName != NULL);
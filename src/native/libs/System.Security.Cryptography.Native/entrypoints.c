@@ -141,6 +141,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_EvpDigestFinalEx)
     DllImportEntry(CryptoNative_EvpDigestFinalXOF)
     DllImportEntry(CryptoNative_EvpDigestOneShot)
+    DllImportEntry(CryptoNative_EvpDigestOneShotBatch)
     DllImportEntry(CryptoNative_EvpDigestReset)
     DllImportEntry(CryptoNative_EvpDigestSqueeze)
     DllImportEntry(CryptoNative_EvpDigestUpdate)
@@ -231,6 +232,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_HmacDestroy)
     DllImportEntry(CryptoNative_HmacFinal)
     DllImportEntry(CryptoNative_HmacOneShot)
+    DllImportEntry(CryptoNative_HmacOneShotBatch)
     DllImportEntry(CryptoNative_HmacReset)
     DllImportEntry(CryptoNative_HmacUpdate)
     DllImportEntry(CryptoNative_LoadKeyFromProvider)
@@ -319,6 +321,8 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_IsSslStateOK)
     DllImportEntry(CryptoNative_SslCtxAddExtraChainCert)
     DllImportEntry(CryptoNative_SslCtxSetCaching)
+    DllImportEntry(CryptoNative_SslCtxEnableKtls)
+    DllImportEntry(CryptoNative_SslCtxSetSessionCache)
     DllImportEntry(CryptoNative_SslCtxRemoveSession)
     DllImportEntry(CryptoNative_SslCtxSetCiphers)
     DllImportEntry(CryptoNative_SslCtxSetDefaultOcspCallback)
@@ -362,6 +366,11 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_SslSetAcceptState)
     DllImportEntry(CryptoNative_SslSetAlpnProtos)
     DllImportEntry(CryptoNative_SslSetBio)
+    DllImportEntry(CryptoNative_SslSetFd)
+    DllImportEntry(CryptoNative_SslGetKtlsStatus)
+    DllImportEntry(CryptoNative_SslSendFile)
+    DllImportEntry(CryptoNative_SslSessionCacheCreate)
+    DllImportEntry(CryptoNative_SslSessionCacheDestroy)
     DllImportEntry(CryptoNative_SslSetClientCertCallback)
     DllImportEntry(CryptoNative_SslSetPostHandshakeAuth)
     DllImportEntry(CryptoNative_SslSetConnectState)
@@ -98,3 +98,4 @@ OSSL_STORE_CTX* OSSL_STORE_open_ex(
     const char*, OSSL_LIB_CTX*, const char*, const UI_METHOD*, void*, const OSSL_PARAM*, OSSL_STORE_post_process_info_fn post_process, void*);
 
 X509* SSL_get1_peer_certificate(const SSL* ssl);
+ossl_ssize_t SSL_sendfile(SSL* s, int fd, off_t offset, size_t size, int flags);
@@ -262,6 +262,65 @@ int32_t CryptoNative_EvpDigestXOFOneShot(const EVP_MD* type, const void* source,
     return ret;
 }
 
+int32_t CryptoNative_EvpDigestOneShotBatch(
+    const EVP_MD* type, const uint8_t* source, const int32_t* sourceSizes, int32_t count, uint8_t* md, int32_t mdSize)
+{
+    ERR_clear_error();
+
+    if (type == NULL || sourceSizes == NULL || count < 0 || (md == NULL && count > 0) || mdSize != EVP_MD_get_size(type))
+    {
+        return 0;
+    }
+
+    if (count == 0)
+    {
+        return SUCCESS;
+    }
+
+    // One context serves every message. Reinitializing it with the same type is much cheaper than
+    // creating a context (and, on OpenSSL 3, resolving the implementation) per message.
+    EVP_MD_CTX* ctx = CryptoNative_EvpMdCtxCreate(type);
+
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+
+    int32_t ret = SUCCESS;
+
+    for (int32_t i = 0; i < count && ret == SUCCESS; i++)
+    {
+        if (sourceSizes[i] < 0 || (source == NULL && sourceSizes[i] > 0))
+        {
+            ret = 0;
+            break;
+        }
+
+        if (i > 0)
+        {
+            ret = EVP_DigestInit_ex(ctx, type, NULL);
+        }
+
+        if (ret == SUCCESS)
+        {
+            ret = EVP_DigestUpdate(ctx, source, Int32ToSizeT(sourceSizes[i]));
+        }
+
+        if (ret == SUCCESS)
+        {
+            unsigned int size;
+            ret = EVP_DigestFinal_ex(ctx, md, &size);
+            assert(ret != SUCCESS || size == (unsigned int)mdSize);
+        }
+
+        source += sourceSizes[i];
+        md += mdSize;
+    }
+
+    CryptoNative_EvpMdCtxDestroy(ctx);
+    return ret;
+}
+
 int32_t CryptoNative_EvpDigestSqueeze(EVP_MD_CTX* ctx, uint8_t* md, uint32_t len, int32_t* haveFeature)
 {
     ERR_clear_error();
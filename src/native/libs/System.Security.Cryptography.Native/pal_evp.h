@@ -89,6 +89,17 @@ Combines EVP_MD_CTX_create, EVP_DigestUpdate, and EVP_DigestFinalXOF in to a sin
 */
 PALEXPORT int32_t CryptoNative_EvpDigestXOFOneShot(const EVP_MD* type, const void* source, int32_t sourceSize, uint8_t* md, uint32_t len);
 
+/*
+Function:
+EvpDigestOneShotBatch
+
+Computes the digests of count messages that are laid out back to back in source, the length of
+message i being sourceSizes[i]. The digests are written back to back to md, each one mdSize bytes,
+which must be the digest size of type. Returns 1 on success and 0 on failure.
+*/
+PALEXPORT int32_t CryptoNative_EvpDigestOneShotBatch(
+    const EVP_MD* type, const uint8_t* source, const int32_t* sourceSizes, int32_t count, uint8_t* md, int32_t mdSize);
+
 /*
 Function:
 EvpMdCtxCopyEx
@@ -184,3 +184,72 @@ int32_t CryptoNative_HmacOneShot(const EVP_MD* type,
 
     return result == NULL ? 0 : 1;
 }
+
+int32_t CryptoNative_HmacOneShotBatch(const EVP_MD* type,
+                                      const uint8_t* key,
+                                      int32_t keySize,
+                                      const uint8_t* source,
+                                      const int32_t* sourceSizes,
+                                      int32_t count,
+                                      uint8_t* md,
+                                      int32_t mdSize)
+{
+    assert(type != NULL && sourceSizes != NULL);
+    assert(keySize >= 0 && count >= 0);
+    assert(key != NULL || keySize == 0);
+    assert(md != NULL || count == 0);
+
+    ERR_clear_error();
+
+    if ((key == NULL && keySize != 0) || count < 0 || (md == NULL && count > 0) || mdSize != EVP_MD_get_size(type))
+    {
+        return -1;
+    }
+
+    if (count == 0)
+    {
+        return 1;
+    }
+
+    // The key is set up once. Resetting the context afterwards restarts from the saved inner and outer
+    // key states, so each message only costs its own hashing.
+    HMAC_CTX* ctx = CryptoNative_HmacCreate(key, keySize, type);
+
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+
+    int32_t ret = 1;
+
+    for (int32_t i = 0; i < count && ret == 1; i++)
+    {
+        if (sourceSizes[i] < 0 || (source == NULL && sourceSizes[i] > 0))
+        {
+            ret = -1;
+            break;
+        }
+
+        if (i > 0)
+        {
+            ret = HMAC_Init_ex(ctx, NULL, 0, NULL, NULL) ? 1 : 0;
+        }
+
+        if (ret == 1)
+        {
+            ret = HMAC_Update(ctx, source, Int32ToSizeT(sourceSizes[i])) ? 1 : 0;
+        }
+
+        if (ret == 1)
+        {
+            unsigned int unsignedSize = Int32ToUint32(mdSize);
+            ret = HMAC_Final(ctx, md, &unsignedSize) ? 1 : 0;
+        }
+
+        source += sourceSizes[i];
+        md += mdSize;
+    }
+
+    HMAC_CTX_free(ctx);
+    return ret;
+}
@@ -87,3 +87,18 @@ PALEXPORT int32_t CryptoNative_HmacOneShot(const EVP_MD* type,
  * Returns NULL on failure.
 */
 PALEXPORT HMAC_CTX* CryptoNative_HmacCopy(const HMAC_CTX* ctx);
+
+/**
+ * Computes the HMACs of count messages with the same key in a single operation. The messages are laid
+ * out back to back in source, the length of message i being sourceSizes[i], and the HMACs are written
+ * back to back to md, each one mdSize bytes, which must be the digest size of type.
+ * Returns -1 on invalid input, 0 on failure, and 1 on success.
+ */
+PALEXPORT int32_t CryptoNative_HmacOneShotBatch(const EVP_MD* type,
+                                                const uint8_t* key,
+                                                int32_t keySize,
+                                                const uint8_t* source,
+                                                const int32_t* sourceSizes,
+                                                int32_t count,
+                                                uint8_t* md,
+                                                int32_t mdSize);
@@ -9,6 +9,8 @@
 #include "pal_x509.h"
 
 #include <assert.h>
+#include <pthread.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
 
@@ -549,6 +551,99 @@ void CryptoNative_SslSetBio(SSL* ssl, BIO* rbio, BIO* wbio)
     SSL_set_bio(ssl, rbio, wbio);
 }
 
+int32_t CryptoNative_SslSetFd(SSL* ssl, int32_t fd)
+{
+    ERR_clear_error();
+    return SSL_set_fd(ssl, fd);
+}
+
+#ifndef SSL_OP_ENABLE_KTLS
+#define SSL_OP_ENABLE_KTLS ((uint64_t)1 << (uint64_t)3)
+#endif
+#ifndef BIO_CTRL_GET_KTLS_SEND
+#define BIO_CTRL_GET_KTLS_SEND 73
+#endif
+#ifndef BIO_CTRL_GET_KTLS_RECV
+#define BIO_CTRL_GET_KTLS_RECV 76
+#endif
+
+int32_t CryptoNative_SslCtxEnableKtls(SSL_CTX* ctx)
+{
+    // void shim functions don't lead to exceptions, so skip the unconditional error clearing.
+
+#ifdef NEED_OPENSSL_3_0
+    // Kernel TLS support arrived in OpenSSL 3.0; the option bit means something else before.
+    if (CryptoNative_OpenSslVersionNumber() >= OPENSSL_VERSION_3_0_RTM)
+    {
+        SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
+        return 1;
+    }
+#else
+    (void)ctx;
+#endif
+
+    return 0;
+}
+
+int32_t CryptoNative_SslGetKtlsStatus(SSL* ssl)
+{
+    // No error queue impact.
+    int32_t status = PAL_SSL_KTLS_NONE;
+
+#ifdef NEED_OPENSSL_3_0
+    if (CryptoNative_OpenSslVersionNumber() >= OPENSSL_VERSION_3_0_RTM)
+    {
+        BIO* wbio = SSL_get_wbio(ssl);
+        BIO* rbio = SSL_get_rbio(ssl);
+
+        if (wbio != NULL && BIO_ctrl(wbio, BIO_CTRL_GET_KTLS_SEND, 0, NULL) > 0)
+        {
+            status |= PAL_SSL_KTLS_SEND;
+        }
+
+        if (rbio != NULL && BIO_ctrl(rbio, BIO_CTRL_GET_KTLS_RECV, 0, NULL) > 0)
+        {
+            status |= PAL_SSL_KTLS_RECEIVE;
+        }
+    }
+#else
+    (void)ssl;
+#endif
+
+    return status;
+}
+
+int64_t CryptoNative_SslSendFile(SSL* ssl, int32_t fd, int64_t offset, int64_t size, int32_t* error)
+{
+    ERR_clear_error();
+
+#ifdef NEED_OPENSSL_3_0
+    if (API_EXISTS(SSL_sendfile) && offset >= 0 && size >= 0)
+    {
+        int64_t result = (int64_t)SSL_sendfile(ssl, fd, (off_t)offset, (size_t)size, 0);
+
+        if (result > 0)
+        {
+            *error = SSL_ERROR_NONE;
+        }
+        else
+        {
+            *error = CryptoNative_SslGetError(ssl, (int32_t)result);
+        }
+
+        return result;
+    }
+#else
+    (void)ssl;
+    (void)fd;
+    (void)offset;
+    (void)size;
+#endif
+
+    *error = SSL_ERROR_SSL;
+    return -1;
+}
+
 int32_t CryptoNative_SslDoHandshake(SSL* ssl, int32_t* error)
 {
     ERR_clear_error();
@@ -711,6 +806,295 @@ int CryptoNative_SslCtxRemoveSession(SSL_CTX* ctx, SSL_SESSION* session)
     return SSL_CTX_remove_session(ctx, session);
 }
 
+// Each shard is a set-associative table: a session id hashes to a set of
+// SSL_SESSION_CACHE_WAYS entries, and a new session replaces the oldest one in its set.
+#define SSL_SESSION_CACHE_WAYS 4
+#define SSL_SESSION_CACHE_DEFAULT_SHARDS 16
+#define SSL_TICKET_KEYS_LENGTH 80
+#define SSL_TICKET_KEYS_LENGTH_1_0 48
+
+typedef struct SslSessionCacheEntry
+{
+    uint8_t id[SSL_MAX_SSL_SESSION_ID_LENGTH];
+    uint32_t idLength;
+    int32_t dataLength;
+    uint8_t* data; // DER encoded session, NULL if the entry is empty
+    uint64_t stamp;
+} SslSessionCacheEntry;
+
+typedef struct SslSessionCacheShard
+{
+    pthread_mutex_t lock;
+    SslSessionCacheEntry* entries;
+    uint64_t stamp;
+} SslSessionCacheShard;
+
+struct SslSessionCache
+{
+    int32_t shardCount;
+    int32_t setsPerShard;
+    SslSessionCacheShard* shards;
+    uint8_t ticketKeys[SSL_TICKET_KEYS_LENGTH];
+};
+
+static uint32_t HashSessionId(const uint8_t* id, uint32_t idLength)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < idLength; i++)
+    {
+        hash = (hash ^ id[i]) * 16777619u;
+    }
+
+    return hash;
+}
+
+/*
+Locks the shard for the session id and returns the first entry of its set.
+*/
+static SslSessionCacheEntry* LockSessionCacheSet(SslSessionCache* cache, const uint8_t* id, uint32_t idLength, SslSessionCacheShard** shard)
+{
+    uint32_t hash = HashSessionId(id, idLength);
+    *shard = &cache->shards[hash % (uint32_t)cache->shardCount];
+    pthread_mutex_lock(&(*shard)->lock);
+
+    uint32_t set = (hash / (uint32_t)cache->shardCount) % (uint32_t)cache->setsPerShard;
+    return &(*shard)->entries[set * SSL_SESSION_CACHE_WAYS];
+}
+
+static SslSessionCacheEntry* FindSessionCacheEntry(SslSessionCacheEntry* set, const uint8_t* id, uint32_t idLength)
+{
+    for (int32_t i = 0; i < SSL_SESSION_CACHE_WAYS; i++)
+    {
+        if (set[i].data != NULL && set[i].idLength == idLength && memcmp(set[i].id, id, idLength) == 0)
+        {
+            return &set[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void ClearSessionCacheEntry(SslSessionCacheEntry* entry)
+{
+    free(entry->data);
+    entry->data = NULL;
+    entry->dataLength = 0;
+    entry->idLength = 0;
+}
+
+static SslSessionCache* GetSessionCache(SSL_CTX* ctx)
+{
+    return (SslSessionCache*)SSL_CTX_get_ex_data(ctx, g_ssl_ctx_session_cache_index);
+}
+
+static int SessionCacheNewCallback(SSL* ssl, SSL_SESSION* session)
+{
+    SslSessionCache* cache = GetSessionCache(SSL_get_SSL_CTX(ssl));
+    unsigned int idLength;
+    const unsigned char* id = SSL_SESSION_get_id(session, &idLength);
+    int dataLength = i2d_SSL_SESSION(session, NULL);
+
+    if (cache == NULL || idLength == 0 || idLength > SSL_MAX_SSL_SESSION_ID_LENGTH || dataLength <= 0)
+    {
+        return 0;
+    }
+
+    uint8_t* data = (uint8_t*)malloc((size_t)dataLength);
+    if (data == NULL)
+    {
+        return 0;
+    }
+
+    unsigned char* cursor = data;
+    i2d_SSL_SESSION(session, &cursor);
+
+    SslSessionCacheShard* shard;
+    SslSessionCacheEntry* set = LockSessionCacheSet(cache, id, idLength, &shard);
+    SslSessionCacheEntry* entry = FindSessionCacheEntry(set, id, idLength);
+
+    if (entry == NULL)
+    {
+        entry = &set[0];
+        for (int32_t i = 0; i < SSL_SESSION_CACHE_WAYS; i++)
+        {
+            if (set[i].data == NULL)
+            {
+                entry = &set[i];
+                break;
+            }
+
+            if (set[i].stamp < entry->stamp)
+            {
+                entry = &set[i];
+            }
+        }
+    }
+
+    ClearSessionCacheEntry(entry);
+    memcpy(entry->id, id, idLength);
+    entry->idLength = idLength;
+    entry->data = data;
+    entry->dataLength = dataLength;
+    entry->stamp = ++shard->stamp;
+
+    pthread_mutex_unlock(&shard->lock);
+
+    // The cache holds a serialized copy, not the session itself.
+    return 0;
+}
+
+static SSL_SESSION* SessionCacheGetCallback(SSL* ssl, const unsigned char* id, int idLength, int* copy)
+{
+    SslSessionCache* cache = GetSessionCache(SSL_get_SSL_CTX(ssl));
+
+    // The returned session is a new one the caller takes ownership of.
+    *copy = 0;
+
+    if (cache == NULL || idLength <= 0 || idLength > SSL_MAX_SSL_SESSION_ID_LENGTH)
+    {
+        return NULL;
+    }
+
+    SSL_SESSION* session = NULL;
+    SslSessionCacheShard* shard;
+    SslSessionCacheEntry* set = LockSessionCacheSet(cache, id, (uint32_t)idLength, &shard);
+    SslSessionCacheEntry* entry = FindSessionCacheEntry(set, id, (uint32_t)idLength);
+
+    if (entry != NULL)
+    {
+        // OpenSSL checks the timeout of the session before resuming it.
+        const unsigned char* cursor = entry->data;
+        session = d2i_SSL_SESSION(NULL, &cursor, entry->dataLength);
+    }
+
+    pthread_mutex_unlock(&shard->lock);
+    return session;
+}
+
+static void SessionCacheRemoveCallback(SSL_CTX* ctx, SSL_SESSION* session)
+{
+    SslSessionCache* cache = GetSessionCache(ctx);
+    unsigned int idLength;
+    const unsigned char* id = SSL_SESSION_get_id(session, &idLength);
+
+    if (cache == NULL || idLength == 0 || idLength > SSL_MAX_SSL_SESSION_ID_LENGTH)
+    {
+        return;
+    }
+
+    SslSessionCacheShard* shard;
+    SslSessionCacheEntry* set = LockSessionCacheSet(cache, id, idLength, &shard);
+    SslSessionCacheEntry* entry = FindSessionCacheEntry(set, id, idLength);
+
+    if (entry != NULL)
+    {
+        ClearSessionCacheEntry(entry);
+    }
+
+    pthread_mutex_unlock(&shard->lock);
+}
+
+SslSessionCache* CryptoNative_SslSessionCacheCreate(int32_t capacity, int32_t shardCount)
+{
+    ERR_clear_error();
+
+    if (capacity <= 0)
+    {
+        return NULL;
+    }
+
+    if (shardCount <= 0)
+    {
+        shardCount = SSL_SESSION_CACHE_DEFAULT_SHARDS;
+    }
+
+    int32_t perShard = (capacity + shardCount - 1) / shardCount;
+    int32_t setsPerShard = (perShard + SSL_SESSION_CACHE_WAYS - 1) / SSL_SESSION_CACHE_WAYS;
+
+    SslSessionCache* cache = (SslSessionCache*)calloc(1, sizeof(SslSessionCache));
+    if (cache == NULL)
+    {
+        return NULL;
+    }
+
+    cache->shards = (SslSessionCacheShard*)calloc((size_t)shardCount, sizeof(SslSessionCacheShard));
+    if (cache->shards == NULL || RAND_bytes(cache->ticketKeys, sizeof(cache->ticketKeys)) != 1)
+    {
+        free(cache->shards);
+        free(cache);
+        return NULL;
+    }
+
+    cache->setsPerShard = setsPerShard;
+
+    for (; cache->shardCount < shardCount; cache->shardCount++)
+    {
+        SslSessionCacheShard* shard = &cache->shards[cache->shardCount];
+        shard->entries = (SslSessionCacheEntry*)calloc((size_t)setsPerShard * SSL_SESSION_CACHE_WAYS, sizeof(SslSessionCacheEntry));
+        if (shard->entries == NULL || pthread_mutex_init(&shard->lock, NULL) != 0)
+        {
+            free(shard->entries);
+            CryptoNative_SslSessionCacheDestroy(cache);
+            return NULL;
+        }
+    }
+
+    return cache;
+}
+
+void CryptoNative_SslSessionCacheDestroy(SslSessionCache* cache)
+{
+    if (cache == NULL)
+    {
+        return;
+    }
+
+    for (int32_t i = 0; i < cache->shardCount; i++)
+    {
+        SslSessionCacheShard* shard = &cache->shards[i];
+        for (int32_t j = 0; j < cache->setsPerShard * SSL_SESSION_CACHE_WAYS; j++)
+        {
+            free(shard->entries[j].data);
+        }
+
+        free(shard->entries);
+        pthread_mutex_destroy(&shard->lock);
+    }
+
+    OPENSSL_cleanse(cache->ticketKeys, sizeof(cache->ticketKeys));
+    free(cache->shards);
+    free(cache);
+}
+
+int32_t CryptoNative_SslCtxSetSessionCache(SSL_CTX* ctx, SslSessionCache* cache, int32_t contextIdLength, uint8_t* contextId)
+{
+    ERR_clear_error();
+
+    if (ctx == NULL || cache == NULL || !SSL_CTX_set_ex_data(ctx, g_ssl_ctx_session_cache_index, cache))
+    {
+        return 0;
+    }
+
+    // OpenSSL 1.0 tickets use 48 bytes of keys, 1.1.0+ use 80 bytes.
+    long ticketKeysLength = CryptoNative_OpenSslVersionNumber() >= OPENSSL_VERSION_1_1_0_RTM ? SSL_TICKET_KEYS_LENGTH : SSL_TICKET_KEYS_LENGTH_1_0;
+    if (SSL_CTX_ctrl(ctx, SSL_CTRL_SET_TLSEXT_TICKET_KEYS, ticketKeysLength, cache->ticketKeys) != 1)
+    {
+        return 0;
+    }
+
+    if (contextIdLength > 0 && contextId != NULL)
+    {
+        SSL_CTX_set_session_id_context(ctx, contextId, contextIdLength <= SSL_MAX_SID_CTX_LENGTH ? (unsigned int)contextIdLength : SSL_MAX_SID_CTX_LENGTH);
+    }
+
+    SSL_CTX_ctrl(ctx, SSL_CTRL_SET_SESS_CACHE_MODE, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL, NULL);
+    SSL_CTX_sess_set_new_cb(ctx, SessionCacheNewCallback);
+    SSL_CTX_sess_set_get_cb(ctx, SessionCacheGetCallback);
+    SSL_CTX_sess_set_remove_cb(ctx, SessionCacheRemoveCallback);
+    return 1;
+}
+
 const char* CryptoNative_SslGetServerName(SSL* ssl)
 {
     return SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
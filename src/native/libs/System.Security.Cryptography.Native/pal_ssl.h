@@ -9,6 +9,9 @@
 // we need dedicated index in order to tell OpenSSL how to copy the pointer during SSL_SESSION_dup.
 extern int g_ssl_sess_cert_index;
 
+// index for storing the SslSessionCache a server SSL_CTX shares sessions through.
+extern int g_ssl_ctx_session_cache_index;
+
 /*
 These values should be kept in sync with System.Security.Authentication.SslProtocols.
 */
@@ -131,6 +134,19 @@ typedef void (*SslCtxRemoveSessionCallback)(SSL_CTX* ctx, SSL_SESSION* session);
 // the function pointer for keylog
 typedef void (*SslCtxSetKeylogCallback)(const SSL* ssl, const char *line);
 
+// A server-side session cache shared by any number of SSL_CTXs, see CryptoNative_SslSessionCacheCreate.
+typedef struct SslSessionCache SslSessionCache;
+
+/*
+Flags returned by CryptoNative_SslGetKtlsStatus.
+*/
+typedef enum
+{
+    PAL_SSL_KTLS_NONE = 0,
+    PAL_SSL_KTLS_SEND = 1,
+    PAL_SSL_KTLS_RECEIVE = 2,
+} SslKtlsStatus;
+
 /*
 Ensures that libssl is correctly initialized and ready to use.
 */
@@ -176,6 +192,29 @@ Removes a session from internal cache.
 */
 PALEXPORT int CryptoNative_SslCtxRemoveSession(SSL_CTX* ctx, SSL_SESSION* session);
 
+/*
+Creates a server session cache for up to capacity sessions, split into shardCount independently
+locked shards (16 if shardCount is 0 or less) so that handshakes on many threads don't contend on one
+lock. The cache also holds a random set of session ticket keys, so a ticket issued by one SSL_CTX
+using the cache can be resumed by any other.
+
+Returns NULL on failure.
+*/
+PALEXPORT SslSessionCache* CryptoNative_SslSessionCacheCreate(int32_t capacity, int32_t shardCount);
+
+/*
+Frees the cache and the sessions in it. Every SSL_CTX using the cache must have been freed.
+*/
+PALEXPORT void CryptoNative_SslSessionCacheDestroy(SslSessionCache* cache);
+
+/*
+Makes the server SSL_CTX store and look up sessions in cache instead of its internal cache, and issue
+session tickets with the cache's ticket keys. The cache must outlive ctx.
+
+Returns 1 on success, 0 on failure.
+*/
+PALEXPORT int32_t CryptoNative_SslCtxSetSessionCache(SSL_CTX* ctx, SslSessionCache* cache, int32_t contextIdLength, uint8_t* contextId);
+
 /*
 Sets callback to log TLS session keys
 */
@@ -310,6 +349,38 @@ Shims the SSL_set_bio method.
 */
 PALEXPORT void CryptoNative_SslSetBio(SSL* ssl, BIO* rbio, BIO* wbio);
 
+/*
+Shims the SSL_set_fd method, which makes ssl do its own I/O on the socket fd. A socket is what
+kernel TLS offload needs; memory BIOs always encrypt in user space.
+
+Returns 1 on success, 0 on failure.
+*/
+PALEXPORT int32_t CryptoNative_SslSetFd(SSL* ssl, int32_t fd);
+
+/*
+Sets SSL_OP_ENABLE_KTLS on ctx, so that connections using a socket (see CryptoNative_SslSetFd) hand
+record encryption and decryption to the kernel after the handshake when the cipher, the kernel and
+OpenSSL support it.
+
+Returns 1 if the OpenSSL in use supports kernel TLS, 0 otherwise.
+*/
+PALEXPORT int32_t CryptoNative_SslCtxEnableKtls(SSL_CTX* ctx);
+
+/*
+Returns the SslKtlsStatus of ssl, which tells whether records are encrypted and decrypted by the
+kernel. Only meaningful once the handshake has completed.
+*/
+PALEXPORT int32_t CryptoNative_SslGetKtlsStatus(SSL* ssl);
+
+/*
+Shims the SSL_sendfile method, which sends size bytes of the file fd starting at offset without
+copying them to user space. Requires kernel TLS for sending (see CryptoNative_SslGetKtlsStatus).
+
+Returns the positive number of bytes sent when successful, 0 or a negative number when an error
+is encountered, with error set as for CryptoNative_SslWrite.
+*/
+PALEXPORT int64_t CryptoNative_SslSendFile(SSL* ssl, int32_t fd, int64_t offset, int64_t size, int32_t* error);
+
 /*
 Shims the SSL_do_handshake method.
 
@@ -3,6 +3,7 @@ include(CheckIncludeFiles)
 include(CheckSymbolExists)
 
 check_include_files("sys/auxv.h;asm/hwcap.h" HAVE_AUXV_HWCAP_H)
+check_include_files("linux/perf_event.h" HAVE_LINUX_PERF_EVENT_H)
 check_function_exists(sysctlbyname HAVE_SYSCTLBYNAME)
 
 check_symbol_exists(arc4random_buf "stdlib.h" HAVE_ARC4RANDOM_BUF)
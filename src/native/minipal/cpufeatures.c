@@ -99,6 +99,28 @@ static uint32_t avx512StateSupport()
 #endif
 }
 
+#if defined(HOST_AMD64)
+#ifndef XSTATE_MASK_APX
+#define XSTATE_MASK_APX (0x80000) /* 1 << 19 */
+#endif // XSTATE_MASK_APX
+
+static uint32_t apxStateSupport()
+{
+#if defined(HOST_APPLE)
+    return false;
+#else
+    uint32_t eax;
+    __asm("  xgetbv\n" \
+        : "=a"(eax) /*output in eax*/\
+        : "c"(0) /*inputs - 0 in ecx*/\
+        : "edx" /* registers that are clobbered*/
+      );
+    // check OS has enabled the extended GPR (R16-R31) state support
+    return ((eax & XSTATE_MASK_APX) == XSTATE_MASK_APX) ? 1 : 0;
+#endif
+}
+#endif // HOST_AMD64
+
 static bool IsAvxEnabled()
 {
     return true;
@@ -125,6 +147,18 @@ static uint32_t avx512StateSupport()
     return ((_xgetbv(0) & 0xE6) == 0x0E6) ? 1 : 0;
 }
 
+#if defined(HOST_AMD64)
+#ifndef XSTATE_MASK_APX
+#define XSTATE_MASK_APX (0x80000) /* 1 << 19 */
+#endif // XSTATE_MASK_APX
+
+static uint32_t apxStateSupport()
+{
+    // check OS has enabled the extended GPR (R16-R31) state support
+    return ((_xgetbv(0) & XSTATE_MASK_APX) == XSTATE_MASK_APX) ? 1 : 0;
+}
+#endif // HOST_AMD64
+
 static bool IsAvxEnabled()
 {
     DWORD64 FeatureMask = GetEnabledXStateFeatures();
@@ -297,6 +331,15 @@ int minipal_getcpufeatures(void)
         {
             result |= XArchIntrinsicConstants_Serialize;                                               // SERIALIZE
         }
+
+#if defined(HOST_AMD64)
+        __cpuidex(cpuidInfo, 0x00000007, 0x00000001);
+
+        if (((cpuidInfo[CPUID_EDX] & (1 << 21)) != 0) && (apxStateSupport() == 1))                    // APX_F
+        {
+            result |= XArchIntrinsicConstants_Apx;
+        }
+#endif // HOST_AMD64
     }
 
     __cpuid(cpuidInfo, 0x80000000);
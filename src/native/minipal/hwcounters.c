@@ -0,0 +1,134 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include <stdlib.h>
+#include <string.h>
+#include <minipal/hwcounters.h>
+
+#ifndef HOST_WINDOWS
+#include "minipalconfig.h"
+#endif
+
+#if HAVE_LINUX_PERF_EVENT_H
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+struct minipal_thread_hw_counters
+{
+    // The cycles counter leads the group, so that all counters are scheduled on the PMU
+    // together and read with one system call.
+    int fds[minipal_hw_counter_count];
+
+    // The index of each counter's value in a group read, -1 for counters that couldn't be opened
+    int read_index[minipal_hw_counter_count];
+    int opened_count;
+};
+
+static const uint64_t s_hw_counter_configs[minipal_hw_counter_count] =
+{
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+static int open_counter(uint64_t config, uint64_t tid, int group_fd)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    return (int)syscall(__NR_perf_event_open, &attr, (pid_t)tid, -1 /* cpu */, group_fd, PERF_FLAG_FD_CLOEXEC);
+}
+
+minipal_thread_hw_counters* minipal_thread_hw_counters_open(uint64_t tid)
+{
+    minipal_thread_hw_counters* counters = (minipal_thread_hw_counters*)malloc(sizeof(minipal_thread_hw_counters));
+    if (counters == NULL)
+        return NULL;
+
+    counters->opened_count = 0;
+    for (int i = 0; i < minipal_hw_counter_count; i++)
+    {
+        counters->read_index[i] = -1;
+        counters->fds[i] = open_counter(s_hw_counter_configs[i], tid, i == 0 ? -1 : counters->fds[0]);
+        if (counters->fds[i] >= 0)
+        {
+            counters->read_index[i] = counters->opened_count++;
+        }
+        else if (i == 0)
+        {
+            // Without the group leader the PMU or the thread is not available
+            free(counters);
+            return NULL;
+        }
+    }
+
+    return counters;
+}
+
+bool minipal_thread_hw_counters_read(minipal_thread_hw_counters* counters, uint64_t* values)
+{
+    // nr, time_enabled, time_running, then a value per counter of the group
+    uint64_t data[3 + minipal_hw_counter_count];
+    ssize_t size = read(counters->fds[0], data, sizeof(data));
+    if (size < (ssize_t)((3 + counters->opened_count) * sizeof(uint64_t)))
+        return false;
+
+    uint64_t time_enabled = data[1];
+    uint64_t time_running = data[2];
+    for (int i = 0; i < minipal_hw_counter_count; i++)
+    {
+        uint64_t value = counters->read_index[i] >= 0 ? data[3 + counters->read_index[i]] : 0;
+        if (time_running != 0 && time_running < time_enabled)
+            value = (uint64_t)((double)value * time_enabled / time_running);
+
+        values[i] = value;
+    }
+
+    return true;
+}
+
+void minipal_thread_hw_counters_close(minipal_thread_hw_counters* counters)
+{
+    if (counters == NULL)
+        return;
+
+    // Members first, the group is torn down with its leader.
+    for (int i = minipal_hw_counter_count - 1; i >= 0; i--)
+    {
+        if (counters->fds[i] >= 0)
+            close(counters->fds[i]);
+    }
+
+    free(counters);
+}
+
+#else // HAVE_LINUX_PERF_EVENT_H
+
+minipal_thread_hw_counters* minipal_thread_hw_counters_open(uint64_t tid)
+{
+    (void)tid;
+    return NULL;
+}
+
+bool minipal_thread_hw_counters_read(minipal_thread_hw_counters* counters, uint64_t* values)
+{
+    (void)counters;
+    (void)values;
+    return false;
+}
+
+void minipal_thread_hw_counters_close(minipal_thread_hw_counters* counters)
+{
+    (void)counters;
+}
+
+#endif // HAVE_LINUX_PERF_EVENT_H
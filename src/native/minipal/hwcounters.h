@@ -0,0 +1,43 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef HAVE_MINIPAL_HWCOUNTERS_H
+#define HAVE_MINIPAL_HWCOUNTERS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+    // The hardware counters of a thread, in the order of their values
+    typedef enum
+    {
+        minipal_hw_counter_cycles,
+        minipal_hw_counter_instructions,
+        minipal_hw_counter_cache_misses,  // Last level cache
+        minipal_hw_counter_branch_misses,
+        minipal_hw_counter_count
+    } minipal_hw_counter;
+
+    typedef struct minipal_thread_hw_counters minipal_thread_hw_counters;
+
+    // Starts counting user mode events of the thread with the given OS thread id. The calling
+    // thread doesn't need to be the counted thread. Uses perf_event_open on Linux, returns NULL
+    // elsewhere or when the counters are not available (e.g. restricted by perf_event_paranoid).
+    minipal_thread_hw_counters* minipal_thread_hw_counters_open(uint64_t tid);
+
+    // Reads the counts since the counters were opened into values[minipal_hw_counter_count].
+    // Counts are scaled up when the kernel multiplexed the counters with other users of the PMU,
+    // and are 0 for counters the CPU doesn't have.
+    bool minipal_thread_hw_counters_read(minipal_thread_hw_counters* counters, uint64_t* values);
+
+    void minipal_thread_hw_counters_close(minipal_thread_hw_counters* counters);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif /* HAVE_MINIPAL_HWCOUNTERS_H */
@@ -8,6 +8,16 @@
 #include <string.h>
 #include <assert.h>
 
+#if !BIGENDIAN
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UTF8_ASCII_SSE2 1
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define UTF8_ASCII_NEON 1
+#endif
+#endif // !BIGENDIAN
+
 #define HIGH_SURROGATE_START 0xd800
 #define HIGH_SURROGATE_END 0xdbff
 #define LOW_SURROGATE_START 0xdc00
@@ -2055,6 +2065,137 @@ static size_t GetByteCount(UTF8Encoding* self, CHAR16_T *chars, size_t count)
     return byteCount;
 }
 
+// Most strings handed to the converters are entirely, or start with, ASCII. The ASCII prefix is
+// converted 16 code units at a time before the general converters, which see the rest of the string
+// starting at a code point boundary with no pending state. The prefix never needs a fallback, so the
+// results and errors are the same as those of the general converters alone. Byte order only matters
+// for UTF-16, and the prefix is never used on big-endian hosts.
+
+// Widens the ASCII prefix of the first count bytes of src into dst, returns its length.
+static size_t WidenAsciiPrefix(const unsigned char* src, CHAR16_T* dst, size_t count)
+{
+    size_t i = 0;
+
+#if UTF8_ASCII_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(src + i));
+        if (_mm_movemask_epi8(bytes) != 0)
+            break;
+
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128((__m128i*)(dst + i + 8), _mm_unpackhi_epi8(bytes, zero));
+    }
+#elif UTF8_ASCII_NEON
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16_t bytes = vld1q_u8(src + i);
+        if (vmaxvq_u8(bytes) >= 0x80)
+            break;
+
+        vst1q_u16((uint16_t*)(dst + i), vmovl_u8(vget_low_u8(bytes)));
+        vst1q_u16((uint16_t*)(dst + i + 8), vmovl_high_u8(bytes));
+    }
+#endif
+
+    for (; i < count && src[i] < 0x80; i++)
+    {
+        dst[i] = (CHAR16_T)src[i];
+    }
+
+    return i;
+}
+
+// Narrows the ASCII prefix of the first count code units of src into dst, returns its length.
+static size_t NarrowAsciiPrefix(const CHAR16_T* src, unsigned char* dst, size_t count)
+{
+    size_t i = 0;
+
+#if UTF8_ASCII_SSE2
+    const __m128i nonAsciiMask = _mm_set1_epi16((short)0xFF80);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i low = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i high = _mm_loadu_si128((const __m128i*)(src + i + 8));
+        __m128i nonAscii = _mm_and_si128(_mm_or_si128(low, high), nonAsciiMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, zero)) != 0xFFFF)
+            break;
+
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(low, high));
+    }
+#elif UTF8_ASCII_NEON
+    for (; i + 16 <= count; i += 16)
+    {
+        uint16x8_t low = vld1q_u16((const uint16_t*)(src + i));
+        uint16x8_t high = vld1q_u16((const uint16_t*)(src + i + 8));
+        if (vmaxvq_u16(vorrq_u16(low, high)) >= 0x80)
+            break;
+
+        vst1q_u8(dst + i, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+    }
+#endif
+
+    for (; i < count && src[i] < 0x80; i++)
+    {
+        dst[i] = (unsigned char)src[i];
+    }
+
+    return i;
+}
+
+// Returns the length of the ASCII prefix of the first count bytes of src.
+static size_t GetAsciiPrefixLength(const unsigned char* src, size_t count)
+{
+    size_t i = 0;
+
+#if UTF8_ASCII_SSE2
+    for (; i + 16 <= count; i += 16)
+    {
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(src + i))) != 0)
+            break;
+    }
+#elif UTF8_ASCII_NEON
+    for (; i + 16 <= count; i += 16)
+    {
+        if (vmaxvq_u8(vld1q_u8(src + i)) >= 0x80)
+            break;
+    }
+#endif
+
+    for (; i < count && src[i] < 0x80; i++);
+
+    return i;
+}
+
+// Returns the length of the ASCII prefix of the first count code units of src.
+static size_t GetAsciiPrefixLengthUtf16(const CHAR16_T* src, size_t count)
+{
+    size_t i = 0;
+
+#if UTF8_ASCII_SSE2
+    const __m128i nonAsciiMask = _mm_set1_epi16((short)0xFF80);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i nonAscii = _mm_and_si128(_mm_loadu_si128((const __m128i*)(src + i)), nonAsciiMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, zero)) != 0xFFFF)
+            break;
+    }
+#elif UTF8_ASCII_NEON
+    for (; i + 8 <= count; i += 8)
+    {
+        if (vmaxvq_u16(vld1q_u16((const uint16_t*)(src + i))) >= 0x80)
+            break;
+    }
+#endif
+
+    for (; i < count && src[i] < 0x80; i++);
+
+    return i;
+}
+
 size_t minipal_get_length_utf8_to_utf16(const char* source, size_t sourceLength, unsigned int flags)
 {
     errno = 0;
@@ -2062,6 +2203,14 @@ size_t minipal_get_length_utf8_to_utf16(const char* source, size_t sourceLength,
     if (sourceLength == 0)
         return 0;
 
+#if !BIGENDIAN
+    size_t asciiLength = GetAsciiPrefixLength((const unsigned char*)source, sourceLength);
+    if (asciiLength == sourceLength)
+        return asciiLength;
+#else
+    size_t asciiLength = 0;
+#endif
+
     UTF8Encoding enc =
     {
         .buffer = { .decoder = { .fallbackCount = -1, .fallbackIndex = -1, .strDefault = { 0xFFFD, 0 }, .strDefaultLength = 1 } },
@@ -2071,7 +2220,7 @@ size_t minipal_get_length_utf8_to_utf16(const char* source, size_t sourceLength,
 #endif
     };
 
-    return GetCharCount(&enc, (unsigned char*)source, sourceLength);
+    return asciiLength + GetCharCount(&enc, (unsigned char*)source + asciiLength, sourceLength - asciiLength);
 }
 
 size_t minipal_get_length_utf16_to_utf8(const CHAR16_T* source, size_t sourceLength, unsigned int flags)
@@ -2081,6 +2230,14 @@ size_t minipal_get_length_utf16_to_utf8(const CHAR16_T* source, size_t sourceLen
     if (sourceLength == 0)
         return 0;
 
+#if !BIGENDIAN
+    size_t asciiLength = GetAsciiPrefixLengthUtf16(source, sourceLength);
+    if (asciiLength == sourceLength)
+        return asciiLength;
+#else
+    size_t asciiLength = 0;
+#endif
+
     UTF8Encoding enc =
     {
         // repeat replacement char (0xFFFD) twice for a surrogate pair
@@ -2095,7 +2252,7 @@ size_t minipal_get_length_utf16_to_utf8(const CHAR16_T* source, size_t sourceLen
     (void)flags; // unused
 #endif
 
-    return GetByteCount(&enc, (CHAR16_T*)source, sourceLength);
+    return asciiLength + GetByteCount(&enc, (CHAR16_T*)source + asciiLength, sourceLength - asciiLength);
 }
 
 size_t minipal_convert_utf8_to_utf16(const char* source, size_t sourceLength, CHAR16_T* destination, size_t destinationLength, unsigned int flags)
@@ -2106,6 +2263,15 @@ size_t minipal_convert_utf8_to_utf16(const char* source, size_t sourceLength, CH
     if (sourceLength == 0)
         return 0;
 
+#if !BIGENDIAN
+    size_t asciiLength = WidenAsciiPrefix((const unsigned char*)source, destination,
+        sourceLength < destinationLength ? sourceLength : destinationLength);
+    if (asciiLength == sourceLength)
+        return asciiLength;
+#else
+    size_t asciiLength = 0;
+#endif
+
     UTF8Encoding enc =
     {
         .buffer = { .decoder = { .fallbackCount = -1, .fallbackIndex = -1, .strDefault = { 0xFFFD, 0 }, .strDefaultLength = 1 } },
@@ -2115,20 +2281,16 @@ size_t minipal_convert_utf8_to_utf16(const char* source, size_t sourceLength, CH
 #endif
     };
 
-    ret = GetChars(&enc, (unsigned char*)source, sourceLength, destination, destinationLength);
-    if (errno) ret = 0;
+    ret = GetChars(&enc, (unsigned char*)source + asciiLength, sourceLength - asciiLength,
+        destination + asciiLength, destinationLength - asciiLength);
+    ret = errno ? 0 : asciiLength + ret;
 
     return ret;
 }
 
-size_t minipal_convert_utf16_to_utf8(const CHAR16_T* source, size_t sourceLength, char* destination, size_t destinationLength, unsigned int flags)
+// The general converter for minipal_convert_utf16_to_utf8, which may have to run twice
+static size_t ConvertUtf16ToUtf8(const CHAR16_T* source, size_t sourceLength, char* destination, size_t destinationLength, unsigned int flags)
 {
-    size_t ret;
-    errno = 0;
-
-    if (sourceLength == 0)
-        return 0;
-
     UTF8Encoding enc =
     {
         // repeat replacement char (0xFFFD) twice for a surrogate pair
@@ -2143,8 +2305,41 @@ size_t minipal_convert_utf16_to_utf8(const CHAR16_T* source, size_t sourceLength
     (void)flags; // unused
 #endif
 
-    ret = GetBytes(&enc, (CHAR16_T*)source, sourceLength, (unsigned char*)destination, destinationLength);
-    if (errno) ret = 0;
+    return GetBytes(&enc, (CHAR16_T*)source, sourceLength, (unsigned char*)destination, destinationLength);
+}
+
+size_t minipal_convert_utf16_to_utf8(const CHAR16_T* source, size_t sourceLength, char* destination, size_t destinationLength, unsigned int flags)
+{
+    size_t ret;
+    errno = 0;
+
+    if (sourceLength == 0)
+        return 0;
+
+#if !BIGENDIAN
+    size_t asciiLength = NarrowAsciiPrefix(source, (unsigned char*)destination,
+        sourceLength < destinationLength ? sourceLength : destinationLength);
+    if (asciiLength == sourceLength)
+        return asciiLength;
+
+    ret = ConvertUtf16ToUtf8(source + asciiLength, sourceLength - asciiLength,
+        destination + asciiLength, destinationLength - asciiLength, flags);
+
+    if (errno == MINIPAL_ERROR_INSUFFICIENT_BUFFER && asciiLength != 0)
+    {
+        // Depending on where it runs out of space, GetBytes either fails or truncates the output, and
+        // the bytes already written for the prefix change which one it does. Convert the whole string
+        // instead to get the same result as without the prefix.
+        errno = 0;
+        asciiLength = 0;
+        ret = ConvertUtf16ToUtf8(source, sourceLength, destination, destinationLength, flags);
+    }
+#else
+    size_t asciiLength = 0;
+    ret = ConvertUtf16ToUtf8(source, sourceLength, destination, destinationLength, flags);
+#endif
+
+    ret = errno ? 0 : asciiLength + ret;
 
     return ret;
 }